@@ -0,0 +1,110 @@
+//portrait/async.hh
+
+#ifndef INCLUDE_PORTRAIT_ASYNC_HH
+#define INCLUDE_PORTRAIT_ASYNC_HH
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+/* 取消异步处理的标志。复制的实例共享同一个标志，
+ * 调用者保留一份，放入AsyncOptions的一份由处理线程检查。
+ */
+class CancelToken
+{
+public:
+    CancelToken();
+    //取消（可在任意线程调用），处理在下一个检查点以Error(Cancelled)结束
+    void Cancel();
+    bool IsCancelled() const;
+private:
+    std::shared_ptr<std::atomic<bool> > _cancelled;
+}; //class CancelToken
+
+/* 异步处理的选项
+ */
+struct AsyncOptions
+{
+    typedef std::chrono::steady_clock Clock;
+
+    /* 期限，在检查点之间超过期限时停止，默认不限。
+     * 检查点：人脸检测之后、GrabCut初始化之后、GrabCut的每次迭代之后、
+     * 边缘混合（MatBorder）的每一步之前；单个步骤不会被打断，
+     * 因此实际结束的时间可能略晚于期限。
+     */
+    Clock::time_point deadline;
+    CancelToken cancel;
+    /* 超过期限时，已经完成至少一次GrabCut迭代的，
+     * 是否返回已有的最好结果（跳过余下的迭代，或以羽化边缘代替边缘混合），
+     * 否则以Error(Timeout)结束。
+     */
+    bool allow_partial;
+    /* 按期限自动降低质量：人脸检测之后，按剩余的时间和耗时模型
+     * （按抠图分辨率估计各阶段的耗时，再按最近实际测得的耗时整体校正，反映当前负载）
+     * 依次减少GrabCut迭代次数、降低抠图分辨率、以羽化代替边缘混合，
+     * 直到估计的耗时不超过期限；输出分辨率（face_resize_to）不变。
+     * 选择的参数报告在AsyncSemiResult::quality中。没有设置deadline时不起作用。
+     */
+    bool adaptive;
+
+    AsyncOptions();
+    //从现在起milliseconds毫秒后的期限
+    static Clock::time_point After(int milliseconds);
+};
+
+/* 实际使用的抠图参数（AsyncOptions::adaptive的选择）
+ */
+struct QualityChoice
+{
+    bool degraded;                  //是否低于profile的质量
+    int matting_face_size;          //抠图分辨率（人脸边长，像素），0表示在输出分辨率抠图
+    int grabcut_iterations;         //GrabCut迭代次数
+    MattingBackend matting_backend; //边缘混合算法
+    double budget_ms;               //人脸检测之后剩余的时间（毫秒），没有按期限选择时为0
+    double estimated_ms;            //按耗时模型估计的抠图耗时（毫秒），没有按期限选择时为0
+};
+
+/* 异步处理的结果
+ */
+struct AsyncSemiResult
+{
+    SemiData semi;
+    bool partial;          //是否因超过期限而返回了部分结果（边缘较粗糙）
+    QualityChoice quality; //实际使用的抠图参数
+};
+
+/* 异步执行PortraitProcessSemi，返回的future取得结果或异常
+ * （意义同PortraitProcessSemi，另有超时的Error(Timeout)、取消的Error(Cancelled)）。
+ * 在库内部的线程池（线程数同CPU核数）中执行，任务按提交的顺序开始；
+ * 开始前（在队列中等待期间）已超时或已取消的任务不执行。
+ * photo与任务共享数据（同cv::Mat赋值），完成前不应修改其内容。
+ * 多个任务同时执行时，人脸检测只有profile.face_detector为FaceDetectorNative时并发执行；
+ * FaceDetectorOpenCV使用的cv::CascadeClassifier不是线程安全的，各任务的检测逐个执行
+ * （FaceDetectorNative的限制见FaceDetector的说明）。
+ */
+std::future<AsyncSemiResult> PortraitProcessSemiAsync(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const AsyncOptions& options = AsyncOptions(),
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+//指定裁剪规格的版本，参数意义同PortraitProcessSemi
+std::future<AsyncSemiResult> PortraitProcessSemiAsync(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const AsyncOptions& options = AsyncOptions(),
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+}  //namespace portrait
+
+#endif
@@ -8,7 +8,10 @@ enum ErrorType
 {
     FaceNotFound = 1, //找不到人脸
     TooManyFaces = 2, //找到超过一个人脸
-    OutOfRange = 3    //越界
+    OutOfRange = 3,   //越界
+    InvalidData = 4,  //数据无效（例如SemiData::Deserialize的数据损坏或版本不支持）
+    Timeout = 5,      //超过异步处理的期限（AsyncOptions::deadline）
+    Cancelled = 6     //异步处理被取消（CancelToken::Cancel）
 };
 
 class Error : public std::logic_error
@@ -3,8 +3,12 @@
 #ifndef INCLUDE_PORTRAIT_PROTRAIT_HH
 #define INCLUDE_PORTRAIT_PROTRAIT_HH
 
+#include "portrait/async.hh"
+#include "portrait/preview.hh"
 #include "portrait/processing.hh"
 #include "portrait/profiles.hh"
+#include "portrait/stream.hh"
+#include "portrait/tracking.hh"
 #include "portrait/exception.hh"
 
 #endif
@@ -0,0 +1,71 @@
+//portrait/preview.hh
+
+#ifndef INCLUDE_PORTRAIT_PREVIEW_HH
+#define INCLUDE_PORTRAIT_PREVIEW_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+#include "portrait/tracking.hh"
+
+namespace portrait {
+
+/* PreviewEngine::Render的结果（一帧）
+ */
+struct PreviewStats
+{
+    bool found;            //是否找到（唯一的）人脸，没有找到时output不变
+    bool rendered;         //output是否为本帧的合成结果；
+                           //false表示预计超出预算而跳过抠图，output为上一次的结果
+    cv::Rect face;         //人脸位置（帧的坐标）
+    int matting_face_size; //本帧抠图使用的人脸大小（像素）
+    double milliseconds;   //本帧的处理耗时
+};
+
+/* 拍照前的实时预览：把画面中的人像合成到目标背景上，便于被摄者调整姿势。
+ * 每帧用FaceTracker跟踪人脸，在极小的分辨率（ProcessingProfile::Preview，
+ * 人脸约64像素）以一次GrabCut迭代和羽化边缘抠图（并用VideoSession复用上一帧），
+ * 再按PortraitMix的规则合成。
+ * 每帧有耗时预算：按最近的抠图耗时估计，跟踪之后剩余的时间不足时跳过抠图，
+ * 沿用上一次的合成结果；抠图耗时接近预算时自动降低抠图分辨率，宽裕时再恢复。
+ * 单次抠图不能中途打断，因此预算是按估计执行的上限。
+ * PreviewEngine不是线程安全的，每路画面应使用各自的实例。
+ */
+class PreviewEngine
+{
+public:
+    /* target：合成的目标（裁剪规格和背景色），意义同PortraitMix
+     * face_resize_to：输出中人脸的大小，意义同PortraitProcessSemi
+     * budget_ms：每帧的耗时预算（毫秒），例如15fps为66
+     * profile：处理参数，其中的matting_face_size为抠图分辨率的上限
+     */
+    PreviewEngine(const MixTarget& target,
+                  const int face_resize_to = 200,
+                  const double budget_ms = 50,
+                  const ProcessingProfile& profile = ProcessingProfile::Preview());
+
+    /* 处理一帧，frame是CV_8UC3（BGR），各帧的尺寸应相同。
+     * 合成结果写入output（CV_8UC3，尺寸为target.crop_size），
+     * 尺寸和类型已符合时直接写入其内存空间而不重新分配。
+     */
+    PreviewStats Render(const cv::Mat& frame, cv::Mat& output);
+
+    //修改每帧的耗时预算（毫秒）
+    void SetBudget(const double budget_ms) { _budget_ms = budget_ms; }
+    double GetBudget() const { return _budget_ms; }
+private:
+    const MixTarget _target;
+    const int _face_resize_to;
+    double _budget_ms;
+    const int _max_face_size;    //抠图人脸大小的上限（profile.matting_face_size）
+    ProcessingProfile _profile;  //matting_face_size随耗时调整
+    FaceTracker _tracker;
+    VideoSession _session;
+    double _matte_ms;            //最近的抠图和合成耗时（指数平均），0表示未知
+    cv::Mat _last_output;        //上一次的合成结果
+}; //class PreviewEngine
+
+}  //namespace portrait
+
+#endif
@@ -3,8 +3,12 @@
 #ifndef INCLUDE_PORTRAIT_PROCESSING_HH
 #define INCLUDE_PORTRAIT_PROCESSING_HH
 
+#include <string>
+
 #include "opencv2/opencv.hpp"
 
+#include "portrait/profiles.hh"
+
 namespace portrait {
 
 /* 抠除人像、替换背景。
@@ -24,12 +28,14 @@ cv::Mat PortraitProcessAll(
     const int face_resize_to = 200,
     const cv::Size& crop_size = cv::Size(300,400),
     const int vertical_offset = 0,
-    const cv::Vec3b& back_color = cv::Vec3b(240,240,240));
+    const cv::Vec3b& back_color = cv::Vec3b(240,240,240),
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
 
 struct SemiDataImpl;
 
 /* 代表抠图结果，但未替换背景背景。
- * 对SemiData的修改不是线程安全的，但可以安全地并发读取。
+ * 对同一个SemiData的修改不是线程安全的，但可以安全地并发读取；
+ * 用Clone产生的副本可在其它线程中修改。
  */
 struct SemiData
 {
@@ -46,6 +52,8 @@ public:
     cv::Size GetSize() const;
     //获取人脸位置
     cv::Rect GetFaceArea() const;
+    //获取抠图实际使用的流程（纯色背景时为MattingPathColorKey）
+    MattingPath GetMattingPath() const;
     //获取替换背景前的图片，已被缩放到目标分辨率。
     //返回的Mat是副本，可被修改而不影响SemiData内部行为。
     cv::Mat GetImage() const;
@@ -55,12 +63,101 @@ public:
     cv::Mat GetAlpha() const;
     //同GetImage，增加一些用于检查抠图范围的辅助线
     cv::Mat GetImageWithLines() const;
+public:
+    /* 以下访问函数不复制数据，适合只读取的场合（例如鼠标点击时判断前景／背景）。
+     * 返回的Mat不持有内存，其内容不可修改；
+     * SemiData被修改（SetStroke、赋值）或销毁后，返回值失效。
+     * 需要修改或长期保存时，应使用上面返回副本的函数。
+     */
+    //同GetImage，但不复制
+    cv::Mat GetImageView() const;
+    //获取第y行的Alpha，共GetSize().width个元素
+    const uint8_t* GetAlphaRow(int y) const;
+    /* Alpha按行分块保存，不提供整体的视图：获取第y行所在行块的Alpha（CV_8UC1，宽同GetSize()），
+     * 行块的第一行写入first_row，下一块从first_row + 返回值.rows开始。
+     */
+    cv::Mat GetAlphaView(int y, int& first_row) const;
+public:
+    /* 产生一个副本，可以独立地SetStroke，例如并行尝试不同的关键点，或者保存编辑历史。
+     * 副本与原实例共享图像和抠图结果的内存，不复制数据；
+     * SetStroke只为内容有变化的行块分配新的内存，其余部分继续共享。
+     * 共享的数据不会被修改，因此原实例和各副本可以在不同线程中同时使用。
+     */
+    SemiData Clone() const;
+public:
+    /* 把抠图结果保存为二进制数据，可保存到文件或缓存，以后用Deserialize恢复，
+     * 恢复后可直接替换背景，不必重新抠图。
+     * 数据带版本号，图像、Alpha和边缘背景色分段用snappy压缩，
+     * Alpha先按行程编码。
+     */
+    std::string Serialize() const;
+    /* 从Serialize产生的数据恢复抠图结果。
+     * data可以直接指向用mmap映射的文件，数据只被读取，解压结果直接写入SemiData，
+     * 不产生中间副本。
+     * 若数据损坏或版本不支持，抛出异常portrait::Error(InvalidData)。
+     */
+    static SemiData Deserialize(const void* data, size_t size);
 private:
     friend struct SemiDataImpl;
     explicit SemiData(SemiDataImpl* data) throw();
     SemiDataImpl* _data;
 };
 
+struct ImagePyramidImpl;
+
+/* 处理一张照片时各阶段共用的多分辨率图像（人脸检测用的灰度图、
+ * 工作分辨率的图、GrabCut初始化和抠图尺寸的图），每张照片只生成一次。
+ * 同一个实例可在多帧之间复用（例如连续处理摄像头的画面），
+ * 照片尺寸不变时不会重新分配内存。
+ * ImagePyramid不是线程安全的，每个线程应使用各自的实例。
+ */
+struct ImagePyramid
+{
+public:
+    ImagePyramid();
+    ImagePyramid(const ImagePyramid&) = delete; //无法复制
+    ImagePyramid(ImagePyramid&& another) throw();
+    ~ImagePyramid() throw();
+    ImagePyramid& operator=(const ImagePyramid&) = delete; //无法复制
+    ImagePyramid& operator=(ImagePyramid&& another) throw();
+    void Swap(ImagePyramid& another) throw();
+private:
+    friend struct ImagePyramidImpl;
+    ImagePyramidImpl* _data;
+};
+
+struct VideoSessionImpl;
+
+/* 连续画面（例如摄像头）的抠图会话，在相邻帧之间复用抠图结果。
+ * 被摄者基本静止时，相邻帧几乎相同：按人脸的位移平移上一帧的结果作为初值，
+ * 只在画面有变化的区域附近重新执行GrabCut（迭代次数较少）和边缘混合，
+ * 每帧的耗时远小于单张照片。人脸大小变化、画面变化较多或连续复用一定帧数后，
+ * 自动完整抠图一次。
+ * 同时保存各帧共用的缩放图像（同ImagePyramid）。
+ * VideoSession不是线程安全的，每路画面应使用各自的实例。
+ */
+struct VideoSession
+{
+public:
+    VideoSession();
+    VideoSession(const VideoSession&) = delete; //无法复制
+    VideoSession(VideoSession&& another) throw();
+    ~VideoSession() throw();
+    VideoSession& operator=(const VideoSession&) = delete; //无法复制
+    VideoSession& operator=(VideoSession&& another) throw();
+    void Swap(VideoSession& another) throw();
+public:
+    //丢弃保存的结果，下一帧完整抠图（例如画面切换时）
+    void Reset();
+    //最近一帧是否复用了上一帧的结果
+    bool IsLastReused() const;
+    //最近一帧与上一帧相比有变化的像素比例（抠图分辨率）
+    double GetLastChangedRatio() const;
+private:
+    friend struct VideoSessionImpl;
+    VideoSessionImpl* _data;
+};
+
 /* PortraitProcessSemi和PortraitMix把整个处理过程分为两个阶段，
  * PortraitProcessSemi主要执行抠图，PortraitMix可以对抠图结果混合背景，
  * 因此可以单次抠图、多次混合。
@@ -74,7 +171,12 @@ private:
  * 4）执行前景和背景分离（抠图）并返回结果。
  *
  * photo：类型是CV_8UC3、格式使BGR的照片。
- * face_resize_to：指定图片被缩放后人脸的大小。
+ * face_resize_to：指定图片被缩放后人脸的大小，即输出的分辨率；
+ *                 0或负数表示保持原照片的分辨率。
+ *                 输出分辨率高于profile.matting_face_size时，
+ *                 在较低的分辨率抠图，再放大Alpha，抠图耗时不随输出分辨率增长。
+ * profile：处理参数，决定速度和质量的取舍，参见ProcessingProfile。
+ *          SemiData会记住这个参数，之后SetStroke时沿用。
  * 返回：抠图结果（中间数据）
  *
  * 若找不到人脸或者找到超过一个人脸，抛出异常：portrait::Error
@@ -82,7 +184,63 @@ private:
  */
 SemiData PortraitProcessSemi(
     const cv::Mat& photo,
-    const int face_resize_to);
+    const int face_resize_to,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+/* 同上，各阶段使用的缩放图像保存在pyramid中。
+ * 连续处理多张同尺寸的照片时，复用同一个pyramid可避免重复分配内存。
+ */
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+/* 同上，但只对crop_size、vertical_offset（意义同PortraitMix）决定的裁剪区域
+ * 及其附近的少量余量抠图，裁剪区域以外不计算，处理时间随之减少。
+ * 适用于最终的裁剪规格已知的场合，例如PortraitProcessAll。
+ * 返回的SemiData应使用同样的规格调用PortraitMix；
+ * 用更大的规格调用时，超出抠图范围的部分按扩展处理（填充背景色）。
+ */
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+//同上，各阶段使用的缩放图像保存在pyramid中
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+/* 同上，但人脸位置face_area（原照片坐标）已知，不再检测人脸，
+ * 例如使用FaceTracker对连续画面的跟踪结果。
+ */
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const cv::Rect& face_area,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+/* 同上，用于连续画面：在session中保存本帧的结果，并尽量复用上一帧的结果，
+ * 参见VideoSession。各帧应使用相同的face_resize_to、crop_size、vertical_offset和profile。
+ */
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const cv::Rect& face_area,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    VideoSession& session,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
 
 /* 设置抠图的关键点，并重新抠图。关键点可提高抠图的准确率。
  * semi：抠图结果
@@ -92,9 +250,16 @@ SemiData PortraitProcessSemi(
  *        如果是空，清空之前设置的关键点。
  *
  * 这个函数会替换之前已经设置的关键点（如果有）并重新抠图。
+ * 抠图使用PortraitProcessSemi（或上一次SetStroke）指定的处理参数。
  */
 void SetStroke(SemiData& semi, const cv::Mat& stroke);
 
+/* 同上，但使用新的处理参数profile重新抠图，之后的SetStroke也沿用这个参数。
+ * 例如编辑时用ProcessingProfile::Fast()预览，完成后用Quality()输出。
+ */
+void SetStroke(SemiData& semi, const cv::Mat& stroke,
+               const ProcessingProfile& profile);
+
 /* 检查用PortraitMix替换背景时是否完整裁剪。
  * 所谓完整裁剪，即PortraitMix裁剪时不会在除头顶之外的方向扩展，而且头顶方向也不会剪掉头发。
  * 一般来说，如果返回false，表示拍照时没有给人脸附近留有足够的空间，应重新拍照。
@@ -104,6 +269,47 @@ bool CanCropIntegrallty(
     const cv::Size& crop_size,
     const int vertical_offset);
 
+/* ValidatePhoto发现的问题，可按位组合
+ */
+enum PhotoIssue
+{
+    PhotoOK = 0,                //没有发现问题
+    PhotoNoFace = 1 << 0,       //找不到人脸
+    PhotoTooManyFaces = 1 << 1, //找到超过一个人脸
+    PhotoNoHeadroom = 1 << 2,   //人脸上方的空间不足脸高度的30%
+    PhotoCannotCrop = 1 << 3,   //按指定规格裁剪时需要扩展照片（见CanCropIntegrallty）
+    PhotoBlurry = 1 << 4,       //人脸模糊
+    PhotoUnderexposed = 1 << 5, //人脸过暗
+    PhotoOverexposed = 1 << 6   //人脸过亮
+};
+
+/* ValidatePhoto的结果
+ */
+struct PhotoValidation
+{
+    int issues;         //PhotoIssue的组合，PhotoOK表示可以处理
+    int face_count;     //检测到的人脸数，最多计到2（2表示两个或以上）
+    cv::Rect face_area; //人脸位置（原照片坐标，低分辨率检测的结果，只是近似），
+                        //face_count为1时有效
+    double sharpness;   //人脸的清晰度（缩放到固定大小后拉普拉斯响应的方差）
+    double brightness;  //人脸的平均亮度（0 ~ 255）
+};
+
+/* 在抠图之前快速检查照片是否可用，例如上传后马上提示重新拍照。
+ * 在缩小的照片上检测人脸（找到两个即停止），再按人脸位置检查
+ * 头顶空间、按crop_size和vertical_offset（意义同PortraitMix）能否完整裁剪，
+ * 以及人脸的清晰度和曝光；不执行GrabCut和边缘混合，耗时只有几毫秒。
+ * face_resize_to：意义同PortraitProcessSemi，用于换算裁剪规格
+ * profile：使用其中的人脸检测参数
+ * 不会因为照片不可用而抛出异常，问题记录在返回值中（空照片为PhotoNoFace）。
+ */
+PhotoValidation ValidatePhoto(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
 /* 背景替换。一般这个功能可以输出符合规格要求的证件照。
  * semi：抠图的结果。
  * crop_size：指定裁剪的尺寸
@@ -128,6 +334,48 @@ cv::Mat PortraitMix(
     const cv::Vec3b& back_color,
     const double mix_alpha = 1.0);
 
+/* 同上，结果写入output（类型CV_8UC3，尺寸为crop_size）。
+ * 如果output的尺寸和类型已符合，则直接写入其内存空间而不重新分配，
+ * 因此反复混合时可复用同一个output。
+ */
+void PortraitMix(
+    const SemiData& semi,
+    cv::Mat& output,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const cv::Vec3b& back_color,
+    const double mix_alpha = 1.0);
+
+/* PortraitMixMulti的一个输出目标，参数意义同PortraitMix。
+ */
+struct MixTarget
+{
+    MixTarget(const cv::Size& crop_size = cv::Size(300,400),
+              const int vertical_offset = 0,
+              const cv::Vec3b& back_color = cv::Vec3b(240,240,240),
+              const double mix_alpha = 1.0)
+        : crop_size(crop_size), vertical_offset(vertical_offset),
+          back_color(back_color), mix_alpha(mix_alpha)
+    { }
+
+    cv::Size crop_size;
+    int vertical_offset;
+    cv::Vec3b back_color;
+    double mix_alpha;
+};
+
+/* 一次输出多个背景替换结果，例如多种证件照规格和多种背景色的组合。
+ * 结果与逐个调用PortraitMix相同，但semi中的图像和Alpha只按行分块遍历一遍，
+ * 适合需要同时输出多种规格的场景。
+ * targets：输出目标。
+ * outputs：结果，与targets一一对应；
+ *          已有元素的尺寸和类型符合时，直接写入其内存空间而不重新分配。
+ */
+void PortraitMixMulti(
+    const SemiData& semi,
+    const std::vector<MixTarget>& targets,
+    std::vector<cv::Mat>& outputs);
+
 /* 背景替换，但不裁剪也不扩展。一般这个功能用于编辑和预览。
  * 参数和返回内容同PortraitMix。
  */
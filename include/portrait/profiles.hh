@@ -5,7 +5,83 @@
 
 namespace portrait {
 
+/* GrabCut构图范围
+ * cv::grabCut每次迭代都从输入的像素重新学习前景、背景的颜色模型，
+ * 因此GrabCutUndecided不只是缩小了图：范围以外的背景颜色不再参与建模，
+ * 背景颜色复杂时结果可能与GrabCutWholeImage不同（差异可用main_benchmark比较）。
+ */
+enum GrabCutRegion
+{
+    GrabCutWholeImage = 0, //对整个图像构图
+    GrabCutUndecided = 1   //只对未确定（可能前景、可能背景）的区域及其外围一个像素构图
+};
 
+/* 人脸检测使用的分类器实现。
+ * 各预设值都使用FaceDetectorOpenCV；FaceDetectorNative的结果尚未与之逐一比对验证，需要时显式选择。
+ */
+enum FaceDetector
+{
+    FaceDetectorOpenCV = 0, //cv::CascadeClassifier
+    FaceDetectorNative = 1  //HaarCascade：按组逐级计算相邻窗口，DetectSingleFace找到两个人脸后立即停止
+};
+
+/* 抠图实际使用的流程
+ */
+enum MattingPath
+{
+    MattingPathGrabCut = 0, //GrabCut分离前景背景，再按matting_backend混合边缘
+    MattingPathColorKey = 1 //背景近乎纯色，按与背景色的颜色距离直接得到Alpha，跳过GrabCut
+};
+
+/* 边缘混合（Matting）算法
+ */
+enum MattingBackend
+{
+    MattingSampling = 0, //MatBorder：按前景、背景样本估计Alpha，耗时随边缘长度和样本数增长
+    MattingGuided = 1,   //GuidedMatte：以图像为引导对Trimap做引导滤波，耗时与像素数成正比
+    MattingFeather = 2   //羽化：对前景／背景掩码做盒式模糊，不估计背景色，只适合实时预览
+};
+
+/* 处理参数，决定抠图速度和质量的取舍。
+ * 一般应从预设值（Fast、Balanced、Quality）开始，再按需要修改个别参数。
+ * 例如实时预览使用Fast，最终输出使用Quality。
+ */
+struct ProcessingProfile
+{
+public:
+    enum { MaxMattingClusters = 8 }; //matting_clusters的最大值
+
+    //人脸检测
+    double detect_scale_factor; //检测窗口每次放大的比例，越接近1越准确、越慢
+    int detect_min_face_size;   //可检测的最小人脸边长（原照片的像素）
+    int detect_coarse_face_size; //先在缩小的图像上检测，使最小人脸缩小到这个边长（像素），
+                                 //再在每个结果附近的较高分辨率上精确定位；0表示直接在原照片上检测
+    FaceDetector face_detector; //分类器实现
+
+    //抠图分辨率
+    int matting_face_size; //GrabCut和边缘混合使用的人脸大小（像素），
+                           //小于输出的人脸大小时，在这个分辨率抠图，再按原图的细节放大Alpha；
+                           //0表示在输出分辨率抠图
+
+    //GrabCut
+    int grabcut_iterations;       //迭代次数
+    double grabcut_scale;         //GrabCut抠图时图像相对工作分辨率的缩放比例
+    double grabcut_init_scale;    //GrabCut初始化时图像相对工作分辨率的缩放比例
+    GrabCutRegion grabcut_region; //构图范围，GrabCutUndecided可减少时间和内存
+    bool color_key;               //背景近乎纯色时使用颜色键抠图（MattingPathColorKey），跳过GrabCut；
+                                  //结果与GrabCut不同，各预设值都不开启
+
+    //边缘混合（Matting）
+    MattingBackend matting_backend; //混合算法
+    int matting_front_range; //混合范围，边缘向内（前景方向）的距离
+    int matting_back_range;  //混合范围，边缘向外（背景方向）的距离
+    int matting_clusters;    //前景色分类数，越大越准确、越慢，1 ~ MaxMattingClusters
+public:
+    static ProcessingProfile Fast();     //速度优先，适合预览
+    static ProcessingProfile Balanced(); //默认
+    static ProcessingProfile Quality();  //质量优先，适合最终输出
+    static ProcessingProfile Preview();  //实时预览（PreviewEngine）：极小的抠图分辨率，羽化边缘
+}; //struct ProcessingProfile
 
 }  //namespace portrait
 
@@ -0,0 +1,107 @@
+//portrait/stream.hh
+
+#ifndef INCLUDE_PORTRAIT_STREAM_HH
+#define INCLUDE_PORTRAIT_STREAM_HH
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+#include "portrait/tracking.hh"
+
+namespace portrait {
+
+/* StreamPipeline的处理阶段，每个阶段在各自的线程中执行
+ */
+enum StreamStage
+{
+    StreamCapture = 0, //读取帧（FrameSource）
+    StreamDetect = 1,  //人脸跟踪（FaceTracker）
+    StreamMatte = 2,   //抠图（PortraitProcessSemi，以VideoSession复用上一帧的结果）
+    StreamMix = 3,     //替换背景（PortraitMixMulti）
+    StreamStageCount = 4
+};
+
+/* 一个阶段的统计
+ */
+struct StreamStageStats
+{
+    int64_t processed; //处理完成的帧数
+    int64_t dropped;   //在本阶段的输入中被新帧覆盖而丢弃的帧数
+    int64_t failed;    //处理失败（例如抠图出错）的帧数
+    double last_ms;    //最近一帧的处理耗时（毫秒）
+    double mean_ms;    //平均处理耗时（毫秒）
+};
+
+/* 人脸跟踪的结果，每帧都有，适合以帧率刷新预览
+ */
+struct StreamPreview
+{
+    int64_t frame_id;        //帧序号，从0开始
+    cv::Mat frame;           //原始帧
+    TrackingResult tracking; //人脸跟踪结果
+};
+
+/* 替换背景的结果
+ */
+struct StreamResult
+{
+    int64_t frame_id;            //帧序号，从0开始
+    cv::Mat frame;               //原始帧
+    cv::Rect face;               //人脸位置（帧的坐标）
+    std::vector<cv::Mat> outputs; //与targets一一对应，意义同PortraitMixMulti
+    double latency_ms;           //从读取帧到输出结果的总耗时（毫秒）
+};
+
+struct StreamPipelineImpl;
+
+/* 连续画面（例如摄像头）的流水线处理：读取、人脸跟踪、抠图、替换背景
+ * 四个阶段各在一个线程中执行，各帧在阶段之间流水传递。
+ * 阶段之间是容量为1的信箱：下一阶段来不及处理时，新帧覆盖旧帧，
+ * 因此每个阶段总是处理最新的帧，延迟不会累积，被丢弃的帧计入统计。
+ * 调用者（例如界面线程）用TryGetPreview、TryGetResult取得最新的结果，不会被阻塞。
+ * 析构时停止并等待所有线程结束。
+ */
+class StreamPipeline
+{
+public:
+    /* 读取一帧（CV_8UC3，BGR）写入frame，返回false表示结束。
+     * 在读取线程中调用，可以阻塞（例如等待摄像头的下一帧）。
+     */
+    typedef std::function<bool(cv::Mat& frame)> FrameSource;
+
+    /* 创建并启动流水线。
+     * face_resize_to：意义同PortraitProcessSemi
+     * targets：替换背景的输出目标，意义同PortraitMixMulti；
+     *          只对覆盖所有目标的裁剪区域抠图
+     * profile：处理参数，人脸跟踪和抠图共用，实时处理一般使用ProcessingProfile::Fast()
+     */
+    StreamPipeline(const FrameSource& source,
+                   const int face_resize_to,
+                   const std::vector<MixTarget>& targets,
+                   const ProcessingProfile& profile = ProcessingProfile::Fast());
+    StreamPipeline(const StreamPipeline&) = delete; //无法复制
+    ~StreamPipeline() throw();
+    StreamPipeline& operator=(const StreamPipeline&) = delete; //无法复制
+public:
+    //取得最新的人脸跟踪结果，自上次调用后没有新结果时返回false
+    bool TryGetPreview(StreamPreview& preview);
+    //取得最新的替换背景结果，自上次调用后没有新结果时返回false
+    bool TryGetResult(StreamResult& result);
+    //获取一个阶段的统计
+    StreamStageStats GetStats(StreamStage stage) const;
+    //FrameSource是否仍在提供帧（返回false或抛出异常后停止）
+    bool IsRunning() const;
+    //停止并等待所有线程结束，未取走的结果仍可取得
+    void Stop();
+private:
+    StreamPipelineImpl* _data;
+}; //class StreamPipeline
+
+}  //namespace portrait
+
+#endif
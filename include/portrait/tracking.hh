@@ -0,0 +1,57 @@
+//portrait/tracking.hh
+
+#ifndef INCLUDE_PORTRAIT_TRACKING_HH
+#define INCLUDE_PORTRAIT_TRACKING_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+/* FaceTracker::Track的结果（一帧）
+ */
+struct TrackingResult
+{
+    bool found;          //是否找到（唯一的）人脸
+    cv::Rect face;       //人脸位置（帧的坐标），found为false时无意义
+    int face_count;      //整帧检测到的人脸数，最多计到2（2表示两个或以上）；
+                         //跟踪成功时为1
+    bool full_detection; //本帧是否执行了整帧检测（首帧或跟踪丢失）
+    double milliseconds; //本帧的处理耗时
+};
+
+/* 连续画面（例如摄像头）的人脸跟踪，用于实时提示画面中是否有人脸。
+ * 已知上一帧的人脸位置时，只在按运动速度扩展的范围内检测大小相近的人脸，
+ * 耗时远小于整帧检测；跟踪丢失时才退回整帧检测（DetectSingleFace的规则，
+ * 多于一个人脸时视为没有找到）。
+ * 跟踪期间不检测范围以外的新人脸。
+ * FaceTracker不是线程安全的，每路画面应使用各自的实例。
+ */
+class FaceTracker
+{
+public:
+    /* profile：检测参数（分类器、缩放比例、最小人脸尺寸），
+     *          实时跟踪一般使用ProcessingProfile::Fast()
+     */
+    explicit FaceTracker(const ProcessingProfile& profile = ProcessingProfile::Fast());
+
+    //处理一帧，frame是CV_8UC3（BGR），各帧的尺寸应相同
+    TrackingResult Track(const cv::Mat& frame);
+
+    //放弃当前的跟踪，下一帧重新整帧检测
+    void Reset();
+
+    //是否正在跟踪（上一帧找到了人脸）
+    bool IsTracking() const { return _tracking; }
+private:
+    ProcessingProfile _profile;
+    bool _tracking;
+    cv::Rect _face;     //上一帧的人脸位置
+    cv::Point _motion;  //上一帧人脸中心的位移
+    cv::Mat _gray;      //各帧共用的灰度图
+}; //class FaceTracker
+
+}  //namespace portrait
+
+#endif
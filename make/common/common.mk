@@ -26,7 +26,7 @@ else
 endif
 
 CXXFLAGS     += `pkg-config --cflags opencv` -I$(PORTRAIT_DIR)/include
-LIBS         += `pkg-config --libs opencv`
+LIBS         += `pkg-config --libs opencv` -pthread #StreamPipeline使用std::thread
 EXT_LNK_OBJS += $(PORTRAIT_LIB_DIR)/$(PORTRAIT_CASSCADE) \
                 $(PORTRAIT_LIB_DIR)/$(PORTRAIT_LIBA)
 
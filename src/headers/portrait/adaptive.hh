@@ -0,0 +1,63 @@
+//portrait/adaptive.hh
+//按期限自动降低质量（AsyncOptions::adaptive）：抠图耗时的估计模型和参数选择
+
+#ifndef INCLUDE_PORTRAIT_ADAPTIVE_HH
+#define INCLUDE_PORTRAIT_ADAPTIVE_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/async.hh"
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+/* 按期限选择抠图参数的请求和结果
+ */
+struct AdaptiveQuality
+{
+    AsyncOptions::Clock::time_point deadline;
+    QualityChoice choice; //人脸检测之后写入
+};
+
+//不按期限选择时的QualityChoice，即profile本身的设置
+QualityChoice DefaultQuality(const ProcessingProfile& profile);
+
+/* 按剩余的时间选择抠图参数，写入chosen（其余参数同profile）。
+ * face_size：输出分辨率下的人脸大小（像素）
+ * 已超过期限时直接选择最低的质量，由之后的检查点决定是否结束。
+ */
+QualityChoice ChooseQuality(
+    const int face_size,
+    const AsyncOptions::Clock::time_point& deadline,
+    const ProcessingProfile& profile,
+    ProcessingProfile& chosen);
+
+/* 记录一次抠图（从生成各层到得到Alpha）的实际耗时，校正耗时模型。
+ * face_size：同ChooseQuality；profile：实际使用的参数
+ */
+void RecordMattingCost(
+    const int face_size,
+    const ProcessingProfile& profile,
+    const double milliseconds);
+
+/* 同PortraitProcessSemi，人脸检测之后按adaptive.deadline选择抠图参数
+ * （实现在processing.cc）
+ */
+SemiData PortraitProcessSemiAdaptive(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const ProcessingProfile& profile,
+    AdaptiveQuality& adaptive);
+
+SemiData PortraitProcessSemiAdaptive(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile,
+    AdaptiveQuality& adaptive);
+
+}  //namespace portrait
+
+#endif
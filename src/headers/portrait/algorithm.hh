@@ -6,6 +6,9 @@
 
 #include "opencv2/opencv.hpp"
 
+#include "portrait/profiles.hh"
+#include "portrait/sparsematte.hh"
+
 namespace portrait {
 
 /* 给出图像（image）和其中人脸的位置（face_area），
@@ -31,16 +34,126 @@ cv::Rect ResizeFace(
     const cv::Rect& face_area,
     const cv::Size& face_resize_to);
 
+/* 同上，但结果输出到resized_image，不修改image。
+ * 如果resized_image的尺寸和类型已符合，则直接写入其内存空间而不重新分配。
+ */
+cv::Rect ResizeFace(
+    const cv::Mat& image,
+    const cv::Rect& face_area,
+    const cv::Size& face_resize_to,
+    cv::Mat& resized_image);
+
 /* 根据图像（image）和其中的人脸位置（face_area）抠出人像，
  * 返回一个与image同尺寸的矩阵，类型时CV_8UC4，
  * 前三通道的格式与image相同，表示image中每个像素的背景色（可能是近似）
  * 第四通道为Alpha，表示前景的混合比例。
  * 对于Alpha为255的点（全前景），前3通道无意义。
+ * profile：GrabCut和边缘混合的参数。
+ * 若profile.color_key且绝对背景区域近乎纯色，直接按颜色距离抠图，跳过GrabCut。
+ * path：不为nullptr时，写入实际使用的流程。
+ */
+cv::Mat GetAlphaMatte(
+    const cv::Mat& image,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path = nullptr);
+
+/* 同上，使用已由ResizeForGrabCut缩放好的图像，避免重复缩放。
  */
 cv::Mat GetAlphaMatte(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path = nullptr);
+
+/* GetAlphaMatte的第一步：用cv::grabCut分离前景和背景，
+ * 返回与image同尺寸的前景／背景掩码（cv::GC_FGD等）。
+ */
+cv::Mat GetGrabCutMask(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile);
+
+/* GetAlphaMatte的第二步：按profile.matting_backend选择的算法混合边缘，
+ * mask为GetGrabCutMask的结果，返回格式同GetAlphaMatte。
+ */
+cv::Mat MatteFromMask(
+    const cv::Mat& image,
+    const cv::Mat& mask,
+    const ProcessingProfile& profile);
+
+/* 抠图分辨率相对image的缩放比例：按profile.matting_face_size缩放人脸，
+ * 不需要缩小时返回1。
+ */
+double GetMattingScale(
+    const cv::Rect& face_area,
+    const ProcessingProfile& profile);
+
+/* 同GetAlphaMatte，但按GetMattingScale在较低的分辨率抠图，
+ * 再用UpsampleMatte放大到image的分辨率。
+ * 抠图耗时不随image的分辨率增长，放大的耗时与image的像素数成正比。
+ * stroke的尺寸与image相同，按比例缩小后使用。
+ */
+cv::Mat GetAlphaMatteScaled(
     const cv::Mat& image,
     const cv::Rect& face_area,
-    const cv::Mat& stroke);
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path = nullptr);
+
+/* GetAlphaMatteTemporal在连续帧之间保存的状态（抠图分辨率）。
+ */
+struct TemporalMatte
+{
+public:
+    TemporalMatte() : frames(0), reused(false), changed_ratio(1) { }
+
+    //丢弃保存的结果，下一帧完整抠图
+    void Reset();
+public:
+    cv::Mat image;              //上一帧的图像（副本）
+    cv::Rect face_area;         //上一帧的人脸位置
+    cv::Mat mask;               //上一帧GrabCut和Clear之后的掩码
+    cv::Mat matte;              //上一帧的结果
+    cv::Mat bg_model, fg_model; //上一帧GrabCut的颜色模型
+    int frames;                 //自上次完整抠图以来连续复用的帧数
+    bool reused;                //最近一帧是否复用了上一帧的结果
+    double changed_ratio;       //最近一帧与上一帧相比有变化的像素比例（去除零星噪点后）
+};
+
+/* 同GetAlphaMatte（没有关键点），用于连续帧：
+ * 人脸位置和大小与上一帧相近、变化的像素不多时，复用state中上一帧的结果——
+ * 按人脸的位移平移上一帧的掩码作为初值，只在变化区域附近以上一帧的颜色模型
+ * 执行较少次数的GrabCut，也只在变化区域附近重新混合边缘，其余部分沿用上一帧的结果。
+ * 变化区域按块标记，分开的多处变化各自更新。
+ * 否则（包括首帧，以及某处变化区域内缺少前景或背景、无法执行GrabCut时）完整抠图。
+ * 结果写回state。
+ */
+cv::Mat GetAlphaMatteTemporal(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const ProcessingProfile& profile,
+    TemporalMatte& state,
+    MattingPath* path = nullptr);
+
+/* 把image缩放为GrabCut抠图尺寸（image_grab）和GrabCut初始化尺寸（image_init），
+ * 缩放比例由profile指定，image_init由image_grab缩小而来，不再读取整个image。
+ * 如果输出的尺寸和类型已符合，则直接写入其内存空间而不重新分配。
+ */
+void ResizeForGrabCut(
+    const cv::Mat& image,
+    cv::Mat& image_grab,
+    cv::Mat& image_init,
+    const ProcessingProfile& profile);
 
 /* 画出一些用于调试的辅助线，展示绝对前景、绝对背景等区域。
  */
@@ -58,8 +171,8 @@ cv::Rect Extend(
     const cv::Rect& area,
     const cv::Scalar& border_pixel);
 
-/* 使用GetFrontBackMask返回的抠像结果，替换image中的背景。
- * raw：必须是GetFrontBackMask对image执行的返回结果。
+/* 使用GetAlphaMatte返回的抠像结果，替换image中的背景。
+ * matte：GetAlphaMatte对image执行的返回结果。
  * back_color：背景色
  * mix_alpha：混合比例，1表示完全替换背景，0表示完全不替换，
  *           1和0之间表示按一定的比例替换
@@ -67,10 +180,44 @@ cv::Rect Extend(
  */
 cv::Mat Mix(
     const cv::Mat& image,
-    const cv::Mat& raw,
+    const SparseMatte& matte,
     const cv::Vec3b& back_color,
     const double mix_alpha);
 
+/* 一次完成裁剪、扩展和替换背景，结果写入output。
+ * output的类型是CV_8UC3，大小为area.size()，
+ * area在image范围以内的部分按matte替换背景（同Mix），
+ * 超出image范围的部分填充back_color（同Extend）。
+ * 使用定点整数运算，逐行以指针访问；
+ * 半透明区间以外，背景色直接取image的颜色。
+ * 如果output的尺寸和类型已符合，则直接写入其内存空间而不重新分配。
+ */
+void MixCrop(
+    const cv::Mat& image,
+    const SparseMatte& matte,
+    const cv::Rect& area,
+    const cv::Vec3b& back_color,
+    const double mix_alpha,
+    cv::Mat& output);
+
+//MixCropMulti的一个输出目标，参数意义同MixCrop
+struct MixCropTarget
+{
+    cv::Rect area;
+    cv::Vec3b back_color;
+    double mix_alpha;
+};
+
+/* 同MixCrop，但一次输出多个目标，outputs与targets一一对应。
+ * 按行分块遍历image和matte，每一块依次写入所有目标，
+ * 因此image和matte只被读取一遍，块内的数据在各目标间留在缓存中。
+ */
+void MixCropMulti(
+    const cv::Mat& image,
+    const SparseMatte& matte,
+    const std::vector<MixCropTarget>& targets,
+    std::vector<cv::Mat>& outputs);
+
 }  //namespace portrait
 
 #endif
@@ -0,0 +1,85 @@
+//portrait/cascade.hh
+//本项目内实现的Haar级联分类器
+
+#ifndef INCLUDE_PORTRAIT_CASCADE_HH
+#define INCLUDE_PORTRAIT_CASCADE_HH
+
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace portrait {
+
+//特征中的一个矩形
+struct HaarRect
+{
+    int x, y, width, height;
+    float weight;
+};
+
+//Haar特征，最多3个矩形
+struct HaarFeature
+{
+    enum { MaxRects = 3 };
+    HaarRect rects[MaxRects];
+    int rect_count;
+};
+
+//单节点的弱分类器
+struct HaarStump
+{
+    int feature;     //HaarCascade::features中的序号
+    float threshold; //特征值小于threshold取left，否则取right
+    float left, right;
+};
+
+//一级强分类器
+struct HaarStage
+{
+    int first; //第一个弱分类器在HaarCascade::stumps中的序号
+    int count; //弱分类器的个数
+    float threshold;
+};
+
+/* 按OpenCV 2.x格式（见tools/main_cascade.cc）加载的Haar级联分类器，只支持单节点的弱分类器。
+ * 与cv::CascadeClassifier相比：
+ * （1）每个缩放级别的检测作为一个任务，由多个线程并行执行；
+ * （2）水平相邻的Lanes个窗口作为一组逐级计算，组内共用特征的偏移，
+ *     已被拒绝的窗口不再计算（逐窗口的标量运算，没有使用SIMD指令）；
+ * （3）可以在找到足够多个（互不重叠的）人脸后立即停止，
+ *     例如DetectSingleFace只需要知道人脸是否多于一个。
+ * 积分图由cv::integral计算。
+ */
+class HaarCascade
+{
+public:
+    enum { Lanes = 4 }; //一组的相邻窗口数
+
+    //从cv::FileStorage中的分类器节点加载，格式错误时抛出异常
+    explicit HaarCascade(const cv::FileNode& node);
+
+    /* 检测人脸，参数的意义同cv::CascadeClassifier::detectMultiScale。
+     * image：CV_8UC1
+     * max_faces：大于0时，找到max_faces个互不重叠的人脸后立即停止，
+     *            此时返回的结果可能不完整，但至少有max_faces个。
+     */
+    std::vector<cv::Rect> Detect(
+        const cv::Mat& image,
+        double scale_factor,
+        int min_neighbors,
+        const cv::Size& min_size,
+        const cv::Size& max_size = cv::Size(),
+        int max_faces = 0) const;
+
+    cv::Size GetWindowSize() const { return _window; }
+
+private:
+    cv::Size _window;
+    std::vector<HaarStage> _stages;
+    std::vector<HaarStump> _stumps;
+    std::vector<HaarFeature> _features;
+}; //class HaarCascade
+
+}  //namespace portrait
+
+#endif
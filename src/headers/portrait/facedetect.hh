@@ -5,6 +5,8 @@
 
 #include "opencv2/opencv.hpp"
 
+#include "portrait/profiles.hh"
+
 namespace portrait {
 
 /* 显式初始化人脸检测模块。
@@ -13,17 +15,46 @@ namespace portrait {
  * 或者DetectSingleFace时自动初始化，
  * 但多线程环境下依赖自动初始化是不安全的，
  * 应在并发调用人脸监测前调用本函数显式初始化。
+ *
+ * 初始化之后可以并发检测：FaceDetectorNative的检测可同时执行，
+ * FaceDetectorOpenCV（cv::CascadeClassifier不是线程安全的）的检测在内部逐个执行。
  */
 void InitFaceDetect();
 
 //检测人脸
 //image是CV_8UC1（Gray）
-std::vector<cv::Rect> DetectFaces(const cv::Mat& image);
+//profile指定检测窗口的缩放比例和最小人脸尺寸
+std::vector<cv::Rect> DetectFaces(
+    const cv::Mat& image,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
+
+/* 同上，max_faces大于0时允许找到max_faces个人脸后提前停止
+ * （profile.face_detector为FaceDetectorNative时），
+ * 此时结果可能不完整，但至少有max_faces个。
+ */
+std::vector<cv::Rect> DetectFaces(
+    const cv::Mat& image,
+    const ProcessingProfile& profile,
+    int max_faces);
+
+/* 在已知的人脸位置face（image坐标）附近检测，用于精确定位和跟踪。
+ * 只检测face四周扩展margin（相对人脸大小）的范围内、大小与face相近
+ * （0.7 ~ 1.4倍）的人脸，搜索范围内的人脸缩放到约96像素后检测。
+ * 找到时写入result（image坐标，取与face重叠最多的一个）并返回true。
+ */
+bool TrackFace(
+    const cv::Mat& image,
+    const cv::Rect& face,
+    const double margin,
+    const ProcessingProfile& profile,
+    cv::Rect& result);
 
 //检测单个人脸
 //如果找到超过一个人脸，或者没有找到人脸，抛出异常
 //其余同DetectFaces
-cv::Rect DetectSingleFace(const cv::Mat& image);
+cv::Rect DetectSingleFace(
+    const cv::Mat& image,
+    const ProcessingProfile& profile = ProcessingProfile::Balanced());
 
 }  //namespace portrait
 
@@ -37,6 +37,8 @@ cv::Rect SubArea(const cv::Rect& rect1, const cv::Point& offset);
 // 计算Rect(rect1.point - rect2.point, rect1.size)
 // 返回结果的width和height与rect1相同，x和y分别减去rect2的x和y。
 cv::Rect SubArea(const cv::Rect& rect1, const cv::Rect& rect2);
+// 把rect的坐标和尺寸都乘以scale（四舍五入）
+cv::Rect ScaleArea(const cv::Rect& rect, double scale);
 
 //判断 OpenCV GrabCut 掩码是否前景
 inline bool IsFront(uint8_t val)
@@ -0,0 +1,49 @@
+//portrait/guided.hh
+//以图像为引导的Alpha滤波和放大
+
+#ifndef INCLUDE_PORTRAIT_GUIDED_HH
+#define INCLUDE_PORTRAIT_GUIDED_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+/* 把在低分辨率抠图的结果放大到高分辨率（快速引导滤波）。
+ * 在低分辨率上以image_small的灰度为引导，对Alpha求局部线性系数，
+ * 系数双线性放大后作用于image的灰度，得到的Alpha边缘跟随高分辨率图像的细节；
+ * 低分辨率中确定为全前景／全背景的区域保持不变，其它区域的结果限制在邻域的范围内，避免光晕。
+ * 半透明像素的背景色取低分辨率中附近非全前景像素的背景色插值。
+ * 耗时与image的像素数成正比。
+ *
+ * matte_small：对image_small执行GetAlphaMatte的结果，CV_8UC4
+ * image_small：低分辨率图像，CV_8UC3
+ * image：高分辨率图像，CV_8UC3
+ * 返回与image同尺寸的CV_8UC4，格式同GetAlphaMatte。
+ */
+cv::Mat UpsampleMatte(
+    const cv::Mat& matte_small,
+    const cv::Mat& image_small,
+    const cv::Mat& image);
+
+/* 边缘混合的另一种算法（ProcessingProfile::MattingGuided），可替代MatBorder。
+ * 以image的灰度为引导，对trimap（MakeTrimap的结果）做引导滤波，
+ * 未确定区域（trimap为127）的Alpha取滤波结果，其余区域保持trimap的值。
+ * 背景色取附近全背景像素的平均。
+ * 方框滤波用滑动求和并按行分块多线程执行，耗时与像素数成正比，
+ * 不随边缘长度和样本数增长。
+ *
+ * image：图像，CV_8UC3
+ * trimap：CV_8UC1，0为背景，255为前景，127为未确定
+ * profile：matting_front_range为滤波窗口半径，matting_back_range为背景色采样半径
+ * 返回格式同MatBorder。
+ */
+cv::Mat GuidedMatte(
+    const cv::Mat& image,
+    const cv::Mat& trimap,
+    const ProcessingProfile& profile);
+
+}  //namespace portrait
+
+#endif
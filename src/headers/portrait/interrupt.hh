@@ -0,0 +1,50 @@
+//portrait/interrupt.hh
+//异步处理（PortraitProcessSemiAsync）在各阶段之间的中断检查点
+
+#ifndef INCLUDE_PORTRAIT_INTERRUPT_HH
+#define INCLUDE_PORTRAIT_INTERRUPT_HH
+
+#include "sybie/common/Uncopyable.hh"
+
+#include "portrait/async.hh"
+
+namespace portrait {
+
+/* 在当前线程设置中断条件，析构时恢复。
+ * 条件保存在线程局部变量中，处理函数的签名不需要改变；
+ * 没有InterruptScope的线程（同步调用）中，检查点什么也不做。
+ */
+class InterruptScope : sybie::common::Uncopyable
+{
+public:
+    explicit InterruptScope(const AsyncOptions& options);
+    ~InterruptScope();
+    //是否有检查点因超时而选择了部分结果
+    bool IsPartial() const { return _partial; }
+private:
+    friend void CheckInterrupt();
+    friend bool StopWithPartial();
+    const AsyncOptions& _options;
+    bool _partial;
+    InterruptScope* _outer;
+}; //class InterruptScope
+
+/* 检查点：已取消时抛出Error(Cancelled)，超过期限时抛出Error(Timeout)。
+ */
+void CheckInterrupt();
+
+/* 已有可用结果（例如完成了一次GrabCut迭代）时的检查点：
+ * 超过期限且允许部分结果时返回true（并记录结果是部分的），调用者应停止细化，
+ * 直接使用已有的结果；未超过期限时返回false；其余情况同CheckInterrupt。
+ */
+bool StopWithPartial();
+
+//当前线程的处理是否已因StopWithPartial而只得到部分结果
+bool HasStoppedWithPartial();
+
+//当前线程是否设置了中断条件（例如需要把一次执行的多个迭代分开，以便在迭代之间检查）
+bool IsInterruptible();
+
+}  //namespace portrait
+
+#endif
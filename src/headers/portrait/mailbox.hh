@@ -0,0 +1,83 @@
+//portrait/mailbox.hh
+//线程之间传递最新数据的单槽信箱
+
+#ifndef INCLUDE_PORTRAIT_MAILBOX_HH
+#define INCLUDE_PORTRAIT_MAILBOX_HH
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "sybie/common/Event.hh"
+#include "sybie/common/Uncopyable.hh"
+
+namespace portrait {
+
+/* 容量为1的队列，新数据覆盖未取走的旧数据（最新的帧优先）。
+ * 槽位用原子交换实现，Put和TryTake不加锁；
+ * Take在信箱为空时等待，由Put或Wake唤醒。
+ * 适用于一个生产者线程和一个消费者线程。
+ */
+template<class T>
+class Mailbox : sybie::common::Uncopyable
+{
+public:
+    Mailbox()
+        : _slot(nullptr), _dropped(0), _event()
+    { }
+
+    ~Mailbox()
+    {
+        delete _slot.exchange(nullptr);
+    }
+
+    //放入item，覆盖未被取走的数据（计入GetDropped）
+    void Put(std::unique_ptr<T> item)
+    {
+        T* old = _slot.exchange(item.release());
+        if (old != nullptr)
+        {
+            delete old;
+            _dropped++;
+        }
+        _event.SetEvent();
+    }
+
+    //取走数据，信箱为空时返回空指针
+    std::unique_ptr<T> TryTake()
+    {
+        return std::unique_ptr<T>(_slot.exchange(nullptr));
+    }
+
+    //取走数据，信箱为空时等待；被Wake唤醒时可能返回空指针
+    std::unique_ptr<T> Take()
+    {
+        std::unique_ptr<T> item = TryTake();
+        if (item == nullptr)
+        {
+            _event.Wait();
+            item = TryTake();
+        }
+        return item;
+    }
+
+    //唤醒正在Take的线程（例如停止时）
+    void Wake()
+    {
+        _event.SetEvent();
+    }
+
+    //被覆盖而丢弃的数据个数
+    int64_t GetDropped() const
+    {
+        return _dropped;
+    }
+private:
+    std::atomic<T*> _slot;
+    std::atomic<int64_t> _dropped;
+    sybie::common::Event _event;
+}; //class Mailbox
+
+}  //namespace portrait
+
+#endif
@@ -7,7 +7,9 @@
 #include <cmath>
 #include <cassert>
 #include <algorithm>
+#include <array>
 #include <iterator>
+#include <limits>
 #include <vector>
 
 #include "opencv2/opencv.hpp"
@@ -180,56 +182,21 @@ private:
     std::vector<Tval> arr[N];
 };
 
+/* k-means聚类，分类数K是编译期常数：
+ * 聚类中心和计数是定长数组，不分配堆内存，各循环的次数固定，可被编译器展开。
+ */
 template<class TVal,
          class TDist,
+         int K,
          class TMean=Mean<TVal> >
 class KMeans
 {
 public:
-    explicit KMeans(int k)
-        : _k(k), _center(new TVal[k]), _cnt(new int[k])
-    { }
-
-    KMeans(const KMeans& another)
-        : _k(another._k),
-          _center(new TVal[another._k]),
-          _cnt(new int[another._k])
-    {
-        for (int i = 0 ; i < _k ; i++)
-        {
-            _center[i] = another._center[i];
-            _cnt[i] = another._cnt[i];
-        }
-    }
+    static_assert(K >= 1, "K must be positive");
 
-    KMeans(KMeans&& another) throw()
-        : _k(0),
-          _center(nullptr),
-          _cnt(nullptr)
-    {
-        Swap(another);
-    }
-
-    ~KMeans()
-    {
-        delete[] _center;
-        delete[] _cnt;
-    }
-
-    KMeans& operator=(const KMeans& another) = delete;
-
-    KMeans& operator=(KMeans&& another)
-    {
-        Swap(another);
-        return *this;
-    }
-
-    void Swap(KMeans& another)
-    {
-        std::swap(_k, another._k);
-        std::swap(_center, another._center);
-        std::swap(_cnt, another._cnt);
-    }
+    KMeans()
+        : _center(), _cnt()
+    { }
 
     void InitCenter(int tag, const TVal& val)
     {
@@ -243,7 +210,7 @@ public:
         bool finished;
         do
         {
-            std::unique_ptr<TMean[]> means(new TMean[_k]);
+            std::array<TMean, K> means;
             for (Iterator it = samples_begin;
                  it != samples_end;
                  it++)
@@ -253,7 +220,7 @@ public:
             }
 
             finished = true;
-            for (int i = 0 ; i < _k ; i++)
+            for (int i = 0 ; i < K ; i++)
             {
                 TVal mean = (means[i].Count() > 0) ?
                             means[i].Get() :
@@ -274,7 +241,7 @@ public:
         int tag = -1;
         double min_dist = std::numeric_limits<double>::max();
         TDist Distance;
-        for (int i = 0 ; i < _k ; i++)
+        for (int i = 0 ; i < K ; i++)
         {
             if (_cnt[i] == 0 && !get_empty)
                 continue;
@@ -305,9 +272,8 @@ public:
         return _center[tag];
     }
 private:
-    int _k;
-    TVal* _center;
-    int* _cnt;
+    std::array<TVal, K> _center;
+    std::array<int, K> _cnt;
 }; //template<...> class KMeans
 
 }  //namespace portrait
@@ -6,6 +6,8 @@
 
 #include "opencv2/opencv.hpp"
 
+#include "portrait/profiles.hh"
+
 namespace portrait {
 
 /* 边缘混合
@@ -18,11 +20,14 @@ namespace portrait {
 /* 边缘混合
  * image：图像
  * mask：cv::grabCut结果的前景／背景掩码
+ * profile：使用其中的混合范围和前景色分类数
  * 返回一个用于评估准确率的值，应接纳最小的结果
  */
-cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask);
+cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask,
+                  const ProcessingProfile& profile);
 
-cv::Mat MakeTrimap(const cv::Mat& image, const cv::Mat& mask);
+cv::Mat MakeTrimap(const cv::Mat& image, const cv::Mat& mask,
+                   const ProcessingProfile& profile);
 
 }  //namespace portrait
 
@@ -0,0 +1,65 @@
+//portrait/pyramid.hh
+//处理一张照片时各阶段共用的多分辨率图像
+
+#ifndef INCLUDE_PORTRAIT_PYRAMID_HH
+#define INCLUDE_PORTRAIT_PYRAMID_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+/* ImagePyramid的实现。
+ * 人脸检测、GrabCut初始化、GrabCut抠图和Matting都从这里取图，
+ * 每一层只生成一次；实例被复用时，尺寸不变的层直接写入原有的内存空间。
+ */
+struct ImagePyramidImpl
+{
+public:
+    cv::Mat photo;      //原照片（不复制）
+    cv::Mat gray;       //原照片的灰度图，用于人脸检测，由GetGray在需要时生成
+    bool gray_ready;    //gray是否对应当前的photo
+    cv::Mat image;      //输出分辨率：已裁剪，人脸缩放到指定大小
+    cv::Mat image_work; //抠图分辨率（见GetMattingScale），与输出分辨率相同时为空
+    cv::Mat image_grab; //GrabCut抠图尺寸
+    cv::Mat image_init; //GrabCut初始化尺寸
+    cv::Rect work_face_area; //人脸在抠图分辨率下的位置
+public:
+    ImagePyramidImpl() : gray_ready(false) { }
+
+    //设置原照片；灰度图只在检测人脸时（GetGray）才生成
+    void SetPhoto(const cv::Mat& photo);
+
+    //原照片的灰度图，第一次调用时生成
+    const cv::Mat& GetGray();
+
+    //抠图分辨率的图像
+    const cv::Mat& GetWorkImage() const
+    {
+        return image_work.empty() ? image : image_work;
+    }
+
+    /* 按人脸位置（face_area，原照片坐标）裁剪原照片，
+     * 裁剪范围的意义同TryCutPortrait，然后缩放到输出分辨率（人脸大小为face_resize_to），
+     * 并按profile生成抠图分辨率和GrabCut使用的各层。
+     * 返回人脸在输出分辨率下的位置。
+     */
+    cv::Rect BuildLevels(
+        const cv::Rect& face_area,
+        const double max_up_expand,
+        const double max_down_expand,
+        const double max_width_expand,
+        const cv::Size& face_resize_to,
+        const ProcessingProfile& profile);
+
+    static ImagePyramidImpl& GetFrom(ImagePyramid& wrapper)
+    {
+        return *wrapper._data;
+    }
+}; //struct ImagePyramidImpl
+
+}  //namespace portrait
+
+#endif
@@ -0,0 +1,40 @@
+//portrait/semidata.hh
+//SemiData的内部数据
+
+#ifndef INCLUDE_PORTRAIT_SEMIDATA_HH
+#define INCLUDE_PORTRAIT_SEMIDATA_HH
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/processing.hh"
+#include "portrait/profiles.hh"
+#include "portrait/sparsematte.hh"
+
+namespace portrait {
+
+struct SemiDataImpl
+{
+public:
+    cv::Mat image; //CV_8UC3 R,G,B，创建后不再修改，可被Clone的副本共享
+    SparseMatte matte; //Alpha和边缘的背景色
+    cv::Rect face_area;
+    ProcessingProfile profile; //抠图使用的处理参数，SetStroke时沿用
+    MattingPath matting_path;  //抠图实际使用的流程
+public:
+    static SemiData NewWrapper()
+    {
+        return SemiData(new SemiDataImpl());
+    }
+    static SemiDataImpl& GetFrom(SemiData& wrapper)
+    {
+        return *wrapper._data;
+    }
+    static const SemiDataImpl& GetFrom(const SemiData& wrapper)
+    {
+        return *wrapper._data;
+    }
+}; //struct SemiDataImpl
+
+}  //namespace portrait
+
+#endif
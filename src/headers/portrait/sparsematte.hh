@@ -0,0 +1,121 @@
+//portrait/sparsematte.hh
+//紧凑保存的抠图结果
+
+#ifndef INCLUDE_PORTRAIT_SPARSEMATTE_HH
+#define INCLUDE_PORTRAIT_SPARSEMATTE_HH
+
+#include <memory> //std::shared_ptr
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace portrait {
+
+//一行中连续的半透明像素
+struct MatteSpan
+{
+    int begin; //起始列
+    int end;   //结束列（不含）
+    int color; //第一个像素的背景色在所在行块颜色（GetColors(y)）中的序号
+};
+
+/* SparseMatte的一个行块，包含连续TileRows行（最后一块可能更少）。
+ * 创建后不再修改，可被多个SparseMatte共享。
+ */
+struct MatteTile
+{
+    cv::Mat alpha;                  //本块的Alpha，CV_8UC1
+    std::vector<MatteSpan> spans;   //本块的半透明区间
+    std::vector<int> row_spans;     //第r行的区间为spans[row_spans[r]]到spans[row_spans[r+1]]
+    std::vector<cv::Vec3b> colors;  //本块半透明像素的背景色，按行优先顺序排列
+};
+
+/* 紧凑保存的抠图结果，内容等同MatBorder返回的CV_8UC4（背景色+Alpha）。
+ * 边缘区域以外，alpha只有0或255：alpha为0的像素背景色就是图像颜色，
+ * alpha为255的像素背景色不参与混合，因此都不必保存。
+ * 这里只保存Alpha平面（CV_8UC1），以及半透明像素（0 < alpha < 255）的背景色，
+ * 半透明像素按行分为若干连续区间（MatteSpan），背景色按行优先顺序紧密排列。
+ * 内存约为CV_8UC4的1/4，替换背景时也只需读取更少的数据。
+ *
+ * 数据按行分块（MatteTile）保存，每块创建后不再修改，以引用计数共享：
+ * 复制SparseMatte只复制各块的引用；从新的抠图结果构造时，
+ * 内容没有变化的块直接共享原来的内存。
+ * 不同的SparseMatte可在不同线程中同时使用和替换。
+ */
+class SparseMatte
+{
+public:
+    enum { TileRows = 32 }; //每个行块的行数
+
+    SparseMatte(); //空的实例
+
+    //从MatBorder的结果（CV_8UC4）构造
+    explicit SparseMatte(const cv::Mat& matte);
+
+    /* 从MatBorder的结果（CV_8UC4）构造，
+     * 与previous内容相同的行块直接共享previous的内存。
+     */
+    SparseMatte(const cv::Mat& matte, const SparseMatte& previous);
+
+    /* 从Alpha平面（CV_8UC1，不复制）和半透明像素的背景色（按行优先顺序排列）构造。
+     * 若colors的个数与alpha中半透明像素的个数不一致，返回空的实例。
+     */
+    static SparseMatte FromAlpha(const cv::Mat& alpha,
+                                 const std::vector<cv::Vec3b>& colors);
+
+    cv::Size GetSize() const { return _size; }
+    bool Empty() const { return _tiles.empty(); }
+
+    //第y行的Alpha，共GetSize().width个元素
+    const uint8_t* GetAlphaRow(int y) const
+    {
+        return GetTile(y).alpha.ptr<uint8_t>(y % TileRows);
+    }
+
+    //第y行所在行块的Alpha（CV_8UC1，不复制），first_row写入行块的第一行
+    const cv::Mat& GetAlphaTile(int y, int& first_row) const
+    {
+        first_row = y - y % TileRows;
+        return GetTile(y).alpha;
+    }
+
+    //第y行的半透明区间，[GetSpanBegin(y), GetSpanEnd(y))，按列排列
+    const MatteSpan* GetSpanBegin(int y) const
+    {
+        const MatteTile& tile = GetTile(y);
+        return tile.spans.data() + tile.row_spans[y % TileRows];
+    }
+    const MatteSpan* GetSpanEnd(int y) const
+    {
+        const MatteTile& tile = GetTile(y);
+        return tile.spans.data() + tile.row_spans[y % TileRows + 1];
+    }
+
+    //第y行所在行块的背景色，MatteSpan::color是其中的序号
+    const cv::Vec3b* GetColors(int y) const
+    {
+        return GetTile(y).colors.data();
+    }
+
+    //半透明像素的总数
+    size_t GetColorCount() const;
+
+    //复制出完整的Alpha平面，CV_8UC1
+    void CopyAlphaTo(cv::Mat& alpha) const;
+
+    //复制出所有半透明像素的背景色，按行优先顺序排列
+    void CopyColorsTo(std::vector<cv::Vec3b>& colors) const;
+
+private:
+    const MatteTile& GetTile(int y) const
+    {
+        return *_tiles[y / TileRows];
+    }
+
+    cv::Size _size;
+    std::vector<std::shared_ptr<const MatteTile> > _tiles;
+}; //class SparseMatte
+
+}  //namespace portrait
+
+#endif
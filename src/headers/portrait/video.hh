@@ -0,0 +1,30 @@
+//portrait/video.hh
+//VideoSession的内部数据
+
+#ifndef INCLUDE_PORTRAIT_VIDEO_HH
+#define INCLUDE_PORTRAIT_VIDEO_HH
+
+#include "portrait/algorithm.hh"
+#include "portrait/processing.hh"
+
+namespace portrait {
+
+struct VideoSessionImpl
+{
+public:
+    ImagePyramid pyramid;  //各帧共用的缩放图像
+    TemporalMatte temporal; //上一帧的抠图结果（抠图分辨率）
+public:
+    static VideoSessionImpl& GetFrom(VideoSession& wrapper)
+    {
+        return *wrapper._data;
+    }
+    static const VideoSessionImpl& GetFrom(const VideoSession& wrapper)
+    {
+        return *wrapper._data;
+    }
+}; //struct VideoSessionImpl
+
+}  //namespace portrait
+
+#endif
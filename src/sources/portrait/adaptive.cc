@@ -0,0 +1,163 @@
+#include "portrait/adaptive.hh"
+
+#include <algorithm>
+#include <mutex>
+
+namespace portrait {
+
+//耗时模型的先验系数：抠图分辨率下每个人脸像素（人脸边长的平方）的耗时（纳秒）。
+//估计值，尚未用main_benchmark实测校准；校准时取main_benchmark的mean一行
+//（人脸边长FaceResizeTo = 200，即4万个人脸像素，Balanced参数），
+//grabcut(ms)的每像素耗时按GrabCutFixedCost + GrabCutIterationCost * 3 * 0.5^2拆分，
+//sampling(ms)、guided(ms)的每像素耗时对应MattingCost。
+//偏差由负载系数（实际耗时与先验估计的比例）按最近的测量结果整体校正
+const double GrabCutFixedCost = 200;      //生成各层、GrabCut初始化、恢复尺寸和Clear
+const double GrabCutIterationCost = 2000; //每次GrabCut迭代（grabcut_scale为1时，与其平方成正比）
+const double MattingCost[] = {
+    2000, //MattingSampling
+    800,  //MattingGuided
+    50    //MattingFeather
+};
+//负载系数指数平均的权重（最新一次）
+const double LoadWeight = 0.3;
+//负载系数的范围，避免个别异常的测量（例如进程被挂起）使之后的选择长期失效
+const double MinLoad = 0.1, MaxLoad = 20;
+//估计的耗时只用剩余时间的这个比例，其余留给放大Alpha等未计入模型的步骤
+const double BudgetRatio = 0.8;
+//抠图人脸大小的下限（像素），再小GrabCut无法分辨头发和肩膀
+enum { MinAdaptiveFaceSize = 64 };
+//以羽化代替边缘混合之前，抠图人脸大小最多降到原来的这个比例
+const double MinFaceSizeRatio = 0.5;
+//每次降低抠图人脸大小的比例
+const double FaceSizeStep = 0.8;
+//改用羽化时的混合范围，同ProcessingProfile::Preview
+enum { FeatherRange = 2 };
+
+namespace {  //耗时模型
+
+    //负载系数，所有线程共用
+    std::mutex LoadMutex;
+    double Load = 1;
+
+    double GetLoad()
+    {
+        std::lock_guard<std::mutex> lock(LoadMutex);
+        return Load;
+    }
+
+    //抠图分辨率下的人脸大小，同GetMattingScale
+    int WorkFaceSize(const int face_size, const ProcessingProfile& profile)
+    {
+        return profile.matting_face_size > 0 ? std::min(face_size, profile.matting_face_size)
+                                             : face_size;
+    }
+
+    //按先验系数估计的抠图耗时（毫秒）
+    double PriorCost(const int face_size, const ProcessingProfile& profile)
+    {
+        const double pixels = (double)WorkFaceSize(face_size, profile)
+                              * WorkFaceSize(face_size, profile);
+        const double per_pixel =
+            GrabCutFixedCost
+            + GrabCutIterationCost * profile.grabcut_iterations
+              * profile.grabcut_scale * profile.grabcut_scale
+            + MattingCost[profile.matting_backend];
+        return pixels * per_pixel / 1e6;
+    }
+
+} //namespace 耗时模型
+
+QualityChoice DefaultQuality(const ProcessingProfile& profile)
+{
+    QualityChoice choice;
+    choice.degraded = false;
+    choice.matting_face_size = profile.matting_face_size;
+    choice.grabcut_iterations = profile.grabcut_iterations;
+    choice.matting_backend = profile.matting_backend;
+    choice.budget_ms = 0;
+    choice.estimated_ms = 0;
+    return choice;
+}
+
+QualityChoice ChooseQuality(
+    const int face_size,
+    const AsyncOptions::Clock::time_point& deadline,
+    const ProcessingProfile& profile,
+    ProcessingProfile& chosen)
+{
+    chosen = profile;
+    if (deadline == AsyncOptions::Clock::time_point::max())
+        return DefaultQuality(profile);
+
+    const double budget = std::chrono::duration<double, std::milli>(
+        deadline - AsyncOptions::Clock::now()).count();
+    const double load = GetLoad();
+    const int full_size = WorkFaceSize(face_size, profile);
+    const int min_size = std::max<int>(MinAdaptiveFaceSize,
+                                       cvRound(full_size * MinFaceSizeRatio));
+    int& size = chosen.matting_face_size;
+    size = full_size;
+
+    if (budget <= 0)
+    {
+        //已超过期限：不必逐步估计，直接用最低的质量，是否结束由之后的检查点决定
+        chosen.grabcut_iterations = 1;
+        size = std::min<int>(full_size, MinAdaptiveFaceSize);
+        chosen.matting_backend = MattingFeather;
+        chosen.matting_front_range = FeatherRange;
+        chosen.matting_back_range = FeatherRange;
+    }
+
+    //依次：减少GrabCut迭代、降低抠图分辨率、改用羽化、再降低抠图分辨率
+    while (budget > 0 && PriorCost(face_size, chosen) * load > budget * BudgetRatio)
+    {
+        if (chosen.grabcut_iterations > 1)
+        {
+            chosen.grabcut_iterations--;
+        }
+        else if (size > min_size)
+        {
+            size = std::max<int>(min_size, cvRound(size * FaceSizeStep));
+        }
+        else if (chosen.matting_backend != MattingFeather)
+        {
+            chosen.matting_backend = MattingFeather;
+            chosen.matting_front_range = FeatherRange;
+            chosen.matting_back_range = FeatherRange;
+        }
+        else if (size > MinAdaptiveFaceSize)
+        {
+            size = std::max<int>(MinAdaptiveFaceSize, cvRound(size * FaceSizeStep));
+        }
+        else
+        {
+            break; //已是最低的质量，仍然超时的由检查点处理
+        }
+    }
+
+    QualityChoice choice;
+    choice.degraded = size < full_size
+                      || chosen.grabcut_iterations < profile.grabcut_iterations
+                      || chosen.matting_backend != profile.matting_backend;
+    choice.matting_face_size = size;
+    choice.grabcut_iterations = chosen.grabcut_iterations;
+    choice.matting_backend = chosen.matting_backend;
+    choice.budget_ms = budget;
+    choice.estimated_ms = PriorCost(face_size, chosen) * load;
+    return choice;
+}
+
+void RecordMattingCost(
+    const int face_size,
+    const ProcessingProfile& profile,
+    const double milliseconds)
+{
+    const double prior = PriorCost(face_size, profile);
+    if (prior <= 0)
+        return;
+    const double ratio = std::min(MaxLoad, std::max(MinLoad, milliseconds / prior));
+    std::lock_guard<std::mutex> lock(LoadMutex);
+    Load = Load * (1 - LoadWeight) + ratio * LoadWeight;
+}
+
+}  //namespace portrait
@@ -1,25 +1,21 @@
 //这是对algorithm.hh的实现
 #include "portrait/algorithm.hh"
 
+#include <limits>
+
 #include "sybie/common/RichAssert.hh"
 #include "sybie/common/Time.hh"
 #include "sybie/common/Graphics/Structs.hh"
 
+#include "portrait/exception.hh"
 #include "portrait/math.hh"
 #include "portrait/graphics.hh"
+#include "portrait/guided.hh"
+#include "portrait/interrupt.hh"
 #include "portrait/matting.hh"
 
 namespace portrait {
 
-const int GrabCutInteration = 3;
-//GrabCut的图片大小
-const double
-    GrabCutWidthScale = 0.5,
-    GrabCutHeightScale = 0.5;
-const double
-    GrabCutInitWidthScale = 0.2,
-    GrabCutInitHeightScale = 0.2;
-
 //以下多个常数定义前景、背景划分的关键数值，全是检测出人脸矩形的长宽比例。
 
 //绝对背景
@@ -79,12 +75,28 @@ cv::Rect ResizeFace(
         << SHOW(image.rows)
         << SHOW(image.cols);
 
+    cv::Mat resized_image;
+    cv::Rect resized_face_area = ResizeFace(
+        image, face_area, face_resize_to, resized_image);
+    image = resized_image;
+    return resized_face_area;
+}
+
+cv::Rect ResizeFace(
+    const cv::Mat& image,
+    const cv::Rect& face_area,
+    const cv::Size& face_resize_to,
+    cv::Mat& resized_image)
+{
+    sybie_assert(Inside(face_area, image))
+        << SHOW(face_area)
+        << SHOW(image.rows)
+        << SHOW(image.cols);
+
     double scale_x = (double)face_resize_to.width / face_area.width;
     double scale_y = (double)face_resize_to.height / face_area.height;
     cv::Size new_size(image.cols * scale_x, image.rows * scale_x);
-    cv::Mat resized_image;
     cv::resize(image, resized_image, new_size, 0, 0, cv::INTER_AREA);
-    image = resized_image;
 
     return cv::Rect (face_area.x * scale_x,
                      face_area.y * scale_y,
@@ -163,45 +175,342 @@ static void DrawMask(
 
 namespace { //GetAlphaMatte函数内使用的组件
 
-template<class T>
-void CheckedFloodFill(cv::Mat& image,
-                             const cv::Point& seed_point,
-                             const cv::Scalar& old_val,
-                             const cv::Scalar& new_val)
+/* 并查集：查找label所在集合的根，并压缩路径。
+ * 合并时总以较小的编号为根，因此任何编号的父编号都不大于它自己。
+ */
+int FindRoot(std::vector<int>& parent, int label)
 {
-    if (cv::Scalar(image.at<T>(seed_point)) == old_val)
-        cv::floodFill(image, seed_point, new_val);
+    int root = label;
+    while (parent[root] != root)
+        root = parent[root];
+    while (parent[label] != root)
+    {
+        int next = parent[label];
+        parent[label] = root;
+        label = next;
+    }
+    return root;
+}
+
+//并查集：合并两个集合，返回合并后的根
+int Union(std::vector<int>& parent, int label1, int label2)
+{
+    int root1 = FindRoot(parent, label1);
+    int root2 = FindRoot(parent, label2);
+    if (root1 < root2)
+    {
+        parent[root2] = root1;
+        return root1;
+    }
+    else
+    {
+        parent[root1] = root2;
+        return root2;
+    }
 }
 
+/* 清除孤立的前景和背景：
+ * 与左上角、右上角不连通的可能背景改为可能前景，
+ * 与底部中点不连通的可能前景改为可能背景。
+ * 连通性按4邻域计算，使用两遍扫描的连通域标记：
+ * 第一遍给每个点标记临时编号，并用并查集合并同类（前景／背景）相邻点的编号；
+ * 第二遍按编号所属的连通域直接改写mask。
+ */
 void Clear(cv::Mat& mask)
 {
-    cv::Mat mask_tmp(mask.rows, mask.cols, CV_8UC1);
+    if (mask.rows == 0 || mask.cols == 0)
+        return;
+
+    cv::Mat labels(mask.rows, mask.cols, CV_32SC1);
+    std::vector<int> parent;
+    parent.reserve(mask.rows * 4);
+    std::vector<uint8_t> front_up(mask.cols), front_row(mask.cols);
+
+    //第一遍：标记临时编号
     for (int r = 0 ; r < mask.rows ; r++)
+    {
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        int* label_row = labels.ptr<int>(r);
+        const int* label_up = r > 0 ? labels.ptr<int>(r - 1) : nullptr;
+        for (int c = 0 ; c < mask.cols ; c++)
+            front_row[c] = IsFront(mask_row[c]);
+
         for (int c = 0 ; c < mask.cols ; c++)
-            mask_tmp.at<uint8_t>(r,c) = IsFront(mask.at<uint8_t>(r,c));
+        {
+            const uint8_t front = front_row[c];
+            const bool join_left = c > 0 && front_row[c - 1] == front;
+            const bool join_up = r > 0 && front_up[c] == front;
+            int label;
+            if (join_left && join_up)
+                label = label_row[c - 1] == label_up[c] ?
+                        label_up[c] :
+                        Union(parent, label_row[c - 1], label_up[c]);
+            else if (join_left)
+                label = label_row[c - 1];
+            else if (join_up)
+                label = label_up[c];
+            else
+            {
+                label = (int)parent.size();
+                parent.push_back(label);
+            }
+            label_row[c] = label;
+        }
+        front_row.swap(front_up);
+    }
+
+    //每个编号直接指向连通域的根（父编号不大于自身，按顺序一遍即可）
+    for (size_t i = 0 ; i < parent.size() ; i++)
+        parent[i] = parent[parent[i]];
 
-    CheckedFloodFill<uint8_t>(
-        mask_tmp, cv::Point(0,0), 0, 2);
-    CheckedFloodFill<uint8_t>(
-        mask_tmp, cv::Point(mask_tmp.cols-1,0),  0, 2);
-    CheckedFloodFill<uint8_t>(
-        mask_tmp, cv::Point(mask_tmp.cols/2,mask_tmp.rows-1), 1, 3);
+    //与角落相连的背景、与底部中点相连的前景
+    auto Seed = [&](int r, int c, bool front) {
+        return IsFront(mask.at<uint8_t>(r, c)) == front ?
+               parent[labels.at<int>(r, c)] : -1;
+    };
+    const int back_left = Seed(0, 0, false);
+    const int back_right = Seed(0, mask.cols - 1, false);
+    const int front_bottom = Seed(mask.rows - 1, mask.cols / 2, true);
 
+    //第二遍：改写孤立的可能前景和可能背景
     for (int r = 0 ; r < mask.rows ; r++)
+    {
+        uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        const int* label_row = labels.ptr<int>(r);
         for (int c = 0 ; c < mask.cols ; c++)
         {
-            uint8_t t = mask_tmp.at<uint8_t>(r,c) ;
-            uint8_t& m = mask.at<uint8_t>(r,c);
-            if (t == 1 && m == cv::GC_PR_FGD) //孤立前景
+            const int root = parent[label_row[c]];
+            uint8_t& m = mask_row[c];
+            if (m == cv::GC_PR_FGD && root != front_bottom) //孤立前景
                 m = cv::GC_PR_BGD;
-            if (t == 0 && m == cv::GC_PR_BGD) //孤立背景
+            else if (m == cv::GC_PR_BGD &&
+                     root != back_left && root != back_right) //孤立背景
                 m = cv::GC_PR_FGD;
         }
+    }
+}
+
+/* 找出掩码中未确定（GC_PR_FGD、GC_PR_BGD）的区域，
+ * 返回包含这些区域的最小矩形，并向外扩展一个像素作为固定前景／背景的边框。
+ * 如果没有未确定的区域，返回空矩形。
+ */
+cv::Rect UndecidedArea(const cv::Mat& mask)
+{
+    int top = mask.rows, bottom = -1;
+    int left = mask.cols, right = -1;
+    for (int r = 0 ; r < mask.rows ; r++)
+    {
+        const uint8_t* row = mask.ptr<uint8_t>(r);
+        int row_left = -1, row_right = -1;
+        for (int c = 0 ; c < mask.cols ; c++)
+            if (row[c] == cv::GC_PR_FGD || row[c] == cv::GC_PR_BGD)
+            {
+                if (row_left < 0)
+                    row_left = c;
+                row_right = c;
+            }
+        if (row_left < 0)
+            continue;
+        top = std::min(top, r);
+        bottom = r;
+        left = std::min(left, row_left);
+        right = std::max(right, row_right);
+    }
+    if (bottom < 0)
+        return cv::Rect();
+
+    //外围一个像素都是已确定的点，在图中作为固定的终端
+    cv::Rect area(left - 1, top - 1, right - left + 3, bottom - top + 3);
+    return OverlapArea(area, WholeArea(mask));
 }
 
 } //namespace GetAlphaMatte内使用的组件
 
-cv::Mat GetAlphaMatte(
+//颜色键抠图（纯色背景）的参数，颜色距离均为BGR的欧氏距离
+//绝对背景区域至少占图像的比例，太少无法判断背景是否纯色
+const double MinBackdropRatio = 0.05;
+//纯色背景颜色的标准差上限
+const double MaxBackdropDeviation = 12;
+//纯色背景的平均梯度（相邻像素各通道差的绝对值之和）上限
+const double MaxBackdropGradient = 8;
+//Alpha为0的颜色距离：背景颜色标准差的倍数，不小于MinKeyDistance
+const double KeyDeviationFactor = 3;
+enum { MinKeyDistance = 12 };
+//Alpha从0渐变到255的颜色距离范围
+enum { KeyRampDistance = 40 };
+
+namespace { //颜色键抠图使用的组件
+
+//绝对背景区域的统计
+struct Backdrop
+{
+    cv::Vec3d mean;   //平均颜色
+    double deviation; //颜色标准差
+    double gradient;  //平均梯度
+};
+
+/* 统计mask中绝对背景（GC_BGD）区域的颜色和梯度，
+ * 返回背景是否近乎纯色，可使用颜色键抠图。
+ */
+bool AnalyzeBackdrop(const cv::Mat& image, const cv::Mat& mask,
+                     Backdrop& backdrop)
+{
+    sybie::common::StatingTestTimer timer("GetMixRaw.AnalyzeBackdrop");
+    double sum[3] = {0, 0, 0}, square_sum[3] = {0, 0, 0};
+    double gradient_sum = 0;
+    int64_t count = 0, gradient_count = 0;
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(r);
+        const cv::Vec3b* image_down = r + 1 < image.rows ?
+                                      image.ptr<cv::Vec3b>(r + 1) : nullptr;
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        const uint8_t* mask_down = r + 1 < image.rows ?
+                                   mask.ptr<uint8_t>(r + 1) : nullptr;
+        for (int c = 0 ; c < image.cols ; c++)
+        {
+            if (mask_row[c] != cv::GC_BGD)
+                continue;
+            const cv::Vec3b& pixel = image_row[c];
+            for (int ch = 0 ; ch < 3 ; ch++)
+            {
+                sum[ch] += pixel[ch];
+                square_sum[ch] += pixel[ch] * pixel[ch];
+            }
+            count++;
+
+            if (c + 1 < image.cols && mask_row[c + 1] == cv::GC_BGD)
+            {
+                for (int ch = 0 ; ch < 3 ; ch++)
+                    gradient_sum += std::abs(pixel[ch] - image_row[c + 1][ch]);
+                gradient_count++;
+            }
+            if (mask_down != nullptr && mask_down[c] == cv::GC_BGD)
+            {
+                for (int ch = 0 ; ch < 3 ; ch++)
+                    gradient_sum += std::abs(pixel[ch] - image_down[c][ch]);
+                gradient_count++;
+            }
+        }
+    }
+    if (count < (int64_t)image.rows * image.cols * MinBackdropRatio ||
+        gradient_count == 0)
+        return false;
+
+    double variance = 0;
+    for (int ch = 0 ; ch < 3 ; ch++)
+    {
+        backdrop.mean[ch] = sum[ch] / count;
+        variance += square_sum[ch] / count - backdrop.mean[ch] * backdrop.mean[ch];
+    }
+    backdrop.deviation = std::sqrt(std::max(variance, 0.0));
+    backdrop.gradient = gradient_sum / gradient_count;
+    return backdrop.deviation <= MaxBackdropDeviation &&
+           backdrop.gradient <= MaxBackdropGradient;
+}
+
+/* 按与背景色的颜色距离抠图，返回格式同GetAlphaMatte。
+ * mask中未确定的点先按距离分为可能前景／可能背景，经Clear去除孤立区域；
+ * 被Clear改写的点直接取全前景或全背景，其余未确定的点按距离渐变。
+ * 每行先求出颜色距离的平方（整数运算，便于编译器向量化），再逐点分类。
+ */
+cv::Mat ColorKeyMatte(const cv::Mat& image, cv::Mat& mask,
+                      const Backdrop& backdrop)
+{
+    sybie::common::StatingTestTimer timer("GetMixRaw.ColorKey");
+    const int low = std::max<int>(MinKeyDistance,
+                                  cvRound(backdrop.deviation * KeyDeviationFactor));
+    const int high = low + KeyRampDistance;
+    const int mid = (low + high) / 2;
+    const int key[3] = {cvRound(backdrop.mean[0]),
+                        cvRound(backdrop.mean[1]),
+                        cvRound(backdrop.mean[2])};
+
+    //颜色距离的平方
+    cv::Mat distance(image.rows, image.cols, CV_32SC1);
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const uint8_t* src = image.ptr<uint8_t>(r);
+        int* dist_row = distance.ptr<int>(r);
+        for (int c = 0 ; c < image.cols ; c++, src += 3)
+        {
+            const int d0 = src[0] - key[0];
+            const int d1 = src[1] - key[1];
+            const int d2 = src[2] - key[2];
+            dist_row[c] = d0 * d0 + d1 * d1 + d2 * d2;
+        }
+    }
+
+    //分类并去除孤立区域
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const int* dist_row = distance.ptr<int>(r);
+        uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        for (int c = 0 ; c < image.cols ; c++)
+            if (mask_row[c] == cv::GC_PR_FGD || mask_row[c] == cv::GC_PR_BGD)
+                mask_row[c] = dist_row[c] >= mid * mid ? cv::GC_PR_FGD : cv::GC_PR_BGD;
+    }
+    Clear(mask);
+
+    cv::Mat matte(image.rows, image.cols, CV_8UC4);
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const int* dist_row = distance.ptr<int>(r);
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(r);
+        cv::Vec4b* matte_row = matte.ptr<cv::Vec4b>(r);
+        for (int c = 0 ; c < image.cols ; c++)
+        {
+            const int dist = dist_row[c];
+            const uint8_t m = mask_row[c];
+            int alpha;
+            if (m == cv::GC_FGD ||
+                (m == cv::GC_PR_FGD && dist < mid * mid)) //Clear改为前景
+                alpha = 255;
+            else if (m == cv::GC_BGD ||
+                     (m == cv::GC_PR_BGD && dist >= mid * mid)) //Clear改为背景
+                alpha = 0;
+            else if (dist <= low * low)
+                alpha = 0;
+            else if (dist >= high * high)
+                alpha = 255;
+            else
+                alpha = TruncByte(cvRound(
+                    (std::sqrt((double)dist) - low) * 255 / (high - low)));
+
+            //背景色结果：同MatBorder，按Alpha混合背景色和像素本身
+            const cv::Vec3b& pixel = image_row[c];
+            cv::Vec3b back = pixel;
+            if (alpha > 0 && alpha < 255)
+                for (int ch = 0 ; ch < 3 ; ch++)
+                    back[ch] = TruncByte((key[ch] * alpha + pixel[ch] * (255 - alpha)) / 255);
+            matte_row[c] = cv::Vec4b(back[0], back[1], back[2], (uint8_t)alpha);
+        }
+    }
+    return matte;
+}
+
+/* profile.color_key且绝对背景区域近乎纯色时，按颜色距离抠图，结果写入matte并返回true；
+ * 否则返回false，应使用GrabCut。path不为nullptr时写入实际使用的流程。
+ */
+bool TryColorKey(const cv::Mat& image, cv::Mat& mask,
+                 const ProcessingProfile& profile,
+                 MattingPath* path, cv::Mat& matte)
+{
+    Backdrop backdrop;
+    const bool keyed = profile.color_key && AnalyzeBackdrop(image, mask, backdrop);
+    if (path != nullptr)
+        *path = keyed ? MattingPathColorKey : MattingPathGrabCut;
+    if (keyed)
+        matte = ColorKeyMatte(image, mask, backdrop);
+    return keyed;
+}
+
+} //namespace 颜色键抠图使用的组件
+
+/* 初始化前景／背景掩码：按人脸位置划分，再加上自定义的关键点。
+ */
+static cv::Mat InitMask(
     const cv::Mat& image,
     const cv::Rect& face_area,
     const cv::Mat& stroke)
@@ -211,7 +520,6 @@ cv::Mat GetAlphaMatte(
         << SHOW(image.rows)
         << SHOW(image.cols);
 
-    //初始化前景/背景掩码
     cv::Mat mask(image.rows, image.cols, CV_8UC1);
     DrawMask(mask, face_area, true, cv::GC_PR_FGD,
              cv::GC_FGD, cv::GC_PR_BGD, cv::GC_BGD, CV_FILLED);
@@ -228,35 +536,142 @@ cv::Mat GetAlphaMatte(
                     mask.at<uint8_t>(r,c) = stroke_point;
             }
     }
+    return mask;
+}
+
+/* 对InitMask的结果执行GrabCut，结果写回mask，
+ * 背景、前景的颜色模型写入bg_model、fg_model。
+ */
+static void GrabCutMask(
+    cv::Mat& mask,
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const ProcessingProfile& profile,
+    cv::Mat& bg_model,
+    cv::Mat& fg_model);
+
+void ResizeForGrabCut(
+    const cv::Mat& image,
+    cv::Mat& image_grab,
+    cv::Mat& image_init,
+    const ProcessingProfile& profile)
+{
+    cv::Size grab_size(image.cols * profile.grabcut_scale,
+                       image.rows * profile.grabcut_scale); //GrabCut缩略图尺寸
+    cv::Size init_size(image.cols * profile.grabcut_init_scale,
+                       image.rows * profile.grabcut_init_scale); //GrabCut初始化尺寸
+    cv::resize(image, image_grab, grab_size, 0, 0, cv::INTER_AREA);
+    cv::resize(image_grab, image_init, init_size, 0, 0, cv::INTER_AREA);
+}
+
+cv::Mat GetAlphaMatte(
+    const cv::Mat& image,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path)
+{
+    cv::Mat mask = InitMask(image, face_area, stroke);
+    cv::Mat matte;
+    if (TryColorKey(image, mask, profile, path, matte))
+        return matte;
+
+    cv::Mat image_grab, image_init;
+    ResizeForGrabCut(image, image_grab, image_init, profile);
+    cv::Mat bg_model, fg_model;
+    GrabCutMask(mask, image, image_grab, image_init, profile, bg_model, fg_model);
+    return MatteFromMask(image, mask, profile);
+}
 
+cv::Mat GetAlphaMatte(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path)
+{
+    cv::Mat mask = InitMask(image, face_area, stroke);
+    cv::Mat matte;
+    if (TryColorKey(image, mask, profile, path, matte))
+        return matte;
+
+    cv::Mat bg_model, fg_model;
+    GrabCutMask(mask, image, image_grab, image_init, profile, bg_model, fg_model);
+    return MatteFromMask(image, mask, profile);
+}
+
+cv::Mat GetGrabCutMask(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile)
+{
+    cv::Mat mask = InitMask(image, face_area, stroke);
+    cv::Mat bg_model, fg_model;
+    GrabCutMask(mask, image, image_grab, image_init, profile, bg_model, fg_model);
+    return mask;
+}
+
+static void GrabCutMask(
+    cv::Mat& mask,
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const ProcessingProfile& profile,
+    cv::Mat& bgModel,
+    cv::Mat& fgModel)
+{
     //使用cv::grabCut分离前景和背景
     {
         sybie::common::StatingTestTimer timer("GetMixRaw.grabCut");
 
         cv::Size full_size(image.cols,
                            image.rows); //缩略图尺寸
-        cv::Size grab_size(image.cols * GrabCutWidthScale,
-                           image.rows * GrabCutHeightScale); //GrabCut缩略图尺寸
-        cv::Size init_size(image.cols * GrabCutInitWidthScale,
-                           image.rows * GrabCutInitHeightScale); //GrabCut初始化尺寸
-
-        cv::Mat bgModel,fgModel; //前景模型、背景模型
 
         //初始化模型
-        cv::Mat image_init, mask_init;
-        cv::resize(image, image_init, init_size, 0, 0, cv::INTER_AREA);
-        cv::resize(mask, mask_init, init_size, 0, 0, cv::INTER_NEAREST);
+        cv::Mat mask_init;
+        cv::resize(mask, mask_init, image_init.size(), 0, 0, cv::INTER_NEAREST);
         cv::grabCut(image_init, mask_init, cv::Rect(),
                     bgModel,fgModel,
                     0, cv::GC_INIT_WITH_MASK);
+        CheckInterrupt();
 
         //抠图
-        cv::Mat image_grab, mask_grab;
-        cv::resize(image, image_grab, grab_size, 0, 0, cv::INTER_AREA);
-        cv::resize(mask, mask_grab, grab_size, 0, 0, cv::INTER_NEAREST);
-        cv::grabCut(image_grab, mask_grab, cv::Rect(),
-                    bgModel,fgModel,
-                    GrabCutInteration, cv::GC_EVAL);
+        cv::Mat mask_grab;
+        cv::resize(mask, mask_grab, image_grab.size(), 0, 0, cv::INTER_NEAREST);
+        //已确定的区域不需要构图，只对未确定的区域执行GrabCut。
+        //代价：GC_EVAL的每次迭代只按范围内的像素重新学习颜色模型，
+        //范围以外的背景颜色不再影响结果（见GrabCutRegion）
+        cv::Rect grab_area = profile.grabcut_region == GrabCutUndecided ?
+                             UndecidedArea(mask_grab) : WholeArea(mask_grab);
+        if (grab_area.width > 0 && grab_area.height > 0)
+        {
+            cv::Mat mask_grab_area = mask_grab(grab_area);
+            if (!IsInterruptible())
+            {
+                cv::grabCut(image_grab(grab_area), mask_grab_area, cv::Rect(),
+                            bgModel,fgModel,
+                            profile.grabcut_iterations, cv::GC_EVAL);
+            }
+            else
+            {
+                //逐次迭代（模型在调用之间延续，与一次执行多次迭代等价），
+                //超时时保留已完成迭代的结果
+                for (int i = 0 ; i < profile.grabcut_iterations ; i++)
+                {
+                    cv::grabCut(image_grab(grab_area), mask_grab_area, cv::Rect(),
+                                bgModel,fgModel,
+                                1, cv::GC_EVAL);
+                    if (i + 1 < profile.grabcut_iterations && StopWithPartial())
+                        break;
+                }
+            }
+        }
 
         //抠图结果恢复到最大尺寸
         cv::resize(mask_grab, mask,
@@ -268,13 +683,436 @@ cv::Mat GetAlphaMatte(
         sybie::common::StatingTestTimer timer("GetMixRaw.Clear");
         Clear(mask);
     }
+}
+
+/* 羽化边缘（MattingFeather）：前景为255、背景为0的掩码做盒式模糊，
+ * 半径为混合范围的平均值；不估计背景色，背景色取像素本身，
+ * 即替换背景时按Alpha直接混合新背景色。
+ */
+static cv::Mat FeatherMatte(
+    const cv::Mat& image,
+    const cv::Mat& mask,
+    const ProcessingProfile& profile)
+{
+    cv::Mat alpha(mask.rows, mask.cols, CV_8UC1);
+    for (int r = 0 ; r < mask.rows ; r++)
+    {
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        uint8_t* alpha_row = alpha.ptr<uint8_t>(r);
+        for (int c = 0 ; c < mask.cols ; c++)
+            alpha_row[c] = IsFront(mask_row[c]) ? 255 : 0;
+    }
+    const int radius = std::max(1, (profile.matting_front_range +
+                                    profile.matting_back_range) / 2);
+    cv::blur(alpha, alpha, cv::Size(radius * 2 + 1, radius * 2 + 1));
+
+    cv::Mat matte(image.rows, image.cols, CV_8UC4);
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(r);
+        const uint8_t* alpha_row = alpha.ptr<uint8_t>(r);
+        cv::Vec4b* matte_row = matte.ptr<cv::Vec4b>(r);
+        for (int c = 0 ; c < image.cols ; c++)
+            matte_row[c] = cv::Vec4b(image_row[c][0], image_row[c][1],
+                                     image_row[c][2], alpha_row[c]);
+    }
+    return matte;
+}
+
+cv::Mat MatteFromMask(
+    const cv::Mat& image,
+    const cv::Mat& mask,
+    const ProcessingProfile& profile)
+{
+    sybie::common::StatingTestTimer timer("GetMixRaw.Matting");
+    if (profile.matting_backend == MattingFeather)
+        return FeatherMatte(image, mask, profile);
+    //超过异步处理的期限时，以羽化边缘代替，返回部分结果
+    if (StopWithPartial())
+        return FeatherMatte(image, mask, profile);
+    try
+    {
+        if (profile.matting_backend == MattingGuided)
+            return GuidedMatte(image, MakeTrimap(image, mask, profile), profile);
+        return MatBorder(image, mask, profile);
+    }
+    catch (const Error& err)
+    {
+        if (err.Type() == Timeout && StopWithPartial())
+            return FeatherMatte(image, mask, profile);
+        throw;
+    }
+}
+
+double GetMattingScale(
+    const cv::Rect& face_area,
+    const ProcessingProfile& profile)
+{
+    if (profile.matting_face_size <= 0 ||
+        face_area.width <= profile.matting_face_size)
+        return 1;
+    return (double)profile.matting_face_size / face_area.width;
+}
+
+/* 把自定义的关键点（见InitMask）缩小到size。
+ * 按类别取最大值：缩小后的像素只要覆盖了原图中的某类关键点（GC_FGD、GC_BGD）
+ * 就标记为这类关键点，两类都有时GC_FGD优先；
+ * 最近邻采样会丢失比缩小倍数更细的笔画。
+ */
+static cv::Mat ShrinkStroke(const cv::Mat& stroke, const cv::Size& size)
+{
+    cv::Mat result(size, CV_8UC1, cv::Scalar(cv::GC_PR_FGD)); //不是关键点，InitMask忽略
+    for (int r = 0 ; r < stroke.rows ; r++)
+    {
+        const uint8_t* stroke_row = stroke.ptr<uint8_t>(r);
+        uint8_t* result_row = result.ptr<uint8_t>(r * size.height / stroke.rows);
+        for (int c = 0 ; c < stroke.cols ; c++)
+        {
+            const uint8_t point = stroke_row[c];
+            uint8_t& result_point = result_row[c * size.width / stroke.cols];
+            if (point == cv::GC_FGD ||
+                (point == cv::GC_BGD && result_point != cv::GC_FGD))
+                result_point = point;
+        }
+    }
+    return result;
+}
+
+cv::Mat GetAlphaMatteScaled(
+    const cv::Mat& image,
+    const cv::Rect& face_area,
+    const cv::Mat& stroke,
+    const ProcessingProfile& profile,
+    MattingPath* path)
+{
+    const double scale = GetMattingScale(face_area, profile);
+    if (scale >= 1)
+        return GetAlphaMatte(image, face_area, stroke, profile, path);
+
+    cv::Mat image_small;
+    cv::resize(image, image_small,
+               cv::Size(cvRound(image.cols * scale), cvRound(image.rows * scale)),
+               0, 0, cv::INTER_AREA);
+    cv::Mat stroke_small;
+    if (!stroke.empty())
+        stroke_small = ShrinkStroke(stroke, image_small.size());
+    cv::Rect face_area_small = OverlapArea(ScaleArea(face_area, scale),
+                                           WholeArea(image_small));
+
+    cv::Mat matte_small = GetAlphaMatte(image_small, face_area_small,
+                                        stroke_small, profile, path);
+    return UpsampleMatte(matte_small, image_small, image);
+}
+
+//连续帧复用抠图结果（GetAlphaMatteTemporal）的参数
+//像素任一通道与上一帧的差超过这个值，视为有变化
+enum { TemporalDiffThreshold = 20 };
+//变化掩码中值滤波的窗口（像素），去除零星的噪点
+enum { TemporalDenoiseSize = 3 };
+//按块标记变化区域，块的边长（像素）；相连的变化块合并为一个更新区域
+enum { TemporalTileSize = 16 };
+//有变化的像素超过这个比例时（例如换人、画面整体移动），完整抠图
+const double TemporalMaxChangedRatio = 0.3;
+//人脸位置的偏移、人脸大小的变化超过人脸大小的这些比例时，完整抠图
+const double TemporalMaxFaceShift = 0.2;
+const double TemporalMaxFaceScale = 0.05;
+//连续复用的帧数上限，之后完整抠图一次，避免误差累积
+enum { TemporalMaxReuseFrames = 30 };
+//复用时GrabCut的迭代次数
+enum { TemporalGrabCutIterations = 1 };
+
+void TemporalMatte::Reset()
+{
+    image.release();
+    mask.release();
+    matte.release();
+    bg_model.release();
+    fg_model.release();
+    frames = 0;
+}
+
+namespace { //GetAlphaMatteTemporal使用的组件
+
+//把src平移offset，移入的部分填充border
+cv::Mat Shift(const cv::Mat& src, const cv::Point& offset, const cv::Scalar& border)
+{
+    cv::Mat dst(src.rows, src.cols, src.type(), border);
+    const cv::Rect dst_area = OverlapArea(WholeArea(src) + offset, WholeArea(src));
+    if (dst_area.width > 0 && dst_area.height > 0)
+        src(dst_area - offset).copyTo(dst(dst_area));
+    return dst;
+}
+
+//rect向四周扩展margin，不超出image的范围
+cv::Rect ExpandArea(const cv::Rect& rect, int margin, const cv::Mat& image)
+{
+    return OverlapArea(cv::Rect(rect.x - margin, rect.y - margin,
+                                rect.width + margin * 2, rect.height + margin * 2),
+                       WholeArea(image));
+}
+
+/* 比较image和（已平移的）上一帧prev，valid_area以外的点在上一帧没有对应，也视为变化。
+ * 返回有变化的点（255）的掩码，已经过中值滤波去除零星的噪点。
+ */
+cv::Mat ChangedMask(const cv::Mat& image, const cv::Mat& prev, const cv::Rect& valid_area)
+{
+    cv::Mat changed(image.size(), CV_8UC1);
+    for (int r = 0 ; r < image.rows ; r++)
+    {
+        const uint8_t* image_row = image.ptr<uint8_t>(r);
+        const uint8_t* prev_row = prev.ptr<uint8_t>(r);
+        uint8_t* changed_row = changed.ptr<uint8_t>(r);
+        const bool row_valid = r >= valid_area.y && r < valid_area.y + valid_area.height;
+        for (int c = 0 ; c < image.cols ; c++)
+        {
+            bool point_changed = !row_valid || c < valid_area.x ||
+                                 c >= valid_area.x + valid_area.width;
+            for (int ch = 0 ; ch < 3 && !point_changed ; ch++)
+                point_changed = std::abs(image_row[c * 3 + ch] - prev_row[c * 3 + ch])
+                                > TemporalDiffThreshold;
+            changed_row[c] = point_changed ? 255 : 0;
+        }
+    }
+    cv::medianBlur(changed, changed, TemporalDenoiseSize);
+    return changed;
+}
+
+/* 把变化掩码按TemporalTileSize分块，有变化的点的块为变化块，
+ * 相连（8邻域）的变化块合并，返回各组块的外接矩形（不超出图像）。
+ * 分开的多处变化各自更新，不会合并成覆盖大半个画面的矩形。
+ */
+std::vector<cv::Rect> DirtyAreas(const cv::Mat& changed)
+{
+    const int tile_rows = (changed.rows + TemporalTileSize - 1) / TemporalTileSize;
+    const int tile_cols = (changed.cols + TemporalTileSize - 1) / TemporalTileSize;
+    cv::Mat dirty(tile_rows, tile_cols, CV_8UC1, cv::Scalar(0));
+    for (int r = 0 ; r < changed.rows ; r++)
+    {
+        const uint8_t* changed_row = changed.ptr<uint8_t>(r);
+        uint8_t* dirty_row = dirty.ptr<uint8_t>(r / TemporalTileSize);
+        for (int c = 0 ; c < changed.cols ; c++)
+            if (changed_row[c] != 0)
+                dirty_row[c / TemporalTileSize] = 1;
+    }
+
+    //逐组取出相连的变化块，取出后清除标记
+    std::vector<cv::Rect> areas;
+    std::vector<cv::Point> stack;
+    for (int tr = 0 ; tr < tile_rows ; tr++)
+        for (int tc = 0 ; tc < tile_cols ; tc++)
+        {
+            if (dirty.at<uint8_t>(tr, tc) == 0)
+                continue;
+            int top = tr, bottom = tr, left = tc, right = tc;
+            dirty.at<uint8_t>(tr, tc) = 0;
+            stack.push_back(cv::Point(tc, tr));
+            while (!stack.empty())
+            {
+                const cv::Point tile = stack.back();
+                stack.pop_back();
+                top = std::min(top, tile.y);
+                bottom = std::max(bottom, tile.y);
+                left = std::min(left, tile.x);
+                right = std::max(right, tile.x);
+                for (int y = std::max(0, tile.y - 1) ; y <= std::min(tile_rows - 1, tile.y + 1) ; y++)
+                    for (int x = std::max(0, tile.x - 1) ; x <= std::min(tile_cols - 1, tile.x + 1) ; x++)
+                        if (dirty.at<uint8_t>(y, x) != 0)
+                        {
+                            dirty.at<uint8_t>(y, x) = 0;
+                            stack.push_back(cv::Point(x, y));
+                        }
+            }
+            areas.push_back(OverlapArea(
+                cv::Rect(left * TemporalTileSize, top * TemporalTileSize,
+                         (right - left + 1) * TemporalTileSize,
+                         (bottom - top + 1) * TemporalTileSize),
+                WholeArea(changed)));
+        }
+    return areas;
+}
+
+//mask中是否同时有前景和背景的点，GrabCut按这些点学习两个颜色模型
+bool HasBothSamples(const cv::Mat& mask)
+{
+    bool front = false, back = false;
+    for (int r = 0 ; r < mask.rows && !(front && back) ; r++)
+    {
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        for (int c = 0 ; c < mask.cols ; c++)
+        {
+            if (IsFront(mask_row[c]))
+                front = true;
+            else
+                back = true;
+        }
+    }
+    return front && back;
+}
+
+/* 复用上一帧的结果：mask为本帧InitMask的结果，
+ * dirty_areas为有变化的区域（本帧坐标），本帧的抠图结果写入matte，mask写入本帧的掩码。
+ * 某个区域的GrabCut范围内缺少前景或背景的点时（无法学习颜色模型）返回false，
+ * 此时mask和state的颜色模型可能已被修改，应重新完整抠图。
+ */
+bool ReuseMatte(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    cv::Mat& mask,
+    const cv::Point& offset,
+    const std::vector<cv::Rect>& dirty_areas,
+    const ProcessingProfile& profile,
+    TemporalMatte& state,
+    cv::Mat& matte)
+{
+    //模板中已确定的区域保持不变，其余取上一帧的结果作为初值
+    const cv::Mat prev_mask = Shift(state.mask, offset, cv::Scalar(cv::GC_PR_BGD));
+    for (int r = 0 ; r < mask.rows ; r++)
+    {
+        uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        const uint8_t* prev_row = prev_mask.ptr<uint8_t>(r);
+        for (int c = 0 ; c < mask.cols ; c++)
+            if (mask_row[c] == cv::GC_PR_FGD || mask_row[c] == cv::GC_PR_BGD)
+                mask_row[c] = IsFront(prev_row[c]) ? cv::GC_PR_FGD : cv::GC_PR_BGD;
+    }
+
+    matte = Shift(state.matte, offset, cv::Scalar());
+    if (!dirty_areas.empty())
+    {
+        const int margin = std::max(profile.matting_front_range,
+                                    profile.matting_back_range) + 1;
+        std::vector<cv::Rect> update_areas;
+        for (size_t i = 0 ; i < dirty_areas.size() ; i++)
+            update_areas.push_back(ExpandArea(dirty_areas[i], margin, image));
+
+        //只在各变化区域附近执行GrabCut，以上一帧的颜色模型为初值
+        {
+            sybie::common::StatingTestTimer timer("GetAlphaMatteTemporal.grabCut");
+            cv::Mat mask_grab;
+            cv::resize(mask, mask_grab, image_grab.size(), 0, 0, cv::INTER_NEAREST);
+            const double grab_scale = (double)image_grab.cols / image.cols;
+            std::vector<cv::Rect> grab_areas;
+            for (size_t i = 0 ; i < update_areas.size() ; i++)
+            {
+                const cv::Rect grab_area = OverlapArea(
+                    UndecidedArea(mask_grab),
+                    ExpandArea(ScaleArea(update_areas[i], grab_scale), 1, mask_grab));
+                if (grab_area.width <= 0 || grab_area.height <= 0)
+                    continue;
+                cv::Mat mask_grab_area = mask_grab(grab_area);
+                if (!HasBothSamples(mask_grab_area))
+                    return false;
+                cv::grabCut(image_grab(grab_area), mask_grab_area, cv::Rect(),
+                            state.bg_model, state.fg_model,
+                            TemporalGrabCutIterations, cv::GC_EVAL);
+                grab_areas.push_back(grab_area);
+            }
+            //只把GrabCut改写过的范围恢复到原尺寸
+            if (!grab_areas.empty())
+            {
+                cv::Mat mask_full;
+                cv::resize(mask_grab, mask_full, mask.size(), 0, 0, cv::INTER_NEAREST);
+                for (size_t i = 0 ; i < grab_areas.size() ; i++)
+                {
+                    const cv::Rect full_area = OverlapArea(
+                        ScaleArea(grab_areas[i], 1 / grab_scale), WholeArea(mask));
+                    mask_full(full_area).copyTo(mask(full_area));
+                }
+            }
+        }
+        Clear(mask);
+
+        //只在各变化区域重新混合边缘，向外多取margin作为样本
+        for (size_t i = 0 ; i < update_areas.size() ; i++)
+        {
+            const cv::Rect& update_area = update_areas[i];
+            const cv::Rect sample_area = ExpandArea(update_area, margin, image);
+            const cv::Mat sub_matte = MatteFromMask(image(sample_area), mask(sample_area),
+                                                    profile);
+            sub_matte(update_area - sample_area.tl()).copyTo(matte(update_area));
+        }
+    }
+
+    //沿用上一帧的部分，Alpha为0的点背景色取本帧的像素
+    for (int r = 0 ; r < matte.rows ; r++)
+    {
+        cv::Vec4b* matte_row = matte.ptr<cv::Vec4b>(r);
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(r);
+        for (int c = 0 ; c < matte.cols ; c++)
+            if (matte_row[c][3] == 0)
+                matte_row[c] = cv::Vec4b(image_row[c][0], image_row[c][1],
+                                         image_row[c][2], 0);
+    }
+    return true;
+}
 
+} //namespace GetAlphaMatteTemporal使用的组件
+
+cv::Mat GetAlphaMatteTemporal(
+    const cv::Mat& image,
+    const cv::Mat& image_grab,
+    const cv::Mat& image_init,
+    const cv::Rect& face_area,
+    const ProcessingProfile& profile,
+    TemporalMatte& state,
+    MattingPath* path)
+{
+    sybie::common::StatingTestTimer timer("GetAlphaMatteTemporal");
+    state.reused = false;
+    state.changed_ratio = 1;
+
+    cv::Mat mask = InitMask(image, face_area, cv::Mat());
     cv::Mat matte;
+    if (TryColorKey(image, mask, profile, path, matte))
     {
-        sybie::common::StatingTestTimer timer("GetMixRaw.Matting");
-        matte = MatBorder(image, mask);
+        //颜色键抠图本身很快，不复用
+        state.Reset();
+        return matte;
     }
 
+    //人脸位置和大小与上一帧相近时，比较两帧的差异
+    const cv::Point offset = face_area.tl() - state.face_area.tl();
+    const double max_shift = face_area.width * TemporalMaxFaceShift;
+    std::vector<cv::Rect> dirty_areas;
+    if (!state.matte.empty() &&
+        state.image.size() == image.size() &&
+        std::abs(face_area.width - state.face_area.width)
+            <= face_area.width * TemporalMaxFaceScale &&
+        std::abs(offset.x) <= max_shift && std::abs(offset.y) <= max_shift &&
+        state.frames < TemporalMaxReuseFrames)
+    {
+        const cv::Rect valid_area = OverlapArea(WholeArea(image) + offset,
+                                                WholeArea(image));
+        const cv::Mat changed = ChangedMask(
+            image, Shift(state.image, offset, cv::Scalar()), valid_area);
+        state.changed_ratio = (double)cv::countNonZero(changed) / image.total();
+        state.reused = state.changed_ratio <= TemporalMaxChangedRatio;
+        if (state.reused)
+            dirty_areas = DirtyAreas(changed);
+    }
+
+    if (state.reused)
+    {
+        cv::Mat reuse_mask = mask.clone(); //复用失败时用原来的mask完整抠图
+        state.reused = ReuseMatte(image, image_grab, reuse_mask, offset, dirty_areas,
+                                  profile, state, matte);
+        if (state.reused)
+        {
+            mask = reuse_mask;
+            state.frames++;
+        }
+    }
+    if (!state.reused)
+    {
+        GrabCutMask(mask, image, image_grab, image_init, profile,
+                    state.bg_model, state.fg_model);
+        matte = MatteFromMask(image, mask, profile);
+        state.frames = 0;
+    }
+
+    state.image = image.clone(); //image的内存空间可能被下一帧改写
+    state.face_area = face_area;
+    state.mask = mask;
+    state.matte = matte;
     return matte;
 }
 
@@ -307,25 +1145,194 @@ cv::Rect Extend(
 
 cv::Mat Mix(
     const cv::Mat& image,
-    const cv::Mat& raw,
+    const SparseMatte& matte,
     const cv::Vec3b& back_color,
     const double mix_alpha)
 {
-    assert(mix_alpha >= 0 && mix_alpha <= 1);
-    cv::Mat image_mix(image.rows, image.cols, CV_8UC3);
-    for (int r = 0 ; r < image.rows ; r++)
-        for (int c = 0 ; c < image.cols ; c++)
+    cv::Mat image_mix;
+    MixCrop(image, matte, WholeArea(image), back_color, mix_alpha, image_mix);
+    return image_mix;
+}
+
+//定点混合比例的精度（位数）
+enum { MixWeightBits = 8 };
+
+/* 用定点整数替换一行中的背景：
+ * mix = src + (back_color - backc) * (1 - alpha / 255) * mix_alpha
+ * backc：原背景色，半透明区间以外就是src。
+ * weight：按Alpha查表得到的(1 - alpha / 255) * mix_alpha，以1<<MixWeightBits为1。
+ */
+static void MixRow(
+    const uint8_t* src,
+    const uint8_t* backc,
+    const uint8_t* alpha,
+    const int back_color[3],
+    const int weight[256],
+    int count,
+    uint8_t* mix)
+{
+    for (int i = 0 ; i < count ; i++, src += 3, backc += 3, mix += 3)
+    {
+        const int w = weight[alpha[i]];
+        for (int ch = 0 ; ch < 3 ; ch++)
+            mix[ch] = TruncByte(src[ch] +
+                (((back_color[ch] - backc[ch]) * w
+                  + (1 << (MixWeightBits - 1))) >> MixWeightBits));
+    }
+}
+
+//用back_color填充一行中的count个像素
+static void FillRow(uint8_t* row, const cv::Vec3b& back_color, int count)
+{
+    for (int i = 0 ; i < count ; i++, row += 3)
+    {
+        row[0] = back_color[0];
+        row[1] = back_color[1];
+        row[2] = back_color[2];
+    }
+}
+
+//MixCropMulti每次处理的行数
+enum { MixTileRows = 16 };
+
+namespace { //MixCropMulti内使用的组件
+
+//一个输出目标预先计算的参数
+struct MixCropContext
+{
+    MixCropContext(const MixCropTarget& target, const cv::Mat& image)
+        : area(target.area), back_color(target.back_color)
+    {
+        assert(target.mix_alpha >= 0 && target.mix_alpha <= 1);
+
+        //Alpha对应的定点混合比例
+        const int mix_weight = cvRound(target.mix_alpha * (1 << MixWeightBits));
+        for (int a = 0 ; a < 256 ; a++)
+            weight[a] = ((255 - a) * mix_weight + 127) / 255;
+        for (int ch = 0 ; ch < 3 ; ch++)
+            back[ch] = back_color[ch];
+
+        //area中在image以内的部分（相对area的坐标）
+        inner = SubArea(OverlapArea(area, WholeArea(image)), area);
+        if (inner.width <= 0 || inner.height <= 0)
+            inner = cv::Rect(0, 0, 0, 0);
+    }
+
+    /* 输出原图第src_begin到src_end行（不含）对应的结果行，
+     * 行号可以超出image范围，超出的部分填充背景色。
+     */
+    void MixRows(const cv::Mat& image, const SparseMatte& matte, cv::Mat& output,
+                 int src_begin, int src_end) const
+    {
+        const int begin = std::max(src_begin - area.y, 0);
+        const int end = std::min(src_end - area.y, area.height);
+        for (int r = begin ; r < end ; r++)
         {
-            const cv::Vec4b& p = raw.at<cv::Vec4b>(r,c);
-            const uint8_t& pixiel_alpha = p[3];
-            const cv::Vec3b& backc = *(const cv::Vec3b*)(const void*)&p;
-
-            const cv::Vec3b& src = image.at<cv::Vec3b>(r,c);
-            cv::Vec3b& mix = image_mix.at<cv::Vec3b>(r,c);
-            mix = (cv::Vec3i)src + (((cv::Vec3i)back_color - (cv::Vec3i)backc)
-                        * (1 - (double)pixiel_alpha / 255) * mix_alpha);
+            uint8_t* out_row = output.ptr<uint8_t>(r);
+            if (r < inner.y || r >= inner.y + inner.height)
+            {
+                FillRow(out_row, back_color, area.width);
+                continue;
+            }
+
+            FillRow(out_row, back_color, inner.x);
+            MixInner(image, matte, area.y + r, out_row + inner.x * 3);
+            FillRow(out_row + (inner.x + inner.width) * 3, back_color,
+                    area.width - inner.x - inner.width);
         }
-    return image_mix;
+    }
+
+    /* 输出原图第src_y行在inner内的部分，
+     * 半透明区间内的背景色取matte，区间以外取原图颜色。
+     */
+    void MixInner(const cv::Mat& image, const SparseMatte& matte,
+                  int src_y, uint8_t* out) const
+    {
+        const int begin = area.x + inner.x;
+        const int end = begin + inner.width;
+        const uint8_t* src = image.ptr<uint8_t>(src_y);
+        const uint8_t* alpha = matte.GetAlphaRow(src_y);
+        const uint8_t* colors = (const uint8_t*)matte.GetColors(src_y);
+
+        int x = begin;
+        for (const MatteSpan* span = matte.GetSpanBegin(src_y) ;
+             span != matte.GetSpanEnd(src_y) && span->begin < end ;
+             span++)
+        {
+            if (span->end <= x)
+                continue;
+            const int span_begin = std::max(span->begin, x);
+            const int span_end = std::min(span->end, end);
+            MixRow(src + x * 3, src + x * 3, alpha + x,
+                   back, weight, span_begin - x,
+                   out + (x - begin) * 3);
+            MixRow(src + span_begin * 3,
+                   colors + (span->color + span_begin - span->begin) * 3,
+                   alpha + span_begin,
+                   back, weight, span_end - span_begin,
+                   out + (span_begin - begin) * 3);
+            x = span_end;
+        }
+        MixRow(src + x * 3, src + x * 3, alpha + x,
+               back, weight, end - x,
+               out + (x - begin) * 3);
+    }
+
+    cv::Rect area;
+    cv::Rect inner;
+    cv::Vec3b back_color;
+    int back[3];
+    int weight[256];
+}; //struct MixCropContext
+
+} //namespace MixCropMulti内使用的组件
+
+void MixCrop(
+    const cv::Mat& image,
+    const SparseMatte& matte,
+    const cv::Rect& area,
+    const cv::Vec3b& back_color,
+    const double mix_alpha,
+    cv::Mat& output)
+{
+    std::vector<MixCropTarget> targets(1);
+    targets[0].area = area;
+    targets[0].back_color = back_color;
+    targets[0].mix_alpha = mix_alpha;
+    std::vector<cv::Mat> outputs(1, output);
+    MixCropMulti(image, matte, targets, outputs);
+    output = outputs[0];
+}
+
+void MixCropMulti(
+    const cv::Mat& image,
+    const SparseMatte& matte,
+    const std::vector<MixCropTarget>& targets,
+    std::vector<cv::Mat>& outputs)
+{
+    assert(image.type() == CV_8UC3);
+    assert(image.size() == matte.GetSize());
+
+    outputs.resize(targets.size());
+    std::vector<MixCropContext> contexts;
+    contexts.reserve(targets.size());
+    //所有目标覆盖的行范围的并集（原图坐标），只处理这些行
+    int top = std::numeric_limits<int>::max();
+    int bottom = std::numeric_limits<int>::min();
+    for (size_t i = 0 ; i < targets.size() ; i++)
+    {
+        contexts.push_back(MixCropContext(targets[i], image));
+        outputs[i].create(targets[i].area.height, targets[i].area.width, CV_8UC3);
+        top = std::min(top, targets[i].area.y);
+        bottom = std::max(bottom, targets[i].area.y + targets[i].area.height);
+    }
+
+    for (int tile = top ; tile < bottom ; tile += MixTileRows)
+    {
+        const int tile_end = std::min(tile + MixTileRows, bottom);
+        for (size_t i = 0 ; i < contexts.size() ; i++)
+            contexts[i].MixRows(image, matte, outputs[i], tile, tile_end);
+    }
 }
 
 }  //namespace portrait
@@ -0,0 +1,253 @@
+#include "portrait/async.hh"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "sybie/common/Uncopyable.hh"
+
+#include "portrait/adaptive.hh"
+#include "portrait/exception.hh"
+#include "portrait/facedetect.hh"
+#include "portrait/interrupt.hh"
+
+//线程局部变量：VS2013不支持thread_local关键字
+#ifdef _MSC_VER
+#define PORTRAIT_THREAD_LOCAL __declspec(thread)
+#else
+#define PORTRAIT_THREAD_LOCAL __thread
+#endif
+
+namespace portrait {
+
+CancelToken::CancelToken()
+    : _cancelled(new std::atomic<bool>(false))
+{ }
+
+void CancelToken::Cancel()
+{
+    *_cancelled = true;
+}
+
+bool CancelToken::IsCancelled() const
+{
+    return *_cancelled;
+}
+
+AsyncOptions::AsyncOptions()
+    : deadline(Clock::time_point::max()), cancel(),
+      allow_partial(false), adaptive(false)
+{ }
+
+AsyncOptions::Clock::time_point AsyncOptions::After(int milliseconds)
+{
+    return Clock::now() + std::chrono::milliseconds(milliseconds);
+}
+
+//当前线程的中断条件，没有时为nullptr
+static PORTRAIT_THREAD_LOCAL InterruptScope* CurrentScope = nullptr;
+
+InterruptScope::InterruptScope(const AsyncOptions& options)
+    : _options(options), _partial(false), _outer(CurrentScope)
+{
+    CurrentScope = this;
+}
+
+InterruptScope::~InterruptScope()
+{
+    CurrentScope = _outer;
+}
+
+void CheckInterrupt()
+{
+    const InterruptScope* scope = CurrentScope;
+    if (scope == nullptr)
+        return;
+    if (scope->_options.cancel.IsCancelled())
+        throw Error(Cancelled);
+    if (AsyncOptions::Clock::now() > scope->_options.deadline)
+        throw Error(Timeout);
+}
+
+bool StopWithPartial()
+{
+    InterruptScope* scope = CurrentScope;
+    if (scope == nullptr)
+        return false;
+    if (scope->_options.allow_partial &&
+        !scope->_options.cancel.IsCancelled() &&
+        AsyncOptions::Clock::now() > scope->_options.deadline)
+    {
+        scope->_partial = true;
+        return true;
+    }
+    CheckInterrupt();
+    return false;
+}
+
+bool HasStoppedWithPartial()
+{
+    return CurrentScope != nullptr && CurrentScope->IsPartial();
+}
+
+bool IsInterruptible()
+{
+    return CurrentScope != nullptr;
+}
+
+namespace {  //PortraitProcessSemiAsync使用的组件
+
+    /* 库内部的线程池，任务按提交的顺序执行。
+     * 析构（程序结束）时放弃未开始的任务，等待正在执行的任务结束。
+     */
+    class Executor : sybie::common::Uncopyable
+    {
+    public:
+        typedef std::function<void()> Task;
+
+        Executor()
+            : _mutex(), _ready(), _tasks(), _stopping(false), _threads()
+        {
+            InitFaceDetect(); //工作线程并发检测之前初始化
+            const unsigned count = std::max(1u, std::thread::hardware_concurrency());
+            for (unsigned i = 0 ; i < count ; i++)
+                _threads.push_back(std::thread(&Executor::Run, this));
+        }
+
+        ~Executor()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stopping = true;
+            }
+            _ready.notify_all();
+            for (size_t i = 0 ; i < _threads.size() ; i++)
+                _threads[i].join();
+        }
+
+        void Post(const Task& task)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _tasks.push_back(task);
+            }
+            _ready.notify_one();
+        }
+    private:
+        void Run()
+        {
+            while (true)
+            {
+                Task task;
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    while (!_stopping && _tasks.empty())
+                        _ready.wait(lock);
+                    if (_stopping)
+                        return;
+                    task = std::move(_tasks.front());
+                    _tasks.pop_front();
+                }
+                task();
+            }
+        }
+
+        std::mutex _mutex;
+        std::condition_variable _ready;
+        std::deque<Task> _tasks;
+        bool _stopping;
+        std::vector<std::thread> _threads;
+    }; //class Executor
+
+    //第一次使用时创建
+    Executor& GetExecutor()
+    {
+        static Executor executor;
+        return executor;
+    }
+
+    /* 在线程池中执行process，在options的中断条件下。
+     * options.adaptive为true时，process收到按期限选择参数的请求，否则收到nullptr。
+     */
+    std::future<AsyncSemiResult> Submit(
+        const AsyncOptions& options,
+        const ProcessingProfile& profile,
+        const std::function<SemiData(AdaptiveQuality*)>& process)
+    {
+        std::shared_ptr<std::promise<AsyncSemiResult> > promise(
+            new std::promise<AsyncSemiResult>());
+        std::future<AsyncSemiResult> future = promise->get_future();
+        GetExecutor().Post([options, profile, process, promise]()
+        {
+            try
+            {
+                InterruptScope scope(options);
+                CheckInterrupt(); //在队列中等待期间可能已超时或被取消
+                AsyncSemiResult result;
+                if (options.adaptive)
+                {
+                    AdaptiveQuality adaptive;
+                    adaptive.deadline = options.deadline;
+                    adaptive.choice = DefaultQuality(profile);
+                    result.semi = process(&adaptive);
+                    result.quality = adaptive.choice;
+                }
+                else
+                {
+                    result.semi = process(nullptr);
+                    result.quality = DefaultQuality(profile);
+                }
+                result.partial = scope.IsPartial();
+                promise->set_value(std::move(result));
+            }
+            catch (...)
+            {
+                promise->set_exception(std::current_exception());
+            }
+        });
+        return future;
+    }
+
+} //namespace PortraitProcessSemiAsync使用的组件
+
+std::future<AsyncSemiResult> PortraitProcessSemiAsync(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const AsyncOptions& options,
+    const ProcessingProfile& profile)
+{
+    return Submit(options, profile,
+                  [photo, face_resize_to, profile](AdaptiveQuality* adaptive)
+    {
+        return adaptive != nullptr ?
+            PortraitProcessSemiAdaptive(photo, face_resize_to, profile, *adaptive) :
+            PortraitProcessSemi(photo, face_resize_to, profile);
+    });
+}
+
+std::future<AsyncSemiResult> PortraitProcessSemiAsync(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const AsyncOptions& options,
+    const ProcessingProfile& profile)
+{
+    return Submit(options, profile,
+                  [photo, face_resize_to, crop_size, vertical_offset, profile]
+                  (AdaptiveQuality* adaptive)
+    {
+        return adaptive != nullptr ?
+            PortraitProcessSemiAdaptive(photo, face_resize_to,
+                                        crop_size, vertical_offset, profile, *adaptive) :
+            PortraitProcessSemi(photo, face_resize_to,
+                                crop_size, vertical_offset, profile);
+    });
+}
+
+}  //namespace portrait
@@ -0,0 +1,362 @@
+//这是对cascade.hh的实现
+#include "portrait/cascade.hh"
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <mutex>
+#include <stdexcept>
+
+#include "sybie/common/Time.hh"
+
+namespace portrait {
+
+//合并检测结果时的相似度，同cv::CascadeClassifier
+const double GroupEps = 0.2;
+//强分类器阈值的修正，同cv::CascadeClassifier
+const float StageThresholdEps = 1e-5f;
+
+static void CheckCascade(bool condition)
+{
+    if (!condition)
+        throw std::runtime_error("Invalid cascade.");
+}
+
+HaarCascade::HaarCascade(const cv::FileNode& node)
+    : _window((int)node["width"], (int)node["height"]),
+      _stages(), _stumps(), _features()
+{
+    CheckCascade((std::string)node["featureType"] == "HAAR");
+    CheckCascade(_window.width > 2 && _window.height > 2);
+
+    const cv::FileNode stages = node["stages"];
+    for (cv::FileNodeIterator it = stages.begin() ; it != stages.end() ; ++it)
+    {
+        HaarStage stage;
+        stage.first = (int)_stumps.size();
+        stage.threshold = (float)(*it)["stageThreshold"] - StageThresholdEps;
+        const cv::FileNode weaks = (*it)["weakClassifiers"];
+        for (cv::FileNodeIterator weak = weaks.begin() ; weak != weaks.end() ; ++weak)
+        {
+            //internalNodes：left right featureIdx threshold，叶子为序号的相反数
+            std::vector<double> nodes, leaves;
+            (*weak)["internalNodes"] >> nodes;
+            (*weak)["leafValues"] >> leaves;
+            CheckCascade(nodes.size() == 4 && leaves.size() == 2); //只支持单节点
+            const int left = -(int)nodes[0], right = -(int)nodes[1];
+            CheckCascade(left >= 0 && left < 2 && right >= 0 && right < 2);
+            HaarStump stump;
+            stump.feature = (int)nodes[2];
+            stump.threshold = (float)nodes[3];
+            stump.left = (float)leaves[left];
+            stump.right = (float)leaves[right];
+            _stumps.push_back(stump);
+        }
+        stage.count = (int)_stumps.size() - stage.first;
+        _stages.push_back(stage);
+    }
+
+    const cv::FileNode features = node["features"];
+    for (cv::FileNodeIterator it = features.begin() ; it != features.end() ; ++it)
+    {
+        CheckCascade((int)(*it)["tilted"] == 0);
+        HaarFeature feature;
+        feature.rect_count = 0;
+        const cv::FileNode rects = (*it)["rects"];
+        for (cv::FileNodeIterator r = rects.begin() ; r != rects.end() ; ++r)
+        {
+            std::vector<double> values;
+            *r >> values;
+            CheckCascade(values.size() == 5 && feature.rect_count < HaarFeature::MaxRects);
+            HaarRect& rect = feature.rects[feature.rect_count++];
+            rect.x = (int)values[0];
+            rect.y = (int)values[1];
+            rect.width = (int)values[2];
+            rect.height = (int)values[3];
+            rect.weight = (float)values[4];
+            CheckCascade(rect.x >= 0 && rect.y >= 0 &&
+                         rect.x + rect.width <= _window.width &&
+                         rect.y + rect.height <= _window.height);
+        }
+        _features.push_back(feature);
+    }
+
+    CheckCascade(!_stages.empty());
+    for (size_t i = 0 ; i < _stumps.size() ; i++)
+        CheckCascade(_stumps[i].feature >= 0 &&
+                     _stumps[i].feature < (int)_features.size());
+}
+
+namespace {  //HaarCascade::Detect内使用的组件
+
+    /* 矩形在积分图中四个角的偏移（相对窗口左上角），
+     * 矩形内的和为 p[0] - p[1] - p[2] + p[3]。
+     */
+    void RectOffsets(int x, int y, int width, int height, int step, int offsets[4])
+    {
+        offsets[0] = y * step + x;
+        offsets[1] = y * step + x + width;
+        offsets[2] = (y + height) * step + x;
+        offsets[3] = (y + height) * step + x + width;
+    }
+
+    template<class T>
+    T RectSum(const T* p, const int offsets[4])
+    {
+        return p[offsets[0]] - p[offsets[1]] - p[offsets[2]] + p[offsets[3]];
+    }
+
+    //一个特征在某一级别积分图中的偏移
+    struct LevelFeature
+    {
+        int offsets[HaarFeature::MaxRects][4];
+        float weights[HaarFeature::MaxRects];
+        int rect_count;
+    };
+
+    //各级别共享的检测结果
+    class Collector
+    {
+    public:
+        Collector(int min_neighbors, int max_faces)
+            : _min_neighbors(min_neighbors), _max_faces(max_faces),
+              _mutex(), _candidates(), _stopped(false)
+        { }
+
+        //加入一个级别的候选窗口，max_faces大于0时检查是否已经可以停止
+        void Add(const std::vector<cv::Rect>& hits)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _candidates.insert(_candidates.end(), hits.begin(), hits.end());
+            if (_max_faces > 0 && CountDistinct(Group(_candidates)) >= _max_faces)
+                _stopped = true;
+        }
+
+        bool Stopped() const
+        {
+            return _stopped;
+        }
+
+        std::vector<cv::Rect> Result()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return Group(_candidates);
+        }
+
+    private:
+        std::vector<cv::Rect> Group(std::vector<cv::Rect> rects) const
+        {
+            cv::groupRectangles(rects, _min_neighbors, GroupEps);
+            return rects;
+        }
+
+        //互不重叠的矩形个数（按顺序贪心选取）
+        static int CountDistinct(const std::vector<cv::Rect>& rects)
+        {
+            std::vector<cv::Rect> selected;
+            for (size_t i = 0 ; i < rects.size() ; i++)
+            {
+                bool overlap = false;
+                for (size_t k = 0 ; k < selected.size() && !overlap ; k++)
+                    overlap = (rects[i] & selected[k]).area() > 0;
+                if (!overlap)
+                    selected.push_back(rects[i]);
+            }
+            return (int)selected.size();
+        }
+
+        const int _min_neighbors;
+        const int _max_faces;
+        std::mutex _mutex;
+        std::vector<cv::Rect> _candidates;
+        std::atomic<bool> _stopped;
+    }; //class Collector
+
+    //每个任务检测一个缩放级别
+    class LevelBody : public cv::ParallelLoopBody
+    {
+    public:
+        LevelBody(const cv::Mat& image,
+                  const std::vector<double>& factors,
+                  const cv::Size& window,
+                  const std::vector<HaarStage>& stages,
+                  const std::vector<HaarStump>& stumps,
+                  const std::vector<HaarFeature>& features,
+                  Collector& collector)
+            : _image(image), _factors(factors), _window(window),
+              _stages(stages), _stumps(stumps), _features(features),
+              _collector(collector)
+        { }
+
+        void operator()(const cv::Range& range) const
+        {
+            for (int i = range.start ; i < range.end && !_collector.Stopped() ; i++)
+                DetectLevel(_factors[i]);
+        }
+
+    private:
+        void DetectLevel(double factor) const;
+
+        const cv::Mat& _image;
+        const std::vector<double>& _factors;
+        const cv::Size _window;
+        const std::vector<HaarStage>& _stages;
+        const std::vector<HaarStump>& _stumps;
+        const std::vector<HaarFeature>& _features;
+        Collector& _collector;
+    }; //class LevelBody
+
+    /* 在缩小factor倍的图像上，以原始窗口大小扫描。
+     * 水平相邻的Lanes个窗口为一组逐级计算，组内共用各特征的偏移；
+     * 已被拒绝的窗口不再计算，整组都被拒绝时进入下一组。
+     * 各窗口的积分图地址不连续，计算是逐窗口的标量运算。
+     */
+    void LevelBody::DetectLevel(double factor) const
+    {
+        const int lanes = HaarCascade::Lanes;
+        cv::Mat scaled;
+        if (factor == 1)
+            scaled = _image;
+        else
+            cv::resize(_image, scaled,
+                       cv::Size(cvRound(_image.cols / factor), cvRound(_image.rows / factor)),
+                       0, 0, cv::INTER_LINEAR);
+        cv::Mat sum, sqsum;
+        cv::integral(scaled, sum, sqsum, CV_32S);
+        const int step = (int)sum.step1();
+        const int sq_step = (int)sqsum.step1();
+
+        //各特征在本级别积分图中的偏移
+        std::vector<LevelFeature> level_features(_features.size());
+        for (size_t i = 0 ; i < _features.size() ; i++)
+        {
+            const HaarFeature& feature = _features[i];
+            LevelFeature& level_feature = level_features[i];
+            level_feature.rect_count = feature.rect_count;
+            for (int r = 0 ; r < feature.rect_count ; r++)
+            {
+                const HaarRect& rect = feature.rects[r];
+                RectOffsets(rect.x, rect.y, rect.width, rect.height, step,
+                            level_feature.offsets[r]);
+                level_feature.weights[r] = rect.weight;
+            }
+        }
+
+        //方差归一化使用窗口去掉1像素边框的区域
+        int norm_offsets[4], norm_sq_offsets[4];
+        RectOffsets(1, 1, _window.width - 2, _window.height - 2, step, norm_offsets);
+        RectOffsets(1, 1, _window.width - 2, _window.height - 2, sq_step, norm_sq_offsets);
+        const double norm_area = (double)(_window.width - 2) * (_window.height - 2);
+
+        const int max_x = scaled.cols - _window.width;
+        const int max_y = scaled.rows - _window.height;
+        const int xy_step = factor > 2 ? 1 : 2;
+        const cv::Size window_size(cvRound(_window.width * factor),
+                                   cvRound(_window.height * factor));
+
+        std::vector<cv::Rect> hits;
+        for (int y = 0 ; y <= max_y ; y += xy_step)
+        {
+            const int* sum_row = sum.ptr<int>(y);
+            const double* sq_row = sqsum.ptr<double>(y);
+            for (int x = 0 ; x <= max_x ; x += xy_step * lanes)
+            {
+                const int* base[lanes];
+                float norm[lanes];
+                bool alive[lanes];
+                for (int l = 0 ; l < lanes ; l++)
+                {
+                    const int lane_x = x + l * xy_step;
+                    alive[l] = lane_x <= max_x;
+                    const int window_x = alive[l] ? lane_x : x;
+                    base[l] = sum_row + window_x;
+                    const double mean_sum = RectSum(base[l], norm_offsets);
+                    const double square_sum = RectSum(sq_row + window_x, norm_sq_offsets);
+                    const double nf = norm_area * square_sum - mean_sum * mean_sum;
+                    norm[l] = (float)(1 / (nf > 0 ? std::sqrt(nf) : 1.0));
+                }
+
+                bool any_alive = true;
+                for (size_t s = 0 ; s < _stages.size() && any_alive ; s++)
+                {
+                    const HaarStage& stage = _stages[s];
+                    float stage_sum[lanes] = {0};
+                    for (int k = stage.first ; k < stage.first + stage.count ; k++)
+                    {
+                        const HaarStump& stump = _stumps[k];
+                        const LevelFeature& feature = level_features[stump.feature];
+                        for (int l = 0 ; l < lanes ; l++)
+                        {
+                            if (!alive[l])
+                                continue;
+                            float value = 0;
+                            for (int r = 0 ; r < feature.rect_count ; r++)
+                                value += feature.weights[r] * RectSum(base[l], feature.offsets[r]);
+                            stage_sum[l] += value * norm[l] < stump.threshold ?
+                                            stump.left : stump.right;
+                        }
+                    }
+                    any_alive = false;
+                    for (int l = 0 ; l < lanes ; l++)
+                    {
+                        alive[l] = alive[l] && stage_sum[l] >= stage.threshold;
+                        any_alive = any_alive || alive[l];
+                    }
+                }
+
+                for (int l = 0 ; l < lanes ; l++)
+                    if (any_alive && alive[l])
+                        hits.push_back(cv::Rect(cvRound((x + l * xy_step) * factor),
+                                                cvRound(y * factor),
+                                                window_size.width, window_size.height));
+            }
+
+            //其它级别已经找到足够多的人脸
+            if (_collector.Stopped())
+                return;
+        }
+
+        //每个级别只提交一次：每次提交都要合并全部候选窗口
+        if (!hits.empty())
+            _collector.Add(hits);
+    }
+
+} //namespace HaarCascade::Detect内使用的组件
+
+std::vector<cv::Rect> HaarCascade::Detect(
+    const cv::Mat& image,
+    double scale_factor,
+    int min_neighbors,
+    const cv::Size& min_size,
+    const cv::Size& max_size,
+    int max_faces) const
+{
+    assert(image.type() == CV_8UC1 && scale_factor > 1);
+    sybie::common::StatingTestTimer timer("HaarCascade::Detect");
+
+    //缩放级别
+    std::vector<double> factors;
+    for (double factor = 1 ; ; factor *= scale_factor)
+    {
+        const cv::Size window_size(cvRound(_window.width * factor),
+                                   cvRound(_window.height * factor));
+        //缩小后的图像与窗口一样大时还有一个窗口位置，同cv::CascadeClassifier
+        if (cvRound(image.cols / factor) < _window.width ||
+            cvRound(image.rows / factor) < _window.height)
+            break;
+        if (max_size.width > 0 &&
+            (window_size.width > max_size.width || window_size.height > max_size.height))
+            break;
+        if (window_size.width < min_size.width || window_size.height < min_size.height)
+            continue;
+        factors.push_back(factor);
+    }
+
+    Collector collector(min_neighbors, max_faces);
+    cv::parallel_for_(cv::Range(0, (int)factors.size()),
+                      LevelBody(image, factors, _window,
+                                _stages, _stumps, _features, collector));
+    return collector.Result();
+}
+
+}  //namespace portrait
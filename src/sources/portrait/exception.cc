@@ -10,6 +10,9 @@ static std::string GetErrorDescription(ErrorType _type)
     ERRORMSG(FaceNotFound);
     ERRORMSG(TooManyFaces);
     ERRORMSG(OutOfRange);
+    ERRORMSG(InvalidData);
+    ERRORMSG(Timeout);
+    ERRORMSG(Cancelled);
     return "Unknown";
 }
 
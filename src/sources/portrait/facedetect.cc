@@ -1,46 +1,50 @@
 #include "portrait/facedetect.hh"
 
+#include <mutex>
+
 #include "sybie/common/RichAssert.hh" //sybie_assert
+#include "sybie/common/Time.hh" //sybie::common::StatingTestTimer
 #include "sybie/datain/datain.hh" //sybie::datain::GetTemp
 
+#include "portrait/cascade.hh"
 #include "portrait/exception.hh"
+#include "portrait/graphics.hh"
 
 namespace portrait {
 
 namespace {
 
-/* 这个类通过继承cv::CascadeClassifier，允许从FileNode加载旧式分类器。
- *
- * 解释：
- * （1）cv::CascadeClassifier支持加载OpenCV 1.x（旧）或OpenCV 2.x（新）的分类器。
- * （2）新分类器可以通过文件或内存方式（cv::FileNode）加载，
- *     但由于未知动机，OpenCV 1.x分类器只能通过文件加载。
- * （3）OpenCV只集成OpenCV 1.x分类器，而本项目为了方便跨平台开发，
- *     把分类器数据嵌入到代码中。
+/* 分类器数据嵌入在代码中（见haarcascade.cc），以cv::FileNode方式加载。
+ * 嵌入的是由OpenCV 1.x分类器haarcascade_frontalface_alt.xml转换得到的OpenCV 2.x格式
+ * （转换工具见tools/main_cascade.cc，make/common中执行make haarcascade重新生成），
+ * 检测时使用新式的特征计算器，可多线程执行，而不是单线程的cvHaarDetectObjects。
  */
-class OldCascadeClassifier : public cv::CascadeClassifier
-{
-public:
-    OldCascadeClassifier(const cv::FileNode &node)
-    {
-        oldCascade = cv::Ptr<CvHaarClassifierCascade>(
-            (CvHaarClassifierCascade*)node.readObj());
-    }
-}; //class MyCascadeClassifier
-
 cv::FileStorage GetFaceCascadeClassifierStorage()
 {
-    std::string data = sybie::datain::Load("haarcascade_frontalface_alt.xml");
+    std::string data = sybie::datain::Load("haarcascade_frontalface_alt_new.xml");
     return cv::FileStorage(data, cv::FileStorage::MEMORY | cv::FileStorage::READ);
 }
 
 cv::CascadeClassifier& GetFaceCascadeClassifier()
 {
-    static OldCascadeClassifier face_cascade(
+    static cv::CascadeClassifier face_cascade;
+    static const bool loaded = face_cascade.read(
         GetFaceCascadeClassifierStorage().getFirstTopLevelNode()); //首次调用时初始化
-    if (face_cascade.empty())
+    if (!loaded || face_cascade.empty())
         throw std::runtime_error("Failed load cascade.");
-    return static_cast<cv::CascadeClassifier&>(face_cascade);
+    return face_cascade;
+}
+
+//cv::CascadeClassifier::detectMultiScale不能并发，检测时加锁。
+//在main之前构造：VS2013的函数内静态变量的初始化不是线程安全的
+std::mutex FaceCascadeMutex;
+
+//同一分类器数据由本项目的HaarCascade加载（FaceDetectorNative）
+const HaarCascade& GetHaarCascade()
+{
+    static const HaarCascade haar_cascade(
+        GetFaceCascadeClassifierStorage().getFirstTopLevelNode()); //首次调用时初始化
+    return haar_cascade;
 }
 
 }  //namespace
@@ -48,20 +52,139 @@ cv::CascadeClassifier& GetFaceCascadeClassifier()
 void InitFaceDetect()
 {
     GetFaceCascadeClassifier();
+    GetHaarCascade();
 }
 
-std::vector<cv::Rect> DetectFaces(const cv::Mat& image)
+//分类器合并相邻检测结果时要求的最少结果数
+enum { MinNeighbors = 2 };
+//精确定位时，人脸缩放到的边长（像素）
+enum { RefineFaceSize = 96 };
+//精确定位的搜索范围，在粗略结果的四周扩展的比例（相对人脸大小）
+const double RefineMargin = 0.3;
+//精确定位时，人脸大小相对粗略结果的范围
+const double RefineMinRatio = 0.7, RefineMaxRatio = 1.4;
+
+/* 按profile.face_detector选择分类器，检测min_size ~ max_size的人脸。
+ * max_faces大于0时，FaceDetectorNative找到max_faces个互不重叠的人脸后立即停止。
+ * HaarCascade检测时只读，可并发执行；cv::CascadeClassifier::detectMultiScale
+ * 会修改分类器内部的状态，不能并发，各线程的调用逐个执行。
+ */
+static std::vector<cv::Rect> RunCascade(
+    const cv::Mat& image,
+    const cv::Size& min_size,
+    const cv::Size& max_size,
+    const ProcessingProfile& profile,
+    int max_faces = 0)
 {
+    if (profile.face_detector == FaceDetectorNative)
+        return GetHaarCascade().Detect(image, profile.detect_scale_factor, MinNeighbors,
+                                       min_size, max_size, max_faces);
+    std::lock_guard<std::mutex> lock(FaceCascadeMutex);
     std::vector<cv::Rect> faces;
     GetFaceCascadeClassifier().detectMultiScale(
-        image, faces, 1.1, 2,
-        0|CV_HAAR_SCALE_IMAGE, cv::Size(128, 128));
+        image, faces, profile.detect_scale_factor, MinNeighbors, 0, min_size, max_size);
+    return faces;
+}
+
+bool TrackFace(
+    const cv::Mat& image,
+    const cv::Rect& face,
+    const double margin,
+    const ProcessingProfile& profile,
+    cv::Rect& result)
+{
+    const int margin_x = cvRound(face.width * margin);
+    const int margin_y = cvRound(face.height * margin);
+    const cv::Rect roi = OverlapArea(
+        cv::Rect(face.x - margin_x, face.y - margin_y,
+                 face.width + margin_x * 2, face.height + margin_y * 2),
+        WholeArea(image));
+    if (roi.width <= 0 || roi.height <= 0)
+        return false;
+    const double scale = std::min(1.0, (double)RefineFaceSize / face.width);
+    cv::Mat roi_image;
+    if (scale < 1)
+        cv::resize(image(roi), roi_image,
+                   cv::Size(cvRound(roi.width * scale), cvRound(roi.height * scale)),
+                   0, 0, cv::INTER_AREA);
+    else
+        roi_image = image(roi);
+
+    const int face_size = cvRound(face.width * scale);
+    const int min_size = cvRound(face_size * RefineMinRatio);
+    const int max_size = cvRound(face_size * RefineMaxRatio);
+    const std::vector<cv::Rect> hits = RunCascade(
+        roi_image, cv::Size(min_size, min_size), cv::Size(max_size, max_size), profile);
+    if (hits.empty())
+        return false;
+
+    //取与face重叠最多的一个
+    const cv::Rect face_in_roi = ScaleArea(face - roi.tl(), scale);
+    size_t best = 0;
+    for (size_t i = 1 ; i < hits.size() ; i++)
+        if ((hits[i] & face_in_roi).area() > (hits[best] & face_in_roi).area())
+            best = i;
+    //按1 / scale放大时的舍入可能超出图像约1像素
+    result = OverlapArea(ScaleArea(hits[best], 1 / scale) + roi.tl(), WholeArea(image));
+    return true;
+}
+
+/* 在粗略结果face（image坐标）附近的较高分辨率上重新检测，返回更精确的位置。
+ * 搜索范围为face四周扩展RefineMargin，找不到时返回face。
+ */
+static cv::Rect RefineFace(
+    const cv::Mat& image,
+    const cv::Rect& face,
+    const ProcessingProfile& profile)
+{
+    cv::Rect result;
+    return TrackFace(image, face, RefineMargin, profile, result) ? result : face;
+}
+
+std::vector<cv::Rect> DetectFaces(
+    const cv::Mat& image,
+    const ProcessingProfile& profile,
+    int max_faces)
+{
+    sybie::common::StatingTestTimer timer("DetectFaces");
+    const int min_size = profile.detect_min_face_size;
+    const int coarse_size = profile.detect_coarse_face_size;
+    if (coarse_size <= 0 || coarse_size >= min_size)
+        return RunCascade(image, cv::Size(min_size, min_size), cv::Size(),
+                          profile, max_faces);
+
+    //先在缩小的图像上粗略检测，最小人脸缩小到coarse_size
+    const double scale = (double)coarse_size / min_size;
+    cv::Mat coarse;
+    cv::resize(image, coarse,
+               cv::Size(cvRound(image.cols * scale), cvRound(image.rows * scale)),
+               0, 0, cv::INTER_AREA);
+    std::vector<cv::Rect> faces = RunCascade(
+        coarse, cv::Size(coarse_size, coarse_size), cv::Size(), profile, max_faces);
+
+    //再逐个在原图坐标中精确定位
+    for (size_t i = 0 ; i < faces.size() ; i++)
+    {
+        const cv::Rect face = OverlapArea(ScaleArea(faces[i], 1 / scale),
+                                          WholeArea(image));
+        faces[i] = RefineFace(image, face, profile);
+    }
     return faces;
 }
 
-cv::Rect DetectSingleFace(const cv::Mat& image)
+std::vector<cv::Rect> DetectFaces(
+    const cv::Mat& image,
+    const ProcessingProfile& profile)
+{
+    return DetectFaces(image, profile, 0);
+}
+
+cv::Rect DetectSingleFace(
+    const cv::Mat& image,
+    const ProcessingProfile& profile)
 {
-    std::vector<cv::Rect> faces = DetectFaces(image);
+    //只需知道人脸是否多于一个，找到两个即可停止
+    std::vector<cv::Rect> faces = DetectFaces(image, profile, 2);
     if (faces.size() == 0)
         throw Error(FaceNotFound);
     if (faces.size() > 1)
@@ -95,4 +95,10 @@ cv::Rect SubArea(const cv::Rect& rect1, const cv::Rect& rect2)
     return SubArea(rect1, TopLeft(rect2));
 }
 
+cv::Rect ScaleArea(const cv::Rect& rect, double scale)
+{
+    return cv::Rect(cvRound(rect.x * scale), cvRound(rect.y * scale),
+                    cvRound(rect.width * scale), cvRound(rect.height * scale));
+}
+
 }  //namespace portrait
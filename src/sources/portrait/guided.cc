@@ -0,0 +1,285 @@
+//这是对guided.hh的实现
+#include "portrait/guided.hh"
+
+#include <cassert>
+#include <vector>
+
+#include "sybie/common/Time.hh"
+
+#include "portrait/math.hh"
+
+namespace portrait {
+
+//UpsampleMatte引导滤波的窗口半径（低分辨率的像素）
+enum { GuidedRadius = 2 };
+//UpsampleMatte引导滤波的正则化系数，越大越平滑（引导图和Alpha都归一化到0 ~ 1）
+const double GuidedEps = 1e-3;
+//GuidedMatte引导滤波的正则化系数，Trimap的跳变比Alpha大，需要更小的值才能贴合图像边缘
+const double GuidedMatteEps = 1e-4;
+
+//取灰度并归一化到0 ~ 1
+static cv::Mat GuideOf(const cv::Mat& image)
+{
+    cv::Mat gray, guide;
+    cv::cvtColor(image, gray, CV_BGR2GRAY);
+    gray.convertTo(guide, CV_32F, 1.0 / 255);
+    return guide;
+}
+
+//BoxMean中每个任务处理的行数
+enum { BoxBandRows = 64 };
+
+namespace {  //按行分块并行的方框均值
+
+    /* 每块先累加窗口内各列的和，之后每下移一行只加入新行、移出旧行；
+     * 每行再沿水平方向滑动求和。每个像素只需常数次加减，与半径无关。
+     * 列的累加是对连续float数组的逐元素运算，便于编译器向量化。
+     * 每块重新开始累加，浮点误差不会随图像高度积累。
+     */
+    class BoxMeanBody : public cv::ParallelLoopBody
+    {
+    public:
+        BoxMeanBody(const cv::Mat& src, cv::Mat& dst, int radius)
+            : _src(src), _dst(dst), _radius(radius)
+        { }
+
+        void operator()(const cv::Range& bands) const
+        {
+            const int rows = _src.rows;
+            const int cols = _src.cols;
+            const int r = _radius;
+            const int begin = bands.start * BoxBandRows;
+            const int end = std::min(bands.end * BoxBandRows, rows);
+
+            std::vector<float> col_sum(cols, 0.0f);
+            for (int y = std::max(begin - r, 0) ; y < std::min(begin + r + 1, rows) ; y++)
+                AddRow(col_sum, y, 1.0f);
+
+            for (int y = begin ; y < end ; y++)
+            {
+                if (y > begin)
+                {
+                    if (y - r - 1 >= 0)
+                        AddRow(col_sum, y - r - 1, -1.0f);
+                    if (y + r < rows)
+                        AddRow(col_sum, y + r, 1.0f);
+                }
+                const int row_count = std::min(y + r, rows - 1) - std::max(y - r, 0) + 1;
+
+                float* dst_row = _dst.ptr<float>(y);
+                double sum = 0;
+                for (int x = 0 ; x < std::min(r, cols - 1) + 1 ; x++)
+                    sum += col_sum[x];
+                for (int x = 0 ; x < cols ; x++)
+                {
+                    const int col_count = std::min(x + r, cols - 1) - std::max(x - r, 0) + 1;
+                    dst_row[x] = (float)(sum / (row_count * col_count));
+                    if (x + r + 1 < cols)
+                        sum += col_sum[x + r + 1];
+                    if (x - r >= 0)
+                        sum -= col_sum[x - r];
+                }
+            }
+        }
+
+    private:
+        void AddRow(std::vector<float>& col_sum, int y, float sign) const
+        {
+            const float* src_row = _src.ptr<float>(y);
+            float* sum = col_sum.data();
+            for (int x = 0 ; x < _src.cols ; x++)
+                sum[x] += sign * src_row[x];
+        }
+
+        const cv::Mat& _src;
+        cv::Mat& _dst;
+        const int _radius;
+    }; //class BoxMeanBody
+
+} //namespace 按行分块并行的方框均值
+
+/* src（CV_32F）在(2*radius+1)×(2*radius+1)窗口内的均值，
+ * 窗口超出图像的部分不计入。
+ */
+static cv::Mat BoxMean(const cv::Mat& src, int radius)
+{
+    assert(src.type() == CV_32F);
+    cv::Mat dst(src.size(), CV_32F);
+    const int band_count = (src.rows + BoxBandRows - 1) / BoxBandRows;
+    cv::parallel_for_(cv::Range(0, band_count), BoxMeanBody(src, dst, radius));
+    return dst;
+}
+
+/* 引导滤波的局部线性系数：在每个窗口内 p ≈ a * guide + b。
+ * 返回窗口平均后的系数mean_a、mean_b。
+ */
+static void GuidedCoefficients(
+    const cv::Mat& guide, const cv::Mat& p,
+    int radius, double eps,
+    cv::Mat& mean_a, cv::Mat& mean_b)
+{
+    cv::Mat mean_i = BoxMean(guide, radius);
+    cv::Mat mean_p = BoxMean(p, radius);
+    cv::Mat var_i = BoxMean(guide.mul(guide), radius) - mean_i.mul(mean_i);
+    cv::Mat cov_ip = BoxMean(guide.mul(p), radius) - mean_i.mul(mean_p);
+    cv::Mat a = cov_ip / (var_i + eps);
+    cv::Mat b = mean_p - a.mul(mean_i);
+    mean_a = BoxMean(a, radius);
+    mean_b = BoxMean(b, radius);
+}
+
+cv::Mat UpsampleMatte(
+    const cv::Mat& matte_small,
+    const cv::Mat& image_small,
+    const cv::Mat& image)
+{
+    assert(matte_small.type() == CV_8UC4 && image_small.type() == CV_8UC3);
+    assert(matte_small.size() == image_small.size() && image.type() == CV_8UC3);
+    sybie::common::StatingTestTimer timer("UpsampleMatte");
+    const cv::Size size = image.size();
+
+    //拆分低分辨率的背景色和Alpha
+    cv::Mat raw_small(matte_small.size(), CV_8UC3);
+    cv::Mat alpha_small(matte_small.size(), CV_8UC1);
+    {
+        cv::Mat out[] = {raw_small, alpha_small};
+        int from_to[] = {0,0, 1,1, 2,2, 3,3};
+        cv::mixChannels(&matte_small, 1, out, 2, from_to, 4);
+    }
+
+    //低分辨率上求局部线性系数：alpha = a * guide + b
+    cv::Mat p;
+    alpha_small.convertTo(p, CV_32F, 1.0 / 255);
+    cv::Mat mean_a_small, mean_b_small;
+    GuidedCoefficients(GuideOf(image_small), p, GuidedRadius, GuidedEps,
+                       mean_a_small, mean_b_small);
+
+    //系数放大到高分辨率
+    cv::Mat mean_a, mean_b;
+    cv::resize(mean_a_small, mean_a, size, 0, 0, cv::INTER_LINEAR);
+    cv::resize(mean_b_small, mean_b, size, 0, 0, cv::INTER_LINEAR);
+    cv::Mat guide = GuideOf(image);
+
+    //邻域Alpha的范围，限制结果
+    cv::Mat low_small, high_small, low, high;
+    cv::erode(alpha_small, low_small, cv::Mat());
+    cv::dilate(alpha_small, high_small, cv::Mat());
+    cv::resize(low_small, low, size, 0, 0, cv::INTER_LINEAR);
+    cv::resize(high_small, high, size, 0, 0, cv::INTER_LINEAR);
+
+    //背景色：只对非全前景的像素插值（全前景像素的背景色无意义）
+    cv::Mat weight_small, raw_weighted_small;
+    cv::Mat(alpha_small < 255).convertTo(weight_small, CV_32F, 1.0 / 255);
+    raw_small.convertTo(raw_weighted_small, CV_32FC3);
+    {
+        cv::Mat weight3;
+        cv::Mat weights[] = {weight_small, weight_small, weight_small};
+        cv::merge(weights, 3, weight3);
+        raw_weighted_small = raw_weighted_small.mul(weight3);
+    }
+    cv::Mat weight, raw_weighted;
+    cv::resize(weight_small, weight, size, 0, 0, cv::INTER_LINEAR);
+    cv::resize(raw_weighted_small, raw_weighted, size, 0, 0, cv::INTER_LINEAR);
+
+    cv::Mat matte(size, CV_8UC4);
+    for (int y = 0 ; y < size.height ; y++)
+    {
+        const float* a_row = mean_a.ptr<float>(y);
+        const float* b_row = mean_b.ptr<float>(y);
+        const float* guide_row = guide.ptr<float>(y);
+        const uint8_t* low_row = low.ptr<uint8_t>(y);
+        const uint8_t* high_row = high.ptr<uint8_t>(y);
+        const float* weight_row = weight.ptr<float>(y);
+        const cv::Vec3f* raw_row = raw_weighted.ptr<cv::Vec3f>(y);
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(y);
+        cv::Vec4b* matte_row = matte.ptr<cv::Vec4b>(y);
+        for (int x = 0 ; x < size.width ; x++)
+        {
+            const cv::Vec3b& pixel = image_row[x];
+            int alpha;
+            if (high_row[x] == 0)
+                alpha = 0;
+            else if (low_row[x] == 255)
+                alpha = 255;
+            else
+                alpha = std::min<int>(std::max<int>(
+                    cvRound((a_row[x] * guide_row[x] + b_row[x]) * 255),
+                    low_row[x]), high_row[x]);
+
+            cv::Vec3b back = pixel;
+            if (alpha > 0 && alpha < 255 && weight_row[x] > 0)
+                for (int ch = 0 ; ch < 3 ; ch++)
+                    back[ch] = TruncByte(cvRound(raw_row[x][ch] / weight_row[x]));
+            matte_row[x] = cv::Vec4b(back[0], back[1], back[2], (uint8_t)alpha);
+        }
+    }
+    return matte;
+}
+
+cv::Mat GuidedMatte(
+    const cv::Mat& image,
+    const cv::Mat& trimap,
+    const ProcessingProfile& profile)
+{
+    assert(image.type() == CV_8UC3 && trimap.type() == CV_8UC1);
+    assert(image.size() == trimap.size());
+    sybie::common::StatingTestTimer timer("GuidedMatte");
+    const int radius = std::max(profile.matting_front_range, 1);
+    const int back_radius = std::max(profile.matting_back_range, 1);
+
+    //Trimap（未确定区域为0.5）以图像为引导滤波
+    cv::Mat p;
+    trimap.convertTo(p, CV_32F, 1.0 / 255);
+    cv::Mat mean_a, mean_b;
+    cv::Mat guide = GuideOf(image);
+    GuidedCoefficients(guide, p, radius, GuidedMatteEps, mean_a, mean_b);
+
+    //背景色：附近全背景像素的平均
+    cv::Mat back_weight;
+    cv::Mat(trimap == 0).convertTo(back_weight, CV_32F, 1.0 / 255);
+    cv::Mat back_mean[3];
+    {
+        cv::Mat image_f;
+        image.convertTo(image_f, CV_32FC3);
+        cv::Mat planes[3];
+        cv::split(image_f, planes);
+        for (int ch = 0 ; ch < 3 ; ch++)
+            back_mean[ch] = BoxMean(planes[ch].mul(back_weight), back_radius);
+    }
+    cv::Mat weight_mean = BoxMean(back_weight, back_radius);
+
+    cv::Mat matte(image.size(), CV_8UC4);
+    for (int y = 0 ; y < image.rows ; y++)
+    {
+        const uint8_t* trimap_row = trimap.ptr<uint8_t>(y);
+        const float* a_row = mean_a.ptr<float>(y);
+        const float* b_row = mean_b.ptr<float>(y);
+        const float* guide_row = guide.ptr<float>(y);
+        const float* weight_row = weight_mean.ptr<float>(y);
+        const float* back_rows[3] = {back_mean[0].ptr<float>(y),
+                                     back_mean[1].ptr<float>(y),
+                                     back_mean[2].ptr<float>(y)};
+        const cv::Vec3b* image_row = image.ptr<cv::Vec3b>(y);
+        cv::Vec4b* matte_row = matte.ptr<cv::Vec4b>(y);
+        for (int x = 0 ; x < image.cols ; x++)
+        {
+            const cv::Vec3b& pixel = image_row[x];
+            int alpha = trimap_row[x];
+            if (alpha != 0 && alpha != 255)
+                alpha = TruncByte(cvRound(
+                    (a_row[x] * guide_row[x] + b_row[x]) * 255));
+
+            //背景色结果：同MatBorder，按Alpha混合背景色和像素本身
+            cv::Vec3b back = pixel;
+            if (alpha > 0 && alpha < 255 && weight_row[x] > 0)
+                for (int ch = 0 ; ch < 3 ; ch++)
+                    back[ch] = TruncByte(cvRound(
+                        (back_rows[ch][x] / weight_row[x] * alpha
+                         + pixel[ch] * (255 - alpha)) / 255));
+            matte_row[x] = cv::Vec4b(back[0], back[1], back[2], (uint8_t)alpha);
+        }
+    }
+    return matte;
+}
+
+}  //namespace portrait
@@ -1,1988 +1,1906 @@
 //Generated by DataIn, do not modify.
-//Generated from /usr/local/share/OpenCV/haarcascades/haarcascade_frontalface_alt.xml
+//Generated from obj/haarcascade_frontalface_alt_new.xml
 #include "sybie/datain/DataItem.hh"
 
-static sybie::datain::DataItem item0("haarcascade_frontalface_alt.xml",0,
-"-A9EmR5F-WNRi1YTb9tSfzcRz8ICk0Z8-uZ2y4IBje08W028JHNTj1NBY5sSbH68o03Uo038dLcRqnMPW46PX9sRlD7TWOcSlv6TXn68c5sOb12PbHNPZHtRovI1zGtG"
-"oLMOqL6PW8MUW8LOfvMPo12JfLcRe5cSqvY2AyY-10WM100y4fW2W0IID1rJIHLGEHbEW8LH1H482LaHF9LHWGqJNv4JF54H9vqHi0oGF1LM9vqHi0IIED5L1n4J9vqH"
-"WyaKWKrK9vqHk4GHC9KUWGsRtv6Rl56PfvsPi0oOl1NU5a0FfvsSq56RibcRd1oRo1ITp5G2OI7Qb1oSlP6Tt5cSb1IUlL78XTcSbL68qz68qXMQp12RfDMPkDNPk40d"
-"0OM1WG1Pl1YRlHdLd000i4X7H080i41T8mY2WK0Y9a70b9pT0GWBA4WjM500OaaRqL6RWmK26I08150dCqMPkHN9cwI00WcHl978F1NPk1oKlLdSZL683zMRmL7Tb978"
-"MbMGWG78CbcOo5cSvfW2WCqRmbdSfT6Qq12A3b28o03CmmI3c1qGl97Sl9NOqbsRkn28Xn6RWKm9SD78oLsSb9dTbHcBA02LebcSa12SX97TvLmpD8I8y01Soz6Sb506"
-"4ycP1uD1f9N0um6SbD6TfPNPWysTkLcSpvY2A0YKbHMQpHdSf9MT1W6CW4cRa1ITpL68fv68pbWk181HYbcRX9NUWOsRorsSi0oTfH7QXWJ08WoRrH78jz6PfPMQZbGg"
-"0eG2znHPorMQqHNPa5mXaONQaL6PWG7QXHN09Y18cz6RizsTXmE4ZzcRabM0t1mS5K33jL6TwKYU0eYEM201dCN05t0ayCsRaL68jLtSq1YSbHNOfvM1K1HOYzcTbbZ0"
-"1912fDMPXKE1W0IKvGmSq5WHkG700uM0MwIa0G2PfDtOi5MQjLcSXi10WuKY0GGQkvY314HYK0dSlHMTZbqH+p802n801GNONm0PlDMT1rM9fbaSK5cRazoRo1oRqXMP"
-"o1IRXHNPobMOiDNEr5oe9mJFb71tSG5Qb1YRXrMPXSHIOtbSC0IRXbN87X08YLMGH00PX986bv6Pl9tSb52-O0dSlrsRqLM0801PrD6TpbmZiGMPobcTbH68c9tRjboT"
-"rjS0A6KB1DOGk028m9NQl978t9NGdGWRWKKC0CNOR4Wd0GLOhNnE0aM7HJWOvLmp1EKHip18ez6RaLcSp5Y2XmTIAZoRoD78Y4sSWasSY4G68g08XvMUWK6Um9NPpD78"
-"l978fr6SibMPa1oTX9dSXv6TfLsS1c12ZnMT96A1YLNH2118ibMRf54n8GtRiKWTDS30Aq1EXm3EjLcSZXMOkHNOYb6RfHNU1874WOMQqvM0j1XPl978XLMeqasOrnMO"
-"o12Sr97SlDNP55VLlH4Pke089v68kz68bPNPkH78pXMOl72z6XP04ycSsWE0S8MPWmMQX96R1XC0oLGweGMQoLsOqnY2WacRDi0BWacRZb6Pbv6TXn6Bf8O09GIPuLMR"
-"mnMOob7BDK5LpLMSrLcRqbMOi12PXrMOdLsSA02AfP761G1SozsOr9Nf5423uCNTYD7TfHNTqL68dzsRaLYR1wA8fDMPpjZ2WmsRX480c5aKKm28a56TXLmUS0dSlPMQ"
-"qDtE1S80Y5y1Xe37fv6Tb9dSr1NWWWJAWWsRtLcTb978Z5MTpLM9HZ0PWyMWlM448ycSv5GVXWG9321BWS7QbL654acRfu24XD6Ti0IWe3mOXSTBgI0BA4WSCGtRoHN7"
-"dJ28kLsPibsPbvsO5bUPR1oTfDNPf0IOobMnZ2GQ9W73t5MUW4aq8ycPAKogXUJfiHGQpL5l0mI9Hp18fP68XHcTf5E-5826b12SlDtSfbGh1C13pLtOer2TOwY2jqYF"
-"AmpRmLcRZPtNpHtRo5sPbvZ2yWMOX9tOXDtOXHMPVPcSl52pEe22qyLOiH78qb7SbzLQarZ89O30j40BmroOi5sSpbcPfLcSYuZ2W02FpbcUbvZCm0YCmmpB5mG1L00T"
-"XSU0Bm08WmpN9W01W0Y3sY00WKm6802CW4mZXU46W02Fq9NPbrGB14G6n4G05KJ0Y83D04G0sW20Dy52ozsRXP61aLM7XbG0SmZPb56Tr9NPHuO4100F1TT7-5H00npN"
-"+C38t0ICq02DWqICkmpBLWS61K090aJ0aWWCW8J1ZG0Fl8rJ0W2Fqb6RqL6P+03FlqW24mpBI190Km3Te9NPp5uVav3Dk0JCq4JErWpDqCpCpC3EnSJPj03CpmpBPCIB"
-"2bG0qn3RbP6TVPNOiv3Ck0pCpSJEq4JEmSpCqOZCqa3FlKH7sG305+U3rG4EpS3En0ZDvKJCt4pCrOZCyyI6U4m-1GG5+OZV1aZf04ZEv5WDe0W-c6WJc605n0YCW43E"
-"sPQ0WS38o0YDWG38puVf1uJf1G4Ck0JCr4JDnCpCvK3Ep0JEuaZaW60FnKJCq4pCo0ZCoWJDtOZDs89e1mpDqW3Eu4ZCo03EnSJDsKJEI3Q008Z-W6WoW605t0ICr0IE"
-"kPq0C438n0J0b0mC+BQ069Q04HZBo43CvapCnWJCv43DmaJCnewH3WJEm03Dv83EnSJCsC3DsSZad60DsCpDqWJCvWpDqSZDpGJGHOqH3G0Fl4uqLQ70yKg50yLUP34C"
-"kWZCoO3EvGJCq0ZCqCJDp4gNXML7aqsYim3SX9NPkHdFj43Flqm2He12kL6U9WH19KtlvDPPtM0MoWx0+BP1+BP1c9P18K38sKcog5P11f62o0oC+3P161P105ZBs8ZC"
-"t43CvKJEmK3Dr8JEk2P1qOJEp03ErWZDq43Es83EMca0uSJCn0JEqOJCtW3DpOZCtODy3uFa5OCa5GmDW4Yf0CZRa602v0IDbGg-FMWGFM0HouYCv0ZDsGJEpaZCma3E"
-"nW3Ecs+0y4pDvK3EmC3Cn03DsCpDnKZbjF0EsO3EsaZCoCJCnS3EoW3D+JP1+JP1QIP1KG38m0ICoO7b5W0DWCJ0au-a5eqa5GJDk03CoKpDmW3Cq83CuumR8egf1GZD"
-"vCZDt8JEuG3EpW3DuOfE70XDrK3Dm46XOGJCsKJErKZqc600pulE78iE70WDEmb28038uusI3mWDW4pCXt30quVy4OKy4GnDkaZDraJm5Y1CuSpDo8pDgsq0qK3EsOpC"
-"p83CrGJCpWJCXXXY1g0EmaJCq43Dr43EsK3DpGZDMVQ00GZ-d6Wmd602p0YDEC03oTQ0bGg4CnW-emWGem07jCZBr8ZCt0JmQYnDuaZDt0JEg+q0uGJCp4ZDsapDm0JC"
-"qKpDoOPz4m0Cp43EEa93GKJEp0pDXHeHYZW64YWB0uG018XS8u0-8G08ruFg18Cg1mGCq0ICXiA0mu6K3KG9bug-f6WGf6W3Ns0DsOZDtO3EvO3En0JDp8Zaim0EpOpD"
-"rOpDo4JCpWJErGJCMAF18SJEo4IfW83DrW3EtSJDs8jy40WD+FQ02FQ0GS38u0ID1RdQXd00t4080KZ-DtWJDt0HvuoCpOJCqS3DrSpCs4ZCo4pCccq0uOJCs4pCuKpD"
-"tGZDn83DoOfu9WZCmW3Er0JEvGpDmOJCrCZrYd00tulf18if1WGCW4Z3ozWSZd00tK6R+t32Ar320XZBsaZDnCJCq03Eo43DrOJEgs32K83EpOZCpuW3EGXCt03EtGZb"
-"kJ0DpO3CoSpCvKpDoKZCr0ZrN410uuVf1eSf1W0EW4Z3u3XQBD00nuGO84Yg+pE12nE184ZBnuWhGG2Em8ZDpO3DnGpDgsI3e8ZCoCJDu0JEoOZD1cF0p8ff1mJDu03C"
-"t03CtWpCt8JErKpCI7F10aZ-c6Wnc600s81cI0WCoPQ0CO38t0Imywlf18af1GGBo4ofmGZDuapDuS3Cp0ZCo0ZfoJ06oG3CsGZDq4YTE4I404Zbd6G0fHIDqWJEsCJD"
-"qOpDMFU2XBC0jOYO8u3P8uVPKuKPK0GDfnaSe600r4Q58838nuFg1O4g10YCk4ZCna3Cs0Z3Ux03mG3Epewf1WJDrKJEsK3DuCJCuWZDoaZbYd07nCZDo8pCt0J07m0E"
-"nW3CIxq004Z-y1Xny111nGZ4V810n87g1KG9Imj3+7r065r0m0ZBmapCvGJEnGZDrOZ3wbWbad01uKJmZnnDoWpCt0ZDsuW+CeuBDm3Dt4pDtG3Cn43Er0pCrSJCMNQ0"
-"+7X567X5Eq740GZUa6G0aumiNaYeYq43H402yybFXcJ6YuFUPe2UPGKCkCpDtSpDua3DoOJEsSJDm8ZfKK01raZ3U218pW3CnGZCo4JCMYN6883EpumJKW1EtOpDmWJE"
-"Emo3A-K304Z-V2XnV210o4cu443EEmD2c1o60WJ0bWWDWWZ-iFXHiF1Fmu2CtC3CsCJCrS3DvW3Ep4cDc8q5oCZ0kin68GpCq4g2O03DpK3DuKJ8kfuQ3GpDmO3CmC3D"
-"oSJDmK3DvuGkDuye1u-cGOycGWGDWSJuk8t350GDEaY200Z-tQWJtQ0GpuYDtOpDpWJEvS3DrKZDuOZ4Gr00qOfzEG3CoS3EuSJEq03DmOpDvOfI3WWDmKJHEW1DrG3D"
-"vWZCM3L304Z-Q2XoQ210r4c90KZTIrG0b0WCEun3+lq06jq08rYDk03DtapDn03Ema3EuO3DrOZfqJ04nSJEuGZ30q16vG3Eq43CmO92AGXDtKZCrOZ36N13pKZCs85e"
-"GuN9RGXDkaJDsOZ6SI12tWpCIC88sLo600ZyaiXBhS00yuGnI8ImRupWAOovIuYwW4G0cqt694G1guljW8ZjW4qH443CEmC3cPP1E8Q6443C+-v3Ezv3E8G2G4ZDr43C"
-"EOk4KCJCn03Dr89y3mXDsG3Do8JDnumCMW0DqCZbR+0DnGZCqWJDtapDq0JDoGZtmFW-rtWmrt00vuWhNuW3Mece10GE1A12o0oDQ8G2+3E2g0E288ZBt4YBaaJEpKpC"
-"uWJDsKZg151DsCZCrCJDo4JEnaZCr0ZcO92En83EuGpDt0pCpCpDsOJE+Jo6+Jo6UIo60CZ4bHX3WiWP8D01p0I8CxFMYe4MY0aCkW3Csa3EsaJCqa3DtOZCvegyDmJC"
-"oG3CoW3Em4JEnW3Coa3EI6P1COJCvCJ130nDoK3CpOLa582L9OJn4KumX+00WuFXAOCXA00DX7HuMeMf1umKM40A+xc72vc7CqICkKZ3W62Am0JCsSZDrWJEoKZgtS0B"
-"qCZCnGpCm0ZCtG3EISY8AYe24KZDEaQ6SK3En4JEo0JCQRQ0+Ve2EVe20OJml9d8R0GD1821n0JeRuVfbuJfbGHBruYDpWZ33520nuGmBuWAK42gMce284ZDruGWd00C"
-"5y31u8ZbPQ0Fra3Cr83CtaJEnO3Cm0pCt8zcFuFYAOCYAm0EW038EKd7orq0EyE7+Zz5AXz5G4ZBv8JDEqR5SW3DoO3Cp83CbGgblZ25oOJErK3CEmv8Ei72QIk4SKpD"
-"pW3EoG3CEKx98KpCoOzYKu-8ROy8R0GE1F90nO7J3GHEW4ZDW4Z-BDWMBD02m8JCIa+2OC3CrC3EmWZgU411nWZ4qX01vWJel0GCEeK6EEF18S3EoumvIGGEmuGF800C"
-"Mlq0+Jo66Jo600Z3xcGOEf6J3uGfBumEjulc6Oac6GaCkOpCsK3Do0pDu43CtKJErGJWnhPJ3mmCmapCEac548pD1tfbnO1ErOJErGZCrWZDu0pCqCZDM-N6+No66No6"
-"0SJXnJGCtucf1WGEW0Z3MV10tulf1Oaf1u0G8WICoSpDsa3DpWJDquW0Kewf1GnDraZDm8Z3ce03rGpDpOv5W0GDE8p30GZ3R020suWHTOTJ3ul9ROi9R4oWEyRBgnq0"
-"44JCbSg-BkWIBkW4Ix00mu0MIGmCvuGuVGWCnO9I3GGCtuGBD01EmG3DquWuGOf4WGJDr8ZCmGpDoWJCoOJDoeDvjuF8ROD8Rude181QUuVe18Me10JCvKpCsO3CoWZD"
-"vOpCESMCYWKCYOB314WBAOX3r+20q8XVX0mCQ402E+e1CKJDv0Z3z124naJDqaZsPDY-QiXpQiX3Po10su068uMH38XPU4G9+pI32nI3GGZBuWJDEan6Wa3DqCJCp03D"
-"vOww40mCECJBW0pCvKJCuCJDsuWVNeOg1GZDnW3EuGJEo43CtCJEn4A8EFx5kC-414WDwxW-gvXJgv10muWqEeNLP409Ea74MeI3o4k01404yybFv0I02uV5geK5g4g3"
-"GW3CnCZCEis2EW3AE064Ass0W0JEn8JCn0JDmuWnoGWCrefBW02DtKJEqG3EtOZ3RiXs7rW-QiXoQi10uuGHO81pEuMR30mC1OY39yYP77W43FI6Zul1KeY1K0KCk0ZD"
-"qCZCu0JCn4ZCrCZCseAoBGmCtu0mq0YCv0JDt4ZCn8ZbX918rSJCnCJEvaJCEyE784ZDu8z4Fu-GReyGR0mCIaK3ojB41CImQR6o10GDbKi-FEWJFE0AnuoCq4JEqK3C"
-"oOZ3Be01taZg3A19raJDpCJCpS3Cuu0pDuGR8e8M5WpCp43EmapDuWJEq8pCpSZsR8Y-S3XnS3X3t2HmWRd-huWiDuGmoOso10mCXxR6Zu-a3qtaXk56rGZDm4JCqu00"
-"HGmCmu0LbeuM50JCuG3DmOJDvC3Dq4JEU+n10KZ3ia01qOZ32b20ouWFVOzZ3u--GOy-Guun8uln8Ocn80ZCka3Ct4ZDv0JDnGZDEi6AI8j7M213uCJDvGZCqGJCo8JD"
-"mKJCuOfD5uWwg4gR0SZ3ZO11sWZrbAX3WxW-mSYkmS20muG6Y81tGec07m0CW4JE1KY-oSYIoS20tuW7bW2Et4pDvKJCp8pDrayt0GZaBo12raJEECNEO8JEqCpDoKZd"
-"NK00qu0NF0WCEO2BCWZDuCZsf6W-24Xn2410uu089umwre6g100EXcJOLvl5Cea5CWmCm4Z36H17p4pDqWZCqSZgCo12q4pDEGo3O0ZDrSJDpaZ3TeWY+Q0EsaJEmW3D"
-"r83CpCJEvOJDQR82+BG4EBG4QOBAgTQ00aZ3GfGeWu-f1eqf10HDm4pDruGXo0GEEWM80CZgzs03qK3Cv4emOCJEuOJDuSZbNb30tuWGd0HDt03Dtuml0fzJK0WC+pN8"
-"6pN8QOLE0OZRd600m4oo0aZ30iZ-ehXFeh13mu2Cou0StGIDm0JEnCJEtSZDM2F1mGpCu8JCoSJDoC3Do8ZcYh15nCJCvWZCXz40puG9u8b5nuNmZmJEkGJEuK3DoS3E"
-"rO3DqKpCEar4w5y8sNkFk0g70mZ3owX-1FY-1FYM1F22t0oCEOQ7cX78EKkF0CZ-rHaJrHa36k12n8ZCEOGFKWZDtWpCqeQa5WGCq4Z3fJ10vuWWzWGCs8ZbZ-0Cs4JE"
-"vWpDmS3CrO3CquDknu-mZuymZ4oVE0m2cLQ0QCy80WZ6DnW-gmWBgm01nuY3s020suGTPu06mGGDs8XzDOvt80YDnaJCmS3DoKZ3x+01s0Zbd600n81JJu03yWmDoOZt"
-"8gW-DDXnDDX4rt00p8elF00CMKG2MKV3+ZQ0zWA1ruY3oH4AvCJCs83CrWZCvCZ42rZbd605nG3EtCJEEaj7GGJEm4JCQUu6Eum9K8pDtaJEouW6dOzQbuY954G0+JF5"
-"6IF504Z3nE40u448cvq05GY3V7Z-c6WGc608quICuS3Es0JEE0J9CKpDv4ZgUZ0DoS3Dsa3CvWJDsSJEs8Z33wYZ5g04pKJEoCZ37yX3YRZ36TYoRQX-6FYn6FY3LQXV"
-"u630uuWdWumCBvVt88Kt8GGDk8HXRWGCtaZ3wc32m03DgEj78K3Etu0Q2HWCtuGwI00CXTXYc600ouWP9XXCua3EvapCEW46IBI4+Zk46Zk484JCW4OyoDe204Z3amY3"
-"rtGQCvKGO0GCM0z6+ZqHAXqHIK7E0GZ3qA16pW3Dn4JEtuw2QGHDuW3CvGZ3Xq14uKJCp4Zb5512oapDEKxHGWJEoSJEEWc3IhS0+lk46lk4E4J70OZ3Z4XQMK00vuGF"
-"H409+3t021t00rYCkWJEtSJCnapCsC3EqGpCkgb5G8pCtCpCEGfG8O3EpuG0V8vWg0GDEWU6GGpDoCpCECS7Eq03AVH1+h+86h+8+t98kt98Iq98C8JCs4Z3aC30nu0h"
-"C10DM67EESaJCOJDqaZ3JIX3vOXbX603na3DoumSYumkxuDvIu-uIOyuIumdP0GEEOD2cr52Euo90CJ02u-aFupaF0HBquYDouW0A02EtWZCvWJDo4Zg9t23oOpCnuWZ"
-"bumtv0GDIGWJAUh1CK3EnSZ3dx46rSpDr8JEvOzj6uVuIOSuIu-CTu-CTeuCTWGDkaZ3eHX3mj32pSpDEKsBECC8Mwy2XI41s8Z3W244rOpCsaZdbKZ3V417qapDv0JE"
-"rGZ39QXoHKW3nhX-zVXmzVX4urWSgjHPk5GdMC82+NN3gKN340ZBEafA8S3EsuGY51HDn0pDt8f1JG1Dp0pCrCZ3Y223sWZCmu0eUeOR3moDrKJEpOZDo8ZDnaZ3ieWq"
-"QXW-EGYoEGY3V9X3GX30ru6N8uGto0GCEeh7+RH12PH1O4ZBuW3EtCZ3oZ25m0JDraJCgoy2Eyf40OZ3zn24uWJCr0Zd5n21s4Z3+kZ3MA13t03DneTjUuFmGOCmGGWD"
-"WuWdx87pBuG74vmEFuVf18Kf1GGBo4ejWKpCpa3DrSJDq4IE12lbjp1BrOpCnW3Dv4ZDvSpCE0j7I262u8ZDq8pDsSJCp4pCoWJDueDbUu-lGOylGu0yEu0Od8Ny48n3"
-"a42q96lJqr02q0IET8Y-JKWDJK03oG3Cnu06Iu0tx0WDEGrHAc58EeLE04Z33v25rS3DoGJEMcuHK8pDr4pDmumjbmGDpWJCQF6B+Z+8AZ+8E06BXaiQceW3bfb9eFY-"
-"W6GFWoWCk0JD1387mG3CqaJDnGZ5N1YbQX00o8XpvGWCmuGj25MEIgs04KpDIuNFKW3Dma3Em8XMAuiM8uVtGeStG8HA-uWyRfsf14G9ESG7+V58AT58KWZBqSJEmu0j"
-"GGnCpa3CpWZ5Yuabf601rGZ3Lr56qSJCuOZDs8Xb8eOO8WWCpCZ3-ZY3-d02rKJDEOW5EdQ0+pB46pB40CZ3MZ00oOdqLOnW7v-f1uqf1GGCkuW0DGnCoaZDqaZ4vGZg"
-"CP31rCZ3cx08qWZDtOpCm03CM2h708Z48I47r0ZCr83DpSZtgkW-y2Xny2X3dOZ3E-aSB-K0b4of+ddGAbdGK4ZBqO3DoumDZGnCvKJEq0ZheI38rGJCua3EmSJCIitE"
-"0aZbW534p0ZDuWZ4l413oaJDmuWZWuCK3uFnG8DnGu0j1ftYY91sLunYYvaO80WDEmW9EeB7MK82+Fi1TFC9nuYDpKZCrGJEqu0loW0CoKZ4IoXbje02pOJEIeVE8CJE"
-"n4CaMEi1OOJCn83EsWJG4WGCnSZsOWZ-AFYoAFY7mkWQ1RW3la40uuF65u46501EkCJCtuGwXG0CruWtt00Ek2978CJDsuG60XHEr83DvKJDXfZY-Q00s4g4GCZDoG3E"
-"E86MEeRCA-s0+Zy8AZy85-h39bXQc6Gn-MQF+N352L35q8ZBmaJEuWJEmapDtCJDEmG3cgN304Z3xF20uuGuc4uuEamKAYQ00KZ3ZD35oSJCu43EEqa5MN3508Z-76Yn"
-"7620sO1oU97uAv0tLKCm+JF12HF1GqoDkGZCEaj9443EEmc41KG8eQv3AWmCuCZ3Jd03m4ZDvuGqQe9mv0IDoapCn0JCmSZ3o160qODoG0WC+ZC46ZC4QGIQoT62+-BA"
-"czBAGCZBoOJDEygH4K3EE8kI4OpDgof1GGpCn83EE47MG83DsaJCEm45A+q08SJCm8H8T11Cv4pDp81PEvyz4uVoGOSoG0mDE842E8MPgTF10SZ3sJIOKv-J38qJ3G1E"
-"kaJCpGZ36626sS3DsSpDs81VcefJ38H4Yn0CvSJDEiSG1dcYd602sCJEE4JC0aZ3Zj62m8pCMxo808Z-96Yn96Y3-V30qOd5KumV0vGBZuFd6O4d68XygXXCuGJCtapD"
-"Eal8E8U4Aoa4O8pCsOpDp8Z3riZ3RDbbC91ErGpCpSJCpSJEpSJDqKpDMdx708Z-d2Xnd2X4cC20net-EenAZul-1fa-1H2DkWpCu43Dn43DE8KB08Z6c210p8v1P0GD"
-"Eq5RK03CvG3EvuGnJOv-EWpCoCJEnWJEmW3EpG3DrSZs9DW-c2Xnc210sum1OvGxS0GCICS2M9J31ok-mRaImR46jaZBn0JEpu0qaWmDnCZ3Mtc4CHZblJW3GR61raZ3"
-"KZ44rCpCrOZbUC55oaJCnWZDE4D98GZDt81ehuib6uVfGeSfG00CUOh3gXQ0ESC4E4p8+-q0Azq08qYDkuW7lumVRX1EuO3Cu0pDgcG604Z37+10ruGTcmWCpK3DE4dC"
-"Acf1GKJCvOZDE8MF0OZ3ghX3hOZpg6W-c2Xnc2X3qvZUsJ00v81zTuVtEuKtE0IBqu2DrSZDoKZ3tq00m81OcegZBuWEnu0Hdv08I0GEEi02EUQ0Xr79vC3EvC3Cr4JC"
-"qezd6uFRXOCRXGmDWuGFR97JIuGYQumwOuFG884G8u0fomYCsGZDrG3CtSJDuaZ3A0aY-W04qGJCqaZ3PY44vOpDqCZc7k02sapDIeQ800Z3EyW4YGXo7D00pulHqOiH"
-"q0mDA2F10WJ0auG2Pule18ae10GBEuv7K03DvO3CqummTWWCrKZiMYa3-111qWZ3gla3MRcbEgX3ZBY3RKY3+T60uezoJ0mC+x746x74HdfSNxGqPw-G8eqG80nDk03E"
-"uuGpnm1Eu8JEtOJDp8nVGe9w9uGNc0GEEyHHEiWI0CZb6833oC3Er4orK4ZCma3CseTeV0mC+-746-74Iis2ESl5g542IamEEi2A+Zj32Xj384ZBtu0D11GDECQ7G0pD"
-"ma3Cg+320GZ3LM55ta3Cp4ZDEev2MUJ3WOJEuCZDm03ErumGoGWDrOjvB1mC+-746-74EKQAwv74IujBEC62+VF16TF1KOZBuG3Eou0HevGzYu0ipumF8OfJ3GpCmWZC"
-"mGZCvCZCr43CpuPpJGnCv0JEo0J0umGEnOpCM-320CZ--1Xn-1X5TSXUi420pumKr81jyuFK384K3umDFn0Cs8JDE4oG00Z3Zh20oKYgMY6NGKJDo4JEEmvOG4JDn4ZC"
-"QYF1GCJCo0pCEmu2CO3Ev4Z4hvZp9XW-82Xn82X5Njd3tAYQvJGm6BXYIrYgEPm304Z3E3X3qoZ-D7WGD7W3Ge03vGpDru0JAvXUQf84AGGDqu0XAvmXIu0EUfPKvHGC"
-"tu0oZ1nCmO3CtumOiPjvO0mC+VA46VA400Z3qqW3niYQ6700muGSX4yl+dH12bH1GWZBnC3EEix48W3Dsu0ouGWDmOA65mGDnS3EE4iUCCJDmGZ3WaXaFeW4fm48na3C"
-"mapCr4pDEqyJExs0+ZA46ZA4EmuCEaL3gPQ0EqW2IOBQ+RQ02PQ0XX42ma3DEOD8GOZCn83DEi22EYq0C8JEm8Z3q+14vK3EuaZcBl42pCJCEunS8WJEtuGWK10EQZq0"
-"+-946-940WZ4PzZSEj21v0Y35910suFe1O4e1GHBvuIDsOZ40lX3gz61taJorQvN80pDqSJCva3DnOJCs0JDIatCAw944G3DESa4E41UCaJCqKZLc6WVY645nWZBq4ZC"
-"EO8FOWJEoCpCpaZ3BucUZ642ompBgZ8WkyC20mZ-Z6a-Z6aOZ6a3jP51nWZTwOX3-021nWJeuAHNMuFRZe2RZumctuG+NnWDmaJEEOEC4a3CI8w3MkZ5S83CsG3CuO3C"
-"IGt304Ju5e8J2GWDmuGofXWCoSZ3-670neTYPuVeFeSeF0WCXhZ3cucRKM00oumgAuWW+uVt88Kt8mGCkOpDESRSK03DvCJDruWqDfwE701Er4JEvuW-Q00CESsKMMH9"
-"S4ZCrKpCuCJEEWw340JEQhbF+3w363w3E4D784JEW8NPHvmeA0GCcKFL+-q0zz43suIEuuW6yWXCpSJDpC3CQOyOMwq0K0JEq0JCu4+TEmOS0OZbe331rSZ4J120ou0C"
-"EumZk9jDqu-dFOydFOHBT97o7w03xumL2w-y48qy4WmDkWZ33t33n8JCtumhK9BqDHGCt8nZ7IGEvuG3iu9BC0GDEKPNG03EuSZDECBL4SZCIJQ0kqi114W-ADaXADa3"
-"P-Z3noXQmJW3TXa31cX-a6WGa6GmNwWn7nGEv4JEICa70SZggmW31416paJEmO3Dr4ydMck4SKpDuWZDsG3EX8E1m0ZstrY-N+WoN+W3RWWUc600nu0yDu-f1Orf1GmC"
-"kuWHC20DEibH4apCECX70SZfMQW3mM82qG3CEKJP8CZCpumzBfeF8WGDr0Z3Yl46t43Cs4pDmuG95fSqDu-TFOyTF8Xaef7QZ0GDEm32ceqG+Rf1TR93nuIDuuW1U02C"
-"qOJCt4pDoGZg4e2ArS3CoSZDmWJCrOZ3NIXcyW00uuGuFvGwF10CESGYMRZ5+Rt36Rt3+tq0stq0EuG9EOTFEiH3CCpDqaZ3teeZtz01n4JmWv0IPWGDsGZchq40ouWS"
-"F0mDE0Z5CWJEs8Zsmdd-szWnszW3fO10ne7XB4cPI0J9+Nf16Lf180ZBmuWcmGWDpumSAYWDmOZ3opWYY6W46gZ3QJ71oSZ3vbXbYD22q03DEGXDImL34CZCEKk9AdE1"
-"+3186318M4pDwDQ01KY3IXY-XDYJXDY3BK22p43DEyPR8O3DpumkDgga6GGDs81kkG1Er83DoGZ3sIfZIQ05qOpCvSpCE0NV0OJOJ9jt9u0yxulM1fhM1vW8RuW-Qest"
-"98nrrvGPKulpE8apEGKBou2DmCJDm03CoGZCoaZCuWZgFx04nS3CmOZ3zre3t721nGZbkM30r81pZG1DmaZCqWZ3tHdrd6W-u1Xnu1H8dw0ZNOuf1uFLt85LtGGDouWT"
-"5w0w0vGJD20Egsq0GK3Dn0JDEmiJ0CZ3T8b3zOaYDD02oOJCE8na00Z37262n43DQRQ0+R746R74EmxC0GZ3aoXQd6G863WC1GY-EDWGEDW3wW00tuW6zHmCvuWYuG0C"
-"qOPhNHmCt4SM4O3EE8pDEe0XIAL68OJDpu0Mg1mDEyzL4KZDXrdoOQW-P5aoP5a3F1X3-WWQX6W6ulcRzoX4uoH5Yu-eBeoeBWGBsuY4b3a33EY3yA41u0Z4oXYbKV12"
-"oOZCEeh3GaJDm83EE04AIcS0WKJDpS3DqOJCqu0PC2GEMHz5Y0S7su64cOwT+tLGAtLGE0pO04J1vPcQj81sD2GCESJS+3p521p5Xn64nW3EmSZ3MCY3nR60q893l0WC"
-"EiRTEmbN40pCEy8WUIh10GZ32v80vuWqj00EIesGEps0+N94AN94Xrc3qGdQZ6W3l6c-SXWLSXW3HZ50numOXu0ZevWOB9XqOOfI3uGG81GEE0qX08Z3oPacDr0Dp0pC"
-"napDraZCqaZDuSZ3x0epd6W-L2XpL2XW8uZ3mhd3Xda-8DWG8D05nuICpSZDEuKd00Z31231vGZhlJ00tuWt4vGFDnmDvSpCQ+C6OKZDqOJDmWZ3EY02nCZDQ7MB+VLG"
-"AVLG0aZ5vlXSNgZ3tDY4btZ-qxWIqx00quGyuuGMT11En03DtuWqQQAKDWGCq0Z3sj03mOJCqumCCQP0q0IDqOJCu83CvOZ3OU51uOZs3eW-S2XnS210ueOg1KIpE4L3"
-"+p946n9448ZBECSTE0fGXi63vaJCreAg1GmDvu06I10CE0258KpDuefmJn0DraZCE0iSKO3EoSZDvOzSeuVD1fSD1vml-P8HI8XG8uFK3u4K301EkW3DquWaXw0KDmmD"
-"pSpDkEL34SpCEaKOE0ZQ8K3Eou08KuuKDum-I2HCvaJDsumSX0GCM3A4+ZJGMZJGEes2oDs80CZ38eG0cuFK3O4K3mWDkO3DE8UH0aZ3Bre3a0bge600oumUFwmAxvmM"
-"B00DEGI3AYQ0KKJDmC3Eou0aB0mCEGIJMR27+ZJGAZJGIObd08JOJvcx900C14Y-6GZK6G38puIEvapDu03EEiP5CC3DuCZgAX00ruGsOGIEvWpCqWZCpO3CME0NOCpC"
-"mGZCu8Z3BQ80numfw8jIIuVE1fSE11mDA6g15Ni-XQWLXQ00quGAQHGCt81R42GDEqj5gYQ0S4ZDq0JCmKJEE84D4KZDQkQN8KpCtu0SVXHCrCJDt83CQBcC+hJGAhJG"
-"EqJ36kBCEaaV+3g1A1g1Eyj38KZDoumtW0XDs4pDnu9EDmWCoSZDEeDO843Euu0dw00FEAF108Z44i30pu0raHWDr8XkQeCEDuFD1fCD19HEGv0cLeMy48XUUwWnhulc"
-"6Oac64oeS0pCrO3DnapDEWd3EKvCEQe640JCEaPY4WZDECFfUM+VEizP4aZCbXa3mhXr9tX-s4aos4a-4DWy4D04jWZBtaZ3Tt31vGZ4GVA0muAehuWjMHoCqS3CvSpC"
-"vO3EE867Eo324CJDECZhEeKZ8OJDv4A8Ehq0+B846B84ESp504Z3a1XQADW55r20ruVI3OKI3W0Ck4Z3kj54vCJEuKZ3IfX3d2YY8D00quWskvmw72GDEKQe0KZbdU28"
-"tG3DoKpDv8ZDEO2WUNmc+3JGA3JGEOSY+Pp500JpCQ19I8oCM4H08mpN+u0LQvWfBaW8+Rp5gOp50GZ3+A47oKpCmSJCrGZ3QcghhFX3eTX3sUf3be80uu9OPw0UD0XC"
-"r0ZDtuGuKwmnLuSQ3uVdGOSdGeHOE9dNyOnPtu-HSuqHSumfdvG3huWYEHnDr8JCnSZ4cTZbJM12o43CEmTbO0ZDn03EqSZdDr01pOZ3ui47tSZDuapCs4ZKKOPLgwLt"
-"Ou-J1fyJ19n7tvGUfeM458ntY1GD+ZQ0IXQ0Ei52iCZCmW3Do03CnK3EtumOGeu45uGlfw0Jh10EEiIO0CJ8kf8j6G1DrKZCqOJ8OJ1DqSJCqGZq7rW-I5aoI5a3lWg5"
-"FxWQa6G0buGNNaeyLfM41G0FVvmDF0GCEmgB0OJ3aul55qh5XSC1sKZ3G735tOZDuC3DIm-XAUS0S4ZCr83DtKJEIKaY0aZ3F+dY7709rC3Dq0pCvSJEtuGjmgz1KuVS"
-"1fSS1vWb4910Fgcn18HO6v0AmuVnB8KnBGpDkaJCq8ZDrOJCtSZCuum3rOghL0mCECj3GW3DmWJEEqNIU6H10OZ3xUX3KI62n8JDIGbgAdh1+-MGA-MGES32EOrCo9cH"
-"1KY3CSbPkDW3WLJ6YuFR3q7RImIEE0iWECiJ0CZ39KZaFu10rum0AH0DvuGfkWGDpaZcc993oSZDuuWZD11CtK3ErerlGAeXtWGDkCZ3Pd71vKZ3pV10nu0OY20F+PuD"
-"4C3FkRuDkyd70mZ-6UZ-6UZO6U30quXyNes34u0zvumjeul348a34WHCk4JEs4JCXgd3fU11mSZg6z23nSZDoumDqXGEn4Z3Ijfbyc10s81vHmHCoapDt8JCuuW8nei3"
-"4uF3dOC3dumkgw0NZf6f1O1aAvnmZuVw3qNwEiCICOpDvWZ3Ul44rOpDpOZhN122s4JCEymlEWL28GJCmeP890GCESHCSaJEvO3DpCZCQLtEYe52YHi200Y-OfYlOfY4"
-"WjXULPf3UQ60nuG8Yagi+VQ0sSQ00aZ3iP62va3EEaAF8GpDm812TOPfZ02Cva3CqGZCsCZ33h50uePiIHHDt8pCu4JOIPns0PDoAu-f18yf10mCEyd204ZUED00pKEV"
-"Eqe5+dQ06bQ04WZBEezN0OZ3q2C2t8JEEqwjECG2McQ0GKJDta3E5C00vuG0iOfJb0WCEesREujI4SJCEy8JMpC5+VuD6VuDEyL4bCeQsJW3pTg3RDc-d6WId601ouY3"
-"vxMW+w0WQXmDqaZhx+01oCZ3AWB0vuWS8ImDmuGJEuOKCG0EruWyD1GCEen244JDEOkKApf1kK7214WDVKW-i5fJi5f3NYIOfecf1Ong+wVjPeKjPGGDkumxEvG+jAnO"
-"xIGCpewI30WCI4e24CJEEy468KZCrO9ur0GDE8XnK0pCtGJCs4gPMFG7+-c56-c5ESRJIu3egLQ01GY3lEQYnNFOH4W4kug3th30rqW8+ph1TpB5qu2CoapCEiCS8W3D"
-"qum8TugpK00EEu38WS3CqSpCqW3CoO9pj0WCEuYeEiuOESBN00Z3kZYohDW-dUZodUZ3u4X46CXQ87W3Z6X3mxh-vWXIvWX3W510num45nmDmaJDISU804Zart01nWZ3"
-"OG71naZ3Bza3TiA0y8v35u0eM00CE4mj0CZ3HO30n8zN8uVSM8TSMW0DWWJOa3GCICOBEbq0Iux8c4lEED20IyBLPCY-jDGVjXWCk0J85wW5kYmCuKZ3E7i3-XWbJQ12"
-"pCZDE4t6Ca3Du0Z40pZa97W3HvA4maZCtGZ3de01raZrJQX-HVZoHVZ3oxW3X5XQ9700nKYeEWZ8bmk-c6GFcIGBnu0hE0GDEK1DIWpB40JDgco448ZCE8zFS83CqGpD"
-"u8ZDECHlE+72ESLa0GZ3sGA0tu0dYQzbMu-pteypt81eFvW-Eu6g1uGUp4Sl+ZQ02XQ0OCZBpGJDuCZ4hy64mKpDp8Zg2310ru0QRvWXzYmCnKZ3T5eaED07oCJEoCpC"
-"u0Z3ym01p4Z3IyfoxQW-FVZoFV30nuW6O4sBkTQ01GY-5XaN5X41pSZ3Wy00vu0BeHGDouAijIpCv0ZDvapCuOJDvOZDte99l1HDvO3Dsu0Sw2HCr4ZCnu0csuyf1uVn"
-"GOSnGuGU61GCEeaFgTQ01GIUDval681OOan8+ZH1zYX30GC0mumumw0Pv0GDEC98IA820KZ4od05o8ZCtCZCEmtGIks0C4JDtKZ3RY83uCZCuuWSa8jW8ulyteiyteHi"
-"sAdEOuG-E2GCIiq9+hh1+eh1X8A1t8Z3w4Z31zg33qbaY602q4JEEOQ6Sa3CpK3Dv4JEQ+S5ESVhIKfD0aZ4+8arY6W-R3XnR3X3Wmg3AeeQbDG0ZuGWYa2eELs0Ea+2"
-"ECAD+BHdE9HdEuT68KJCmuWD1wmzh1WDEm6DEcK74W3EEyhSE8NJ8GZCmuWQI8PU8GmDpumQHGHCuCpCpGZtsVf-v3Xnv3X39qfVHqb45fW40qZ-dDWFdD03jKZBpumj"
-"LGGDuuW0uomDtOpCkc4GEexb0SZ3G+g3RjX33ycZe601o8Z4E5D3u4JEqumtIQTR3uV-GOS-GumRNu0pBeMR34sHEi+2+RQ02PQ004Z3jd43sGpDvu0+k10EEa-NgsM3"
-"4SZDEmDo04Z4e+20su0ZMfOf1uWMu0XDpK3Eo8nCk0mCMpU5+x+DAx+DEKzL1-eS-2L0b4Yo+BF1U9F1EmUsE8U2CCZDs4Zc4e85oOZDp43DEqHZC43Dr0ZcLa20ruGa"
-"zw0-XvmoN0GDEGh4EtX2+pD46pD4E8v5wHQ9E4v5+FQ9IDQ9CKZBq4Z37HB0vuGnewmtE8nwLOvjG0GDESB4WS3EtaZDpWZDtufyeWWCp8Z3nj30tuWNW1mCQl5B+V+D"
-"AV+DEayj04ZUTX02n438E4W2nX40AuHvL4H04mpNIK+2E809+FH12DH1EmaIE4y80CZ3zK62rG3CEm9NAk520KJWLxmq4IHDtaZDu4ZbWe06oGJDpOJEuu0agXGDt4Z3"
-"zDeofDW-3WZo3WZ32qb3y8fQpQW3WeW4-XW-PXWFPX01puY3R-92m8JCEm9g04Z3zLHmpQvdSmWCq0JEX561v8Z4mmacKb11pSZ3QdD3oCZDuumxqOD8K0WC+NP86NP8"
-"04Z3cBJ83gcf1eHx1vle89be81YCs8pDt0JEsKZ3wt72u4ZCXSgcGKW3cHB0ruGvKxmCP00EM6cQ4CJCE0cO0CZ33DD3mC3EsOD8Kul-t8j-t4cJovqEECHA4838+7hN"
-"A5hNESK348pDE0gHE8mb4OJCEeLJAoE1SGJCrW3DmKJEEq9jEmeDIwA4aOJDvS3EsKZCoCZ327Y-sVZ-sVZfsVZ-7DWz7DW3UJ22n4JCEKAXEyUQ8aZDsuwxyG0EnuGI"
-"P10CEq-g44ZCQ2snEWiSEmHFKCJCv0pCmumvevCb6uFjGOCjG8X9nuGdLesx48HsQu04PulAe8aAeu0QNuWICp0CqKZCMy0Tg+E1O8ZDm0ZCu8Z3Nx31qWZ3+5cY9r01"
-"nWZ40wi3ii11s4Z4EmWpd6W-M2XnM2X3fYc4hscQd600nu0a+uGvLOHF8uq-900EEu15PCY-2NXA2N13qu2CtuGfI1ICoC3DtaZCnSZgWX04rOpDpKZ3A352m4JD1f00"
-"yueo1mnCpG3Do43Cmu0dI0mCUt+7+J2EAJ2EEChiEqLUgbS0EifrXDf-lDWGlDW3GC30oumZvuWXf0GDEC6dIMS50KZ30F11v8Z3E470muW0A89e1GXCpaJDs4Z3vDZ4"
-"8Egrp2X-ZWZoZWZ3znb4f4ZQX6W3xXW4+JY-ckWFck03jSZBpu0+TwmeyW0DsOZ3c0ffHKW3J435ua3Cm0pDECYQECsLA6H1CG3Co8Z3Cyh3x6ZvcEk-r2Xpr2HW7xmI"
-"ROMaX4A4IeyG+dq02bq0Eeq5ESGO4WpDEW0784JCsuGEBeu0AG0EnuWo81ICnK3EpCZCu8ZbAD02qK3DEO52GWJEsKJCEGdaIBQ5+t-DAt-DESHMMyd9gHQ01KY3zFX-"
-"CrWICr03jKZBmuGNImGEn4JDEubQ00Ziuw30ouGN8WGCm8Z3CO30nu9zOWmCrSZ3NG92naJCECDwMJlH+J0EAJ0E0SZ3TuXU3G10tuG05wF1K851K0WDEGvxGGpCsWZD"
-"IGxT4aZDgwq5OG3DnC3Cu4Z3XFk3GqYbeWY3Li52tKJCEiXEEKvLMJl3+J+DAJ+DXnY3yBcStpJ0buGaXuVK3eKK3mmCka3DEKMLX151p4Z3z6ifTQ01rGZ3HI60mu0z"
-"7YGEp8ZcITX3xX61tCZ4rr20nuG7Z8j+4ulvteivt0WDX1b3WpcQvJ00s46KEOEK+tf16rf10CZ3s011n4Z3lp81oaZ30yWh5X03pKpDuum30HnDtGZCv8ZbJ524pa3E"
-"vSZ33J23mWZCo8E-yuVDoOSDo46B+7r0k7r0E0dP0GZ31e48n0ZDq83Du03EgAr08C3DvKAD08Z3vwYdC3D1rCZ3ivb3tqA1tCZ3PEcrIDW-d2Xnd2X49w6Dp0oCWqIC"
-"kmpBVvZ2W020W8J00W6FVvZCW43DWC38n0oCkmpBVv3Fl8NPZHtS+eWCe00BWm3Tfn6TbHcFmmpBDe08yyYPb56Tr9NPsi20Go3Te9NPpXsRiHcFjSZBnaZCs8ZDn8JE"
-"uCJDuG3DmKMBm0pCyyI6a8pP0G7FiLcPqzbTXncFmuICn4JEs43DvW3ErOJDqGJDyyI5TO3D0mWSfT6QHK3Hr8ZCvOpDoS3EvKpDpOZDvmpBPuH2T3mNPu30yq130128"
-"y4IBj02ToLMPWCJDWqIBPS20WeJA0qmAW8tRlH78kz6PbfJB0W08WmZKO402W02FIbL05y55q0oDW4ZC1C01j4J96Apu04G0mmpN+43CWS38s0YDW8ZOZ003q0ICpqn8"
-"+pS0kmS041ZBmKZCta3EvGJCtCJCqKZCv8vn1GZCpWpDn0ZCvaJCpGZCruvn1W3DrC3Dr4ZCtK3EoKJDm4Zr7700seZc1O3y1u-n1uqn1WHEWS38o0YD2MS004JD5xle"
-"1uYe1GqDkaJDpSZDsSpCpG3CtapDq8ZfkD0FtK3EsaJCtWpDt4JEt8ZDs8fR3m3DqCJEpSZDua3CsKJEpCZCMVQ00SZ-d6Wmd606u0IEWK38ousf1m1EW43CWK38nq6R"
-"+VQ0kSQ0a8ZBtC3Dq43Em8JPPG0Dtewf10WCXoG8oX1DpS3EsOZCIUQ0yK3DuapCo4JEqS3CvSpDtWZrd600uu-f1eyf10XDWC38qusf1WHEWO38n02D+lh1Ajh105ZB"
-"uK3CtapCvKpCmKpCsKpCgQQ0KOpDpGpCq4GFGGJEn8pDMQQ0yGZCr83DtGJEmG3Cs0pCsGZrc600vulf18if14oW8838uOdf1GHCm0YCWGZ-DDWHDD0Fmu2CnKJEnWJE"
-"na3EnOZDn48X0Gd80YWC5TWBSX0FrG3EuCJDoSpDrKpDpSpCn8vH30YCoaZCsOJCvOJOFHmCqOTb6G0DmuVe18Se1mmDWS38EK12gf520WZ3-XGOk9HM8uVx4uIx4GKC"
-"k8ZDuSZDta3EqK3EpapDpaZfKQ0Bs43CqCpCn0JCsK3DEm72IQQ0yG3Co8pCuaJEqWpCsW3CtCZq7D02q438+BW2+AW2C4JCWCJ12esf1WGCo0Y4ekW-lJWHlJ0HsuYC"
-"uWpCv43Ct8pCmC3CrOpDcUQ0uKpCn03ErCJCoCZDsG3ErOvE8mJCrCZDnapCmGZCvapCrGZDMVQ008Z-d6Wmd602r02D5FdQc600t4Ow+-K3IzK34PZBo8JDvWJEo03C"
-"nS3Du03ErOgf1mGCt8JEICL3MS020WZaDD0Fr83DnO3Cs8pCrK3Cq4JDmOjf10mC+RQ0ARQ00OJmp1mCkTQ00KJWq30C+ZQ0IXQ01R9Do4pCoKJEva3DvWpCsSZahq07"
-"sKJEtSJDvSJO9nmCpC3CIEQ0yGpCoKJCu8JCpa3EtCJDmKZJZ601yyY3OxW8J-06yC7TXTMPVbFAG9JCk0JCmOpCv4JEmOpDpWZCu03FluJ90qUJem3SX9NPkHdFqmpB"
-"DeG4P0YRbX7T+qICyyI19uWRFKW6cON3I8s35Sb3ZqW8Yz00y8Jd08n3FKGE94G1r4W800Y-wSWpwSGuu0GEkPa0M4v3+BP1A9P10roCkaJCuGJEmWpCu8JDvGJDks+0"
-"yOJCmC3DpKJCrWpDoaJDrCZaA90DnGZDvCpCmapCsOpDmCZ3c6Xoy4X-vSWnvS04s0oDWaJ0uPMEHumbFKUE+-D2+yD2S4ZBrapDn8JEECp3KKJCs03CuOQa5WZCsCZC"
-"pOpCnG3CrWpCmCZcHM0DuaZDqOZDvS3CqGpCt8ZrtSW-sSWnsSW3Wm01nOZTbmW4+B11nOJuzu-f1upf14AaiSpDu0JCn0ZCpaJEu42EPwVdj108sO23KWpDoWpDq4wn"
-"4G3EUQ2344pDEuR3W4JEpaZDsWZDr85a5KXSvoH01avw+Bp16Bp104Z3NZWVxA13q0IEWumWAuVe18Ke1GaDkKpCpGpDsa3EvSJCs8JEnGJO810DIQp184JDs4osSa3E"
-"o4ZDqC3EMoE1uKJDvO3CsOJCnSZCuOZDuOjkI00D+ZD22ZD28438ruWs80GDk9f104Z3wZ02s0ID+N236L238rYCkWpCrC3Cv4pCoapCpOJCsOZgd60Dv4pCnKpCvSZD"
-"o0ZCm4Zbpz09rSpCo0pCs8pCou0qDeza6ulpNOipNGHCm02CWOZTvW01n0Z4TXW-wWWIwW00n4+-iGZDuaJDsO3DnWJDoewSF4sUSaJCpWJEoS3DEee2Ic32GKZDoC3C"
-"Ems3G03DpWZCECO4Ad32+tw56tw5EeK60SZ3yhXQwW00su0KPuGGHu-y48qy4uG9CumxBW2Cs4JEmKpCuG3CsOvx40GEEi55WOJEqKJCs43EoOP9CGHDsG3EoCJO611D"
-"uS3CmODoDuFgNOCgNWGCp0YWxA15nC38v0oC1Vf-sWWFsW01ruY3PrW3to16u83Er8JDt8Ht9OPb6WpCnC3Ds4ZDv4JCq4JCoWZczo18r03DsCJEtG3DEuO611Xo8DW-"
-"dUXndU14n02EW4Z3O4XS8D01u0I0ZuVf18Kf14sHX46Au8ZCmCpDs0pDqCZa7D0DoKpCsG3EnaJCsa3CqGZ3Q3XZUv1AtO3CnGZCu0pCnaZ3ozWJizWWSdW-YUXnYU11"
-"n4JOVum58ece1GGCnK6R0KZ-gJWHgJ00quGxJuGUB0oCvKpDvSZCrCZ3sWWbd606rSZDtSZCou0GWmWCnSpDMEW50CZ49517q0ZDr0JCtSZskJ00nu-RGOyRG4exESu2"
-"gPQ01sE0q4Yp+tE1+qE1O4ZBt0JEoGZ3Ni06o83EnGJDnOQf1mZCuGpCnaJCm8pDsGJCoaZDMM32EOR6GCJEn4pCXYIOsgSx40GC+-646-6404Z3cUX4UHXQd601nKJn"
-"Jw0v9uVg1uJg1mpDkKZCnSpCraZDvapCmW3EkwZ7EOK6GGZCt4JCE8+504ZchqG0fmHCmaZCuC3DqOX6WuSg1uFTGOCTGu0uL8XnVe6g14090GJbqNxkH403yybFvu0b"
-"Zan8+ln6gin6m8ZBoGpDvWJCm83EsCZ3IrWgDV18rS3EpSJDr43EESz74aJCMMW2qCJCpK3Dm43Cn0JDnCpCQ-5204Z-R2XnR212q02DXKOG3PsuJGGCmKwEwnH9EOP3"
-"HCY-B7GFBBn6bW2CmOZCn4JCp43EnuWtEu8OIGJDq4pCn83CvWJDmCJCnOfkGumi80XDpOJEtu0GRG0DsOjXU0GC+lB4ElB41ljSCTX3i720ouWpBuFD5u3D5u00K0XC"
-"mWJDruWgLWGDraZ3n-XYW60Dq0pCoOJDraJDqCZDmaZcjD2DsO3DqKJEn0JEp0ZDpCZs0GX3Y7X8WaH01OJAKu-kcuqkc81WU0WCEqI4gLs0EGg7EGe4+xm32vm3O4ZB"
-"qO3EtWZ3P815o4JDu0pDIGB40KZaBl02pKpCEap6Oa3Cm0ZCu8Z3NYYaBl01maZ3fh10vuGNWGGEsOD5b0GC+NB46NB4E0n3wPQ00WZ4iZX-9lWI9l0GtuICpaJDnW3E"
-"rS3Cm8ZCrWZ49lWbt216p0pCtG3DquG4bWGDm0ZdHy0Ds43CoOJEv03DnCZDsKZsb6W-u2Xou210m4gOEeo5krq000JOdxVAWOLAW04DkO3Cm4ZDq0JCqW3Ds03EseAN"
-"8WpDnWJCmWpDnCZDoO3Es4ZbEl02qK3EXs20m4W148ZCEyZAENY2+pB46pB40KZ3NX00suW4ROcz400E1GY3Y9X-sJWGsJ0Gou2CmK3EvGJEm4ZCp0JEp4JPHff6FWWD"
-"o4JODYHCuGZDs43EMgn3O8JErCZDuGZ30313sCpCqeTK3ulmGOimG0GEA2r00aZ-FDWOFD07quIDmK3CoSZ32X04q8ZDtWZ49GXbd606qOJCrC3Et4yP8O3DvuGDeeOd"
-"60mDEGX5a4pDvK3EsGJCmKZrUg10ouVmGOSmG00DE4v304ZU6n10q42pIei9+3r021r0EWU2C4pDqOZ3Gz10muGwa0WCI6424KpCEW37SSJCq4JEv0ZDQYU2u4pDt8JD"
-"oa3CpK3EmOZDrejYVuFmGeCmG0GCXKA0rOdYB4G9EKl3+xf6Avf6E4R5SK3Ep4ZDpC3EEGZ64G3DMAr5C4ZDuOZ3WA15qW3CtOZC1khY9D00ruG2nGmDoumyGWGDsCZ3"
-"NsWoNQ00ouFlGOClG0WD1oSmpfsb60WDEyd2EOj8+Vq02Tq009ZBpOZCvCpDvKpDr43DmSpDgwu7qCpDv83CrOJCqCZCuC3EXmjYd60Es0ZCsW3CpWJDn4ZCtOZCMJJ8"
-"08Z-Q2XnQ212n438EOS7szu74838EK6A+-u7Ezu7iSZBu4JDs43EmOpDvuWII0WCIyu7MYf1W4JDn83EsS3Cs42g0aZd7n18p83Dp8pCtSpCE0B70aZrZ230ouFVGOCV"
-"G0GDISJ80SZREDW3VgX30UX-DDWGDDGWmx0KB0XDnO3Cnu0-C0mCM6J3C83Cu4Z3Lh12mS3EImU7MMr5mCJCva3Dr8JCs4pDuWZtX6W-n4Yon420pKM9ovX4Iat5E484"
-"+-X42zX4E8PDaS3DrKJCvSZDqSZ3PlHXnRPI3G3Dma3EoGZDvaJCsC3DpuWSweOy4GHDo43Cp8Z3yN13n4JCuu0PDuCc6ulVGOiVG4ya0GZ3ZvXPkqG0ZOowp0W2Eqh4"
-"k4008mpN+ummaaX8+VO5gSO5X613oSZDp4MEKS3Ev03Et81KDO9O8WIDsapCoS3DnG3CpuWfSO9eaWpCqS3EuGZCmSJEsCJEqCZsvQW-X2XoX210puWWBuGaLeco14G9"
-"Emt508Z-oDWHoDW3fk0CpWpDmG3CvO3EvW3DpOP8l0JDp8ZDtK3CuS3Dr4JEIyh3Aos088ZCruGMem1CoaZCtapDmOTjV0WC+l946l94EEQ00CZ3CrW-GuXKGuHmt2YC"
-"pOpDqaJCmWZ3fkW3+D10qPeMtWGCrKZ3Un11mKZ3PY01oWZctQ08o03Ct0pDv4ZCEiO8QtO508Z-N2XnN2HOY4iaoDgE1KY3qu10ouFN8e4N80KCkG3Eta3DmapDnWJD"
-"s03Cr81wJOvDNGJDr03CrOZDvKJEpWJCn4g9Asq00CZ3ZU19tOJCoGJDt8pDrOj0A0mC+h94Eh941giSGGZ3mx00quGO8ulVQuZVQGmCkumpHWYDq4JCn8ZDoKJDv81t"
-"OefN80XCpWZDuuGGImmCtK3DXHeYb600s8HHcG0EouW6jGGDpuTf1u-cGOycG0mDE4tFEua9gLf1ImUCE8VF+dw2Mbw2Wa3EnSJCn0JCrumTJO9I30WCIKz2SW3CpCpD"
-"oC3EEi57AEQ00KZ3fiY36-HmS2WDE4wCA7W20CZ-P2XnP211t0Y3UfXSmJ00uuWTXu-a-8ra-0mCE0l38G3Cp8HfJW0EqWZho424sOpDrSZ3V116q43Dt0pCq8vJDG1D"
-"o4JDoaZ4c642oWJCEa15ERQ0+Z946Z94EyGDEWHGgXq0E8+4+td6Yrd6EWDB0WZ3iX14uS3CoaZhzf15o8ZDt83EE0H6GOpDmKJCMQD68KpCuumnG0GCE0s38WJCqOzB"
-"N0mC+V94MV94Ee12gTQ0EmI3EG+4+Nf12Lf1Eu79KGJCm83CtuWdGuWiJOAydW0Dp0Z3jO43m83DtuGn4P9kYGWDuu0R1nGDtS3EEWBFQl940CZ-R2XnR210mu0zqu0E"
-"aecf10GC1KY3jVIpMwazE00CE8N3TGY-uxWAuxW3Er02o83EEun5KaJEsO3DmefJDW0EpOZ3Xja3lW00ou9R30oCqOpDqSJEmKZ3uD40quDN8ulkGOikG00EEujG40ID"
-"kPS0EaCHEqj8+ps02ns0EWJD8K3DuuGif0mCE4qI40JEgoaHiS3CnOJEqG3EuKZCr4i+Mch1GCJCnGJDEiEEEqR3Eur3Edh1+Z94AZ94E4r5E8L3krs0443898W-e6WH"
-"e604puoDuSZ3Kq06mSpDmC3Et8hk6G2EvKpCqK3Cv43EEW45MMH1CKZCoGZ35V26q4ZCq8JEuOTpdulc9fic9vmSG401gTQ0EC5KEyK3+Zw26Xw2C4ZBo8Z4n4Y3aQ33"
-"nCpCseghLGWCvumy7n1CuKpDr83Duu08UuOhB02Du4ZDqG3EsWZ3Je40mOjDX0mC+-94A-94Eeu7XWeQd602n838E0BH+tVKArVK1R95m4ZDmKJEEmVK88JCtuWEIPOG"
-"IG2DuW3Eu4pDvOJDEW15Q23KE8V5aOJEtWJEo43Ev0Z3VtZomJW-RcaoRc40r81Aw8tJDGmDWOnEBvlx4Oax44IeKOJCtGJDsuGbpGGEvevaGWHCqWJCqaZCEa62C4pC"
-"qaZcu2a3uz34v8pDpSZ3HEZsfJW-McaoMca5w8aSTpa4MEb3s2X-Y6WGY6G8XYHEoaZCqO3CEqV404Ju8xeG30nDuOpCmumI-01EvaZDoOPe10oDpS3Ena3CtKZ3cM50"
-"nejaQ00D+7946794X4A0oO7mdqIe+3O5E1O54CZBEGSC0KZ3Mi25pK3EtaJDkcT2GCpDq8ZCE4cG4O3DEi79McT2eGpDmO3DpaJEt4JEEuc4IB8E+7PIA7PIEKQHIqa6"
-"kje1E0u7E0KLMC32ELK3EGrFP8Y-3rWA3r09jaZBpW3CpG3EmuWOQmWCqSJCgMQ5qC3DuaJCrG3EtKZCtW3DQ2n3CKJDpSJOVIHEo4JCq8Z3QNXppQW-r2Xnr2X3MKb3"
-"MaaQ97W3dYb37uX-HKWGHKGnpYWCs0Z3Gf55vWJCrSpDMoT7u8pCtaZDuOJEu43DpaJDvO9tT0IDp4JDqGpCoSZ3jT30meDES00D+7B467B4E0d6ECK3oP521KY3x9X-"
-"LKWJLK04mu2CoKZ3Uo26p0JCpSZCtuW3keuj6uGMJ1XDuW3CmuGEpGWCmevU21GCESQ3GapDqK3EEe35M7K30GZ-F2XnF2X4giY3mJZQ7DW4ClLO8bA4+xE1kuE18SZB"
-"ruG2NGIEsG3CoSpDm83EIu-4M2F6eKJDv0JDo83EuKpCEir7Msq0CCpCsKZ3a855p03EnS3DEikDExE1+7946794EWoA04Z3+gaQe602n438EiZ4UujLEXh10KZ3uaZ-"
-"RhaKRhKOkvmzC02CuWZCtWZCvCZ3IWZYkD0CmOpCq03DsKZDvGZDs8w45GJCs8ZDpG3EqaJDqWpCqOzH410D+lK86lK8IKyEXIXQ6700v4oeEab4+Rh16Ph1K8ZBtOpD"
-"muGkiGnDsKpDu4Zh0132tCZCECN5E8tN0SZ3euacce03v0pDmuWLhumOweTiG00D+7B4A7B4QCHDsjh18038n811AuF65O4650XCkSJCruGw5XWDvKZ5u9a3La10q8PH"
-"mW0Dn4JOKmHEsGZCtKpCsOPg1WGDvWZ36t31maZ3vz50r4Cz6TH10mZVzEb4f851taJeQ1WCE4GH08ZXzE51rmZxzEbB7M00yumcJ1mSPMlDfgZ9Ixa-p7Ynp7Y3scaU"
-"5qX5zuW-yBXIyB11nuY35+01o4Z3UR24vaJDmKZguJ6BoOZDpK3Dr0JCoGpDEiWNIA-04OZDEeoMaOpDqKpDrW3CrSZqOuW-o7Yno7Y47GZ38kaQPMW4CDa4igW4PE20"
-"AuYJg4G0EaHPEaE5PCY-gaWBga08nu2EtGJCsKJEEqWKCGJEnOZgA7W36434uG3EuaJeA2WDEudCAsc5EuyLaKJCoa3CqO3Dq0ZsgaW-86Xn86X3-5a4V5aQA7W36rX4"
-"90c-ZTWHZT00n4gki43CmaJDoGZCq43Cvewf10HDtOZDpK0DC83CoCZ3-waZd6W3ek40sumr81XDs8JDsOTS3ul6YOi6YuWlZ00EEeO4gTQ0bLf3HYcPnDW4OLK6ZuVS"
-"3eJS3WGEpaZ3stZ3Ir22tK3CgcO4iKZDu83CqK3EnSpCtuG759vE5GWCruGzGvG4Y1HCrK3EoezKJu-2K9y2Kv0qe0mDESYDgfS0E0RLEKr9+3t061t00LZBp03Cs0JD"
-"o0pCvKZDpOJDkk7DWO3DmOpDraZDnu0FPffX8nGDrKZDIGDQ0KZ46E60q8Tu6uVZHeSZHu0dMeN+O1GCEi8QEm04c1t0D7k7ZvW-mDWBmD04mu2CqOJW43oCnSJEp4JC"
-"tKZalh02s4ZCE0o4ESSEEC+6QU98CSZDoWZ3M812u83CE8fKINS0+tQ46tQ4AIS01CYT37W5ANY-27WJ270GtuIEqCJCpCZCq43DvOJEu0Z45YXbso05rS3CtWJDEOt4"
-"EK+BE8EAEol1GWpCvG3CIy34CCJDqaZr77WB5nG01OJECulu6vau61WCI8+3EikPgDJ10WJ0buWhOuFD584D5uWpRuGAOGWDtu005H0DuuWETeOgHW0DmWZ3I370uu0U"
-"HGmCqeft6HZDm0ZDpOpDo0ZDrSpCquWXnO4ME8IIBOZU1OoiDuFgHOCgHu0hWudd8409ce72LKS41G0FV5omEue20SJhGvVB5uIB5WGCk8Z3rC13oa3DquG9sGWCm81S"
-"nOvolGGDtuWDnG1CtGZCt8Z3gXWbTY0Bt0JDoWJEn8JDqGZCQvzOrGWN97W-97Xo9710uuWEl5wgcb2E04Z3CgGfu81sDu-f1qpf4OZBEKLMGC3En8JDECmH4KpCkEa2"
-"ECQCO03Do83Cm0Z3lFYac604p8ZDo8Z3QU65rKZCt0pCMFcD04Z-Z4XnZ410vum22ftf891FLulf8Pbf81XCkKZCuu0DgvWyZm0DmaJCgMdQGO3ErC3EEu46GGpCs4JD"
-"QcS9E4+GG8JDsWJEE8l84OJDMJxG+J7LEJ7L+-q0o-q0eqIDka3Cn0ZCnW3E1k81sKZhEB15p8ZDs83EEqiFCO3Cq0Z3MYWYXX04rGpCqWZ344X3aY10ouGC-0WSYG+T"
-"EW5Q1GWWsJW3m8b-4zak4za3f7aUsJW3m8a-rJWKrJ09ruYDt0ZCtO3CmuW+ru0ZIv0lMevc6G1DsW3Dn0Z3Od10tuWIk8Pz4WXCp4JEm0pCEaEP883EseDftv-JKfyJ"
-"Kvmuj0GCEyWBknf1Eir30WJeRuFd6u3d60IBpu2Cp03Dn0Z3ZF71qGZ3k+Yge603rS3Csu0Jn1XCn0JCqu0WReOJ3u0kA1XCpW3Csum6J0mDQhg4+73LA73LESFAEau2"
-"gTQ0Eqn7EK39Map3+B42g842C8ZBvWJ8X2HEr8ZCpumdbeQf1GmCtu0MxG1EvS3Dm4Z3QdXaDD00ru0HvHWCr8nVQumaq9j6FulDKfiDKvmZI1WD5vXPfd00tums84Yo"
-"+VQ02TQ0EqB4eSJDuG3Cr43Cq8pDEymJIsB488JCquGS+W0Cr0Z39x10nOvUdGGDqu0N5vWPsm0CqCpDU3F1+xB46xB4X5Y3lF20mOdI3uWV+vG8puVf18Kf1u0+EuG1"
-"0YGDpaZ3lZ21pOZbX912rKZCECO7O43DnGJDsOZcvW04oSZCsKJmM2nDpGJDueD+EuVCKvSCK1GCXrh3OWWQ8DG0bumgIvFbyf4byHGCku0XBWYCrapCsGpDrSZDu8XY"
-"BOvGIWmCvKZ3Qr66uOJDs4JDuePilmWDm4pDEalMKWpDr03DruWZqviu9uleGOieG0WCEy-2IKgRgbQ05KY3+WGQC9YgA4H0E8B700JOKc19+ph1Tph3-T27vCZDvK3D"
-"vWZ3C3YcHN14r83DnCZ4W+23pWJErumGne8N8WGCqCZ4nvX3uE41q4Z3lkZp77W-W2XoW2HeLu0abecn10GC1Fh3YXWQ67W3FEM6ZuVn1qJnC4ZBmGZ3eD40vuGfqWmD"
-"mSZhQO53pC3EruWJFum3WW0DvaZcyX61v8Z3eE37oK3EoGpDpSZrRyW-pHbopHb4AEM87gco18Hnhvm7WulpB8apB0WCEWG6IKc4KGZCt0JEmugmGWHDqWJDpSpDEm6E"
-"0KZ3VKeaee0Dp0ZCnKJEtWZDo83DpOZtQOb-f7Yof7Y3ifa3YvdQd6W4V9d3cUIQnvlJ3qdJeaZBsapDtGZDt43EI8x70aZ4SyWcVR00pumrlWWDm8Z3K-51vKZcED02"
-"rCZCE4UJE8y84G3DEuKUAZH1+Z7LAZ7L0KZ3hkW3scZQd6W4FlW3HGX-d6WGd604ruIEr4Z31d02o03EEeFU0SZh9h1BsCJCtGpCmSpCqOpCUkn3GCpCrapCEe9YKa3E"
-"u4JCpOTLUuFUKfCUK1mCEOI6EKjKgTQ0ESOH1CY-qJWGqJ02j0ZBE4oH0OZ39Z43qGJCr8XmVeOoQW0CsCZ3Xo76pW3Cq83Csuf0W1WCEC2WCK3Cm0Z3TQZtXza-U6Yn"
-"U6IWhx0ykfMe1umCuuW+Vu-H38qH3W0Ck0Z3KS10suGEXHWDnuWe9AP5FWHDnCZDvOpCESN5EOT20aZaGQ03n0ZCvuGeQ0mDE0EG0SJeUuSw4uFcXOCcXu0L51GCEmRV"
-"g5Q0E832Ie6B+Fq02Dq0CCZBqOZ3k+18m83DpapDtC3Cg6bNIm0J883CmuW4SuGoV9vf10GDEeD9WWJEoWJEqS3DquGBWvyf1uFlGOClGumWBuG9Decf18Xtvu0Z0vFI"
-"3u4I3WGCvKZ37r03m0JEvumS0P9I34uhaWZDtW3DpOZCtaZb5Q29nWpDrWJDva3Dsu0+h0GEM305+d4LAd4LE8KBE4G3+5Q0EmcI+Vq02Tq0KqYCkCJCouG2N4E-8WJC"
-"tugXc0WDEyH8O83EuaJEnaZ3AUba8D03qOpDvuGoFvGcGwWzc00FIZq0+VB46VB4EKl8wTQ0Xei-c6WLc602nu2EEe2A8WJErumLFXmDuSZgDT10tuGOc0mDXCA0pums"
-"JQfVBG0DpumCpumZDmWCvWJDQBTA+-4LA-4LES9a1giQDDW6vjY-3GXI3G11jaZ3xi8BsCZDo0JDtSpDr8JDIOJ8QMI380ZCnu09jXmCpSZ3EwbbDD03rOJDmuW9D0WC"
-"EWGF0WZ3o9XoLQ00pulDXOiDXuWMBuWXa8tf10GEISK3+FF16DF1iKZBoGJCuCpCnOJCruGef1GCIGI3MUU7443EEOj8EuREGSJDpG3DMAU21-C1oKZ3qr32rKpCI0m3"
-"ERQ0+B746B74E8+aw9+41CY9rcY-m1XAm111nuY3kj83m4JEtu0GSWmDvGZ4UqYcBD0ApWJEnW3EmKJCo8Z3aFdaOQW3Wa91vSZ3iw30muW2HQTcvu-JKfyJK10EEOm5"
-"2oq0IaZG+RQDIPQDa43EtW3Eq0JCraZ3JP60negpd00DEClZ4GJEEiRGGKJCq8ZCIUQ0COZCrCZ3f210suWc12WDEaYGEpq0+RZC6RZCE0NAICeBgDF1IWu2E0RbMWu2"
-"ELF60GZ3U9H6ZuVS3qNSEaW7ECGF04Z3Oa73uWJEpuWAyf8bG4Ci8CJEvuGJXWmDoaZ3xqZYrZ10ruWG122EoSpDuapCmOZsB2Z-lHbolHb4QjYXjDW3t2X-jDWKjD01"
-"tCZ3pR10vuWNOmmDvCZDgch10GZ3sj20puWCynGCq03DQcqD0OZ3y819pWpDqGJEoO3DrODsp0mC+l946l94Eau2Ei74gns04a38EmpA+NQ0ALQ0GqYDkKJCE09X88pC"
-"mumHrWWDmGZfUI26oKJEr8JCsuW4jX0DoWZcJ831rGZ3kv75pSpCvS3CESS3IBL3+35LA35LEKpJESO5gPQ00WZ43e00uuV1AeK1AGGCkumRBW2Dp03CnCJEoG3Ep8nh"
-"VOP1AWXDnOJDnGpCEi96COJDr4ZbWXW3cA17uapCuW3EvKZ3caarc6W-p7Znp7Z49ceUkYa6qH50suFg1e4g1um+Ym2CpK3DoG3Cq83DvCZ3fsdYMQ08nOZCu0ZCu03C"
-"EGob0KZ3DtZZMQW3FG76mG3EpCZCouG5jOze1u-cGOycGu048etKe5OxEGOHMe52+V32gS328KZBruG-qGoCmGJDrOJEmOZC5Jfcek06naJEsK3CvuW8Av06SAP0AGGD"
-"ruWNevmrzGmDnumGvPTf1uFCXeCCXumD80WDEqw2g1F15K20p4G9+dQ02bQ0Xba3by14sGJEv0Z3WoebJZ18q43CpaJEq0pDEivG4OJCQMw2EaN34W3EE0s74SJDUxCZ"
-"0GZ-N2XpN2X4IlaSzHA0uu0lauGN8ule18ae148xC8JCrWZ3Ro21m4Z3Zy90m8fBNuGgM2GEEWw4GWJDqCJDX6YZiJ03napDpuWhku0WK10EEWGBAZK3+x4LAx4Lb9Y-"
-"7DWw7DW3xsX38N88s8JEq4ZDqOJDEW+8A6f1qW3DvC3EsKJCp8pCp43EQoNT4G3E17F8oa3DpWJEt83DMhT2+B5LAB5LEuBKI44EgjE11GY9ysXJixW3vmK6YuFj6qDj"
-"8qYCkuWoi1GCEeIbEiuL4CpCIKkRMsV2eCJCp0JCrS3EuSJEEa84McUCCK3Dt4Z3mi52s0JCEeWdMRI8+J7LAJ7L+xs0+xs0K0ZBmSJEvu0zOGWDou0vdvm2SeOR3umG"
-"XImCouW3tWWDmOZ4+ccYIK03s0pDpuG6WYmDo4Z3tWYrPg10quFAXOCAXum3ruN454Ci+V52MT521NB0tuGnYW0Cv8Z5frfbydW30y3AsS3DmOZCt83EuWZbOXW3p-16"
-"rCpCmKpDo4QXMJQ5+35LA35LEq4QwDX91CY-IOYKIOY3lZ10uuG-Z02CuWJEtO3Es0Zgym13nW3EnumtkH0Erum8lvG+qeOI30GDECz44a3EEOtd8SpDreTtJuVKKfSK"
-"K10EISYN04ZRrQ00v81Ptv-ESeqESuGhi0WDEGYZGapCuGZCE807cMZ44KZCE87ESaJCqSJEn43CQYyE08Z3A453sKJEoumkKHWDrODxEulJKfiJKvWzlu0bQO7uG1WC"
-"EKw2EmWCMKw2Ev521aa3OCY-44bK44b3Ab23oa3EtuWOSumRW6IpMYH14GZCEy1d0GZ3XQA2sCJCQskW0KZ3OOX3Fb10m8XhmezN8uVkGOSkGu0zLf7F-8H4Dvlqi8bq"
-"i0GBEKbS4SpCEG5VEiVK403CMiOdMQW2GOJEpGpCEKfJGWJDnWZDEiI6AcH10GZ3rN50quGrB00EEudZQB62+lB46lB4ESzSIOOIgzy2EqVVEaN8+-w72zw7EWB4843D"
-"o42fGSJDpGpDQYq00KZ3mn58o4ZCoKJDqSpDQ2BNGGJCpWJCEG4Y00Z3gHXswQ00ruFkGuCkGuGHwedchHmDWumjzuFe184e1mHBnuIEvOpCouWByH1CuCJCvCZgAcY3"
-"9MA1pWZ3qm70vuGGcOfYfumBK813b11CoC3DpOrH38eyL10DXV33uSJEtuGy91GDEOT82+Qg4O3FkBVLkuL10mZ-oNb-oNbOoNLuRfNs-u0RK5UE+ha06fa0CaZBvOZ3"
+static sybie::datain::DataItem item0("haarcascade_frontalface_alt_new.xml",0,
+"etRBmt8F-WNRi1YTb9tSfzcRz8ICk0Z8-uZ2yy6SbvsOszrSqzcSXTMP+e0FXqIBA028W0oKqLNRmrYOXDNPa1YCmWdCm0oPbv6TiL68XHMOYzsRpH78c9tRkHNOi1YP"
+"XDMPWGMPqLsOqzcSke08W02839NPXHNPa1YOv1YKXbcRb978CbMPkXMOoHdBAemBlyoB+F00ED00mJa2A0289r4KF95L1v4Lw0YK554HW8KH6zaK512HFTbJCzKG4baJ"
+"7n283z4KPbaJ7n289vqKK54JCbaJ71oJI1ILJbaJ7vI05naGv12PlTdRizMOabcRdn28Zz6SvLG2yacRpHNOinMQkT68l978rDN09W9TeL68pzcPqTNOoL68vzMTW4sP"
+"oLMPWGtRWG7QfD78ibsObvsSbvI0S2WP5025az68kz6TMT200mI4U41W0mI4qX0BA0I18cGU0KcCt101keG0sQL00WHIkHNPi12J9O81W4K0SoGRbv6TbCkB100Q6zcS"
+"Wy4Sbv68JzMToDMPWCqRj1NTqLcSWOLQ153TWmKQY9NOobd2A0oGl1NUobsPeH78eCKAW83Cm03BDO6G3zcSmzcSXHNQlv6BW46Ri1I1dmrSW8NPpLcSsL6Pke08KXMQ"
+"oH68m5cSqbN1FtW8Xm34m9tRmLM0OGmRc5Wt4acS1W3RmLsOqbcTb1oRtvMPoDdBAe08IL6PfD7TobcOr50Qm0IOkH68rDNPWacRWCN2w6W449MQk5cSv1YPl9NRpn28"
+"tb6Te52E1W0AlL7TWqsRabcPfDM2f2W29q77b9NRfH7TbHM07IYTfHMPa12Te56T1a86WOsRinsRt52xGCsRkHMQ1S70pLGDCqMPqfJ9w1WAwO904SoS1KS3GopOlHMP"
+"WqMTpH78oL6TXbcR5G54X9sRsLME24a48asOb5Iv4028Hb31pHN06v2T00WR1OfBH209absSZnMOfrMPo5o600YJ9201fvcBE4G49I1Soz6PrDMI7vFZ084Z040TXT13"
+"azsOr5KRbaMIoHLOkHsBl978lH7Qb978j56Tb9NQXnsSvKN8Zc0FzKU4Sp1LeL68k5MRb5o59XTNon08j5MUXS42W8MP1510a5cWOKcRazcSpLM8yZ1SozMRlHNP1W04"
+"aLtOqDN2FY1Pb9NQsL6P1kC0jboTrjS0A6KB1DOGk028m9NQl978t9NGdGWRWKKC0CNOR4Wd0GLOhNnE0aM7HJWOvLmp1EKHip18ez6RaLcSp5Y2XmTIAZoRoD78Y4sS"
+"WasSY4G68g08XvMUWK6Um9NPpD78l978fr6SibMPa1oTX9dSXv6TfLsS1c12ZnMT96A1YLNH2118ibMRf54n8GtRiKWTDS30Aq1EXm3EjLcSZXMOkHNOYb6RfHNU1874"
+"WOMQqvM0j1XPl978XLMeqasOrnMOo12Sr97SlDNP55VLlH4Pke089v68kz68bPNPkH78pXMOl72z6XP04ycSsWE0S8MPWmMQX96R1XC0oLGweGMQoLsOqnY2WacRDi06"
+"WacRZb6Pb5yN0mIA2IJOin28bXNPj17RX9NUiqGLKDNPnLNPkHNQXn68a5MRXTMPpf08eacTO405m9tRZLdSbMG8CWpSr9sSqb6TrHNPWSsRlHM9k5ehWasObDtEA02R"
+"l5IW0OMGIH1BWGMOq5M1xn1SozcPfHtSx4mX08Mm74YESacRqLcSoL7S122Ef02QlTNPsLcSWCMOrDNPb4D2a1oR1+QHGWmRobN0z522bC84i0oTeLMPKGGQkbYBG4sO"
+"qn281YE0Z5orjeA1ieG0on0Tl97TTSE9WuMPdnMQdLcRZLKwbj58tbsSbb28X9NQ5FA0fb0UCSNOv1IGIZmRcfG9h6wDbo61fDNLy20Bb4DAWacPW46PsbsSbHM2YWHP"
+"W0tRpDNQ9qQ0JmmSrD6QjG7NkeGBjuZ2yCMOpDMOaL68qb7SbzLQarZ8Me520qI3OWOBZnMOpDNQcbMPo9YFA028yC7TXTMPKb7SbvZGFzqKKnpBpLH41y15cLMOqLdS"
+"942585KGInpBk8101821eLMm52XFo03Flqm21O14tb6PqXM1LaW21GH1hH1KX9NOjDN0G058WmJRXXtLb5sQ3zMTkHdFo4pCyyYCI0G3DcnCHyO6IaGH8CKOqb0H00J1"
+"2Ln3LuQ6naWXKuKTjvZCoq0O1qG5W6nc0yL0J4G0sKA0+CA092S3M11Le9NPp5OMOv3Ek8ZCsWJEq43Dm83DpKpCmCJPj0JCD0N6d4XF0SN85KJcDCO01anX1400yK4t"
+"KuMOivqRa5HgH40Um0IBn02CWGZBm43DnaJDuS3DpCpCpWJCtKMBmC3Fl8cE002FiLMOcPLOiLdFH10GpuoCta3Dna3CtC3Ds83DuaJ0AnaCWWZBpS3En0ZDvKJCt4pC"
+"rOZCmaWsTS41yyIDz008+AC0S538nuIDnKJCpCJErWpCma3Ev0JCbr2Couim04WImGJCp83Co83ErSZDsOJ1hY48tu2DuW3En8ZCmWJCtKZDraZC+BC0o8C08938quYC"
+"n0JEvCJCu4JEnG3Cv4J02BDX1GKEk03CqaZCu4pDnOpCqOZDvaJ8CW38suoCtG3Ena3EtGpDsCJ0Excm0G0FlupN2KJePzbDcB01nOJP8b7dHbQP3d5mKPZBvKZDs03E"
+"tSZCoSpDuCZCmKsAm0Z-dBWWdB0Hp0ICkOZCoSJCmaJDv0JDqKZC5rfqZ50GsuIEp03ErWZDq43Es83Et0JId3qDk4JCma3Ds4pDuGpCs8pDvqMm+Vk0DTEIq0YCk8JE"
+"mOZDqapCv83CvWJCu42nIBC005ZBtaJDu0pCm43CqOpCt43D1L2In0YDkOZDuOJEo8pCn4pDu83Ep4Gs443F+BC0H8CFr0IDk03CoKpDmW3Cq83Cu4u3Ul61y4ZBsapC"
+"sSZCvW3DuC3EqWJRfIaDkKJDq03CsapCq4ZDraJDqOZRdBWmhH07s0oDkaZDraJedsqmYJO00LZBuOZDpCZCmK3DnC3EnWpC5iAIWaZBnGJCqKJCuOJDqC3DsGJEq46m"
+"+JO0rG89t0IBpuIDo8pDm4c2KS3EvOpDm4I-QVa0uGJCp4ZDsapDm0JCqKpDn4WI1T43mCJCu4SKOKJEp0pDuOJ8cx-H2arH4X38puYDsOpDsWJEsWJCmKpCoK+AI3V1"
+"0DZBsSJDsSZCn4pCuaJDq4ZDbHR8c3WC1GC7oGJDuWpDtKJ2NuVX1KJX8b38vuoCpOJCqS3DrSpCs4ZCo4J0u1mCEBh10PZBnOJCpWJDtS3Ds4ZCq8ZD159In0YCk03E"
+"uK3Cva3Dt0ZDnKpCvKSo+BC0L8CJn038uuYDvOJCp43DmWZCnGJDsaJ8cBzm0WXCkWpCs8pCX305oS3CuS3D5mQmpIZDm8pDpaJDt8JDoK3Co4c2+FC0TCi3uW00n4k2"
+"aW3CoOpCsGJCqSJWmhzm0GYCoCJDu0JEoOZD1150pamm0LZBu03Ct03CtWpCt8JErKpC+Z32sW32G4ZCWqYC1GCAqO3EvS3Et0pCm8Z4TbWs4305q0ZDqO3D14h3-WW4"
+"4Y03n0IDk4WMeK3DuaZDpK3DsSJD1jg-76GF7YoCW8ZBn8JCv0ZDm4yt803DuKIFIFC04LZBrKJEsK3DuCJCuWZDoaJCr4w-a0ICkCZDo8pCt0J07W0EnSZ4KaW-33G7"
+"3J3DWqIEkCJEqaJCqOJDs4OC483C1edqJI02uuID1PF0t4+VG0ZDsOJD9j4FquoDnSpDq0JCnWJDmCJDtaYd+7z0v5D0r4Y9qSpDtS3EvGZCsaZDtK3C1rgs7600v4Ud"
+"WC3Em43Do8JCnKu61I91uCZ3vb08uSZDt03EvWpC5kg-33G637kdqC3CsCJCrS3DvW3EpOJDcdX1CGZBpGJG4n1CqCJDqWJDuq8b0TZBmO3CmC3DoSJDmK3DvCJCbNh-"
+"33G633mD5B9BsSpCuaJEtGJDrO3E5l70qui66mpCk0ZCtW3Eta3DmG3CsSJEIyY2XU51mKJ9YW1DrG3DvWZCfqf-33G63p4EWqYDk03DtapDn03Ema3EuO3Dr4Y9Iha0"
+"Eag24W3DEeT3Ka3DuGJCm8XsD48bKOpDr8JDsuG-9mmCr8ZDs962AxC348JCMwC34bZBqa3ErGZCtWJDsG3DrCJCoulpC8fpCGICv0IBnuYDr43CEKG2KCJCn03DrKo6"
+"IB71WOZBsG3Do8JDnu0ZAW0DqCZ6Ag0Gnu2DoG3ErSJEtG3Cr83DoWZ4UdW-f8GLfGXCm0YCkSJ0QHIEvCJDpW3ErOJDYF42yOZBp8JDpKZCnaJCv8JDmGJJipJCk83E"
+"uGpDt0pCpCpDsOJEfPi-33G63N8rm0ZDvWZDv43DvGpDs8Z4ebWshB0EoG3CoW3Em4JEnW3Coa3EfYF4suICvCJ13WnDoK3CpOZDXQf-33G733WC1f40ru0TIG2Cm4ZD"
+"tOJDuaZC1phs430DqCZCnGpCm0ZCtG3EqWJYSn08ruYDE823WK3En4JEo0JCsOHhDu-X1apXSC38jKZBsC3EEKt304JeQwWT9GGPjOzD546MEem400J1EX0EoGJGL60n"
+"ia3Cr83CtaJEnO3Cm4IYEi52+JC0PGC6q0ICkaZCru0AAW1Eq8ZDmCZCIS54IVO0O8ZBsaJDr0Z3j315nOJDnaZC5HZ3Ad05pW3EoG3CEGo4CKpCoGJ8au-m0qnm0KJ8"
+"7Y0Co4JfgYnCmKpCu03E1edq4302nu2E5U11vWJGMIGCm81sAK0n4WZCEWG24a3CX5D1mOZ-43WE4300s4IFeCZDrGZCmS3En0pDEG44UJA4K8ZBp0JEpuGrAGWCt4c4"
+"Qyn30KJ8Uo1DoK3EsW3CpuWAIu-19Op19GWCtKcqe4ZCtSZDvGpCuK3DE4N2cJC0KSJDvO3Co4OvGK3DtCJD5qA1WKZ46F10quG9F0WDESW3+VO0+SO00WJ0430CESA2"
+"4CJEEmj3C8JCoaJm-9Du6WGCkSJmU01EmG3DquGB80mDfg50ru02HW2CqSZCu4ZCsKZCraCD+Bz0v9TvaYJCvKpCsO3CoWZDvOpCm0J0wfDn0mmCpa3DI0z30CJOygX5"
+"C8HyC00CEGu3K4JErGJErON298CyI0mCEu168W3ErumsCWHEqGpCnC3CIi25IBz04CZBIqI5aCJEr43EpKZDp4JIB1aDk43EuW3Dv8JCmSpCv4pCrulq3OZq3GoCn0IB"
+"uu2CnCZCXoW3hA12vW3CXzWq7600vumgEWICmK3CtG3Eu8JDnOHT9m28ru2DtKJEqG3EtOZ3Rp01pSJWqu-I2arI8DZCW4ZBmO3Dp83Em4JCn8JDp8Z47WWs760Dt4JD"
+"nGZCv0JDt4ZCn8JfZ6cqaSJCnCJEvaJCoWZ3zK10tuG18u-m0qnm0CJOI3oCq4JEqK3CoOJWFHmDv4mOIJC01+76pCJCpS3Cu4CQ0KZ5RgW30g1DnW3CvS3Eua3DoCpC"
+"saJHYvlq3KdqiC3DWqIDkGZDm4JCq4EeEyp55CcqB90Enu2EqG3CsKJEpG3DnaZDEaG60qI986eB4GZDECr4C8JEuWZ-UOWEUO0FpK38ouIEmSJCsa3Cr43DsuGcIuGq"
+"H8zX1mpCkKJEq83Dq4ZCoK3Cr43EcCh24CJC1L60tum0AGWDu8nrBu-X1qpXEW+3qGpDnWpDnSJEr4pCoSJDbvWqby03ruIEvuWRT0YCvGpCt8JDrWJWR4aIKGJDvKZD"
+"ou0VKm0EsWpC+Nl4wKl44CpDE46440JCE8I2SCJCtG3EoGpDESc20CZpe-03quICt4SmS0ZDrSJDpapCQ8W5yOZBva3CuGJDo0pCpaJEsKJQexV33aN3WW38quIDm4pD"
+"ruWFN0GEEay60CJuYgzm0WGDmaJGomnCvWZDrWpDrumDAumXNuWGI0HDt03Dtu0KUGWDpu-L5epL5WGEW8Z32Z1AuK3CmaJCpapDtKZvbX0Eru2DpWZCn8pDr8pCq8ZC"
+"US33i4ZBp4JEu8ZDva3CpuGEQ0WCXSkO66Wog211paZbg2HWl1HCoaZDvuGuDWnCpCJEuKsA1aeEVsX7ssXF0uH3O8iG8G0Dm81sCWGCo8JekW0EsSJmTvTZAmGCkGJC"
+"E4S20aZ37q12nOZCMGG5E842eaJEuS3Ct0JDs03D+Rs52Ps54GJC1lh3Hx01sOZ3ae14v0ZDrOJmxATS4u0qFGHCmS3DoKJuy5CJbUF1nuY44aW3Pn12t8ZD+JJ12HJ1"
+"0GZ3aYW3P1Y3pI17o0JDu8JEpWZvYy03qWpDp4qIKK3Dv0JCn8ocDuGBIGXCtSJEv8Z3v810p429Yjk06ha0eC38quICuS3Es0JEE8I48KpDv8HKD8TS4GZCkS3Dsa3C"
+"vWJDsSJEs4gFbO86suoCraZCpu0TEu0oPOHVTu-m0qnmGG38ruICESD384pDv8HwQG0Cq4uqIFC0CKZBuSZ34z11oSZ34a02mKpCIWp280YCkuWeYWXCua3EvapCIOr2"
+"1ej-tNGjtJ0DrOnSQ00DEqB2OC3Eq4JCvSZvJm06ru2Eu0JEqu0XDG1Er4pCnWJ8E40n4apDESQ8GWJEoSJEX-X-43WE4300s40nqWJEtSJCnapCsC3EqGpCcpe2K8ZB"
+"pSpCpuGKVWWDuCZ3ZvGQH7odOOZDqSZCpCZ3wt01n8J9VwFY1a3Y0SJ04pHCs43CsSJEnuWyZG0DnuEZA0WCEy324GJEEyS2E4f2b4NGjYGEq8Z3z-W3vlX3zcX-C9WD"
+"C906u0IBquYDo4ObWWpDu8JEuKZCn4WUI3n0G8ZBsCJCEOa7Eyn68KJDoKY31GC2u4pDE8L9OKpDtKZCvaZ4MDX-86GF82GEECa2CCJEpSZ3Pk12pSpDEKS5UdL10CZ5"
+"5JX3mu14rOpCsaZ42kH03ZWDvWZ3jc16ta3CvK3Dr81PMu-m0anmKK3CWKZBp4QME448CKJCmSZ6rOYrDg04p0pCrCZ3Zy02sWZC1rPGpG08tuGcTuGlMmWCs4JE1wPP"
+"bul33Kd30KZ3at14uW3EtCZ3jB15m0JDraJC1kas9901n8Z31M17mK3Eu4JDm0JncLYX04Z3vlX3uX03t03DnaId+FC0PCi4C-13pOpCruGwHmGDtK3D1OctgaW3FS18"
+"nW3Dv4ZDvSpCEyg3b0NOam2DoSZDt4pCnCZCuKZ-TvWFTv00ru0pVW0Dm4Z33WW3slX3L7I0v9jI2GGDk8nGSGmDuuW1KWWCqaJg15kkCKJCt0Z3k514rC3En4Z5DFX-"
+"76GE7wmPdG3CrGpCmC3Cq03DvKJCq818F00DEtm0Q0k6483CEar70CJmWNM38KZBt8HlSG0Equ0ZI4fg+FC0PCC7r02EkGpDv0JuRInCpa3CpWZ4VHYq33W3Np02rOZC"
+"Eys3GOZDs0pDMaU51NF0puWxI4uZ4KJDEe371ej-33G63pWDW4ZBXMB5p8JEsGJEIq+5X3aqGF02ruoC1VC3qWZDt8nWL8nh84mmIi28SK3CoKZCqCpDQGa4+FC0PCC0"
+"t4mm8O3DouGHGWnCvKJEq0JDg-y0SGJCua3EmSJCI4w64aZDUOA4G0ZDuWZDEG02G8JEr0pDMKX5+FC0PCC0uuG3RWnCr8JDqa3DEOo580ZCruW088jX10mCEOF6Euj6"
+"8CJEn4qzQGf6COZBn4Z3Y5H0V7Mp0OJ0Xv-m0qnm0aZ3+v21nSZ3N+05mKZDoS3CMOd8Ipm08CZBrumKYmXDvKZCqaJDrqoR80YDk4qG0CZ5nx23m0pCn4ag+FC0PCC1"
+"s0Z3gd0BmaJEuWJEmapDtCJDXghtPO01nuY3g310uuG5I44D4KZCf3ABruoCs83EoSJCu43EEKb2Mer3+ha0Lf47s438jSZBq8Z3W711nWZ3dXG05O+99G0Ep4eTC0JC"
+"saZ3zmW8Kg19r8JEp43Cn0pDoaDz+JC0PGC7o0oCk8ZDrKJmM00EEmj8MGo5Ixm0KGZBp4ZCuu0GfWXCqOJEnSpDXqW3da01n0Z4wi22maJCEms6MWu2+FC0PCC2p02E"
+"1100quGGFGXDtGZDtSZ4neXsECW4yr22mapDE8N40KJJtxmGF0GEEyi50aZ3G932m8pCI4k3+FC0TCC0quGZHmHDoW3DnSJEtuGmFGGCtOkLRmXCkCZDsSpCou0FR8H+"
+"c4d3uGpCpSJCpSJEpSJDqKpDtKwR+VO0vS8Br02DkWpCu43Dn43DEqD508JwXAjI20GDE0E3E4C58G3Ev8X594u6E4i5q8pCv43Ev03EuC3DqKpD+ha0+ea00OZ3pZ23"
+"n0JEpuWoGWmDnCZ3RCZ38XXqB900ruGWYGGDvuGmX0HDpCJDsOXEnuGgOmGCnWZDEiC4KGZDtOZCmKms+VO0vS80tuWgcuWiLumUgG1EuO3Cu0Z4vkXq8601nuY3Wv00"
+"rum5eGXCpK3DrWZ3vhW3sm02naZDEeeAEuJ28C3CuOXuGuFn0a1n0WZ33z05qKpDs8JD1x10m8nbHOUM5m0CoGJCEi1CEW528apCpKISXy91pCJ8VoGEp0JD1Dh-aUWD"
+"aU00sumXNmXCsGZDrG3Ctu0Y9unLTuySBG1DkGJCqaZ3u526vOpDqCpDsacqCOZBvSZ4U+00m4i+U4K2+VO0rS80tumItu0pI01DvO3CquGUDWWCrKJWr8zI2WWCkSJu"
+"bI0DuuW0ZW0Dt0JrW30DESn488JCmumEmuG3AuFTB83TB0mD1-72mW3EEuf5KW3EoapDsOnhk8zm0WHDk8ZDp4JEEKz7E4Y84CJC93E4ouoCuKJ0J3HCo0JEmu0CJu-m"
+"0Opm0u0AV0mDEGW70KZ3pr04mS3Cv0ZuqjGuZoIEpSJEmCJCsK3EnSZ5y+IGAX1EpO3CmWJDEKm54OJDfhh-A9GMA1mC1M92uG3EEC390SZ3D0X3jUXtkd09pu2Cu83C"
+"q8JEpu0hWGmCtOHUduWx90HEmaZCm4W6CaJCsCZ-RmXERm10taEfa0ZDoKpCm4JCm8Z3L1I043GDEBz0ESw8ECi9G4JCnKJCE4+40KJGq018puICouWXd01CpO3Ev4Ig"
+"1Ql-86GF8A1AVW0DtKZ3p8Y5vbYvdX00ruG5HGmCouGj8uWQh00EImU7ECh4aSpDmO3Cp0ZDmSZ3-8Z-rjWErj07tO38uuICpWZ3WZ02uGZDESV651WsHF02nS3EEiDE"
+"CCJDmGZ3lTJoRmJCk8JCn0JCv03CvCJDnSpCIyU4+RO0zO86t0YCk0JEquWtEGXDo4ZCqSZw7O25ruYCv0ZCEei3GaJDuWJEUal8CCZBp4Z32M32uapDEWk90WZ-XOXE"
+"XO11tWZ3ga03rOZDruWdCGnDmC3CtaJPD8zX1mpDkGpDnaJEq4ZDnO3CrWpCM8-3O02DkGJDnaZ3Cu24taJCqKZU43WpcvXc5x31nuY3Of20nu0yG0GDEem30CZ-cvXb"
+"cv11taZ3ayW3mP12vO3CXxD0nuWTfuz190WCEmM9C03Es0JvmHGCr81bO4g+Eyl44CZCESBF4S3CE4oE1ce-wNGjw30EEeo74OpDEWGDK03DvCJDru0OauT+5WHDkWJD"
+"naJEEGC300Z3qRY5t1IOlIHDrC3EpaJu720CEOz9+FC0sCC0XK21vWZ3rk16oCpDrCpCmO1Jk8T5C0GEXM30u4s+EWFD4KJEMiP8EqJ5Iap308JmLZ0DpGJY9wlX1aZX"
+"G838tu2EEq77C4ZCnSZ3hTYwTH22nuoDICtF4aJEEGC5rYl31m20qu03CuGQPWGCoSZ50zX-33G633mCbr00r44m8aJCv817E8X9N8jS40GCEGf60CZ3o521qKJOL8Hd"
+"tumG80pDuWZDsG3EnS3En03CQWJ9+JC0PGC0qu0gyuWS110DEiiB4apCEaW3EWr4IJC048ZBEyQ24G3CEalBCCZCpWZ8Id11r0Z3uE37t43Cs4pDmOZ4WMX-43G74xmK"
+"tGGDuum-D00CEO1G84pDo8HdF8zm0mIDkS3CoSZDmWJCrOZ3Id00ou0sA4Mq0WZ30MY38M20mu0q-K2w+FC0TCi38UX3FoX3mG23pS3Dvu04RO1a+Oi74nGDk4JCE8fB"
+"Em-20KZ3yuY5Rs01ouIux1mDEqe2GWJEs8pDfwc-A9GMA9XvFuG9s0mCEi7G4O3CEOJDECa2I-b34SZBEip6KSJEuGZCtuG5C00E1HPu0I0CquWPPKiC8CZCqO1IIuFn"
+"0a1nIG42G43Cp43DE0kC8O3DpuG02vD76mWCkKZDIaU50WZ3MN31qOZ4EYGOIJ1DsCJEtCZ3uf30s42a+-j1wyj1bFADq0pCr03Cm83Do8JEoWZ4a4XqFC05nuoDm0ZD"
+"E8UGEC3404JYW70nIOG4OG3Cv83DuCZ66kZ-86GE82GEXFA1r8Z3kuZ31uX3c6a4wnYq3305ru2Dn0JDE0890CZ3AO21v0Z3mYW3rB11s4Z3XI40muWAjuWkT8HQBu-I"
+"2KrI0aJWq0mDEqbE4CJEECZ600JuQvjq30mCEaLC0GZ31s05rCpDmG3EMmABEKuGCCJDo8Z3bR23o8JDsqId+FC0PCC0oum8F8X-Tu0hGGXCsGZCu0Z3+tWq7603ouYD"
+"o4ynCaJDm8Z39LY55sW3sv02pS3DESOBEKLG4a3E+R91wO910aZ4FyY3oq20tu0JGuGrl00Dc3c3C8ZBm0Z3mb07vC3CpC3CoSJo640n0GZ3Z940vuGdL00EEqu7+xU2"
+"ouU20aZ3pQ33oSJCpu0uoGHDp8JCnWZvqB17ruIDv4JEm8JW0Y0Dv4Z7Rd20pumI4XIEtKJEoGJEsWpDoK29+la0TjKuZoGCpSZDEqNI00Z3xO41vGZwA900tu0DWuG2"
+"aWmDvSZ3B6K8lvWx901DsK3Cu4svC4pCsGZ-+KXE+K11vOZ32O10oumvtWHEuWJCmGpDEKzHUpX1EOt7XE43mOJCqu0H1f1OEuWzmGHCu83CvOZ3oY21uOZ-LIWFLIW4"
+"DRY3dPZ3DxH0u1GEMiRGIBz0EGZFEGW9S03CqOJCrS3EMiF61GC2raZCEqIDOO3EoSZDvSZ-PLWEPL00uu0QqW1EqG3Eo8ZD1h13tCpDt4gMIJC0CKZBtCZ3iqY3Y633"
+"rWZCnO1WmuWA513Cv8JCvaJDsCJEu0JC5Ul-FCGVF0GEXg52sGpCESbFEKQGEOSEYJC0EaHAEGI74aJDXE41qGZ6BU17ruIDmC3EoOZ3er43rS3DoOHZBul76Kj7m43C"
+"m0oCkaJEvS3EmWZ3z223pG3Ep8Er3GGDkumSBGIEvWpCqWZCpO3CMyR6EGZ4K03DoWZCnu0n8umORuFIFO3IFWGCm4JOLxWbI0mDI0JF0KZ3VfWu5308nuYDq0JCmKJE"
+"EO968KZDnOnJhuW1M0mDEK2BW4JDpKpDo03EouW5BuVY1uIY1uWZNu0FaGIEmaZDs4pDn0pCb+hqvj05ruYCoSZDE0DBC43EuCZ3DaIfTHWCk8HkRGmCvumXAHGDqqyD"
+"0mZ-ooa7oo41n0Jveo1CpKZDq4JEt4iY0KZwlv15tu2CnOJCEWE7EeBJ4SpCImzGEu33G8JDoaZCbqe3WoW4fxW-53WB5300q4uc4SJEE4E74a3DI0UJMyt8Il9148ZB"
+"E0AHCGpDmaZ34030uOIC9GmCrumVHv0W1HWDruGel4Ie+hO0zeOuhoXDo8ZDvCJEu4IX0OZ8jxWnBwW3UN40ouWS9u0Gs8X8z4GhEuL5KGZCrSJEouWA21GEE4681SX-"
+"43G74ZWDWGZ3Xw4BoKpCmSJCrGZDrK3DEO-2IZO04KZBEil2EifHE03GQu0K1FImm0XCr0ZDtuGW5f13AuFn0q1nbpA0numsJu0baGnDr8JCnSZ3gZWq5301ouY33J48"
+"qW3Cs43CuGpDQi231k90suW2ZGnDtO3EvCJu6xVY1eJY181O+moCo03Eq83Cm4JDuSZ335Xt7q02tuIDIa27E48B0WZ3-XKYS6ow883Ds40tGG3Dt43DMa1C+hO0zeOv"
+"k2GDEyk5KSZDsWpCqum0W0mCUNC004JW5wWny8XD0vWqF5oSXe8DqG3CpapDvSpDu83EvSJ1SxVn0aHn443CEqsJK43DoOJDsum1b00EEmfDUxh2EiS6OKpCuG3CuaZ3"
+"o821qOJQN7Un843CquGbkGGCouGh75qh+JC0kGC0XP70mu0Tyumaa0mCEO36IWm6Qdk1Eye84GJEE8N5CKpCvaZ5EXIfs10EEG39K0pDrWJDvK9-Mr5LABU64G3DMY4E"
+"X9B2n0ZDEKU900Z3eg40ouluPOfuPGGCnuWJ80ICvOJCnKJEtOZ33i01mSJWM8zT40HCkSZDou00sWHEn4ZDp8JDfjf3DgY3mY06n8JEtSZCnu0tL561+tk0Trk4EX00"
+"uu0ZB1oCm83DrOpDpOZvpyW3xi20uKwF08Z3EA10nKWIEyT4EGk5SaJEvO3DpCZCEGtH+NC0wKC0Iuz70aZ3Oe42va3EEaE9ECg8Ups6WaZBv03Dq8ZDpu0WgG0EqOXS"
+"tOXvP0mCEeeA4KZDM4i7+NC0+KC00KZ3JaW3Gp20sumvPHmDou0UR9Un0GHDkKpDvWJ13uGCm0mDQ0+7E4G34SZCEiq84SJCEO19MSP40mZMqEWmHa31n4Z48RZ3oEJG"
+"7uGCgGmDq8XcQ9D53mWCk8pCEKSL0aZ3s+32t0JCYi-34WJDEW8904JeUYGCrKZ-CaYECa25n4pDWKZBE8D94WJDEKlIGa3Dn4pCYdO048ZBbI32paZDE4DN48JDMer6"
+"EiI2Wa3Dn0pCtGJCs4KiMGi6+dO0zae3Cy33m8JEpumVqW0EqGZ3lsWwOd00uu08Fu06g0nCqW3CoOnbDW08ouY3Hja30wY3Qj21m8Z5+aX-43G74Bnh6n1DqKJCt0JE"
+"ru0+8v05JOkJ800EEWWD44JEEKI9ECvG1eK89wGhAumdDH0EpuGCPulLLeZLL0GCIGbJ00J2n11DmC3EruWo4fkJ80WDEGD3Ga3Du03DEm375I81WOZ30554maZCtGJW"
+"QIGDv81V2vVY1qJY08Z4lv33s4JDru02O81qL00CIyV4URz0ESQ7O83CqGpDu8Jut6i3Eqm4Eaj5ES6J0SZ3mk40pulw6eZw60WCEqoBGC3DrWpCIOyCC0JDtCZ40NZq"
+"4301ruY3UhY3hX52p4JDIa1F5GC8ouoCv8pCpW3CX+B2p4ZDfQd-ICGUI0WCIGZN4CpD1lE0vu0RmWGDoKJ8+8Dn0GnCka3CsaZ3x-02raZDEGdFn513vO3DsuW-MHHC"
+"r4ZCnGZ4XMY-43WB4300qumGNumsHv0RQuWKS1GCMWK8Mhu908JW4IWCouWfN0GDQGJFE4728KpDrumJ-G0EpuG8C0GCICn6+JC0kGC00KZ3ff10ou0qYu08Hn0DvKJE"
+"ImxNIJC0CGZBnaZ3Am04v0pCrGZ3uWIHvZ08suY3m2b4Gc10v8HxUuWGNuFn0u2n0K+gXE52ta3CEKaC4O3CgdO0Ei6BEKPDE0+88GZCmu1KeuWXA1mCEy02O43EpCpC"
+"qCJHkwVn0uIn0moDWqIDkC3Cva3CrWZ3zL52tSZDIeF5IBn044ZBEWfH0SZ3e552oSZDECc8bPj4fF10num8sWGCvGZ3tGKOpvVn0uIn0uGrsWXCmWZDqSJEEetC0WZ3"
+"HoYvZO00tumbmG0En8n8MGWDtaGh40YDEeHCGOpCrWZCICN50CZ-QIWGQIW4CzX3eL60suWQQWWDs4Z373XtiU04ouYDsCZ3Hm40tu0FeG0Cr8HfLKy81VF2sWpCEej2"
+"4KZC+JD8wGD844pCESdFGGJCnOJDIOp30aJmdwG+98TJ2u0ms0oCrS3EtaZDpWZ3U3IQNx0rA4eh00Z3wm11qCZ6wRX-ZOGsZ0mCXmk3i110pumxkuWHLHGEv4WU08Zr"
+"VLGGou0czGHDtaZDu4Z6ug10oumwUWWDvWZ3J633rSJCvuVlAuJlA0mCXlg3de40muGPH10CEqvJIGG7INx908Z3sk30sumegGWCmuGVPe1UemJDkCpDsapCm8pCsWJC"
+"sG3C+JJ2+GJ20CJuhIWCsuW+U0HEsKZDvuW6+0WCUNz04KZBEqvK0KZ3PCc30k00ue1MFWmCk4Z3Du20pumAYH0CpuG-b58i+pa0Tna3wv31oSZ392Y3yM42s4ZDMuk7"
+"Ipa08GZBnu0jSHGDvuGlJv0VP4Y31rA9rapDuOJDo8pCuumkFO1NCuFn0q1nGK38j4ZBEyC8C03CmKZ3d431vOZ4gZWqLF00o4WIImo5C03Ep4Z3DyK8ovWRF02Cr83D"
+"qSpCnaZ3FrY-D9WGD900suGIK00DEGmNG03Dr8JCIWTDcta0O8ZDm0ZCu8Z3Lr12qW3EI0fCEGJ20WZ4j0c3io01s4Je-6ms+dO0zae3Xv41mSZ3kO27n8pCqSJEo4Z4"
+"X4ZqLFW3-c51pKZ3KLY3M0X3YuG0jMI9GGZCn03CEemK0CJW+4m5+JC0TGSvg2mD1uB0vumjF00DEe6CUNk14KZBE4H24aZCEu8D403CE8mQ1qg44n02rOJCEK060GZ3"
+"Pla-gUWFgU01paZ3vp30puW991WCE4cE4OZDEGhGUta0eOZBm43Cua3Cm0pDEGNC0GJoBuGmj1WCEyM90WZ33T13u83EquVY1eJY1W0Dm0Y3Wjb3C-W3bo04n4ZDsGZv"
+"fX12uuICEuT8K4JCrWpCp4M69v43quIDq4MqOWJEsKJCn0Z5y4Y-E9GNEvWnDXGDk0Z3mX02v4JCI42I40ZCXaYsRI00o4cr843Coum6P0GCQiz41P60ruGxJmmDnaJC"
+"E82R04JWuuVn0uIn0uGoj10CEmz20OZ35EY3vJ30s8UlAumAvWmCmWZ3ij05r8pCtSpCXuW35q10nuGvk1GCEOmR04Z3b6Y315X-43WB4300puG3F00DEur9XW81p4Z3"
+"McbtICW3ppW3wkZ3jy31vCZ3N6KRN7u+0CZ4GJ10nuW8GKms+l91Pk90q8ndkumvUWGCnaZ3bIKmhh+r3umkAu0iT0nDtGZCvOH6E4AOGa3EvSZCEm+A8WZCouFGSO4G"
+"SumoDHnCkW3DrOZ47X15q83Du03EX0aqIC02pu2DEi7LECKD0CJ06B1thKc4EawAEW2K0SZ4s9LGlwlY1uYY10WDX664naZCs8Z3rF32uCJDE8GFU-a084ZBnumOQuWF"
+"cHHDsK3DqGZ9Kw01vOJf2ZGDtCZ389MGcv-J2qrJIar348pDIWbR0SJGsIWCv8XXD0WCEZ43EKsE0SZ5sbZ3Ku10qOn1G4sA0KZ3U0X3vwY3ewZ45yY-53WB5300u4YY"
+"Ee0BECLG8C3DmuGEa56UI-a0CSZBrWZ4V+00tuWTZuW7U4oSC02DkGZ3ir41sWZ35E52vCpCImPI+NC0kKC0Ier30SZ3Jc52u0ZCbO40q8nBU8Tn0uWQlGGDq4WhKGpC"
+"tWZDs8Y3D00D1sA0nu0dj1GEE8NQE4l7+NC0TKC0rOXZ+mGDmSJEEmYNEau2glSF0OJ8FuGX90mCE0ZDUuADE8BTKKZCqS3DvuGNe10CEOKKX4g-KCGUK8nqDv0IaWHE"
+"na3EnOZD5-ev+d00quWDc0YCtSJDrSpCtCJIyxm7GuGijXGCvOJ8HImCqO1-juFn0q1nIqLP48ZDE4lQIiI7E0MC1EbqE9W3M911qCZ3XRa3g441r8Z4HlG8920CEyS3"
+"SaJEqWpCsW3CQGe4+NC0TKC6p0YDk83Euu0k9XmDoCZ3JeY4XQYq43W3Ck42mWJDEaQKCOZDqWZ5HoZ3Fq01rCZ3PSY4Hw32pK3DIOfH+JC0kGC00GZ3Ph21o8Z3wEd3"
+"il00t8-w60HCkSZCv4k+0OJQ2NzwO83DnO3Cs8Z3yc33q4JDmul96eZ960GDIqr3C8JCp8Z3Da30qumX0HmDm4ywIRY10OZ3B011tKZ3XXW37Id6wsZ3QS23oKJCu8Xg"
+"9vGzD0GDXAiOA6Woe920rO1Sx98AuvWtPGGCuum9NvG4Pv0JouFiQ99iQnHCrO38jCZBvu0n3v0BC1XCra3DrOk5946jEad3ECc9c4WSESsB4OJEEynEEy7I80pCmO1E"
+"MuFj3q7jEqdJOKJEt4ZCvaJuzumie5AeIJx0EaLL48pCECY5E8dF40pCMapBEC6FEmh6Eu5F0GZ4yyLvYwFn0q1nEy-34SpDE8lOEOM3EKKN00JGDAjx2uWZNXWCuSZ3"
+"ZSY37xGq1u02au0VWuWCW0XDuOJDr4iO+JC0kGC00aJOe1nCpGpDsu0pB0GCEa0I1QXq7613nuIDs4o3Sa3Eo4ZDqC3EM4v5Eym4SaZDmOZDn4pDEiU70WZ5bXW-86GE"
+"8Q1WEvm0XvG9VvGvWGWDn81WGfTn0GGEnuWSk0GEEaJ6483CgK6TESyT4OZCEaOO8WpCmO1ZEuVn0qHnXH70suWxw10EEy7VCGJCuKJ9-eT43uWxjvWCuXWCtGJe25qb"
+"Xa82s8pCE0aG4C3CXu91p8J8gxFn0u2n00WCEeaGCSpDr0Z4YWZ3eZ21raJOr9j43WGCkaZ3Md04sa3Dr4Z4SFJmALGn0GZ34c20ouWpcXWDvaZ4Oib-53WB5300p4Ki"
+"443EEuoTE43E8KZCrK8KIta0WCZBnC3Ds4ZDvu0gGmGCoW3D1IU043GDESDVWapDqGpDrWZDmuVLVuJLVO1XEvWXH1WCEiTL1tfwQ330ou0-800DEW-V0OZ3BSY9-j11"
+"tOZ3-K78u0pCnaZCnC3EISo4+Bn0z9X35w40nu0kL0mCEO23GSJEt8JDEW83IBn04KZBEC3F48ZCEKw5E4p5Qif20CZ3Z4X3js60suGe+GmDmKAm+JC0kGC0EyfF0SZ3"
+"PQHe3mWCoWJCMqk3IJC0G8ZBuGpCEWx4EWcCC4ZCvKJKDXGEnWZ3rI50n48+XHZ-epWDep01sSZ3ixW3VU11raZ3X822mW3Ec7d34GZBEeH6K8pDn4pCmumrHK8vESV6"
+"843Epu0jau03Gv0484eD+ZO0kWO00WZ3Br02qSJEE4H5E8mBE8LKUJO4E0dUaCpDrKJCuCZCnaZ3LxK8nL6x8K3DmumtJvmw3w-GS8qGS0WDEaSN483CES6I04Z3gc52"
+"n4JCbEXqTLW3H350n8Hw0vGhv5uc5Gi3zL50suGsTvGzzXGEqOZ-mvWFmv00tu0e+uGM12GDEWV20KZ3tCav4303qu2CpuWgYmHErGpCs0JEsO1gt008IqYT0KZ34V53"
+"p0ZDpuWwG5ms+Z91PY90t4kg4GZDE01OEi5P04Z3DZa3pyWqym47puIDpKJEtSZ3pa13oWZCoen5W0GD1M30pumpmumIFGGEsuVWHuJWH0mDEKaHEKGI443EIiAD88ZC"
+"rKmO0OZpFFX33q31tGZ3QqY4+D40u82bKuG5pvm2dX1DnCZDsKpDbTY-86GF82mCEC8E8O3Cmu0iVum8emWDmWZDXmkqTL00tuGLOuGga0nCs8ZDuuHqpW08quY36I80"
+"ouGcsmmCo8ZC+tjT+qjT44pDEGr7EufH0aZ31QX3T861p4ZwbRW3fU20rum8Pn0DsOJCfuW35915vKpCsW3DXZA0sumwBK6x+dO0zaOufwmbZ0WCEyUPGK3DoOpD5Tiq"
+"8600quGMguGqZWGCsKZ3VRc56n21WSZ4r940nuG562WDEOfGM8j2+JC0TGSuf2GCE4vCE0a4ESJ4gpD8IiS70WZ3sQOmVWWDs4JnEx0pDu0A2wGsd00EEi1H0KJWsuFn"
+"0u2n08HfNW1Ep4ZDpC3EEWs48G3Dq8Hq88j86mHCkO3Es83DrumOY0mDE0sN5uQ1SJ0Ctum692GCEiFC+7IB25IB0SJugomCs8JEISjA4KJC1qc3HZWs-j01taZ3Mr50"
+"nuGco1mCQWN61B21m8Z3RRd3Re30o40t1QZ-96WB96W4Kz11u4Z3XZ00muG0dmGEu4ZC1HWqICW3ol85oWZDt0ZDEelHEu1513T89oWCqCZCESH7EaM30aZ4AZX-53G7"
+"530EIGw5G03EtOJCEG0R0KZ3IfdviUW3Xh40nuWZC00CEK684KJCM8F31Ki3j054r8JCs4Z4LCN1Sx-r3atrWWJCWqYCkSpDqu0hkmmDsGpDES351zaqA604qu2CvWZ3"
+"mla3JIb4MPKBAwWyM1WCEib244JCEufN14c-53WB5300ou0kQum42vWX9wWfXG0Cu81mC8D53u0tDXmCoSZ36-80puGLDeHUbGnCkGpDuWZ3Lf72vOpCEK43+NY1wKY1"
+"0WZ31S25pWpDmG3CESWK8W3Dpe+6MmGDkCZCE00XSWpDqKJCvC3DQ0k5C8ZBoKZ38B10mu0h+WGEt0Z-etYFetY3qta3Hs52tGJEEGLG0WZ3gZZ4Lz10ouyD9mGCkKJD"
+"EOG3ECMI443EEa5HHv42m0pDEeH908Z3eE30suFaUu3aU00EIKw50GZ4sD81vSZ3ISa3EY61brYr0hW3iC41mKZ3t170vu0Ea00CIeHDEmG3GWZCm4pDEWKO8KpDouGz"
+"p50t+Zz0zXj32SY3b911sGZ3QY42s8JDManSQVz048pCECKT0WZ7EzLHxZ08suY3kn40qu0t4XWDtKZ3RtW-43WE43W47q70v8Ho8wGNnuG6FO++mGWCkKweWW3CpCpD"
+"oC3Epe1E9u0Eh1WCEqR80CJOQWWDrCZ3TfW-96WB9601u0Y3Z621nKZ33s32mOZDECk4I8v4IhO00OZ3sK82t4JC5+90t4moXC70Wu0VIwm3H2GCXbD3u4ZDo8npKulJ"
+"2qbJ0aZ3AnW3UL71u8Z3Qk23t0ZCvOkICGXCk8ZDt8Z3aF93oOpDmuWhsKGnXeOu2JGCmuGMcGGCqul1NuZ1N0GEEuAX483DES-QEqt9403EE0M4UFE4CGZBp0Z3U323"
+"m83DtumPW8ofH00EEyf7CKpDtWZ3AE20vO1douVY1aJYImVJ08Z3pTY31nX35VYybO00u8HUmGHEsOpCv8Z6B7PWRI3DsS3Dta3Cr0JCra3DruFn084n08n9jvGVTvGB"
+"JuWYHvWoSvTY18Ha5vWwMG1Er8JDpaZ6L9H8WYGCnGZ3+z30uuGr1HmCt4GO+dO0kaO00CJONZmDuSJeRZ1CtS3CpWpDkBn0qWJErC3Dr0JEnWJCvSZDMmJ6IaqC0GZ3"
+"b910qumV9vmcJ4MA+xa0Tva48u32o83CEWr3EaG684pCp81d98Dd40WCE4QOEe1bOKpDr83DuSZ6T082ru2DE43C8G3EsuWpGw0vKvVn0eJn0uWL610CEmqM0aZ3yO21"
+"o4Z3eQetc920qumWmvmNEwGwv10DX8P0jwGyguG0wnmDuaZCE4PP08Z-PwWFPwW32u44nuYDnSZ35690tuG7W00CgRIN04J8oX0Dv8JWW0GCImiG5KC0ru0KcXGEv8Z3"
+"Mp43t03CuOXhIvlJ2qbJE8h7OaZCv83Ds0Z3qT61nCZy5Ad38M40mumSTm0EvaZDUeUN0SZ48g93v0pDruG9eGGCnul5guZ5gum0EHmCku02N0GDEKkW4CJDECEW1kZq"
+"ICG0kY0Do8Z3sw12sGJCE8B7ba81quY3IFf3+E53t4JEouGnK4m5+dO0za80vuWPSuWw8uG-o0WDXv80t8n+L8Tn0GnCkG3Ev4Z3hC64r8pDuGJqg3HDkKpCt4Yc4aZC"
+"EqFCMC07+NC0PKC1o0Z4UzW3d9e324Y32970t8-NJ1mCE4PDCOJEu4Z3rh30vOXj+umS8WICrG3Dp8pDtCJDvum1nulY18ZY10WCEKWJE84A08Z3qN36nCpDoSZDsuE4"
+"DGHEsGZDuWZ3K-a3j9O9K7Gn04Jmz1HEtGJDuuGM9O1iEu-J2KrJ483CIur30KZ3Hy03vO3DmuWer0WCI0b3I3z5EO2L40JDEWy5CKpCo8Jml4oSEeeC4OJDEOb9EyiB"
+"CS3Dn8J1NuVn0qHn0CZ3kGa3DR60uuG8G0WCEyUBcht7KOZBpG3CqumfsG0DsumGkOHHKum7RHWDouGcoG0DvuGmKwGe-1GB+Jn0oGn00GZ4j61AsS3CqW3CtSZDrSZ6"
+"qmaqPF04tuoCoCZ31v61p4Z3bzX9-O20qu0d81WDIGEF4GJCM00Z+hO0keO0ESPP8SJCr4uCGOJErOpDEKd70Kcsgt86quICnG3Ep4KcEKq3frLOJGGEuumVSuGI6wWR"
+"X0WCo5d4EFm9QsbaEeVE08Z3KhZ3Xsf31F80mu-0d8v0dGWCmuWhNW0DtWJWwHWDuu01Y00CIqWHIdY008Z3Un33rGJDmuWlbH0Dm4JPES470CZ3r6a3hZd3DrW31NX-"
+"f8WBf8W4--03uS3DnuG9SX0Et8Z3Cad3GcWq5305suICqC3EE4vQ1fD1s4Z45fX3xd1Dr43Er4ZCv03DsG3Dm4Z5GMZ-uHGdu9nfEv065Y0CmaZ4js51n0Z4zldq53W3"
+"b621sCJ13HXCm8pCp4Z5HXW3fb21tGZ3Uyb3Wk70ru-0tup0t0WCESgJIqyZESLKEKaB8CpDr8nFHeTn00WDE8jQ0KZ3Hk60tu09W4c-be83oaJCquWvjWGCrKZ3gtX-"
+"zKWDzK00n8n0tumoo00CE4rXE0uLghxI04Z3HM50suGMFwGLKvmTS5Wh1xD1rOZ4t430r81ck0mC+Jn0wGn004Z4MP51sOZ3Ok61nSZ3Ap31tKJozvSOLmWDk4ZCE4G2"
+"E0n60OZ3gn30tKGnCGZBtOJ0I3HCpWZCm81sa4m5+Jn0vHX3qp90tu0lcmGCpCZCEm+REinFEKs2Q-w5GS3CtWJDESH24W3EEeQKnH11uCZ4ta91qOZ3RIX5fHe-53WB"
+"53W3lUX3QiW32tY3D312vW3C1HWq9601quY3raZ3zd20p4ipMCebE4M5803Csum8Zw06AomCqWZD+p95sm9508Z58ua3RJ60ruGBeuGxOOXzSgDs3mmDn83DEWrZ88pD"
+"o8oPCvmzG11Cr83Evu0kHX0DoKZ6yk70yu-GDvnGDXWCnKZ3LjZ3x133u4ZCrum9P1GDc7QCEKFS1GA0ouWMnw0iGa8dEO3UEaGOEO52C8pDmCZ58fa-43G74R1N6vG-"
+"h8XpWwmv7AXDI9TY1WWDkWZ3Ye60mu0xCu0gXOXOru0B9mGEv8JDEC6R0aZ42PIOpvVn0uIn08XNVWHEm43Co43EQev8cN72XCd3t-03mWJCsuGn4L2rX663qC3Du4Ei"
+"E8u2ECeA+p91wm910WZ30m11t0Z3fUc3FC60nuWJcuDdKu0TVvmySw04CmmDn8ZCQOxM48ZBEOIF40pCEChB08Z80fe-E9GNE1GEEm95EuFW04Z3Kw12qG3DEaY5cNC0"
+"8KpDmu0yAn1Eo43CnG3Dm81JBW18ouoDmWZCEavEEOD2EuhL+dO0saO0IWWJOa3EmCZDqaZ3jBa315Xu4300pu0Rc5a+8S3DmumNIAHq25KJEK8E48JDIu83IObD+JC0"
+"wGC0IGJVIOyGC43Cq8Z3h3f5vAgqbOW3dGA0mu0yN0GDECaX4WJCISa21Ki35D20qumDP00CEGZ7+--3+y-308Z3sMb3Tk32rCJEEmi40CZ3AmYtWLX3AGd3otW4XaA0"
+"s4MsX8NGDHWCsuGWH0mCEulI4W3E+l91+i91IWWJ4W3EEOkG0aZ40F61tOZ4DsYqnX01puY3vjg3Ep61rOZ3ZM40qOXD9uWs11mDEKzgCWpDr0Z-ondHon71o8Z39S20"
+"vumk0wmyXoGDtWpDgtG70KZ3fR30p8X2MuWDf2WCIO-5E4O9OGpCrSJDu0Z3Qz12q4JC+pqGwmqG48ZCImw50GZ3uxX34F31oSZ3undtPI01puY3utb3fzA5sS3DqaJE"
+"Me-CEmSYECSIEWpLK83DtCpDr814AulN5ahNM06dQi62KGZCt0JEmO+g7uG7PuGrwvmGQ0GDYijY00Y3uFA0n81w71WCEqPQ0KZ5BbX-43G743nDWaZBsu0sluGQB9Hr"
+"99nq8eD430mCEiX5Em-fE07L0KZ5PCIOh3nCo0pCou05Uv0Ss9X7BuFn0u2n04kg8aJDn4OE483CEiNa00Z4blXq43W4jb82tGpCISli0CZ3RUHXOImCkuGDz1GEEiyU"
+"E8YJ0CJn2wFn0u2n08XiLn0CnKZDEyP80GZ3RC90uOn3FOzpD0mCE0VEEOId08Z3NCY4d1Y3MI10ouWbxuGjjvWEPGmCqK0t+ta0Pr40puWhbHWDnuG2TuGTevGt-00C"
+"XLjqbR01ruY3te10su0BAv0kd2mD5TPWPY0CoaZ36n05tK3DuOpDMWb2+JC0kGC0XHd3XQf5xMh3aM80muGq88DWBGmCkuGAZuWN6v0W210C9eKPH0GDESn2E82b4S3D"
+"EOrL1Hc-86GF8MUgE4zaCW3CmaZ3cEg57Ias86GGnG0Es8I2pcUgC4ZBuSZ3zw50vumGRwGqhvFJ2u3J28H+q1mCEWKLEuOB4S3DEWiHEGK4IdO0Euo8C83CoWZ3Cg60"
+"vumVeu0k8uG2DuWlL10DEOq84K3EESZhb7i-96GF9AnLV00EEWc44WJEIq7UEyNhUVk14SZBEyP40SZ3MSA0pummHbslE4E8Eqx51xd4s590oulY1uZY10GDEK474G3C"
+"EeISC83CrSZ43rK0a9DO5KSqEGeC8CpCtuWyh8nxH4s44OJDEySW48ZCEi474WZC+ZV2+WV2CCZDWqY4hZ00uuGgMGGCruWkm818B8zJ20GCEGx9403CEyh6GSJDpG3D"
+"Y4u2EeDi4KZDEKQi8KpCvulWyuZWyGWCpu0MVGGCtu0+iHGEtum2DWmDvGJOJeTY1WmCuaZ3bS50ruGcLHmDrqaJ8KZBqum1xuG2T00CEuwG+tw1+qw1IaWJE82b4W3D"
+"EK598OZCqOHMB9DY1uWBJGGDpumglIWCruGtFQHAcW08suY30fA0su0x1oWDsGZDQag7+Vz0zTTwjY0Eu4Z3eV33uWJEpumHXuj2D0mCEeC80CZ3Mg56qGpDoaZDm46N"
+"X913t03Cmu08dwmg5IWDsOnrYvVn0aHnIqyc0SZ4HyA2vSpCEqdL0CJPrfTY1u0FK0mCECUH843Dmu0BS4iqE0pFEK6H0WZ3MkW39zc4Q-Y-43WB4300num24HGDnuGN"
+"TXWCp0Z39X10s8XbG8Tn00YCkKJEr8JCs0Z3ufa30ZNobumGKvGGJ0mDIaqPE8+d1mj-96GF9QHM6HGCpu0hlX0CnCZ4lRNm9ATn0umGs2GDI4k60SZ3Jg60ne13D0mC"
+"EGRAKWJEpW3Euu0KnH0DtKKP+NC0TKC0puGBKX1CpK3DoG3CE8+a0CZ6W-gqqX08nuYDoW3CoW3CEyEIE4a5XrLOJ0WCE8LLEG0S08Z3Qog-HtWFHtW4Jl90ruWGOGnC"
+"mGJDrOZ34XY3RKXsWL03naJEsuGc-HnCoSJEoOZ83oZ3FBd3+915pSJCm0ZCMOjO+dO0zae3PzW31v01sGZ3mjZ3H8If3BDY100DEWgUCaJEq0Z3O162pOJCr2MmpG0E"
+"uuWaEmmDr8pCMyd8+JC0TGi45S12nK3EEa6540JCE4TI00Z4ocWq5301nuY37dc3Sa04uK3DpKZ56jJGDnGCvSpCE4P5Ma+OIeA3+NC0kKC0IKh7EOQF0OZ3HQ62sGZD"
+"EauO9kZnbx60uuWaFH0EsuW8b2nCp43Eq8nTZu0-900EXfc3nJg3V150qOH9hvlY1qZY0WZ3e9Y3a8Z3Otd3Y521nCZ4OyYqSIW3Z740muWnrvW5D0GDEuOOXyGeXHmD"
+"numAgWWDm4Z3nba5P4Z-53G753GEES9R0aZ3yF80suWhkumMv5AOIxa04GZBEyyc08Z3I172s0ZDEmki5GC5su2CtCJEEGkd48JCEKj4+h43+e43ESWJEeI7E8-708Z5"
+"DZawnY32uuoCIGLRESHiC83EuWZ5M910Wu0mT20DEOAPES8WIWV71mj-96GE9IGDn8HXBm0Em03CEK1D4apDEaFLXkjqE9W3v462nOJEEiu6CSJEq0Z6i320WuGrW1WD"
+"EWa7EmkN8SJDsulJ2uZJ20GDEqr3EC9HECk4CC3Eq8Z37pWtJt02ruYCEyW6GaJCqSJEEaoLja81ouY3+Dd3RIC4t0ZCuOZ6Qra-96GF9w0tR2WDEiqbEy4i04Z3GaX4"
+"uNXqfR08quYCpKpCmG3EISYN04Z77o30r8HNAG0Dmum2gv0fMuFY184Y1OnjLvmOJXWDm4Z3Tna3SIbt96W37GC1qCZ3IG22uKJCEqbcfTD1quY31V20quWKG11EpOJE"
+"tOXJ9uVY1qJYXxg3XBZ3cn71rCZ31HPPH8zc4GGDkumkBwmddwmbFomDv0JDXzRu5xW952mCI0-h4CJC+d432b43EKMJS4ZBvaZDp8pDE0jM0WZ3YRR8-8jr3GWDk81M"
+"Rvmrq0GEEaQ4MmfBEKE4O8pDoCJEvaZ37Qf3sHI0SxLY1uCod0WDUEJSWSJCrCpCr03EpuGexWGCoKZ-8VYb8V21rSZ36612vOJEEeL8ESVA4WJEoRlnEimd883DouWW"
+"y1mCEi08Xy42W8ZBE8FVImuZIWSTMSg7UPM02NkRK8JDu0oDkumMNuG8Mwmng1GEMOjHIZ71CKZBt0Z3K-90uuGpx1WCEuRaDGC2p8JCEORC0aZ43A20nuFEFu3EF8n1"
+"EX0DmGZ3F490q8nTnQXDi9Dn00WCE8JdEuGQ8OpDnu0uXA1MJ4CnCWJCqaZ3fd05mW3Cv0ZCMKgB+ZO0vW80sum2qAngDumlTHmDuuWUw8+E5mWCkaJDE4I8C0pDmGZ3"
+"DOHPyN0n0OZ3EpB0tuGbdH0EvOH4-uFn0u2n0WICWaZBoGpDtG3DpuWan10DE4SoUpvE08Z3WzA0vuGB+uGef4wx5n40rumUSv0Gz8Ydx4m5+ZO0zW80ou0ZkWWDs0Z3"
+"S0e3ufY4E0ct4R04ou2EnCZ3u5d3Gy40ou0J77Wh00Y3IhX3hH40ouWRU6sz5mj-53G75ZmCWWZ37z62rWJCEChL0SZ3P2JOBAz-58Hv7HmCsu0wYIGDuO2wCu0gl10D"
+"Eu9i8CpDquGRm1mD5ij-43G7430D1B63uCJDoumD5B1VRAXFe8Tr3uGsmuGfP1WCEiW5Ee68XuGeTHmDpu0XCGGEvuGuxvWba6od+JC0TGi4eUH852GEEueV4OpCE0fE"
+"1GcsU6Z3r582p4pDEyvVE0Kd0GJ0kwW1E1mCEifO40ZDEqD44CZDUGA7MjBU6BY1Em8d44ZBEqw3CSJEmCZ3kZ33p43DuOk43GmDruWEqvWSb0mDE4fX1eKOIu0bH0WC"
+"Ea8AEacJ0WZ-pSfEpS92oOpDESC28CJDsuGYyv0me2GDM49fIBn0E06F0KZ33Kd3lm82sS3EDGi3zIi3Ux60oum0ev0c091JFulJ2qbJ0WZ3is00su08pumFFvGHS2WD"
+"ImQ6Ilf208Z38jW3Br86rCpCm03Dt8oMLGXCvGJEvSZ3CQ80s8XjF6KP+NC0TKC5v02Dk0ZDEWgQ8aJEsu0Nl2GCIaJ4IdO0IyfO4KJDXDX35KY5V5MON30DE8cUIW8d"
+"EqJF+7z4+4z40SJuiw0ExWmDvWJ8iG0EpOX74Bjr3GmCkuWjovGUF1WDEKuLculD0SZ3C318s4ZDtSJEp8pDMCMA+ZO0vW80tum2OuWaAvGw2H0EouGf-1GEXpgq8602"
+"qu2DEasYXF90u4mh5Pf3th40puGj37yWEWHX0KZ5ihY-43G74xmhbvG86xW91A1+9OX43BDn08XPRGWCquWLGPHb5bgN08Z3hdA0nu0m11mDEyaD0WZ5izX-43G74RXf"
+"N0WCESYPS0JDrSZCtSZCIWF5INC048ZBEC9ZEC3m48JDo4vJ0CZ3DIX4p781v4Z3cIj-LFWDLFW3Iof3Kc12qSJDEGo8ECqh0GZ4kFfs5300tuGsFvWdK21EoKZDoaSq"
+"EOa4Ei024aZCEy76E46T+NJ2wKJ20SZ4RPKmSu0br0WDEq43MGVVINC00CZ3Hl91oWZ3AED0ruGk8BHEy5GnIi4GIaw5EG+iIeMT+-a0kya00OZ3P523qOJDuu0GJxGd"
+"d1GDIOw8IRJ24GZBEqkQE8prGKpDtG3EQm0cEC470KZ4+Gd3Wi00nuGplvlJ2eZJ28n05YmDr8Z3QLX3TsZ3koHWSATn0umWHuGoju07Mm0EuS3EI01AEOJ2E8lI4OZC"
+"ECL2EmJSI8D2+dO0kaO0EGBVIKKc80ZCnu0fwwmqGvTD90mC5x64ua3EtKZ39ce5xGIGDHnDmapCuKZ3F741uSZ3ktW-96WE96W4iwY3-mg3hzY3iZf3bwgt5302nuoD"
+"EiX34CJEEOz488JEoK4c1KC0ou01LvGj7YmCqaZ3DSY-53WD5300uuGjLXGDs4Z3GFX3O-30uumFTwzqw0nCkO3Cnu05xWXCn8pCuS3CLGC4t8JDs4Z3-412pC3DEiFG"
+"+JC0wGC0ImgB4CZDEWgM04Z3da33napDo4CeIBFL0KZ4wl90ruG1h2nCrGpCt81oR4c4EurjeapDmSZCsaZDsWJD1zg-ICGVI00EIKr78GpDsu0yXw0FG2mCEmr3cFQ8"
+"ECvREOgbK43CnO3CuO1b+uGwDGmDpuWXoWWCvSZ3ymc-h9XFh910uumfNuGVMGGDvumOHpGCrOZCbyZq3kW38n01nKZ33o53sKJEqu0Da6qDX263nW3EnuWJdLqjI8aK"
+"+dO0kaO0ISw58SZDrumCRuGPu0WDQuiJI3M1EOxh0GZ3Oa01sCZ3urY5oES992GEEO05Ee+O4GJEEysb1mj-uaW9ua01uKZ3uIX3UHe3RhB2tGJCEOcB4KMBMBn0EqLR"
+"00Z3YaB0tu08EuWQ75Gh1r40suGPTGmDruGwTxGEk6m5+JC0TGC0suWeXWGDmaZ3uk35ua3Co0JDgZ9RK4ZBtSZDouG9uu0iRJGEp8Y0dGmCpuGVWu0uLwGslK8E+NC0"
+"kKC0CS38jCZ4uM50sumaY2WDXPdvbAb3AuJ0gw0I1vWF900Ebga3AYW4yB50mOHdT2mC+p912n91EqGP8OJEouGtSx0S9vW3T8+c4uWUQ2mCEGTMOW3EtOpCq8Z5xeb3"
+"PP12sOJDEmt6EKpJ0KJBWwlJ2qbJbxA3mGpDt40PESRAEOYRUxw14OZBXTROMGGDru0U8e1ZeG0Dk8nFg1mDESZZIyWu+h43we430aZ3mw20ouWnNuWHX81WN8XuY8DX"
+"B4Sw40JCEmcG8OZDrump83WCX1SWoIWCpuWVYI0DnuGnu0WD+lV2+iV20aZ48u33m0ZCpumOT10DEuu8fxgq5300o8H0MHWCqu0-QxGOdbWhEuG3Ey1mECp48O3Dnum4"
+"l60t+xa0Pv40vu0PT10DEegQC8JEqOZ3oT81rGJW-BDn0uWuuHXDtCJEo4JO08Yp4vW+t4M3EGMeEayR+NB9+KB9EWWJCWZBuSJmWImDq4IX4GJEIG1OINC04SZBEyVY"
+"08Z3ZDj3SeX7qNg3ar50puWSgGmDquGtn0GEMyXJ+dO0zae3RPZ3bnB2tCJEEK1DEG751dkq4300ruG2Gu0VDwWkcoWDmCpDf+b3HV9BsOZDn03CtG3CqCZCMis7+JC0"
+"TGi4MBC0ru0bw8nx52GDEevo1gZs53Gmbv0tUGWCmumFoP1t45aJ0SZ3Pgj3hea3fQ10vuFmAe3mAu02EvWLP00DIybnEiTREqzdU3M148ZBEOb4EasKEGVQEm6OX1C5"
+"WKZBnSJEE0rLE0tnE8sTXHd-A6WBA6W4qw10tuWTguWHRuGZe0mCIWmGIpV2EW6JISpp0OZ3TO61taZ6PHROO30CEm280OZ3ZqW3CIQ0Sx-J2qrJIam5EyJM8a3Cvum7"
+"VumQa8+J2WnCkSJDqCJEXOD1nWZ4muQ0kM8j4apCES67Em584OJEMuM6+NC0TKC0vumjLvGrtvGT2w0uDxG+ouzJ2uWQJHGEsuG4o2GDE05B0SZ5Te33WGZBquG06JGE"
+"vumpiXmDoSZ5z3X-53G553mCEaWJ0KZ3QkC1v8Z3cUa33Ge5T2XqPFW3yz30mu0L+8HiKI0DsK8wXee3DIa3HN50tulpEvapE1mCEaWJ0SZ37k07qO3DmG3EtWZ3aM80"
+"vuz8Gu0Ucx0KJ1mDEGz58WJEqeH7Q00DE8q60CZ3u3C0oumjauVcEuJcE0mCIu0d4GJDEGp2Eq-vCKZCn8JPEgDbO0mDEmM5Eub400JG1P1t45s4Eu5n04Z3GXe3Rbf4"
+"eCc-E9WBE9W33gi4Nob3evA4qOpCr4Z4WKXqTzW3BKd4Xx00nu0ol8IlKGWCkuW8DGXCna3EsGZ3++i4zfX-43WB4300quGWLGGDmuG7ennCnS3EmOZCqumc98T43uGb"
+"YxWmAum6DY0Et4Z7fD51suIWFoGEpSZCXPX365MWowlr3qdrICHPEu5wEqjs0GZ38m10t4CYIJC0KKZBnOpDuuWGyHGCrOojNu0KmumSH1GDIOBK84ZDuuFMPe3MPGmC"
+"muG2N0GDEyCd04Z3MO52m0ZDMmFmQJC0E4LS00Z3Gt05o83EpCZCXuW3ItW3+LX3ST22r8JCEKkF+B72s8720CZ5br41pOZ3fcW3eFj3mDgvNw01tuY3Mke4Bca3XwB0"
+"qOngnu0mAGmCouWK71HEu0pCtuW3yvVJ2eJJ2um4bHmDpuGE21GEEK9k8SZDpOkCJWGDk8Z4rh40ouGDu00EUO-oE8T34WJEEKFC0OZ3N730mO12kwV43uI43u0Qq1WC"
+"E8+D4KJCESaR00Z3f8XtXO02puIDE8IO0KZ3XWD0vu0aJNIS00Y30oX3EE17oGpDnGZDs0Z4+lY-43G74xmOD1mCEe+9EOUM0SZ30vd6eQXsIC00u4eb08Z3OiD0nuW3"
+"+OHD900DE8ElEGCE4KpCXPY5SKX-53WB53W4zEf3hHX3VrE0uumIN2WCcBn0EO9aEia9C4pDuKZ4N3Hef6c48GZCouWC11GDIumq4GJC+Vz0wSz0IiscE45GEi6yEGfW"
+"443DoBn0EW5nbs51r8Z3l4LO-wG3Kum2Hw0JJmWCs4pDQ0fHUDY1AtvA0SZcbD56pu2DrK3Dnu0go00C1BC1v4Z-TkYaTk20pu03SwmtZHGDouWGXGmCrum0BeLJv008"
+"L40CymMPXPcLXnMTbDdFAKX58328WKZBv43DtCJCm8JDsaJDu03CuKMBm438ouYDoOJDraJCpWZCvW3CpKZCbr2CnmpBibnH8mpBVbnI0mJ7CG38WmJQkHNPovMOivqR"
+"avJS008CWqICWCJCq0ICkaJDs8ZCtapCpa3EtapDr4JPj0pCyyYOy0WO430GouoCn8JDu4JEuOJCuW3EuaJ0AnKCWKZBtGJCs8pDo4ZDpCJEn4JCp4ms0mZ-43G643LD"
+"Wq2EkWJEoGpDuGZCnCpCmGJDo0Zt530HnuYDrOJDp03Cr83DoC3DtOJE1uA1WKJ89oYDrG3CoW3Ev8JDnSJ1SxVn0qHnSP38uuoCsC3EpSpDqWpDsKJEqaZDbr2CouSY"
+"1GGDk4mkiGJEuSpCv83DoKJDqK0nXeECt8JEqa3Dma3DuG3EsuFn0u3n0WqDW4ZBo83Eo8pDmGpDoGJEsS3D1TiqD90Gpu2DnSJEmG3CtWJEs03DnaJHs46AqaZCr0pC"
+"tOZCoGJDnS3E+7n0+4n00WJGmIZDoaJCsa3EvOZCqK3Cm4WUQJC08SJCv4M4SOJCsCJCtS3D9n4Gsu2CtaJEmC3Eq43CnWZDtOJ8buFJ2u2J2mKEWqICkO3DnS3Dn0ZC"
+"oGZDtOJCp42AINC088ZBr4qaaO3CpWZCmW3CmSJ1k248ruIDtOJEnKpDq0JEsOpDva6A+7n0v511o0JH3mHCp43Dv4JDu4Mb4apDUNz0W8ZBvK3CtGJEm4KF8GZDmaaD"
+"1GC4nGJCt4J8c2HDn03EsK6A+JC0TGC0n4IYu43CsapCo0JCq8ZCsaJCm4ecIRz00TZBrOJEpK3EvG3DuaZCuWpC1X96n02DkGpDt4c9S43DsGZCpC3D14c-53WB5300"
+"o4IYqWZDrapDnOJDqOJDpK3C1cZq430GruIDuCpDmW3Eu8pCp43EqWJ0ALyvSOJEs8JCn0JEXH71s8JHavVY1qJYOC38suIDt0J0Wn1En4JCo43Eo4WU0GZrUL0Es8pD"
+"p4pCoKZDoOpCtCZCfPD2ouIE1JF9m4JCnG3DsC3En4cS+JC0kGC0KG38j8ZBq4+GGC3CnG3E1EA0m40PIdO009ZBtSJCnWJDmG3CqSpCvC3E5P3HWKZBn03EuOpCn4JD"
+"p43CsO3E5mj-96GF92GDXACCqCJDo0ZCoS3DqSJCruUY1mIDu0ZDr4pDs0JCm4JGFLyvaCZBn83CpGJCuaJ8nJ0EmKu++JC0kGC0iO38ouYCvSJCr0JEmKS84W3DYh91"
+"0DZBpC3CoK3CmW3Dq03CnSpDnW8DsSJEmSJDt4pDv8ZDm8Jw2xFY1q3YWS38jCZBtW3CnK4IKOpDn0pCt8Un0GZCkaJEmKpCqa3CnOJCu4iyba89ruoCqG3EmWJCm4OE"
+"80JDo4GO+NC0kKC00WJeVHpCq83CsOJEtC3DqS3EmKwN04ZpNF01nuIOsoHDuapCo8JDs4k-HKC3v8JDs4eDGGJCvOpDbOY-53WB5300v4QsEqC2mG3EpGJDqCJCsWJD"
+"brYrRI09puoDqOJErCJEm4AHCSJDq8J34ZZDv8pDpGpDnWpCo8pDrCJ1RxlJ2abJeC3CWq2Dk0JDqKJDEKR24CJCEW221bitRI0CrGpDqS3EsSJDuGZCo8oHCW3DuGZC"
+"vS3Et4JDuaZDs0Z3ViW-53WB5300nuWlAuG8BGmDm4sZ8SpDr81r88TD94IYmGJDuG3CoCJEr83DuGJSIWpDrO3CtKJEtWZCtaJCnCZ-eRWEeR0Gp838jSZBq83Dva3D"
+"uCpDqaZ3AkGeM8Tn0mpDkKJCpWJDv8pDo03Cp4pD9uAGWGZBt83EoCJCnCZCmC3CqWZ-BqWFBq0IpC38ru2Cv03En8JEnaZDs43DmKeEQtw1uG3CqWJEsSpCs43Dr0JC"
+"v46NE472GapCoCZCEyb2G8ZCvG3C+tw1+qw14C3D1k9EoW3CuGJDm8ZDqWJDs8JCXPdq9606suICsapDtuGaCq0obTD4quYCtCJesn0DsS3CXha-E9WFE900r4GnCWpC"
+"qWZ3+l06o4JDsO3DsuGTA8Tn0mZCk03DuGJEs03CtaJCvCJCbZl3oX0Do0ZDqSZCoSpDsGJCoaZ-4kWF4k00p4kh0SZ4lx08vK3EqG3Dn4JEXaeqRI08ruYCr8JEuGpD"
+"XuC3nSpDoaaJy4ZBsSJDr8ZCm8JEpaJEuSJ2RxFO5qBO0SZ3oX0CpSZCq4JEqW3CoC3DpKC9IZO0eKZBoOpDtWZCu0pDEey24K3EbRf4He04tOJDu4JPlGGDqO1hEuFn"
+"0q1n0WZ4c612sCJDXPD1mGZ3jl00q8+c4WWDkaJmkHoDuaJDsO3Cq03C1eKWRY0En8J01xmgCmWCvWJDb3W-53G753HEWGZBn4UGWSJCm4pDuapDn8X-B8TY104Dk8JE"
+"nW3EtWpDvCpDnO3DpaC9GOZBpGJEES34GCpDvS3DEO12Xrk-43G6430DEe-4GuoDma3EEiQ2OO3Dq8JCtSJ0a9Tn0GYCkapCmKpCsWZDEG-4803DuK8XEiV2mOJCoG3E"
+"uK3Cu8ZCqGJIbvVn0qHn04Z3Ht0Dp83ErG3EsOZCpO3DqWZu4308qu2DvKpCoK3C1yA2mapD97D2WSZBEiD40aJOq5Ye+JY12HY10HZCWqIEkKpCt8JEmS3EnSpCEqa3"
+"1kfq9601puY3f416naJEnCJDtuGzC4WIXa8Dq4ZDr0JCtO3CqWZCtWZ5nzW-96GF92mCE4Y4mCJCma3EvGZDv83EvWZvwd01ruY3Q+0Av83CvGZDn8JCo4Z4Zd0HW4ZB"
+"p4JCt0pDvGpCsSpDv0JC5ij-43G74Z2DWCZBsGZDmaZDvuWvGm0Cn4JE1TisZO0DnSJDv4JCtW3DnSZCmKJAn5I9maJCpCJEvGJDtapCnKZ-43WG4300r4UOiWJDqCZC"
+"vOJEmCpCtOFn0GnCt43Dm4JW+vmk8O1S8WGCkKZ3ud00sumuGmGEmGJC5rg-86WB8600s4y8CSZCmSZ3+l05rOJCrK3CIGd2QhV2eKpDqC3CvWZCrWJEEq76XCTmZmoC"
+"vWJEtWJEqWJDvCZ3SfW-VLWEVL00tuGD90GDEGm5W03Cq0pCsWpCs8XgJ0GDENf3eKZBrG3EvG3CuaZDEqP644JDfe8GpuoDmW3CsaJEo0JDpa3ErOJ1Nul43qd4btg3"
+"Cw01r0Z3Ft04nKZDn0Z3eWWqA606puoCuS3Dn4GmGGpCsGJELk91rKZ37W03nCJEs4UoIad6+NC0kKC00aJONp1CpS3EraJEtu0rFGmCs4OKI-L18KZBpuGRI8naO0XD"
+"sC3Cu4WI4438EOA684JCtuWoD0WCECI504Jv4xVY1aJYSK3CWqYDkW3CEeE2S4JEn8pDrWpC5HWq5303suICouWUJ0oDtK3Cm4JDoKJf9n18quoCqK3Es4GmGG3DtaJE"
+"Mm05+NC0TKC0num7GGpDm8JCsO3CvKpCtO3CmOEXB0WCXe80numZMWGEpWJ1D5Mm1p34vCpDpWJ05mmDtaZCIq26+NC0kKC008Z3oC13saJDquGAOGXCrOJDmCZv5304"
 );
-static sybie::datain::DataItem item1("haarcascade_frontalface_alt.xml",1,
-"1h70ruWwPn0Ev8JEoIP6OGZCp83Do0Z3Mn90oePyNWWCqWZ3Pi90muGqB20EUNpU+Zv8MZv8Ii+fg1P1QWfH+hQbAfQb4SZBECYCO0JDvCZCmGZ3XaZgbRI8QxmO+G0E"
-"ouWaa2WDMA-5C8pCo4Z3Chc3Sjf38QXqoVX-FNbnFNb3lMZUt2b6E7Y-IxaIIx47su2DmGJDp0Z3Rig3Ujg5h0Yb3g01o4JutmGCvOpDEaobUMe7E8jQEiD5G03Ema3C"
-"QRaO+Vv86Vv8ISD2EmB2gjq05GY34aW5DnW-9IXA9I10qu0lVm0Dm4JEES3lEyWVgQV348JEEiA7EqdT0GZ3oxYbEc72rWZDEGyYCS3EuKZ37qgs15X-fMbmfM50muGh"
-"rummSecf181GsvGv9vFc684c60KEk83DtS3DqCJCmGJCqGJCuKYfMEOG08Z3jj16v03EtSJCrumkGPvuS0mDEyXg0OZ7a0erh0Y-sDYnsDY4bFfW8wX6++W-CDWGCD09"
-"jWZBsO3Cp43DsumzR10CEq9HEOt3M+S3K83EnC3Cou0A33WCEmNZM6dCiKZDpKJDq8ZCtCJDouWV88Dc6uV4qOS4quG58fdy4uGoDuVy48Ly4m1Ek0JDnK3EnumLwwGP"
-"IQH93P9f1u0fQYnCsa3CpWJDE8RbMcN6eO3CrGpDrSZCpS3DE8gaMBq6+Nt8ANt80CZ3bCa3PrYQoJG0buGsNulmIeamIW0DkCZ3TtB8q0ZDqa3Cra3DMSzAM+32EW1i"
-"EWDQE8lB0WZ4K2ZYR412oSpCEOU6GaJEsWJCESi7Ipq0kCM314WDDFb-GSbJGS50r4ofw9oO0SJ0aumsNuVc68Kc6WGBvuIOBHHEtCZDpOZ38je5RVXbQQW334a3kW25"
-"rG3DvCpDEKIOAUQ0CCZDpWZ3In90suGkZ0mCE8QUAR38+7i467i4IqSRE0hEkvq0Ea85+tBQMrBQ44ZBEuP8iSJEmC3Dn83Dp43Duegc60nDrKZCruGoI4GGEm02AUQ0"
-"0KZ4Z4X3pRb3AYA0uOTG8uWxA1GBkip5+-q06+q00SZ30EY3uVgQe6W4l1h3MPi-FDWGFD03su2DpuGW9vWtbIGDvuG8BOwf1m2Dp0JDsGJCvGJEnSZ3Uhfaed03t0ZD"
-"vuGRe0mDE4O600Z360goEDW-CLbpCLb40afUxtJ0buGzmuHq1w-DDeoDDu0TUu0gYXGEp8Z3vi42mO3EQ21bEq8K0GZ3LL83p03CquGkZu8J3mXCvGJEvS3Cvu0mr0mD"
-"EWXWENQ0+-746-74I8qIwHQ0IShpEiZ5+xu22vu2GGZBmOZDEmZ78aZDtumhWPX7nPPw90HDqS3Eru0JX1GDEGlJEO3TAUQ0C83DvSZ4MOX5BEerNeY-BLbpBLL94gdy"
-"M5G9EShJ+VaaATaa0GZ33XW35jQGbp0EpK3CIWzHME428CJEpuWjMvWN3YGEu8ZcabX30MLedXWDtSZ4kGfqgdW-CLboCL50u4GTEys2gnf10WZ332b3eXW-SQWISQW3"
-"C3A2m4pDEyvP04Z3y6XgSQ01q0Z38K20nuWh1ImDvuWDZe8K3GnDpa3DtOZ3esW37AftGDW-52Xn52X4B2Z35EbQd6W-GnfPGn92su2DEmo8Em9cESN50WZ5ciadtJ01"
-"qKZ3Ue01o0Z4PMfbCiX3yqd3NtY3Ez01sKZ39WcpUQW-52Xn52X3qqW3RbcQc6W3CFX3Bpg-SQWGSQ06j4ZBm8JCnuWnzWHDt8pDt83Cg+VA88JDq466CaZDoKZggiA0"
-"puGmhGGCmuGnUmGCnaJEMJF1+V84AV84Qm5AkTQ0IWJ3+-j3Mzj3KKZBq83DtuW7BXHCqKJEmGJDIWq8Mwq048pDEKsg0WZ3Bs52oKZDE4iGAMF1Eqvda0ZDv8ZDnKJD"
-"maJ0gviJ3u-XGOyXGumJ1fNBI8Xz2v0m4v-J38rJ3mGDra3EEaJZE8d604Zh3P45p4pDu83EE0DJE0hrUUaMIOYYI0cC4G3EIadkEVQ0+V846V84Q4o5+LJrXei-ZXYI"
-"ZX20suWRXGGDuu0ZO0nDnC3EraCdMIz4WGZCuGZCnaJCqu0C020EQQf9GOJDrWJCEOICG03Ds43DQt9H+3HLA3HL0KZ3S3c33SXQTQ02r0ICMy9H+-q06zq088ZBtuGI"
-"OH0CvuGr4wGVz8nw9O9g1WGDv0Z399c3ld02uWpDQQLB0CZ355A3s8JEtum5eIGEpOzbcuV4LfS4L5ST+PeOIKz4+xg8Ivg80GZ3DJj3b584nCJCvWZ30vgfIk00puG3"
-"D22EvWpDrCJCsOZ3jfdZTQW4lDB1rWJmPJmDoeTYGuV4LfS4L1WDI4+foLF1E4wY+dpIMbpIGCZBoWZDE4rDCOJEnaZ3+xHPDPvG8GGCtumzT0mCIeUA48JEQUZR0KZ3"
-"3-Z3fn62pC3DEmvqIlU2+3HLA3HL04Z3A+Z3a1XQrJ00numpYumtEaOzIPLBEWaMPCY-rFXArF14nuIDs4Z31jW3yc82uGJCM89RMUH10CZ4iy57o4ZCn8pCuSZcI915"
-"rSZCrOJCEGE9GCpCqGJCMBb4+ZJLAZJLQyyMoLiEI03DEqC4fei-d6GFdIGBtuW+iw0IhuWjxvG2VBHjBOPeLu0NzY0ErWZ3Vo30ruG8a9fHNWoCmG3DqapDmSZCs81C"
-"ERjS3ulgGOigG8nlW1WCESMSkDt05OY4olNAhwKT300CESd4TGY-F7WBF7W3-r23qSZDtuWaJX0Ds4Z4oIeY2U33p8ZCmumfG2WDEu1500Z3O2XZYRW3gD76pG3EoapD"
-"nuGRAOjo1uVpGOSpGOn91AuVju0TwwV6K8K6KumgYvmKmmGDv03EE0zYE0eTA2Q00GZ35h30ouGefnGDvGpCQkR54OJDE0XDECVtbg80tODe1u-nGeynG0GCIeTDoD82"
-"Eyg6ISC4fTc-3DWB3D04puoDsKZ3EgZ3md70su0tgvWAAefk6GGDsuGzTx03q4iZMAH1Euu388pCsu0-MZ0DvGZLJKOb8PZrTOoksv-OLfyOLvmpRvtW8uG38v0BA8HL"
-"kLHnH401yyb4nsN6YuFo1q3o1dj3OV61uKZ3-je3NGM87RPs60mCEu4Y1YD4s4JDmKZcj5Y3vT10uu02YwWhM3GCEqWGAVE4+JOLAJOLE4c908J05O7s60WC1Fh7e3XJ"
-"A7W3zHHu0u-a3eqa34irGK3CvaJEE8VFG0ZCmKJEMgsG4SpDE0BF80JDuumYUwGfsver6GmCpu0U5nGEsWpDEmePMZa2+JQLAJQL0SZ3nhXXD6Y3X4c-7raJ7r41puY3"
-"YZB0sumr53WDEu02k6biICPe4WpDEC3ZEq55MQtA4GZCIShi80ZDou0lufjCrvlfLfifL9HDZuGbpOtR38nAeuHZXuqR30mDEivA+J13IH13Xv65saZCrG3CIGdd00Z3"
-"eNZYaY01rGZ3hDa3Dp93tOpCqev+aGWCnu02RWGDm8Z36gA0r4seANJ10CZ-l6Ynl6Y6ae70pucn181OFwWzIulHA8aHAumKrX0DtSJ8u0mCE4DB0CZhkE70suWP80GE"
-"EKGW0KZ3JBXbFy40quWiaZGCtWZ4dr60uumyhwCg1uVCoeSCo0WDE8N9Em9Pkzs0I0s3E0b2+hQ02fQ00CZ4wD70ruG68vGUJJGDo81iXOPqIKMWEqoZGOZDrCJCEiGd"
-"A+h10CZ31l43nSJCqumKF1WCEedSEdQ0+JZC6JZCI8KBwXQ00CJeMu-f18rf1WHBqu2Cm8pCEqOoKGJDoCJCtOn1HO9g10WCEiKkK83DmaZCsumEVRPK3u0PU00DEGpM"
-"G4ZDq4ZCQRy5+pQLApQLEKOY04Z4UwiRHDW3Eyg3DRYRulW6-aL2ZuV+B8J+B00DEuXvG8JEqOJDEWzP4GJDEa-2MkS0qKZDtOpDpaZCnK3Er03EQot80CZ3KE43nS3E"
-"rumYr10DE4zGEFt0+ZG46ZG4ESFME442gbS0EuY2EuP3+ZH12XH1Gq2EkWpDEmo30SJO5m0DqaJCgcH1aSpDqaZCo4JEo0Z3rZZ3nyWYPKW3O+W3fi51tGZ3Gkc3Qgap"
-"c6W-E4XoE4X3KiXUd6W4jeW3sDa-e6WGe6W3wEF2n4pDEyNe0SJ8c2mDIOq3Qsq0CCpCuSZ3A843nCpDsuvxb3mCE0ThOOJCm0pDq0Z3NyYqrAX-LNbqLNb5kbXQDDW5"
-"Rdc-zrWJzr04ouIDmWZ3p-97rSJErG3DmOZgA+Z3TGX4H841o0Z3PMF0tOPnN0mDXH84ua3CmWZ3GWirPgZ-MNbpMNb-DDWyDD00ju0KtG1Dn0pDq8Z3rpE1mGZ5nPcb"
-"ED00ouGEeuGAqwWYa3WDUk55C4pDv4Z3oE21t0Z33JirD3X-QNboQNLmq9XR-esJ3409EGw5M442EDo3E4eZP8Y-ZXWAZX03jaZBtu07SnGCp8ZDEmvL4CpCIWg7MIY5"
-"WKJDpO3Dp83EsuWTS3mDEu5AAwh1ESe5EKNH0OZ3GqXubsa-yBanyBa3lfj4hhXQ97G0auVEKPLEKXHDkWpDqKJEq1JEqWZCoG3CsSpDbr2CmC3FlG7QoLsSez6RavZ2"
-"WqH0an3RbP6TVPNOiv3CkCpDrGpCv43CtGJCu0ZD1KJ5TO3D0mWSfT6QHK3HrOpDvCpDs4ZCrCpCrOJEpmpBPu12yyoN5GG5+G0FVb130128y4IBj02ToLMPWGZCWqIB"
-"oi10oa20Di28ozsRq1YRlHMPwq20a028yOMPXHNToLcB31G01G1FoLsOqDdFM000W40YeW38t0oCWC38j4ZB1SQ5Z6H0SmpN+a38t0IC1KI1YG0Fl8LJ0W2Fqb6RqL6P"
-"+03FlqW24mpBIv800mJE2YKBqu2DvCZDt4JEpK3Cr4ZDtaZDcQQ00T3CnaZDvaZCnK3EuWJEtS3FEQQ0yG3Du0JEqaJEpWZCvSZCt8Zrc600peJU1ulf1Oef1WHCr0IC"
-"o0YCsXQ01K22p0YCXmg-g6WGg60Hru2DpWJEo8JEmG3Dp43EnaJEcgQ0y8pCn0pCsGJEv43DoO3DsWZag60FrCJCpC3EsaJCt4JCq8JDuOjg100D+hQ02hQ0OS38u0oC"
-"WGZRGD07u02EW438q0Y-c6WHc60GtuIDma3DsG3CqWpDu0JDm0J9c20DIQF1uK3EsG3EsWpDs0JCmWJEqOff1m3Dn8JEpGpCmCZCuCZDv43DMRQ00KZ-c6Wmc600n4oe"
-"04JOKf6+4WICp0ICm0ICWO38ouFK3u3K3GJCkGJDoW3Em03Do0JDo4IHXz40r8Pg1WoCtCZCq0pDmapCm4ep0OZbFD0Es4JEs8JCoSZDuKJDqOJEMdQ00OZ-f6Wmf601"
-"q0IXwJGCouMg14G90OJDdwqm642oXai-B7WIB70Hmu2Cq0pDrW3CsaZDmGZDpKZCIQS0yKpCn83Cv4JCn8JCpO3Eq4Za6701oSJHl0GEXjQG1Pjn10mD+RS02RS0CS38"
-"nGZ4eXWQkD03t0ICrOHQ8uVR3uJR3GaDkOJDmKJEp4pCnS3EmOZCqGJOjP93AW3Dt43Cm4JDvKZCrWpDn8ZbMK08sOJEpGJEpSZC17C1p8ZsMK00uu-f18yf10mCXXcU"
-"bX01p0Y-aXWNaX09quIDtKJEpKJCvuGiBmGCtSJDcUQ0EqZ2aWJCv8ZDnKJDmaJ8ShuiBWJCsCpDoSJDvO3Dm8JCsWZspk00vu-f1eyf10WCX1bSJK03n038oKcJ9lhJ"
-"KKW3slW3PlG2Yu-rBeorB0aDkKZCsapCn43Ev03CmO3CsuQo1WpCvSZDmW3EtOZCoWpCpCZbNK04vC3ErCZ36n03o43Dv4k4ApN34K3C+dS02dS0Eq52IG62gTH104Z3"
-"dYW38YW-NKWGNK0Hj0ZBm4pCsO3CpSJEsWJDqOJCM2824S3C1-73u03Cu8nqBO9W8m3DrCZCo03Cma3EmCpDt83CIhh14KJC+FQ02FQ0Oa38m0YDWKZSY601n0IOj1GD"
-"+BQ069Q001ZBm8pDpK3EuOJEma3CsSZDMIh1uKZCmO3Du4ZCnWpCpW3CnO9H3mpCrWJEoCJCvOpDv8ZDm8JDM7Q0+3C463C4EG320OZTCKW5Z310ouVw4uKw40YCnapD"
-"rKJCraJ8YYmDs4JmoQvRDWpCr0pDmSJDv0JDtaJEuOZb6D0FrG3Dn4ZCp83Dt43DsO3CsOTf1u-lGOylG4yP0OJW5hMw40mDICy20KZ-c6WHc60CjCZBp0pDt03EmSpC"
-"quGrJ0GCgQc44K3EEmV2W83EnaJDna3CqO9J3G3Dm83DuaJCuKpCpCZCruTx4uFlGOClGKCREyB4oTQ0EWK30CZ-jJWHjJGnF23CsCJCn0JErWpDuG3EMcK3iOpDqCZC"
-"sSJCtWJDp4SnIA328G3Do4evSaJDnKZCsO3DMZ050KZ-u2Xou210s4oU40YDk9Q004Jmmw02KulC88aC8uGC8mIEqGJCsGJEp4pDtGZ3m7X9ENXCafWBGT15r83EoSJC"
-"Iiv2GKZCnWJDIAQ0u4pDvSJEmGJEsWZCs4pDn8LiGG0FluWDN82sMW1FpHNOdLsNP893oSZBnumZN03CuC3CmS3En8JDmmpB+K20DSBAy0NOoLcRqvpDyyI3A4H6WuMP"
-"uHdFj43FlKG2YKo5cKV5I0y55S50WuI3C00Foq90Iqs5DCL01KGD1820WuFUAOCUA4KHX+cQdFW3F5X3PWX-TmWGTm03jKZBr4q1GOpDtCJDEau54OZCXNZcQZ0Dv43D"
-"tCJCm8JDsaJDu0ZbiF07oOZCsKJDv4Z3qV12u0pCMhD2+hd26hd2E4J4IG-5gPQ0EeD20GZ3o+W-p4XFp41GnuIErOZCoSJEpCJEuSJEtKZ4QZWbb605oCJCoK3EEKg4"
-"443EEiP6I++0iKpDq4ZDoSZCnOpCpuW5J8js8ulVAOiVAG1CWG38nSZUQZ02m0IE1KY-RZWJRZ0Huu2Ev83DtW3Do4pCp03Dr83Ccsq0q4ZDrOJDp03Cr83DoC3DQ6q6"
-"yKZDoOZDrG3CoW3Ev8JDnSZqe6W-1gWn1gW4lV12r0ICobp1Iyl4C4JDWWZ-sJWHsJ0Gmu2CuCZDpWpCtS3DuSZDraZbhz00r4YcaGJEuSpCv83DoKZcwS07vKpDoa3D"
-"vGZ3zx11qWZrbmW-zfWnzfW40O10s4GUcfe70SJO8vWxDu-b68qb6GKCk8ZCu8ZCt03Dt83DvOpDqWZf9D02pGJCEiA2O0pDuaZDmGZ3hYWYzH16raJEoK3Cpu0wIm0D"
-"r4pDMly5+7e2A7e2GK38o02DEWE2cPQ05G22o0IE+RQ06PQ00LZBtOZCv4ZDvWJEs83Dr03CISp6MUf1CCpDnaJmNYWDnOZ3zgWbCD0Ds0pDva3CpW3Dn0JCuOJeaeiM"
-"KulDROiDRu0nNuW0CeMf14Yn8C38nuFf1O4f1GKBnuYDq4pDq43Co83DsSZDnCZgXd01oKJeXGXDmC3Eo0Z3YHXbyW0DrSZDv4JDtG3CvOZDtaZrKQW-LiXnLi10nu0o"
-"D0mDwjq04C38Eut8+-s3Azs3iCZBq4JCp43Dv4JDuuG280GEg6I9S8JEr0pDqa3C1EC2qO3CUQQ0C43DnSZ3Bt03rKJCmezb6uF5ROC5RW0EW4Z4i6YRCD00uuGgB00D"
-"+Zt8IXt8ECt3S43CsapCo0JCEGB44aJCIwb70SZ33Q28rWJEqG3Ev83EEij6AEf1uG3DtS3CtWJEnGZDq8pCpOzjSuY0F4G0cSo394W4uxW-2RYC2RY3zT10ouWfNecx"
-"48n3RGGCm4Q5IiI3gau39403yybFmumQWan80mZ-eRY9eR2Fmu2CpG3EsKJEt4ZDrGZDru0XEOYfG83Z083EH0JDuCpDmW3Eu8pCp43EQAv888ZDsuGwXWGCmaJuZuWC"
-"Oeii60GC+J946J941-gVZOH0a0mCYWK3oWJ01403yybFs8HjGulQDeaQD0XDkKpDm4IL0WZ4p621u8Z4HyWbhV17rOZCtCJCp8Z3yq01pSZeKpX3yy08m4JCnG3DsC3E"
-"M7n304Z-t2Xnt2X5rKY3mrWRFEW4hrG8FdsZ+ps0znMeoGWCquGHG0nCm43DuuWBA8fC5WZCtSJCnWJDmG3CqSpCvCZcKR03n03EuumiM0HDp43CsejLbu0tauVzheRz"
-"h00DX9kUa600q4Gc+FQ0IDQ0yKZBvGpCr83Co8pDqGpDnKZiCDW3fL21r4Z4cY22nCJCMUQ0EiM9GC3DnWJEXDC0uu0CCuC55uljGOijGmmDWK38EmQ5gfq00aJWjxF8"
-"Au48AGXCk8JEt4Z3DDY4fr01uGZgWe0DpCpCm8JDm03EqG3Cm4Z3sqWY+XW31z24mSJDt4Zx1w10nuFkGuCkGu0BN00EkLQ0I425EiD4+xE16vE1KCZBtW3CnKuv8OpD"
-"nu0NXOAkGWZCva3CrC3Dv0JCs43EvKZbCD08rC3DqW3Cu43CEiC240JDMNJ904Z-v2Xnv210m4U3+TY200JG11WC+JW2IHW2Oq2Ck4pCq8JmcWnDpG3DtW3CEeIC6seC"
-"04Ju+ZIDuapCo8JDsOJEvOf4F0nCv8JDsumg800DE8T8Mtb4EqI5+Zf16Zf11RfScM10qOHWe0mCjraL6e00nuG9K4n8+x52gu520TZBr8ZCqK3DuC3DrGpCnO3EIij9"
-"MUW2yCpDqOJErCJEmGZDoWpDrGZbA70BsaZCtC3Dt43Ep8ZC5KZpxQW-T3XnT312s02CEOEC+HAAE0K6UGPBMfS0XUJ4YuVo1qJoESY2KG3CrGJDruGlLmmCn03EM+u0"
-"XG8AtGpDuOpDrW3Do8ZcFE0DqW3DoapDuSJCrWJEsOZsClW-y3Xny312o02CXkgS57W3lHZ3QbHRFw-e1qpe04Z3EG13oapDmuGI80mDE8D4ckj1uCpDqGJDuG3CoCJE"
-"r83Due9R3WmDrOZ3JM25tWZCtaJCEqD8Eps0+7G467G40aZ3gkW35eWSeeW-tsYNts2DjSZBq83Dva3DuCpDqaZ32bXgVz26tKJCpWJDvu0smm0Cp4pDMYQ0eGpDoWZC"
-"p4JCp83CECmCM3V508Z-Z3XpZ310n4cBozq0IyrBEWO9+lY22jY2aKZBma3Cu4ZCv4JW3Y0Dm8Z4geWbxQ00ruWKs0IEsSpCs43Dr0Z3HRYYHl05oapCoCZCEKc5C8ZC"
-"vGZ3j6YoFD00oulmGOimG0GEIeY200YSoNHRp1GC+JM96HM9OqICk83EmWJ8dXXDqWJDs8JCgUF1KOJCsapDtuW7RaogIE62CGZCtCZ36m05qOpDmSJCQBz208Z-y5Yn"
-"y5Y3VIY32hXQsJW3CZIODvF8Z848ZWHBnu2EpG3EEeg6O8JCrOZDqOZgAo1Fo03DuGJEs03CtaJCvCJCo8ff18HrjGnDo8pDtOZ3rbZrM-10ouFnGOCnGWGCt0I8fAtq"
-"B0GCEOm6Eic4+ZQ02XQ0I8qB0GZ36425vK3EqG3DXqcYrr07r8JDoa3EqSJO+XGCtSZbsl2DnOpDrKZCo0ZCvCJEvWZsSv30ouVmGuSmG4OxoPf10WZ3oHJ0d8HFPuFv"
-"9e2v9mZCk8pCt83Dna3Du0ZCpGpCM0L30CZaoM16r8ZDtS3Eoumrj0GDECwDIUq0u8pDtSZDrWJCmG3EvOJDqOT3e0WC+-B46-B4IK870KZTLQ03n438ru0nQu-H3OqH"
-"3u0QcWWDpKZ3yW06mGZCn43CqeAv9GWDvumPDGoDuaJDsO3Cq03CIYQ0E0iCXGg3oi11oaZ3qmYpzWW-w5Ynw521q0Y3DoZSyWG0X0GD+l32Ej32CGZBnSZ30T38n0JC"
-"tWJEt4ZCgg32SGZCv43EuS3EEKCH44ZDQYECCOpCqaZ3LD23pSJEtuG5H8T3e0WC+t946t9444JEIa32oDF144JEI8z7+Zj3AXj3OqICkS3CvWZ3pL13sG3Do4COccj3"
-"W8JEp0JDpO3EsuGNhG0CqOPz4GIDpOJCoG3EuK3CEqmH1KZpDDW-02Xn02HWE30Dsrq0E4I6+hN8IfN80PZBrCZCuK3DuOZDoCZDqG3EgMQ0SG3DvKpCoK3CX870muvc"
-"69nla0GEXlGO4wzBDulVGOiVGuVu9OVu9mHBvuIDpSZCvumtnGmDpumNVeQz48n-a0ICvaJCpKpDu0ZcP+1ErGJCsK3CnSZDmG3EoS3EMNF10CZ-+1Xn+110mO8YBuGg"
-"ku-XB8sXBum8VGIEua3DsaZCua3EMAU2EGiEaaZCma3Ds4ZCn8Zbfq0EnCJCnS3Cta3DpOpDta3CMlTD0CZ-t1Xnt110nuGon0WDE0K9gfrAEm32E8X7+du22bu2ECA9"
-"OO3Ds0JEsaZ3dI20muPADGICtKJEn4pDuGJCEi9HME4708Z3DE38paJEqKpDvCJCE0JHA-e10CZ-n1Xnn1X3jYHmmfMe1umXcuW8juFe1u4e1WXCmWJDqCZCEi6F4CpC"
-"Eyb3Eci3O4pCt43Dm4Z3ogX3D9Xayj01nKZ3VL10su0VaGGEm8HvtuCe1u-QGeyQGuWmduG+ReMe1GGCoK2e08Z-Y6WHY606jWZBt83CtuG7Q0GDImEE0CZ431ZcXL1C"
-"rS3Dp0JEu8JDuapDoumLpeOOLG2Dpa3EvS3EvG3EEqjH0GZrK540puVSGOSSGaOnovt2ECiEI0lJ+774+4744qICE8S7EGb6CG3CpOZ3KEZ4OdWcFE38rG3EvG3CuaZD"
-"EKnDEyoGAQQ0ECSA00Z3f255mKpCvWJDMdx40CZ-o1Xno1X5awaSuEX3VLHmswlf1Oaf1G0EkuWNVGGDmuWcT0HCrOJCmeQhOGnCpWpDq4J8Y20DEO7KMsx48KJDruGs"
-"GmGCpaZDEeA4MZX40CZ-m1Xnm1X3zpY381ZQpJGmtwlr98br90qCkO3CpS3EraJEt8JDsOpCsuAM11mCEay9IWJDCOZDp0Zb8x03pGJCnu04IXmCu8Z3ErYr8z10puFS"
-"GOCSGOH8c8N5IuGki4cS+lq06jq0COZBu0Z3+D18naJCoSJDuCJDgEYEEyiLK83CoSpDruG1D1WCMMAHKGpCqK3Es4Ye4G3DEmDH0mZq-WW-k1Xnk1X3Ec40rO7WB4sI"
-"EKO5+RQ06PQ0EO4K0SZ37o44s0JErCZ3VhYaYq04oCJDu4Z3P130vuW0B1mDM6Q0OKJCvCpDpWJ05mmDtapCQZ32+h64Ah64EK590GZ3k9YQkJG1b0WC1KY-2zXG2zH8"
-"b2mCEui5EyBDC8JDsKZcTd01tCZ3k223n8JEru0U8efJQW2DtO3CvGpCvGJEouW+dOTa600D+V646V64MmAJsvT204Z3YzX3xsX-Z6WGZ602nu2CXG38taJErO3DmCpC"
-"oI4KEmt4CKJDnSZ35Q40qewa6WmCp0Z3wSHWtBrf41W2EqfC14WDCKZ4AKZ42G40qulRG8jRGumDLuGwp8tRGGGEWuGLQuFg184g1mIBouICmK3CsWJEvSJ8kYmDr8Z3"
-"4SXbjq04oWZCnOZ3I921sGZ4JfXaLxW3Xd07vGpDoKpDmGZ3szXqMQW-WsboWsLmMAnYne6g1OXLauGB4v-BD8qBDuGk0H3CuCJCrWpDp43Ds0JDt89c6WHEn8JEvC3C"
-"EqT98WpDvumuHeeAD01DsapDquWYYGXCnaJCnOZrwEX-TsbpTsLXGxG2De6f1aG9EGj3+NQ06LQ04DZBsKpDv0JDv03EtOpDnC3DmOQJ3mYDm8ZCsS3CoOJEm4Z3A2aa"
-"DD00pu09f0IEoa3Do03Dt4Z3o3aoY810qulUGOiUG0GD1ddUf600t409+ZQ0MXQ0E8jAKGJDv83Csu08-umoZOAg10HDs4pCouWyqGGCquGIVOvxW1nCuGJDr8XZYW0C"
-"uSZ4+hape6W-y1Xny110pu03DuW-ReMK3uWHV5m8+pu2Inu28O3EtuGvKnWDvWpC1ciaqJ08o8ZDnOJCnaZDISX6ECB8AIF18KpCm8HvCXHCsOpCr4pCQJF1+Z74EZ74"
-"Eik5sz324C38EeqCEiNF+Vf1+Sf1EOnF883DnumrEGGEvuW6LP9KQG0DmuWHkWGCvaZ3vz50veP6LnGDu83EEqKLO8ZCpG3DvSZsvWW-r1Xnr1X4oGYV9kW36Ga-PNYK"
-"PN2HjGZBt4pDqWJCtW3EoGpDu8pCI8y4Qgq0mWZCt8JDpapCtSZCn8Zc+WW4FO23rSpDtumMQ0mCQViA+NNNANNNIqZG16lSiJ00nuWzR00D+p326n32EW-60WZ32266"
-"rW3DvC3CuuWF5v8MQW1CtGpDq4ZCEqWP4OJCEqA8AoE1K43CoCZDnumNSmWCmSZDUR32+Z746Z740WZ3MWZ3t7XTY6GmDwFVdu4Vd0XCkWJCsu0xZmHCtKZCv8ZCr8Xi"
-"OOfI3uG4kW2CmO3EoG3DvC3DmO9eTG0Dpu0qO1WCE8SN8SJDoeDb6u-JTfyJT1mDXWgUmGY4cna3wxW-tWWGtW0GuuICp0pCs0pCvGpDnOZCs8Z4-lXbd601qKJOAHmC"
-"muW5JnmDmCJEIMu28SZDmuGBK4Cr80pDpu0MfeSt9u-KTfyKTvVc6OVc6WXDk03CrO3CEKoJ4G3DE0OJgwq0SKZCq03DmWpDEicO40ZDQ242843Eru0Zfm1CmGZDs4JD"
-"sOjRLuVMTfSMT1mCEGK504Z3GhYQtJG1b0mDEyI3ICU2Yek4H401yyb3xTa4ZOY-0sbI0sb37e03v4pCvumjU1GDEKxDM2a4GKZCmapCEmNC4OJCE8LFMMH8S8pCp83C"
-"t4JEIuk60CZ3SgbpkDW-L4YnL4Y3Ax00nuGHxecn1umeBuWzIfnN8uan1uGAAuW1ma2w+B0Cg80CXGC2sG3DEiVPGO3EpW3DEG0EE6820GZ30z58oa3CrOJDqa3CQ+m3"
-"48ZDE4rKYitCIJ05+ZPNAZPNEiKF0OZ3WFXQ47W32f00p409+BQ029Q0EG05mCpDpKZDua3CtC3Em4ZcdM10sumcDm0DsW3CECmN0SZc6l03qKpCpu04oG0Etu00c5Mq"
-"EVs0+BB46BB4ESeObTaQZ6G0auG7cule18be10GCE0jSEmU2883DoKIRAMq0q8ZDrCZDsGJEqOJDrO3CE0r7AQy2SK3Dn83Ema3EEC6S4K3DUV72+BB46BB4EWKKEqV9"
-"g5Q004Z3aiY-mZXKmZ12suYDEKI8aSJEu0pDmGpCmSZ4wFXcTe02qW3CEWE6KW3DpW3Dvevy81nDnC3EsuWZsGHDqOpDo8ZrC-40ruljGeijG0mCIefNo1qS04Z3j4Y3"
-"Q3HQ9vqh681EJbn8+3h1T3B1tuInj2WCEucOC8pDsOZ5QqbbvX03q8pCnu0hsmWCpW3EEGHFIU+28K3DtuWw+WGCr8Z3N4X3rPYpIKW-F5YqF5ImKAtvd81S7vmzYaYo"
-"+VQ0zSA1nuY3SHY3AK70nu0ZlH0CteQismGDpGJCEmO800Z3lx30uu9N80GCE0ONEa1CG03EvW3DQ7t0+tD46tD4+7t0+7t026t0E8g4GGJEu0ZDEaOS8C3Cmum2Hf8t"
-"6WGDn4Z3aOY3yS40oummd99R30nCqC3CrumjS00CEOzJ0aZris00suVTXuSTXumpZPND58n-nusuBuWrRv-C58rC5WGDkOZ34y04v8ZDtKJWu3mDICt3MEJ1uCJDp8JC"
-"uS3CqGZDo0JDnuvC50XDuOpCvuWiUW0Ct4Z3SjcopK00suVbXeSbX0WCES+2EKy2kLA208J0XuGXfvVD58KD5uWwB0GCEyZ7WO3DvSJEuKJCoO96j0YCuGZCpKpCuWZ4"
-"JbacdW2CrC3DuS3CmW3En03CqujRO1WD+RWC6RWCM8NKoXHBIa8C+BQ0M9Q04OZBEanS843CuuG5AmmDoS3CIWeLMca2GO3EuCZDEixOGapCmOZDQE7UCG3Dv8Z3amW3"
-"-312qOJDM-l60OZ-u3Xnu310n8HDZuWs0v6J3eHJEv-jNuqjNW1Ek0JCs0pCEOTCEqIK84JDvuGxVOfg10GCE42FOapCvGJCuSZ30uaazQW3Qwa32d15sSJDv0pCQVx5"
-"0OZ-L6YnL6YZf6W-e6WPe601nuY3L651u4Z3PY34n0JEnSZgtU15r8JEmW3DX593raJEruPeRHHEvCpCuCZ3cx63saJDreDP8uluGOiuG81gSedNP00EEO6J+xL6IvL6"
-"4qYCIaEL4SJCEytMG8ZDmWJCgYQ0OO3DvW3ErGJOFY0CuWZcSd5EqGZDmGJEvW3EoOJEu0JDMhTA0OZ-e3Xne3X4Y9XTCeG0ZuWzVOHG8u4GFuGCMaX8+ZP3gWP38qIC"
-"ku0GH1IDuaJDvCpDrCZiVh4Dp8ZDmGpCu43Dq83Ct0ZcsvX3OYW3iu40su0vc0GCQdKB0OZ-A4XnA4X4FvX3tTeQ0RW3EgZ3PXY-EpXHEpX3Be05oC3Ep0pCEyL6C8JD"
-"rCZbmk0CtKZCua3Dn0pCr8pDm8XhYfuKKG1Du0JCo4Z3BF23ta3CnuGaPuCiBu-uGOyuGOHTDONvK1mD1020qumbw8X8Ru-I3qtIGOZBvCZDb830q81M72GEgAH1EOnS"
-"a4ZDrWJDu8ZDuSZcIK05p8ZDnGZCIGYH8CpCqezWC1WD+FE4AFE408JmN20EEuoQgnkB5KY3RgZ-f6WGf602uuYCESdWWKJDsO3Eq0JCtuwk6W0DrWZ3I124m8JEs4Z3"
-"wBdbAe07tCpDu8JEu0Jef00DQFh90SZ-73Xn73HOGvt-EK6K+pL3MnL3Ei87EyZCSK3Cm8JCoOZDEud6Agc4C8JDv8Z4VU64q4pDsGZciT63r8pCpu0AgWWCvCZ3r5aK"
-"udYVVR72pGZBEyBM44JCEKA5G4ZCuaJC6+jT4W3Fk-jTE0VAYC1N0mZ3yAZ8zTd-WRd-WRdBWRd3wYW3mSYQlFW35uY31Ce-jFWGjF05tuYCm0ZDE4iUIacC40ZCI82N"
-"MUV34CZCEmiZ4O3CEuRN4S3CEi13Asp14O3EEuH5SW3CvO3EuKZDEuH5Atp1+pk46pk4ESK4+1-PIqQGs5-P0aJGKcn8+-r1z-b3uT21raZ35j67mWZDmWJDrKZhWT03"
-"uC3EuumTAG0Dvu0LDQvdWGWCrawj8SJDvu0VCOzytuV4JOS4JuGgA8H7EesR3409cKG2E973IOtLPCY-97GF9ZYDkWJDu0JDoW3CouGOuH0Dneg7pWGDt0Z3jB60tu0X"
-"vGGErefW8nXCu4ZCq83Dmu06CYmDv4ZrpCX-oCXnoCX3zxXXXC60v409+-JHAzJH4SZBI8zU0aZ4ep11pOZ6Q5cbuK07oK3Cn0JDn4Z3ts51mOZdbW10rumDBG0CtuG4"
-"LG0CneTsKulBJuiBJuWqb8dLTuGfH8n4uulSCuZSCuGmq81UnG0CruGgpX0ErCZ4scZcb6W3YwZ58p22qGpD1wjYTR04rGpCpCZ3on54rGZCnGZ3YDXoTRW-iCXniC12"
-"q0ICbAXSd600u4G9IW82+ZQ0+WQ0GSZBvGZCI0ZDOGZCrGpCtaZ4njXbd600pu0bK0nDmapDo4s708ZbwQ02s8ZCEiRQ8aZDnuWwkvmS5fyf1u-AJOyAJGmDWumtgu0w"
-"cP66E81SC00DEmFA+RQ0+OQ0G8ZBqOpCEKRE0CZ3kQ42r8ZCgI190KZ3Vp11mWZ3DUb3sE70r8v5E0YCvaZCpKpDv0Z3bd80qumlieif1uV2JOS2JuW5EuWLNQNf14il"
-"+3oCA1oCOqYDk0pCvOZ3WV12uCpCEuZMIu32Moq008Z33226n8JEqS3CuuG1f8ff1WIDq4JCsSZDtO3DquW9aOD8OuF3JOC3Ju0SDumq19df14G8+tA5ErA5K4ZBoa3E"
-"u81h22WDIKSPoYf1CK3Ct0Z3kx43mKZDvu0qeu8c6GmCsu0Oc1GEECoW40JDXQYoBDW-ACXoAC10nuGrled7O4G9ICzB+tn36rn388ZBoum-QGWDvuG0j1WDEiGFEGH7"
-"Mgb58C3EmuG-C2GEXn41v0Z3h3XZe609t8JEs0ZDnKJCru0oBOzYB8ZzG4G0sWyG+RvdEPvdE8j31NdQEDW3QmNm-wFc684c6WICkGZDrGZCu0pCuuW2JG0DvewEdGWC"
-"ru0xUWmDvKZ3ku51oCZclE20oOnXMmGCpaJDE0+60mZpDDW-hRdohRd6MxeSbdW3+Bc3-la-c6WGc604jWZBn8Z3xC20oum4DnWDpKpCI068Moq0EqdW0WZ3Vd11v4Z4"
-"gLfaPQ06pWJDn4JDuumV12GDEKZGMVQ0+3A463A4EK54wP1Lb8g-MxWJMx0Dj4ZBpWpCs0ZCmCpDmaZ3T3ZgDDW3EF10pu0LBGWDtu01ievc31YDpOJDuOJEsGZ3HgYs"
-"-Zb-iRdoiR70numSU4oggDF104J8ewlCD8bCDu0-NuWxA2WDEyE90SZ3taXbeRa30583p4pDm819A0mCES8GEMf14CpDEKA248JDEqX40OZsBPZ-gRdogRd3mSX3x0YQ"
-"Y6W3+Ed3SBc-lJWHlJ02quYDEmcO0KZ3uC24v8JDoSZhxW00sumF92GEEejM0SZ31kXalJ02rKpDEe3SCSpCnOZ3FHbrHtY-fRdofRd49LXUuRY--ocQ-o64quIEu8Z4"
-"nq05uCJDnKpD9VfbmqW3Wm23r0JEouGlSGmDquGjoeeJ3m0DrCZCESRVCWJCt8Z3FFXrNQW-z1Xnz110ouGUG4Opgzq008Z3xiZ3GLY-GDWGGD0Dnu2Eu4JDp0JEtG3C"
-"s0Z3MjW3AkWbd6W30I61m8Z3nO64t0JCnSZb+WW3E0d31a55u0ZCtKpDEG2BABJ3+diTAdiT0SJuD4CUgTQ0Eu5fXsX7nXdJWZ10t4ox1KY-B7WGB7Gmy2GCEKmH4KJD"
-"EOEb40pCEqdCAYh704Z37N91tSZ35PA1nKZ4IweYkD08rCpCm0ZDt8pDEWmKU-0B+liTAliT0SZ4CYaSY430uuWxs108+VPgETPg1pB0mu0XK2mDEiTSEma4css084JE"
-"sum3UWGErSZ3Rhe3yUcZc60Dn4JEpOJCuSpDqGJCq0ZshkW-W2XnW210u4UCEyB6grs00WJO95A5+Vp52Tp5GKZBvSpDEOe34O3EEqTP40pCgorB8GZDtu0YD0GEEGZD"
-"40ZCEGrLAUQ0EyFC8CJEu8XP5vmCF00FEJH1+diTAdiTESGMwjw2Eu1J1tj-b6WGb6GWkx0O2A1Stu0enwGbTuex40GCEmo80OZ3r-61uGZ4zXaYX606r43Cq4ZDouW5"
-"bHmDt8npGeSj6u-msfyms916g881AuWSDulMEgaMEY0Ck0Z3mb33q43CtuWO3HGDqOvID0HDnGJEs8nXL00DEaSQMIFC44pCEmKKCC3CrOZ3QBZsbsY-yQdqyQd3JXW3"
-"4tWPwf10v8XjG0GC+7f1A5f18aZBpumpY0HEuOpCuuWWkPncoOvEIGnCs0JDqWZ3uZ82nOJCIaahEYq0EiAPEOfC08Z3i-50oODrO0WC+FH86FH8EG3GEGR2gPQ0Iad6"
-"ESQB+hE12fE1Ey8AIqPX0KZ38T51naZ3NrXYfJW3MY75o4ZCmK3CEqId4O3DIsk38SZDuum6H10EEiCUEWpQMhe1+xG86xG8IOHHw1D60OJO4vWtJulUB8aUBGXDk4JD"
-"vGZ3tme3IO62rapCI8S7MYq00KZ3HL43nC3Ctu0NP1WCQUQ0EaVi8apCvumoaoGCr4pDMJfC+xhTExhT00Z36yY39tXTADW4c0h-THYITHY3rW02r0ZDEOrD4W3EECcb"
-"EGuWAoq0EONaCOZCnaZ3XYa5kpWZjJ01oCZ36ve3yh52sK3CXejprWW-H2XnH2X37hg4xcfRa6W3WsY-XFXKXF18su2EsOJDtGJE1ZY3-gg4mGbbCD02pW3DQSKgCKpD"
-"o8Z3mtZZd6GO1H0DruGDhumVQODEIuVlsvSls10DIitLs58F1GY3NWc-pJWGpJ07uuoCt4ZCqCZ4dph43RXfBx01q8J8j11Dm8ZDp81yi9fc60WDE0s54KpCEW+kEOMO"
-"QFF1+3H863H8E03LEyE8grq0ECJ8X5b-wWWGwWW4G424rC3CsaZ3LSb4MPcfc603oaJCpuWyMGHCs4pCqOZ3C9XZDD00oumXznmDuSZDI0xSQ7U2+7746774bbY3BkWQ"
-"d6G1auVJ38LJ34ybCGJCvGZ3VN54m43DnCZcPW9BtKJDqSJEvaJCqCZDEWbKIcq0OG3ErO3Cp0Z3TU30mOnoieyb6uFks9Dks1mCEGE4EKO804Z43UYJUL10muGedum-"
-"nvVy48Ky442f08Z3xx73pW3Cru0EVu0EdeuE8GWCuu0upmGEv0ZCEqDmQc3k8KZCrumsyuWEXW0EtWZ3Zuepa6W-D7ZnD7JPZu-H38+H3u0Fhn1CuKpDqGJEnuWAbwWO"
-"ffee1umV452dCWZCqCJ8t9fH3mWDoSpDEaHb4CJEEmwLQRid0CZ-54Yn5420mOOD8OnhVvFRFg5RF2XCrG3Csump1JWCu4iLI6LOSS3CvapDmSpDECT24C3EEuE3Age1"
-"Ee4LEW1LIy+400Z3wDZp3DW-h1Xnh111naZ3zjW3wQZQdJG0b0WDIG32+ZE16XE1SGZBnGJCrG3DESZmEu3K0WZ4bYXbg601q0Z3P540suGND00CE0LCIkq04K3DEykV"
-"EeZBKO3CpGJDr8DTGu-lsfylsvmSpf7dd8XRG4ya57h-CJZACJZ3GZ85nWZCq4JCEW19CKpDqOZaADW3En81m8Z4mB92oSZCQEgE0OZ3L814m43CtOZ4anbs87d-z5Zn"
-"z5Z3xB31nWZTilX3ah21WaZ3M8H9YwqK8umFNaX8+JS0sGS0S43Dn43DmCJEEi6F0SZ3SWWYlQW3lI36uO3Ct8ZCru0+OO99UvmvQvGTmH0Cru0K73GCMlLA+VjTAVjT"
-"0WZ3m8XUDKW4jPa30rGA4xle1qZeOOZBt8JCqKZ3KzX3hC71v4Z40DZbCq40q8XwT1mCEqOFEeV2QkG18WpDpuWRC2WDEe770aZLEuJLaQZViOYHmvVssfSssvW3c0GC"
-"Ei+6kHh1X2Z3EyGAdMnnH401yyb4UeJ6YuVo1qJo0qY3AK33nSZDpumBDHWDsu0lWOQ2FGmCtuGHRw0noYWDvGZ4yrhY-X08rK3Er8ZDrSJDEmLiUVxe+tlTAtlTEeE6"
-"wXq5QeE6+NsCELsC4SZBEuzD4G3CEOhACOZCpGZhDgg3gW62n0pCE4KD8SZCmevSkm0Ds0pCIqSVGCJEvO3DESScERY2+3B463B4XSg-HgXuHg1GouIDu4pDpCJEtS3D"
-"o8JCnWZ43cYbqO22qOJEE0EPWaJCs4ZCoGpCtOf8AGGEmuGX8vGXc1WDEyzEIBY2+JmTAJmTEOaH04Z30eWQNKW3FQa36fW-zFXGzFX4e1g3vy71vKZ3Jb40suWsMuuN"
-"8mGCqaZCE0f6GKZDpS3EQAeWG43EmW3EIukY4SpDE4U3M7Q0+3B4A3B40KZ3jrWUfHI0bum8XuViseKisuGNbIWDou0iZw09zXmDnOZ4jZXbAD01rCZ3qS70puWfj20C"
-"E0YKIgq00CZ3Wyh3RG70suGozfzCRwl-sfi-s919zetHN0GEEu+2EWW2+lq02jq0EOAU4KpDEeHR4aZDEa-W00ZhVbB1oGZ3XSi3oGHejuGIFuuF80GCEyx7Ee72CGJC"
-"vGJmDhCc6u-0tfy0t1GEEOoAw1r00aZ3VtX-vUYKvUY3rvY3HyW33eZ3FX50vOnu3P9K3WWDrSZ3ZTi3WkZ3yeZcDT10tuGP420CEC5KEu5mQdF1+3J863J8IuCBwXQ0"
-"0SZ-e6WOe602nuYDEmCDGOJEs43EEqV4kMPs8GJCvu0+x1GEEuaU48pDEqO3A+q0COpCmCZ3-Oj3ezW3zDcrWQW-33Xn33X3eFX4czXR2XG0buV3KeL3K0mCEiMX0CZ3"
-"3Z43u8pDsu0eIxmDD00DIoc40KZ3UuB1vWZ34Z10vumTCg9e6W0Co4Z3nn82nGJCEW-bMdQ0+JJ86JJ8I0Ifwnc400Z3t2Z-yicKyic4Sg10sumdM10EEeTb4WZCE8Z6"
-"AoU244pDIeEMKa3DvOpDs8QLV1GCESh480pDquWfXuTMuuF2tfC2tv0xNwmn9e6ZB8nPLvW-EulG8OaG8uWlYH0CrumYl0GEEeZ608Zc5VY3vz89o43EmGpDuKpDou9J"
-"wHGCs81mPIHEtGJEoaZsAua-2Sdr2Sd39xZSWae6Q0Z-CkWKCkW4Op31qWZ3-2c313YgZ815qG3DtK3CEqsE08Z3PtgbyW01sCZ3ROY3tRA3v0JCquW-LuCv9uFVGOCV"
-"G0mCEW1204ZUu-20puWdn8noKwFJ3O5J30YDo4JCqSJEqKZ3PQdbzZ10ou08mvmyF2nDpWJEmuGfrgeE8u0fxWmCqaZ4ZbX338gqHQW-4Sdo4Sd3KHYU9+H0V4m908Z4"
-"xZX-kLXBkL16ou2Dn4JDnumTy21DoSpCtuwXBGGDpuWDFnnCo83Ev4ZCp4SoAQQ0EuhR48pCE4lkESX2Eqs5Alq0+FmTAFmT0KZ3lAaVvS10r46I+79lM59l4qoDISJ5"
-"K83CnS3Dpu0hKvwV7oGDrC3CEaTgKaJCmWJDuuGaiveg1GGDqumcPxW7UW0Dr0Zs6Cf-6Sdr6Sd353eSvWZ4Ebh-wWZKwW32ouIEECqV08Z3gN23oaJEnO1BDR9YBG2D"
-"nCZCsaJEmSZCE86MEKLNAUQ0SKZDsSZCqC3CECFn4KZCXmjpHDW-+4Yo+4Y3ESa3szXRcdG0au0LSuV+4OK+40WDEy1UKGJDs0pDuu06aG0EuegEuG0CvuGFCYWCpCZ3"
-"p5C0revtn1GDEyLpE0zPGSJDqSpCQR+G+hiTAhiTEO+6wru2EuYg+pu2Ynu2e8ZDoS3Dt8JEr83CECPJI6j340JEEe5LWGJEoG3EtGpCmOPv90HDm83En8HViXWCv0Z4"
-"o5Yp9DW-w1Xnw1X-XfXyXf12ruoCES+dCO3Cu8Z4Yf10quQOQmmDoOZDEuEn0OZ4ucWbtJ32s8ZCEK371q62oKZDEaAEERQ0+V746V74ICWRE4g8gzE1I0DOEmm8+du2"
-"6bu24GZBEuia00Z3D-62sa3DESBWEyX4M+M508Z3fcC1rSZ3Ol12ra3CQYQ0ESidEqm3OGZDs8pDu0ZrV8X-ERdoER71v0Y3Zif3qhaPxoY4CMa3uSa-e6WGe603puYC"
-"quGsaIGEquWFYHGDtOndsOvf10GDEyxEEqNAGC3EuSZDEa86Aw320CZ3xw93tOJEmuWwn1WDQRr7+lgTAlgTIej36cj3I0jFQu32MTi8IWJKHCY-QrWBQrW3Ce3BsCJD"
-"vS3Cv83Cp83DEyHFAc+44SpDEm52Eiev00Z3RLZbdO53qO3EruWwjo0DrapC1fZrxxW-W2XnW2X3DSX3HIYTrS10suGeG4w5+RW22PW2OCZBo4ZDs4Z3OkE4pa3DpWZ5"
-"sOYbjk07rGpDua3Et0Z3R521m4Z31xYYlD02q83DEavVE41f4S3EUd6E+xgTAxgTMuPcsXQ0IuHI+VQ0ITQ00OZ31l75oG3DmSJCE8X40CZ52Ddcd600puGpL00CEGsH"
-"04Z3ZXibSZX30t39oGJEr4ZDqWpDnOjnY0WD+NI86NI8IGOAwn27IGOA+JT7MHT7OSZBua3CvSZ3ppZ35RA1m0ZgDe00suGwQ1WCECiDEaWgEmyJE+q08SZCsuW0OHGD"
-"suGPEvm+sfS3AuVasfSasvW+Q1WCES2cgL62Mmx91KY-tJWGtJW3+D31uCZ4PM10ruWeFvG-teuc60GDEuKDEaMQGOJCm8ZDQUNMEKcN0GJu20GDECLp0OZrp0Z-DQdo"
-"DQd3wxZ3AeWQY6G0Z4MR+3Q021Q0EK1z84pDuumRMImCr8n9hhQsnGmCtuWr-IGCuuWFV30DIyWUAcq00KZ3TZ16tC3Es4JCoumiMATG8uVYsfSYsv0e5w0gTecf1um7"
-"Fum1Aulf1Oaf1WWCkGZ3TOi30J64r8JEr4Z5WBbbjk01p0Z358A3n0pCnuG8A8gXKHGDvumLl20CIqSJE4-9E-E1+BA4UBA40KZRc6GYk308+BvwA9vw0qY3ngB0uumR"
-"cnGEs43DEeG+gkl3E4eB8aJDu42h883EpuW17fOJ300DEOwJ0GZ3LDd30ha3g6dpd6W-Z2XnZ2X3RAk36pbUDDW-c6WLc606nuoDvW3EquWlqHWDnuWgcB1mYOPJ30XD"
-"raZDuuWkcoWCpOZDUcxE0GZ4Zci30y33t0JCpeDpsuVPsfSPs912retf1uW6pvFg1O5g1m0EkS3EEWdY0KZ3Gf82sapDo6ag48pCEGnoGWZDna3CEOMVMju20228y8NQ"
-"dX6TVPNOiv3Ck8pCnKJDtaJEr03Ema3Dta3FlaX78mpBVL014e08D401yyL6C048WmJ8jq28q9NPb1YDu0IBj8p608JA0qmAW8tRlH78kz6PbfJB0G28WmZPb56Tr9NP"
-"kC401405y8NPZHtS+O1000I08YYDW838p0YDWqICk4mfLCQ41m2FVvpDW838n0YDWCJ1YG0Fl8LJ0W2Fqb6RqL6P+03FlqW24mpBIv80Go3Te9NPpXsRiHcFpuYDt4JD"
-"pW3CuGpDqK3DmSJCbr2CmC3FlGN5Z83a0m0FiLcPn07Hr83Cq8JDm8JCsG3Eq0pDmmpBLqXDq0GE7I4Ck8JEtSpCtO3EtWZCs4JDsOZrb600ve3U1uVf1OOf10ICq0IC"
-"q0YDWKZRd6G2b0nCWK38ouVg1uJg1mKBmu2CpKpCpO3DqapDq8pCnSZCyuOf1mpDoC3EuS3Em4JCt0pCqaJCIMQ0yG3Es4JDmK3Cp4JDuKZDvCZqb601t0Z-b6Wmb606"
-"v02EW838ouse1WGEWaJPCvVe1OKe1GaDkaJCuaZCq03DrS3Dv03CuSJOB10DIQQ0yCJCmK3Co83CnCJCuS3DmWZac60Fr8ZCvWZCqS3EnGJCtW3DtOjf10GC+RQ02RQ0"
-"S43CWS38n0oCkTQ0K43CWW38n4W9+dq02bq00DZBpa3Ds43CvGZDva3Em03CgEF1yCJCpWJEsW3Cr03Dta3EuaZce60Dn0JCtCpDoO3Cu43EqWZre600ouFg18Cg1GWD"
-"W4icovq01CI8cccJ0eGqo6H05hR8i3GCD8Y-wQGtwIGEk4uce83EpSZCtKJDsGZDg+s0uGJDpOJDu0JCqKpCra3CpOvn1mZDrWJDmapDv03EvSpCsa3DMVS00CZ-77Wm"
-"7708o0ICn0ICu02Do1t004J0c4w6cjS0C838nCJ7ZuFp1q3p1tDDr0JCsCJCm43DmGJEmKZb2Y03nW3CquWj8mXCuO3CsGJCrOvZ3GJCvWJEnOpDv83EsaJDsezZ300D"
-"+ZS02ZS0XncUTRG0Zu-Z3ezZ3WKBouYCpOpDoKJEvKpCnSJCm4JD1-lb870Dt8JDrS3Co0JCuSpCtSZ3mXWYAf03qOJDn4slK8JCsOpCsejIAGmDruFo18Co1W1CW4JD"
-"W83CsbL1C038nOJ0buVE5eKE50pDkGpCoOZCuSpDo8ZCESU20OJ8fQ9g8W3Dq4ZCv8JCmSJCmKZCrKZbEf0BrWJEuK3Dra3EmGJDMCe2c413E4F31GGrxOZoBO2cDGmD"
-"suVg18Sg18XyBumcDeMcD00Dbqi-eYWKeY0FvuoCqWJDnWZCnKJCna3Ep8BKAGJDm03Cr8JEuWJDoaZCmeP65GnCsO3CnSZ3aY03r0JEoeT650mD+ZQ02ZQ00WZ3Qs00"
-"qO7KA00EXWA0quFg1u4g1W2Ck0JCtGJEtapCvuW4A0mDEqx2c0s3LXT01uIFFG3Dv4ZCna3Dv0pDsOJDo4CyAEF1uWpCnKZCuG3EqWZCnCJCvOTFF0mD+BE46BE44W38"
-"E4C4o5-20WZ4xs00nuluGOauGGGBnuGgG4G0SG3Ev4pCmOJC52lbPQ00p4ybWSJDv0ZCtG3En4osAQQ0yKpCt0JDs0ZCuW3DoaZCs0ZrfeW-Z3XnZ312v0IC1RfSd600"
-"vum9AuFy485y4GqDkW3CmCJEq03Et0JEuKpCuaZgNQ0DpKpCtSZCn0pCtWZDqOZbGl0FraZDtCpCr43Cqa3DoCZCouqf1G0FluG5K0mSnTC6yC7TXTMPVbttGDJEk43C"
-"t83EuCZDmKJErS3Cp03FluJ90q81em3SX9NPkHdFvmpBDeG4P0YRbX7T+qICyyI19K-3vlGv7KmLXyd9WI10y8Zd08HJKq0L14G1s4W800Y-A6XnA610r4QR00ZTqn02"
-"r0YD99d5pnW-GnWBGn0HvuIEvGJDrKZCsGpDn4pCu03C1rabqF0Fs4ZDoK3Ep8pCnaZCraZDq8PLCWpCmK3DrCpCm03DtO3CtGZKD9GDRcJs14GEdw-YHOyYH0HEWS38"
-"sOdf1GHCo0oDWCZ3wnW4A6H557H04mpNIGr4P8Y-87WB8704nuICmWZ3eB17v8JDu4JCoaZgi61BrWJCu8JEqW3EoSpD16Yb870CnKJDrS3EmSZDuCJEqeDLJu-gHOyg"
-"H00DbGgS3X12q0IEbKg-HDXGHD1Gnu2CpO3DpW3CqCZCoaZCu4JfvQ9R3WZCrKZCmKZCnG3CoCJDv0ZcGn0AsaZCv4JCtG3Dn4Z3DXXJvMGLdw5R3uFYHOCYHumOH4w5"
-"sXO40CZ3fgW3d-WPlDG09v0K90WCDGY-nDGVn1YDkWZCn4pCn4Z3-Q13u4JCv8HnFO97EGnCsWJDmWJeuHmDvu0gA89S3mJDvC3DvCJCmCJEu43CnWJCIpS0+pO46pO4"
-"4S38E0r4ojH58S38v4E1+JQ06HQ00rYDkW3CrSpCq0JCmGJCp83EfMXbb60EoCpCoCJEo0pCsaJCqWZCQcX3mGpDqSJEo4ZCoW3DmWZsb6W-f5Xnf5HOCv76EK09EG+3"
-"fzc-BDGVBnWCkO3CESE7Wa3EuG3DqW3CrKykMQQ0OCZCrS3DrSZ3D+02vWJDE843EU73qOZDtK3DrSJErG3DmOpDM3g5+RM46RM40KJWn30DXHiP-xH1aON55GmDWuF5"
-"5u5550KDk4ZDmSpCt83CmO3Dm43Do81JAePo1GnDqGpDnOZ3Xn03n0pCpO9X8GIDuGJDqSZCu4ZCEe140WZs86XAdmG01O327u-nWuqnWGGEW4it0SZRkCH0ZumJAuVR"
-"38KR304EkK3CmSJDo4JDrOZDv0pCpuAk6G3Do0pCt4JCnKZCmSZDte9k6GHDo83EmSZ3kt14uOJCqKZquQW-96Xn96X3pr00uu0-8O6R30GEI4130CZ-a6WHa60Ij4ZB"
-"uO3CtWZCvOJEtGpCm4pCqOQbD0WCEeU6W4JEva3DpK3Dou0HTue45GmCt4GBEqR4CGZCvCZrLsW-86Xp86X48kXT9DW4h6X-UXWJUX0GnuIDmCpCvS3Cn8JCoa3DoOJX"
-"lxvpBGpDv0JDmaJDu4JDsK3EsOv0AG3DvWJEr8ZCsaJDrGJCpOzx40GC+FE46FE40SJmv2GDsrq00SZ37d10ru-rKuqrKGZCkC3DtWJEma3Es4ZCvuG-SOQJ3G3DnSJD"
-"nKZDmKZDuW3CvefnPWZDp4pCt43Cu03EtKpCvOZrsr00nu-uGOyuGuWBDuGYI8trKaG9+ZW2IXW2SqYCkW3Eu0ZC1U85v83DvW3DgcA8qK3EsKJCsapDsCJDsK3CQoe4"
-"qG3Cr8ZDsOJCoSZDu4pDQVF104Z-53Xn5311s0Y30NIOARcd60WDEmU64W38+7s9A5s94XZBvG3CrGpDt03DsaZDsKJDpOQK3WHDo4JCnGJCIG591eZauJ0DoCJCuOJD"
-"q0ZDmCZDpSZ3-aYoNq10nuFoGeCoG00CXTi3RGYQe6G2buV5KOL5KuWSRGJEp8pDtCJEoKpCsG3Co89PdWXCtKpCqCZCEqV8C83CqWZbb60Dr83DnKZCrSZDv8pCpSZ3"
-"slWpb6W-X2XnX210qe8f10mD1GY-Z6WLZ60Aou2Co0ZCmO3Cn4Z3Lv10vuweGWHDt8ZCvS3EE8v2C83EoCZbZ21EpOpDt4JEra3CsOpCv0JEMpVB04Z-a2Xoa2X38aY3"
-"gZYRCDG0au0lUu-DD8qDDWXCk4JCta3CE0L5KaZCr03Eq81fGO9x9m0DqOZDIy02KCpDoGJEte9x9u0aB0oCmWpDtO3ErKZsVT10nuVfGOSfGWWDWCJPgecf1uG9P0GC"
-"EC42ISI6+da4gaa48qICkuGmOWoDs0ZCrGZCpG3CteQmUmZCu4pCoKpCn03DsWZDtCpDIgf1OKpCm0JEraZ30a12oK3C1KZprJW-22Xn2212nG38E4k3+DwBEGx2+742"
-"A542aGZBo8pCqGJDuaZ3Cu11oSZ5edWcDD0DpaJEt0JEvaJErOJCp4ZbB5Z4hF10oumQD01Er8pDoOztE0GC+N846N840SJ8+9HOAO6w9KCd08Z3cXW-FDWGFDW3-W05"
-"qCpDr8ZCECI9CWJEtaZb-W02vWJCXw21sCZ43mYbNuX5+L25v43Ep4ZCEW28IVY404Z-32Xn3210uum68OuKb0WC5Vf-oJWHoJG8Z2GDEi2AEK578SZDou0OJOITX82t"
-"R4G0kGL94SpDEm47EO05CO3EoaZcYd00quWsZ0mDEiu2Ca3Dm0J8OhSx40WC+-746-74I412sPj3Ea74Em32+Jq02Hq0O4ZBr4JDo8Z3iT34saZDqSJoI2GDIYq08CpD"
-"nuW4PG0Cru0kGG0Dru9E80pDsWJEt8ZDpKZCsaJCMt7408Z-z1Xoz1X3jLHW7hsw40GCIyi3+h32If32OaZBn8JEpaZ3+e26nKJCqCJDvOArEmpCs4JDnaZDmGJEo4pC"
-"q0JEMg32W83EsSZDsW3Es8nlBOzpT0WC+l746l7400Z4UdWS0520mKij08Z-kJWHkJ0GouYCr4ZCnKJEtSJDvGZCrOZgNSX3-x01t0Z8jeXbDD05pG3Es8JEECf4GOJD"
-"qC3EMNf108Z-v1Xnv110vu0D8ety40GEE8H4+3AAI1AAaq2DkaZDvOJEnWZ3E010ruGV9OQJ3WZDv8pDsKJCtOZCvOZCpGZbeB21qOZ36I26s4pCp03Cp8H2Fuic6uFV"
-"GOCVG0mDXGeUzW00tu0oJ4ym+t32Mr32G83Eoa3CEyWA8G3Eq4YRIs32XL89pSJEoC3En83Et89y4G0Dsum6U0IDnC3Cp43CmKZrt110ou-TGeyTGG0EWumwh8Ny40GC"
-"MmqE+BF1A9F1EiDCWOZDm0ZDra3Cqu0PfG0EoOwI3WpCpS3DvWpCvOZDpK3CrKZbV812rCJDXGD7t8ZCrWpDrWZrls10ouFUGOCUG00C6UQ0XWi-+WWK+W04puYCqKZ4"
-"6i27uC3CpWpCtWZfb60DrCZCr43EvWZCuWpDoOZ3oGYYlsX3BJ20suW0u0nDqSZDnejtm0WC+V746V74I0eCE8Y4gLU20WZ3TH10suWZBuFqE85qEmGCt8pCIC7C04Z3"
-"YgZa8k04sWpCtOZ3Ww00nuWi90mCMk32KGpDrGpCmuGJ0n0Dv8ZDEK-4EFf1+F74EF744G38Eqg3o9Q01-80quVBDOKBDmZCkaZCrSJEq0ZDvKJEt0pCM0oAQsI3OKpD"
-"o03EtWZ3Do22v83EQYX4Eq8CG0ZCm03DIm62MxRG08Z-r1Xpr1X31HYSKQW39HJ8AxlH3OaH3mXCk8ZCqGZCnuWF61HCpW3Du8Xt9Off1u0kWW2DoSJCpK3DsSJDoOvA"
-"D0mCEiFBGO3Dm0JCXbB0nOzAD0mC+Z746Z74Ey2C13dQBD00tKsI+-9BAz9B4KZBEydAOK3CvOZDv4Z3nYXgSA24r0pDmWZ38G24oO3DmOZcSA21n8Z3Q148o0pCtKZD"
-"pCZCMJLA0CZ-u1Xnu110pumNB0GCwPLAEGQ7Ea3CnagCODH01G0FV5GI0OZ4zUZ-49XG4911muY3OM22oaZDXk13uOZDve9R3u0AaGYDm8JCtWJDtCZDMgK3I8zC04Z3"
-"n744nG3DuaZrox00pu-bGOybG0WDMO32ojW95G20pumUQ8XM8uKn10GEECp6PCY-SgXBSg14su2DnGZ3r717v8ZCtWZCuaZgbe05t43DrK3EE83CG0ZCs43EMAr5OGJD"
-"uGJCvSZ3o032tSZCEyL6AB820CZ-z2Xnz2X3Rea3TgXSC7G0bO1n1bIp+hQ0zeA0pu0CcWGEvKZ3Vx03p83CrOnNvOfdQGGDp8XPcW1Co8pCvaJEEyM8Ewy20GZ3XT41"
-"saZ3vH11vOZ3hSapf6W-+2Xn+2X4Qg13n838uucu60WCX9b4-ZX-f6WGf6W3zZ10uuGwMm1Dv83CuO3DnePX8GWCquGwLu0sJ0HDoS3EtevGAHHCs0ZCoOZ3Ny03r8JE"
-"sOTK+0mC+3C463C44S3818WSCDW3ZEZ3xXa-X6WGX601nuIWlInDq0JDpKZ3v320s8XAAOfI3WpCuWZDuaJCv0JCqapCmSZc4I21tOZ3pn11maZ33c21qSZrzZ10puVl"
-"GuSlG0WCEyb7oPQ0Eat504Z30CY-d6WGd60Dj4ZBsC3Ct0JEmG3Cv4Z3FCagt42DpC3EvGJDu0ZDm8ZDqKZcDG10r4IdW03Ct4JDmOJDm4w9EBF1+3C463C4E8-B08ZT"
-"s4I0Z0GCE4G6IG62+Vf1TV95ou2DrGZDI8LJKOpCnW3EmeAG8W3Ds0JCq4pCv0JDs83CrSZbAG1DsC3Et83DsW3Dt4JDoSZ3g5Ypb6W-23Xp23X3tAYSLQW38n10numt"
-"nuVf1uJf1umJ-00DE0C64aJEEy848KJEr817hOv0ruWBP00EEyX2K4JEnOJCvOP7FG3Dn83CpaZDmSpDsCZCv4WQERQ0+FC46FC4XX20pO7psGGCm812K00D+JC46HC4"
-"IOJ81sE3v0ZCmum3f00EIc058G3EtumS3X1CnWZCp03DE0OCAwT24S3CEuT5E0VF8CZCtuz4w00D+xB46xB40GZ3SgX3qhYQ-2X4uda-lqWKlq01nuY3fE55q03CrK3E"
-"EKnAMGXEMk320KZ3Ke06rCZCs4pDru03X89eQ0WCEerCWG3DvKZDm4ZDruW2ReCI300D+3C463C4EiJFw9r504Z3SlZ3EuX-lJWHlJW4R212t0JCEaJ8Eic6EW-HAA47"
-"C43DvWZ33y06tSpCqO3DoePhL0WCEKM8GOpDrSJCEq05MNy90GZ-R2XnR2X5hMXSLDZ37GX-X6WPX603vK3CrumZE00EEm6K0OZagJ0Dm83DuapCp4JEoC3DoKZcX60D"
-"qaJEvWJCs4JCvOpDmWZsl850quVSGOTSG8ni9usw4uGSGum+9uVIueKIu00DEGY90aZ4ke10muWMN0GDImQ5QI32CGZDqOZ36035qCJErSJDMEvE4G3CE8i3O8JEmSJC"
-"oCZtQn50quVSGOSSGuGDkum+qeca64Si08Z30Na-QdWFQd03tuICtuWLdGGEsumqtWGDs4Z4SQZbHQW3oZ19mKZDvK3CmaZCp4sWAY328K3Esu01ZW1EuSpCvSpDQ774"
-"0GZ-n1Xnn1X4yt50suGF8esf1KG90CJ0b0WC+dQ0+aQ01J93tGJCuuWkq8HBkum7Ve8b60XDuS3Dnu0UuG0Dmu0-MOPSG00DE8A4C8pDvWZ3SN10p46jER32+7746774"
-"EKKO443DsLI31GInPMYeEvo5ESH6E8AN+lW7AjW7XOC4nSZCrGZ3I945nSJCoapDIch1EidDeOpDs03DmO3DvGJCMgo58KpCq4cPXaC3tOJEvOzXG10D+-846-8484ZD"
-"Wu0ixumAy0GCcLQ01KY4QhLA930F+FnOcCnOESK3EaNL4KJDEiRH8W3DsOvNuG1Ds8ZDtaZ3Gh13p4JEqu0yMeu35u01jWGEmGZ3WS52oS3EEqGBEhs0+x846x84EGk3"
-"04Z4gSXQa6G0buWpOaYeEjs0I8dKPCY-57WE5701m0Z35422m8JDEqRHMMn8GKpCqOJCESLOECk80SZ31zWY5700puWbrmGDpWZDEScJ0GZ3IQYp57W-j2Xnj2X42rW3"
-"M9XQ47W43fW381Z-xXWGxX03ou2CnuWQf01CtG3DpumnDfwHN00DE0dJCC3CmOZ3h940u4MeAUQ0qK3EoGpCmGZCoC3Cs0ZDEGT3AVQ00KZ-p2Xqp2X5hxWQd600q4cZ"
-"E0C9fnc-9DGV9vmwnWmCrGZ3uI21o0Z3EV20ueg1e0GCIWb244JCE00300Z3s6ZYd608oWJDs43DvapDbMe3FA10o92vfvm6L501LoaDMZa9AD50ru-iGOyiG81D8eN6"
-"ZK09E0-2+VQ02TQ04CZBXr40quWPA1GDEyrHkQRHmG3EpWJCs8JErWZDo4Z4FSZYd602raJDEC37OSJCmSZDvOZ30hbpd6W-u2Xnu2X32PYUc6W3LKb-b6WKb606jKZB"
-"nGJDmumdDvW6-WGEmKZglr00uuWjFX0CoaZ3iM10u8nVafef1G1DtGJCq4Z3Pa53nSZDn4cWERQ0+tB46tB40aZ3Eta3sxWQqJW3ekW4XtX-SQWHSQ05jGZBqSpCE0V4"
-"EOJD8aZCpOHusO96F0XCmCpCvu0SA1mDE0ZPQsB4CKpCpSZ39TX5om50oOTek0GD+tB46tB4ECj8EinFgXQ00KZ4SQb-QtbIQt58nuIEs83EqS3CIynHEyNHckf1OGJD"
-"t4ZDpCZ3+H52tGZDEqNHAwq0EyDPaWZDp8JCuC3CtGZ3nQYpEDW-z2Xoz2X371ZUc603n438m4If+tq06rq04KZBEK4J1YF6nKpCnCZCquAus0YCt4JCmWJCr0Z3p3cc"
-"LB23oW3Dr46lKS3EuWpDneDCX0GD+-B46-B4XnaUNTK0ZOYcQ8o194H04mpN53U6YuV2AeI2Aum-s0JCnGZDmGJCtK3Cv0pDImaEM2T5ESTJ0CZ3Bg35rWZCv4ZDMQe4"
-"CKpDnWZ3La31saZ30t00qODVh0GD+3C4A3C4IqX9w1mD1KY37AX-NKWINK04vuoCt8JGz3HCvS3CqumQSOw55mGDo8JDEycPKWJCo8JCmu09Deu55u0dH5wXCOJCsCZ3"
-"YAXqb340ruVnGuSnG0GCEyf6o5I6IuS5+3r0I1r0GOZBmK3CEmaRC8pCqCZ3GdbgGD00rumQhHWDuumpsWmCq4ZcN832pCJCE0TDOaJEqaZCoOZtPrW-d2Xnd2X4tlZU"
-"CeW4tlZ-d6WKd601ruY3MF12rKJC1s80pumSk4cJQUF1EatHGKJEuOJCE40H0OZbp+11s8JWo3GCECZS0OZ30eYqED00su-fGOyfG0GCE8R504Z3U8ZQCeG1b81Mw8cs"
-"LKooPCY-2RGt2xmrVm0DsG3DEyv2CKpDnKZ3EaXY3bX3Ul3AuKJCuO3Du43DtKZbPjY3l312nGpCEqnG8OpDqeTsL0WD+RC4ARC4EOoD+jY2E8Z7Xrc-KGXGKGX4Wa10"
-"muGyb0HDmGJCsuWuV898P0nDtWZDru0HM1HDpC3Dnu0fVeuj6m0DuSZDEyLB8CJDmuG6l0WDMds0+BC46BC4EOzCwPR5EWmI+NR5ULR5COZCvGZ31p24pWJDtWZinu42"
-"oW3EECL6KaJDmSZCvuWLCfOf1GGDuum1Tn1Do0JEtGpDpuWupfySD0WD+7C467C4E0U2XoWSXCI0buV1AeL1A0HBru2Cru0YQ0GCEasMEWDNgQW28CJDouWdVuWA8mGC"
-"uWZCQ+w2EKOTG03Et4JDEi45EiQ3EhQ0+BC4EBC4Eiw2oXQ00KJPmv-gBeqgBWGBruY3QH54s83Cv0Z3d+41rKZg5a14sW3Dn0Z3zv54v8JCrOZcig11qKZ3pdb3Mm01"
-"sKZ3rLZrrJW-33Xn3310v8H219tgB0GEIKR5+hC9AfC9Gq2DkKpDESgD04Z4fYc3o3ef4eW3vc50ru0ZzuWfz10DQkw24K3DEel31gF0ruGi2PzL41WD+BC46BC44W38"
-"EaRAoPQ00WZ3Xdb-ggXKgg12jSZBEesJESDG4WpCIq+LIO5HMkw2CCpCsWZ3tY65oaJEo0JEUANPEeS8WapDn83CsOZDr4WQEFF1+BA46BA4EmsS1MlQfkGAAx-y4uqy"
-"4uWpK1mCEWYUKOZCoOZDp8BOWXoCq8ZCnOJCmGZCsu0sYOPKD0GDE82V04Z3ie73tOJDmeDj2v-56gy5620CEaa9wLGBICPVEKC4+lu26ju28WZBr4YQIyPFE4dB08Zg"
-"tM10suGg42ICo0JCoWZDp4Z3NaaYhd02qG3EEu6XSWJEmOpDuG3CQ3v2+3A463A404Z4KwbUX2H0buGjBu-d6eqd6mHCkSZCtSZCtuGJI01EpGJEo8HIIOPED0IDp0pD"
-"rW3CoCZ34Y00oeP21AnTT1IDoaJEmOZCt8Z3gJYotJ00tuleG8jeG00EEq6Eo1g10SJ0YuWXNulK3OaK3u0WGm1EnaJEs0JEpuGfevGGQe8WGWXDuKpDqK3EEmYU0WZ3"
-"ULcav7Z3ed01rWZ3g932uCZCIKDQEJQ0+384A384+tq0wtq05-90uuWoX1nDu4JEpuGTqv0x9OfJ300DE08U4KJCECLP0aZ3V4Yag602rCZDEGUR8aJDpum1CeD261mD"
-"+V846V8404Z3hjYVsJW30Ba3g8X5lFX-CFXACF16puoCnSpDnu0riuG4hGGCvKidMoU2ESZCGSJEuSJDEWeN0CZcJkW3Kl75tK3Cn0pDIaGEMdJ30SZ-92Xn9210t4of"
+static sybie::datain::DataItem item1("haarcascade_frontalface_alt_new.xml",1,
+"tuoCoCZ39Q11vKZ3k111tCJX6wmMF0YDma3Dpa3Dv8Z36A10ru0r8uVn0uIn00nCW4ZBm40OKSJEvKZDq4CAECC3Ixa04KZBEiH2KKJDnS3Cs4QI0WJWXqs48CpCmuGs"
+"A44M0aJ1RxlJ2qbJIWm5W43Cr0ZDuaJEt4Wo4SJD1GcqSI05ou2Eo4ZDE8044O3DMi43Dv48rK3DvGpDoKpDIm77+324+0240KZ4qw12mWpCE0O3OCJCqO3CrOZvE907"
+"vuICoaJEp0Z3k614uSJEr4JAAI1DkOJEtGZ3X016o4JEn4ZDouVd4uJd4GaDWqoCkOJDta3Cra3CuSZDt4Z5+fXqA60Csu2Co8ZDt0ZCsa3Cnu0tT42r1za3jC19v8JE"
+"q83CqSJCnOX3Ku-J2qrJb3B7oK3DraZCmOZ3pqX3A2Xt1M15ruYDnCZCEm86443DEif30OJOU5GnCW3DrKZ4S011mWZ3QyX4CYW-53G7530E5V2AtWZDqWZDvWpCoaJh"
+"18zmAGYCk8ZDnOJCnaZDI8330WZ5B0Hu3W2CmGJEsWJCsOpCr40vXjY-53G753GEE4O54GJC1pE4vaJEmOZ3VYXt3422qu2CE0S504JmE31CqaJCoKGhO0IDkWZCuWZ3"
+"Sn05oC3DqapDIKD2+JC0TGC0s8X2NWpDnS3Du4pDuWZCqS3EoCJOEAjO54OdeSZCrCJEpSpDo4ZCQK3300Y52713rSpDtuGKCWmCrCJXqwVY1aJY0OJHn2ICpO3ErW3D"
+"vCZ4zfG04BTJ2GIDk0pDqS3Dn83DEya2EmL31PJm7oWCpOJCEyM3K83CtOJCvuFn0u3n00WCEuI7uWJCsW3CqaJCtKZCv8ZCr4kJIdO0I4O5a03CsWZCqGJEpGZ70128"
+"quoCraZDv8JEE0g38KZCpuVrDuJrDGaDp02Ek4pCmCZDmCJEqSJCs8Z5QyXq4302quIDXG82p0JCEKi640pCfc44WSZBs0Z3McGOlm0Ct8JE+l91+i914O3DXgD2mKZD"
+"Emt5KS3Dq0pCtOEHMWJDk83DmG3CuSpDu4JEmOJSMZGCkWJI911CqOZDn4mQ1Hc-HCGVH0GDEmJ9S4pCvCJCvOJDEiR60GZvwz15ruYCmapCEGm58OJCsummDaCwW8ZB"
+"pCZCmSJCv8HhCGmCuuFJ284J20WDESg5mG3DrSJDvO3EpW3DtGZxf61EqK3Ct0ZCv0JDsK3Dv0pD9GC3puYCsuWUcOIvNuFY1e3Y1OXjUWoCrO3Ev0pDpW3Cnum+Luz8"
+"6GWDk4iPCGZDu0Z3Lq01tKZ6c314quIDpCZ3gT17uSZCoWpCvGZ-53WF53W4sw13vSZCt4eK883Do4WU1GcqVL0DouYDrCZDsGJEqOJDrOZ3siH8p108Emv2a83Ema3E"
+"qWpDuKZ7WSX-ICGVIWGEWOZ3Uf0BoKpDvW3Ct03Dp0pDEKJ2Qh918G3EmuGVBW1EqC3EqaJCQuP9KSZBnC3EsumLPGHDqOpDo8Z-96WF9601t0Z3ZNHOH0YCuKpCr8pD"
+"sOZ432Xq+g04quYCp4Z3Gb13oC3EuumKS4CRbW80tu0AT0ICr8ZCu8pDnGJ9VwFY1a3Y0SJuAvGbGWWDq0Z3aaIOCwm2P8DY1u0iX0GCESw300Z3jq11u0Z68S10p4yW"
+"4GJDEKa5803Ev42f1Dc-43G74BHOc0JEu0ZDn03CnC3CmW3Ck-6244JCEaO4EuE888JDvOXNau0q800DESA61yb3UJ20v81rfuFn0u2n0u0jU0WD1R84v8ZDtKJG281L"
+"P8DJ2WpCkKpCo43Et03DqOZCmKZ6eLHOK3XDuOpCvu0CE00CE4k6Im53+ZO0zWe4qw1BnC3DmO3DvSJEuKJCEW99UxL1y8ZBuGZCpKpCuW3Cq0JDq8Z5ZIHHa13Et03C"
+"uWJCm03DpCpC+NC0+KC00KZ3Aq06s8ZCu43Cu4uL8SZCtKgNIBn0KOZBuWpCsuGzjGHEp0ZDsGZ5q9Y4ne10o4QTXFB0qu09Lul43eZ438H2N01CnO3CpuGmMu0Gb0GC"
+"Imw4INC004Z4jl10v4io4WpDEW09XGT8AYWCoGZ4Tl01tKZ3nWHo-x-J2qrJEuWBEmP94WJCEeX6C43Cv4Z4xmYq4306ruYCv03Eq42s8KJEvumbO4YSEu77CapCpWZ3"
+"-fX3t4Z5PgY-43WB4300uuWHCu0YEGmDnuWhJ0XCs03En4u-INC0SOZBqa3EuK3DXWD1mWZ3WtH15p3DkGZDmGJEvW3EoOJEu0JDMav2+dO0zae4FuY3IL26rWJErapC"
+"t4eN1idq53W3ad08mGpCu43Dq83CImB55KC4ruoCuWZ3JG20suGmHumSS4m5+NC0PKC1u0J8A2nCuC3CpumXBWWCrKZ3yxWtTI08tuIDoWJEq43CXVF3mOJEm4WIXXD4"
+"u0JCo4Z3+1X4dnX5RkW-53G75xWjUWGEpOJ1UH1Dq8ZDqOZ4lrWq960FruoCpKJCsK3ErWZCsWpDpKMN1hE4oOJCq8Z4M123pC3DvuVvnuJvnW4Eo02Ek83EmOZCrKZD"
+"sW3Dm4pDcBn0CGZBrWZ3Rx04m8JEs4Z3+JZ38iGWR6mpE4FD1L61qSZ5BGX-86GF8YmCWqY58S16r03Co4ZCsuG0M4KiQFu28KJEo8HulW1DnSZDqWpCMqG3GKZBoCpC"
+"E4q488JEpumMUKsSYLC00npBtLMOhD4RXDtSfPMQb9tScWTDcGTDGmJRXXtL1S28lLdRqv3EmmpBo410Q4bDKnpSq5sPbH5QoLsSez6RavpCkaJCmSZ3n032s0JDE076"
+"8CJPh4GYwS20HuZF82G3O008TWO01O8NsG2Eq0oDk83CmOJDEi06Eyf240ZCXxkqkB04puYCrWZ48Q20vu0bNqgwX7g3we07u0JEsW3ErOZ-rzYGrz21uKJWtvWAUWID"
+"ua3CuO3CuKJDr8U060HDkWpCuKw9KGJEuO3Et8ngB4in8KpCt4qx8SJDv4y2M0N5+-k0TzE0s42AKK3EmKZCuumTlmWCnGJC1vkqTg00r8nUUW0EnSZ3XgX3WjG8J70n"
+"GWJCoGZCEec3G0pDtaJCM0CE+JC0TGC3t0oDkuG6vGGCv81JDGmCsOn9j8TJ20YCkK3Cn0JDn4Z35k20muGOg4Sh00Y3jzX3fg00tuGy9m0CnKJCEeK3+JC0kGC0Ie-3"
+"48JCEGk5S0JDoKpDtWJD5sYs53W3-pX5WJ12qGpDDPZ3cmW3Mj01m8Z3rjG0P4ah+NC0kKC00aJ89I0Do81wOG1DoK3DpSZ4RUZq430ApuIErK3Ct0JEt8J8wHWCtaIY"
+"COZBo8Z3z332vOJCEesC4apC+dO0waO0Ca3CW8Z3k-Y3tg10puGcWWGDo8Zu+211ruY3Ks01mWZ3JZ20quWDkKGhIif2e8pCrSJEmaZDta3DQiA5+7n0v511v4Z3fp03"
+"mCJEsuG4BG1EpCZCtSJ9-8TY1GWCkuWDFWHCoa3Dt03EEym4nd89q4JCsSZDtO3DqumrG00C5lj-53G753WCXd81oaZ3DR30vuGGSuW7l40PQNC00CJGDv0eaumJT00C"
+"bFTOIGmCsu0Zl0GEEKEFEOeCIm33+NC0TKi33S20ouGWTGWDvu0Xo0WDEi47U747WCZBu03Dn4ZCv42Y4a3CMy2E1GC9t8JEs0ZDnKJCr8XKpKgT+JC0TGi38u38qOJD"
+"q83EmC3EEOH24GJE1Xis8600rumiEGoDvKZDpKZCoCpCMur2EqJBIig2K4pCvKJCnu-868q860GEIGr744ZCEa5408Z3LE21sCZ5gBZseR01vaZ3d337uCJEnWpDs8Z5"
+"zyH8W2HDn4JDuu08ymGDm8ZCIq02+dO0kaO00OJOIGpCuCZDm83CpS3CvGJDpKu-IhO0KKZBsWJCp4wH4OpDEa85MitFESH9mCZDrWZDvO3DnC3Cq0Z-epWFep01vSZ3"
+"sa01taZ3Nk20vumvt8XAEuThD0ICkGJEnCJCt0JXjJmCteXKfmGDkCpD12Z33Q13n4ZDuaIe+Fn0zD12u0IBE8K844JEEm1FKaJDv8JDoK8dI-a00CZ33M32q8JEE4cA"
+"CS3Dm4Z6EY23ruIDtum7q0nDp4ZDtumJZuFd4u3d40GE1KC2vWZC5V25uCJDnKpDbzeqF908suoDrWJDmaZCEug28S3DoaWhEOS3EuJB0GZ4Me02s0pDMOdD+hO0re82"
+"q03CE8+6eWJCrC3CvS3DmO3CXwXtBu31ruY3qaW3MP32uS3C1QIYTw0okuWQVW1Eu0ZCtKpD+Zz0+Wz04G3CIiWFEKD84KJDEGqFC0pCqGJvb1WCEVXAEuzFEK18403D"
+"EWg24KJEIC1A1R27pC3CmOpDoSZ3eQY-OIXGOI12q0ZC1v42sa3CEC9H0SZ3UJZ3yXWtA603nuIEsuWpDmGErSZDEiECMWl4Eay9G4JEpOJCEyH3GGJCq0ZDXpa-E9WB"
+"E9W3hU12vSpD1V82sWZDXC40puWx88j43m0DkOpD5La3pa12m8pCQC72SSZBm03Epa3EEa780CJu74qh+JC0kGC00GZ3wL23pC3Cp4Am04Z3E611o0JWxejJ20GCEaRE"
+"OOJEsK3DuGZ7C6I8921Cq4ZDoum5lGmDt4-n+Vz0zTD2r0IEEqX88GJCmuWwBmWDrGpDISD2IJC0CKZBnGZ3Le33n43CquWIn0WCISF3Ei3CEKT9CC3CrOZ38V10ruFq"
+"+e3q+W1DmO38vuoCEG14Ga3EsC3EEqqCIaw5UJY1C0JDqWZ32+34nOJCqOJTH00DEGUBWa3Cp8ZDp0JEoO1xquFY1q3YIaw5EmRF0KZ32X20nuWIe44iIZO0eGZBuWZD"
+"o4ZCmK3CE4DI0OZ40-Y4c920uu0abm0ErOZDEOSC9-l-43G7430EEGw88KJEqu0r0v0BlWGDvCZ3ItWq86W3itY3ua01mSZ3VcY3J3Y4V018puYCq0JEpa3CEeH7EidH"
+"5hZ-43G74ZHEWqIDk0ZDEiPD4W3EEKNH4OJCkNz0E8+H88JCvu0zXKD3EKu2E8V20GZ3he23sK3CsuFWRe3WRW0Dn0Z3i91AsOJDtGJEuKJEmOZ39SYwDq02q0JDE8fB"
+"KOJDt8ZCsay2EKJ2G4pDvGJDE8-4E853+372+07244JCEmOICSJCoGZ3JW01pKZ4ZfWtcR02quYC1WA8q0ZCsCJDrS3DQqFC4OZBECj2KKpCv8JCrumAja6x+ta0Pr40"
+"neXMFGHDp0ZDvKZ4Oj20nOk-m0XCkaJCpuGeAWHCs4pCqO3DMiO81ra36f33tWpDsuWjrG0EvKQT+NC0TKC0pu0S8WGCvGZ37V23m43DnKIZUZ430SZ3Kt27taJEv43D"
+"pOZ3hOY3XxW3+g0BuKZDmC3CvGJCm0JEEyc8Xvk-53G75B1ikWmCr8Z3bL44rKJEv8Z3jsYt5300oumGM0WCEyZI48JE1ff8Dq01oKZ3SoX3NhY5oFY-53WE5305r02D"
+"k03EE4y94aJCEO5J0SZ5hZWtaO01t0J0+o0EoGpCE8V4XuW3CV12oSpDEWLH4CJEECAA4WJDX6i-96WB9600suWbEGHDq0ZDuOZ3HmIG9BHqI8Tn00oDk0JEvS3CtSJW"
+"OYmCuSZ4l4HGEXGDtKZ3PSY4JbG0VuVY1eJY10mDbD15q4JDqG3CEe43C4pCuWZ33kWqgR02qu2CEee70OJmmv02G0mDb5i34PX3uhZ35M15s0pCqK3D+hO0+eO00WZ4"
+"nH13oGJCnu0dGmGDtGZDcdO04GZBEqk508Z3b9Y3X+00u8HRt4aJ4SZDE8U380pDs81tg00Ebvk-NFGVNxWhkm0Dn43DES0DXa80o8V+wm0Dq83EE0uA48JDEyy29xW3"
+"dV30vu0+Gm1CmKJDp4pCn8XjPuFn0q1n08Jujwm3Q4Ug0SZ30L31v4Z36nWqhY30qu0xRumG7HGEnK8djPD3ru2EtumHHHWCsuGRD0GEwTG72R670GZ3ar42tuIEEiN7"
+"0CZ3nF21sOZ34yWtkU02puoDEu+HEyhKGOJEqSZDIyP6X517rWJDoOJDtKZ3S851pWJ9cuVY1uIY181k5vmhPG0DmuGbJmWDoC3DIGm9INf3SSZBoKpCn0pCESD64SZC"
+"EGUD1Ie3iw02mCJDEyaEKCJEvO3DouFmAu3mA0WCEWm50KZ39x37papDtGZCo4Z5AdYq43W3wDX3iw23v4ZDnu0ga0mDECw3Xa85v03CoC3EEusBGOJDn4ZC1zg-96WB"
+"96W38S10pumvBWGCvKZ398Y3rNI8+uifH81bEWWCnCZ3RzY3tI10tKuWEmi4C03EuGZ3q144tSJDq0Z4nuW-43WB43W3Bu33oaZDouGrBvWqvWmDnOJG28DY1WGDkCZ3"
+"bT30puWNGH0Cqu0DJ4Y3XX20nuGe91GCEeK2EyPKbFi-ULGkU1WCbpA1nKZ32e42vaZDECGF40ZC1idq5305ou2DmW3DEerB08JGN20CI8G51r40nums6XmCtaZ3lt21"
+"qCZ4ouW-53WB53Gviw0n8XGCuWJWsW0CmaJf3BTn0uGmGXmCrWZ4Uk13sSJDsaqDECZEEuLF00Z3tL23r03EpO19DulY1qZY0WZ3kHX30X14saZDnWZ3PWW43qaq4302"
+"quICEKL684JEtuGQBGmDm81Sj4EhEei4843Do4UIE8bB+Rz0+Oz0EeWF0CZ3-mW3NY53oSZDpOn388DD9uW9Wm0Coa3EEis20aZ3AYIQM3mCI4EFEiHG443DEGeHMiK2"
+"+ZO0vWe3ar41ouY3Ow41mWZ3KL42u8JDo7a50SZ4HcY3cX51tOZAZn20numPDW0CtGZ31-00qulQ3vZQ3X0Dp4Z3uI11mKZ3UN10vuWxBuGsv4uE08ZpWL02nuIEEKt7"
+"WW3CqS3ErSZCuqaJCKZBnOZ4KT46vS3Dv8JEuKsS+hO0keO008Z36s05r4JCrG3EEuDBEul3Yl91OGZBqGpDr0Z3Bk10oumnGPnhdm08suoCE8Q4EuNJ0aZ3wOb5J4Z-"
+"E9GNE1mCXae3oL59qSJEqKJDoCZCrOUY1GWCku0UmWWCt0Z3LE31v0Z6sGLmymmDtC3DE4R9EqC50SZ4+iX-53WB53W4Qz04q4JCr4Z3LS54q8pDpSJ9jBDd4uWmg8ny"
+"HmWCuaJCEehBEOL31hE0su0rqumdM5OjQ0TH+hO0ze80rumiFvWvvGXCm4pDqCZ3jS20ruGDEuTd4GmCmuGsEXHEn03ErWJCQqe8CCZBrGZ3ELa3at03qK3CruV96uJ9"
+"68HPD1GEEi+408Z3U513oaJEnKmOIJC0OGZBnCZCsaZ3MPZ3va20veXeR0IDkOZDt83Dp0Z3vi51r8Z-BDZFBD35qCpDWqYDEGRA0GZ3J210uu0XG00EIuL40CZpSI01"
+"vuY3rZ22oCpCE8PMCKJCu0J8J3WC1o93vWZDsuG-jmGDqSpC+ht7+et70GZ3cra3q067tGpDoaJDo0Z3DF20mKmUMNC0ECo9GGJEoG3EEiqH0OZ5NW13WKZBmumNn0oD"
+"nOZDoa3CoWZ5bqW-JCGVJ0GEXr81o4Z4lz20o8XIC8nuL8TY1uWhIHWDsuWCR1WD5oe6HY13suYCouG7D4WNC8JDsGZ4xKY-43G74xWPD10DXy38v0JDu8ZCsa3DEatE"
+"UVf308Z3Bi02qKpDEiF30KZ3rXLmm5QO84pCt4y-KGZDs8pDuOnWtuVn0uIn04u-483DE05J4a3DECQB4KpDIGo2IdO0EC9Em0pDt0pDtC3EuSZDpGZ4bdW3ua06o4pD"
+"tOJEmuGErGWDou-B4fpB410DEOMJO4ZBsCJDvSZ3yi12p83DESb3U-N58SZBt46sEqt700Z3ZZX6pX0CquYDuKZCv4JEqKJEp4YAXDd-96WB9600puWVQWICsOJCmapC"
+"mCJEqenWG8DO5GHDkGpDuaZ33MX4AA20teHCJ00DEyj68CpDpumFCHmDuuGKuuWwDulr3adr4G3DE4mC0GZ35w32mSJCEe224C3CXWes4301pCZ3KvZ38520num4T5WI"
+"1ra33p15oGJEr4ZDEafL08Z-86WF86Gvj22Ev0JEtCZCq0Z3cq40mKwNIBn04OZBE8YA08Z3LbX3Tx40m8XfF8XqDmWCsKZDImLFG43Cv83DEqx3+dO0kaO00OZ3cs11"
+"pCZ3+d00rumtaeXAf8z86GGDku0rOuWHnGXDn0ZCs0J9Jx0yT4c7C83CpKZ3iyb3GXJQofo-cvEkc10DEOMJ4SZBEKO7EyQHCCJDuKZ3n6Xven10tuWBPHGCuu0Qdvmg"
+"2vn1NuGWBWnDpWZDn4ZCEKTH5Ah-ICGVI8XNsG1DvKpCv4Z3Rd20ouWk75aiIxa08CZBmum5BnGCmCJC1kE0tOHWE4kI4KJEEuKK00Z4NG21nOJ8cuVn0uIn00GEEOL6"
+"08Z3re20numtLumv310EYdk1SOZBsCpCvK3E1ei3PXW40yHOJ0WDEWtGEGRDEeg80CZ-FqWFFqW3dr4CnuoDvW3EqC3CpCZDnuGhbv0sF8jY1GWDkumO1vmIDHXCpOZD"
+"m8JBAwmPDHmDn4yFKOpDm4pCrOHjbu-J2arJ0KZ3tw13tWZDmu0CbH1CvWZDvSZvotX3+IZ3ku50uum3a00CEKbK1xW3cA41nKZ3I+10ru0TpG0Dtu-j5fpj5H0Dru03"
+"+0XDt4JDpumERXmDqKJmiujD9uWQ3X0DoKZ3uv43qW3DmO1Rt40nCapDtCZ3Ue11u8Z3kGa-jUWFjU00r81NFGGDp8X-gmmDq8pCEW0LXtaqXL00t46N0WZ33g33nS3C"
+"puWo8LIYWGZBuOJCr0JDmumeY0GDEaNL1SX-D9GND10DEuG3CaJCuaZ3oLKeD30CM4UJI-w10CZ4ms41o8Z4cE62tG3CYmX608Z39D12qS3EESuP4W3Df7W-53G753GD"
+"EOE40CZ3EPb3JPb4CeKnXAzr3u021n1EvO3EmK3Cq4uAM0K61Pc3Ce52pSZCE4u7UCjP+NC0TKi3ZPIAZZmCt8Z32gHAe8TY1W0DkKZ3wt24m43DrCZ3IP20uKqD1Ah3"
+"Ol29ta3CuapDpOJEpKm5+JC0TGC0t8nsauW1h11CnG3CqumXn8HBY8z430GCEGIC1kX3pq12sGJCQKu2CKZBnaZ4t+06v83EsaJDsaKP+NC0TKSvlYWCpOZ3P943vKpC"
+"nu01S5kJIxa0EKw6E4T3S0JCuSpCtSJEMCYA802DkuWZLu0vDGGCsu0iKvFOme3OmG0DrumlrG0DpuGIAvmkWuWVa81QXejJ2uWiVHWCnu0qBmGDoKJDM4I2ECV74a3E"
+"E4rJCW3CqKJbpwVY1aJYEKMJKaZBpG3Erumnf1GDEuQM4C3EE4c2INC08CZBruGOVuGXquW9C10CYqV2SCZDs0JCtWJCECSOEqg5+7M1s4M10OZ39m10tuGQ3vm5G10E"
+"E0-CIe43IBn0OGZBv4ZCnaZ36M14sOJDoKZ5I6X36R23nKZCuuG-WvmlA0GE+ta0+qa0EKMJ44ZBESc4EmEMEup280ZDnuGA88j43GmCk464EqeG48pDEOmA0SZ3PWHG"
+"EHmCtumwDGWCuum-bHWCsOn4AulJ2qbJGC38tu2EEqbCEa5JG0JEuKpCbgjqD9W3Iua4j+41mCZ3D6b93lY32I66pKJCmGJEqumdL87O5eC3+0GCXCdZDuZ3XfY3Z762"
+"n8ZDEyz8EilB0iY3FmW-DuZUDu32qO3DEqkNEyFNCKJDoOZ39F51pWZ4LaWqh8W3G+42oK3EEGqLGaZCraZDImw2Ey-340JDE0JDG03CqSZDIiz4+Jx0wGx00KZ3TMZ3"
+"QT10ouWOJHGDuuGgte+dA00EEutQEaLE0SZ3vVHp20mCEuuB0KZ4EFX3+na-QIXGQI10suG2E12CpO3DpW3CqCZ32kX5ivaq9605ouIDr83CEuu580ZCpuGIG47jEOHK"
+"84JCtumRbnmDtCZDo1l06N-84OpDEO6B08Z3-U60nu0cAG0EnOHsd9Dj30mCEqx4403E1nfAR+b3ew61pGZ3zpb38733m43EmuV06uJ06O1jL11CrSpCquGoEHGCpuGU"
+"QuzmG8nFG1pCv83CpOJEnG3EoGJE1jl4iF12qSJEEmq54W3DEKNI+FC4wCC4COJEW8Z31950uuWKKuWNd10EMGz7QdO0Ei0AESQS1ua777b5vd14rGJDtaZ3qZ22sSpC"
+"+ta0wqa04S3CEiZ2CO3CtCZ3eh65sG3CnGZCEyQ3QJC00SZ3M370s4wvC43CpCZ6TL10ruG0OX0Dt8JeunGDoK3E9pj-5RGs53mDXtk36Y25r8JCrKZDI8WOEif2QJC0"
+"0GZ3yf33n4JCru0dL1mDMeLEEaF808Z3mtY3Hu00u8XJh5qO+JC0TGi4pwY36aY3lY30vuWSQ0GCIqL8Qh91CW3CqGZ33N25qCJDq83DICw71KC1pSJ0Fu0P8m0DoapC"
+"9mj-53G75BnM6nGDmCpCEudS08Z3IzZ5xpas53W31141r0Z3J570ruWixKSqXPD2vWJEEKBG0aZ-FCXKFC11tGJWGvW9OumHI0GCEKvQcdE3I4JQ44JDE8ENGW3EmaJD"
+"DFY4Y321t4Z3DB21tKZ328c-QIWEQIW39u41ouY3X620o4Ix8aZCqu0khvzN5GHDkWZDr4Z3ID10peoDpu0GjmGDoOZDESgG0OZ3vZY-mXXFmX15tO38uuIEEiDB8SpD"
+"muGWbGWDrOUnOXGDk8Z3SQd3bT70q4GI08J8Eum3J0mCEmVGEWrEGCZDpSpDI4I4+Bn0k8n0I4MN0aZ3WA43paZCrumXtekWjnXCkSJDpGpCouWwFu0hDe1wtuG6OvGq"
+"YnnDsaZCpCpDm8nfSuVn0uIn081-F01Co0ZCmumN21nCsO3Cv8X+98TO5mGDkSZCMeiS44JCEG6GjtA3puYDt8H0OvGniu0hwvW38uVn0uIn04Uh04Z4kG50v81mA00C"
+"MWfSIl91EOhJ0OJP-w0ckHGEteHkauW7dGWCquW-XXnDsWJDrGZDIW82+3M1v260uOXlinmDqCpDISnT88pCqOnzU8Tn0WWCkWZ38d71p4Z37W50sumFa4yqC0IDkCZ3"
+"BG30vump3XWCr0Z5tOc-53WB53GWwu0Ge00DEeCT40JDEGIGXreq4300q8Xeh00CEKhJ8KZDnu0CIr0nE0J2C83EnKZ3Rw12t8ZC5lZ-96GF9Mkh8GpCtuWCruWMAvWF"
+"K4oFI7C488ZBvuWOtnmDvOpCIK85c4cDECEQCaJCuCZ3du51oSZ3KZW-53WB53Gwkw0fIuG3D0mDM0-VMiA763mW8SZBtum2DumW90WDEyyIIqB2Xik3F310t4QPGa3D"
+"m0JEMqR8+hO0zee3qw20ruW5B9HrbnGEsGpDImOM0KZppF23puoDnuGoBu0ffmWCvGJDvTj3aV30tuGnuGWCsulHSOaHSu0QD9XnanmCv4JEEOHPC43DpKJWx8z43GmC"
+"kuGA7vmD2wmVlG0Dm81qH4srS83EsSZDsW3EEKxF44ZCMuSL+dO0zae3hH77oKJCo4JDvSZ3Cta3PHYvzg13pO3Dtu0I3g1DC4Y3ECE48G3EsuW6H1WCEuwHEWdDXvk-"
+"43G74R1jkGXDvOJEnWJuFvWxR4cTIdO0E8E8Ey5BE4rW4OZCE8OB1ug3bR10tu06jvm9eH0Cpu0xo4m5+NC0TKi5fr40u8HG91mCEqVTEmTEgVz0XCj3d0Z3M-70u8HL"
+"TKGnEGZ30KZ3W661n0Z-tMbGtM52qWJEE8p4Ee6280ZDruGwiuGLU4QnIhO04CZBEyWUSWpCvOZDpK3CEqDQXCNmgZGDn8Z4BW11rWZ3TNKGmwlY1qZY0aZ36F81oGZ4"
+"SC63oWpCmu0u66CeIJC0CKZBp8Z3hlY33N63t8ZDuOXaHuW6bW0EvOZ3Pf11tGZ3AH60r4+I+JC0kGC0IiRH84pDou0hwmWCu43CEu3SXyZqgR05su2EpSZDEe66EaLJ"
+"4OpC9ug3dY20ru0tgu0DJOnGS52e+Fn0vD10vuGjkuWYj0GEEam7Eqm9MuAPQNY18KpDouWj+uGeKWGEoSZ4BlHHDHWDmuGZvuWV+5MxEy02+JC0kGC00CZ4h9Y3h050"
+"nuGWW0GCE4-D1ofq53W3ggW3fS54nCJDqOZ3XOMYS2mCI8D50OZ3D685rO3Co4JCXDd-53WB5303q0IDkuWYJ0GDEWpX0aZ3arb4R2XsIC01mSZ3w885oaZCsG3CE4ME"
+"1PZ37b61rOZ3yu53pSJDsuGpYLm5+ta0Tra3YP30tu0we4qJ0WZ3-SbvHCW3EZ60vKoQEOSC4CZDMe3LC0ICkOZ3XTX3hw13nG3DuuVbmvJbm10DEaMJ4OZB1902uOpD"
+"Ei1K0WZ3yQdtkU06tuICqKJDuuGHMG0Coum9rKq+Eys7CW3DnaZ39UZ33T40mOXhEuVY1qJY0SJeP30DEWV2OaZCpWpCo0Z5YRasD904pa3Es4Z3QM84paJEv0Z5Sb32"
+"WCZBEq5PE0120KZ3ZT40ua6A+JC0TGC0uuWzrvGMAW0Dv8Z34ce3biHOMBzN5GWCku0huumzpuWwHH0Et8Xml4ucC4ZDm8Z3qhX39lJu54MA+NC0TKi3EuJ8wJnDq0JD"
+"pKZ3GyW4fTYq9600pu0H7X0Ev4Z3wF30v8XX65GhEO340OZ3Tq04maZDp4Z3JrZ3grX-43G64JGDm8nMFGWDpu0aLX0Cq0Z3hg80m817WeTn0mmCua3DEGJT40ZCEytK"
+"MCW6XJi3CBX3l281mOZ4e9L0SxVY1KJY0KZ4HB13qK3Ds81gZ0XDp43EuKOKIJC08GZBsum3t0mCEiuAC83CrSZ5oU23WOZBpuGnlHWDu8nl8ImDn81oSuFn0u2n08H6"
+"yvmV+umWy4kQ4KJEIS-4Utc4Im3U48ZCIqKF4a3EIyH2ESP5m83CpaZDmSpDsCZCv0JYowVY1qJYEi6T0KJG7HHEm83CtSZ3qdZura00q8XJp01Cv0JCuuml8f10gW08"
+"tuY3qP40ou0nS0mCEmDVMib5+JC0TGi3QzW3Al70quWW110EEC-4Im69Ita01ZE9pKJDp8ZDnSJDsuGyX4a+ECe40aZ3KyIu3mGCsK3DMeiB+JC0TGi42pb3NNX3QzW3"
+"2m01mWZve6X3CE50u4kAEazD8O3Doaq+1mj3lz00suGiAQnE940t+NC0TKi4Fu33vK3Cr4ic0WZ3vL20sKmUUJY1WWJEpCJCv8pCqu0xObWIEKq84aJEEeNJESUY00Z3"
+"MWW-53WE5300tu048uGfC1nCm0JCmumnAKOKQRz00GZ3Yd08oapDqCJErSJDI8B7XPD0m4itS8JEmSJCoCJD+pjA+mjA8K3Cuumw80mDEWW4EqRKEWeF04JWG9j43u0m"
+"6AXgPHHDm0JEoCZ5pWJGDvmq12HEsW3EtuWD90WDMCe4+ta0Tr40vuWSvW0DnWZ30XX3CC42taJDc7724OZBEmDVE0c6E8uQEG571PJGD5O+8SJEuumOAumSD5m5+NC0"
+"PKC0nKUh0SZ3lO41s0Z32Bf3KKL0a9j43uW7G01CsSZDm81-fH0DnaS3btQ85o0CoSJE1N40v4ow+NC0kKC0ES+2ESy94KJDEitBE0+PcJC04GZBEOAG4aZCEeM9ESoX"
+"MuJ6Ei29C8JEv0Z3Ewa3MK60rOXzBvVY1qJY08Z3CJd3UA40mu0AEnmCt8JEcJC0E8OR0OZ3Ig80uuG2GGmDvOn9WumWBWXCpGJDpWZDEW29EGXX+ta0wqa0EeRHImVK"
+"G83CtG3DEORFIes5QRz0Ei59EWeLESh70WJYW44JEu+IK03Do8pCmuWSqbms+ZO0zWOui2HDnCJDquGrc0XCmW3Et8XRD8Dn0umIi0WDEWpMEShT483CMepJbpA7rOJC"
+"qaJEt4JGs2mC+JC02HC04K38IKcB443DEmZ80KZ344Y4tqcq4300quWAEnGCs8JEEizVC4JEtWJHrumra8n0DumWtuWyL1mC+hG3seG30KZ3cra3vR44r03Dq0Z32j22"
+"na3CIGk4INC04WZBECD9EysGEePAUafBEuo41MA0ouGxq0nDs4JCsKQT+ta0Tra46SX39P52t03EEm868aZCp81LP8Tn0GWCkum3YuWRY0mDEOsB0KZ8Hx30puGqlunr"
+"gGWCru-2Dep2D0GCEeRHSaZDoW3Dt0pDEWB8Ei-7U7E4CGZBrSZ40tf3Pg40qu0ks5uWE81NC8JDuOZ3l272p0pDEWNE1SX-96GF9wm2+uWGZ44KEGfb4CZCImUAIZO0"
+"CKZBoSZ3t167nK3CqWZCnSZ48RKPMJ0Dr4IwOS3EuWpDnSZ5hfa-43G64JWCmuW38WWDn4Z3SV61nSZ3sOPXv8D+9uG71X0Ep4Z3z7b4wM90p8ndKu07G0GCEudS0SZ3"
+"9Kf3c4a-gUWEgU07o438vuoCt8J8aumNuG0Dm8-1fXWCoKZ3u+20uumLvuWAR5KDEeG3403D1rg3kqf39YG1NuFY1q3YC838suY3q4b3FW80pu04qHmDp4anIZO0E0oD"
+"EKi60SZ3Nn72q4pDMiH2EaK204Z3kZ10v8Xm3wGpU4ms+JC0TGi3zob3mI11rKZ4gZ51pKZ5I+Zq43W3DG32n0JDEK-4E4s70OJIvp08suYC1T40nuWrq0WDE4v4+ZO0"
+"+WO0Eub9EKaL4CpCEumY84JDqeE3q0GDEqfTEaWCOO3Du43DtKZ5xeKep1HCt43DpuG3VGWDtunnUuFY1q3YIeWB00Z3u410ruG9TvWcEO+z9uWL01WDEqqQ08Z3jF61"
+"nOZ4zbGmcp0EtOZDIOAS00Z3ZNX-9qWF9qW49h94mOZCvGZ3hH12pWJDEGBZc7Y1883EuumnBuWQVYWCvCZ5HDa3vSY30x11q8Z3x6c3wQd-Q0XEQ0X3ara34wZ3olW3"
+"Oq94p0pDsSZ3gZWqYO03puIDou0TE4slC43Eu8JjUvWQs00CEe7cE0L2MyL8+xa0kua00WZ3VSZ3yQ22s83CEWUN0KZ3JvbtA603su2Equ0f82GCEuF88KZDv8HDU4aJ"
+"0KZ30cIewIWDruGXIu-c4upc40GEEefL4KpDEGG644ZCEaLZEetE4KMBMp91CCZBrOZ3R130m4sr443DMmYC1z40q4yv1Db47rY5Q7Y-OFGUOxWPDHmDkuGSauWfTW0E"
+"p8Z3kXIuZ9TO50mCEm6PEG5CEus900Z3MyNmE4CF0KZ4MeX3ola48fO0NuVn0qHnI4h7EGEFEG38I0AM08Zv8n05pu2Do8JCEK3DEevX08Z6Va01WKZ3cT11m4Z3orW5"
+"YTb-oXWEoXW3Bh91uuY3uv80q8XPSumCL0WCE8o2Idz00OZ4Gs3An83Cn83EsCJCraJ8K765CG3ErWJ0RX0CsSZ3ivLWwulY1uYY1uG1N0mDEakJEClU8a3EpuGaEvDs"
+"3uWbeGmDrum-N6u948pCMau6EGqR12Z3b311s8Z3dFd-43WF43W4cra3N861s0Z3yQ73mCJErOUGMGWDkuGHSvGnaoGEmWJEE0iF1nF1WGJWTw0CT20CEOTDUC7C+Fn0"
+"zDHvm2mDEa2DEyR804Z38Lg4gTXqE9W3ti51tWZ3TMa3XcX3xqJ15xmMevWuYXGErCJe83GC+3c9w0c98KpCs4eKE4A3ECn7ISw4IO7NIp91MaTLCa3EtKZ3FLe3COJ1"
+"43mCEGCA0SZ3VCd3Eef3t0H0NuVY1qJYEiic0OZ3wA72vaJEEqgG0SZ5HvXs86W3JkA9pS3Cq8pDnCJCs8HHhuGmAuW2SHmCmuWDMn0EuS3DIGR6+JC0kGC0IqWBEGp2"
+"00Z3QVg3xk30uOE8nOX+jwmLau0fA5+EX8NGavGw-GnDmKJEsKZ3dBL1NuVY1qJYQO1V4SpCEuJ94SpCEiydcVz0E0qbK83CpWJCmu0Ee0mCMGga1NY3I9d332X3cGe3"
+"ePQ0SxVn0aHnEOMJ84ZBsu0wGX0DmSZ36CYxHO80oOnwH1GCEiu6IKtCXkQ053GCEi2Z883EmumLK00DQCwK+NC0TKi4AF72pCpDEiHG88ZDvuWXX81s88D53mWDkSpD"
+"Eq9GEOQDCOpCoKZ6uz13qu2Eru0XB0HEoWJDo82WkvVn0qHnIi1REiJKC03DuaZ3c-A1rSZ4hTXsSM21s4Z4ys03vO3Cs4qFn-A3nKpCmumCRH0Eru0-99HwBuVn0uIn"
+"08n3kG0CouGTivmT8G0Enu0SUOEi7uGcy0mDEawL0CJ08PXuq4ywE4abEqcF0OZ3y6c44mX-53WB53GvmomCnOJCEKc78K3CuuWad4OFI-a048ZBEiTCE8p4EWi2EWJB"
+"X9i3tzGWq3GEEa0U08JmnNm5+-a0Tza3eeA2p8JCE4b70aJmUw01h4WUEJjB4KZBEONIOCJEoOJEsCZ3dPe3RrW3a010ouGbd1GCEqM60WZ3rdd-43WF43W4BF71sOZ3"
+"g910mumiJ0GEEW1dUNC004Z3Mq16m8ZCvG3Dqu00nQnlDu0JeumeZHmCn4MxEmJa+Vu2wSu20GZ3Tm60nOHOA0nDuS3CsuGyTvDn0uWWs81oGI0EouGGh1GEIiS5EG07"
+"Ea8h08Z3aAd3KAg-OAhFOAB2rG3EEqB5IC+C0GZ3CR22u4pCIa+2I7n0Eeg20aZ3V311p4Z3Gq01tGJ9Eu0sAu0U1wWPGw0qk00E+ty5+qy5ESMJE8E7eKJDmaJErWpD"
+"nGZCMS0IINC04CZBE4b40GZ4K613n8pCtO1a252eEC-XEqLBEe4eQujK+Rz0vPj5dr43n4JCsu0pu0GDE4n50OJa-RyRp0WCEqANEOc6EyKF0aZ384IGO6c4ECINC43E"
+"qGZ3oy20s8X1SuVn0uIn08XNFummmwmNK01Cp43Dv8lyT0mDE8LiE4bG8CpDtuWMPKGn4GZBEmFjEKzY8CZDnuGCMs8E+3KKQ0KK4KJDEOyLEqm70CZ3+661m4Z3JFN8"
+"-8jJ2u0L4HHDn03CnaZ3yf52sWJC9GC1nuY30ed3rYA0m4wTMiC7+dO0kaO0Emm50GZ3p3g3FCB0mKYzEW2208ZpaO03quIEsuWE1HGErumSi0mCMG19E8c9S8pCmKJC"
+"mSJCMmQaMix6+Bn0z9X5qjOma3mC1DC0puGuF42xINC008Z3iqc38U32q43EEGp4YSS800Z3yzf3Bb51vaZ33pKv0uVn0qHnEq1RES5C40pDXe30puWY+vmDE8TJ200D"
+"EOw3CG3CnWZ3SR80quGnhKM4ESj2EyMi0WZ4Fa21rSZ-9BaE9B40ru0pQ2WDEusCEWQR44JDEKTA4S3CXWYq9600nuWv72mCEWQDK4pDvOZCseHuxuG+luG+b0GCES-a"
+"04Z3xzG0SxVY1qJY0SZ3pGZ3Wu70qumlMuGSp10DIOUFIhO04KZBEOWBEG430CZ32zZ6dhY3An00nuWD1wGDBHGDsumuhuVn0eJn0OXNFmmDnS3CXc53t8JCvekuxu0O"
+"pY0EpCZ3DnW3H340pOX7J4iwEeY808Z3RW93rOpDsKY9+hO0keO0Iur3SCpCnKJDo0ZCIOSB08ZvOF02suYDEKsdGa3Eq03DEaJh4C3DXCNWq2GCE4EES0JDsKZDqCpC"
+"+F24+C240OZ3dC83rG3Dou0et10DEe8M0aZ4elWqE902qu2DEmO4EOZf0OZ3JCf6BB45su2Cu8JCEO-a80pDtu0BJv-43ep430WDEyb2EuCH0WJeWH0Cr4w51CcqNF01"
+"ruY3Qe62v8JCEGXJ0CZ3uWI98omCk8JEEm2TEOv70WZ3xxJm6wVJ2qLJESMJ08Z3gFZ3r3g3Zp12s4pDcpKB0OZ3CN11n8Z3Mq91qSZ3yiQ2531DkKJEqumeC0mDEaFe"
+"EeLD1mj-SIGcS2WDEGc9E0b7EGtXEOXa0CZwqG30q8nfm0GEEOc6E8244aZC5qg36420su0do20EESqOES3e5pZ-43G74x0Pc0XCpS3Csu0xI8HVaA1qS8T43umfcvGL"
+"wG0Cqu06JuGKK5ISEKe4ESabGOJCqCpCEieZ+7n025n04K38Ee-j8OZDvuWdCY1EraZCoaJEXWYqIC00ou0KKvGaFwmHWWmCtCZ8oX00oumm9vWvOXGEnSZ39BL0SxVY"
+"1qJYIir3EmpIO8JDvSpCmaZ3uQe3taWqA603puIEuuWe6XGCnWZ3ra50ue1Jj0GDE06NEmXKOGZCv4JDpGZ55AXN53Wpr+41n4Zb2t81ruY3DV33mSJCquWF3xG4+uVj"
+"F9PjFHGDsuWik00DEeb6483EEuME0CZ309ftFC11ouY3Q876nW3Cv8ZDpu0oGuGMJuGEF0mCEKYX8OZCvu0zFwmgQw-A2epA28nJ8u0CXvWwHGGDuuW562GE1Elqh800"
+"su0H71mDE80nK0pCtC3EqOHZI118pu2Dtumj3xm+yvmYyQHdHurA28CyE1GDISMJ1Pe3Lka3Q351v4JPqADn00WCEuEfEGAR88JDou0KdOn0B5qx0WJmQ31CpGpCsum3"
+"6xVY1eJY10nDm0IEkuGyZuG1310EE4zc0CZ4H4dq+gX3dA40nuWFAnmDm8ZDI0kN1PZ3pg01p0Z3Ji36tS3CtKJCv8XDruFY1q3Y0SZ3IuW3iEB3sOpDuu0qlI0Eq81O"
+"N8Dn0GGDku0l+AXNi0WCEaOVbFTGCPHqvuGb-GWDrumKF4ms+pa0Pna5dra3Rrf3QHImbvmuTvjr3WmCk0Z35p31s0Je464-XQO892GDEascECp8GSpDoSZD+lB9+iB9"
+"MSMJE4ig40pCE4M3E4Bm5idsA6W3agX3-K45oGpCv8pDI8Y2Xee36g64qS3EsCZ3SsB0ouVxUfJxU1GDISMJCapDvCZ3qv01v8Z4nDK8jBzCPGXCkO3Dq8Z3WjW3Aze7"
+"JqY3pgW3i9g3B-a4z7a-KwXFKw13tK38u8H863GEEqmY0GZ3Nb20p4QsIh91IaS944pCESzgEKaa0GZ5k510WuWcX1GDEKm408Z3qaf-gDaGgD40rumRRYWCkOZ3WD81"
+"uaZ3apW368HmehTJ2u0oPw0JIu0ZAu0M846mE0G34GZDIyFZEWu60WZ67TC0yulqJ8YqJumPDHWDkuGNT1WDECo6EOi40GJX-BjY1GmCk42YEWTL8CZCuuWZA74c1v44"
+"pGZDvSZ35p21oKZ3vgb49wW-53G75dUh00Z30tb3idZ3sPNfN8TdA0mCE4bVEq-N04Z3jub3XIH9A2GDEWv3EyeE4SpDE4AC0GJQkxVn0qHnIm-3EOGJ0OZ3x882m4pC"
+"E8DhcxdH4C3EEiG48WJCquWSj1GDbGTGF1HDuW3CsuGSRXWCpSZ33bG0SxVn0aHn0WZ3qj80v81HfHGErumf-10Cg3C4Ee-ZEGF74SpDEihB4O3EIO44EiE308Z4jK51"
+"vOZ3rT61paZ-WLWFWL01u4Z3FC10su0l37aK4WZCIu+T0KcsIYY3Fm04n8pCmWZ3Nt20tumlN6YSEqwF84JDm4U184pDr8oMAxVY1qJYE8HP04Z3RRa3m184sGZDqKZ4"
+"JuWqNFW3Pui3Aae3+b42q43CMuh3Xae37N91oOZ3MNb3dla5oeY-43G74B1MVG0EmuG7E20CEKJB40JEMGi4Q7M1Ee-f0aZ3K570vuWXb0GDf660pumWMWmCmGZ3MG30"
+"nu-yjeqyj00EI8HPW0ZCsOZCs0JEuu0dJ2mCIau4IhO08CZBmuGKs2GCESzg44ZDE4iB5vK8XY0CrSZ3mb20sumqNAXgCulY1uYY18ngNG0DsuGJKYmDvKZ4GWHe4BTY"
+"10mCES-nIKmWECe7E4VODGi4tN31m4Z3as33qa3DpKms+xa0Tva4dr48s0JEtO3CmKpCEWNHImA3IZO0OKZBrOZCu0Z3KFMXZRHvF4ms4G3CE0hLEm4ZEmj6+JC0+GC0"
+"0SZ30810nuGnkH1EvOJDo0JGJvz86G0Dku0OU2GDEOZj0SZ3UZb6aR10tumecumQv1WDE8L248pC5UZ-86WB86W4crKeBWmCmaJeQGmCveE960WCMCh80OZ3qd50tuGn"
+"L5kCI87208Z3O4e3eZc3pxa-RIWGRIW4swY3Zc93s83Er4UIE8ueUxG3EOONImkG4WZCEewUMCXC1Ki3CLe4XlW3at60mu1zUulpTuXpT81qQI0Cs4wr0aZ3bm33rKZC"
+"o4aJIBn0E8eP8S3Dqu0c0AXFi20D1ea3e6X3xr64uWZCmGZ3WS21rGJn-xlr3adr0aZ3RzW3-o01tOZ3KBf4KwH0Z9Dn0mGDk4JDEeS3O4ZCp8ZCoCZ5RuGme3mCEmbD"
+"Ee090OZ346a4RfW-43WB43W5aeh4mt21vSZ3aPZ3abhtD9W3i9X3eD41oaZ3l0Z3lfRfVv0yHxmSQ9XZWIWCqu-BcwpBc2GDEOMJE8mZEShWECxf04Z3wdGuZ9jY10GC"
+"EykJEmkRGGpDqO3DE4-M5Ki3e1D1o8Z3UYd3itY3w6P0NulJ2qbJEew54GJD1cf4AU33qGpDoKWUEp18IyCFEy0iEmUY88JDteX5qmGCkKpCE0Q4EySm8O3EnuFuW84u"
+"W8XPDv0hxwmrd1GDEW1l0GZ4hZWq86W3Q140p4gNEuU48KZDteX18nmCkOZCEGpiESo8E8N3MWU3+ZO0zW80suWRO0GCEOPY0aZ3OE10oK8fkBn0EKEOEKsq0aZ3Jcg3"
+"xYW3CqW3Ubh3zm46nK3DsS3Eo4GO+NC0kKC0EGm9ESB5ESk400Z3pOa5kHcq96W3sVC0vum8E1WDEqAq00Z6rsX3eS33oGJCvuGsqu0n210C+Zy9+Wy94a3EbmE1rCZ3"
+"aN11mGZ3eQg42PXqPzW3BZa3zh02m43DEim5UKMJ04JHkYWDtaZ3Uv51sKZ6HVf-D9GND1GEESoD44pDEaL4EyC20SZ3odJ8iBTY1GmCkuWWC1mCEq0M4aJDESa952I0"
+"SxWUlwG9j01Dm8ZCo8nt6vVn0aHn4O3CEGtY0KZ3i+42vSZDEe6B4O3DIK-4IBu24GZBEuWJ8G3CvuWeAX0DmKZ6wdW3e7C1o0Z3UM30oumYE10D+xWFwuWF0OZ3Dhf3"
+"mHX3EPA6vKpDnGZDnOHNp9jJ20HCk4pCvuWCpuWWbvGY97JY00Z3RlW3ptg3orX5Gza-96WB96Gvj6I+XU15vCJDs8JDIS+2Ixa00OZ3Y790muWo8v0iSJ0Do8H1L4uc"
+"8SJEqum5TuGcd9Y6Lx-43Kt44O3CEa1V4OJEECa5X5f4pHIeL8Dn0u0Jz0GCEClB8apDruGazfXeRuWt3AHxq0WCI80YMWFO+JC0kGC0IqicEKu80aZ3Kj20t8Xkpump"
+"I8z43uWGFGGCpu04UWGDtSZ3L9HWXuGqD0mDEi7nEqjK+N2MEL2M0OZ3dra4S642o8ZDEy18IuH5E0i2QFn0Eae5EqLd8O3DmuWA2Mt4mWJCsaJCtGJCvGpCpKZ--LXE"
+"-L10sumPDnHCk0JDp8pDou0cOumOlA1uQ8zJ20WDE8YEKCZDt03DnuGr4IWCv81v9uGud00EEOULECW4ECXu+NxJwKxJ4O3CIqdeE0WV0OZ3hu80num0FuEs3um8pnmC"
+"n43DE0eegGGrE4RiEKGgECfMEe+I+3i2o0i28O3Cu4ywEKxeESb70GZ3By81sGJG58D53uWBT0WCEm3W00JmKx0hK4Wh80IDkumCuwWIKvWu3wGUT7m5+t91Tsf3LKb3"
+"I211uGZ3lwLOQdcZMNu2E43m0GZ3Nb60qu0P0ri904J8W2mDEa8KEukCEaL2+JC0sGC0EWMJ08Z3ef82vOJEE0cd0CZ3tvhu-0Y43n93oOpDvuGOywWzELWhEqv20WZ3"
+"Zue3bc41qCZ3Tph-53WE53W34jX3eF20ruWZOJHCpCZDrKZu4303quICsuGjhI0Er8HjD2GDI8O21Gi3Vg78uOZCmGJCqSpCMGqS+ta0Tra3Hh90ruWksvmY9vWEz2mD"
+"Eq67Uty54CZBEic84GZCEe8XE0yYYuc48K3DtuGkA0WCEePhE0IC+dO0waO00CZ3iZ52p8JEEOJI08Z31jb3apdtFq03ouYCmuGqoG0CouW6T0GDQ4Il00Y3zaj3+eA4"
+"uKpCp4Z3Mgd-53WF53W4qw20m8XSL20CEO0j4WpDM836Ip91CKZBs0Z38k10nuWgIwWex5o31RY3IgZ3vBi3V8A1o0Z5ONa-SIGcSQnQDvmK8xWhU9HnM8H0C8zh7uGc"
+"pGGCsuGbk0mCIyTBj-A0suGUd6wSEqkHIGDo+xa0wua00OZ3wQd3Wx61m8JO82WCESPfUta0EGT30aZ315g3VTk3eFX5tFX3CWi3It81mOZ39430qO1jfuFY1u2Y10mD"
+"EO3HE4QhXiZ3bxc35ldt53W36k00vu07EWWCtCZ9VO90WuGw8vWZiwmC9H0EpuGOFuVY1eJY1uW5L5gr00Z3P560s4M4IidAIVJ2EOAJ0GZ35R41tKZ3fq21uOJP-wG+"
+"ivWoSxWEhG0Cq8X4FvFn0e3n081o3IGDqu0sTx0BywWLEO+JpumyE10EEqHG8S3Eru0NGA26gu0hK1mCE8dAGWJEq83EM8dI+Rz0vPD3o038uumXQAHfjvGBOvmvVuD9"
+"6uWwtGmDquGStGmCuu0rB8YikuGSyv0T+uGbCJGCo81SDuFn0u2n042xCaZCuGZ3DT81sWZ3h+cv4kW3+bC1n8JGwGWCnumUOO1DU5od483EEey54GpDEWTCQqQI+ZO0"
+"zWe3Eb51r8Z4Ore3Qo72pOJCIG84IhD90GZ3RPB2n03DEG6BEmBxIiv81VE0quGZVu0FCYmCv0Z3lGh-HCWDHC00ou0l5vWN3wWTiYnCv03Ep0JD1YZqLFGmY0GDMiuh"
+"E0m74KZC5qg4MJZ492E0ouGZfumyGwFn0e3n0um1NGHDuS3CpWZ37t34q0pCo0Z3qaWq43W3XC90suWCpuWmy10DEu7K1qg3uzX3+nZ3r3g3Qa20vOnDYvFJ2q5JI4CN"
+"04Z3aGd3G+70muG+9O+g70WCESEC08Z3n622u0ZDIakiEON7XX20mumAQu0uOxmdRv-lxeplxGWDouGTxH0Dp814dJWCtu0W61GEIiG3I-62EWjX08Z3WXe3CVZ3H2IA"
+"9oGCkKJEEyQD8a3DruGWJw-VLupVL0WDEiMJ8WZBpOX2kWmDs4Z3KHb4K3aqE902tuYCE4v804Z3wD11q8Z3ueNHEn0DkO3DIaxTK0JEpG3DqOncyvlJ2uYJ2u03+umx"
+"wG0EquW8yuG4I8nfH8Dn08HFW0mCXVg3BJi8Wl40pu0sDwWSJxmyH6S8+lw1wiw1EeMJI4bUI0728KJDo8nUAOED900EEyfL08Z4TH62s43EMOO9Xa82oaJCEa-MEyUi"
+"0KZ8esZ-qwX6qw10suWQDvWYGwGwf0HEn0ZDu81lK4MZEx14S8ZBrOJCsSJCI0naE0XrXRVmamWCmOJCEGYCCGZDrKZ31RMGbvFd4a9d4CJCEmNrEOaQEOZ3K03Eu03C"
+"n8UY1umf2HGEs4i28O3DouGPB5ucX262mKpCE4jB4KJDEyBGj0g-43G74BHopXGDrSZ3hBZ3dy91pOZwS561nuY35t90tumBHGGDpuGis4JY04Z3cDC1qWZ30Cd4Jih-"
+"96WE96W4YPY3svA1s0Z4RDB1u8Z5CIZsKwW3RKk3DkX4wwX7srj3ali3pwX3kV20suWq5LAU+hO0zeOukYWCoSZ3aBH08xmfO5c4Qp91E0jQ0SZ3A080nuGI2AH0G5sr"
+"00Z3Nvb32iC1qaZ3j6b-43WF43W4fr42o43E1L42pOJCEK1GcNY18OZBruWmivGTCJHEq0pDpGJIEvGZQ10DEibP08Z3L+c3w4e-E9WEE9W4sw10pumCU30DE0lJ0OZ3"
+"Vvf3+QXqA6W3az12u03DEugCEOI200Z9Jgc39za3X8c3YpA0rOHSFulJ2qbJIWtU8CZCu8HmAmGEtO3DE853U7M1G4ZBoW3DE0fCGOJDo8pCEK8FXCd3ua01qCZ4Pl30"
+"mu02AIWCmKkn+NC0TKC0uu0GWuGXxwGgC0GDEaDL0GZ433ZqA601suY37Oj3iCA0puWr+1mDQaJ28GZBt4e-EKMQCCJCnaZ-cxhFcxB0sumQDXYCk4JErGZCo0JDpuWw"
+"B9oBtRyz41ICkG3EtSpCnaZ31e10p4gjnee40Fh3Jl32uWpDMeP2+hO0ze80q8XnSvGxWxWUYZmDpKZ3xQgtqX02quYCEezKEaz94SJCEyjBb5i3CG11sKZ3Cl80nuWD"
+"bvWSD7ms+xa0Pva3gr42nu2EEarA0KZ3QAB0puGNh5iYIRY18GZBmu0xMuGUEvWrfHGDp4Ah1KC1rWJWn0GCE0360WZ3IHf-53WE5300oum6Q0WCEytf0GZ3Vo83o43C"
+"u81JCez43uGZjmGCs4pDE09r4KZCboQmduGMNI0Csu0e+vmCdO1iEulY1qZYb3h3KrC1r4Z398b4o9H8AATn0GmCkumcmXmCpWJHtum7s5oSEWI34WpDXq10qu0QDv05"
+"f7m5+NC0TKC0quGZd00CE8DWXpg3jjlL4301A0I51m2FiLMOcPLOiLNPpvJ7NWA8WGZBsGZCoSJDuOJEuGZDpG3DmKMBm438ruIEoG3CuKJEtGZDvCZCvWpC1S11yyI7"
+"7X0FlyL6B10FTm0DW02Ffv6Tb9dRXncJlHcFn10Qm0IBn0YDqK38nuYCoaJEqaJEsO3CtC3CpOJC9CcOy0WO430Hru2CoKJDoaZCsK3DmCpDqSZD1e4NWOZBv4JDoG3E"
+"nWJDpaZDna3CpKMBm83F+JC0PGCJs0IBnuYCp4pCr43CoaJCoS3Eq0J8-GWCy8Tn0m3EuGJDv4JEpS3CsKJCoGJD5KCGquIEpG3Cn83Eua3Es83Cs4JBcuVY1KJY8T38"
+"quICqSJCmCJEuSZDpGJCu8J043mCEJC04HZBpSZCoCJEn4ZCuK3Dm0pCvK0n4LZBuapCqSpDtapDr03EoCJEt4m5+dO0za8Ju0IBpuIDr0ZCsGJEuGpCsaZCtWZx530D"
+"oSJDr4JCoO3Du0JCmCJ9oX48ruoCvOZCt0JCrKJEmOZDtSZC+NC0wKC00aJGEXIEo83DoOJEp4JDs4oFX0aqE90FnuIEnCJCpG3CmWZDqO3CnaqDXf2EsWpCp0pDsGpD"
+"t0JDmS3E+NC0sKC08L3CW4ZBqCJEr0JDvKJDo03DpOJPDAjJ2GKDkC3Cu4pDu0ZDt83CtCpCsGJ0jI48quYCqCJDpC3CnKZCr4JCs0Z-96WE960Kr438jOZBtSJDnaJE"
+"v0JCp4ZCrWJE1Abq530GsuoCsKpCvKpDuGpCtW3Cr4J9oX08quIOWG2Es0JEmKZDqSZC+dO02bO04938tu2Cn4JEsC3CrGJDpSpDtK4oIJC00LZBnWJEuC3DoCpDma3E"
+"sapC9GC4pu2CoOJ8bWnCsWZDsSZDb2c-NFGVNpKDp0IDkG3CnGZDr4JCmG3EmS3Er4q0UJC0e0JDmOZCn8pDn4pC1mSHD1aCkKJDtO3EoaJEn0ZCtWpCo4uD+JC0kGC0"
+"4H38vu2CoS3DvW3Ev0ZDqK3EmKmO0GZrVL0EsaZDv43DuKJCsOJDqaZDfW86ru2Es43Eo4YuK4pCoK3CtKms+-L1v+50r4Ehu43DtG3Dr0JCnW3EpapDm4A5Id91aKZB"
+"mKpCsGJDvOJOHWGCvGJ24pJCkKZCt4pDta3EvG3EoWpD5gl-43WB4300sKMrq0ZCpGpCm0JCvOJCt03E1KiqD907suIDmWJEu0J0koGDs4pDja81quI8aZ2Cq0JCv4ZD"
+"r0pCv4GO+NC0kKC0CT38j8ZBmGZDoaJDv0pDpG3Epa3DYBn00PZBoGJCu4ZDuS3Ep43EtWZD1IUXQ2JCqO3Cm0pCuKZCuG3D96B1yyY-nXW7nX0KrW38jaZBvaJDnKZD"
+"uaJEma3DrWJC1idqA60Fpu2Dp8pDu4JCm0ZCtCJCpaWh5Y3CmaJDpW3EuWJEp4ZCt4Y9+NC0kKC00aZ4oX08t03Ct03Es8pD1aGHpAD53WGCkWJmRGHEmKJEpWJOVNOX"
+"Xj2DtG3CtS3EqGZDnapDr4J1NulY1aZY4O3C1V81rWJG3pnCmCZCrSJEq4EJIp91GCZBu0JDXa07qaJDq43Dt8JQO7QmG8JDsapDXz62oa3E+Z43+W43aOJCWqIDkGZC"
+"s0Z3ma04rWZCqSZw9601suIXLI2Dt43DmK3CoapCb8N8cGHEr0JEt0JWxYmDoSZ-OFWFOF04s838suI01J3Ds43DpWZCvWZCoKJPjOj43GGDk4Wke0JDoGJEraJDsGZC"
+"5MO0430CX4A7vSpDvGpCq4JHkwVJ2uIJ20mCX66EqSJEnWpCo4JCv8ZCsGJDgVz0GCZDuWJDbA64uCpDsKJGO6c4mCJCmSJDt4ZDm43EsSZ5SfW-53WB5300qu0XBW3D"
+"vCJEqOJEvWpCu0JCoGZu5305su2DuSZDE4C2O83Dq0pDvKZ3ElG8A2mD1J38rWpDrOZDpSJD9tZ-NFGVN7+huGZDn0JDp0pCq8JEmOpDnuW480GDMF72O0pCqKpDv0JG"
+"KY0DsCJIt4srmKJCmO3Dn0JEu0ZCoGZ7y+W-bOGqbmaDs0IBtuYCp8JCvC3EpK3CtaZDt8nMF8T96WXDkC3EsWpDEmf3EeF344ZDnTTWlWoCvaJEoOJCuKZDmKui+dO0"
+"za84t0IBquY4rd08nWZCoO3Cpa3DbIiq5303ouIEu4cpWW3Ep43Cs8pCo4t4K4JDtCpCrumHHmWCtW3CIyM3+NC0kKC00WZ3el0AqOpCmW3CuKpCo8JOLO1IHOTgHmYC"
+"naJEtGJEvGZDraJnlXJCWSZBnKJEvKZDmapDs0Z3qXG1RxVY1qJYaa38jWZBmK3DqaZ3Yi05qapDtWpDY7M1iOZBqaZCqKZCm8JDqum+H0mC5ug39D1CnaZCtK3CpC3D"
+"tCJEsuV96uJ960nDm0oCkuGMFGICpWJEvCZCsCZCI4N3IB72KKZBnK3Cru0l8GGEqu0bCaq+i0YCkGJDmOJCpapDr4CG00JoyuVY1aJY4TJCWWZBqKpCm83Cu8JDvWZC"
+"mO1JE8T43m3DkKpDpOZDv4pCrKpDmKZC9IOOj3GEEO05O03Cu83ErKJwAvFn0u2n00WC1J24nO3Eu4Z3W314mCpCrGZ432Xq530Apu2EsKJDn83CnCZ3L310senMFWID"
+"kG3EpOZDn8JEpuGUFGGDv4ah+NC0kKC0SC38ou2EmS3CXU55uO3Ev03D5xfq4301ruY3lF11taJGuG0CvuGpGenMFWpDm43Du03Cv0ZDnWJCpGJWtuFn0u2n0m1DWGZB"
+"tCZDr4aH483CE4p40aJe2BzlA02Dk0JDnK3EnaJ02WmCoOZ5G61DWKZBpWpDqOJCnWJDqKJX+7ms+7n0z5HuiYICtGJCmW3Cp8JCpuWs84SdQNz0EWX3OK3CnS3DpCZ3"
+"Y0H0AnGCWCZBESs3O4pCuSZDrCJuCLod+JC0TGCFs0oCk43EpCZCpW3EvapDmuWOAujlAm1DkS3EvG3CsuWFK01Do4JDta0n0PZBuaJDn8ZDn03DpK3DuK3E14c-43WB"
+"4300tumBJ0YCq4JDm43CuaJ8l3mDEWV2Ipa01L35qG3Ev8JEEKr34WZCIuN2XW8Ev43EmW3Cv8JDvGJCqOZDoXO00npBtLMOhD4RXDtSfPMQb9tSc0N6cmM6GmJRXXtL"
+"1S25lLdRqvJC1TZCI0W6gd1eyC7TXTMPKXcSbD7Qln6P+KZBm4ZDvSpCn43Dm4pCsSJCvKsAm43FlCdDd0G4+uJY0q0600I796G06MV6mS3EW4ZBt0JDvaZCvOJWr1mC"
+"M0b2Ixk0qCZBvG3Er8pDuSZCrOZCE0s2Xjf3CX03q8JDp4m6E4z44apC+R71+O71ia38ouICuG3CuG3Cru0S90GEMiK3QJC0CCpDmCZ33R14uKJEqaZ5ekGm3Z0Cv0J8"
+"ZoXDn0JEtSJCtulT4eZT4G0EmKkwG83CmGJEI4d68GZCu4KZIxk04CZBEab3eSZDm4JEoWpDn03EXIOewWHEuSJEm8ZC1ZC2uKJCIqs4+Bx0z9B0uumI8WmCoSZ3w-02"
+"nC3DX5L9d8jm60pCk8ZDtKZCu4JCsS3CEiG49n44ruYDvSZ37q13oa3DsuWGNulT4eZT4m1Eo0IDkSJCquWyF0GEMK74Iag4QZO0S03DqKJEvWJEEGf48aZCo43YqKpC"
+"nOJDsS3Do0JEra3DbKY-86WB8606p0YDkSpCtuWFSWHEuKpDtG3EIir2QJC0COJDm0Z3Ea05s8JEsC3E9qQ882pDoOpCn8ZDpSpCoaJCIyM2+JC0kGC00GZ38H15sWJC"
+"ra3CESA7C0pCnCJG28jCFGmCkuG4UW1Dn4JCqCpCESX7XfL04pnCuWpDoSJCuuGhKGmCr8nyKuFn0u2n00GDEam4uWJDsCpCvWJCvSZCvCZCuuWcC8T430WC1fFAvGZC"
+"uKZCvSpCvCZ4ErH0533DvWpDtW3Eo03CpS3E+pX52nX5GWZDWWZBEqq7EmS50KZ4HzXvwj11ruY39r11rWZ3Nd04n4JDt8Jf6118ouoDsuGOOmHCpCZCoG3DuOtX7OSv"
+"6G0EtuG2JWGEu4Z3ro16tKpCsK3Eo8nlB8j86mXCka3CvO3Cpu0UPmGEsG3EY023q8JDv83DsWZCs4pDnWpDMiU2+JT2cGT24W3EE8p34OJCEu1200Jmjxmi842GIVz0"
+"KKZBuaZCr4SoE0g68O3EpumM9uWCFG1CtCZDvSJ093HCpaJDp4qh+NC0kKC08a38v4wNaaZCqaZDp4JEn4JQs9Dn0mpCkKZCpKZDq03DmOZDmWJDbnLPI0JCrWZDo83C"
+"oO3DqC3D+Vk1+Sk10aZ3lC22kGpDE84700Z3r112s03CIGa4Ip91Eeo5OC3CnSpDq0J9KqaJXFC1p4Z31r05sCpCs8JCMib4+xa0Pv40v42x8W3Do4g3OCJEpaJEr8Z4"
+"8HXqIC02ruICE0Q54KpDE8G7CKpCm0JGNwWNB4wSSaJDuS3Do43DXLX3FeW-43G74pWCW4ZBEGI6Ei16Ea694W3CbBcqVL00puGjJ0mDEiS7KCJDu4pCu81kE4KJuCpC"
+"rCpDs8ZDoOZDqSJEq4SX+JC0kGC0aC38nu2Dv8ZCnGJWK11Cu03Dtu0OD8DJ2G1DkGJDn8Z3Z420r4mo0SJIwZ08ruIWpJGDpumEcmGCmOJE+JJ2+GJ24a3DEGG7EGn2"
+"4CJEEWm4Ca3CvCZvx213pu2CpumVFmHEtOpDpSJEte1HImHDk83Du03Euu0lA0XDvaZCnuVY1uJY10GDXcDDo4JEr03Ct83Cr03CvGJeK8TJ2umCF0GCEKr4G4pCq83C"
+"EOE81fF2WOZBEGn6eGJCtWJEmK3DuS3C14c-D9WBD9W4+R22vW3CIiD8OWpDtGpCuKZ3dAXq53W321X3aP18nGJDr8pCmS3CUOJ2O83EtOZCr4J8bpGDuWZD+FY1wCY1"
+"0aZ5ZU14m4ZCn0JGA1nCsW3Cr4OKINC04OZBE4X58aZDuuGyC0GDEah8be81quY3mRX5Un00vum8eulJ2uZJ200EEW664C3DEee344ZC5CC0v8nNA8Tn0mGCkK3CEyg8"
+"K0ZCrWJEqu0oWKGn4KZBEuE8eaZDtK3EqO3Cva3EXik-F9WBF900v4AOqGJEmW3EvO3Et0JEn4JCXqkq4306quoCnOJCrumSZGmDouWqe8H1Gu0Y8OnuDWHDq4pDsCpC"
+"+Fn0wCn04S3CEul91cF5mS3Cn8pDEa94cdo8EmD50KJe9XXDmOZDqCZDQ472OaZBmWJEtaZ3sX05vCJDrGZD+ta0sqa08S3CnumtMG3ErOZCpSJEvaJCsCJDs8X-B8TY"
+"1uWbfmnCnWJEmCJEouWZS0mDXCT89oGDtS3EE0v6OWpDtK3CoGZ-PzWDPz0Kt0ZCW8ZBoa3DmGpCmSJEm43EraZCE012IJC00GZ3X317ma3DvK3CnaZ3clI24pXDkK3E"
+"mWpDtuWgHmWCpKJE+l91wi914S3CECw54aJEEKC600Z3LW03pKpCu48KIxh2iKZBs8JEoGZCmOZCruGhdKiREKJ20aZ38w19uaJDpapCpSJCr4I9+Nz0vLD1t0Z3PzW3"
+"wS1AqKJEt83EuCpDm4ZuULW3NL17nK3Dt8JCoOZ4uDIYPYmCkOJmWZGDuKZ3VR11mKZ5ghY-vdW8vd05t0JDWaZBEad5eSZCoGpDm03Dr0JE1edqC909ruYCrKJEvSJC"
+"uuW+QuW8EKQN44ZBE4k7ESU6KKJEqG3Cs8XuBuFn0u2n08X-cmXCtWpCo83Ctu0OdWWDm4Je1BTn0mZCk8pDoWJDsa3EmKZDo8JC5IUOLx0KM0mCEOq5CaZDs8Z51TX-"
+"53WB5300tuWfH0JDvW3DtaJEtWpDq0ZCcJC0CGZBs8Z3mX05mWpCrC3DEyZ5bae3ra06u8JCv43Ds4mu04Z42BY-43WB4300u4gN4CJCECk40aZ3eTY3mBHOr9TY1GXD"
+"kCJCtKZ3m710numFS0mCMOH6802Dk4yB4KpDE8i8GSJCn83DXDd-53WB53W33S1DsWpDs4pDv0pCrSJDp0ZvhUW3Jw00numvM0GEEOS78CpDp4qb1GC0mumLTWWCnCZ3"
+"pg11pSZ5OVY-MFGUM3GCIuq704Z30a25vW3CsWJEEaw8UNh6KKZBpK3Eq4iqC03EuOZ3l4HHDnnCk8pDpGJDquGkFmGDs8pDIG55+JC0kGC0blQeLJ2Dr03Dp8JDpa3C"
+"cx37SSZBtapCrSZDEiL38SZDtaOvXa82vSJDE4MA0GZ3vq21sCZ5VVX-96GF9wGgkGKCt0JDr83ErC3DvG3Eu8ZDbrYtdRW3lI10nO1RjW0Es0JJDHmCku0NYG2CpaZD"
+"sGZCsW3D+JC02HC0EWr38OZDpuG880GDX9D1n4Z4wWYqLF08quYDtW3CvG3CEOJ284ZCoKYqXw55u4ZDqWJCE8s7Ei74+h91+e9104JuhwGol0GCEe6D80JEp4ywc7n0"
+"08Z3Hz08q8pCoa3CoKZCMKg2X+B1qOZ3aw05pCJCnC3E+pCD+mCD4SJCEuq788pDvum5ImWCv03CEeD7Eyn2IZc4aGZBuC3DsSJEvOZ3e721r8JIrG08tuGZJWGCraZ4"
+"Y612nWZDIWb2+3n0k0n0Euq74CJEIKG6G0JErGpCEKc8UZO0CGZBr4Z3zh04n43EvCZ37nIWZxm6GW0Dm4Z38b06pa3CuaJEsu-z9upz90GCEGbDEKG3E0zBCCpDsOZ3"
+"BXXt4300ruG5JmWDrWpDXk50nuWdRqQNmKJDr8ZCmaZDnKpDmSZ-KPZFKP31t4Z3iw13qWJCvu0QI00DICK4clh2CGZBoKZ3K3X3Ua03vOpCoO1BCuG-RGmDouGeEGGD"
+"numQN0WCMCq4+pL1zo50v8nYOmGEvKpDEa17EqzD97YqPI08pu2CmCpCo03CE8x5EKtB9RE3ruYCv4MRS83CqOJDuK3C+BUBw8UB4SZCEKr34KJEXD13mC3Ctu0PdOUr"
+"3GHDk0ZDtCJ04XnCvG3EsOJE1EE7n0ICkOpDrKJ8jJXCmOpDuSZ-4nWF4n00o48EOOpCtSpCqaZ3nN33saZDu4OcIZO0OGZBtaJDmOZ3tg24rGZCoOZ50nY30B28uKZD"
+"m43Cv4pC1Fk-dFYEdF21t8Z3bw22tCpCE8G680ZDuKOEgNz09J00oum9puG9R4+yEmv604Z3vmW3LKX3SY30rOnuDuV43aN448pCEyt2q83ErW3EmaJEmCZCsG3CIuB3"
+"IBY1O4ZBvC3EuGZ3ZoY3d021t8J8J7cr48JDEeS9GWZDmK3CE8595Hc-53G7530DXPDAo8pDmW3Cm4JCtGJ087mUUh14CWZDrCZ3rp04qKJCv0Z5jmW3KmZ3+I24u43C"
+"uSZ3GyY-pzXEpz11t8Z4lw1DoOJDnO3EnGpDnOJCs0Z4qaWq530BquYCoGJCsWJErOZCEK6FYy2CKGZCvOJEr4i+Eq1FI0K4+hO0keO00P38nuICmSJDmaJEvC3CnOpD"
+"MuQ2Ixa0GKZBn4pCEOdECC3DmWZ3ZnH8J7s4CKJCqKZ4gr01p8Z3uFH1NulJ2qbJ0SZ3AJZ3kx07oKJCt8JDqCZxTk1DtuICvGZDs83CvGJCnOZ3LTHvjo1DkW3DvOJC"
+"uuWuaG0DtuWMP4m5+NC0TKC0uuG5QG2Eo0pDn0JEq8ZDECr8IKc7Ixa0GCZBuG3CIejE8KpDv8Hre4WhEa82qa3DqGZDoKpCtSZDrK3CIa82+NC0TKC0v4GnOS3DuaZD"
+"v0Z3HR32uSpCIa38IRY14KZBECy2ICd88aJDnuGfPKGnGGZBrOJEEC+F4apDEOX20CZ4jZX-53G753mCXxA5m03DtKJCXu33r8JEu8HmCuz43mmCuKpD1g11tCZ3p4Hm"
+"m5s4EGdCESx3E0l3883Dq8XtNuVY1aJY4CJCEqF8q43DvS3Eq0JDuCpCoG3DIm98IdO00OZ4DVY3iRX3aq31vGZ5+dX3dt01pOZ4tfHu4x03N42e+NC0TKC0o4i98W3E"
+"pu01vuWb9GmDve+ujmmCkGJDE0R340pDImQ44SJCMyo4EyC5GGZDs0ZCEKV9CO3DmWJ1NuVn0qHnb3B4q0pCvCZ4+C33oCJDtKqJIBh7Eyy9iCJCmGZCsSJCo0pCs81q"
 );
-static sybie::datain::DataItem item2("haarcascade_frontalface_alt.xml",2,
-"wP42IeCQ+t9JIr9J08Z3mjJ8mHGEt81-h1GEIaZEQwq00OZ3VI51t0Z3e132p4ZDMwq0SO3Dr8pDp03EEW4V4WpDEWZMEZF1+R84ER84IahBwT8484JDWu0B-u-c6Oqc"
-"6GWCkumeO01CsapCouWm020EksRX8KJEnu0XCo1CvCJDvS3DnuPhpuWi9omDmKJEEaJ3Qd2M0SZ-82Xn82X4+kZ4XeZQzqG1b0WCX8j-uJWGuJW35X03nGpDt81BHXmD"
-"p0Z4U6ZY5X00pu0HLmmCu43CE4iL4CpCMsq04KZCESVFK83Eqa3EmuWRd9TBI0mD+V846V84E8bB+HQ00WZ4bd00nuVvnuLvnWWDu4Z37M70t8H02Qvb6WWCsOZ3O7f3"
-"ikZ34zcbH651r4Z3G892oW3CEuvA0GJ0ruCy4u-WGOyWG0GCIKoas1F104Z3iEZ-CdbLCd54suoCpSZ3in82oOJEEqDIkwGI8OpDtumuAwm+p1WDEawTIQU28G3Eru0n"
-"OGHEoWJDoGZ4BqYpe6W-a4Yna4Y413d3RWWQlJW4Vna-e6WLe605qu2DrO3CEeRX0aZ3XM70tO17TffAEHWDn81WTmGEs0ZD1Mibe60CnKpCmK3DmK3ErKJCteD7TvFl"
-"5QDl56cJo1420aZ3H9X3EkW-0XWH0XW3Ka46q0ZDo03DsuWFDG0EoeAw9u0P3Y1DtWZCrGpC1aZcGD04rOZDp0Z3jO83sC3EueDTp00E+J846J844S38E8FIoTQ0EivM"
-"EOxO+RQ06PQ0K8ZBp4ZDnuGF2XGDmWZ3YObgSx01oaZ31vY4uJ93p4ZDtO9UHHGDnumIA0GEEOaTESRKMheL0WZ-62Xn6210qu03h0WDEeW4gTF1E4rW04Z3vsZ-bdWG"
-"bd00mu0GR1GCECXG0aZ3Ww00mum9ze8v9GJDnWpDuCJEoOJEsC3Emef5rWZCo0ZCsCJCvW3CnW3CtGZrce30uu-VG8zVG4YV04ZTEDe3lqW40Jb4lHY-02XA0215j0ZB"
-"nOZDEax900Z3Ph21vKZ3QjfYa602nWZDE8tJCa3DqGZ3QrcbDH27r0ZDmC3Dp4Z3mX01q4Z32IYozW00uuFVGOCVGuWBMAny4gcH3uGQQu0J4vlx48ax4G1Ck4JCoKZ3"
-"eQX3VZ41sCZ3KlXYX601r8Z3uh70rOnTH2mDEyWQAkB6Eq1A80ZCou0pEWmDpKZ3SXbpX6W-s1Xns110suW0huGkmfMe18Hz0v0Qpule18ae1WGEkCZ4N270quWAKn0E"
-"nCJDgEg8E4n54apCIO9E8OJEmuGx2guf10WDEG7eEulA8KZCpu0Tz8DqE00E+N74AN74QO6boT321KY3uYX-qsXJqs16quYDoKJDmuGrMmmDnGZCQmscMUy40CZ3UT20"
-"q81mbmGCoCpDM+X4EWeBEq4908Z3uT40vuGAPuSK3ulUGOiUGu0XBuGE88db64G9IS8E5NfJ57Z3RR30mq19+dh1wah184JCnuW9HIWDrumpnuGMLe865u0nUwWkuGHD"
-"uSJEvSZ3E6ZYnD00rumB+12CnW3DqKJEsWZ3u7Zp77W-U2XoU2HO910Dw1W204Z4bo21WaZ60eWK8700suG5ja19+ZS0sWS0G0JCmW3EEuWH8O3CpuWCz8vAhuG1XumU"
-"WvWWfGmDtuWWtf8o1m2Dta3CqO3DmGpCs4Z3kVdrvKW-+2Xn+2XZuK00q4Mi+xB4IvB40KZ3Y2A3qC3CnumQWYGEmOZh+zc33P5An03CnapCm8pCsWZbsK05nKZDpKJE"
-"E0eTE4030GZr2520uulGX8jGXumTkumYsfcy5v-R38-R3W0Ck0Z3LU26qC3Ev83Em4urIws00GZ4gA62qaJDEq7O4C3CMox7qSZCp0JDn0pDn4ZDsaJEQZzT0aZ-S3Xn"
-"S3X3w1g3mBdR5700WuGMTv-e8uqe8uWj71GCE0p30CZ3TX80p81gn8vr60GEEmxcC03DnWZ3UcYbbG11r0Z3IR57u8pDqaJEpWZ34daoNR00vu-rGOyrGulrtPlrtH0D"
-"kum0fH0Ct462CCZCtSZhIw21qSZ3JO22nWJDEOCLIu1fAQh1SOpDt0JEm83EIGBM0KZ3pAXpd6W-R3XnR310ruGD8WGDWaZR9D00ruW+GuGKculbD8abD4cIE0re4KZC"
-"EOyaCSJCm0Zbao44napCsCZ3OH74nSJEs8Z3MfWYZ602r03EEuXK04JWeZGCuSZrIs00vulsGOisG8nVC10DXWgRjJW-aoaPao47jaZBu03EnGZ3W631tKZ3W1fgAH44"
-"raJEv0Z3xg10pu0b8wm0Tfeg1G1Du43CpGZ3Kj40r40SMp520aZ-Z3XnZ3X3nTXW0hX345d-LQWJLQ0DouICt4pDmaJEm0pDo4Z3i7gfDP25pCpCuCpCE8i6Ea+YQkPA"
-"4KZCEmQI88JEnum4h2mDQ7N30aZ-Y3XoY3X3YI21p0YSz890nuGgI0GCEyg4IWp3+pK3+mK30CZ3xl92o0ZCIavOME-JSOZDnS3Csa3EEaH344ZCEasREcq04aJCE8rU"
-"S0JDsKZDqCpCMZVR0aZ-R3XnR3X4JgXTY6W3P3X-X6WKX60CouIDqGZCmSJEsG3Cv4Yegch64G3DEaW9EWYOCOpDnCZcZi77s03Eo43EqaZ3lVY3L6Yqnx00vuVkGOSk"
-"GuGzc9HrLesb60mDEKV5Im9E+Zq0+Wq0EGu208Z34iY34k02mKJCESwaAIu2EGBOOCJEo4JCuGZ3gfcbbq05p8JEoGpCECga4C3EE45YMBQ0+F946F94EiuH+b3208Jo"
-"HwFBme4BmuGt9mWCmS3CEy6jKSJDuCZDnO9oE0XDu4JEnuWnsuG4cGWDoOv9Dm0Dra3DEen6KSJDqa3DpeTTv1GE+-84A-84EyV7IuNhgPq05K20puG+3QnnLu-Z6qzZ"
-"EW2CEmVGW8pDv4pCuW3CpO9yY00DEyEQ0aZ3ZYZ3oBYc5zg3Sf69oWZCuGpCrWJEtumC5gC9DGGCmuVRGOSRGumHXuWJGese18XHO5G9+ZE1+WE1G4ZBoCpDEuk8Eid8"
-"CCpDsGZgskZ32x00pumJL0nDpapCtev3dvm+ZH2CnOJCqCpCo4JEEic7IRQ0+B746B74EeJFIeC6gTQ004Z3QDe33uHAew4INuG3FaX8+ls0zjMeG0pCtOZDvCpCu83E"
-"raZCE0SgAEh1EWda0CZ3uAA5ra3EpSpCM2H1EWvREWM8CCJDv4Z3x9aqpQ01n0Z-H2XnH2X3bOd4PGaQ67G0auWDPOMn1WGCm0Y3Vac7kPd-67WB6700n8X4ZIYCrapD"
-"p0JEvGpDkcD9KCJEuKJCrume7n0EsapDQgs5Eq1AECMi8GZCvuGgAAro1u7FiYGDmuY3XbZ3ct30o4EbISVZIK+gg46hjvW7ymA2n03Fot3hkmZ00mZ3Rmg8Rpg-zmg-"
-"zmgBzmg3EcX3XgWQl9W4UJa-Z+bJZ+52qu2DEeDEW83Eu4pCuC3EvuQjPumYbI2CnW3Cv8ZDp8ZCQoZ88OpCpuG-S2WCEOkJ4WJDQ7O9+hT16hT1EKoLwHQ0+h3hoh3h"
-"C8ZBpWZ3K-08vWJDu4ZDpKJEgIw1KOZCn4pDuuW4LomCtC3EXCfYO-W3z7d3BrM0zuWsS9jt5u2e34G0s0kM+RxeEPxeE8bKw5AZXxd3R-GgRxFk5qBk48ZBX+Z3gme3"
-"qyA2v4JEgMC588ZCruGZuo0CoKZCEG5LM6I78KJDuumPEuGJdGWDo81QwgCI9ulRMOiRM8HOlOOR38HHJ4-NDdJ6181glg1aEwlo18ao1WGEkaZ3wXA9q03CuOpDo8pC"
-"tewZvu0VbwGMWInDm8ZDraZcIt75rapCm0pDE4SEC0pDr4ZsXGY-EQXnEQX5VKKu7QMwU8H5Z5sa+RQ02PQ04SZBEKcReOZDtWJEnCpCuGZDI4t9Mw9D0KZ3-o85o0JC"
-"sOZCEyX6QMQ44C3DEiLJEi6l0OJ8oAD55ulZMOiZMuWxeud-jeXR810E+7u6A5u604Z3C-b4Qwa3lt02s4JEgYjMEGSEC4ZCs0Z37iW349barB34rK3CuOZ35DX3Dm61"
-"tOZrSdX-IQXnIQ10q4MI04ZUD-50u4W8+FZXMDZXS4ZBsG3Cp0pCEyE74CJCESpLEuT6Q+q08SZDouGuHuGnKGGEoe9WS1mCESSQWGpDuOpCqWpCqumqcfyl6uVbMOSb"
-"MumR8vm6Ee6z4uW1kuWfRu-y48qy4GWCkuWczw0pUWGEoaZ3x6f4KeabHD14oO3Dq8Z3wW11qGZ38gYbPI33rGpCt81hs0WCIGgZMh36+Vf56Vf5EK7DEyMEgHQ0ECOJ"
-"+JepIHepSWZBrSpDqa3CECT2GC3Dp0pCksZD40JDE0UkEuJd8SpDvev1AmGCtaJDESCAEq3o0aZts6f-OQXoOQ10nu1m9ecf14G9Ea+j+t36Er36O8ZBs0pCoOZ3BQa3"
-"nf20rOXoCgPy4G0Eo8XFLo0DsSZCESy80mZZKr02qG3DEGxB4WpDEqpE0WZ3FobonJW3HXA0ju24BuVLDOOLDuWTM8XsJvMg1umYv8nntw-dMupdMWGBsuY36bC3sC3C"
-"ruG7SHGCqOnhzfvhl4sJE8PkGCZCuSZDQkxIESJR4apDEW1O48JDEWmmIZU2E4-R+ZQ0+YQ0E4YDIS42kbQ01KY4ixc-g6WHg6W3hd11p0Z38gC0muGhy2GCE0PBA+d5"
-"Eyp94a3DEyOO0KZ36WhbDk02rCpCE4IAGapDt0ZDEiaSMNQ0+BA46BA40WZ3hRYWl2b4ePZ-4FYJ4FY3Lx1Bq83DpOJDm8JDm4pCEubmAEQ08SpCuuW+ZG0Enu0LL3WD"
-"E4AFAIa4EOxI40ZDEGAn48pCEmfmMFQ0+7A467A4ImdF08JWpx6I3u0HI0GC1KY-8DWG8DG8aYGEqWZ3HL75r83DpK3CM2y84KZCIOaF4SpDEq9P0OZ3zpXYa607o8pD"
-"qGpDnaZ3-T51oCZ31lXpKQW-x1Xnx1X5Xc10nuce18XAxuVH38LH3mGEkOZDEOLJ4WZDE8Br8W3Es8nu9efE8WGDn4Jeb0WCEOoh0WJO-fef10mCEG3Q40ZDES2m8K3D"
-"sujE8u-UGOyUGuGKG8HRLuMI3O1V+wVx4eKx4WmCk4Z3zb99maJEtO3DsGJDnegUG0GDEiBe0CZ4pw91q4Z4MPZYd6W3r742t8ZDEOiME4+eMNp5+31hA31hX8e3-fXQ"
-"c6W3XXK8BxVx48Kx48XxS0XCs0pDmuWAXH0Cve1IvgPJ3GmCuu0s2I0EmumOlIGDnOvXBuWrdXmCmGZ38170n8UpYvF4igC4iwm1Xv0PV10CkXQ00GZ3XmW4JBc-g6WH"
-"g600sumAEIXDoO3CvWZ4F2A0p8n5NePYBG0Cp81Es00DEW0D0WZd7170quW2Bw09PvWTavG6AuSd6u-VGOyVG0GDEej3EOw4g5r00SJ0auWxJuFg184g1m0DkG3DEO9W"
-"C0pDvKZ4JFJ9dQPK3WmCvaJelG0Ctume11GDEWnBAUF10KZ40G72m4JCEmDI0aZL-0Y81dXDlwW9aRd-NmgoNmg4mwWUd8X4uxGWvx-Ng8qNgGWCk4cIeSZDm0JDpGJD"
-"rWpCkwf1GKZDoW3CE4SSIWlHM6x84CJEEeYcGW3CtCZDEWYpMpy4+l1hAl1hEmnaEGmJgrq0Eyx7EGc6+NQ02LQ0EaIE04Z3pQg384B2r83CE8G5A+I38GZDmuWHuvGZ"
-"tuGj-Qf9E2mDEWtGWOJCuOpCuaJEoezIlul5iwi5iwmzHu-H38+H38XqEuWCfXmCmaZ3Pj01paZbkqW3aN80n4OkEKz648pCQQXPKCZCo43DquWIYZWCqOZsxQa-Hmgo"
-"Hmg5GSXS77a5GSX-8-eI8-e4gfg35TZ3Ypf35WWi4I21pCZ5y-84oOZDvWZ3FZYZGQ00num1AXHEnWJDoaJDI47cAV32+B1hMB1hEK32oXHH0aZ3R8X-MxWKMx03ou2C"
-"su0yC0GEEiVWCKJDo8Z4FzXbUd06qOJDtG3Dqu0GguGDa0GDI+m5CO3DrKZ3G3D1mGZ3bG50rOz7IuV4igS4i20CE0s2E8UDg5f100Z3T2b33mX-IQWGIQ01tuY34l12"
-"tO3EUaOG0SZ3dsXbd603r4JDqumcou08MJWCpefA3JWCpuW2rvGYDHWDpumW4AjnJuV5igS5iwVQLeVQLWmCkOZ48B60v8X4rXGDsGZgVdW4v280tu05qGGDquGfG9vJ"
-"301DqSZDsu0nywWxr00DEiE6ERF1+ZF86ZF80CJOFvGJLesJ381ksvlz48bz4mGBruoCIS3P0aZ3huj3r6kgLh30nuWBl0GDEOaKECSXECvFIwf1EiHwSWZCrOpDo43D"
-"Q-MG+Z1hAZ1hEiLAIGmAgXQ0E8nBEeP5+RF12PF100Z3h9e3YdW4lV72qGpDMMU24KJCEaQu0SZ3FnB0suGE9API3WGCrCZ3UNY3m042sWJCEGm3Edq0+R746R74ESVF"
-"wTu2EG4D+ti3Qri30GZ3XXD9v0pDrO3CvG3DregH3u0o4xGYBGGCsuWBSvm7kfeH3WmCs8Z3o6C3uOZCuuGRSODfTul5igi5iAHLHwGBVecH38nnewGTVu-H38qH30IB"
-"puICoWpCpaZ3jfY3oxgigmb3VLE8mSJEm4JCv4pDEiTPAYQ0GG3EqKJDEi-e44JDEqKMMJpL0CZ-HUZnHUZ3rgZ4tfgQe600pu0MNvmpTuFg184g10HCkSJEquW5N00C"
-"E85j08Z6vYjbbdW3n7Z3CC70suG3k30CES44AUQ0KK3EoGJCvuGlpuGzFgTOQul6igi6iw04Nu06N8tPl6G9Eiky+lrXAjrXESiyCOZCrCZ39+Y3jyj3h7XYW814r8ZD"
-"mCZ3pZD0qu0cne9EN1GCXEc3Az04sKJDsKJ0gfCc6u-zhgyzh20DXDY3+WWQBDW4tw40rule1uae1uWfAw0572XCoCJCmuGNoRXw3Q9J30mCEahJEOkf8SJErumBI99G"
-"8WHDoWpDmGJDE8LO80ZCoeTyCvFrhwCrh2GCEmZ6EC96gbQ0Xna3QTe7HUY8OVH41G0FV9Hjd4ylHGY-aDZAaD34suIDpWZ3MV60suGeVHWDqOH0hO9tO00DEG7g0GZ3"
-"UY00muGI4QPbL0WDEma44G3CEOJpEegzIjHErGWNSZ10puF8XOC8X0GDIevNEaP8cjPCE4TI+3i1M1i1EKP5C8ZDqWZ36f54rSJCqOZ3lnYYOK03n4pCvuGEkX0CtCZ3"
-"MIcc7K30mumFPGWDou00hummI8TeGulzhgizh66I5ElSmD00muG4Wu-+EOr+EGmCk48rEit2CapCrOZ31IhfB9X3xIC0muGBTYmDuaZ3fVcaQK05qSJEqSpCIumfCO3E"
-"vKZrW4Y-xlgsxlgUY2X317a-c6WKc606puYDvapCrumXFI0DpuGaE9XpTOvl60GDEmluEeOA0SZ3tYQedeu2AuGrLxWznvGuiGGCuej4cuF+hgC+h2GDECtA04Z36mXQ"
-"pJ00r4w4Iix9+Vt72Tt7E8-4E8nmaCJCoOpDtC3CuaZ4T6ZbSQ03rGZCn0sCvGpDmKpDt83Dm03FlmMPcHtNs56R+e08T404y8NQdXM2Om4CkCpDmaJDp83Co83DtOJC"
-"vO3FlaX78mpBVL01Lu31yyL6C048WmJ8jq28q9NPb1oCu0IBj8p608JA0qmAW8tRlH78kz6PbfJB0G28WmZPb56Tr9NPkC401405y8NPZHtS+O1000I08oYDW4JCWC38"
-"v0IBnuI0eM1fH401yyL0aW0DWCJ02Km84mpBIz40em3Tfn6TbHcFmmpBDe01yyYKG20SyG7QoLsSez6RavJBmu2Cq4pCu8ZCs0ZDo0JDvGJ0+Kn7oq800mJD6I4Ck43E"
-"vGJEraJErO3DmSJDqSZaZ60Fr03EnOJEnS3Dna3DpCJDvOze10GEwON0+FQ06EQ0W4JCW43CW838ou6f1GGCo4G9G438n0YCbKgCx4G01G0FVLGI18I4auVo1uIo10MC"
-"k0JDp8pDoapDvCpCpaJEsWJPj03CpmpBAwS0uO3DrGpCsS3Cq4JDuS3EpOPS3m3DtWpCs03Ev4pCq8JCsCJCIxS04G3C+xS02xS0CK38s0IOof6S3WGDWSJ9Ax-R3OqR"
-"30aCk4ZDqWZDm0ZCp43ErOJCmugf1WZCnK3Cp4JCqS3CmCJCtGZaqD0FqGJEvWZCs4pCp8JDn4JEmOjf10GC+RQ02RQ0GG38v0IC1ElQd600qKcS0CJ8ENsS+-q0kyq0"
-"4LZBsS3DtS3DuS3DvCpCmO3Dm4sJ0GZaFD0FpSJCoOJCma3CmG3Co0ZDv8Pg1mJDq4JEpC3DtOJEoG3EvOZCMdQ008Z-f6Wmf600n46BXHbQf603s0oDW4m8+VQ02TQ0"
-"y0ZBnSpCtK3Eq0ZCqOZDtSZc+Q0Fr0ZCpO3DpapDmG3EvK3Co8Pe1WJCo4JDtGZCm0ZDuapDv8ZrXX01qCZ-X6WmX607q0IDW4ZCWOZRX606u0IDWG38suVe1OKe1WKB"
-"ouIEmGJEsaJEsO3Cpa3Cs4JDXXabNQ0Ep83Dm8ZDtapCoGJCr03CQYq0qC3EnW3EpapDuW3DpO3EMN624G3D+VQ02VQ00WJWDxWv9e6I300EEmY20GZ-mJWJmJ0GnuYC"
-"oaJErCJEr8JCpCZDrKZgd609q4ZDrK3CtWJDp4id4K3EIwq0uKpDmC3DuOZCmGJCqSpCpezf10GD+VQ02VQ0C4JDW4J92w6g14G90KZ-2XWM2X0Hru2Dp8JEoCpDv03C"
-"sS3DpGpCX5bcPQ09uK3DmGZCuWpDs4m00CZbg609rGpDrGJEn83Er4MYQB420OZ-g6Wng6GOjGGDWONg14g6Xeg-QQWGQQ0HjWZBp8JEt8JDu83DoaZDqS3DgAr0u8ZC"
-"mG3DvG3CoaZCuCJDoOfw9GHDmapDmWJ8c2nCnSZCseDaB0mD+ZQ02ZQ0Eis20SJ88gM+4GmDW4W00OZ6RrW-edWBed0Hnu2Cq4pDsC3CoKJDsWpDvWZCc+q0yKZDmS3C"
-"sOJCrG3DtaJEu4ZaFD0FqC3Cp0pCs0pCq43Ct83CuODw9uFgGOCgGW0CW4Z3vq00musf14098C38rqofE9m30CZ3bXG5YuVo1qJoO0ZBmCJCo0Z3Sq06qOJEvS3Ct8vg"
-"BW3Ds8JCsKpDnCpCn0ZCq4Zb8313sa3Eou0tBm1DsG3Dm4ZCrOzm1uFoGeCoGuG+EetO8mGCs0YC+F62MD62SSZBua3DpK3CESq2KaZCsKJDv4cQMgW2qKZCsaJDvGJC"
-"v8JDmG3EQch1u8ZCsa3CsW3Cs8pCmK3DrOTk60GD+7A4E7A48K38oO7k6uGJD0WC+ZW2EXW2Oq2DkCZDqKJOEWHCrOJDna3EgQQ0uOpCraZCoCJCoSpCsKJCnOvLDW3D"
-"rCpDvKZDn43ErWpCsSZr9e00ruVeGOSeG0GCE0151kiQtQ01nCJ9c2GD+-526z524SZBEWH380JDv4SWGWpDv8pDksq0mS3DtOpDuSJDsSJCpWZbqJ0AoS3DmG3EpW3E"
-"m0Jn2BDz40GD+-946-948038p8XsEecf100CIql308Z-b6WHb6W3TT1CoK3Dp4JCpapCvGZDqummEeuZLWZCmC3Er4JEvS3Er8pCoKZd-d04t4pDp8J0sWGEq8J8MhC0"
-"P0GD+-946-940WZ3xd00qO7NN00EEi05EON3Mir5+V32gS320XZBo03CmO3Cn43CrCJEnapD5+kbEr0AqK3EtGJDr0JEpWZ3za10s8v-9WZDn4JEuO3EnKJEoa3Dn8Zr"
-"-d00ru-dG8zdGG0EWumQLeMI3mGEW43E+Rl3MPl3y8ZBv83EqO3Cm4ZDuGZDsKZhTZ13r0pDnKelG8JCoaJDQEU2y83CoWZCmGJEqSpDn03CpSZrlJW-V2XoV2X-hgX-"
-"hgXYhg1GquIDoKZDqS3Cv4ZCnCZDnCJny2GDM2x2aWJCo43Cq43CraZ4XyWaqD0ErGpCmWZCnSpDsCJEm0pDMhR50KZ-23Xn2310tum4KumP8e6T3K09EG57fkXJqrW4"
-"sGH6ZulF5qhF05ZBp4JDuC3CvSpCv03Ep0JDIqp3MEz2uGZDoK3EnCJEs43Coa3CrO9ZIGWDtuW3M0oCo83CoKZCvaZra310ruFvGOCvG4sbG438q02DkjS01KY3jY00"
-"oq2p+dQ0oaQ0uK3Et0pCuapDs43DmCZCm8HDKOPg10HDpWZDouWjVGXCp83Du8Zb6U1EpGpCnGZDr0ZCvSJCsGJEMxi60KZ-c3Xnc3X4EY02p02EkXQ00aZ3oY02n02E"
-"+7Z2Q5Z284JDpuGBPGGCt8ntL8f55W1CoKJEq8JDEif680ZDuuWwE8ogX8J448JCZGJDm0pCo8ZCu8pCnGpCm4AWE7Z2+RC4ARC48C38m8XHIec558H5UuWxGuFsL84s"
-"LW3Ck0JCqCpCqG3Em8pDu4ZdmC20ruGK8G2DqSpCuaZDm8ZDMoY2W4JDv0ZDp8JEqK8x0GZrRy00suVmGOSmG00EXnXTiJ01v0Y3ge00quFe1O4e1u0UNG3Eu4pCuCpD"
-"s4pDsCJDteww4moDoWZCqWJCnapCrGJ098fN8W3DsG3EmG3Dn0JEpG3DqWZrhJ00suVmGOSmG8HvY00CEC62kbq000Z4x+XRJNX4Uv10rKn8+Rh1TRB2vuICE4y4GGJC"
-"uG3DEez90aZ4feWbJK04rKZDoCZ3X315mGpCpaZDMED9iCJEoCJCv4JCp0JCsu0yQ8jzB0WD+NE46NE40CZ3vr00uO7HFK09cGq3oWX11401yyb3Cf00vqn8+hS0zeC5"
-"jKZBuGJDI0h48KJDo8HSNOAiIGYDu0pCpaZCtOpDE048E8z7Awj10GZ3qY01oSZ3g623tWJDsezo1u-3HOy3H8HQe0WDs582Ii7508Jebv-za8qza04Ck0JDqS3CtSJE"
-"v43CsWpCsOfR3GZCrOJCsSJCnCpDu0JEtePpBWJDo0ZDn8JDvS3DsKJDnKZrDl00su-2HOy2HuGhIede1uGHPuVe18Le1WHEk4JCq8pDE4v700Z3CM10neAI3GGDnu0M"
-"c00CEmt388pCvef9AGpCmKpCuSpDmKJDsG3Dv4MVARY20OZ-94Xq94X3xN10t8Nt6GWCWuWiS0mD+R82AP82ESY2iKJDtK3Cm03CuGJEpuWy9ee+LuWeIG0Ctu0Cb0HD"
-"p0JCmOv9AWJDnOJEma3Du03CvGJEmaZriA10su-tG8ztG0GCI0I6g182+pB4cnB48rICk83Cr0ZDm0pCqG3Cu8pCq4JmJQv+LmIDtCJDma3En8pCrKZ3sqYbfe00oumX"
-"IuWfDGHEs43EoCZrUXW-z2Xoz2X-pJY+pJY3SQ20tuGhf4IhI0W7XagbPQ0Dr83EvWpDu83Dv4ZDuCZ3M8ZZyW00mu0E8mHCv0pCqaJDtuDz4uVlGOSlGWmDW4Z3wuXS"
-"d2J1aOI3Kuq1AG0EW8HAWuVfmOLfmmWCnWZDXH75s43CnapCksP3uOJDtKZDpa3EqCJEq0pDpe9T3mGDtG3DEac5KSZCpK3DneDT3uVvGeSvGuFT3eFT3WKBpuoCoKZD"
-"sGJEmCJEsWJDt8ZDcMt0aCZDoW3CqSJCmWZ32GX3ZJYYrD0Dr4JEr0JCvW3Dn4JEq4Z33fWofX00tuVxGOSxG0WD6Y620SZ-dXWSdX02p83EICu5KapDsG3Ds89CKGJC"
-"oW3DoOJDvOJDo8pCpePgXWJDmGpCqW3EtG3Cv8JCm8Zrlk00tuFwGOCwG81bS0WCwfW2Eue4EeCCMOK6+hl3kel38CZBpuWZkGoDn0JDuGJCmG3Cgcq0COZCv8Z31a35"
-"oCZDn8JEEah6Acq04GpDEWd2WKJErCpCn4JEoOjgX0mD+NC46NC4Equ28W38o8NOe81Pt8XAluVg1OKg103Ck8JCvK3Do83CrCpCEuaE0SZbCD04qWpDtCZ3yE33rapC"
-"tefLDGIDmOJDm4pCtOZDEqOB0KZrpk00tuldGOidGumUNuNxp81zau0Y8uldG8adGm3DkaJCn4pDmW3CsSpCrSJDMGPDMcW20GZ3Z219m8JCqGpDnWJCtO94KWIDsOJD"
-"uC3Et43Equ09Pezf1uleGuieG0mCEGg6obW2Eq87EGhE+hq0Afq0e4ZBuS3DqaJDmO3D1kF1o0Z4uMXbQr01q0Z3I837q0pDoKpCoOZdyJ21rWZ3aY00nuWPqm0EuW3D"
-"IhL30SZ-b2Xob2X3zWW3WMZQ2yG1a0WC+-r5Ezr5eqIDk8JCtWZDq4pDIOL84WJEIqF9M2r0uO3CmaJCnOJCt8pDv0JDoOPHeuWlXWoDmOJCn83Es4ZDpOjZB0mD+hA4"
-"EhA4Ema4orx70WZ4adW-HhXJHh19nuICn4JCr4JEvumszWGEqOJPEPff1WmCr4Z3-g30uK8mUox7CKZCuSJGDG1DpW3ErWJ0gviYBuFgGeCgGulJ38lJ3m1DkG3CpO3D"
-"muWeGG0Dnu0kuOQCDW3DsGZCoSJDuOJEuGZDpGZcnd24v83DmWZ4-S13vCZCvOjIe0mD+RA46RA4ESs20OZ3HdYQrJ02p0oDEe150CZ-4XWH4X07muICo8JEvGJmhG0C"
-"tuWYp8fv90GDE02D08Z3t234q0pCtGZbaZ34mOJEnKZ38v11uKZ3eJYr0-10tuVVGeSVGuVI38VI381FN0XCp4pCruW6cWGCoSJuGh8FNGHDuW3DraZ3L912mOJDIOvC"
-"EsI34apCECyC8W3Evu0ZweTDt00E+R746R748038muNE8u0KDuFE885E8W0Dk4Z3T719pa3EtOpCq43Eo8n61PPa6W1DpSZCoCJEE8020KZ3hdWavS1DrWJEpGpDtSJE"
-"tK3Cu8Z3a-ZoHQ00uulUGeiUG00DE8s2EClDgjE11KY3KMZ-02ZJ0237puIDr0ZCsGZ3rK14saZCtWZig606oSJDr4JCoumtY0GCXyjYFDGWe3XCt0JCruWkaGWDtOTC"
-"D00E+p746p74IyI3wbQ00CZ3vtZ3TxW-OxWGOxGXoxWwHmXCsapCnKZDme9BDmICv4pCnC3Dm03EsGZ333ZbDDW3N-14p0pDsGZ3MtX3TMXpDDW-x1Xnx1X4KYHOfu6J"
-"3u0UVu0vYu-e18qe1WGCkGZ3py15raJDr83CEmIIgQy4KKpCmWJCtuGjG0XCmSpCpOPrTG2DoGpCrCpCm4JDEWxHE0C9EVQ0+l746l740WZ5wcWS6FH0a0GCY8j3EDe6"
-"QCsAUSd9+3P5k0P5COZBtSZ4Dr07m4pCn8JDuaZgA702sCZDECoG8S3EquGwY0GDMw7C0GJmf31Es0JEmuGzmejyp00E+t94At94I4KGESY4k9t004Z3AlW3ICY-HMXG"
-"HM16tu2Cn4JEs81lxGmCtu0PLOQKDumwYm0EpGZCESS58WZDvOvP8mmCm8ZDEOs3KCZDuOZDtuzS3uldGOidGu0nYeN65uWlEvF658565mGDkG3CEa+BG4JCmG3EEGWH"
-"0GZhb6W30628o4ZCt4JCpC3DMwq0K8JDrSZDuu0-nu0Wj0mCMxsA0WZ-T2XoT2X3HqYUtv40numJyu0dVu-l68ql6mJEk0ZCtGJEuWJEmO3DrW3CMCx20GZaxx0DqOJE"
-"saJCqWJDnOZDrGZ3MaXZ9e00uumuY4MjC4pCoKZswS10uuVdGOSdG8n7X4oXgHF10WZ33aHm0x-f18qf1uWDcmHCqS3DqK3CnOHnA9fe1WGDmKZ3r+31vOJmOIGCvOf6"
-"XWJCr8pDnSpDvWJEqWZCuWZrdm10uuVdGOSdG0GEE0x940IDk5Q0IKhB+7Q0I5Q0Eu3280ZCpu0CpWGCvOZ3BgXgLQ06sK3Cua3Em4YS8KZDnuG7DeOI300DXDB8mG3C"
-"naJCsK3CQZoI0aZ-X2XnX2X3adWUd6G8Axlf1Obf1WWCk0Z30u24ra3CtCZ33g10qegb6WXDoGJCu4ZDEWGL843Etu0I-uef1GGDnuWdyu0k-WWCuGJmBhihB0GE+BA4"
-"ABA4EeKD0GZ3PxWQmJG1b0WC1KY-adWGad0AjaZBvaJDnKZDuaZ33h22rWJCgwu28C3DpumWrWHCm0ZCtCJCEi02AgQ0Equ2SaJDpW3EuWJEEeAHIl270aZ-Y2XnY2X3"
-"bAa3sNaQe6W5hEZ-89XJ89X3Tb4BrS3CmS3CuOZCtS3CEO34AAP5X147mKJEmKJEpWZ31X00y8Pe103CtG3CtS3EqGZDnapDQR1C0aZ-W2XnW210vKodoH271CY37eW-"
-"7DWG7D04quIDrWJmL1oCmCZCrSJEq8Z36kWbVd03pW3Cr42r8GJEr8nYHPPf100DES4CWapDt03En8JEuODVQ0GE+x946x94ESp504Z40HYQ8DW3+Z10su06tuFu984u"
-"94MI4K3DEiMN803CpuW6GHmDu8Pu9OHs901Dt43DmumKzO9f1W0DraZ4J0b3Te02t8pDMxd60aZ-u1Xou1X-KQW+KQ01suY3ev23qOJCquWCVm0Eo8JDXrabVZX3lTX3"
-"F4Y3Sy51rOZ38WWYJQ02qK3CXD86vSpDvGpCqeTid0GE+Z746Z748O38s88F8G0EWumaLGGCquFz4O4z4GIBsu2DtaJCuCZCEOEAC8ZDqKZhxW01pOZ4S322vWJEEa2F"
-"Qgf1qCJCmSJDt4ZDm43EsSZDQNF1+l74+l74+l74+k74CqICkGZ4+h48va3EpW3Cn83DgYQ0GO3DuSZDE8c408Z3JOYd-630tumND0GDE0EJ4OpCUtLA0aZ-y1Xny1X3"
-"8QbUu-a3J3a359X-2XWG2X03nu2Dsum0BH1CpGZCv0Z3OuKWrh9b7X1CpGJDta3CXoY3bpac2X03r43CsuWD-00EECRPMJvH0aZ--1Xn-1X3+WW3DqWSYG41naZ47F10"
-"vq2gE9E61Wa3vMH4au-uOuouO0qDk8pCo4JEpWpCr0pDvOpDmewzTGXDpWZDuSZ3c+X3Zm10nePhQG2EoGpDpaJEv8ZDIOjOINL3443C+RA46RA4EGqKwjp5E0OI+lp5"
-"Ijp58q2Dk8HZL0GCIqtPCCJEq4Zgd605oa3EsGZCEG2504Z3WJbbyS13r4JDtu0UdHHEsOZCtWZ35tWoc211n0Z-d2Xod2X3V630ouWkBesjBuVT3OVT3um8FW1CqOpC"
-"mW3CEWIN48pCMgz2CK3Co8Z3g755qaJEqOJDQcg64SJCIeNQG0JEtO3CEyc4Q-s0+NC46NC404Z3AeW3e9cR77G0a4+19JkJyK02p0ICEy1A0CJ3Zu-E5uoE5G1Ek0JD"
-"qGZ33G43oGJEtu09L5E2Ms-2EWkI0GZ3fVa3fX30ru0RuuO-BWXDnaZCtK3CEiVPCCJEsaZsC7W-m3Xnm3Hm+QnofuMp100CEyX7bqg-hAaFhAKOnnIEr0JDnC3EvapC"
-"oOJe4e8bI0HDnK3Cru0oIGGEquG2RO9DZmXCqK3Cs4pCvuGl4X0Dv0Zrrn11n0Z-m3Xpm3X4EzWTF6Y44Wa3iUXSoDW3A5c-G6YIG620uuG0QH1Co03EoKZ3Mr52vC3E"
-"c6t0qGJDtCZDsaJCpKJDt0JDU6OLEy3F0CZ34J13oWJDrejX-GGCmuF6HeC6H0GC6Q8CQ8jG+V8CQT8C8O3EuumOVnmCmCpCE405ccQ04C3EE8UHC83CnCZ3LJ20sOvZ"
-"X0HDqWpCsu0+u0mCEiS8Q-O8443C+ZH46ZH40KJOmf7hN0GDXYHOJb6T+Fi1TFC3ou2EmumEGvW5e01Ev03DreQrp0GDEKlI4SJE1gE3ma3DtO9QKu0yf8HV4H1Cs43E"
-"nCZtEYW-O4XoO4X3AYW387bR1RW5avc3YJY-1RWF1R01quY3dy55o0JEp83CEGVA0aJXwRPjNm1DmKJCrWJCv4W04CZCEie4Ak62EayH0GZ4fz54qKJDp8Zt6RW-P4Xn"
-"P4X3dX00nuWIKuMg1m08t0IEYCX2EPZ2Em8200J7auFT3q7TIWR8eS3Dn03EmCZCnCpDESp3Eo8248JEEGw5G4pDqCpCEqr8IcJ44CpDE0IGOC3EtOJDpCZt0l21n0Z-"
-"w4Xnw4X3l-X3DzWQ57G0ZuWNHuFR384R3GoCk43EpCZCpW3EIiXP4SJEg618OGpDua3DmOZ3wl20qu0la9ff1mWDuaJDIKWSGGpCrG3EEGHREls3EWR2+-8Uw+8U4K38"
-"EC0Kozr8Xbc-P9ZKP931tuY34U62r0JCEObTCWJDqSZ4gOXbIK0DrC3EqG3Ev8JEtWZDsWZ3UAaYIK07paJCu03EmaZ3-S52nGZDIr084mpBEeXU0CNaJX1FpHNOdLsN"
-"vvDArGZBs83CmSJCq4Z3iR25u4pCmmpB+K20D29By0NOoLcRqvJCnmpBDiG4Q0YRbX7T+qICyyI198I2wPItu9HfwL0MEi32PT10y8pd08nKwr0L14G1s4W800Y-TDXn"
-"TD11t0Y3YeXS0s60v8n7Qu-vt8rvtG2CnS3CraJEoaZDESG20CZb690Bpa3DuKZCtWpDoKZDEuLEIo+0KSJCq8JDp4GEECfAEuP7Ep+0zCT01aJ+94G99xVUy9JUyvmJ"
-"CGGCuOdiWuWk6vGvRullFualFWZCnW3DmW3DmKpDu0pDv8Za9yX3OE41p4Z3sBX30060tOflFumUlG0CnuGTDn0CvSpDE4WO08d8uuNOf501rDZDu5G9sLsF+to46to4"
-"0SZ3dfY3CkcQnS00tOX2JulCUfaCUHWCkumoIW0CqaZ4IbZ3HPc3ltWc6DW3Hx18tO3CnaZCuSJCEKlPAoO1SKJEuSJEm8ZCEKV38WJDnOjNTu-1Jey1Ju0+-0GEszxV"
-"E8x604Z3TgW-7DWG7DW3b970tu0KYWGCpGJn2BnjROvhKWoCoOpDr83En4ZDtuWamPPxDWGDsaZ3J681u8Z38241tSZr27a-8CXn8CX3Gv31p0YS3ad336e-UVZKUV30"
-"r4S84WZCES-AI4y80SZ4yfWcAD07mG3DraJEuaZ3xT20vuGhIueI3GIDp4ZDrOpDq83CEKpRIPD222F1+3k4A3k4XKgVlHZ3rob35nW5YmG567H0EGMWXaS6ZulvDeYv"
-"D0XDkSpCtuWzyWGEuKZ4Qud4SWXc9703sK3CmuW0JmWDoaZDUINRaKZDt8ZDp4ZCsCZ3PlcswTd-0CXn0CXY87G0Za3fETS0EW83P8Y-67GF6pmCkGZDEytQ00Z3Iv33"
-"mCJCp818JOfwW0mCEO9GEW+2GGpCp0ZCEGB2E+u0mC3EuSZCt43Eu4JCmCZ3rWZo-XW-UCXnUCX3Rk01n0ZT9o50v4W804Z3A2KQGw-f1qpf0rIDkWJDsCpCvWJCvSZC"
-"vCZCMavTMkj188ZDvuG1hW1Er8JEtCJEEiO7EYQ0mGJEuSpDuWZCm0pCtWZ3yUYoe6W-TCXnTCX3jQc3cIXSjl40pKm8E0F5+dQ02bQ04WZBEWwGE8uB0KZ4iEahGjZ3"
-"NN72pK3EEiC5C4JCrSZb6324oSZDoWZ3bQ14p8ZCqGZ3X6Zoe6W--BXn-B10su0Qy10CE4XGg1z204Z3GCZ3xWHAdwK6581CAcn8+Ft0kCt000Z3oQ41u4Z3dw32tKpC"
-"EilJIMP3G8JEmaZDEi-VGW3EvO3DEuQHEws0K8JDv83Dsumc6omDnWpDM3QO+3o4A3o40aZ3Mvd3V2YQ67W4+wZ3RHY-mlWGml01jWZ31972pOpDEap3EGm304Z4nlWb"
-"4Y08rWJEoKpDt4pDECPE0OZce6W3hbLeEHWCquG0V0GDM7-204Z-U3XnU3X3i5JOp9tf1uGWRuFrUe4rU0GEE8-2GaZCqaZDIuaP0KZ5LJZbb601pKZ3tQ60qu0AMHWD"
-"m8HEMuOJ3uGkBYXDo83CoO3DEKwLMNa8+FE46FE4Eic5w9E4ES82+ZW2IXW2EW9B0SZ3Lq30muGwGumMq9nVdOP2A0GDEmyN04Z3mXO9cRPqUWmCr0Z5UN44sCpCs8Z3"
-"sb50oPCYI0GC+FE46FE4+lq0klq0Ey9aGW3Do0ZCEKf74CJE56e9yTXCWSWBV291r4Z3pv21rSZ3nw31rCZd29f3Ql00vuGrtnWCnGJCEu82E3Q0+tD46tD4EmtQwjE1"
-"E0UYc8+8+J32gG3204Z3dub4N3X3jM52u0ZCIKi7MY32GCJCrSpDEi5G0CZ49Gdcuu2CpCJDpSZDoOZCsO3Dtu0x+uSf1ultGeitGu0sSumlleMa68nB+vFE885E8u0X"
-"nmWCo43DEWQ200Z3S+bgiJ08qGJDn8JEva3Cbug3oQZZIQW30f01rCZ3VA52n0ZDUJH6+pB4EpB4EeIZ04ZRc6W3Rhb-b6WKb602j8ZBECSV4CJEE4DACa3CvCZhxE22"
-"p0pCE888GapDsSpCEi0OIgh6EqfK803EuumSNWWDvaZtI8Y-S2XnS2X4fKaU5k00nu0yLuFg185g1WWCkaZ3gu50muml7wmbE20DISg7MIF1CGpDu4Z39yc3rK91m4Z3"
-"kXWYDD03sO3CsuWf8I1Ev0JDqWZ3shXpqJW-R2XnR2X4PfY3yKYQqJW4IyGeSOXyEu-c6qzcKqICka3Em8Hz6H1EtS3DpWZhKx82p43EEmyB443DECYA00J8pf8g1uGE"
-"PHWDou0V80HDvK3EuODrq0GC+l946l94+-q0s-q0EWmC00Z3MtNWp3nCsW3Cr81rEO9K3mWDq4pCEalHEC378K3CnOvGb00DEyMCMel6Ca3Eq0ZrlIZ3fAc-SEYkSE20"
-"uu0iVu0fQe6K3e1X1wl12va12H2DkC3Dv4JEv4ZCbOA0vOnrEO9g10GCESTGEi+D8K3Evu0CIQvd6u0exGGEsu0uLoWDmaJEMpHC08Z-y1Xny110suWkV0GEEC38oDTd"
-"4O38ES2E+ZF12XF104J8d20CEmu44WpDEGwN04Zgfs25qCJCs4JDES2J4SZCEezLMUQ0EeD6WOpDmK3DnSZDpeT2S2WC+x746x740WZ3LSXU+VZ4ila--VZK-VZ3qeY3"
-"Vi05mS3Cn8pDE479IsM5CGpDpKZ3Pj03s0ZDsu0uMAfe1GGEmumiOwG9IGGEpumpJAD8I0WC+h746h74Iy99w5Y4Ia1B+BY4U9Y40WZ36f78taJEv4ZDpKZDk+JM0CZ3"
-"6+10uuWFj1WCEKLFMQZAGKJDtS3EEmtEKWpDtK3CoOzIl0WC+B84MB84wzu2I8B6EmhF+VqB+SqBG8ZBoa3DEG9Z8SJEm4MKkA84EetGEKJTEadREecNIsq0SOJDu03E"
-"tSJEEKB2Em72Mtq0+B84AB840KZ3O7dU-WG0b0mDEu3Q+Zf16Xf148ZBEe8e0WZ3j2b3O+71pWZ4tqWbMS10ruW2jH1Do0ZDoKZ3TMbb-WW3mU37uS3EvKpCvCZ5K+Yo"
-"tq00ouFXGOCXGuGf8vGnYecF8umZcvG7XwlJ38aJ3WpCkK3DrK3DrapDoW3EpSZjWf79pWJCrGpDo4ZCs8nAC9fJ3GmCsu0rEWGDuKZ3F330mezxB1WC+F846F84EiAC"
-"X8eQb6W3aBe3oqe-b6WGb608vuYDn03Dt8ZCIukb8K3Cv8XpJOPYB0IDoKJDvapDnWZ3hb30te9Al0GCEOaGE0bICKJEqGZtcC60ouVWGOSWGOHXI9dWkO1h42GC+NQ0"
-"6LQ0KqYDk8pDuumgAYnDu83EtO3CkgFeq8ZCt83ErOJEu0JDs8ZCEeV9E+7404Z3Sd83m83DnuGu1v0fcvCy4u-VGOyVGu0OQuWTL8tI3uG77vF0Sg40S2mCESIJ0WZ3"
-"-k90tuWsq1WCkMQ08GZDou09Im1CuCJDpGZCqePZk0WDEieZCaJCqOJ8YxGAseSf10mC+tSC6tSCEytDEmBKoLQ0E0E6+p7FMn7F4CJCEqJA0aZ3dLb3AbYgcf14sCJC"
-"tKZ37P20nuWVye93c00DEiL30KZ3Lt93pSJCneTYB0mC+h746h74ECtCICCZgTQ044JCICTCnraC4rH01OH26wWTD4n8+NP5gKP548ZBEedeC4pDv0Z31F71p0ZhT213"
-"rGZCnummn0GEEy+F0CZd0iA0mumg+uGrawmVVeTrT0mC+t946t94E0J3+fS01GY9KVYJ97W4AII6ZuVo1qJoCCZBv4Z3ea50vuWSEwmUwvAX8mmCrW3DEek3G03EuO3E"
-"QcJ1OCZCtC3DrGZ3l622rOZCXulpvKW-43Xo43HOAfdAA0GCEyKE+lY2IjY2EGz904Z3vq00qumlxXWCrCZ3dzXY15Y3eD92rSZDE0978SZDtevmpG1DvSJDtWZ4XQ83"
-"n4ZDpODiL0mC+-B46-B408ZYPy00ouWQr4oe+3R521R54SZBEeAE0KZ3vMA4qa3DuWZ5gzdcOyW3Xp20nO1sXH0Es4GDAYY24CJDE8nDEKcaGGZCsW3DQVQ0+7C4A7C4"
-"+hq0ohq0G4ZBsOpCEaY40KZ31YW3aue3HSZbrr01qOZ3Oi81q0Z3GG11n8Z3YNbYd6W3Dq50qumgwvms72WCQx470CZ--2Xn-210ou0viuW+xe6X88XJUvW6MvF7F847"
-"FGmCkumldvmYiuWuEWmDm0Z4kL30p89NNGGDouWFX01DoCZCvu0OOQv3KGmCquWlr10CE8af84pCuejGo1mC+7C467C40SZ3BX20sON7F0mDE8I6EKz2+VQ02TQ0EuF6"
-"48pDE0z9EuVc40ZDEaP2AUf1WG3EpGZDtaJEsu0Y81GDQo8c0SZ3KA11raZ4nOY3N-XqnM10pullGOilG0WDfudS-2X4hnX-Y6WKY603puoCv8XisW0CvKZ3+Df5evgb"
-"9D01qKZ3FNg3Xe00vumb1PPZau0wNvGFK0mCEug60aZ3nqepXdW--2Xn-2X3zDZ33cYSe6G0bu0ffuVQIeKQIG0Dku0HSuWodv0K2w0+qOQc6uWJf0WDEKo5ECfe00Z3"
-"wAaYPQW31o18o83CvOJCrS3CICNjAdQ00GZ-33Xn33X3ZJhU9kGA8xVf1eKf1mGCkG3EEG2X8a3Eq8Hnb0GCgIk8EezcXCUehWWDp8ZbED03rSpDou0nVmGDnOJCEC2Y"
-"INF1+ZVkAZVkXbIA6gsF84G9+xq0Qvq0SqYDkaJEvKpDEONFEuDU00Zhza57p03CpCZCm0Z3sP90p8nSXfuJ3umLy1IEm0ZCmGZDrWZtHda-vdhovdh3zCZ33dWQe6W3"
-"AnX3R+X--WWK-W01raJmX20CEuv90aZ3MDdY-W06r0ZDtCJCvuWJGY0DuOZ3jLbYW604nOpDrKJOzIWCmuGDhQjBc00D+d746d740WZ36IYXVBY3VNa-nJWInJ07tuYD"
-"pSpDpGZ3uu25sOJEsWJEcQf14GpDEmZXEy4NEyOYESPIAUQ0qS3CuKZDm43Cv4pCuG3EQFfP+ZVkAZVk04J8d66JgXq004Z3X2X32aX-9DWG9DW3K340puWRsuGAno0E"
-"vaZDks32MGF308Z3Ow61tKZ3aagYd602o4ZDISB74SZCICZkQZf1+t746t74QC8hoD4HEyzEE0M8UafME9P50WJ8Bx0BZuFII84II8nwJmYCuK3Eu0JEv0pCoOZ3fydY"
-"LKW3f060uuGV0Z0EvSZ37-bat+X3Mg70puWJDumx4IGCrOjFo10D+t946t944S38EOCh0CZRjDW3IuX3oUa-iDWGiDW3Iu10ouWlCo0Cn4pDEOuf0OJfKefwJ0ZDuOJD"
-"pWZCna3Dr4JE1KZYjD01q4Z3Fy42u43CIOimEiV5Ehw2+p946p94ISCMEyw2kHH1Ea52ImuC+Bb9+8b9EWnYqOJDnO3EnGpDnOJCs0pCIi+4MYQ0GGZCoGJCEuVK0OZ3"
-"z1A0rOfgaWHDq8JEsaJDEGlR8K3Cou0c8uCg1uleGOieGumLw1WC1KWQe6G0V4Q6D6lJKK00numpaq19+Vg6gSg6EWc4C43CtKZ3-uY3MFgce910rumoWImDruGN1wmh"
-"O2GEIIH1G8JDnGJDIiD7Em-2Q74H+VXkEVXkECCJ+d0KUd0K1RB0pu03XmWCr4pDEqIjEC6GAQh1qSJCvGZDs83CvGJCnOZCE4rKE2H1eW3DvOJCuapDnC3DE8v5INn3"
-"+BXkABXkEOy2EK+4gTs0EeS5+3sAI1sAKqYCkWZCmumnF12DoOJCqWZCpOZ3AlWbEK03pW3Dm8HL-HHDtaZCpWZb8D04rCJEqGZ3V0B2pSpDEe5nMRQ0+tN86tN80GZ3"
-"VEZ41eWQe600quGur8ndiwFk6O4k6WWCkSZ3xeC1v0Z3KS73uSpCv8HeCPviLuGlM20CIagI4aJDEWvVIAF1CGJDsaZ30e81vSZ3iN10pOTn5vV5wgS5wAnHOw08weMg"
-"18nnQ8XpBuFO8u3O84Cb803CquWX4oGDtaJDIixZAAF1EeEP4KpDEu820SZ3g3iblP20ouWNjv0fX0HEm03CouWMG2WS6JdG+RXkARXkE8+4EG1A0WZRZ600n8nD4xWb"
-"ca6JIn520GZ3nrG6auFN8e2N8WIBuuICqapDuG3CruGNSv0fi6g6M2t0ECu700Z3h7Z3hH80ve91Zm0DsCZDIeIEGGZCoO3EE8t3ExS0+7M867M80GJXox0srfMS3KG9"
-"EaG4crS00aJ8Cdn8+pS0kmS0GOZBuWpCES1VKK3CuCpDv8xDZHmCqumx2YGCmSZ4VQY3ZfWYCY08r8JDqOZDm83DEWgS0GZ3ZfWpC7W-94Xn94HOHvGQ887SE5G9Eqo8"
-"UO-2+hQ0keQ004Z3fL91vCZ3FvC2q8pCES9VXPdcuUa3Xr88mGZCsSJCo0pCEqw7AgQ0SG3Cu83CuCJCEKuF40JEECT3EhQ0+pE46pE4QCh4wrE404Z3pLb-1OXI1O11"
-"nuY3H552q4JEEiY400Z3ZfP8dQP75um96JIDpS3Cs4ZDv4ZCQgAJ4K3EEW-aE8V8CaZDsSZ3drepd6W-j3Xoj3X4c8f3E3XQTKG0buGZ8uVK3uKK3WWDkSZ3We93vaJC"
-"n48b4G3DgEp8a43DsW3EtC3CoCZ4M3C0s8vDAWGDnWZ33xA6oKJEm4pDvuTb8u-xGOyxGuOg1Kinb2Y-teWFte00o81AeGXDoa3DtWZ3v-i5HKbb8s05r8JEpKZCEGVf"
-"C83EvCZ3FceYuJ03pGJDsu0L6nmCr83CMSjOE7r0+7P867P8ISJBwztFboX--zZK-z31puY3YFi3sng3Wqj3X3SWuRvf1W0DsKZ3h1d3CA32rKJEEqmDAUQ0Ei-kECSt"
-"MuccEmnoAVQ0+RYkARYk0aJmxvW2Pesz40GEEqn6Xva-5sWG5s00ruG-xGmDru0LXu0WC1mDMGU5Q+f1KOJDpK3Cu8XXcuG+b9Pz40mDEiU2KGZDmSZDvumwuOjVh1WD"
-"+RD46RD4E8UaE0Q5sfl604Z3YlW3TDY-tJWGtJ01j8Z3Ai20uuGnbHXCtW3Cn4Z5e-dbHDW3mw89oaJDoO3Cq8JEpu0dxgOK3mmCtO3EEOpU4aZCE4Q3Eas3E7r0+FZC"
-"MFZCI4VCg5r0IqwkIGrK+-f1+yf1EaS584pDqum2dv0oSx0-KBPThuWT9Z0CuSZ3ViC0nu00l8PJ30GDEWzhGapDuCJDESW8Q7PT+xTkExTkIyvnwfd41KIOBvnHUuVF"
-"DuIFDu0KJXHDpGpCr8JEEGiN04Z3CwYYy9X3W7k3hr02tCpDE0HgQQj604Z3lE37uWJErGJEoKZ3BVgp8DW-k2Xnk2X5yVeTnJW41BQ8bwFI384I3GGCkuWUqw0PUxWX"
-"EI0Ct8xg5pGCqK3EECV7Ee5S0GZctm30ouWH5oGErWZDIenT0GZrVqY-YdhoYdh3WuX4xSkSlJ00r409+-j3Azj34qYDE86R8S3Esum6611DrCJDt8HpVOPG8GWDruWA"
-"9vm1vu0nbwPlQum-qInCoapCpaZ3DNfr8QY-ddhrddR86Ad4Sw0kwuWzfulJ38aJ3uGNEv0qUHmCuumJg3GD1cl3FkWbd600rumRy0HDoSZCvu09wwW1yeeF8um7pIWD"
-"uu0Lj0XCtO3EoOD5Pulvvgivvwmh+2GCwHam08Z3WXW4C6e-+WWF+W08puIEuKJDmKJEEyukESsuk+6R04Z3tq07mW3EpWZCt8ZcsJW3mTZ3y6j3tPB1tSJGHuSd6uFX"
-"GOCXG0mDEW8EECm5gPF10SJ89x-Be8rBemHBsuIDq43EruWCivmJG00Ek2JGSO3ErCpCtS3EEKTnEq-CIgU2ECn30WZ3vS34qO3DtWZ3KMZpe6W-52Xn52X30Zc4eSXQ"
-"e6W3tuc-SvaKSv46pu2DuGJDm8n+810EEOkVgoN50KJ0xm0Eu43DEqL8IuISEMF1aK3CoSJDvWpDpWZ3EvcrrJW-zchozcB0mu0XGe7huK09ciU2EL67I49XPCY-nkWE"
-"nk0BnCZDvOpDu03DoWZCIe-9A6x2COpCvKZ3JG30qu0SQwvXcW3DrSZCrKJDn83DtKJEsSZr-v40tu-eGOyeGuFR38FR3umKDWGCtCZ4S-60o8nEG00CIYl388pDruG0"
-"YZHEqCZCn0ZDECi3AYs00KZ3p540nuW2AuGJww0+zfi350mD+l946l94EyCJ+vG1ESbU+xG1IvG1EGW28W3Eru0+cJGEuu0fnABoHvm1-ImCsuW9TvW6ER9xJWGDnaZ3"
-"qjA0mu07WuGID9jmau-tvgytvwWPQuWfVOdD7Bn41AXmlvl1AuZ1AGGBvuGdlvGoHv0AkY0EoKZiF2Z3M4Y4Fx51rKZ3OakbVX00u4sK4a3EEqOIEiHrMhQ0+JA46JA4"
-"IGRAwvNDEe4fIOpg+ZQ02XQ004Z3kD30qu0tduWXfWmDuSZgGc40q8HAC30CEaaM8KZCpuW6Yv8+4uWYYZ0Cs4Z3pd21nSZ3zNXpuJW-j4Yoj4Y3n9O15es1AuW+ieXa"
-"cu-vO8qvOGGEkuW0800CE4LA8CJEnu0yefw-EW0DpCZ3dVF5v43EtGZDEiMPAgQ0CGZCmWZ3rXB5uW3Do8pCE4jZEhQ0+tI86tI8EmuaImtpgbQ0ECL3+B7CM97CEmWX"
-"8WJEsumgU3mDEOlA0OZgVm34sG3Ct4Z3xM32r83DEiUCMYF18KZDmu0Nh4gA40ZCECsDEVQ0+tI8AtI8MCbEoHj844pDEywX+N-4EL-4COZBrSZ3dS90mu0UkuGDxfA+"
-"40HDo43DruG-IJmCru0iwOPN4nWCoK3EEG3DEeAp483CQ3Ft0SZ-c2Xnc2X30LZURtX3OGc-b6WKb6W4abl3bzZ3rO74v8pCo8Zg7q22p4JDEaHgCa3Dn8Z4pfkaDDW3"
-"1JA1t0Z3GiF3qCJEsejUauFwvgCwvQ1nMPNsTuGLawGCGvlc68ac6uW1juG0f0GCEma444pDI0fqeG7QoLsSez6RavZ200I71G7FiLcPqzbTXncFmu2DuS3CuCpDmCZC"
-"ta3DvKZCyyI5T0W2TC35WmZSfT6QHK3HsO3Eva3Dn83Et03DmSJCmmpBPu12yyoN5GG5+G0FVb130128y4IBj02ToLMPWW3CWqIBoi10oa20Di28ozsRq1YRlHMPwq20"
-"a028yOMPXHNToLcB31G01G1FoLsOqDdFM000W40YeO38r02DWC38j4ZB1SQ5Z6H0impN+W38r0YCWC38oKW84mpBIr40em3Tfn6TbHcFmmpBDe01yyYKE20ayG7QoLsS"
-"ez6RavJCkSZCp4JEvaZDsCZDpO3CuWJPj03CqmpBqLn8o090kKQ0yCJDsapDqWJEvSZDuWZCvGZab60Fr8JDn0pDu03CvO3CrG3CuOTf10GCwWN0+NQ06MQ0OS38r0YD"
-"WOZRb600vKIf8O38puVf1uJf1mKBmu2Co43EmCpDs0JEm43CvCJDyuOe1m3Eu8JDv83Cu83CoCZDo0ZDI6Q00GJGBGYCvapCo8JCoWpCQRq008Z-X6WmX605p02DW4ZC"
-"1CWQ8DG0b4YnfXaCQBG01W1FVvJEW43CTCY-hDGVh5Ynua3DtCZDn0ZDsapCtG3Dt8fn1WICqGZDnOZCm4JDn4sf04Za670Dr0ZDn4JCpWpCqC3En4JOHxC350mC+RS0"
-"2RS0Sa38o0YDW4JDkLS0K4JCW838o4G9+hs02fs04LZBrWZCrKJDnapDnSJEp4pDr4w30CZae60ErCJEsGpDuSpDo4ZDpCJEMYQ0qGZCpW3CsO3CtSZCp8pCXqjpe600"
-"quFg18Cg14IWCO38nSZRe600qaof0SZ-d6WHd60HnuIEr4pDma3Cq03Dq0ZDna3CcUQ0GGJCt03DXI45n4JCmC3EMk52yK3DvSpDuOJEvWpDqWpDtaZrsQ00ru-f18yf"
-"1GGCqaupoXQ09K22p0oDjUX-qJGdqJ4Ck0JCo43Dva3Cm4JEta3EoWZaBD0FqOJEuCZDt4JCuWpCrG3DvOvy4WZDsGZCtG3CvO3DuWJErCZra600suFf18Cf100CAEQ0"
-"0CJ0aule18be1WHBtuIDnOJE1367mGJCpG3CuCZfCD0Es8ZDtSpDoaJCoapDv4ZCQ662uGZDp4pCrWJEu4JCp8JDnODg10mD+ZQ02ZQ0+lf1wlf1Ey32qSJCsOpDv0JE"
-"s8ZCnaZCQQw2q0JEt0JCn43DuaZCvKJEMIQ0uKZCo43CmCZCvCJEv43CueDy400E+JQ02JQ0EOI3+z320SJoN2GD+Vf16Tf1XCg3Aq02oGJCXS33qC3Cv8vx4W3Cu4JC"
-"oC3EuW3Dv8JDuGZcJQ0Em0ZDpOJDnW3Cm4JDrO3DMVq00aZ-Z6WmZ605nS38v0oCsfK3G4pDW4JCEyk3+JQ06HQ001ZBmCJCmOpCmSJEuCpCvW3DMQq0uKJCrKJDmCpD"
-"qa3EqS3DnOve1GICoWZCoKJDvGpD1wE0tOze10GE+794E7940SZ43qWQ9r00uuWB8uFxEu4xE02Ck03DsOZCnWZ3Rd01t4J9sOohG8ZiDu2ZGm1DsaJEtSpDvuWIBmmD"
-"oWpCIA32CSpCsCJ0om0DoaJDEaa2IFq00aZ-C2XnC210nuW38GGCue7H381M84sQcrk3C438nCJ7ZuV+9eI+94w2u4ZCnWJEqWJEtWJEp0pDn8v25mpCv83CrC3CmW3C"
-"taJDoW3EIYS0uKJDnWJEvOpDnKJDqKZDreDQ3u-iGOyiGG0CW8XRG0GEkbs000Z3I313n038pu-258r25WJCp0JCs4JCm83Es4JCsOZaZ60Er8ZDmOJDu8ZDq4ZDm4JD"
-"M652qCZDuKJCpOJCpapCv83EQtv20aZ-G2XnG210uumPG8OdLGGCsuGVIule1Oae1WGBpuY3+RX3NR10qum88W0CmaZgTk07pCJEoa3Dv4Z49YW3gLXY4T16qSJCs83E"
-"m4cJCaJEqOZrvd00vuFaGOCaG0GDXTY3UFXQqQ02r0ICXeC0oqQ4+xE1kuE1SGZBq0JCr0pCE0n5K03DsK3Dt42gMQQ5yKpCpC3CoSZCqCZDnGJCvSZapJ0FpSpDs43E"
-"qaJCsGJEs8pDtOzk6uVaGOSaGWmCWCJOkGGCouMg14Cb04Z9dMX-f6WBf60GmuICmaZDsGJEm83Cv43CoOZbSF1CnSZDrC3Do0JDsSJDn81jEe8J3mJDna3EpGZDvSZC"
-"qOJDr4JDMJQ0+79467948438n4IesHQ01KIEZA3c94G0CmpN+SZ66fW5-XW-57WB570Gvu2CoSJErK3Eo0pDuCJEt8JPkfPoBGoCoGJCra3Es0ZD1fWb9l04pWpCuaZ3"
-"KY06s83EsCJCsOjo1u-iGOyiGWGCm0Y35M10quMR3GGCnKClnQXJA7W4IaX4rTX-QhXFQh16tuICn8ZDsu0bLGGDsuWSQ8HoLOfo1G1DsGpDv8Z3Ja14qGJEtCZche0D"
-"tKJDo83Do8pDv0JDoSZrbG10vuVsGOSsGenAA8tD54090KJ8eMYfEbS00KZ3AfG6ZuFb3u2b30nCk4ZCr4sbWWZDoGpCpOpDo4k0MwL1EeF6iS3CuapCv0pDrGpDm8f0"
-"70GDEmm4WS3Cu4JDuGJEp44DAhJ60aZ-04Xn0410vOnsG8txV0GEXs71p0Y-IfWIIf02ou2DE057WSJEtSpCra3EvuQKAuGtQW0DpaZ3-+X3NtWbnD02sGJDEmq6KSJD"
-"mK3DvuzE5GGCmuV1HOS1H0mCXGe3qNXQIf00pO1GF0GC+Jk16Hk14GZBXe6BoG3Co8ZDn03DuKZDXzacPK0Aq0JEp03EnCJDr0Z30mWaFD06s0JCm8JDr4WDCa3EsCZr"
-"PK01n0Z-D4XnD410vKIfobH1IOs308Z-d6WJd603j8ZBouGQVG2EvC3DoKZDvKZDk6i100Z3S+17paJDnO3Ep0Z39IXZLf02qapCXWA5rCZDr8JEMnE44mpBEiC9Yq69"
-"OmpSq5sPbzb96D1Cr0ZBnOJEtCJCnG3Cnu0QRmGEmmpB+K20D347y0NOoLcRqvZ3pJH3B4X6WuMPuHdFj43FlKG2YiB9cmu8IOL95Wb3wrW9NL20y8pd0811bq0L14G1"
-"s4W800Y-rFWprF00q4sqoT+80CZ3YX10pumZbKEQ+Nq1kKq1IqF5Oa3Cn83EvCZ3TIX3VgGEts3900YCzJ1DsO3Cm4pDnaZCpOpCtCJ8DhOI20nCtGpCuuG6QGXDvGpC"
-"pKZrg-W-lFWplFW3SQXTIh02o0oDIq36cbG21MJ83dW8+FS0kCS0m4ZBqKZDuC3DvKpDvCZ3W+GXHO9290GDEuC3aaJCo4pDs4pCo8Zb8a0BpGpCtSJEt4ZCv4JDE8g3"
-"Ip93+pF56pF54438ESM90WZRUT01q0Y3tJ10uuVf1OKf1mGDkKJDE468WapDvaJDrGpCq8HzeO9f1moCs8ZCoOZDvG3Eo8Je19PN7GIDv03Eo4ZDoC3EEWy9QFl7+tF5"
-"6tF5M4DAsX04Iyi2EeW6+lq02jq08SZBpumgZW2EtC3Cp83EsSJEnOw090IDr03Cq4JEnCZ3Fo00mumLbee45mWCuSpCE8G200JuPIWCpOj45u-+KOy+K00DI0g5443C"
-"sjq0EaW60KZ-b6WHb603nuoCpumWU0IEqGJCt43EqKZgXQ14oOpDp4Z3uk13mKJCouvj6GJDqCJCm4JEmOpDtO3DoumlbeyzDuF+KOC+K81Bd00EXHiPbt20su0rR00E"
-"+RV3QPV3qC3Dt0JDvOZDnKZCoK3C56lbEn02pWJDEWz3KWJDqG3Do8AGYGnDq4pCuWZ3dvW3SYWrQrX-wJXnwJ10muG7H4CcgPQ08038t4MR+l98Aj988qoCk4c2Eql9"
-"S83CsS3EoC3D1AlbOQ0ArK3Cp83CvWZCvCZ3CnWbOQ08pGZDoW3Dr03EXD82paZCIp32+VD5AVD5EiR21GWQd600nuWQOumGHuFc684c6WHBsu2EsKpDEC+8OKpCsSZD"
-"s8JXqhfJ3uGBdGYCnWJDt0pDmaZCMYA80KZ4X228v83Eo4JCo4ZCMVQ0+JB56JB5ECJC0GJeiPsy4OXO8uFc685c6W3DsO3Eo03CnOJDmCpCpGZg7k04pK3EuCJ0yGHD"
-"saJCr8ZbeB13rCJDnuWQluWvUW0Et4Zr05X-EIXnEIX3o4Z3LqXSoxG0b0WDb5d-pxWGpx02puYCECn2aS3Ct83Co03CoGZgbd04q8JEsWZ3cd05vGZCo4JDM+I3aKpD"
-"m0ZCpGJCtGZ3dGY3rIZo0XW3jbW-bOZkbO30numDM00EEaQ3cvq0ISx6E442+JF12HF1CSZBq4JWt22EpSJEvW3EmSJnQQvy40GD1YB8sG3En83CuW3CXfXYCk03pCZD"
-"su01u01Em4ZCsuTpj0GC+-946-940SZ5-8XSUV10tuW3J0WD+ZU2EXU28CZBuu0JWmGEuW3DXVD1nWJ9dQPG8m1DrKJErOpDu4oT0aZ4GfYYd604s8JDtCZ4NF24sS3E"
-"vKZrz1X3XvW-EDWkEDW3fdW38FXQDDW3edW3aXW-pJWGpJW3cF1CnK3DrO3DpaJEoSZCoePe10XCpK3CnumglG1EnK3Dv0Zbe828r4ZCvGJDoa3DEm+44W3EMdu204Z-"
-"x1Xnx1X-ZdWzZd06ouYDtaZDtu0rmGHEsK3DnOZ4YdWb8D06rCZCvGJCr4yrCG3Cu0Zb+W0Dq4JDr0ZDo4pCv0pCq8Z3iaYpMQW-y1Xpy110numVG8dF800D1GY9zoZC"
-"6RH01G0FVvW+EuWbluFuye4uy0YCkWZCvOJDsaZ3uE13u8pDregto01DoSpCmu0nEG1EpOpCmCZcnD0Du03DrC3EnC3CtO3CnaZr8eW30aZ-IKWkIKW-nDWznD03jCZB"
-"vu0OGm0Dv4ZCEuw24W3EgcNEECL3eOJCnaZDnCZDqS3DM6fAX5A1sWZ3xW34s0JDnOZrqm20nu-eGOyeGum0A8Hwy0GBcXW2EeXBXTf-xQWGxQ01ouY3Ni34rKJEsaZ3"
-"gT30qugLD0GDX914uWJCnSZ3jZYcY+2EpK3ErOpDt43DsaJCnOZCMpYDEOgE+xq0+wq0EmB60OZ3qzWPc601nSZ4WZ10qeXhBu465KQNEOjA+7z225z2OKZBv0pDtOZ3"
-"7T25sWZDt8JCI815MAk1CGpDmCZ3H721qWZ3TBZcdg10r4U50WZ38C33paJEpeT0k0GC+NC4ENC4E4CFsXN30WJ0au08duVS38KS3WHBquYCoG3CIy47CK3EtSZigp3C"
-"o43DnKZDt0ZCnO3CuKoSAAz24K3CESR51lB1rKZ34NXqJG10nuVoGOSoG00EES43EqEAg9t00WZ3Ah00q4Yg+hx7+ex7eGZBmSZCrW3EuO3EEWx84apDg+h14GpDE4GA"
-"CC3EsSZ3T840mOfaguG+G8nu11HDoO3DuezP80WC+7M867M88O38muWeG8thZ4098G38sqOzIXH1EGw5PCY-0-XA0-X3nw3Bm43DvKpCm4pCr0JEEmQ7AAO88KpCsuGK"
-"u02EpKpDrGpCvKZaMu1DpS3DuGJEt0ZDuW3EnaZsbj30ouFvGOCvGKSt08Z45CXQUR04r02CW4Z8RNXK67W3TOH6Zuln1qZn4rICkW3EsGJEvaJDuC3DrOZDsK6aQ2h4"
-"4SZCEWHDW83Cr4JDqGJCvO9p1m1ErC3EmK3CsuGAwG0CoODFU0WC+VO86VO8CK38p0Y3leWQA7G0Zum8MaQDEbS04a38E0GD+xR3AvR34q2DbWC6pK3En03DtuWYFK2o"
-"MUA2KCZDvCJCouGil0mDE845MUGAuKpCq0JErW3EpCZDvG3DrOz-60WC+3J4A3J4M4d2Eaf5gHv0M8d2UyM6EjS0bH90pKn8+Jv0zHf34h40suGhjGnDvapDpOZ4n+YY"
-"QLW3VJJefu0vcG0EtumfceOn8GZDmKJEvWJEv8JEnaJEo4smA-K408Z-F5XnF510vumAHuGIAeMn10GEEu14EutCf1f-Y6GFYY2DkWJDs0pDrapDruWbnGGCt81DROPD"
-"5m1DqC3EvGJDvuGcKGmDsevQCHXDm4ZCqOZ3yi24mKJEnGZri410ouVpXOSpX0GCIWKCXIXQe6G0bOnMpul5C8a5CuGf8GGCo8HgNWmDuOZ3sdYcvkZ32728m8JEtK3D"
-"sC3EM2j4EauFeC3Eu0ZCvWJCpSZDMd6E08Z-e4Xpe410nuW3C8NYP8Htxu06kule18ae10IBou2En43Ds4JW1IHCuOJDsCZfB726s0ZDm83Ep8H9HHmDvePlcuGzlm0E"
-"vS3CICRH4WpDMJ2808Z-C7YnC7Y435Z4e3XRCD00muWkDum8MaOzEfh10CJeOan8+ZH1zY1HjKZBs4JCoSZCva3Dq83EuSpCIKg70CZarD02pWJEECl40aZ3B441nGZc"
-"rC3BrK3Ev8pCt8JCp4pCEyX3INu308Z-j4Xnj4X4PAaVOKW3NsX35+W-rDWGrD03uuIDsuGMK1mCEyIKGGpDnSpDcIt0qK3CsapCqK3Ep43Et43CEylCAU62C83Cs8Z3"
-"2P16p03DtKZDneD75uFBHOCBH81jhuGWUusS3K2g+tH1MrH1mCZBu4pDoSpDv0ZCoSZ4DkJ8fQPQ8mHDuWZCo0JCtumZxGGEsefrBW0DnaZ37L30vKWD483CMRG70CZ-"
-"k4Xnk410r46BwbQ0IiII+ZQ0MXQ0C4ZBtOJuwxG2C1nDpKpDouAg10HDpCZDmu0KsmGEu0JCXsYYHD0Dq03CpCZDuaJCq4ZCtCZ3IF20o92uPv0Oq401rol9eHJ01OYD"
-"q0mC+BH46BH4E4J304ZVun40puWdD0GCEqUM+hF12fF14OZBE8x2CKpCtSZ3Kc10u8BiU0mCE0LB0GZ3Hd14uCpCrKZbMeW3Dm22naJCE0dA84pCnuGLEvSg1u-xGOyx"
-"G0WDMQY5EuDLU4nF+d42ka420OZ37a11uOJmcHWDqu0K291MWev94X0DpCJ0v0GCEK9508ZcYQ04pa3DqaZ3DyW3Tz31sCZrMe00pu-pGOypGuWlSuWTe00CoDg1EuDG"
-"X1bPLe01q0Y3SAX7n3X-B7GFBZWDkaZ3lw31r4Z3nw33t8ZDseAuBWIDs03CpK3EoGpDtumCwuf8YmGEoSJCEqf4C4JCrOZ3PWZpoDW-J3XnJ3X3THX32pXQhXG8ZwWA"
-"Fu-558q55GKBquYDtG3DqCJEtK3Cv0JEu0Zg-G15sO3ErGZDE0UBCCJDtGZ3rrYZ1R0Cs03DvO3CvS3EmCJCn4osERQ0+BD46BD4Qup60WZRd6W35sGePuMiU00E17E0"
+static sybie::datain::DataItem item2("haarcascade_frontalface_alt_new.xml",2,
+"B4YYu03Eo03Ep43Cs03DmaJDru-J2upJ200DEGr6EafG44JEE8BG40JCMmo7Ixa08GZBp8n3Om1Cs4ZDv4ZCuOnApuWsQuGD4v0jF0HEsOpDpulqDuZqDGmCr4aJE8V9"
+"E8ZAK4ZCrGZDq8HjP8Tn0mJCkGZDuWpDp0ZCpa3EsWJCYOt7IOiFWKZCra3CnSJEqOnY8ulJ2qbJ0OZ3xk20tuGjM0HEqS3EsuWiU4cTINY1ESF34CJDEqwGKKZCuapC"
+"meXmA4MA0OZ3I124pKZCmWZ3W4Y-NFWENFW35S10n8XuI00EE85E8aZCnOUw6G1DkOJDoGZ3Qh32uSJDICkE1qQmxG0DouGCmG0CsuGG710E5ol-86WB8600uuWzLGGD"
+"muGEMGWCvum0Z0mDIiV2Ipa01GC3pK3Cu8nfHW0Ct4JoDuW3D0YCqW3Ds0pDsaZ3Oe10o8X+GuFJ2q5JbtA3rWJCuu0ok0XCtW3CnOHBOeTJ2W3DvSZCvKZCs03DoapC"
+"u8Z4RXW3w631sWZ3wZ33v83Cpu0NAK2e+NC0PKC0q8HNcGmDquGClGGEpu0BwGmDoO+3D0pCkaJCv03Eta3DsGJCEaS5bYK9h3mDXp43pKJCruW9B8HY8uVn0qHnK438"
+"jGZBrumFr4KJEm86403CXTjqpX02nuYDEyxAWS3CtCpDuC3EtaS3Eqv2EWy5aW3EvK3Dv8JDrCZ-fRWEfR00quWNc4oFEe86KWJCsW3Ct8nNA8z43GHDk43DrWZ3-s01"
+"r8Z3D+J9EumD90oDv43EvK3EsOZ3YS30qK6T+dO0kaO00CJmaG1CnSpDuOZ3u024qKpCrSJGoATn0WWDkKZ3a6Y3af13v83DmOH3Y4Uh0SZ3Zp20oumbJG0CouGEr4ui"
+"+xa0Tv41q0Y3qkZ3Qs12pW3DES96E4H3cpB5EG+6aKZCt8JEmC3Dq8Z6mb26qu2Cv8ZDuu0rK0XCtO3EoullheZlhWmDqKJODI0EruWX910CI0SF4GZC15hqSI02puIC"
+"1R28mW3EpWZCt8JCI0O2X9X3Ub32r0JEIa+24S3CIKR6+dO0kaO0ICh7GK3DnWJDISJ5EaR6c-U7aOZBuKpCpSpDu4Z3DY32oSJEf6Mmz0WCEii4S03DsGpDu8pD5Eh-"
+"E9GNE5kh8G3Eq4CeEWQ7E0fE1CcqICW3Ke35qK3Eu43DE0s34SJCQW-40GZ3m746tKJEuSpCuuWlouVDgeJDg0mDEqLJG4ZBpOJEESf6OGZCu8JEmGJH48DO5GWDku03"
+"Bvm1du0t1HmDraWh1KC3t8JDrumzE1nDraZDtakn+dO0zae4Tr41tCZ4bD31oCJuNfU+JGWCkuGZ51mD1-60ouWDCayqXYd3Ch01qSZ3lY12q4ZDIWmC+NC0TKC1r0JX"
+"S21EuK3Do8HfRWmCsGZ4YKXqF900puWpiWWDpOZ3dh21qWZ3x6IeA5Gn0aZ3io00muG-E0mDEuNA1SX-A6GEAwWND1GEE003EWP9OGpCt83EoKZx8PX3-yW3H914uKJD"
+"tGZ6anZ3m9X3oP31vWZ35720suWvuuVn0eJn04+hEaHCEaY4E8l44S3EI43FIdO0CGZBnOZ4Nz00nuG6l0mCQ8BEEaKB04Z3a310nu0KJWGCt0Z-JCWFJC04rC38vuIO"
+"620CEOj48CJEnu0PmOUw601DpC3EvuG7Eu0CzGGEq8Hv9m18quYCmWJDnuW8iG0Do4ms5SX-D9GNDLkhOSpCuaZDr0Z4v222tOZDXkjq9605su2DmSJCI4H7G83Du43C"
+"IqB21KC2rO3CE0-41560mu1SPuVn0qHn0KZ3jZ00tuGi510CEaJ5ECE7XWYq4304ruYCnGZ3Qq12sCJDM4PE1fl3pM21rWZ3pW10ou0s8H0CvuVOcuJOcumNDnWCk4ZD"
+"EWI7EadDCaZCp8Zv3Za3V431nKZ4kR15o8ZDvKJEE4O2X91DnKZDt03DtWpCqCJEsCJXtuVY1uIY1GmDWuWcGWWDm4Z3oX01nSZ3U+I8-8Tw601DkWpDmuGye8XjNGGE"
+"rqC94OZBEKFJKGJCoWpDm4aR+tX6+qX60KZ3tw14t8pCnaZ3HO40paAuU-q8EWp80aZ3HQ13vSZDuuG1x4z8G8JDn0pDEeTGEiNA00Z-gnXFgnX3Tr46ouICu0pCtu08"
+"J1GCE8UCcB724WZBEi6HE47H80ZCp8XGNLc4OGZBvOZDp8Z3AL44o4ZCuCJ9gxVJ2qLJ4O3CESkJmGpDpOJCmOZDvCpDqGZws451nuY34u45s83CnKJCXaTQ0BnpUu0-"
+"d4M4MSbE1mj-RIGcR2WD1C61rWZ4Qc04vSJCtaZ3mXYvaO01paZ3cj05tSZCnOpCEK2M1qQmaGmCuu0Lt0nDt8pCou0a84m5+JC0TGSuiIGEruGEbW0Cq0Z4UjYv0l20"
+"qumgcuWzA1nCn4JCmuWDT4GhEiv2EG5IEG3JCS3DuSZ6VnW-43G74xGOcuWjruWjA0HEta3EoekLP01DkOJEuuWz1vmIAv0595hNEun98S3DmumPw00EEme41ij-43G7"
+"430DECzICKJCsaJG7J0Cq81wSeEh70WCE8vFEOtM8apDvuW4k4WhEilAI0S4CWJEu4Z3ifZ57HZ-53G753GD1KC0nuWqaG0Cvu0-i0GEQuiMIJY14CZBEK5KEeYFEq2H"
+"0KZ7Xu41ruY3Lr20muGvGumbM10EMeW7+NC0TKC0su0uQ00EE41CE4DCEeW40WZ49CYq5303uuICnuG9T00EEan4EKUEXDX3P346m0ZDpOJDnuGfW0GDEqX6X4g-53G7"
+"5xmMFmHCmOpCmSJEu81fbeEJ4vm3BvGqTu0+qm0DtGJCIKw3ES19883EouGilG0Dt4aK0SJw0uFn0q1n0WJODIWDoumJ4H0Dqu0oz00DIO-4IZO0XTD0vu0PTnXDmSpD"
+"t83Ep46NEam58CZDp4058GZCvuW9i8XKUuFn0u2n08XMF0XCnWJEqumSK0GEECQ9ctw1CCZBv8Z3u254mW3CtaZ3qbIGD5AO0KZ4Ok07t4JDrGJDsKZ-QeXFQe10tuWj"
+"UuGmXmGCn0ZCEWE74OZDcJC0EW7GO0ZDrWZCsGZ3eAb5UxW3DVX3MWZ3sn12vCJEEaLG+Zk1wWk14SJCEaS80GJ8smGEvG3DXL90m8HCO8DIC0YDkCpCv8JEqaJXVGGE"
+"m8HAR4AOKSJCs83EmuG2uummFLkI+xa0Tva3Tr40quWdguWFPXmDqWZ3KX23qSJPjuTyTmmCpC3CE8MAGCZDnGJCU0pMiCZBtSZDnW3Dv4ZDqumqV9HFbuVn0uIn08Xj"
+"U00CEucB0aZ3It01n0Z3zIKY-RCDHHGCku0kB10DE4EJGSJDn8JDbGTOJGGCvuGeiuWUc0XDrKJCrqGO+BuKQ8uK8SpDqu0mAG0Cou0cnuGMZuWzR1WCXeeq5P12ruoC"
+"EqrI0aZ3DZ30nu0jhu06O465CWpCuaJOjZXDoWZDp4JD5SX-XLGkXnmDr0oD1-92sO3DIWV70CJuPvj3DuWAbXmDv8Z3-j04qGJEtCJbSwGBH1XCq8ZCtuWTN1mD+7lF"
+"w4lF8SpDs46sXaF1oSZ33G63qCpCs8nWu8Ds3mnCk8pCsS3Cuu0KhGmDru0qs44cX7W3JB60muGB5n0DvC3CMS58+dO0za86t0YCkGJCquGKlWnDtCJDvWJE5Xiq43W3"
+"nx30tuWiI00CEmYJEWON5GC1suY3cX30nuGKwGHDqapCnOZ3EBX-43WB43Guk6mTC83Dm8Z4Bwa556ZqHCGWbpGEp03EEqhKEmbEQ4T3COZBm4Z3CRM0OmGEuOpC+NY1"
+"2LY1ISh708Z3ruW3JM62oKZDESNLcBn000Z3tv01paZ36d23p03DpKslIuG3OCZCrK3ErCZ62oH8WwLJ2uSwEXmCrmZafx43suYDsum9Z01CtW3EruG64vVwEPPwEHmD"
+"u8XgNumndu07YGmDpumwb0GEXsZqQdW3LY32m4pDEm638OpCtuG2l42K1VC1qCZ3u127nOJEqCpCrWZ-HXWEHX00uOnNsu0i710DEmy9E46GI4aCINx04KZB1F49v4ZC"
+"nSZDnCZCoeHbUu0mVv06enHCoaJCrGZCmOHEMu5B28iZ91mDICMJ4KJDE4l30aZ3PG30ru0f7vjmGmmCkOZCE4tBECgO08Z4+4L99IGDku089WICs8pCu0ZCnWJDmulE"
+"FeZEFm0Ep0oDEeUE403DEao8CCZCuOZ52wbqvH00ruWp+G0DnuGhL91Kg10CE0T4E4Y58WpDpum0nG0CqumrGu-kYvpkYHmDuuG1dGmCpuW3EuGdAGmDnu0xgvDY1GWC"
+"kuGnn0WDEm6L8KJCoKN4KKZBqCJCmuWuTWmDtOZ3goX4P3X-C9GNCvWj5H0DpuW5WmGEsOJCEi5MImxEIZO04CZBE0w708Z3JR62qGZCgm-30SZ3wL20uu0gVvGXZ1GE"
+"1rg-43WB43W4EXG8tG0Dsu0WPnWDtWZCI8B2QNz0CK3Cp8Z3Su54vCpCmGZ6oUIOLJWDo8XzUGnDmKJCpaZ-96WG96W4Zr43uOJDtu0mG0GDEGcQ0OZ4z5ZsA6W369HO"
+"vInDmS3Cv8J1ALinE8p3WaZCu8JCn8JCo8XK5vlY1uYY1uWgN01DsO3EoumwJvmDS1mCI064IdO08CZBr81eXW0CmKZ4qU20tKqDESt2EWG704J86oWDuSJCbek-43WB"
+"4300vuGKA4Oz0SZ3pCY3vLY4doXq8602quYCEK1QE4OMGGZCo4JDDB29ruoDm0ZCpGJCtuGLavW2i4QT+Rz0vPD6v038tu2Dn4K04WpCEGpF8W3CtuWEA8Dn00GDE8Z4"
+"IWwEC83CuWZ35OK0j218puoCsuGr6Lm4COJErCJv2xFn0q1n1Cc3Otc3YLc4m920n81309DJ200DX332rOpDECJO00Z42HM14ZWDk8Z3f162s4pCEeW84aJD+7d3+4d3"
+"0aZ4Or53rGJDsuWoJGWCtum88OUwt0WCEWIBEeH20OZ3qG41v0Z5a-W3ep02oa3DIa2A8W3Cnu-Pg9qPgHmDvuGj51WDEqyGEKf5GaZDrGJC5edq96W3ryW3fVKOX10D"
+"EyNO5PZ34Y10r8Xoi1mCEKb948pDMOHC+ta0Tr40qu07U5GlWOJEpOZCoWZCt8X9o8Dn001Dk8pDpuG5gWnDuCZDp0pCM8M9I0hBGGJDpWJCEi8SEe3MEm02+JC0kGC0"
+"8K38juG8Qn2Dq83Dv4ZCpCpCqWZ4ogaq5301ouY3YXX3Dz64nCZDqSZ6kJMOjp0CoO3EEe5TGO3Cr4ZDIaOB+NC0kKC0E0hBEOt68KJDvumqo9XlQuDD9uGJnvWnTWGC"
+"nSZ3IC10u81pH4uDEapHKSpDnGZDv8XirK4P+ta0Tr40t8n7BGmDtuGctumU8XmDo4JmSADY1m0DkS3CECoDG03Du8JDEiIT5PJ0Xvm3BvmeN0nCvapCruVsguJsgO1O"
+"DnWCoG3CIaG3CK3EtSZw3n13ouICq81oWWWCnOZ3+PKIxxmoTuWz94M34KJDECW2bQd-96GF92GEESdACSZCrWZ38zZ37311vSZ3xlWt96W3JDX3nXY3Yx10men3qumF"
+"h1GCECgT44JDEmJT4aZC+lw1siw10WZ4Wr42m43DE0UG44pCImdAkVw54CZDEmZ6WWpCrSJDqCJEq4Y3X51DtG3EqapDmO3EuWJCvWZ-7NcE7N60ue1ODX0EsGZ3O+36"
+"uC3DrOZDs4mUQ372E8xBE0LP8KJCru0hlbc4Eq53CC3EmKZ3KGZ3NSd-OMZEOM32u0ZCEe8A1Ki30J51mGZ3CMbvTk23puYDvuWw4n0EsCpDIqH25jVWowmZrummseXf"
+"cv0Y8ul43Kd40WZ4Xra3c050qu0KAnmCsSpCoNr7GaZDoCpDEG5GG03CuSJD9TZ3GFX3w5a3n360nu0hpuFfHe3fHG0Emu01bH2ErO3CtKJEtKJCE8oOI8TLIta0EWZI"
+"0WZ3cW31qaJenI0Csa2YEG95883Dsu0CK01CraJCquVlAeJlAG0EmuWj5HGCou08Bu0jm0WCEW22XikqiCX3wM51q8Z32y63tK3Ds4Oe1L31W4Z3Jl32pW3EE4o2C4pC"
+"tOJ9buFJ2u2J20WDEmxEEOqA4OJCXeE3nWZDruUYe00CEWmQE03UEWwE4OJCE093EaV2KG3CvWJEtuGcmnGEvWpDbda-53WB5303t0IBruGzRv0immGEqGZCEGwDE012"
+"IJY1CCZBuaZ3jXW3q9Z3GGZ8Jw00ruW7eGmDo8ndwHmDsuFo8f3o8X0EmWZ33v50suGdcGmCs8XJ2HGCt441IJC0Ey2HCapCqKZ4XK70numodKaJG8ZBmOZCESV24C3C"
+"EqUBfDd-96WB9600vuWlAuWGUvmNInWCoSJCEq06URw5KKZBuWZCou0qeW0Cu0Z39q50pKGn8GZBnu0+k5KO00Z3LY70mKcx+-L1v+51n0Z3iD41tOJOqv0pYmmDpKpD"
+"I412Ip91ESbM8CZDmuG6P0GEEKPV08Jup4s4EGfHKO3Ev43DnumUR0GEb3W-53G757wm0KZ3nh32pSpDEqZ90WZwGtW3Q8c3LWb3Uw70puGji56N1ZE1qGZ3s3X37D11"
+"nCZ33pL8WwFn0q1nIeWF0KZ3mRKG8JWDquGJU42AQNKFEeUB8CJCuuWdAXGCoCZ6-gW4jrW31R70vuGPTGWDpuFd4u3d40GCES6P0aZ3so11r4Z3uo12t8ZDc3M14KZB"
+"cqYT0KZ3WGKml5KJEa1I04Z3rXW3Dd30su-jKepjKG0En8XhkGWDtu0ALuW21wGLp9nVN8Dd4uWIiuGV-uWyke1tQ0GB5KC1s0Z3Ut52vS3EEOZOM8uD+xa0kua0bxg3"
+"irGub1HEmO3Cpukh7WmCrSZ3TL15oaJCt4pDUmG348ZBEynD0CZ3lT70p8nUdvl43uZ43u0k5XmCm0Z3ZB30numuQ10Dgt0DE0xJ0aZ3d281rKZ3DiW7aV35tuoCmS3D"
+"E8S70WZ3JK20uulc48ac40mDX+55n03CuKpDE0rSEOkCbaeqD900puWB4v0-i1GCEazI4aZDYCu24GJCEK4308Z3qHZ3zUb-aOWFaO00uuWNAm0Dt8ZD1o30suGL09ne"
+"M8z86u062wmsruGEHHGEsu0mDKM4XrE1q0Z3KV26uSJDtOZCv8HJ9u-N5qxNI4m90GZ3np34q03CrKZ3O-I9jBDmA0mCE08FEKMEEG968KZCnOHYXumrAGGEpuW71XnC"
+"mOpDqS3D+38Fw08F8WZCmum+90mCEu364G3EEugT8OZDp816i8jJ2mWDkWZDEqAPE4oD0GZ30xJ9p5cAO8JCu8JCmGZ3yZ70ru-XJvpXJH0EoO1k510EXi32t4JDIydO"
+"Iy3QI-a05BD0muGpVHmCou09MP1dauGPSuWaH1GEEWu804Z3-UL1Sx-J2arJ08Z47SX31sW41942tKJCE4Y6U7tT04Z3Nw01s8Z3CUa3Ek20tenRv0HDk0pCtumvmHWD"
+"quWCr0GCMCX2+NC0TKC1p0Y3wt54qa3Dt0Z3a-62m4pDIyL4IdO04GZBECsVSKJEm0pDqKpCEKoFnXD1nCZ35376q0pDnOJDrOHqKuFn0q1nE8h7WaZDtapDp0pDruGa"
+"-WGEqOZt+L13qu2Duu0-Wu0jN8nlI41nECu248pCE8hIEutI+3M1+0M108Z3RPZ31sW3pH15mG3DsOJDb2cqMFW49E54v8JDu4Z3JGZ3p5N98ImCkuGRiG0EruWyEm0E"
+"uCZCIKC7+ZO0kWO0EOm5EeSE4SpDEO120SZ3ZFK0wfDn0umBpuWpTG1CuOJCo0Z6wP40ouGvOXXDqC3EtCZCEmBW+hV2+eV2EKMJ4OZBECnVEWdA0OZ3b780oK8KQNC0"
+"E8MW0WZ3jE42pG3DE4AGba80qumpyXGDpSZ30U33t8pDtuVn08Kn0uGiUGmCpuWU920CECtEIutIUd918GZBruWpyvmT4XGDmOZ3kRL14xWGbn0DtapDEidU40pDES5C"
+"1SX-LFGVLxGiUuWG91WCE4AQ48ZDEOG8EiG3Ipw14KZB1V00o40mC8pDo8Z7H+32pu2DESHQXZ41nKZ3m2e-raWEra0Dp038j8ZBr8JEqGZDmCZ3fE61rKJn6ATJ20GC"
+"IGL6G4pCvWpCEmpMM4bF1VE0muWeJ1GDE8XA8aZDpawl+dO0zae3ar44nuYCu0Z3g770qumcjX0CpSJ8AATn0uGtQ0GDXn50uOHqqenNiG0DkumluG0CrumhcnWDuSpD"
+"M0AA+xa0Pv40pu0lS10CEe5W0WZ3ia43v8pDsOUD900DEme50KZ3dra3tDX7GHMOImmCsK3CESlOGO3DnK3DI4Z3+JC0kGC0ESWF4O3EESSQE0oD4S3CE0yHUlc4EGpM"
+"4CJDEeLL80JEtuWmxOXuGmWDk03DEeb588JEmu0p51mDMyDI+ZO0zWe3yob3SX30su0wb1XDuKZDs8XdWeDJ20GCEWGa4SZCEmM508Z3BKHW3w0wYuGzG4Id0WZ3WrZ-"
+"PMYEPM20uuWODHXCk83CrSZ3mX01mGZ3pKcvRI04qu2CtaZ4UlY3pf71v8Z6Oe13ruYCmuWi3wGa9umaz9X7BuVY1uIY10WDEC0ICOJEmOZ3qb80num+9O1rF8T+9uGS"
+"8GGCs4qC4aJCEWdJ00Jf9vGMM0GCEmASEyJP0CZ3BaM9XwlJ2qbJIub98S3Cm4UIKOpCnO3EqOXJZeTn0GWDrumfPvGA41GEXrX4mmGOkZ0EuaZ3jYY3gF91n4Z-bOWG"
+"bO00uuWrauGXd0GDECRHEC4bIGd2IJC0MyrIEqNN04Z32g30rOnBCuW4au05tG0Cnumw7omDo43D5ij-96GF92GEEWBGC8ZCtWZ391d3RAc5VSZsNFW3fX00pu0E32GD"
+"EepJ04Z5BV11puY3wPf3XmY3YS11r4JYowFn0a1nECMJOKZBq4pCmKZ3m-11oaZ3cpX3LZWq5300nu09OvGARuWlAGGEpu1fZ1HDk03CruGcgum1qG0CsO1nDvVn0uIn"
+"0eX2kuGCy10CEWjHEex81NYs2PX30Ud3Th11t8Z3qY40qaYY0GZ3GQ43nCpCu8XhK2WCQe29+hO0zee3Km61pCZ3Ro40vumkKm0EqSpC16bsIC05nOJDuCJDESCX1pE0"
+"q4oqEOJ20GZ30o81n8Z-i9XMi915qC38quYCEGQ7EOKM8KJCv4K2cJf30WZ3LL53n0ZCmuWjxH0Dma0nEiFbEu9800Z3IOa3nbHv4xFY1q3Y0GZ3nE20nuGSsH1CuKZC"
+"m8Z3lIat43W3ib36oC3Cr43DmOnLFO1tQGmCkumMNHGCpumZwGmCouWHF6En+JC0TGi35SX3r3c3PfPH4h+EWWGDkCZ3rd93t43Epu0gF00EIO641Vk37xX4Pf01oGZ3"
+"48X-43WF4301s0Y3Wi00uu0G-G0DmuGn8H0Cs4a0Id91Eqh20WZ3BH51sKZ3-W70qOX79008E0uCEC344apDE0g548JD+dy5+ay50GZ3oMa3uHZ4r570pumUEMo9Q-S3"
+"8K3Cr8H+e1GDEm3Gc8gCESWTIKVGK83Et8ZDouFY1u3Y1OHOB20DE4gUESb70KZ3oSctGCG8I3nDuKpCmuGMn10DHqA0WuGZOWGCuGZ3R6f3Ci20sKQl+3n0k0n0Ia6P"
+"a4JDvCpDr43EuWZ3EyW4kgYqTL08pu2Ep03Epa3CEWD64a3EQCkSC0IDkGZ4Vl90nu0Dn4C-1vg-53G75xmNDv0lF00DEys7EOIU883DqOUqsHXCkKZDsCZ37L90quGq"
+"sHGCmaecCKZBmWZ3-Q23vG3DuuGu6wV4auJ4aOnNDv0BoHHDsKJDs4Z3WuMXH1mCEx-ZCOZBqOZ3mh33nSpCnu0RnOX79u0F7v0S5wG1Sm0DpSJDMWd6+hO0keO0EyZG"
+"08Z3Hna3Jw91qSZ4p9Xvg9X3P570uummQuGyd0GC9I81WSZ3qL91tSZ3bm82oGpDQyML+JC0kGC0ICm5E0k8883CquGPSGmDs8Xj09DY1u0uGWWDsOZ3wH34oSZDqWZ6"
+"-A50oO1heuW3V1HDrOpCmul2DuZ2DWGDq0Y3R+86rKpCnS3EquGwJ1GDcFJ2IOm244ZCEy2SCG3CoSZ5FoGGCH0CqumDOvGoDumLU81GouFY1u2Y10GDEWI7EyPB0OZ3"
+"s953rSJDmO1x99D96mYDk4JDuKJCo8pCqOZ4qUf32fG05J1EnKZCuCZ3Zu20tumwYv-c4upc40WDEyvR0CZ3-vZ3w3Y3gTfv4SHmaWGDu0Z32f91oGZ3rNM24JnDk0ZC"
+"uaZ3b792n4pDEa3e+Vr3wSr3EqhcEG+2EWxH4WJDEKW448ZDIKJNIBn0O8ZBuGJErOZ3mib3cv60q81vb4C98C3CquWWnvmHR10CEm98+dV2saV2EqhcECZdE4eJ8apC"
+"nuGhr1GCIKD9INC04SZBE4N7Eu5R04Z4lYZ53hH8XwmjQ2WCEWVUEyjYIG55+Fn0kCn0EisUEeBCEeMXEuIS843CrumkFeTh70GEE09AK8JCmS3Dqu008MqDE0R9KSpC"
+"qO3Dmu0x-4Ui+dO0waO00OZ3sM30nuWU+uWsz01Cm8ZCr8HJA1WDEVk1GCZBsW3DXe00puGYi0WDc4jT48ZDESDY8SpDv4k000Z-kCXFkCX3yg93nuYDtumpVvW6RwWf"
+"o8n9T8TJ2uWjcHGEnuWdm00CEKJM0GZ62oY3sa70t4wRCGZDsCZ3Omc-RIWERI01s8Z3FW02oO3CEub20aZ3gt50pKkOIJC0CGZBt8Z3np82v4ZCEW9A0CJY4wWoIG0D"
+"tu0TGv0-OHWDseXRFu-pDOopD0WDESr30CZ3yw52m8ZCEOoY443Ech91OGZBu0JEnWZ39Yc3ipa6zsOOHGHEnaZCnWZ3aLe8sra-43G74BnkQwmUE1WDIiY80GZ3QRIO"
+"CgDw60HEmCZDtumra4eW4CJC12IXQwmuOum7JH0Cu81lhv-N5OpN50WDE8MFe03DsaZDsaZCr8ZDEqcR1CcqD901ruY3AbA0vu0h3vGRY0mDMSvFI8-40WZ3B552vCJC"
+"ImSQ5-l-96GF9Q1iUumfZw0fX60ncZO00KJWa30EE8aN0aZ3aI80v8YRfu00D8HZl4S9QewB+JC0TGi3OzW3-620vumwT0GEEGHF0KZ30pWq8603quYDsu0TRXGCpCZ3"
+"uD10sennNWWDk0Z39Nb3XXa3jb10mO1rAuFn0q1nEyg7EG22E8WR0CZ31Ac5Vtbs4303q03DuumsQumch1GEnWe3wLg3IA20uu0wv00DES0W+3n0w0n0E8iY4K3EIyBW"
+"80ZCnu0y31GEXf80quiv6mHDkGpCrapDnuGUsmGDo8ZCQ8m5MGQMa8pCmCJDmGJEqCZ-JlaEJl41uSZ3c9A1vOZ4-WY3Zec3iXPWOgDn00nCt0JDtuWXjuWKT63YGGZB"
+"m03CEKuY4C3DMGBN+x62wu62EmLJ88ZBtuWzWumxl9n0wKMrIta04KZBEiFd04Z3+A62sOJCECdM1PJ89YGDvOZ3r140uuGMVIGDouVc4eJc40mDI4m5EWAZ0WZ3LM20"
+"quWyI64iQJC0K4ZDnOJDtu09EnWCmGpDQK430CZ3cb10uumIwGHEnOpDp8Z5EeW-LFGULB1kQwWvOGWDpuWw6I0CtuWM75YFE7n08GZBu4iQEKVB48ZCEeVT5ea3px01"
+"qSZ3LV10uumbYuWpDaGO+hLJQeLJ0WZ3Qr41quY3Qm20muWYBI0DtuGhM6c4IdO01Tf3wj00vuGLFuWLFKaDIWc4EC+90WZ3I771vGZ-o1aFo142uSJDE80E803DpuGK"
+"KG0Euu0Mj10E5idslX01uKZ3wJg3H+Z9-oM05xmB8XmDm8Z3Wl01r8JXuulJ2uYJ2u02kuWUfvWPz1GCE8L904Z4Ki30rOjJ2uWkW2WDESVYEC3D0CZ63S12ruIDEC4L"
+"4KJCEKcM8WpDq8HcWuFn0u2n0815gwGvY4qiCC3Co8Z3ui51brYrWLW39Ld3kp93v8ZCoumKAfH2LvWwaumVfG0Equ0TkvmNSv-43ep43W1EW8ZBpOJDECYI0SZ3ir70"
+"peED9umRBwW1OXGEqOZ3Rx90uOXKIW08tuY3-Jb3o011m8Z3qZX4bFa-96WB96W4b9A0nu0PYwGpLvmsq20EcVP9EqiB4K3CE8iY8GJCrumve5trWKpCuCZDoWZDmuWP"
+"2XWCsKZ-96WD96W3voa3FkZ3Nv60muWsWwGUi5UJIp918KZBvuGDJ2mDE0CY4KZDEKc91ug3F124oapDnCZ3hM70pum4GvlJ2eZJ200EQ4Si04Z3Bv10tuW7xW0CnWJ8"
+"f8Tn0m0Dk4pCE8jd80pDtuGTWHGEoakhCKZBqSZ3WB20tuG8qvWOZKIe+hk1PhE0uu0MFGWCsu04zG1CvKpDvCZ3eudvNe12qW3DEGq80GJWSwWc9LIY4KZBEiMAOa3D"
+"nCZDu4Z3SwNWuuFn0u2n0umjSvW25vWgHoGDtaJCEuEgUJC0ECiY0GZ3qi67pOJEv43Eu8Z3HoGGD11Dp83DquGuGI1Dt4JErCJ9VwFY1q3YESWB8OpDtu0CrImCpuWQ"
+"cPHJkgDJ2uG1+XGDnWZ4bNY31+I98w09qwWSnH1EpW3DrKZ36bK0NuFn0q1nEyg7C4pDp8Z3v0h4Pn50q8nHCeDn0WGDqGZ35TX3lZ21rWZ565RuiYGEnGJWioGCt4ZC"
+"I83V+JC0wGC0CO38uuY3Xz51nSZ3WQ12mCZDMmHJUV438C3DtuWOavGaXw0at4GhECq4CWJDv4Z3lFX3vhB0q8HxOuFY1u2Y1WmDWSJG2W0EpGZ38V91mKZ3iYhthUGu"
+"KwWzCwmYRY0CvSZ5P-I043mDEm8DMKSQE4V35Dc-C9GNCvmLFmGDsW3DEu1I0SZ4aSY4yTXq8600qumrGH0Etu0tvv0oTPn6654JEOFQK4ZDoS3DuuWxMvV0NuJ0N00E"
+"IOGL04Z3d-15t0pCnOJCEuq8Xsbqzg02nuoDE4w3XD10tumHuPnV6108EKpjEe-9EinREWXG0KZ-TLWETL00vO1jSH0En4A4Ey2K08Z5Mcdt96W3ga40v4SvICYAfhA5"
+"ruYDu83EIyRQIi-W0CJ8buVJ2qLJ0aZ3v9b3F5X3CSc3jhc3j0ctft10rumaEGmDnumduAnsBPXwMW08ouY3J430vuWyQwmOf1GCMWn5+7n0v5X3uo40uuWBluG+9YmD"
+"sGZ3U730uekr30GEEaDi4CZCEWnMECiYEyU45RE0su0lAIGEsu0oMHGDoulokuZokGGEpum4YHWCt4gLE04X8WJDrOXkPgz860GCEOqZ4SJEECuG0KZ7GY20WuWBynGC"
+"mKpDM8UCEOnLXQd-A6GFAwm1ku0v+KkM0GZ3-7a4pcXq4300r4UC4WJCE4aW0SZ3T9e6Aq04puoCvSZ3Lr20vumQmuWoUuFn0e3n08HOaHHEr8JDsWZ3Pq31rGZ3T0at"
+"qa01suY39n12uCZCEO1V0GZ3iOH0kwG+GG0Dr8XYl0GEE80k0WZ-j+ZFj+30vu0MFu0L4IXCva3EvWZ3DGRPI8UY100EEu33EmTW0OJORN0nEasU0GZ4GT31mOJmku-r"
+"38qr381OzuWGM2GDEeDL4aZCEGZVEGD2QJY1EW1808Z3Tkf3ZQb6bENGbH0EuuGUTvWdb20CEWpl1mj-ICGVI4UhKGpCnK3Evu0uGmWCu83CI084IdO00GZ3Vue3K131"
+"oOZ3Plb5RZP04JWDruGjmum3X8nX8ul43uZ43GGEWumbbum8V0WCEi228CJEpeURfGmDkuWTJ0GEEGiO0WZ3Tnc6Yn11quY3cv62nS3CEehjEiaS5Lc-96GD9IGEm8H3"
+"5vWagwm6suWeRuWNKujw60GCEKxJ04Z3KP21u8Z3ECK9K7YY00Z3WEB2nW3CEWD94S3DMG34+NC0TKi38b40puWzyGGCvu03330CE88E95hnNBMukw0DOn0EmKpDEag9"
+"Qeq808Z3E561n8Z38u90o4AoMGP5+JC0TGi4Vr31r8Z3sEd3sq51v0Z3asgtWLW5yh35nSJEnOpCEuYC56I89AHXn1WCEipVEW+RIe98+NC0kKC00CZ3SEc3WM63oSJC"
+"su07G0GCM8YiIpV20KZ35E60puGNx0mCEmzf4O3EIag2EOQ444JCEyVd88ZCuuGDEuFATe3ATGGEmumPKXmDt4Z3WXg3xmY3UmXuICW3v024u83EsWZ35s42pCJDjxA0"
+"t4qhGK3DqSJDEusC4C3DMGHQ+xa0Tva3fjd3w4X3k-91p0Z3KxM1w9DO5GGDkuWlL00C1NIGWIGDrK8XE0e440JCEuz94aZDEOgU0GZ-RIWGRI00su0NcuW3zWGCvOZ3"
+"Fn31sGZ4aecqeR00quWiSwGoQnGDm4pDIuvh1222W4ZBEWqD0OZ3mK22pGJCE8sS1SX-86GF8MUh4K3EEW-O4a3EEWK408ZwbVY3akY3tXf3rPe3i-b4glX3JgY38rg3"
+"FhW3Iy11m0Z-lJZElJ30vu07Q21DkapDouGrc2WDE0pP0SZ54wYqE904suoDvWZ3FDZ3THg47gI8pvGZV8nwauWWIGWCsumwl5m5+hO0ze80v4ucEePl0KZ5Dx22vS3E"
+"56bqRIW3x150m4890WZ3ltHWV6WhXvE0uumSQ0GEEGV7ESBF+-a0wya0EiBJ08Z3kv20tuGzD1mDIqm5bHXqA6W3pm01pCZ3rC96t83Eq83DmaGnEO+RC0JDmCZ3Q9a3"
+"0fd-eDZEeD30vuW7Q6K1EaBJ803Ctu05D0mCIa6WINC0EqV20KZ3h110ou00fImDvOHdU4GnEOLc0CZ3KS60uuGfbK0t+-a0Pz41n8Z3vj30su0NSu0FBu0tU9HqI8Td"
+"4umU63WCIK5G4GJDEukZbCj3X010q8XQ7nGEqOZCE4650aZ6KZW-mtX6mt16v4pCWqIDkuGuS00DEeEdCSZCqSZ58CgqJC00ru0XJ6EDE0OR8aJEreHUVm0DkSJDEi14"
+"40ZDEK1JEiaXXfY-96GF9AnTfwGtDvWbY1WCEGaJMqsJIhO0EmXKG8ZCuaJCUmdDb5SGE1WDECg80aZ4n981qSZ4rcXO53WqvW61tmZcvW65tOJEuaZCQW2ZG83EnKsA"
+"1eeE9TB0Au0+sI08Wul8tAY8tYGEnKJeY2GDEenD44pCE0EpEeJ6UV234CZBE49G0KZ363Y3qXh5mog3LM32oG3CEqf2ESIa00Z3wTc-h8WEh8W3HX03vKpCtumQBJWD"
+"suWj0BnfSeDU4mWCrO3DEeAB8GJDsu0CuaaA0OZ3u-75vCJEnOZCE4E88CpCruFn0e3n00mDEmJ4EOeO0OZ3+l10uumSluW9C8zi3uGWx2GCE4g68K3DuumotOngGuW7"
+"Tm0CmSpCEGKF0WZ4IbY-FCXDFC12v43EEeFC4apC1Kd30Ui5IxZtlXX3ufC0nuWq-umTZYGEuSZ8YO15p03CrGJDEa5L1Qf4iaWOpEWm0d60vuWNDvmxd5g-CWJEtCZ3"
+"5Ne4x3ZqA608ru2DnOJCoOZCECSCEG-C9v40pu0nB0GCEqie4SJDEClO08Z-LaWELa00ou0SvImDuu0-h00CEeYEIeccUJd3WKZBoSpDuCZCtu0RY0GDEetj1jl3GC12"
+"sS3Cbvc3o560tOXP8uV06aT0EqLJEiEK0SZ3oyW3-n30quGl5vjJ2u0xC00EECqQG4JDpGJCEuIMDKi3MRa3w335ra3CsKZCMK14+NC0TKC2o0IBEC-h8CJDnuW9t1XC"
+"sOJDq8XON8jyZ0HDkSpDpuGNlWmCp4Z35f10vKQI1tj3J2i3f6A2mK3EE8SU1mj-53G75xm3i10EEaZ2G0JEu43DEKblb3aqICW42kX3TMa3qM92mSpCMux400Y3eJ33"
+"m0JDtu09M2mDUCBG+JC0kGC0IiGLEaKZ0WZ3GJi3FaJAjBT96GWCkuGOB00CECO4Eu56cqErGCZCq8JEXz20vumh3N8E+NC0kKC04K38ES23GSpCrOJCEupAEOTk5Abq"
+"A6W3Vh30uu0HBGmDn4I5UijAESTC4C3CESEj0KZ36+60r8nLxuVn0uIn08nnnY0Dt8Z3Ioa3E772u83DI0N7INC0Eu9GEWyREq9JG83Dq8ZD9s90ruWrJ0GDES1F00Z3"
+"Vq50rKEJ+NC0kKC0E0hB04Z4E353m83CpuGxv816B8jJ2WmCkSZ30e23n43CnOnvUKi3X0g3cK61s4Z3LGB0ou0S+w-r3epr3811d0GEE0ZkE4sYE4wRIOPDIJC0E8RH"
+"1RY4Ch70m4c01qQONx0dZvGOAH0DqumKNMwT+l91Tkf4CK5CrCJEmKpCvSpDqOpDnO1+o9Tn0uWbFvmD6ZGEmSZ3EZb6BZb3wO10uu0wZW0Cm8Z4+Ub-dRXFdRX3Wra3"
+"8p91sWZBZgetlU00suGjYu0CQxGYyYGDu8Z5SXW3ms02oO3DEq9bECLe4S3D+BZEw8ZE0aZ3Wra3Olj30610vuGxlum2Y4SYIVz08CZBpumRvuWptum3lP1IG4YY88ZD"
+"muGE9uGq3wFNsO4NsGGEpu01d4Gk0WZ3YJ61u4Z3NuR04BjJ2u0CZGGEnu0sgu0w-YGCtaZ4h2X3dNLG7vmOKvW+KuVWqvJWqHGEp8X4ivGJZH0Cmu0Wb00CEaXZUta0"
+"ES4LEOqGEec5EiAE08Z31cGQNJGEsumLQwGGZvHKmu-r3atr0CZ4SP30rum-2vWQvGGCtuG8t4gsIdO0IyG3Eu5jEWPHEWWnXCTGDvWJVWWDs8Z3ZpZ3D5L1NuVn0qHn"
+"I8hBEa2gIiw80aZ3nIbv0431suY39tX36YY3fl21mSZ4f1IONZ1DrKJCqK3C1g90numdt5AU+NC0TKSwkAnuOnGEv4JCEOB700JG58zXH0WCEeV60SZ3K152tW3EEuMo"
+"9R25ruoCq43EEeALEebDEqcF+NC0wKC08S38vu0maIGDru0fPH0Eou0bP7WUIl91ECjJ0aZ3MGB2u4ZCE833QO-8E8NS04Z3vrj3rM30ouGBbvFn0e3n0umPa1mCIyDe"
+"8SZDouGXf10CICLAIZO00KZ3Il90vuGWZxGhY7ke1qA0WuWM5IWDquWpduG7RuGvEQX2IuVcKuHcKu0nQYnDkKZDpCJCEWBQ08Z3eC40r4srIdO0EujOIGI80SZ3n3Z7"
+"HjO0SZ0EvWZ3v7a4uPh-t8dFt874vG3CWaZ5TV60ru0Hz0GDEGnmEWO3Il91Eu3QEiKbEGEbECE5ImX3E8Y50CZ3wtc4VB61rCZ3NlN8Wwlr3adrM0MJ0KZ3LZW3i924"
+"pCZCoOZvIGZ3jj00muGGm2GDE04q0GZ6jjW3RkW3VSg33Q11pOZ3sPNm6wVn0uIn0umgNG0Dtu0xvW0CsWZ3Rg21n8Z3zQYqRz01quY3GY24qKJCpKZ34w10tOXuPuGJ"
+"pmWDq0ZCE072QSlO+dO0waO0Xtg3Oi70vu0SI0GEECEPcxL1E0gq8aJCqu0brm0DqWZDQmsu80YDkumLFW0Eu4Z3na11q8Z5gXi-86WB86W3nwY3yh82ra3CEWP68W3C"
+"v8nbWejc4WWCtGZ3NJ43m0JCpuW5eKCqE4JG0SZ3OHA0nuW15vGsv6wl+JC0kGC00KZ3FY20tuWqV00DEKJ54OJDE8iKURJ20SZ3dCc3t450pumkSH0DpOnLOuGQNW0D"
+"o4Z3nla3Oh10se19Lvlr3qdrE4MJ4CZDEyEnEybmEu8D08JeUvjc4u0YS0WDEifaEGRQI8V41g92t0JDEGHNIuoFEaFn+7n0w4n0EeSi843EmumUvP1ee1WDIGvoQJC0"
+"E0eSK8JDnGpCsuWNseXlA0WCEqpO403EEKE4Eu5sMOgf+ZO0kWO0IyHm4KZDEyNYEiIS08Z3hZU8e8zv6uWuG0mCI4rUEK5o4a3EMShF1g90q81+wGGDpu0k010CMmpR"
+"+ta0Tra46SY3TY61pOZ3eT91s8Z3YjZtIC01ruY3IDC1uSZ3bb73nKpCu8Y1d0ICmCZDrCJCp8Z3E680vuVbEuJbEuWODHWCku0KfmWCuaJDICKIM436Ip91EO6PIeVH"
+"MOMtU0vXIOzEEOcFESkbEOI7+p91wm91E8MJ4CZBEao8EWBYEiMH48JDIum7I-a00CZ3MvZ4iU20t8H9WQHsjuGY8G0EtuWuD4YA80JEpuFvGu3vGGGDo4QO0CZ32Rg3"
+"GVI022WDbzeq53W4z2E1nKZ3wse35oNqgxG5I9H+E00DECcfXhi-TIWDTI00r8nNsum2JI0DvuG--uWvg4S9Ixa04KZB1O40puWPO1GEE8IY0OZ4RC12W4ZBEKWT88pC"
+"vu0D-WGCq8JQguFs3a7sE8icSOZBpKJEr0pDE0pBEm0P5EbqYL00n8XFe5iSC0ZDrOZ6abOHEHmCou0zSJ0Etum4A0GCfRi-53G75x0Os8nMp10CEyQK04Z31fMOs9Dn"
+"0G0DkuWDhv04bJGDnuWVEMoqESJ204Z3cP71v4Z3wHc34Ke-D9WFD9W3qwY3FDh3Vo81p8Z3Rz00peEO5uG7w00EE0nIK4pDtSpCq81gAuWrA00CECw6EqCoCWJDrOZ-"
+"VhXFVhX3Zr42nu2CEOelEqc4E40dg3M104Z3eJ96vWJDmC3DvumIK912y4KJG03CmWZDESi8KK3EnG3EnuWRDuVJ2uIJ28X7gwGeCWHCu8pCrCZCEGVSUdk10GZ387Y4"
+"NQj3RI50meXgIvG7du0Z91mCEGrECCZDpKZ488X-43WB43W46SY3-da32gQuGf1et8zN5GmCkuGHC00EEiW8GKpCva3DMCW6Eer30SZ4KuB1paZ3RkE1sSZ-96WE9600"
+"suWjUuGl5wm6TH0Cv4SfI8q6QRz0EyWA8CZDnumo11mCEOZp1pW33vb3BFa3G5D0tu03u2GCbQd-QIGcQwmOD1mDECUx4C3EECvME07W00Z4v-Zq5302ru2EEmBDEW3C"
+"04Z3wR10t4O8XTD0q81Yl10CEyLC+lRV6jRV8aZDouGTOImDmuGW+5oG8W3CrOnQDgjJ2uWgn46n00Z3niY78SX3-n10ru04AG0EquGVY1GC+B72+872E02wOWZBt4ZC"
+"raZ5Ue11uaZ5icbqA601nuY3YMf3OJh385Z3izHHF10DEW5x4WpCIKqVC4JDvaZ45mX-F9WBF9W49S11mCZ3VkY3viW3wtUnWAzS8W0Dk0Z3uw17n03Cn8ZCqKZ7QQb3"
+"X722q8pC19h3foC0v8XZTuVn0uIn08njUuG8I0GEE4k604Z3Xli4twXqA603suYCmuGsju06Exm4B2WCMmB5EqF4Ei8H00Z3F8A1q0Z-i6gFi6A2vOZDE003EKykEGRO"
+"0CZ3JhUfN8Dn0WHDkKZDtSJDEuRv4GpCI4RwDva3vgf3ziY3Bvk3w0M0NuVd4qPdIOhBEO2TG0JDvS3CEavT0OZ4Lhbs5300su0Y2HmDuuWlLvWwjLwIEG72Ey0N0GZ3"
+"Vnf3yDi45mX-53WB53W3tw12nKJDIqZLC83CuSZ38RXvlU00uu0-KJGDuuGFeX0Du4J9E4i98S3DvuWR8mWCqCJDEiMC5ij-96GF9wW5i1GCXLd3rO43qO3EpOHmU9jr"
+"3uGICumJpu0JN1mDE0Wa5PZ39nW38c31uaZ3jbg34-GXowFn0a1n4S3C1NY5asg3xMa3HPb4o3bq53W3EU41vKZ3Iaa3aC11pKZ4EQX3pX00ouGECp0EnWJCEiYl0aZ-"
+"4PXF4P10t4mO4S3DEevFE4FH0CZ3VDMOCgT4300CEq4o0WZ3qwA1qOZ7vCZ3YP31tOZ3zxe3mHD1oaZ6npc-96GF92WCEO19E0NE4O3CI83VEuFO15hq5302suYCE8HP"
+"0GZ4hYd3euPOS5crEq4QEimG4KpCICVBbQd-53G753mC1KC1sGZ3gyg3Gg14oW3DnGZu53W3ReX34q53v8JEnumgFO1B7108EC0EE8hdEamJ0CZ3Lgj-JCWFJCGwk2GE"
+"EqFF00Z43q20o8IE-OSiuGWCku0UwuGb91WDEGazc4mA443EEydu00Z3Up62m03E51h-A6WBA6W33h90qu0u3IGCpuWDJ0WDE8dj0KcbHq95rLsS+e08T40equ2CsaZD"
+"pK3EsW3Ct8JDma3Ebr2Cn0IDkCZDo4JDm0pDp0JDnGJDoOJ0N02FlmMPXPcLXnM07X0FlyL6B10FTm0DW02Ffv6Tb9dRXncJlHcFn10Ym0IBn0IEtO38jKZBmKJEpW3C"
+"o03CsaJCr8JCoKMBmG3FlacNz000yqXVoKC00LZBr0ZDt0ZDoCpDtaZCvO3E9KCHquoCtGJDvG3Cv8pCsa3Cu0JC+NC0wKC0GT38jWZBo4pCnSpDtWJEm0ZCsKZDveUn"
+"0GYCrS3Cva3EsO3E1uC0r4Wh412Dk83CvCpDrapDtKJCs4pDpK0t+hO0ze8Gu0IBsu2CoSZDrCJEqGpCoaJGDmGPj0JDMhO0yGJDrGpDqWJDpKJCrOZCr0J35ZpDqWZC"
+"sO3Cq4ZCtW3EpaZ-A6WFA60Iv0YDkW3CsKJCq8ZCra3Cm4pDp4aJ0CZr430DnKpDvaJDu83CmGJDqSJHOYKCWCZBq83DrSpDn4ZDvOZDoG3E+JC0wGC0CX3CW4ZBt83C"
+"oS3EvWJEr8pCsGJEgJC0q0JCp83CtSJEp8pCrSpDj919suoCp4ZCsCpDuKsU4SZC+JC0+GC0C538j4ZBp0JCsaZCvSpCpKZDsa3D1DWtNF0CpapDnWZCt0pCm43EnqGn"
+"0HZBo8ZDuOJEvG3CtKpDtKZC14c-ICGVIm2Eo0IBqu2Em4ZDpWJOM3HDtW3Co8kY1W0DkGJeNHIDm8JCt83Dt03C16IeXX3Dp0pDu03CrCJCpWpDp8J1Nu-r3atrGXpC"
+"WqYCkKpCvapCn0JEtaJEv8JCr4YxIFn04TZBnGJDtWZCn4pCmSJDoKZDpqsriOJEtO3Cr0pDpGJDn4sC1SX-53G7530D1z40q4c4a8JEqGpDtKJDo4J0a9Tn004Dk0pD"
+"mG3Dr03Cn4ZCrCpCs42rXe82paJE1KC8pKpDu43Es03D+NC0wKC00KJ9AIJCq8JDr03DsW3DqG3Em4qi08ZpTI0Ftu2EuGZDv0pDs4JDsOJCsacmS02DkS3DtCJD1AB4"
+"mKJCo0Z-XLWFXL07uO38jCZBuWJ8g0IEpKpCpapCp4JmcejY1GZCvOJCv4JEp0pDt03EtKu8XeOfVH2CmKZCn03EtO3D14c-F9WBF900tum48GGEquG58mHCvWJDpG3D"
+"u4sTQJC08OJEp42WSGpCoC3CqC3E9v43tu2Co4EI08Z3Ib02vW3E+xa02va0WW38ou2DsS3Eq4iACK3DqaZ5NZWqD90GruYCq8pCo83CuSZCuSJEm8JOS5iwGWJCoKJC"
+"EqV2K43EqaZDt4ah+ZO0kWO08b38pu2EmGpDsS3EtO3EsC3Du0JWHfDn0G3Cn4pDpapDp03EpGJEsqAO05ZBsWpDu83Em03DpO3CnaJE+JC0wGC04b3CWSZBvGZCqWZD"
+"rK3DpW3Do8F4301EoWJDu4azK0ZCmS3EpKGhXxACsaJDsWJCmaJDn8pCouVr3uJr30GEbxADr4JCm03DvWZDoGJCqKZ40mWqHC0GruIEmO3DuKJEnKJCuG3Co4J2534D"
+"kG3EtOZDtapDtW3Cva3CsKm5+JY1PJ2Jv838su2Do0JCtGJCqSJEpCpDo4Z3wiWs4301oGJulm1EmS3EuGZCnqCwm8ZBva3CrS3CmO3EpKZ3DkW-43WF43Gvj2HEu0ZC"
+"numhCGXDoG3DtKZu530Hpu2Cq43DsK3EtW3DuOZDp8pD17D3WKZBm4G4aapDu03DoO3CoKZ-eRWEeR0LvG38jSZBqK3Em0pDua3DqKZDpWZDsuj3Dm3Dk4ZCu4pCv0JC"
+"v0JCoGJDQKu20LZBoKZDu8ZDoWJCrGpDrGZD+NC0+KC00KZ3oX0EmGpDmaJDm03DqOJEnO3CESJ2Qp91uW3CuCJEr43DtCZCpO3CuKWhXD1CvGZCvO3CnGpCmWJEoKSX"
+"+Fn0kCn0iO38vuoCpOJEo03DrumqFGGCrOEmA4C9eOJDr83EoGJEtG3Cfu0In0YCkOJDua3DuWJEuCJCrGpCmKy-+Vz0zTD5t0YCkSJEEWx3G03CpGJDEGF2YZO0aGZB"
+"sS3DvKJDm4JOQWGCoGJ0A1GCXpA3uSZCrum6GG1DnOpDqWZ-NFWFNF02u0oDEuh21ZE6r03DrWZDo81hCezc4G1Dma3DuOJ9o1GEEm43bPD6puoDrWJDn4wMXvD1r4J1"
+"RxFY1q3Y0aZ3+g0CpK3EqK3Cv8ZDuG3CpO19I8T43KWhWOpCvaJEn83Ep4IT5KC4ruYCpWJGgo1CnGJCoaZDpuWb9uVn0aHn843Cmu0NF0GCESi44G3CEq22CKZDtKJG"
+"nAjY1m1DkCZCvKpDuuWeAGGEr4srDKSePH2Dt8ZDm0JEpO3E+B72w872C43Cm4Z3Ow03pGZDuuGIHG1Do4JDuKJHpgTNFWZCu0ZDnW3Ct4JDrO3Cv4Z32cW4yd0CtC3C"
+"sa3Eu8pCv83EuaSF+3b0L157n03Co0ICk0Z3fW04q0ZCo4Je7Rk3Dm0Dka3CIKf3OW3Cm83Dt4Z4n4Hmh3WDI8i28W3EpuG6KGmDquFK284K20mCEyG3ua3DnW3Cr03D"
+"pSZCpGpCq4KKQlO0GKpDmW3EECC24OpCXDMIH11DkCJCuu0YBmHCpSJDrSJEtKm5+lO0kiO0Iyr3CCZCt0Z3va06vGJCo8JEr4GPQRC0COJDuGJOSZnCuK3EpCpD96AF"
+"quoCqCJDrGJEtCZDm8ZCvuFZ1O4Z181OFG3Cn8JDr43CsCZDt4pDm81dJ8Tt3mZDk0JDsSpCv0JEnWpDp4ZDfp9GWGZBrCpDr8pCvW3Dv0JEmKZ5kt00yuF4Nu14NmGC"
+"m0ZDEWT3GWJDqCJCEyu5CSpDuOZ4zaWq530FruoCv03DtSJCu03Du0JErOHmDu0L90pCu0JCm43Dq8pCpS3C59h-53WC5307t0ICkWZCpSZ3ux05p4JCnKZD52aq530D"
+"quoCrG3EoW3EvGJCpWZAl61Et4pDnW3Et4JDvC3DtKpC5Tc-A6WBA600uum0AWYDsKZDsKJErGpCruWf9uW68ejy6G0Cn4QN04J013GCXIRpjWZCnOJCo83EsKZDtO3E"
+"taZ-YIWGYI05v02Ek0pCEOF24WZCEm034apDIOB3Qlz0CC3Cm4Z3fu01vOJ8J00DESz25p2AnWpCvOJEoKJEoOZ-r9XGr913n0JCmuWTN0JCt0pCtWJEp03EsOpDc--4"
+"KKZBp83Emu0wGW1En0pCpCZCE4M3XLX3ux04m03CsCJ0dbGO+3b0k0b044JC1p2Ds8ZCoSZCv83DvWJDtCJPRhzY100DEqV2EaA54O3CXELIGn3Dk43EsapDt43Du0JD"
+"s0pCI0L4+RC0oOC008JOMWICsC3Cm83Coa3CsuWzQ4c504Zp6J18nu2Dq0pDo83CX5E2oOZCQ4F40KZ3QV12qKJCEeD2G8pCrKJE5Xc-SFGVSJGCp4Wn8GZDvum2CGHC"
+"qSJEuWZyCM17tGpDt8JDoGJWVImDv8HtB4aK8SJCr4OfOCZDuKJEuaZ-okXEokHe0328ouICvSZCnCZ3iK12tGJDMq72IVM14KZBXx99pC3Eo4ZDtWJCs8XrL46tqCJC"
+"rO3DqWZDm8ZDtOpCMeL2+lO0kiO00KZ3Eh03saZDr4OE4WJDE4660aJOJgz53mmDsSZCEG77Sa3EtCJEs83DbU64qu2DrWJ98YXDrKJDvCJEIKk2+RC0kOC0WO38suID"
+"nG3Dv81jRWmDqOZ5SpXsB60Co4JDsS3DmGZCt0JCtOH4V4oYGO3DtW3EEaV34W3DECW3IKJ3+NC0kKC0Ems31n4AmO3CsS3DrG3En0Z37vWqnR0FquIEvGZCmGJEpW3D"
+"n4pDn81YTGKCW4ZBrOpDvK3CvapCtSZDp8Z-ewWEew0An0JCu0oCk43Eu4Z4l-15nKpDpC3DXukqA6W3Fb16o83Cm0pDsu0qI00DMyU2K0YDk83Et42d4W3EEyF600Z5"
+"uYX-A6WBA60Bv0IEk03CnapDtS3DESE248JEIeR4QJn0OC3DtaJDq0Z3WT13r8JEt81P8018puIEqu0pA01Cr0pCvuW3K4Y9+NC0kKC0483CEmT8G4pDt8ZCEGV588ZC"
+"ou0vIGGPjOzY1WXDkSZCt4JEEeM3Eiq44C3E5JX3EJ10nuWETm1CrK3Em4pCvauj+lO0zi80oOXRFuWXQG1DvWJEmCJGr60VI7b0SCZBn0ZDsSJDX3A3n0ZCrOXuGG08"
+"ruWvKGnDvCJCo0Z33XX6mPX-63WB6300ouWgJGWCvu0kRumaLWGCoOZ4YAYq5305qu2EuOpCESP2K0JDrK3DnOHjAW08ruY4Os13rW3EpumuS00C+BU329U308Z4VSX4"
+"1D14uWJEraZ3kwGXN9jn0uGxYmHDta3DnG3Equ0MM0GEHlIGAHnDsWJDuKJOS0mD19h-B6WCB605q0YDka3DEuC8GO3DuSJCEKI3EC34IRM1EOP5W0pDqSJEoWZDn4wQ"
+"5ug3NW01uKZ31C24nGpCsWZ3pYHu7uFK2u2K20GDESg3803Du4EJEmk40SJI6eTn0G3Cn43EsSZCuGpDtGpDuaeYK0YCk0JEmumAL4MV8aJCruFK2O4K20WDb197vKpC"
+"q0pCu8Z35w10s42GI-a04GZBIS93EKQ9GCJDp8pDQKW2GSZBn03EI0i38CJDtuWv8ulP58aP50mDEii2q8JDmCZCs0JDnCpDsSZDISg3IRC08CZBquWjPWGCmaZ3Y221"
+"s0Z6Nn0FruICrOJCvKJCsCpDoO3Em81kCuFK283K28HRFG1CoWJCnaZ3hs12p4JDMSE7IRC08KZBruWAJGXCoKZCoSZ80n0AWGZBqCJEqCZCm8Z3Fy01tKZ4TZW-63WC"
+"6300vuG2eG2EuapCs8ZCnKJEIuX5YpY18OZBqu05f8XhR83pAGYDo03Dq83Cv83DXPZ5IiX-SFGVSJmCmuW2e4q0EmF94G3CEqY4IaP3Ix72SCZBtOZDqGJCES55COJC"
+"oaZ6fA22ru2DEKZ6aa3EsKJCr03Dr4Z-DhWFDh01p4Z3+XW4N1Y3TOIWf2WC5ThqI900pu0XL0WD1+E4qCZDqCZ73Q21ruY3G712tSJCEKn68SJCn8XbGuFZ183Z1uW9"
+"Nm1Er0ZDqa3Cnu0-fWGEtWJ8g8Tn0uW9N0nCrS3CnuWwNWWDoKZ5uFHHenWDvC3DI494EK5908Z-jOWEjO05pC38jaZBEqd9EWK7K4pCpGJEvK6VIxY144ZBEmM64KJC"
+"EKj4C8pDpOZ6Fh02ru2C1SD3o4pDsuWtb00C+xH32vH34C3DE0S44KJCE4h68a3CsuW3e0WDUa-2YXEBgjABEeL6C4pCn0Z3s0HZC2WC155CtGpCtWpDr8pDmW3Dp8ng"
+"duVK28JK28nRFmGDoG3DEm66K8JCr8pCtOEZ10aDkaZDnG3EuSZCpSJDqW3Eo4+FXc66sSpDuSZCvumhOGGEne1Kau-e4uoe40WDXd52qWJCXO83r83CquG8WGGPjOTK"
+"20KDk4ZDta3Es4JDqKJDs8pDqOH2AGHCk0pCu0Z30h25mW3Du03EMqY7+NC0kKC0Iys30WJmbW0Co8Z3h922pOJDU-H3CGZBoSZ39f25nGpCraZDQC3BEGv2KKpCo0ZD"
+"m4Wt1LL2SxVn0uIn0m3EWqIDkaZCq8ZDr4pCp8JCIu75cxU8qOpCua3DpapDm83CpG3CIan21OC1oSJ0P0GCEmu3CaZCtSZ-5bWF5b01paZ3fOY3Iw25uapDsOJDEy05"
+"YVM10KZ4vp24qWJEtGJuX20Dbzb4mz00p4GrSaZDvCZCvWpCHoZAD3ZxB533n03DmumeVuGFE4kMEG49E0K5U7b08KZBsu00UG2DmCJCt4JDpapCXKTORJpDrS3CpC3E"
+"uGJDoKZCvuFZce3ZcuGcX018nuICr8Hsj4SZCSJDr0J05BTV8G0Dku0giWnCrW3EsSZD14RYWYGDkKJu8mWCt0JDE8b6QOk2+Rn0zP11q8Z34KY3DQ20oum7W0WDEi94"
+"0KZuH9W3cSHeTH1CmK3DrCZ3dUIuX68kqapCmO3Do4ZCtaJEmSZC+Rn0+On0WGpCWWZBv03EnuWpCu0YKumgNO+s3GmCuumLo0GC1373oG3Eo4WI1KC0ruWBBGGCnu0n"
+"RuWRnumBBu-Y18pY101DW4ZBvu0sj02CvK3EpSJDsCJncADK2mIDkC3DmGJCrWpCrCZ3p9X62b04quoDmKZ3Yc22tOZCEe7D+lY12jY1KGJDWKZBou0AXuWiT0GDEq66"
+"04JmcgTn0GXCnC3ErOZ31712pO3CQek6EiuAEi+A8a3CvOHXF8XiTulY18ZY1umZcG1DrW3ErSZ3K923oG3Cn8Hf98Tn0m0DkSZDEmR4SaZDnCpCu03DIWW4Emi2Ee9C"
+"aC3EuK3Dq03EoOJAXwls3uYs30oDWaZBnOJEuGZ3Mz11s0Z3n-G8AAj9rW0Dk8Z37236v4ZCq8pDvuW8LqMs8GZCvu0QKuGKnmWCq8JCI4R5+NC0kKC0EqZBC43EpCZ3"
+"RR14mSZDtSZ5dB10puCnRGGDkuW3rmmCmW3E53E2tCJD5KCFquICv43CtK3Es43DrG3Cn81bGuVn08Jn08HRFGYDmCJEsSJCqGJC1KMXL9DK2GGDk4S8Ey48GCZDqKJE"
+"Qat2EC348SJCsuWoFm0EpOZCEqU91qj-B6GFBIGDmumlHuW5g0XCpaJDru0IE0GEbiYqSq0EsuoCt83EoCJCnaJCsCJDUKN64GZBEeE740JEEaw2443EESvD+RC0+OC0"
+"Xe20pu0VIm0Cn0ZDE0WB0GZ4kpXsB602p4pDE8F40KZ3Mr10vOX-s48eea3DrWZCvWZDuCJCE8k2oLC00npBtLMOhD4RXDtSfPMQb9tScqL2cGgEGmJRXXtL1S29lLdR"
+"qvJCq03Fl8Z40eHNw05FpHNOdL6Le9NPpXsRiHcFsuIEo8Z3Wn13sKpDou0xvWWCbjIGRhp904XF+a80DW10WqHY14WWji38n0JDo0IBou2D1o72qa3EEu84E4TDUZF3"
+"OOZBrKJDr4Z3xM14u43En4Z4AaI8eX1EtCpCn43E1R63mOpDm87Q1uin0GoCWOZBnC3DuOJCEmZ30aZ33cGWvBjV40mCE8bEe0pDo03EtSZDqS3DbnZ3NX01vSZ3Mh18"
+"t4ZCnCJDp43DXOY-uEWCuE00qu0EH4YXESa8E0460OZ4BiWq5300ru07um1Dv4JEoa3CruGbl8Xo9W08ouY3Kz01n4Z5LN11oCZ-AfYGAf21rKJWoG1Dv4ZCn4Z35mX3"
+"ptH0x9zj3umZq0WCEW954S3CE0oE0GZ6nm02ruoCEqLB4CpDEq-404Z3inX-yHWFyH00suG8B01CoC3EvuGKRuWhW8XzVejY10GDE8Y5883Cu8Ju9WmCkKZ3ZM21tWZ3"
+"x912pCZDIyG5+-a0oya0CS38puY3f131m0Z3Af04u03Em8J8f8jY10nCkaJDu4YQS0JCvK3EqOZDMiR31FECrapCu4ZDoW3CpO3Dv4GO+NC0oKC08W38n4Gn883Dmu08"
+"fuGpS8nzseTn0GWDvumPuu0+KmGCo43DM03DIiR3EKM804Z3cx22o0JDIOL3+NC0oKC00aZ3H3X3l713qa3CtuW0IGmCu8HjP8DK20qCkSJCn0JEma3EnaZDm8JEt4Ow"
+"5Oi3eh10muWGKm0EsaJC+73325330OZ4NX01vKZ3lc16mSJDrWJEsOX5Q8zL80nDkGJEo8HYFGGDq40204JWb4+y0KZ3d5a3GK34nC3Co4Jf1uFZ1u2Z1GWDnumHF00D"
+"Eyq6WG3CsK3DuCJCo8n-M0WDMdg24O3DEyp5S43EtKpDs8JEQmt7OCZBv03DmOZ3Qy13n4pDpenhHu-u9eou9GWDouGEMmWDmSJEESrD48pCEy04bAksI902pWJCEOYB"
+"0SZ3sG11m0Jvx4aKW8ZDtW3Cn83EquGGAOXVauln08Zn00mCE4P70OZ3-e24n0ZCoCZ4SAavT910r4Sxa4JCs83Dv03EqGZ3S4X3xX02t43DIqsF0OZ3xO10nuVy68Ky"
+"6GWDq8HRcG1DsC3Eq0Z3Xu00ruWhAuzqGWIDkO3Cu8JCqSpCruWZ9OH705s5W4JCpKZDsWpDruW6DuFXEO4XE0YDr0oDkK3Dv0Z4IB12o0JCEWzAUNC0SCZBrKJEo0ZD"
+"ESsD883CqO1M-44KI80HEK580KZ3Uh30m8XrDul53uY530WDEKX6aWpCo8ZCpWpDtCZ3iuWvpR01ruY4sdZ3aR11rGZ3GsZ3K+GHHnXDp83Cr4JCnenleuVV8eJV80WD"
+"Iut7ECeGKO3DmSpDtuGQj8nWA8DQ50WDIeQ9EKkGCCZCoaZ3fCH0lw0xG00CIiM50CZ3a012u8pD5SX-C6WBC6W3qS23tO3Emum2LG0EpumptuUe40GEEqz2Ga3EtWJC"
+"EGv208Z40nGuv2ZDpSJCs8JEoC3En83EImO7+NC0oKC00aJGH11Dr83Erum5800E1uc4JKXqdL04ouIDrGZ3mQY4PB41uaZ8-XW3-C40nuW6o81SPak2+lO0zi81t0Z3"
+"cn30ru09w0HEmS3Cru0+T4oxINC0OKZBnS3DsSZ4yg30nuWxk4uwXP10muGohm1CnG3CoOZDqu-P5OqP5GmDnuG9J00CEKy38SpDruGlUG0DruG+8eTn0uGRO01Du8pC"
+"uuGtGe1cKm28ou2EuKJEsC3Co8Z3rK30vaqP+hO0keO0Iit748JCEm+3SKpCoG3CrSpC1Qbq5300qu0Yx01CqC3CmuGnLGWCrOnqJG48ru2Er8JCvO3En8ZDoaZDvaJe"
+"7xVn08Jn00mCEqH34O3EIyK4GKpCmapCgxb4yKZBoWpDpOJCtGJCmOJDvSJwV6YY0SZ4to06sKZCp83Equ-1A8q1A0mDI0gD4GpCEynCIKiAEmvFXgiqbL05tu2Cna3D"
+"EKh70OZ3Ul00o8neC4QPGO3DtCpDEO8H4W3EEKu75Uh-G9WBG9W4Jv33ua3EsuGIgGHCn8ZDtaZ4RmXq6301ouY3xC24r8JCnaZ3jb21sKJ8G4KK483DE4U8EeBGGC3E"
+"uC3C+-K6+yK60SZ3kz01nKZ3Gs10vumfEmGEmKpC1GctMC0DoC3DtC3Et0pDrGZCq4J457km4OJCEWeJ0GZ3saa-yXWFyX00tu0esW2CvCpCsS3Co4JDpu0XD4mUIhO0"
+"XP12sWZDEuwB08Z3xE40qKWhEe5AKC3Cp4JEnumE5vWnS4GO+3b0o0b0ICp98GJEp4SYMCFCMmB3IRC048ZBEOREEKMGOC3CoCpCtSJoh0GDEem3S0pDt4JCvWZCEClB"
+"5qj-MCWBMCW4Ov36vapDmKpCvumrEvWs95sUIN34KKZBqOpCrumd+uWwDWmCp8J1lwWXFm1DmSZCq0ZCtuWMU0WCsjZ5AFD54W3CE0F6COpDtOJOHwG28PXJLej53mmD"
+"mC3D1x02oK3Ecij6SSZBqCJDt8JCEWu3C8pDtSZ5OLa-B6GFBwGjD1WDE8ZEECZ81T02uWZD56gq6300ouGKIHWCru02A0HEmCJDv8XTuKOe0WZ3sz11o0Z3k8Y3I6b3"
+"ZhW-63WB6300ouGfx00CESrGKa3DsGJCmu0X4PEgE0GCEK478W3Evu0orG0Coaq-EOoAeWpCrGpCmapDvSZCECeJ+NC0+KC00CZ3Ch0Eo03DmCZDrKZDnW3DoaJCXPXq"
+"B6W3J452pSpD1n30uumzJeXLZG0Dk4ag0OZ3xva3hPa-VPXHVP15uG38uuICEmGBE4qEEKv20aZ4NnWqXIW3cG52uCJEEyuHEmA60WJhdHXCk8JDp0Z3rv41s8Z34vW-"
+"zXWGzXW3ts43nuIDmumOlu0uE9XakKQ7EJe4e8ZBvOpCq83Dv8JCEiOA0OZ8GG11oOZ3fk01tWZ3Nj30nen7Aul53uY53umwkGmCnum6I0GEIGlE88JEmu0RA8DK2W0D"
+"kOZ3cz02rW3EE0D9ECPK1zl3Pb04t8JEp8Z3OLa33ZY5cRa-53WB5307t0oDkS3Dm8Z3eBH02JGCr8Hl89zA6G0DkuGQmm1Dta3DpC3CruGlyKGnCKZBsOZ4wwZ3OZ00"
+"suWQL5m5+NC0kKC00WJOGwG9Hn0DnGJCEGY9M4E7QNC05w72s4ZCEOv2EWPH1ug3gVX30wY3mcZ3U-X6iDY-53WB5300vu0sP0WDE0kE803DvuWO010CISq2I-a0CKZB"
+"oaZ32050n46P8K3DnqiAmCZBn43Ds8JCvCpDoSZ3dZW-bLWFbL07v038vuoDm4Z3Y546rOJDq43Eo8XAu0GDEdz00CZ3RXa3fG56sSpCtWZCpOHSS40tWOJEqOJCuS3C"
+"numOj8XjZulY1uYY1O1lD1WCECiCEeK7EiD544pDDHhnMo21ouY3d3a3Kq00tumt71mDcOF4WGJDtaJCmSpDsu0X1vlLC8aLCmGEo0IBECzI44ZDXy23vSJDtuGJWujj"
+"7WmDk4Z3L8a31M14pGpCp8Z5R0HWt2GEECA8EWv20SZ3U5X-H9WGH900pumhOG2EpGZCn0JEv43EEi47b8aqNC03qu2DsuGLhu0nru0mGb60ECk2C0JEmWZ3-A31rSZ-"
+"7fYJ7fY30t41nuY3QwY3-V43o4pDtuWJHvDZ10GDEOR8X100qu0+EG0ErK24Xm84q4pDsOZ3BE34qapDvWZ5PcY-YIGdYYHEr0ICkSZDECULEmnFEy8K0WZunRW3Sy31"
+"p8Z3s2JW9IGDvOXzJuWEQuGyMHnCmG3DuaZ3pVX-H9WGH900su0KqWGCrWZ3W9Z3hnZ3dgX3JpWqjOW3AE30muWlrum0OvmcOKu95Eg32VZ3m720nuGn0vWBBu-Y18pY"
+"10mDE0m60WJOFI0Evu0+GGWDvOHw19z53WWDkCJOT5c4EqmF0SZ4+TIGH1mDEeO84aJEE4wC8WJCpulKT8aKT0GEEqj7mKZCmSJCoapDsC3DpaZ57vWq53W3fp40muWo"
+"Q1HCp83DmumjtKEkWCZBpOJCo8pCvuGJCvGg981b8ul53uY534EkE4eJ8SpCuuW3+W0Ct8Z5DmWppRW4u432nCJEEGMD403CE8FG5KC8nuICt8ZDpK3CECuKXmUHdvVn"
+"0aHn04Z45t42rOJDECXKESYJ0aZ3EbWt5K20qu0cqu0-CWnDvSZDnK3CM4tCK0ICkCJEpu0Vc0mCEy6F00Z5SFY-53WC53W4qL52nSpCEecM08Z3Dy50oekcLWnDk4ZC"
+"vOJD1rf3mt51qGJuy4M5OaZCn4JEs4Z3j+43s03Ct4g0+RC0oOC008Z4hW34tOJDn8Z3PR43pS3Ct8nLV8j53GYCk83Eu43CoaJD1hF2mWpC5fZ3wt01qaZ30b01oaZ3"
+"qZ30mO1DDuVK2uIK2umsUuWu8mWDs4JCE0HBEuqEU7l10HZBsCZCqCpCvK3Cv0JCmCZCXlZ3Po21mGZ38K25uGpCq8JEEyc2XrY-53WB5300qumG9mGCv4JDE4b8EGSH"
+"8CJCq48GIlO0GOZBqOpDEWC2OK3DuG3CmWZ5iaG0T30CE8H6EGx9EKTGIew4+RC0oOC0IKSJ4C3EX510mumIAHGDsOnqd8DDGmGCkG3EECEBEW7ECa3EraZ54MHe+1WC"
+"EyO888ZCruGDi0WDI4s6+RC0oOC0EKo5C0ZCuGZ3rG40rum+800EIKLEIlO0EGcEEi87C43Cs4Z3Ah50pKMn1p21tKZ3Jt40numyuumLUvVK2uJK28nsUumVyG0Eru0x"
+"9HWCs4ygUZM108Z3v+W3q1Z3F2a3FCJeo6oYSC3CpKZDt0JDEiSJ1Qa-63WF63W3hx2Ds4ZDuapCmC3Dq83EpKZvL054ruoCp8Z3Ii23mS3Ep81vG5WhIWW208Z3bx22"
+"t43CEuy3MSC6+pz0kmz0bVh38Q22sSJDEeyJEaxB0KcubS62pOJDE8OPEGgF8OJCu81Tu4ssG0ZDpGJCEK+F40ZDEGR714c-53WB5301n0J80HGDnu0cWXWCoKZ34S30"
+"t4yfINn0ECe4X1W3iT63uKJDqOnUBuWMH00EESn8GWpCqK3DEaFPI0H4+hO0zee35t43nuIDoumS3vmYS00DEesL1Hhq6303ru2DqumWC1WCEaA38OZCp8XpI44K0OZ3"
+"0P53pWJDnuWZfHGDs4GO+RC0oOC008Z3OnW3rN13q4ZDquGNYGmDr8n4BfjP544K8WpDmuGcEumxQK-j00Z3dz43oa3Dp813Yuly6uZy60GCbVB1naZ38wa3Ng51r0Zw"
+"2PLecHWCtuGEnGGEouWAueHGaGWCk40nESbLKGZDnSZDvuVTPuJTPWHCnG38tuoCEW-K4CJCEuN3EaoIXfdqG904quYDnSZ4NS42s0JDEeZ692A4suoCsOZ3wo20ouWF"
+"Wvm2t4uj+Rn0kOn00KZ37e03q0ZDpuW8uuWCBGGEu8nHE8jn0WIDkaJCs8JDma3DquWyM1mDMOG3I4MHCS3Es0Z3ob10uuWTGLqP+RC0kOC00OZ3-610suGWKW1DmKpC"
 );
-static sybie::datain::DataItem item3("haarcascade_frontalface_alt.xml",3,
-"oKn8+7t0z5d4q3X3-uX31312v0ZDE8520GdXa263rCJDt81Dl0HEnSJCtumTUeen1WWCv8Z3Is32mKpCEmS90OZr5O10puFzGeDzGetVD81zGu-VD8rVD4YeqC3CmS3E"
-"q0JCq4ZDrG3CI6o3aGZDta3EnS3ErKZ3dVX3LRbYY609tC3CtGZDp83EuuWMGvWyyuCQ3ulxGOixGKMGwv48IeO9EKW5+3H161H105ZBn03CuKpDvS3DvOJCq03CI8U5"
-"QcC4iapCtK3Cn0JCp8pDuufbIWGDq4Z3Ki17oW3ErGpCt0Zr0F20puVoGOSoGKc9wXQ05ok-YHZKYH36su2CqSZCsuWk90XDqO3DqO12sO98Fm0DoGZCEW2PEiTH4O3C"
-"E4yJA+q04KZDEeqNE0xKCSJDtOZs+o10puVoGOSoGuWAW0GEEu35ov52EOaFEKkC+NV8+KV8IaSBaG3DvG3Eq03CrKZ3N1caoJ03pOpCnumNRv0keWGDo4ZbhU35r8JE"
-"p43EE8fAEWY8E0+DABF10GZ-33Xn33X3TdW3zlYQY6W4E7Y4ldb-Y6WGY602ruoCEOSDGG3Eu43EEKw20aZgMg46sWZDmGJDou0FlW0DvOZcMg40qumkOHYCn03DrWpD"
-"rK3DMZ080GZ-23Xn2311n0Z4THZSla10nuGOCvlQIObQIm0Ek43EXz09t4JDt43CsaJEsOg4KGmCvu0-O0YDuOpCoOJEu0Zc-l25q83CqCJEEiAJ84ZDsejQI00D+7C4"
-"67C4XCe3vJYQFD00muGDK81-Qu-J38qJ3umu9u0EgGIDo03EnSJDnWZCI6F1a4JEs8ZDo4JErSZ3pw51tKZaIDY3kr5AuaJCuO3DtSZDs4ZrxW00qu-kGOykG4CbEKQB"
-"g9Q0E8T5+VwDITwD4CZB1Id3Wk26paJEm4pDq81yEePE803CuOZCra3CmS3DrCJEEGJ8Ic3244pCEaaI0GZ3RA60rumNDuib6ulbGOibG0WDE412EK2IsPQ00KZ3i-Z-"
-"8kWH8k02nuIEE8uJGC3CtK3EESWF0GJXkRvXBW0DqWZ3YW43nCJEm8XfeO9J3um-O0YCp8ZDnGJDnSZs7z20qu-bG8zbG4Cco5INIKzAEerG+-E12zE14OZBEOR7EKKB"
-"C03DqOZ31WLmLQvf1mGDpCJDEqyOK4pDqWJEsefrE0mCEC9F4WJDEy288W3Ep4GDExq0+Z746Z74EONPwrI30OZ4vWW-rCaIrC41ouY3k321tSZ3p613tSJCqOXGMfPf"
-"1um8l1WCEmu2CWZDn8ZcwWW3-C29sGpCuSpCo43Dtu06KuSf1u-UGeyUGuGzHOuaou0YBucuJeH8e4n8+B+4g8+4OqYDk8ZCsGZ3Np53sC3EnuGR6fAS3GGDquWueXnD"
-"o0pCqGJDEyH3Awh1eG3EoGJDpSJEp83EEye7MxH60GZ-U2XnU2X3PrYUA7G0ZumTNOnKD82DT4H04mpNIGB7P8Y-87GF8xG9AmoCpKpCp03CoW3CuOZ3UEXYgM1BqK3E"
-"sGZCpapCpK3CEa1AIcj1GO3DnGpDESz7G8JCmSZCUFxI+dB46dB4Eyz404Z3RaXQ0Y03n038o8njBP6n1uGFluGsBbW8+JS0sGS0XW83r8pCuu0F8GWCqOvgq1GDE8L3"
-"08J80pWCt8ZCE4n8AQu0GC3DoaJEICw3C4JDp4Z3OxZoHL00rulsGuisG4Cz04ZU37W3XGX-WWbIWW51j8Z3I817qGZDmCJDs8Z3gVbgTY00nuGmtu07FHnCoapDpGZb"
-"1o16r0JCpCJCruGSRXGEsCZ35tWpd6W-Q3XoQ3H8cgtCF0GCE8C2EOg4fbaJlK00nu0vXan8+ps0zn67j4ZBoW3CnOZ4iMc35H60tuA+6WmCmKJupO1ApvWZ8eeS300D"
-"EWxUG0JDmaJEEu+GQZ9R0KZ-z3Xnz3X5dqdSaA11r0Y3lAZ-qsWIqs05tu2CsWpDEeGBKOJEv8pDsugIKG0Ds8XcgH0Esu0FguvGFXXDqCZDr03DEu4UCGJCrGZr0410"
-"ruF0HOC0HKMAEOa2kjj1EmNHEGCC+JR32HR3KaZBsW3EmuGSs11DmS3CtenMFef0HuG0bWGEv0Z3oC73nKZCtOfW800CIeFCO8JEmaZCq0Zs4f00rul0HOi0H0WCEew7"
-"XnYQd600ou0syumBYv-f18qf1GmCku0BxXYDraZCuO3ErOZDregKj0JDnWpDsCpDo0JEuaZCICyOAEF1KCZCp43En4MWCWJDrKZsMx70rul0HOi0Hull6ull6Oel6u0s"
-"rmWCmKpDEyi4G03DrGZDQU-7C0pDv8Z3-J22nW3CEefTIss08KZCmuWnZumsKWGCu4Z3X1Yp4YW-X4XnX4XY3YG0ZOoN8uaW84ysP8Y-1YWB1Y04suYDv0Z3Lo11t4Z3"
-"vO10ruQqI1HDpCJCs48-4aJCIW+UIYS08C3EnuG1d00EEyw38apDvOzDC1GD+JK4AJK4EKW2EmR3gLJ1Lpj5CfW-e6WDe602t03CEuA4EGeQ4W3DQyTJMsj1KKZDrK3D"
-"oumrv1WDECs3M2t0GGZDuWJEEuMMG4ZCqKJCE0T3E3t0+7I467I4fjYSb1a3ENe3CpX-c6WGc602tu2DEGrLEOFKGapCq0JCMGs8MMQ04GJDI0xW00Z3IU81m0Z3y1aY"
-"RR05s83EtG3CEWIK8GJDt8nJWuSf1uF1HeC1HumvlvGKeONJ30GEb5d-d6WGd606ouYCo8pDuuGRUGHDtOpDq0Zh1lY3ZA17pCZCsCJDuSZdUg84pC3CpOZ3u1c3+A30"
-"reDJ30WD+VE46VE44K38EKGQonq00OZ-b6WNb607jKZBq4pCmKZ32R40ou0BA0mCgUAIEqz5EGoEEqz50aZ4BsdYDD03r03Cru0BTXHDnKJCmOZCMh2D0OZ-c3Xqc3XX"
-"eY41nCZ3rHX3IAX-FDWGFDW4uJ68o03Cq0JCsSJDE4mJIGD7QkDC1EC9pS3EmSZCtC3EsO98W02Dp8JDnCpCuOZ34R60ouWdFfyz40WD+NC46NC40OZ3vrW3W3ZQtJG1"
-"a4w6fWgJEe00u4ooPCY-dXWAdX00ouGVNnGEnOJEEeMBCW3DtCZ4qKYc1R09nOJDuCJDmWZCruWHFOfo1mGDqGpDEisK04Zx+X20sulwGOiwG0GEXei3IkWQA700v4sb"
-"EW62+Fq32Dq3qGZBoWJEqK3DtW3Cr4JE1Qkfki13qWZDmuGolXWCmSZ34YabRK42sSpDEGrHS0JEnSZCmK3EM7f40OZ-g3Xng3X4yuZ37YYQd600muGF+4Cw+VQ02TQ0"
-"8KZBvu0q9WGDmWZ3o952qKJDICv8Q2g7W8ZDoC3Cr43Dm8nwXe9NDWWDn8Z3wt80vumDd10CQtT50OZ-g3Xng310vumaZuGIefsf1qcJ+h6IAf6IEKB708Z3qj01paZ3"
-"RQ40suG5PeOjSGIDp4JEpSpDnWpCEWY80WZbmJ00puGAr12Eu0ZDv83Du8J8Nxik6ulnGOinG0GEXLYXmJW5h7Y-9DWG9D02quYDEuDPaSJEq0JCvGZDmOZgBeW3Ya11"
-"oGZ4A230num-c9PfGuWDCXGEoKZ43E41q8ZsCN30suVfGeSfG81QyuNNU8nNvu0geuVg18Kg14sIEmrASWJDvS3Cp43EEOdEEkq00KZ3Ur73ma3Crum5CwWUBeuhB0nC"
-"uWpCs8npFwmmXej5v0WD+7A467A40WZ7akYQjJW6KUZ-zuXIzu15pu2CqGpCE0SFOOZCsKJEm8ZgKQW3ym18uKpCm83EtS3Db8dYd607tC3CnW3DqaZ3C-81mOZtd6W-"
-"Z2XnZ2X3hgOWFhcf18H3gvGqhOngBuFYBe2YB0HBsuICruGTrmGCuW3EEyK80WZ4baXb9k0BpWpCmWpCv0JEtGJEEKy2IAF18K3Dsu0uAwGZtu0lCQju90mD+FA46FA4"
-"0WZ4nrYSOu10u8Xt9uF6Ue46Uume5wGR6vm+C1XCo83DquQu9GZCrOZDp03CmC3Dr8pCmum9jfOJ3GGDmuWtIwWSlX0EoGZtTx40tu-eGeyeGu04gvWScecJ30GCEaEd"
-"+pWFMnWFKaZBpKpCuum1NGWDnuW2yuQTj0WDEy5ZaOZDnSpCnSJCvaZbED01qaZ3ahX3po30quWEvOzII0mD+7A467A404Z3-c50nu0emeMg10mD1KIWtx-F8uqF80HD"
-"oCpCuu0RNoWDqSJDEekG0GdXft33qS3Dru0OMI0ErumYN1GCMID94S3EE0RcK03EoWZCquGaj9DQB1mD+h74Eh74EGDEoHP5443CI0uL+BNBA9NBaCZBrSZDrOZCmGZ3"
-"dt32tO3Dogp5C0ZDsOZ3BA71oSZ3ugbaNQ00ou0fGWGEu0Z3C591sCZ3KHXomq00tuVUGOSUG0GCIK+ConHPMmw2+RQ0EPQ04SZBE8haaCJCtW3Dr4JErKZh6FX3vt53"
-"n8JDtuG3N1WCIaqeAUf1OG3Cq4JEmWZ3XsW3e6arHD60tuFUGOCUGumP61mDI4aCgzE19KY3R5a-ddWHddW4mqW4EJ85vW3DrSJDQsX4EmqLSKJCo8pCqO3EEG05Ikq0"
-"4G3EE4DS0CZ3jK60tu0VSPTy4u-UGOyUGO1ihPdzz9Xga00D+7f165f1CSZBtCZ3gXe3dV40uu0ZQeQD1H3DsaJDu0JDv0pDoGJEqePqTmnDm83EvW3CuuWSVuWGUOTf"
-"1uVUGOSUG0GEIytKoTu20aZ4gkW-7kWJ7k03quoCouWZSI0EruG2mWWCsOZgFS17oW3DvKZDs0Z4y440oum+Je8y40JDp03DsW3DmGZCvC3CIyeHERf1+l746l74Q03K"
-"or325GY3WcIYkh5WQumrOuldGeadGumskGGDpuG7lHmCnumsz0GCMS7KMEp50SZ3l-34uGJEm4Z3Tm70oO9Ot10DE8OO8aZCmuWc8G0Etez-21mD+-946-94QGoc0KZS"
-"wQW3BkIeSaoo+3A4g0A4C4ZBm8Z3MN98m8pCna3En0JDI88CQ+940aZ3fYb3rE34qG3ErSZbkk07rKpDpGZDq0Z3vge3GodqOK00uu-dGOydGu0Qy0WCsPQ0E0iE+NQ0"
-"ILQ04SZBI46Y0WZ3nfd31jW5U7gbfV93pO3Eq42t0CZ39560sufdG0XCsCJEu8nYRwmBFOzKD00E+x94Ax940KZ3ZfbUUZH0buWM1vVm6uKm60HCkOpDnum1cvGVY1mC"
-"EOCEc2T7GC3EqaJCE4YQC03DnWZ4sHaa1RW3sZ30numRTYmCuGZs-P60uuFeGOCeGOXkd8tP8u0k-4id+t942r94KGZBv8ZDmuWoMWHErS3DvCpDkMe68SZCvuWmhHGC"
-"ouGYOffkOvW9iwWCl21EnGZDs8nE3fiP8uFohgCoh20DE0Y4XzYRSQ00v4G9+36CI16CCGZBpaZ3M387o83CvKJEnWZhEe01qWZ3ks52n0JEEWVTIOzMEsq0eKJEnaZC"
-"nW3CsCpCEOE6Mpf1+JA4EJA404Z4NtXSe600s4G9+ZQ0IXQ0Iql34SpDEuPTEyjI4GpDE08MAw+4KOJEmCZDtumDGvGi9e9J3G0DsumjrGmDmumNWIWDrejWfuVnhwSn"
-"hw-c6e-c60WCECveGaZDsaZCXtD2q03DgMF1KKpCt0ZDvuWnIoGDrG3EEaDUAsq00CZ3+A96s83CvCJCsuWrQPTJ3ulfGOifGumyi10D1QlQA9X33c60o409+3v221v2"
-"EauC0aZ3yq56ua3CtCZDpumrbeuI30GDEa0FWOJDoSJEnapDsuWImPfe1umLQHGCqu0qL00DE0b2EVf1+FA4EFA4EyS7o5J3EeY9+lu2Iju204Z361B1qaZ3M444vaZC"
-"oaZiBg74sO3CoCZ3VEZ3LcY3ZLZYb600suW7T20DECUTEuoDEmegENQ0+BA46BA4MKXXsDBiE41504Z3m9X-apaFap40nuWSZIWDvuWCkH1DvS3EoSZ4rzXbz110q4A7"
-"8CJDvu0VBHGCvevI3WGDuOZ3lj45uK3DnO3DI0mLERQ0+t74At740OZ34BY3cbeQkJG0bu0LDuVCDeKCD0GEEi0PE4aE80ZCnumoK2GEg+74OK3DpKJEt4Z3QS72r8ZC"
-"UQpF08Z34d27p0pCr03DvGZsiH40vu-VGOyVG8Hobv7g1um3cuG6mulCDuaCD0WDIi-L8O3DmuGJs00DIqDGMQY4Eq324KpDEyiO8WZCouvc6uWrO1WDEKrWEuOF4WpD"
-"MpJQ+NzgANzgEqqeESW4gvq04O38Eag6+pq0Anq0CqYCkSZ3iU40n81WVwmjiLYfMQF14KZDEmzUK8pDq4ZDsuWX7PPYQumIGwmrC21EsGJCmuGu-giz4u-ihAzih2GC"
-"M084gTQ000Z3O0Z3S4Y-TQWGTQ0FouoCm8ZDqW3CpCJEqOpDruQkdWHDnOJCsKpDECXg883Cq8gYB0GDE8SIO4JCv4ZDtCZ3Bqepd6W-X4YnX4Y3UXfV3iY3AkGOrv-y"
-"48qy4W0Ck8Z3-OZ3HrZ3CA21sCZblL11qWZ3br01naZ3xa40pufZEnmDnGpDEesC8W3Cn4ydM-M50aZ-u1Xnu1X3cKbUCOI8Ww-2cOr2cG0DkumEWH1Co8JCqGZ30aai"
-"rQ91t8Z3qY16vG3CoSpDnuWrbeeYB0GDEqCnCWJEu8Z3Tm70qez9Lvlhhgihhw0DGvGPdf7Yd1WD14Y3YZHYnxqBS4WIEKMI+luPAjuPEGa4CG3CqCZ3gZ65uWJEp43C"
-"MM6lEmh60GZ4bQ93vOZDt4MfIgS0EuPd8S3CouGJPGGDoOjk0vFrhgCrhwmN2501gTh1MaD6+7Z9A5Z9ECL38SZCouGZJwW3qgHL13GDIkZMEmqF8GZDruma-HmCq8nK"
-"avOf10GDEiY9ECHRGWpCuS3DQNQ0+x946x94Qajmojv7I0T7EmD6fnc-GtXAGt12j8ZBEK1J1x43p0ZCoumR6xWWQOvgB00DEWgf04Z3HU41oCZ3Shca5e01rCZ4lfb3"
-"zgX3-6Zr0ed-DkgoDkg4y3e4Q5iQFDG1bON5581BKan8+pS0zmi3CG11pOZ4G9A4tGJDoWZ3YSXYCG12qS3DEqvlEyLDEqAJ0GZa6704tK3CqCZ3+C21m8Z370irkMX-"
-"9kgo9kg4Oe30ouWI4gcn1uGzg9Hknv1TuuKt68HyB81ftwVb3OKb300EE00oEGSjEy378a3DuuAwH10DEGlD8K3EuumU9ImDqu0ZV8PF5mnCuCZDoWZDmu01HwW1Dfyy"
-"B0GC+7xgA7xgEC15Ier5kzS0ISi6Ee82+Z35+W358qoCkuG6GHGCpuGELn0Do0pCMupVQEq3maJDoCJDt0JDpSJDsSZcIOc3NF99t4pCma3DoC3Dqejcz1GC+BxgABxg"
-"EWR5443EwvSAEyNbE4PFfagJsD01n0Y36Vg-dEdLdEd3Jl31s0Z39KZ3-2A1uKJu9Ovo101DnCpDtuW+nWnDpaZDpapCIEK18K3DtuGUBXmDrWZ3v3Zsdz01n0Z-C6Yn"
-"C6Y3b1Z4c0bSqDW3Dgb3XFf-qDWFqD03quYCsuGgN00CIqMg0SZ6zmfce602qW3DE8BJCG3DvCZ3jafbe6W3if58vGJCpO3En0pC1ecqSKW-G4XnG4X3Oz30nuGxGu6g"
-"14+2E885fWgJpDW3GgL6YuFi8e2i8GGCkuW04vmi5oGDtaJCXQWfoD0DrOZCqWJDuSpCsaJEnWZ3JQcYcR05qGpCoG3DES6r8GpDnerHlMZ0UfcU443C+dJ46dJ40WZ3"
-"d4a3KdYQA7W4+wc3-kY-RBXGRB1BnuYDtS3DtS3CpC3EEiknMWWdQAt00OZ3s891nWZ4g850uuGRag8g10ZDpO3DoGJCuC3EqKJDUpIG443C+VbC6VbCbGe3JzWTe6W3"
-"vie-4rYI4r29nuICtCZCs8JEr8Xn930DMqn6QYQ0CK3DqKZ37u04oSZDrWZ3D5XYe6W30V80quGlh1nDn83DveT7RGGCmuFjXuCjXGWCWum11fsf1u0kIuGFZP665u0X"
-"VbX8+ZH1zY10uuGLAG1EnSJCnSZ3-u41maZ4xDYbJ+07rCpCqSJDoSZ3B931mGZcJC6DpW3EraJCtaZDnKJEtGZsJc81n0Z-y4Xny4X4EwXUrB40s4AF+3i1I1i10TZB"
-"sCpDuC3DmO3Cm0JDuGpC53ide602vWJDEu1IXHddZYd3-OD3vGJCvu0i-G0DpuG4Y8jY8uVtXuStX8nqO97vIen28vF658565mGDsW3DEyWd0SZ49L50tuwuIuGJv0nD"
-"p4ZCmuGFChPDWGGDsuW1A2WDECiEEKHlMZXA443C+-T8A-T8E4Q3ESZ2gbH1I8s6EGeJ+Z622X62EGz5G8JCr4JCEGWtC4ZDnGZ3Z830qPe1+uWiDGGEo4ilE0atQocf"
-"8KJCuu07NXnDm8ZDtG3EEOGoEpq0EGI60qY9qeWFMZh-vujJvuj4duR80g6f10GEf1d-CDWKCDW3dcY3sjW3d-A2oSJCooq04GZCEKwNOSpDp83CmaZb8u32rO3EEewD"
-"KW3Eq0pCp8XDbADg1uFNoeCNouFJ38FJ3u03Mum1JwW4XnGEu0ZDEKWfAkq0E038CSJCsaZ4vOA0teve10WCEuqQEmH78GZDnumbG9jkh0GCEyXc+lq06lq0IyF9wjq0"
-"EKU2+3u8E1u84WZBEaOleK3CmSZDqOpCu43Ek242Oa3EsSZDp8Z3ZQi3qYdaA3X3H376q8ZDvO3EruG8OODJt0GC+d1gEd1g+pq0opq0aq2Ek8pDpO3CvaZ3VJB2rKJE"
-"MiPVQcL304Z36eB1taZ3+Df30Daaf600ruW-p0GDESU8XUc3cwXqrJW-f2Xnf2X3u0YU0XW3n9Hm-w-F88qF8GmCku0P92mDEy3U0GZ3E0f5Ffdbc602r4pDIu7SKaZD"
-"t8ZCqumz0hu-EWmCpaZ3Fa71maZ38c60peTcY1GC+V-fAV-fIC42wrXAIC42bwX-1NXF1N18jSZBvKZCrO3EECQXEG5ZMyViMcQ0IKRF8WpCouGiaJ0Dpu0EkfOg1umw"
-"L8HgdXGEq4Z3KudsXQW-e2Xne2X4eKf3BrYQid00pu0uEu07WuVg18Kg1WHCkKpCu8ZCEKrc8WJCvuGLTgAeLWGCtWZ3Mh13t43CvumJGAvz4uGxX8HvuH0CsuWGDuTI"
-"8uFYGOCYGumH8uGsc8dI84G9EC0N+l42Ej42EyaHEyG9E0gG0GZ3qm80o8PQZ0GCE4XHC8JCmKZ3ViD0nuGOeheJ3umcG1WDEC0u0GZ3xtbutJW-62Xn62X-AvcxAv66"
-"nu2Dp4JDuume2vGUC10CkolQaGpCsWZCrOJEoOZ30Wi3t7XZc601sKZ3Vc63uS3Emu0OIuDx9uFXGOCXGuGUL8XbQe6z44YoIeIT+JF12HF1Xfa3-T41q8Z3P8i3wYjb"
-"OX20tuWMg0GEEOqr0WZ4lkkamJ05qaJDv8JCEaQuCaZCuKZsjX50nuVqdgSqdMCcEanIgHQ05Zf3xqW-a6WKa601n8Z3kPd33xE0ouGa-Ofx4mGDuKJCESfbGWZCnSJD"
-"E82AEYq080pCoumHk10CES7q0SZtkJW-nUgonUg3vOE0nu05ff6f1uGqV7m8+FQ02DQ040ZBEWZTGOZDnapCEOcv4apDM2f10KZ35jE3mG3EmuWiJ3WDEqprAAQ0e8pD"
-"rKJCoWJCqKZCEu-2Mp-C04Z-7Ugo7UQ9Ywm2Dece1u0KNxGKSule18ae1GGBn81ybxW9S0nCpa3Ct8hB191j0oGCtaJCEqk808Z3S9XYe602r8JCEyS7483EEeNV00Z3"
-"njapLxW-dTgpdTg3uDb3ugcQe6W4YkY3TIY-f6WHf600vu08Xx0r9mWDtapCEeJdIa99QUc64WpCEuRl08Z3wFg3BpkbNQ02r4JCE8Km88ZCuuWIUODtf0GC+hqfAhqf"
-"Ee07+LVUMy74UWch+RR7gOR7E8N5EeUH8SpCvumTW1mCEuq2AAN5E89mE0HTKOZCpSpCpu05teuI30mDEKvUCG3DtKZ3h+60puTiTuVHdgSHdwWBGf7E8uWBGv-D88rD"
-"8GmCkumlb0GCECDVEWmP44ZCgMUFEmlNEqzk00Z3c130nev-Yp0Dn0JCEmhL8aZDmuGqHQjKMIGCou-TGOyTGO1SCANW7wG5cK01+xX4+uX480ZBm4egG4ZCnaZDEKzW"
-"Ea1REUq00aZ3Qdk3B3Z3v1X3DbYY7DW4VNA0su0SG1mCEWiEMZqD04Z-0Tgo0Tg6TE10r8da68nwku0-iu-a6Oqa6umRG0GDEG7J8CJEuumfbuWnneOf100CECnDEGIY"
-"0CZ3bI90qOfZ6mGDnOJDIedME4qG00JmuBzD8u-RGOyRGumk9uGG7hcD84w3Eyz4+BQ069Q0mGZBvSZCrC3CmOpCoGZ3ykc4GtccaL10tumzh2mCXtF0vuGzRPPD8O1E"
-"GvGwduWOQOzVr0GC+ZnfIZnfEiQK+jq00SZ-ADWMAD05vuoDsSZDESWmOOJDvapDuWZgGzX3+kj3oXW3afZ3A1lbe601tWZ3la30vumB1vW24QD3N8-5dI38W02FcLMO"
-"qLdSbvZ2W8J00G1FoLsOqDdFM00IW02FVvJDWS38u0YCWqICkmpBV9r800IEWS38q0YCW8J1YG0Fl8LJ0W2Fqb6RqL6P+03FlqW24mpBIv80Go3Te9NPpXsRiHcFj8ZB"
-"qO3DtSJCmCpDv8JCp0JErKMBm0pCyyI6a8Zo0G7FiLcPqzbTXncFmuoCpapCpapDv8pDoW3DoGJCyyI5TO3D0mWSfT6QHK3Hr8ZCmK3CpW3Ct0ZDtWpDnmpBPuH0-701"
-"Lu30y8p31m3FXqIBWGdSbL68nCJCWqIBPWI98LXD14G1i0YSlz6TWusRaLcEj0Wsd603v0ICou7g10GEbWA0puFg184g1GaDkSJEpSpDm03CtS3Ev4pCr0Zfe60FqCZD"
-"r4pCsaZCnG3CrSJEoe9g1GpCvOZDp4ZCq03EqGpDpeDg10WCwiN0s8T000Y-e6WKe605s0ICm0oCk1r0S43CWO38r0oC+7r065r041ZBmCZCs03Em8JCmK3CsaJCs8vI"
-"3mJDmKZCt8pCuW3DrWZCr83CIEQ0y83DoKZCnGJEqOZCsaJEuaZsZ600pu-e18ye1GGCm4cI8C38n87f10GC1K22n0IC+xq0Avq04LZBuKJCqGZCn43Ct83DtGpDo4cJ"
-"0GZbh600t4Oz1YF4vGJEvKZbsJ0FqSJDuKpDq0ZDuK3Ds8JErezg100D+lQ02lQ000J82oGCW4JDkjQ0Xv41n4JOHvF+484+4G1Ck0ZCvOJOJn1Cm83DpGZCr8Pf1mpC"
-"uaZCoWJEn0ZCmSpDqW3DI2r0uKZCsCJDvSJEsKZCq03Dt85K3G0Fl4SWrdC6yC7TXTMPVbVBeOZDkOZDv4ZCmS3EX4F5o4JEmmpB+K20DhABy0NOoLcRqvJCpmpBDiG4"
-"Q0YRbX7T+qICyyI19KF5vwJnWN0MbmPzC00Foy90+Wn15OJ0YG08mulI28iI2mHCW038nW38suMI2GmDW4qI0OZ-oFWHoF0Hmu2CqOJDr03Er4pCnKZCraJEMUa0m8pD"
-"saJDm4ZCmaZCraZ3NaWYYZ0Ds83DmKZCoWZDnG3EmSJ8Txiu8uFe18Ce1WmDWSJuwusd1umXA0WC+7P1E5P10TZBvKpCt4ZCt4ZDsa3EsGZDgQe2uGZCrO3DuKJCmGJD"
-"s03ErOft8mZDvGZCvCJEnOZCoK3DpC3DI3P1+pD2EpD2K4ZDWO38quMf10GD1G20p8IBCqeKP403yybFu4MYPCY-GnWAGn0Hsu2Eo8JCrOJCpSpDuO3EmKZDccr1yCpD"
-"n43DuS3CrG3EoG3EoaZbqM07v03CtCZCuSJ0wWmCm0Zq97W-2aWn2aW3+f02v02EkXS08O38vOXJCuFL784L7mGCkapCXG68vSpDmS3CmapCgwF2q83Cq4JCpCJEq0ZC"
-"na3EXJYYIK0DrC3CmK3Dr0JEsCJEtGZsb6W-yZWnyZ00ru0IC0WCs9h18K38n4MI+h43Af43GqYCkOpDEK43KWJEtCpCpu0fFOAJ3GJDq4ZDn8ZDoKJCo83CtePk6WpC"
-"n0pCnSJEmCpDrS3CvKZrpt00ruVk6eSk6WWDWWJ8hgMGHGGCnKwD0KZ6ntWJLK00tummA00DLCY-LKGlLGaCkS3EnW3Cs03Du03CrWJCvCJ893mCIA82yKZCtS3Ep8pD"
-"qOJDmKpDpSZaLK04pGZDt0Jv9nWCtC3CQJM40OZ-97Wm9700reOo1409vKgJ8700vuFo186o1WKBquYDtSJEmS3ErGpDuGZCu0JCXaictu0Dp03EoCJCn4JDpGJCnWZc"
-"970Coa3DqaZCmOJDv0ZDru0-CeyIA0mD+dS02dS00aJO6vm79ucqK0WDIia2+xj16vj14DZBmCpCr4ZDmSpDoOZDrG3Cq4IfMUZ3uKpDtC3Et8pDpCJCnOJCrOvXHWpC"
-"uKZCmapDma3DmK3EvaZrIJ10uuVf18Sf10GDEyL4wXd55xD2u0IC+VQ06TQ08SZBuuG1MG2CvWJCqaJCu03Dgkq0qGpCnS3DpWJEm03Dt0pDEqx2AI82XyC3mKpDv46V"
-"883EsOjyB0GE+RQ02RQ0C43CW8ZVc6W4kJX-c6WKc60EjGZBoKJDpWJDnC3Ema3DE075XrabxQ00ouW7OG2CpapCoKpDnGJCMco4KKpCoGZCv4SzCaZDuWJ0reiy40GC"
-"+xD46xD44G38XaQ0vP6z4409EOo49IlJyQ02r0IDT8Y-3YWA3YW3ed1AtCJDs43CpK3CmCZ364H89hvk6W0DsWZ34W11t4JGAGGEpO9X8W0EqCZ3Hs07pK3DvKpDrWZq"
-"Ps00nu-1HOy1H0GEXKiWzQ01n4Z-+QWM+Q03nu2Dtu0sN0IEpWJCnWZCqaJPnP9g1m3DoWJCrGZCuapDo83Dq8ZDIYQ0yKpDrKJDuSZCo0JCv4JErOZre6W-B4XnB4He"
-"M0GCECS6g5t008Z3pkHOIvFcM84cMmGCk43EEWJ7W0ZCmC3EoW3EnKofMYH1uCpDqSpCm4JCm4ZDuGJDtOPP8WJDqSJCqOZDnWpCsOZCq4Zt1XX-0RWm0R00uu08F00D"
-"E8M4cXH1KW38nG38quFMKu4MK0aCkCJEpOJDu03Dm0JEnCJEr813AOvf1G0Dru0nIGoCuOJCnO3CoS3EIwq00OZ3Xl08oW3EtC3DqCZDXXhp-QW-h3Xnh312t0YCEGC4"
-"krq0EiY21Ql-CDWGCD0Ij4ZBrCJEmKpCvSpDqOpDn4JEt4CdMQQ0q8JEt4pCq4JEmSJEtW3C1VcYCe0Er43EvKpCu03Co0JCq4ZDMN35ECn6YSN614W9TcH218HRPu-W"
-"W8pWW0mDXr40sONJ30mDXr40suVJ3uKJ30KBtuICvO3Eta3CnGpCt83EoOHtLO9g1WZDsaJEmOZDtK3EnKJDu8Zb4X0BqSZCsGpDsaZDtCpCEOQ7Mpf1+dC46dC4EaR5"
-"6E42I4Z2QqW2+lU2kiU2OGZBnGJEvSZ32q15o43DpKJEgY35yCpCuGJErG3CpKZCu8JCpKZarJ02r8ZDIa35K8JCsC3EquDYWu-fGOyfG0GC9QlSIo10nuGUb8XuLu-X"
-"NupXNG0Dk42deWpCm83Cu4ZCoSpCbSgbED0BrCJEv4ZCo8pCu4JDEup3IUQ04CJE1+E7mWZDoGZDqaZ3I4XpSQW-f2Xnf2X3pq00pum-NOcG80WCIWJ30GZ-SQWHSQ0G"
-"ouYDs0ZDo03CoOZCv03DnOZgRQ07qG3EoKpDu0Z3dn12vCJCQc97u4JCvOJCtWJCvS3Es0pDoOzy4uFgGeCgG01DWW38qe7J300DEmL3EWCA+tq02rq0EG42883Et4Ig"
-"O8JCtaJCuOZgaTX3vn11oCZ3PN14q0JEsOZbgd0DrC3Dm8ZDs8ZCtSZCo4J0reiJ30WC+dA46dA404JOdumRKucJ3uGZB00E+RQ0APQ0WGZBtCJEt8JDmuGQg00EE8j5"
-"cgU21J6AmW3EoCZCva3DmWZbqJ07qGJDr43Dr0Z3ed02nGpCMR8408Z-62Xn62X6tqWSRQ00uuGwVumMDO1KIu-G8uoG8m0Ck0JCECu7S4ZCvaJCnaJDEGZAcGE9oeh4"
-"k41BK83EpWpDruGPgm0EuGZCEiFAEsu2mC3DnWZDnW3Dq0ZDoWZsNQ00ouVWGOSWG0mCEas2wPU20CZ3cmW3oCY-Z6WGZ603vuYCouWkHGoDn03Eo8pCqC3EXfabe8X3"
-"lY16rGpDoWJCo4sW0aZb+W0CpOJCsKpCvWpCraZCvu0mQuCy4uVWGOSWGuVc6eVc6m3Ck03EpKZCvW3CtOZCt83CE8j5Agq0qKJCnaJEsa3EqG3EnWJCEyU4Agq0u03E"
-"n4ZDqG3DvGJDpCJDp85meK7lsug3Img3Ia1A08Z-z1Xnz1X3BFXUxW00oulE8OcE80qDkKZDpCJCqWZDs8pDqKJEr8XE8OfI3WpCp4pDn83CmSJDo8JDuCZbKQW3+11A"
-"uCJCoKZDuOZDqKZrBF10ouFQXOCQXuWjjuG688Nb64G90SZ3+1X-pJWJpJ09uG3CpWJDvW3EpumaOGWCv4uyQ6J3K83DtKJEuu0nBuGHiOPg1GZCpC3DvKJEmKJEvKpC"
-"suGohuyy4u-VGOyVG0mDEeOBsTQ00WZ4nqW-fjYIfjY39kW3SD19p03DqCpCo8ZDrugf1WmDr0Z47z14s4ZCvGZ3CYXYsJ05q8JErOZCEiyBKCZDsWZCn8jCD0WC+x74"
-"Ax74EqK5wvb9I07D04Z302X4+1Hjz6H04mpNEeD9I8E6+3t061t00DZBqSZDs0ZCmO3EvWJDu4ZCIqp5McK8XL6AqGJDnCJDn4ZDrSZbkB25rKZDq0ZCESa4GSZDsCJD"
-"M-+408Z-X2XnX2X3JkY3HdYQJrW3uxY3b2X-vxWGvxW4W433uOZCvuWAeWGEn0Z3R9ZYWX00quW2XG2Dt43CmG3DuO3CMEl30OJ0rW0Eu4Z3HO32q8JCMFK808Z-S2Xo"
-"S2HoHQ7k6WmDWCJOevle18be10HCnCZCru0GmGHCoG3EmaZdvV2AqCJCna3Cm4pCuWZ3cWWYCK0DpOpDpW3Eu43DsWpDt8ZsAM10puVbGOSbGG0EW4oVoH6DEm7CIe05"
-"bgW-jxWBjx03uuoDuuW4au0Uk0XDrapCqeQYL4cGaCZDuSpCu4pDqGZ3pjWYc601qOZ3Ty00tuWaSWWDvOZ3fxYoOXW-2iZo2i30vunDmeMw4u00A8nYauVI3OKI304D"
-"kCZDpaJErapDsS3Ds03Eo8HgBu90AumtyGYDnS3Cp43CvS3DIEl3W8pDmK3EtSJCouG6suDy4ul0xei0x8otne6g1K2pE882+3r021r04GZBEyy9GSZCu0JEECa64OpD"
-"kUQ0m0pDoKZCr43DpOZCpCZcCF35oG3Dv03EEq69E4H60GZr2BY-6iZp6iZ3pz10rOt9hGGCo8Xxiu-9SOr9SmIDsO3Er4JCp0ZCo4Z3cYX3Fr00q8Pd6G2DoWpCn0JD"
-"nC3DECTC1ZcYtJ05rK3DuOJEE4GBX150meDg1u-dGOydGuWF80GDEqoAgzq0EqpDEifBMWw2+xf1kuf1GCZBt43D1J67vGJEs8JCv4Z4ILZcsJ03r4JEpuW28GXCm4JD"
-"pWZb2c2Eq43CpOJDp4pCoaJCrGJEMRu20CZ-V2XoV2X5WfZSSSZ5WfZ-emXIemX3oS15oKpCmGZCEeb8E0JAEOuGYSsGoaR3k8p5iO3EsS3Cm8ZCqWpDsuGtG89c64sH"
-"aW3Ev0ZCmaJCvWZsFL30puFcGOCcGuW+ReNCN8npOu-x48rx40mCEmW6EWZ6SS3DnWJDoKZCI8x9M+E14CpDECT9SG3CoSpDoa3CQ6dBE097EWV71D11maZ3SGXpcdW-"
-"O2XqO2X4FUYSDO20neX-O4Tco4k014W5Q210n4ytHGY-MKWBMK00uuGsdmIDoCJCsO3EuS3Ds8ZgzQ0Ds0ZDm4JDo0JDpWpCp0Zcyx02qOJCIa08EOCE4SpCEOVGExS0"
-"+p946p94EK69wn0500JeHu00eulMDuZMDuWHSu02Am0CqaZDEO-HEW22AIH10KJ0mWoCrSZDtapCsS3Ct8955GICu4JEu8pCvW3CEmy5QR050CZ-S2XnS2X3NxW38eWQ"
-"SXW3emJeKuFe184e10KBsuoCraJDmSpDvK3DoCZCsuQcu0GCEm1IEyO3G0ZDrO3EEOFDEEW248pCEiTC8S3EtuWuLumrQeiH300D+3A463A4MWPCoD5IEuV2+tgHIrgH"
-"04Z32K4Bu43CvW3Ds43EvOJCIeU7M6W2GG3DsCZCEWnAKKJCv43CqOvzOWZDnSZDrGJEnaZDoGpCoWZrek00quFDXOCDXumUGumF49tm2bG9Ei7I+lw22jw2O4ZBm4JC"
-"t4Z3cx30ouGDX0mCkgw24GpDEiNAKWJDt4pDtuvqsW0Dp0Z3cl37vCJDvWJDrOZr9n10qulEXOiEX8n1cumeieMz40mDE4V7+VQ0ITQ0Eiw2G43Cp03EE0WB0OZ3YqWb"
-"hk00n81d41IDmC3DvGZCs8ZbNQ05r03CmWZDEGcI4K3EE8r8Itf60GZ-s4Yns421v0Y6HSXQZ6W439H8ZwVc68Kc60KDkGZDu83CnWZCpKpCoK3EnewGIu0CkGWCu4sX"
-"0CZ3EnXcpJ01t4Z3+356t83DnCZDpej+010D+l946l940GZ3hkW3WmXQd600quWXBulc68bc6WIBvuICsaZDqO3CtumBGWmDrCZ4Ym10q8vGI0mCEud68WJEuu0NVWGE"
-"vGZbwx00ruW6hWWDqWZ37H41qKZsrb20quFdGeCdG81-RONG80GCEmW7+-q0Izq0EOGD48ZCX556ma3EtG3CneQuO02DtWJDoCZDn8Z3TL10vumDBfuv90WDEe0C843C"
-"uu0MuWWDr0ZssJW-X2XpX2X4eFXSedW3fI20nu-ZBOrZB0oDkKJDtC3EnWJmjmmCm0pDbzabgdGmVXnDvO3Cv0JCEuOCM+q0qG3Dn03CuK3Cu83CrGJC1KZpFkW-Z2Xn"
-"Z2X5IqWSd6W53EZ-y8bJy857tuoDm83DmCJOM01EmK3Dp8HuYePz4m0EtW3CEC12G0JDuK3DEG25Awq0CK3DsKZ3Wk36uG3CqK3DnOjhs00D+l746l748G38v81LVe6d"
-"60GDE4wE1KY-x1XFx1X3Lt10numvF9nLum0Ev83CgIF1G4ZDs03CE4bJGS3Em4JEEypHAQQ0Em0LWWpCs0JCvKJCruj1410D+78467848O38m4IX0SZRd601v0Y3GTb3"
-"IeW-e6WGe6W3a814mC3CsCZ4ZY11nSJuKh89IG0DmuGN21ICm0JCo83Dr4ZblJ05r8pDq8pCX6MWl7CpA-E10KZ-+1Xn+1X4ufLOdecI30GEEiXE+RU2MPU248ZBEGv9"
-"0aZ3ud35nCJDsWpCImM5MUf1uOZCmOJCvGpDrW3DnKZCoO91r00D1+E0uumDK0mCXccr1210ruVWGOSWGOnz8v06yO6NpenN21GD+NJ36LJ30PZBu0JEv0JDnSJCpa3D"
-"pG3EgUQ0uKJDsSpDraZCtK3DpO3DmuPASWGDrOZ3Hob3iu41pOZrlv20ru-VGOyVG8nR0f7TL00EXSi-cdWLcd02nu2CEyh8OKJEt0ZDqCZ39BY3uzXbFD01rOZ3PZ52"
-"tWJCE06G8OZDs8v6NG1DpKpCm8Z3Ap23rO3DoumVcuyz4uFXGOCXGumgJu0Sk87w94G9E0mA+hU2AfU2q8ZBnKJDm83EvWZCmWpDEuOCccQ0mG3EoOZCsK3Et4JDoGZ4"
-"7ZaY3X03sS3Dvum+B0XCqCJDnuzDD0GD+R846R84E4I8w1mA0aZ36mX-sJWJsJW3mz50n4+rO4JEqO3DsWZ3pwZY0X07r03DuCpDvWZ3OE30n8HAfe8e1WICuWpCoG3E"
-"vW3DuumJXPTYB0GD+x746x7400Z3Sga39mXQOQG0a8Xa0v-5N8q5Numu9mmDuC3EE0EOO0pCpGZCu8ZaX818oCZDvK3DuapDEuIA0CZcD0Z3B241nKZ4qK32v03DEOf6"
-"EpE1+h746h7408Z3-cWWEZ40nuW+Ivlw4eaw40HDkS3DnumSsWmCt8Z3dA50ruQUGm0CqW3EEiNFG43CqO3DQYy4m8pDtO3Dsa3EuOpCm8Z4zFXpd6W-v1Xpv1X4s6ZS"
-"IQW4kkW-xWWLxW01ouY3yL40suGjlG0CuuWgWvwFz0XCpWZDmu0kKn0Cn43EQswP8GZDv8nusWGCrCZ4xAcq-Y10ru-UGOyUG4yQ0aZ33dWQoJW4JXZ3pkW-LxWHLx08"
-"ouYDq8pDvCJCEGF3CW3DnGZge6W3-226nGJCv8JEnumDXefsEGJCsapDtSZCtGJCp4pDtOj2S0GD+t746t740KZ3qUI99gMg1GGCn8X5Yv6lPv0eVuWW8uVl6uKl6GGC"
-"muWUfGWDm8n0YHWCoOPwJ0WCEubIWGJDmKZDpGpCmuv9TXGCuCZ3JM12q8JEEG25MRS00OZ-W2XnW2X30kWUGrW3ktX323X-X6WGX608tu2DmSJDv4pCEaNACOJCuOZ4"
-"bk00r8fO8W1DmOJEsCJDEWAO8SZCruGMLeO1AGHDpOZCnKZ3r160muWM2PT9T1WD+t946t94443C62+O84ZCWum49vlO8eaO8mGBru2CEGjK40ZCECB884JDoOHCHPPJ"
-"3WGDr0Z3Gp56oCpDtaZCvuGQGe8g1G0DpuGpzW0DmaZ38fW4lGaoZX00suldGOidGuW0Sud45409EmGDfvaJybY4cgHjpulUfOZUf0WC5J60tu0WPnWCsKZDg+F68KJD"
-"ouWMWXGEuOZ4upYb35Y3p216pSJDvSpDruGmpODX80WD+-B4A-B40CJRDvss6409EOR5fei-e6WBe604su2CoSZ3nE44qGpCoaJWcxWlGOP650IDqKJDqS3DuKZ38210"
-"sumTUvOS30mDEKF4SO3Cq4ZCtW3EEimDE7t0+xB46xB40GZ3xrGOme6g100DEma2EyhB+pY22nY2EOR5GOJDnGZCE0cQ80JCtO1Zbff3K0ICrSJEvK3Eo0Z3PmXceg17"
-"pGZCqKpDt4Z3w621s8Z3msWpd6W-53Xn53HPhumLDesf1K09+-q0Izq0C4ZBt8Z35O52vWJEEyG8QSPMQUQ080JCpumXkHHEp8pCrSZcCeW3JI42oOpCEmRAECyCMFK8"
-"0OZ-93Xn93X3DRdUc601s0Y3nGX-M0ZJM037nuoCm4ZDv8Z3nS63rOZDvOXoxuPP8GoCvSJCu8pDmC3CEqaBMkr5G8ZCsWZDE09JCSJDtSZ3mYZpDDW-83Xn8310o8nm"
-"YuGiFvcJ38HWp1GEECxCISV7EX6208Z3KAH6ZuVm6uIm6m0DkW3CE45LEW62CKpDu0Z5nEZbpDW3g265maJDm8JCEiNAQ2j60KZ3gsW3YU65p4pCuSpCQhz2+tE46tE4"
-"fDdSlEJ0ZaB6EbS0ICKQ+Nv0ILv008Z4kIb4tr35vaJEo4JDgY97OSJCqKpDu8Z3ag32tKZCQIW5OGZDvSZDmKZ3QG60ruWHB9TjI0WD+tG46tG404Z3Qdb3bXWRKEW3"
-"z-c3LiHQJwFS3u2S3mGCkGZCEeo8Wa3DqSpDrKZCn8XIFe9S3m0Ct03DISMKG4ZCrCpCMY97EKiLXWA1pKZ3Vics6k50tu-xGOyxGuWIP0WCEiGGgXQ01G20n4Q6YfJ1"
-"04Z3BPH6Zulo1uYo1u056vmKAGIDr03DsW3DqG3EI+G4uS3EuGZDv0pDs4JDsOJCse9hXuGpW1GDE8e240JDESITIts00SZ-F4XoF4HA3BdBy814RaTtETJ1EuKLP8Y-"
-"57WB5704pu2EuaZ3Hd21pKZ4ezdhut33q8JEsuWpZHnCmSpDmWZ3pyWY0t00r8X5Cm1CmKZCn03EtejJo0mD+7J467J40aZ33YW3SHXQFE00vu0mD4yt+3S321S3GGZB"
-"pa3DEec4S4JEuKpCqG3EIyG4QQJ1Ey1F0OZ3as53oC3CqumVheuf10nDm8pCvu0u800EESvIECaAAFd20SZ-F4XnF4X-pfW-pfWYpfGeuG0DsuWsl10CEeG94GJEMYJ1"
-"4KZCEqJEEGY808Z3T4cbR362pWJCECd5EeJCCW3DvOZrc540tulBHOiBH8Xk-vdECKG9vUXJvKGPscn8+hJ1zgZ3I823u03DtuWN4oWDuOpCQwl10KZ3zU35papDp03E"
-"EODHMEm984ZDuu0FAH0CmuGxbvjKg0mD+tK4AtK41ZhUl1Y4H-d3RdX-qKWGqK0DtuIEq83DuOJDrGpCuGZ35-Z3RIXcqK04u83ErWJmZwms-10EMss00OZ3B920su0H"
-"xmGDn8pCQ7tI0SZ-D5XnD5X3jlW3PqaQQRW3spX3F5X-b6WGb6W39F50nu08GvWNGvmmU0GEg213EyATSG3EraJCr43EEeYUMsK4EKGHGOpDvSpDIaiAMZR30SZ-D5Xn"
-"D5X3CCK8cAd5Y4G90WZ-VNZLVN30sum8PmICtGJCqSJEpCpDo4Zgk122r83DE0HJ0WZ3lAe3Lwaaf607oaJEmKpDm0Z3kTY3RcXrqlW-f4Xnf4X3OwaU9Hc3eYIeSu-J"
-"3OqJ3WWCkaZ3LW81raZ3dx53qGpDregf10nCmGJCquWJg00EEOgMEef4AcY24K3C1yY3Mi63q8ZDmuGnPuSAAu-1Hey1H42WESFJgPF15GI1e81OFulF8eYF8WIBtu2D"
-"rW3CmS3EvuWOwmmCuOZD1t90q8fGF02Dn83EnCJEm4Z36U30quG96v8g1WWCrOZ3kmY3y671tKZs-w40uu-1Huy1HWGCt0Y3YNZQe600p409EWlE+3r061r0Ia3D4GpD"
-"EOU5O03DqOJEnOZaZ609rW3CuCJEr43DtuGmtuP-7vmy-GGEsu0+iX0CuaZs0X00uuVvGeSvGuWEbuWNVfse1GGCou0Xbu0UKKsIEnw2+xs0cvs04aZBEaZCG83CqKJD"
-"EeWUQKvIMgW2GKZCqOJDESAR0GZ3K9e3-GXYjD07oOJDua3DuWZ31+b3mVXqxQ00uuVvGOSvGG0CWuWGQvmPrPsMq409EiUIcbS0IKxIPCY-tKGltumEFumh9vGkcmmC"
-"qK3DEKw8AUuB0GZ3p333rK3Cn4Su04Z3STYY47W3JB19oKZDv03Eq4ZDtumtDeSs600E+BG46BG4I8O90GZU57W3GBZ3aY00sqon+JQ0zGA0tuGuNum5F0HDmGJDuuWa"
-"B5isQss0KG3CvG3EsKME4aJCEye7AcQ00CZ3rx80nuGpBuWY84+3EdQ0+JE46JE4Ean3IKYDgrs0ImXXEShMfvc-d6GFd6isC8pCrWZ3gv41oOZ3pB60n8fs64YRE0IM"
-"OaJCoWpCq4ZbTL23r8pCu4AVE0oQ88JEsOTNb00E+7C4A7C4EI4I9KY3jSY-b6WGb605nuICqKZCEiIEOSpCvKZDtKZ4E9bbCDW3GM22rS3EE8-KEW5PMsn3EGCU08Z3"
-"GKd3mc80suWIFvCJ3u-mGOymGuGNG1GC1KWQCD00muG3AvWCRu-f18qf1GGBqu03720EEOf9OGZCnK3ErWJXqRfpBGHDoW3Cs4Z33-e3ehZ3CHZZqJ02uSpCEKvIEm8K"
-"483EE0g4EZQ0+NC4ANC4E4WD0KZTO0N983GDYiY2+JF1TIl4DlW3o810qu0ZQnGCrGpDIEF18GJEm817W00EEm1b4SJCMIx8Ea0548JDEmyDES5BQpIC0WZ-+2Xr+2X3"
-"bDdQ9DW3X3X3wyGQ89roB00CEK1B+FS0EDS0GqoCka3DE4HH00Z3Te70puG0cvmN8evQ3GGDtu0aDHHCtGZDpOZeTI32p43EEGK6K4pCtKJDtuGhPuyQ3uVuGOSuG8He"
-"AwG4neco1u0Vb8neUulEFeaEF0HCkCZCtu0uMonCvGJCo8JEr8HsLePg1mWDrW3DEWWIGC3ErWpCQ+8ZGGpCqCJDEi4N8CZDm40SINN30aZ-Y3XnY310u8ntG8t8WumP"
-"8vGFFuFuGO4uG0aCk0JCoKJDn0ZDpOpDnS3CuewDbGZDmKZDtCJEmaJCuSpCnu0ZDeek601DrCpDruWGNn0Dv0JEIeqVA-q00aZ-b3Xob3X37ZY3yqaRFDW3+yW3xnb-"
-"e6WGe607ou2DuK3Dp4Z39HZ3pJf5lGXb9eW3s3e3y5A1u0Z3MW60rOfiBu0gBX0Cn0Z3+o92pCpDXThpd6W-23Xn2311u0Y3-ZXUDDGm1xldVfadV1ICkWZCpS3Eu0Z3"
-"Ib63nKZDougnx1mCEW1Q8W3Ev4IUYkj9SSJCt43EuSJCEy4Q4SJDMlaA0aZ-Z2XnZ2X3An10nu0iLe6J38X8suGLDuFJ384J3uW+E0ICsOJDsOJDvKZ34C40qO9I3WmC"
-"m4Z3Cb61nCZ3RUZetX70ouW8LYXCuOJDsSZDUZq80aZ-T2XnT2X64GeSbZb4Dea36+Y-Z6WGZ601uuY30Sb32Fe3Fg11vSZ57IgcyW02p03CEO6G40JEEaTGEawGAQf1"
-"EuwI8CJEsumVTIWCsuTl61GE+7A4A7A408Z3WdY3iLXQBDG0b4cR+toQAroQ8CZBquGxg1oDuapCmWZDsSZhEl24rCZCu0Z3CJ24u43CpCZclnX31WA9q03CmOpCmCpD"
-"uuW8KuCc6uVeGOSeG0GDXWgUEkW4RWf-GDWKGD0GjCZBs8ZCoSZCv83DvWJDtCZ50XWcHD00qumYLG0Enu0uGGmDpePIIW0DnWZ3i041nGZ3Ts90mu0-QvCg1uVeGeSe"
-"GumEN8uvPwWQIu0r1fc0F8nLTwHJ0vFnGe2nGGGBmum8S1mCEKbYC8JEmOZ3biZa5313nG3DmumtJvWsaGWCsef69YHDo8ZDqKJCECj488pCruG-Quin1uVnGuSnGu0r"
-"a0GEkLH1EON3ES0Q+ph12nh1Iy520GZ4GFA0mu0BZG0EuO9ufGnDtGpDt8Z38l42pCZDU+pg8GpDn8H1AGmCsuGiw1GEMdr50aZ-T2XnT2X3fqG8+fcj6uWzOumWouVe"
-"18Ke10XCk4JEtuGXkwG3ho0DrC3DI8a4MIW20KZ3Y117pC3Eo4ZDtWZdz233pCJCru0j8HXDm8ZDtOZspo31n0Z-Q2XpQ2XWnPY3PPc3MyY-c6WGc6W36q91vOZ34980"
-"nuGHhYGDtaZ4AJYcpQ03tOpDouWL+0HEuSpCvu9Po00DEC0OSO3ErOJDrKJEYVQ0+l94Al94QWZFsf1A0GZ58Ne-hFXIhF15suIDnG3DEiXhEilL8OpCveAHIGJDo4JD"
-"sS3DmGZCt0JCtuGKfvehB0XDqS3EuuW9Um0Eqa3DQN2X443C+x946x94IyS70CZ3ggXQvJW4O1B0n4G9+Nr02Lr0E0K8ECVNS0ZDmOpDqK3DEmQSE2K8aaJEq83CqapC"
-"uGZ3xPcbEqI8OpGEr0JEE0bi4OpCXejoyW01n0Z-U2XnU2X4LMbWTQW4ZaZ-DDWIDD01puY3ypd4HP40nu01m20DoM9P8GZCoumANv0ZM20CECh8Asq00OZ3Mz41t0Z3"
-"gg11p4ZuCP90mu-eGOyeGuGYau0SbgsI300CXPa3XZX-ADWGAD02vu2CEKRN8SpDqumWJGWCvOnD+efd6GmCqum2jH0CpuG7D0WCE8b6AUQ0EqMM0SZ3F171mCZ3sDfr"
-"JP21n0Z-Z2XoZ210mOX5tOdd600CX5b-xSZKxS35jKZBnSpDE4qZEqzFC83Ev8Z49gXbmd04sSZCt4Z3xB90rumpfu058eug1uWY3HICpW3CrK3Em4pCEKDZIhF1+NA4"
-"6NA408J8ggd+40WCXag-OkWKOkW365Y3mE55qa3Ev0pC1FZ4KqYbf601p4Z4tVf3m113n0ZCrOfUzHGDnumVIGmCnuWNTI0Doumsh8Tg1ulfGeifGuGvOudShuGDjump"
-"GeMfGu0PDan8+RA4gOA4G8ZBs8JEEW5FEujB84ZCsOnlBPvo100DE0RL443CEG2F8KJDqePH9w0OWwmUZG0Epu0a+uGWA9zo1u-gGOygGumyYfdo14m8vOgKm5Y4TM30"
-"qqow+ZS0zWi3WuX36d24uWJEraZ4vFZgjyW3F835ta3DnG3EEGwXE0jBAsJ10GJesmmDsWJDEyEg0KZ3wyYq97W-J3XnJ3X4ara4mWYQHYW4TkY3viePLE00pumkhan8"
-"+tS0zqC5mu2Csa3DEm7IKO3DuSJCtePcImHDoG3CtGpDvumQsIGEpu0CKfun10WCIulUE4VA0CZ3WEhrvn30nuGwc2GBk8l0sy4a+ZTlEXTl00JOB5wEgPS0Ied2EGSD"
-"+Vb22Tb2E4Q3SG3CqWJEpapCESOAE4E6A6Q3EO5FE0WS4W3DEO45EqX2EEQ080JEmumdj4UT4aJCEi-XEhs0+ppfAppfQCiRs5b2EG6L+-Z7IzZ70CZ3hUb3Nc92pWZC"
-"EelGMiWLUkj1EGo608Z3MX62rCZCXqjYe6W3yLf4T0Y3jg70vejC31GCEKTC+lq02lq0E4l6oTQ0bvc-7zWJ7z02j4ZBE0Wca8ZDmKJCpSZDtOZhQk61pGZ3PU32n0JE"
-"EWjH0OZdOla3GYB8vKJCsCpDoO3EEO7LI-q0+3F463F4+-q0s-q0EagP483EI88Z0GZ3fS10o8hFKumz9GmDoumP1wmTiQfXrH0Dqu0JF0WCImgPEiWaIZ2A04Z-+Sgo"
-"+Sg3yld38-XQQQW32sa-sJWKsJ01jWZ3fW41pOZ3tjB0v81MmeQdDu0SHwmbIG0EquwZNmWDo03DEOvL08Z3CvX3tHbqGDW-n3Xnn3X32ZgUWra3-sW34zW56eW-ZdWA"
-"Zd01jOJmU20DECDK0GZ3I-80mOnxZQ9cIWnCtOZDqGJCEywAEWpVMgvI4K3DEWEE8a3Esu0Je10DQpfK04Z-+Sgo+Sg57yKuNO6xu42gI85I+dQ06bQ04KZBISZHE0zK"
-"EuU208Z5I6Yb7X04pCJCuOZ3be02qCZDEKXA0mZZ7X00ruGkcWmDt4Z39h31t4Z3eGgqGDW-j3Xoj3X3VJYUv-b4JUb-xCYKxC24nu2Er0Z39RA0nu07SXGEtWZhLd20"
-"vuWTGH0CnuWsp0WDUMf40OZ3m060pu0f-v0fmuWLj8Dg1uloGuioGuWNrum6ZecK381j99X9gv-K3OqK3m1Ck0JEvSJEvumf-mGCpC3DEitSAsJ384JDpuW9AuWSe0WC"
-"XGdbED00m4IrC8JCtOZ3JAbukdW-d2Xnd2X48+30tuGpEfcf1uGFD0GCEqcZ+NQ0ELQ00CZ3tL11pGZ3hnB2tW3CEqWEAMQ040JDEmkDG4pCn0ZCECLR0KZbb6W31dB8"
-"tWpDr8pDmW3DEiWAElq0+xpfAxpfEOoDISW7gHQ01G21p0Y7YPYJMGH0U401+NS0ELS0XlE1qGZ3GL33o4JDouWepeOn1GWDvuGh8Z1Et8pCtK3DIOBEA+l38GZDtuGw"
-"fGGEruWXU1GCXBYq57W-N6YqN6Y3pkfSC230nuW4WvGY-uFf184f1W0Ck0Z3+b20n46PCKZCmGZ3ygXYZ607r4ZDta3Es4Z3S6c3fAgaeD00nu0Pzw04T11CuG3Emum1"
-"DBze1uFaXOCaXum4yuWAeesP3uGV8uVe18Le1GWCkum7qAHbSu06BHmCs81uaOP0AOHS330EISNi8OZDqeP0AGHDp83Cs0J8T7w4Mp2A04Z-STgpSTg3tue3G8ZQd6W4"
-"XxY3O9Z-9DWG9D05jKZBv83DECyX8CpCo8H0j9ntaOvKD00DEeqT8GpCv8XmvAna8hey4WGDoSJ0tu0L7Z0Cv8Z3M3gqFDW-I6YpI6Y3vWWSZub3ChX-d6WKd602nuYD"
-"E0XPEaySKOJDuW3EmeAgB0GDE0TOEG0T0GZ3h1Xc0p83papCou0DAGXDvCZCvWZ3kEfqc6W-W2XnW210sumYm0GCw9A4EiNDMO57f5bJWX00suWFFuVp18Lp10HBouYC"
-"nu0LL10EEitF0KZ30wY3ctZbTK01rOZ3R440qu0BsYGCrCZc81C5qSJDt0pCIenr88JDouWEC8jp1uFjXOCjXumOdwmSwe6754m8EKs5cfS00aZ3kfW3fKY4Tka-GAXA"
-"GA10num1eumkav0zTnmDrK3CbWicyK0Ap0pDrCJDuWZDtOZ36KaaBY05rKpCrS3CECrdISNbMVwf04Z-eUgpeUA0p81gO9dBPK09EuMB+ZQ02XQ0CqoDk8Z30kY3lO40"
-"suWja0GDg+J104Z3y-b3Ve64rGJDp4ZdX37BnapCmO3Do4ZCtaJEYBej+VufAVufXXY4a+XQoDW3AAX4NRc-XuXGXu12uuIEEWSkEC+h4SZCESbs08JePuPK300EEOQR"
-"C4pCt0Z3YOgcWN10ruWzNWGCnCJeYGGEvOzBN1GC+-ufM-ufECs5s5r0EWM8b4j-vJWHvJW4rH69maJDuCpDrOpCo8HTeO9g1uGNUG1DnK3EpKZ45XYb4s0AqS3CraJD"
-"sWpDs8Z30BdsUlW-LUgoLUg3dOKWKBtJ3uG8SvVRjeKRjGGDkuGSE2GCEywX0KZ3zL31nGZfED01r8Z3eYC0suGgcGmCsKOmAkz2SC3En03Cta3CEGem4S3EE4D2EV62"
-"+NvfANvfUGXVkTQ0IqC4+xq0Ivq0CaZBqKZ3fpD1oCZ3Ra70me18zQfJ3uWgJ20DEKkU44pCE4xNMsBCCOJCp0Z3ahA5rG3DmWZCEGA5IZQ0+BD46BD40SZ3VkYUja10"
-"tu0tL4ye+RF12PF1Iewa8W3Dt8nXKx0wYK6KMw0TE4ZSa03Cv4ZCq8pDv0Zc4d80ru0ORZWDp8Z37k61oGJ0r8Dg1uVTXOSTXueUxwG5lum+GuHTnw4XD8Xdx62y+FX2"
-"2DX2E0g44CpCEWx780pDsummPNimQEO3Em-SEmFcIGo3Qg1QOGJCv43CtKZ3HxD0ruWFKQDcXulkdgikdwm5+fdm6umkXul658b65GGBuuWi+YHEsSJCqGJCXSZhHe00"
-"ruGMDu0G61nCsGJDvu08Peum601DqSJCsu01Y01EpOZCru0Qq9zS3uF+GOC+GWGCs0Y3ToX3FdXPo-H1b0WC1KY-HDWGHDW3Wo10num3S1XCpaJDrumXVOvenwGKc81r"
-"N3HEnOpCrefVt8HW+G0CvuGRPWGCuGZ3miXqc6W-G3XnG3X3gdWUdjK0Z46Sf8gJMKW3KVH6YuFqGe2qGW0DkCZ3EX27m43Csa3CsGZjGyB2p4pDE0G90KZ3e-30vePj"
-"NmnCvGJDu8JEuu04HYWDsKZKLKWWjOE6tuYDvWJEou0wo0WDECCWECw3IKTvg8bvjSa8jOE1qmZyjOkBv800yuWyz2mSH8c-jOk-jOkBjOk3cHb4DFaQIGGfxw-DMPrD"
-"M9XxjumB900DEq+Y4apCEaRBAIw6E0gFEWw644JEI8eYMom7E8ZL8CJCnumfjwGaKfT6J008+J4B+I4BIiTg0GZ3fPXQZ6G1buFgbO5gb0XDk4pCquGdHxWvcumKK81S"
-"HOf19GmCtuWcdZWCmWZ37g80tevLOWGDvSZ3Xd31t4Z3OqC0p4ItAdR1+Z73EZ73bIdSyd10t4onE4l7fch-NMGlNIWDkumHl10DEeaIGGJDn8ZDoI4B4GZCE8EIGaZC"
-"v0JDECiPIUc508Z30321n4Z5Rv20ou0NVeif1ulTCOiTCeXnF00Eorq0E4rccycD+RQ0oOQ0KC3Dv4ZCnuW1q2GEEu7GIijFMQy3883DsuGRO30CEKHd4KpDQQy30KZ3"
-"czD2rCpDEuiA44JD1ecoc6W-7rXn7rH8zPeIsG08qeY9sqklP4W4-bk3TMa7XGY-87GF83HCkG3CouG6V3WC16A2sGZCIO+3MIH1GKJDvGpCEOiSkoD5SCJDoWZDrS3E"
-"Eaw98CpCsODwIvVSCeSSCuWd01WDXiiRyQGeHu0FuaQ5EbS0EOQMEW-B0SJ3au-o1qpo4CZBESDQ403CEmZ50WZ3FHl4OPdbJE02paJDEWAgEWeQ8K3Eqef9OIGDtu0-"
-"ywmE910EE0WjI1j2rGWDkVZ9zWiBTfG01O3A0ul5uua5uuW1audo1409sbS00OZ5sJb-87WI8700n42o483DEuRhEOXy0CZ5EIkc87W3Tm02vOJEEOpK48JCEe1RAQ04"
-"4KJDE0sA4WJCEGTC883CrOz5QuFJkOCJkKCtEu2jg9v0EqsM1CY-UKXGUKX3Uoe3d690vumMMm0CvC3EMGWoMcJ1KCpDn43CvumlgHHEs0ZCvSZadYW3Wb80uuWBJv0a"
-"L3GEEGT3A7m1+haB6haBIy9BE0QCgPQ00SZ3iAa4WXZ-xkXFxkX3Ns0CnaJDpSZCs0pDrK3Ev4usAUP34S3DEejd4K3CEKBG4SJDEW8QAYq0EaDJ48JEEOkSE4IlEmbO"
-"ABQ0+RaB6RaBXqf4-UhQY6GqqsijrQT41W0FVvZ5NPN4YuFs6qDsI0MSE0DxC0ZDrGZ36qi5t6Zcz+61sGZ3e7Z3XaA2tOZCEKLKAcS08CJEmuGknumllvmDVQTs6O9y"
-"+WZSlz6TWusRaL68jqYFA0I71m1FcLMOqLdSbPZ50m18WmZSbD6TpvZ50m48WmpN+438v0ICr0YCWqICkmpBV9590mWDWa381C20pKW84mpBIv40em3Tfn6TbHcFmmpB"
-"De01yyYKF20ayG7QoLsSez6RavJBpuYDmSJEqKJEu8pCsO3Em0pCbr2CmC3Fla190eG7WJ68ymMPcHtNs56R+0ZBpC3En03Eu0pDu0ZCoKGDLqXDq003obsPe5HD4LZC"
-"sS3Em4ZCuGpDv03Cpa3FlaX71yV04KXF0mZCF40By4IBj02ToLMPW4JCweN0sa2000I2hu-f18pf10WD1K72u0IEsTQ0K43DWW38puFg1O4g1GaCk0ZDvSJDm43Co8pC"
-"sWZDt0Zfd60GrKJCv8JEn4ZDoGJEmW3DrmZZd60EpSJCqC3Eua3CsaJDrSJCQVQ008Z-d6Wmd606t02DWC38uucf101EWG38n4of+tq02rq00HZBsGZDpW3DmG3Cu8JD"
-"mOJEbOA0q8PJ3mJDs03Eo43DtCJDvW3Du0ZCIQQ0yGJCnCJDsO3EtK3DrSpDsGZrDD00pulf18if1mHCq0YDW838susf1GICq0IEW838p0YC+ZQ0+WQ04TZBrGJEmGJD"
-"oK3Eo0JCsK3Et4MJMUQ0uCJDraZCmOJCoWJCo03DoOvf1mJDp8JEpKZDnapCrGZCqWJCMVQ00GZ-d6Wmd606r0oDWO38qucf14m88C38oqIfrcR41W0FVvJeqaX8+ph1"
-"kmh14bZBuCZCo8pCuSpDp43CtKZCvOAo1mJDq43DtaJDuSJDrGJEp4ZDI+s0mCpDsCZCmKJCn43CoOZulD00ruFo18Co1mHCW438nW38n8Nl60nDW438s409+ZH16XH1"
-"41ZBm4JEvG3CsG3CtSpDpGJEr8v45GWDpu098GoCm4pCo8JEpS3CIIQ0yGpDmKZCvaJCpa3Co83EoSZriD00suFf1eCf14A40KZRiD00qKw30KJRivlI3qdIyCZBtO3E"
-"mC3CmW3Epa3DuWZi5e09v4pCqWJEuS3En4iW0CZab60ErKZDpSJCs8JEoC3En83EQNQ00SZ-b6Wnb602o0ICXEXSjkG0b00EXja-f6WHf60CjaZBqKZCuK3CrKpDu4oG"
-"08Zglk0EoKJDqWJEoWJEtO3CrWJEMEF1uKZCnKJCnOpDpaZCtC3Ctezk600E+hQ02hQ0EcQ008JeLGWDWuFg1e4g1WWCkaZ3Gd0Aqa3Ct0JDqa3Cn4JmQ2mCIQF1qKJC"
-"tGZDtaJCs0JCnWJC1KZYMr0Dp0ZDpaZCm43Dm8ZDsGZtlk00vu-f18yf1GGCtuWBDeN2AWmDWKZ42XW-PQWGPQ0HvuICmS3EtCpDtK3CsGJEqKZCgUQ0mC3EuG3Du8pC"
-"uCpDoWZcd60FoW3EraZDp0ZCoS3CuWJEp8Td6GWCmu-f18yf100E1UF2p0oCkvf10WJOEXmCW4Z-d6WHd60Hnu2Eo4JEo8JErCZCq0JDtC3DcUQ0uGpCpO3CqC3Cm0ZC"
-"o4ZCre9iBW3Er8JCvO3En8ZDoapDm0Zrd6W-a2Xna213n038numQBO7MDW0CW4Z3zrW-PrWIPrW3ed0BqO3EuSpCvKJDp0JEEuT4AYa4yKZCuSpCs4pDq43CsKJEtaZa"
-"3X0EoWpDm03CraZDr8pCoW3DM7A408Z-X2XpX210n48yojq00SZ389HmPwly48ay48nYBG3DpWpDva3CpG3EmGJCn8Pb6WpDm4JEqG3EuSZDpW3Cv8ZcBk0DsGpDpS3C"
-"uS3DuWJCtGZrU210ouldGeidGuVb68Vb6KoeiWJEuOZDqa3En4ZCs4M4AQq0u8JEuOJDr8JCnaZCrK3Csuvt903Dt0JCnS3EmSpCuWpCM-T208Z-Q2XnQ210u4cHEqX4"
-"gLp50WJO61WC+7f1M5f1y4JDoSZDpaJDu03Ev0JDpOZhHQ0CoC3DtC3Et0pDrGZCqePa6umeGGYDnSZCr03Dq8JDQVQ0+d746d744a381okTkq00n4iYXmi-dFXFdFHm"
-"Eo2CvCpCsS3Co4JDp0Z3dvWY8D06r83EsWZDquGtJm0Eo43CQ+o5u4pCmCJCv4JCuGJEvSJDsOjC8ulTGOiTG00CIOT2o13200Z-+jWN+jGXfZ0DvCZ3Pv05oCJDnKJE"
-"MEO5y8ZDrW3Dna3CnC3CoCpCtSZalW02r03EEqd4O4JCvWZCt8Zs8x00oulSGOiSGm0EWK38Eqo5oXE1EKF608Z-jWWIjW0HouIEvS3CrCJEs4pDpKZCnW3E1Ykbc60E"
-"rGZDpKZCsW3DqapDuCpCMYX4uCpDq0pDoG3CoSJCrO3EpeTUBulRGOiRG0GDjHYQc602r0YDIuH3+xC62vC6OGZBnOpDtOJuv3nCoC3CnuQnEG3Dt0pCqaZDvaZCrW3E"
-"mePlJGpDqCJDt8JCtKJDm8pDtuzI3uFRGeCRG00CEm02szC604Z4hSX34nX-EQWFEQ03jOZBpumA80WC5YB3uWZDmeA5IWWCmOJ8ZYHEuSJEmCJDEyp5AIX4KKZCu0JD"
-"pumuQGnCp83Cv8ZqKQ00puVRGOSRGGHCW838r0YSiY11n0IQovlf18af104DkK3CoaZDma3DsGJCmWJEqewQGmJDnWZCsG3EuapDnSJCm8JCIYf1iC3DuCJDqC3CvSJE"
-"tumqEOTf1u-QGeyQGOHs98tnEmGCp0oD+7u2M5u24rIEk83Cq0pCsKJDs43Eq8JEnKicM6M5EiE64SpD1AC4uO3DvaZcCxGeT1YDm0JDp0ZDoGZ3P3XotA20pu-RGOyR"
-"G00CEW44ECH8gjf1E8D6ECl3+lf12jf1m0ZBmWJCp8pDoKJErGZ3qY10v8PRGWJDmK3Epa3EuGZCu4JCrWZb2k0Ao8JDp0JDnaJEs8Z3Du10vOTI3uVRGOSRG0WCEW59"
-"443EsDh808Z3YO20nuGkYuFf184f10IBmuICr0pDv8Z33013q0ZDouGtHeu9DWZCvOpCq83Dv8JCmCJDtOZc6k01oOZ3SZ16tWJErGpCnuWZLuiH3u-RGOyRGuGl9edR"
-"GuG2XuVRG8LRGmmCkCJCEio9WapCpCZCr8JEm8XhYOvw4G0DsumtWmHDuWZCmC3DpePLampDmSZCvCZCn83DnCpDuS3EMhq0+t646t6404JWix09Vesw40GCEKs7XSQQ"
-"8v4iYGGCmqij9CY-dzXAdz15tuoDq0ZCEqFAXSC2nKJDIq52M+K3CGpDu0Z3F422qCpCEKl5MIo5EiX988pCtum1AWWDsKZ3bBYplDW-M2XnM210s8XTa8tDI4m8sXS0"
-"0WZ-77WN7705su2EnaJEE449O4JEtG3DqaZ4smXc7707oWZDvaZDn8Z3lZ10vuWdYuOoBGpDo8JCrOpDsC3CtOpDueToBuFlGOClGuVSDOVSD0KDkCZDt4JDt03DvGpD"
-"t43CmKcRMYJ1CKZCvaZ3k3IuOWGDq4Zb2Y0Dp4JCqOZCnapCt8pDqaZ3o3XpkDW-z2Xnz2X3vN22o0oDkTJ10WZ31PIOGvl5FuZ5F0GEEeb6iWZDsOJDsK3DnWZCq81q"
-"YOv7cWmCsSZ3kj27uOpDpS3EoCZbb607r8ZDvGZDnWZ3Hh10puzYf0mC+tB46tB41ZD1nKZ3IZXQURW3oi20n8HY8uFg1u3g1uW9A0YCrC3DmWJEpWZ3bp21nSZaBlW3"
-"ON1AqaZCmGpDp0JEuSZeLg19rSJEn0pDtOJCpuTbQ00D+dB46dB41Bd3-zXQY601v0IQkvVkG8KkGWHBruYCr4ZD1vD6vSJDtCpCteAbQGnDn4JDvCZ37v24pGpCp8Zb"
-"iM16qOJEpSZDtuG+O0mDEa5CIVY20GZ-w2Xnw2X38lW4BrWQd6W4LgX3+vIQ9vq9AO1fIuH+iul9AeY9AGKBtu2EpGZCn0JEv43Era3DpOZ461ZbvQ0BqGZDoOJDn0JC"
-"qCZCEqyC0mZaWX0Dq0JEmWJDtK3CrSJEuCZre+10quFtGOCtG4MJEe37kbS0Eqy2E455fai-d6WBd60FnuICp43CmOJEu8JCtS3Dvuwf1WGDvGZ3vA11tGZ3c-10uumB"
+static sybie::datain::DataItem item3("haarcascade_frontalface_alt_new.xml",3,
+"m8ZDEeuFUVM1EOIP4W3DEC-KEWKC8WpCmKmhXE00nu0nN1GEEy448K3Do8ngkuln08Zn0uG9NWWDtCZ3K213va3Dnumzf9Un0m0Dk4JDEuyCEKdJCK3DnOJBBwG+eWHD"
+"oSJEu0pC1kB0sKai+NC0oKC0EKo504Z3XM65m43ErC3EEOWPX0asu311mWZ3vSY4Ej12t4ZCYij704Z33KY3df02t0JDE0fJ+Rn0+On00aZ3Ik00mumjpGmDmumZkXmC"
+"qKJHrAj53GmCkuGwHvmnAuWPQXGErGJ8L74K08Z3S+68s43DsOZCnS3Cfsd-MCGVMuWnDX0EkOZ39ab39n62u83EEKRHUxH3GOZBoKpDEatAEuWCGaJCpCpCXKNWvAnq"
+"KmHEvapDpOpDuOHgBuln0uYn08nRFmWDpaJCEGOB0KZ3jt00mKcaIBl188ZBmuG7CnGEvCJDEmj7Mu3Qbm81q8Z3Ux64rWJEo4Z322L0Txln0uYn0u0tU00CEeDDG0JE"
+"naJEE4MMI8EAIVn0EKMLK83DoSZCquGTSGmDte1OM0mCIWn6483CECVNCapDoGZ4UZW-53WC53W46t40r4oAKWJEvapCv81NYuTK20IDkW3CpaZCt4Z3-9c4XGM8q5KK"
+"44JCEKRR04Z3QF41oaZ5v6b-B6WBB600qu0cG0GEE0vF88ZCr4SC0KZ4ugXqB608qu2Dm4ZCt4JE1eC0tumE2LGnKKZBuGZDmum-L00CICzG+JII+GII44ZCEKo5CaZD"
+"rOZ39oX38+50uOnhG8Te4u0MPHWCpumSBHGEs81fj91y94yGCW3DraJf2Z0CoGZ-l4dFl4d3GPHmGIWCvuGfXW0EpGZ3FoX4ccWqA605puoDq43EXp30o4yU0CZ5R0HO"
+"immCqKZDE8WA0WZ301a-LCWHLC00tuWG9GmDv8H1WWGEpKZ3eia4zIYq63W34AX3AD45uW3Dq8ZCECoAD151pKZ33P53maJDm8nOJumIOuV538J53G4EWSZBoWJDsC3D"
+"vWpDmKZDoKZvxK31ruY3uTc3HnZ3Spc34hI15JWCku0LiuWL51mCEaYJ00Z5KpY-QFWBQF00vuWazu07kn1Dua3DmKJCruWNYuD+G424I0MEGK3CvS3CXbG16xWpYG0C"
+"quWbYXXDo8pCnG3D+lO0+iO0EKSJE0aE48JCEWH6Ee5EEyFRURC04OZBECNNCC3DtOZ57v20o81B944Q0SZ3r847mGJEqaJDsaZ5QbW-C6GFCwGnDvWCO10DEedMEWUI"
+"ESiQ1XWqYI01quY3nSMupInDvSJCqaZ4DcGOT3oCoCZDoOJEvKZ3Rv51saJ8jxln08Zn0uWIkWGCqGJ8320CEG2U8OJDm4q1Ip72EWqO4O3DEOvJKO3Dp8ZDq8Hix4Gn"
+"8O3Emu03KG0Cs4+p0GZ49Bb-53WC5300pKee4CJDEy6B04Z4xmMIsgje4uGDYuGCGuWFKvmKAqs5EORUC4ZCmKZ3ec61n4Z-hVXGhV11pGZ3Ji60nuWcQ1GEEW3284JC"
+"o8HJAfDK2uGZaW0Cm0Z46b02s03E9KC0t8HkVum1z0WDEqwP0KZ4uvX-B6WCB6Gut2mCIisB00Z39FX3Toa38jWqA6W3Yl70rumMMmGDva3DEG-P5ge3VK23r8JCpumH"
+"h0mDEKqF00J0XvVn08Jn08XRF00EECSJ0aZ30Q31qaZ3wEZt7e07nuoDr8ZCnaZ3hNZ33kW67lX4L052oKJDECIICWpCu4Z5SIa-XIWBXI00tu0vDuGmWu0v9vmvQHmD"
+"u8HTK8TK2mnDk8pDn8pCsuGIsOnlXLc5aGZBuaZDo03CuaZ327Z3BCJ0Nuln0uYn000EI8w74aZCIK9484ZDmu0Kb5wuIBb0KGZBm0pCvumZaGWCou01R8o2b8Hd9uWH"
+"h00CEOUL+Ro52Po50CJvvwGhg1WD1K61nCJWO5qjIpO0IGE4IOg3ECw7EaJ2XKN8C20CEaQH8WJDouWEsH0Eo4EL+pO0kmO0SG3CWWZBq8JCE4jHCOpCmWZ36zLmHATn"
+"0W0DkSZ3vA20su0hM0GCXJQHwW18tuYDoCZDECR5XL12sKZC5ch-H9GNHH0DnuW+hGXDrK3EtOZ31y30nuGpWuDt3uWnennCoOJCv0JEquWoo92DGuGv611DpWJEpumq"
+"z0WCbFb-53WC53W3kzW3xO70r81Fn10EEiwM1LWsLC01oGZ37PX3Pwd3uiY4nsMutYmCvaZ3bP33vOZDu81ti4aP+hO0keO0Ius30SZ3bZY3By41vCJ1zvzY1uGiAH0D"
+"ruWjFm0EpaZCEK4E1yg38Z11oGZ3Od31vOZ32p20rKg0+RC0oOC0I8WDE0nI08Z4sl01q4Z3+lWtEh02ru2EEWnG44pDEm9O803CpO1MFW08quY3Pkd3hmZ3qlGee5Gt"
+"+pO0kmO0Iqj70GZ3AH40nu0wI00CXkMW09T2A0WCE4hDXBg3zoY3b5M1lY18ruICuaJCgSsT14c-63WC6302s0IBESiBSSZDpC3CtGJCEi8P0aJOO8je40mDECFF0OZ3"
+"Kp32qGZDEOGL1UI8C2mDES6T0aZ334e31LX-ctWGct00q8XtUGWCr4C9KapDmWJDvuEWZWWCkSZ3JrX4bz72qapCUy87E0uEEWL20SZ44bW3wYX-I9WFI900uu0hEumZ"
+"BG0Cmumb1vGZo8Hm98DZ1GmCkuWdTGWDmu0he1mDEeVSL953qGpDo4suGWpCvS3EMqV3+Zn0kWn0IGWDEKZF4KpCEa53COZCnGZ4-XWq63W3vI50tuWUqWWDp8Z3wsa5"
+"i6X3iw02sSpCEWtB0CZ3spX5l2c-63WB6300ru0Nqv0iY0WCEinEESdPMea3Itz0Eey6WGJDtCJCo43CtuWlNboYEWpIEim3EKYSGW3CpK3EEe12+NC0oKC004Z3vH34"
+"t43DsCZ4vx42n0pDgRC0G8ZBva3EEO0SESbV84pCvamhXT15vCJDrKJEEWPGEGUL+Vn0+Sn00KJuwIHDm43DrOZ387OObx+dm00CEWJXEq6PEucU0KZ64bW3Uj71rSZ3"
+"yC40ou0Ho00D+Jm62Hm6ISIJ4CpDECNHEWT6CaJDvWZ4c3YqLCW3UAc3Sa62vKJDEmsEM084M0J88SJDmuGxN0HCqWpDqu-s38qs3GGDq44KC0pDo4J852mDIGcT0WZw"
+"ct01sSZ3QT23vCJCtumzQe1uUuWvDu0sL1HCmGZDouGfYvmdQul538Z530GDEOU30CZ3Eb41mWZ3WT22p4ZCcNv2O8ZBsaZCtKZ3J651uKZ3UwGvYw0PMW0DoOZ3l2Z3"
+"OD81sCJHowln08Zn00WD5t20vuGEGuWy810EISn9UNK2eSZBnWpCuO3Dn4ZDEikH00JjdvGZmHXCua3CvOZ3TNa4jLY-63WC6307t02Ek8pCrOZ3jPZ3oW00qO1UH8z5"
+"3u01R0mCEit20CZ3fY81p8Z6P-22ouoCEWwF08Z36323nW3EsOHw0vly6qjy0KJwu20CEqOJEKhJ0CZ3mzcu4b01ruY3xe17rKJEq03EnWZ3oOd3dXW3Mf10pu0ya10C"
+"ESPN8WpCuulq0vZq01HCra38quW2TOHnxvW4FacaQlO00GZ31W61nWZ3jk50puXk0vmFQG1DuWpCs4Z3Eo80quWWL50t+lO0zi80s4+j8K3Duu0og1mCEKf9E4039Gcn"
+"0L30qumTI10EXNB1p8Z34ENAp5+jK0ZDnKJEuu0cZmmCuGJEEmL408Z-53WB53W36E40muWSUHHDvSZDoOZ4QIbtwA26quoDmaJCtu0VyGHEtaZDtGJ0k68e4GZCEmvI"
+"EaGW0KZ3WEIBcuFmUv1mU1HCs838pu0cCoWDvaJCEOkF483DMmJVQ3t300Z3rC11saZ3cD41saZ6IjZ3C113m0JEvu0hF2WCXT10r8nRCulY1uYY10mCbMc32A32m0JC"
+"Em030KZw1p22suICEWhX0aZ3glY3jRKZWY0DkaZ3YS31q4Z3-fb3bvY-LCWGLC00quW3FumrdWGCmKZ3CC51t8Z4MaXqCh00ruW20HWDuuWmhvmxD1mCfwa3tO41sOZ3"
+"M253rW3Dv4udbVW-B6WBB6W3dS10o4EQOGJEt8ZDp8Z3Kjavw3X3fg00nuGoZu0QP0mCMCaGEir9C43EnSZ3Qx10pu02Wam5+NC0kKC0bNB2o0JCIuDAEWoVEaf7U3A1"
+"EODVC8ZDnGZ3BD80nuWHC424Eqo20aZ3Lu10vuW0M0mDEOlC1oZ-63WC63W4kz05mKpCpSJEEWgC04Z3OROWN9Dt3umiO8XpEwmXjWWCpCJvw4yA4S3CEiNWEug3CSJD"
+"paZ5IYW-C6WBC600uuW+Gm0Ct0pCEa66COJDn0Z3c0YtC601ruY3KE51pCZ3BI80tumFl9nY946t0SZ4mGb3Cs22pC3E5SX-63WC63W3iJc3BD30nuWe7ImDo4sVYlO0"
+"4GZBI0nDEilQEav2QWIDX8A4tSJEvSZ3M413mGpCpuFUP84UP0mDE81V4W3EEOES0WJeF3WCEinJc7l1KCZDpKpCuOH7v0WDMesG1KC2rC3DE4yH8CJCruWKJ8XVDulY"
+"1uYY1GmDn44KCaZCqCZ3YM31pCZ32T60mek1Aumk8umS1IWDt8X7c424XP13u8JDou04zuW+D4Us95h-tUGztomDo02EECQJX350ruGeVWWDqOJ0xvzs3GGCnumcdG0C"
+"ruWSW0GCIWD71Ki3hiW3Lk04rOpCpWZ-w+cGw+61nSJvtwmpyHGDrumlNwGGB9HxN8DpAGmCkuWKXX1CnW3Er8ZCXHS8G4KK88ZDmu0G-91nM00CM0aE+7b0o4b0E4NH"
+"0aZ3f2e4Fwe3STY4VdZq53W3YD63s4ZDtummHmGCpa3CMK62EmZ64WZCEy+VCW3CvGZ31TX3E-W-53WC53GutAHnF2GD5GMuN5QPQp7248ZDEab5SWZCuOpCs4ZDIag5"
+"E8MCESSH08Z3zV11vCZ3v5OxIvV53aN5IKo5ECI30CZ3p4OeaJGCoqGP6V53GOZBtCpDE8uIOCpCs03DqCJoQxG9KGGEru0WZ0nDvKpDqumyRv-s3ups3uWbSvGnAWWC"
+"r0Z5cW81sOZ3hfWqG901ruY37v71pKJ0530EEyJI5bZ3GB22uOJEESDQCK3DsCZ3Mte-53WF53W3TJ53vSJDquWtc1WCEOq440ZDESF2I3A1eGZBr8ZDmOJCn4pDECPS"
+"0SZ4RzIOQ31EvKZDpu0WZulX89bX81GCESIJ04Z3wd51qGZ3DNY3zI90sKkjIlO04OZBEi5LCWZCoSJP7GGDp4STXie39B90numhFwmyc0WCMGA7+7K2g4K20WZ4Im73"
+"u4ZCouWxt00EE8NHMuyEIpO00KZ3UP11o4Z3GC90n48bI8v41OC1r0JnpxGCtWGEuOZ-KJXGKJX3eq42ouoCEeFKEO0PE42L0SZ4zoWqC6W3Ot91rKZ4IT93q43CpOXR"
+"N4aKEWHM8G3Eo8XQR5QS+Vn0wSn00WZ3Im71t8Z3Qg32vG3CI4yKoVM100Z3rlY3BZ01v0Z3SLK0kwGKQuG9SGGCuuWNQ1WDEW7O1SX-H9WBH900puGkYuGd-v03P0WC"
+"E0b90WZ4zXWqB600puGfdumGn00CE8y64W3DvVh5G184nKpCuWZ3CCZ-63WF63W4Ux10quGfXW0EvKZ3nP32q4JEXwXs6302pW3CEu6O0aZ3MI60vOXVG4KK84ZCqume"
+"C2GCECqc40pC+Jw72Hw7MaIJ4S3DE08QE4XAICMFXiYsvU01u8Z3J+51t0Z4mC10vOnP8uW7DuGy4w0KE1HDp8ZDouVt3OKt381SFGGDouG7CX0CnWZ4t211vaZtbS10"
+"suWA7w0aEumXB1GEEyGe1jJuvIGCt81RgvWoxGmCtuVjp8Kjp00EbdB0vu0IQ1GEEKUM0KZ3lUbt53W3eF42sCJDEasYEmyQ0OZ5C+X3pTY3vg31q0Z3L271sWZ-0EYH"
+"0E20uOXbc0XCrOpDnu0Tbu0NqPkq0vWsy10EE0p4ECnG0CZ3noI9Bw0+v0GCE4eNO43CrSJCoWZ-01bF0152nWJEEmsESKJCuO3DpOpDEmRDEOeOUVe4E415CKJDnWZ3"
+"qJ24n0JEm0J26xGR5wmo0wWCyuWitu-J9vpJ91GCImIJ80ZDquGwS6ee0KJ0ChESF81JMHGEu4230OZ65z83WKZBr8nki1GCESt3EWfFIOJ3+xY1Tx20v4KjEO0GE475"
+"EmHE04JIrATe4m3DkWJDrOJDp03DtKZDnO3DI0AE1KC0qumsqu0Px10DEW9N5xeO53Wpco60seffi1mDEe54E42e0WZ3eu23nSJCvulfiPffiXGCv8Z3U2g3Kn61oOZ4"
+"Hg12na3EE8f6Uxi1EG5DXdX3uKc6qyW3yd00qu0QGumSOwmDduls69as61GEEaJNOOJCt0JCs0Z3F920se1xBeTn0uWCy10DEO3300Z4uIe4DdGGnJmDtuWoN2GCEa9g"
+"0SZ5DBbOi8WnNY50numoDHGDkuG7W2mDEu45GG3CoGZDIemDQ3t28K3DouGRYwWwavm5JAnRE018puYCvu0HRvmCOX0EqGZ546d-63WC63W3H013rGZCuumuWIGCpuWv"
+"4AnCVezY1GWDnumz5IGCmuWRSWGDqKJg15Y9ESx804Z31Kc38nM1NuFV4u2V481M800CEGbIEa7fEWrB0OZ4PjXs6301rCZ3kZe32+81oOZ8bX43ruIDtuWtNuWU6XmC"
+"u8Z-uwXHuw11vSZ32M55sa3EnK3EEG5200Z3Xggt7O00pu0w-umMZuWx2HWDpOYHx0WDEmT204Jf3XmCoSZ5b7Y-B6WBB6W3At40qu0ZxvWUDXGEqOZ6ZXaq5q46quYD"
+"sS3DuuWhXw0nU10CQCE9Iy-e0OZ3bbA3oG3DquG-YuWR8uVn0uIn00GEEqAGEiw38GJEmu0SEYWDtSZ4pMasG9W34990uumZ82GCE8V7IOU416g3pk80r8nawuWlD8XV"
+"9uln0qXn883CmuGLquGxs1mDE48fCGpCu8Z5v680qOTaEvmq69nooH0DouWdPKMnEGA8EKkb8aJCn8HtD0mCUWu4+t+4Uq+408Z43v91uWZ3tcZ3HFY3b9X4ueZs5304"
+"oOpDsOZ3uA74uS3Du4Z5sXX3Bz01rSJ0Hu0nwXGEpOJ9ix-Y18pY18HsJ2WCECuAE8m50aZ31cWvH0X3nWZ3Dn30uOXKI0mCQG334GZBECXE8GJEvuWgzGWCsu-oQAqo"
+"QYWCmCJ8gu05dwW+YuWDLOXnF8j53WGDkKZ3AgY3G720t8niDb+j8CZBuumLW4QW8O3EtumVwvFt3O3t30WCEiSJG4ZBmK3EEauNE4MB0SZ3+9dtpm04puYDoWZ3Su63"
+"oC3EnuWsk4QiXnD1p8Z3A-91v0Z36XA0penWjvle4afe483CXVB1qaZ3Aq62m43DEu-K4C3CEC33I-LME8DFXga3H492s0pCgG5DGOpCp8pCEW1KEST508J9YwVn0uIn"
+"0uGN+GWCru04Zv0bRwW5c2WCEqI5Q3b0EWzQE0QMC8pCq4Z3sHMGvuGG90WDEqOX4a3EEeP40GZ-3wWG3w00ouWoDv0DduWuS0mCEesM4W3EMChaIRC08OZBs8nrWw0h"
+"D0GDEG3J5zl3leX3D030muWGCv0PWOHLnu-Y1uoY1uWoD1GCE886ESl80aZ3Ule4XQXsG9W35Ac3X153qWpDvuWJvLoYImCVGapCn4ZDXjX7g1h-53WB5300vuGiKG1E"
+"nK3Co8Z3V6X3ah70n40VQlO00GJeDHGDuuGm6H0Coe1Pz5oYE8oA0WZ331Y3oAY-DhWFDh01o4Z3qS24n43CrWZ3WO20ruGWo8HhF8Tn0GGDkuGUW20CE8G8E4zQQO4T"
+"XUC0oumJqG0EuuWtNGmCsOHEQv-Y1qpYEiSJ0KZ4fs11sWZ3mP81r4Z3vmgvcLW3G+20qu0-uvGLNOnPDKgP4KZCE8+X8G3Dt8HJW8na8uln0uYn08HNqvG94HnCpa3C"
+"sWZ3tMh4OxZsC6W3oe25mCJCr83DEWP400JfG5iy5dk3zo60uumqIKyG+RC0kOC00CZ4bC12qKpCE0Jf0aZ3EV11nKJ8CAzG9WmCkKZ3G610suWHoumoNenBT4KQ0CZ4"
+"E-W3tq11v8Z58XZ-63WB63W3hHe3nS23r43CouWh3w0TNvjTLu0heIGCvuWqNvWlv0GDMerAE4d9EyZA4CpDE4J3803DuOnQXuVn08Jn0WGDWGZ3e2Y3jL60sumq1H0D"
+"qKa1INo4EWZaE0IT483EEatN4S3CIu88EG48X021maZ3vqb3I7Y4jZX-GiYAGi20oumoDXnCk0pDu4pDI8Ud8KJEsaSaIRn0EiUC84ZDs488GOJEu8pD9bJ1T3WCI0nL"
+"GKpDpapDQ805+3b0k0b00SZ3t1Z4cpe3Qn60tu0x88XsL8jn00WDEecj1o82mKpDEmsFMGF8EWC5Xp40v4M5E4hAf-i-63WB63W30+X31jX3y+a4DQa5qYdq53W3Sj80"
+"tuG3a5O90WZ3qOPvuomCkWZCXti3By00sumrjL8k+NC0kKC0EigiE87cEKp9G0pCuKJEM8HGI3A1EqBL803Cqumw-G0Dpum2aMS5Eq72E8CG0GZ3V+50puGJiL0t+NC0"
+"TKi3Bta4zRB0ru0zw0HCrCpCpa8GIlO008JWAwGEFwGwFY0DtOZ5dBa3kl22taJCEqbLEWm54OJCIKk4+RC0oOC0IiSJE0Tl84pDmuG055qkX8aqYI09ouIEt4ZDqK3E"
+"vu0oo00DQ8yaXnD2oW3DEOp50WZ3ZNZ6G9a-C6WBC6W4lz00nKIE0aZ50p40m81SU8jK2u0zu0GCEKcVEG-jXMRHxu0NZuWMmYXCm43CtGZDXxROkuln0uYn08H56XGE"
+"pGZ39dX3iBb30MJOy9jn0um1DvGVvI0CquWUpuWbs4mhXHl31U81v0Z3WH52vK3CIGTG+RC0oOC0XZB3qWpCquWJ52GCECiQ0SJnIAjMCum7+2GC1mB0uu0zNGmDseH5"
+"6vGHT00DEmHa0OZ3QN31m4Z5leX-B6WBB600rumCWwGHsX0ErKZ3f-01t8Z4JYZqSFW3lz00v44F08Z4-Q20tenPS0WDECPQ80pDruWJq81eiwFK284K28Hyav0JxH0E"
+"nuWe9GmDnumB9vDbBGWCk4q+0KZ4nCg3dr20p45KEeQ58a3DmumaBvmqU4Ki+lO0oiO0Eaza4O3CImWSEOqH0OZ3WSdt8eW3ut81uaZ3d+B5r83EtGpDM4oZ80YCkuGr"
+"t1mDXn21taZ-cSXIcS11o8Z3cS14tCJCqOZ37Z61nKZ3NTf31ZYqcL02quYDEyuU4C3EE82908Z3bTNPQx0se00EImfl0GZ3Kz80o8HHEulY18ZY10HEW8ZBoumPoG0D"
+"muWTNX0CmKZv53G8A2GEIq7X4a3EIK9G5vV0XHGCouWqEI0Dmum8A00E+xs32vs3MiSJ84JEsu0f01mDEKOTEGPOUNn00OZ3etb42510nuG+H1GEMmd8EaDA8C3En4AP"
+"8O3Enu06kMGt+3A1T2g3Bt40vumH72WCMqSJCCZDuKZy0u51pKZ3UPA1t0Z3S010pKhP883Dt4yyEqn6EagDI8s4+RC0kOC0EqkB40JEE8xB8a3Epu0Fw0GDIKD5IRM1"
+"Ee3U0aZ3Bt40ru0iq5wkbPX3OiX4dM42tOpDEqx8M0KI+NC0kKC0IWAR08Z3s5e4nj20nu0eg60VIpz00SZ3xj40muGxk0GCEC4J08Z4TjIGHvWZBuGGCvmbzW0DqSJf"
+"zvln0uYn000DEmZ6ECm8ECKVKSZDn4pCp8nNH8DZ10WCEWPHEShI443DECG40GZ6TxX35A51u0Z3SD11vGZ3fZM9jxln08Zn08X5yvG3MGWCp4MtE0SPcVN68KZBtu00"
+"hvWnz20DEay6MSH8EGU38GZCp4o8EObW4aZC+h532f530CZ3dS11vOZ3Yeb30s92o0ZDM0sGI7b04KZBESU8Eia2KS3CpKZCnOHpDuWa12WCE006O0ZCuCZDvaZ-ghbG"
+"gh50ou0pDHWCkuWZUGWDouW880XCt4pDq4OGI7b0EGMBEqZQ04Z3BAc3ubI0ALoYCa3EqKZ3Zh31pGZ3JOIuKvVK28JK201EWGZBquG-L00DEufD4WpDE8U6UtY1EeLG"
+"EaRG443EE0TZ0CZ7XA65ouYCo0pCEi+cGOpCmW3EMmGG+NC0oKC0IiSJ0SZ31B95q03DrGpDEOhaXeYsB600s4yq4WpDEetk04Z3nzGfeH0Dku0Ot0WDXE80s4IBIu46"
+"+RC0kOC00GZ3Mm72m4ZDEq1HO43DmS3Dp8Z4q+YsMCW3e7b3nd02p4pD1Nk53bW4nY51mGZ4JqO1BN0t+VM1zU60qum-LumtFuGYJIWDouGWYA17800DEBw7OGZBt83C"
+"q4Z3gvi3oO70p8YO810EEyiHG83CoOZCIa3KbnY-53WB53W3jx20suGxIoGDmCpDEWFX0KZ4ZyWqF9W3qIi3MH14v43Du0Z3kXh40nGuE3WCXD20uuWG5xG3W0GD1Pc-"
+"53WB53W4bS10tu0jn81ov1GDEWxkESQ2IRC048ZBE0sOGOZDmO3DEati0aZ4OiG16ZnCn8JEr8ZCEWcC8GJDru-Y18qY181givWwf5IG0CZ3PV20v8H+G8jn0WmDkCZ3"
+"c610tuWBammCr8JDMq295X63oWJCs4muE0MMMGl7+pO0kmO00KZ3iX60s4apE8QI483CEy-CUdG94KZBECAI0SZ3zrh4PsJY9wmXNu0532mCEuje4SJDU84P+NC0kKC0"
+"XRh3LSC2sOJEEy9B88ZDt8nC5hzs30nCvW3EsumOcfHcM6q-00Y37D50numa92GEEW4E08Z-n5aGn541oGZ3jz00qumwPumOExGdC3WCIO08I-a0E0Vi44ZDECPA00Z3"
+"eo90p8XGHuGTPWGCpOZ45EZ3Vz80rOHxSulY18ZY1G0EW81wQvmQAuW0MI0CsuGf2xjj70WDEeJN4KJDEGZi483DEKeP1fPGGnGDnO3DEOhOI8NR0GJvHvln08Zn08Ht"
+"UuGpFvGRbGmCmuG7MOUG90WCXPX3nq56pSpCmCJEo81zf4KK88JEq8nCJH0Dvu0md0WCbZW-MCGVMuWaR6Q7ECsOG0pDrOZCUSvkIVn08CZBtuW-Q00EEW87ESeO04Jv"
+"W6SBEekjESFe4O3EEO6B+RC02PC0X0VGkwWsh1WCE8lM0OJPN8Tn0WGDkGZ3j840vuW6GWGDp4Z9EFTGewGnUvW1jXGEs8JPpx-Y1uoY1OXWH7I84S3CEOi5CCJEp4Zu"
+"Dh05ouICpaJEESXH0aZ3lW90n82bcGGEvuWgjY1CuGZDrKpDfSY-63WC63W3eo66t8pDo0ZCmuGEhuGKU6kLIlO0ImZ6K83Et0pCoumkS1mDI8MD11b3oPa3ZhW3Bm30"
+"uqkp+lO0kiO0Emck80JEqumfXuGChWmDuOZxfVX4SZY3KO21mKZ3h2e3EBH05ZGDt8Z3eD80uuWJQWWDuCJe2uVn08Jn0u0tUuWF0HGCuuGTyHGCn4S+gdP5EmBV48pD"
+"E4iH843Cse1qyGnCk8JCoWZ3Gmd3ug40uu-Aa9qAa1WCESSJ0GJeBxWhQ01DpS3CvuW0cgEB60GDE0pU00Z3eoW3h1IOV58F0KZ3gEA0ouWKF9XPL7o9+lO0oiO0I8XH"
+"C8ZCv4Z3u261v0Z3MYZvu312ou2CEyUkEidEEuCFQunA00Y3-120oumIRv0RFXWCoKZ5i4c-MCWBMCW3jz02uK3DEWG7CaZCoWZ3DKK8BAzs3uG5yXmDs0Z4-382m0pC"
+"Q0KX5B42vK3CE0fRC03CuOZ-vyiFvyC2n8JDEmj740JDI4iL84JEtuWhaPk3K00DImsf0CZ3Mmd31D90t8HeC4YYGapCu83DES3JC4JDoKZ6GXd-A6GFA2WDI4lcE0iL"
+"CCZCm4Z3AZa3eBbvIkW3zCA0muGChen4CBHpA00DImZoG03Dn8ZDEyJVQmz6+RC0kOC0ESk4CGJEpSZ3MO11tKZ3ibZ4o0XsDh02sapCEucc4WJDEWoH4GZCMSW20KZ3"
+"ewB0vumZ2XHDr4JDnCZD+l72+i72E0lc04Z3Ali3O2i3gXA2tO3Cclz0GOZBtaJCEGUf1gE3uOJEp4pYCO3EnOZ3Yf02pKpCEKhT+p72+m72EaSJEqXE0CZ3XvW36YY3"
+"I5NmeADZ10mCEiYc8SpCvum7Y10DX3Q26x0WI91gOG0EvuGfj00CIS3C+7b0o4b0ESAR04Z3Q9A2tSpDEetREOcTgRn0EimlKC3CoSZDnu04taGnCCZBsCZ3X6b3kfc5"
+"KkGOjul53uY53uWIkmHDmO3Cq83CpuWq56K49GcnCLKmKuGq93GEESNQ843Dt8XwV4sT48JCEyrU00Z3J760nu0tiaGO+NYCYKYC0OZ3pAh4fYA1qaZ3g1D1sOZ5aXXq"
+"F904qu2Dn0J089nibGGDpOXHMum-NGmDsumHGW0EoCZ3RXZ5ZNY-A6WBA603t0IEkuGoev0s8HGEpOXNfuzU80GDEOlRKWJDr4JCnuW44vHtGv07G3WDE8IQEON60SZ3"
+"11f-A6WFA6W39v21r0Z3-Z71vSZ33Te3cWetKC01quY3yx30tu0uY1XDoW3CuKRPEOvn0SZ33822rCJEEW3K+NC0+KC0Ims3ECBlEKhWKWpCoOpDoKERQ3b0EicrEOvj"
+"0SZ34ia5uDLGG1GD1ja3WXa30OC0v8nMUvFK2u2K20mDEuJsEWiAE0PE4KJDICj2XeYq0b01quIOI0WD1Rd34KY5R0S05x0AGu0Ya10CEOtt4W3E+3b0+0b00SZ3liW3"
+"-f00mu0ixH0Du8HdkfkLCu0PWGmCouG9Xm0Dm8pCM0v2KCZBnKZDpu0AU0mCEiBe0aZ-AUZGAU30t8HVLvmaJx0bJwm1r2GEcdkCEmUs0CZ3Al61t4Z3-Ud7luc3GB70"
+"uuGykXGDt4Z3TIa-7vYG7vY36ta3eSd3hJ83v8pCquGf-P+U+u04a1GEEStKCSJCvSZ3FIIHv4uj0WJ8f0WCImv74WJEMaz60mZ-gOGsg0mDEis3CSpDnOZ3zPe3Rq60"
+"tO1kg9js3GHDkC3DnSZ35+A5s4ZDpa3DQ0U34CZBX0E0u4iH4OpCEyvD+NW2+KW2Eukc48ZBEydUEuu2EmIQE0ZJURM10KZ3cjZ3qea35t42uGZDIKM3XTd3K5i3HY01"
+"n0Z4w8MWyu-Y18pY10WDE4D3IOlFGSpCuGZDEqdFY3U3E80vEGuHEOkCES+aY4D58OZCuuWBxwWUDu0VV7CZ+NC0oKC0M0uYESgrEWJn0SZ3z3d4rlWscL02oW3EEmu2"
+"ISdU4OpDMCh21X60vumTJ30CEOQq0aZ3Yke-nRWEnRW3lh90ruWNgwmpd0GEEKGH0KZ5iiaqEr15su2EvaJDEaOK0OJGyenKZw00OW0CpSZ3YU61nSZ3CIC0ouFZ184Z"
+"1K+jEyqHEC5l48JCEunb00JGI9jn0GWCkumdFwmHUY0CrCZ3+FH9rvmuA0GEEWBc48ZCE0qFE8jd+pO0wmO00WZ3bAA3q8pDpu0G7xmTExG30P+1A0GCEyom0GZ3MdJe"
+"QPnZfu0Ih0GEESLCEyTBC8pDsWZ5ZhW-dLGld10EEuWH8aJDruWzaYGCu0Z3foa4cBXqdL00quGWmGGCvu00+G0Epu0CHA1eCu0TnumOjvmLqX0Cr0Z32OX-A6WFA6W4"
+"7v21tGZ3aHf3tH30tuWEBuGNM8jn00mCEajiEqNDEmfG4W3DQWCkEOg3EGjD8KZCuuGnHumtevln0uZn0uGR5vWLl10CE8WkEqU6gBe4I0Eu08Z3GQ20vuGUBGWDmK6n"
+"S02EkGJCsK3CXwd3oT51nOZ-LCWGLC04q0IBouY3A-GHtAXRGBnG98zP5u0V+G0CquWH7v0hMu0RB62TEy63ECWk8G3Eru01Wum4I6m5+Rn0kOn0I0f90KZ3Es00mu0b"
+"GuGi981yquTK2GmCqu0wiHWCnumT510DMmt21t23u8JDtump-2mCEWhIf-i-63WB6302s0IBEeP3IOC8EayhIGLPUBA14SZBESuPEuT54GJDEaMWbOT8C2nDpO3DtuWA"
+"k1HDna3CqO1KQuln0uYn00mDEGQj04Z3CNe3LhY314k42sWqiOW3u310vumlZuWAN0mCESRw1fZ3lYX3ucY3KVD1uaZ3eNL1NuVn0uIn000EXTX3ov18paJEqSJDt8pC"
+"M4zlQ7b0ES2pK8ZDuWZDnuW2Za2T1qj3gzB0su0TqW0Cp8Z5DZe-63WC63W3rq50ruGP3YGDvOZ32l11nGJ9gezY14CxEaGO08Z3tC50oKTB0OZ358Y3oP65v4JEmOpD"
+"+BA1+8A14a3CXie4D6Y3dX11p0Z3FPY3piWq6300sumQLxGom91rAuW15LKK8GZBtu0vAvG5hxWGo0GD+pcA2ncA0aJOwvm+tu0pbmmCm0ZDE8hBUlz0EKdcE8kME8Li"
+"oOdP40JDE4ChEmgl0GZ-vKZJvK30vum4y1mDECLpIy-S403DE8EDUNC0GGZBsaZDEaRO80JEsu0dOOXWmG08sum8oGWCt8nYS0GEIyU3X4g-RFGVRx0yQYGCk8Z3Wq00"
+"nuGHnXWCpWJICBzs3umJZxmxy8X9dX0EoGZ4ghJORBnjFIGCtu0cB20CE0TR+RC0+OC0EuVDC0JEoaZ3WSd3dZa3RYYt-6X49650tuG8Qv0P620EUqCGi4ZBsCpDqWZD"
+"mS3CpuW+GuVgE8KgE0GEE0PqEaNyE4341G61tCZ4fa10rOjffumJDIHCtWJEpGZ3rAd5e6X35+01pCZ3pOe33Sb3hB30qulY1uZY1WYDWqYDkK3EuGpCsuW6XAH3N5oY"
+"I3b0COZBtSZ3kl21naZ3UMc3GNL0lM8e00Z3ZWA0vu0+J5CI1SX-MCWBMCW3yL51oKZ3nb10vu0-VwGGruWNH8Tn0GGDkuWCW3GEEOMeE8uN4OJEIit2402DEGGp04Z3"
+"8f12rSJDE4GR+lz02jz00WZ31bW3YAe3DhW3Kj71pCJ1yfjn0u0wdHWDnuGrlm0DoOpDjjj36Z12pC3EEO3U8KJCquWRTu-Y1upY18nHkGWCruWMHw0yN81YIumWD8jn"
+"00mCEymD0aZ3Vq50quGpA0mDfKN8Z2GDEqgtESYRI8XP5Xc-H9GMH1mCI0lcGaZCqOpDEOTME8pyMCmEQZ5304Z3JHX3Qi00v8XCGK2T5mj3gL41m4Z3JRh-qQhHqQB0"
+"pu0yQYmCkWZ3ADB1t4Z4cFg3jjZtdL01ouY3mj20tuWKq1GDECZJ04JP0um1AuWgTum-TvGpx00CMqE5+lO0kiO0XVh3mle3oTa4PaZ5uFdqB6W3AFe3RN10numfsvmZ"
+"I5Hn0KZ3JQD4p83Es0Z3T2b-8vYF8v20pOHjex0Isv0OU10DEy2P0WJXYAz1AmmCk8pCEOCQ403DEys31vJO57oY0aZ3Q+E5u4ZDt8ZDESbq1SX-B6WBB600qumC69XE"
+"Bv08QHHDnS3DmOZu3b00r8X8YH0Ev8nTEBYuh4AQECMi0GZ3yKi3B7k5GLZ-63WB63W3Rx11qGZ3PbY3YFY3+NZ45FXsuU04tGJDsSZ3Ndc3f7g5puT8BwmIxHZCsa3E"
+"sOJEqCpCraJPj05CnmpBiLMOcPLOiLNPpv3FlybFA0I3100FTm0FW02Ffv6Tb9dRXncJlHMPpbX9140Ym0IBn0ICp0ZDW4ZBqaJDn8JEvWJCtSZDsaJEqKMBmK3FlacN"
+"z000yqXVLeN010ADkCZCqGpDp43DoOZCpa3CmWJPj0JCWKZBqW3CsG3Dn0ZDuO3Dv8JEo4m5+NC0kKC0WT38j4ZBuS3DnSJEvKJCuGZDraJEvKMBm8Zp630HnuIDu03C"
+"r8JEt43EpaJEmKJC1yAHWKZBnS3ErCpCnaZDqGJEoSJE5qj-63WB630Iu0ICkSJDt8ZCpapDpa3Eo0pCs4mU0CZp530GquIDnSZDpO3EvKJCtapDqaJ0A5GnySpDpSZD"
+"q8JDoOZDoOJDuSJ0SxVn0uIn0WKEWqoCk4pCv4JCnaJCnWpDta3EbeYs630DnGJEsGpDvKJCn8ZDmaJIw4KKqO3CuGZCoKJCtSpDsG3EXmk-63WB630Kn038suYDsKZD"
+"tSJEpWJCqGZDrG3CcRn0u0pCv0JEmWpDnWJCmaJCp4pYu8JEp03EqapDv0JDtCJCo4GO+NC0oKC08538suoDtGpCq8JCrCZCo4pCsWJGqgjY1mpDsSZDr43ErKJEqKJD"
+"uSZC1b3HWOZBn8JCvKZDn43Cm03Cs43C1oZ-53WC530Mo0IBtuoCuO3EnOJCva3EsWJEnSJDbrYr630FpuIDuOZCrW3EuWZCqGZDoaKEXjDCuSZCu0pDtGJCnOJDnKsT"
+"+RC0oOC00CJecH3Cq0JEp0JCvOZDq8JEm4oxI3A1yGZBt4ZCnCJEvO3Dn0pCsaJQ4Z48ruIDtOJCrKpDu4pDqKJEn0ZDX8g-RFGVR3LCq0IBruIDoK3Ep8JEvKpDt8pC"
+"s4ZuH90GouYDs43CoS3CnGZCrKJDoGJIH1GDXr2BoWJCoGJEmGZDp8JD+7A1+4A1C5JDWCZBuO3Eq8pCva3EpKJDuOZDXi80nuiP50KDk43DqCpCvSJEvW3Ema3EnKq-"
+"40YCbO29vaJCn8ZCoGJDtaqP+lO0kiO0XRBEnGJDv83DmC3DmOZCtSpC1KC0quSn0m3Dk83EqaJEqa3Cm8ZCsKJE5eKGGn3DoCpCt4JCvKpDvCJCr4JE+3b0+0b0fRBD"
+"qOpDrOJEt8pCt8JDp0JG60WCERC00DZBuWJDuCJDn4JCnGJCo03D1fP063WCEKE2a8JCsSJCsSZDsCZ-MCWGMC0Ju0IBquIDv0pDm4JCpSZCmCpDoCJ06BDZ1GKDkGJC"
+"oKZDp03ErKJDs0pCmCJ8r5oeqCJDv0JEuSJEo0pDs4JC5Fa-H9WBH90Iv0ICk8JDoSJDq03CvCZCuS3Eo4YAQpY1iWJEvC3Cr43Cr83Cv4oa5KCGsuYDoG3Cv4ZCsSJD"
+"uKpDrGJPjuVn0qHn483CXQMWw32CvGZDnCZDt4JHCBTn00KDk83EsSpDu8JCnKJEpOZCtKq-412Dk03Dm0JDnaJEsS3CtaJCsKIe+NC0kKC004JmnJJDqCJDrOZCtKpD"
+"tSJDnKguI3b08OZBm4Qha0ZCnSZCmW3Es8J1l6yGEC-2O03Cs03DqCJ8j7Ye+RC0kOC0C938jOZBvGpDuWpCuS3CqKZCsGZCX0lqC605qu2CuG3DX163mOpDs4CD1yAH"
+"WKZBpSpCr03DnOJCuC3Dt4ZDbDl-63WB6305p0YCkW3CE8B3W0JDqSpCr4ZCq4mUIlO00HZBuGZDmOZCvK3EoG3Cr0JEX6R05ZpDrapCu8ZCqSJEoG3EmGZ-nRWFnR0A"
+"oG38vuYDmSpCt4JGF1nCu8JEo4oxINC00LZBnO3DtGJCoSpDsa3Dt0ZCXy00nu0M90GDEai28WZDm4OE48ZC+NC02LC0eK38j8ZBsW3EpaZCXj74uW3CoGJOIgjn0GZD"
+"tSJDu83CoKJDoSJErKIrbP1Bp4pDsKJEuK3DuW3EfSY-G9WCG909s0YCk4JDvapCt4w6GKZDnapCgNn0Eas3eWpDmCJDtKJCpGZC5vF7WSZBmS3CrOJmE20EEqg300J8"
+"cuVn08Jn0WqDWKZBs8pCrC3CnC3CuCpCpWpDYNC0qKZBoG3CoGpCmSpDoS3EX3KPQpZCkS3EnSJEna3Er0pCqa3Db7b-53WC5300uu0pA4WUaaJEnGZCt4ZCpKJPw9De"
+"4mXCkWpCt0JCpuWG9GmDvu03AKWnSKZBmOZCp03DEum3GCpDoO3EbrY-WIWBWI04v0IBvuY3GW09sCJEsG3EsSJDv8nf98jn00qDkG3CmSJCtSpCr8JEmKZCt4DBqapC"
+"qKZDv03Cn4JEtWJCbTd-63WB630Jp038quICr4JDn03CtGpDpGZDuSJ819Tn0GGDku0UGuWJFWnDqOZDn8JDEmY316A6q0pDm03Em4UJC8ZCr8Z-MCWFMC00pu03FWZC"
+"qOJDmW3CvaJCpWpDpOJe58Tn004DkaZCpS3Eu0JCn0pDq0ZDsac58OZBru0BG00EISi2CK3Cr4J9XwFK2q5K0CZ4jz0DmKJEtGpDu43EuKpDqCZ4JpWq6302ou2DXR98"
+"n03Cv8ZDpaJEM4E4XP12p83EEG940aJOuH0DmKGt+RC0kOC00CJmi02CrWpDt0JEtCJWg2WDI8K2IRC0WKZBv03Cp43CuumaJKM6bnDFquYDvK3CuS3CtKZCpC3Ds8np"
+"Fuln08Zn000D1OC1q4Z3qW02mGJDE8O34SpDYBb08CZBsu0cL0oDuWZDpKZCrCZ8FG1AnWJEo0JCuCJCu4Z4QbG0TxFZ1u2Z10GDEeP50GJ0T5s58SpCt469U-R4Eui2"
+"mGJEqWZCoapDuapDpCJP67sBOG3Cn83Em8Z3VW02taJCXSY-63WC6300suWpAWpCm4ZDq03CsSZCqaJDpOZu6304ru2EnWZ3MK16t8JEp83Dp8YV8GJDs03DoSJEsCpD"
+"pCZDtOn9KuFZ1u2Z1WnDWCZBqSZDEi22OW3Du8pCsSZ4bSXsNC06o4pDqSJDuuGwL0mCE4R41fJ0Xv0DNmmCn4pCEuk4Myo2+NC0oKC00WJONGWCoK6V08JuwI0DuKWn"
+"IN34C8ZBpOJmOm0Ct03EEK-5kCA1403EXm84maZDu0Z4cBX-63WC63W4cS10mKCe00Z3Fy02sWJEIOo5IRC0KOZBqaJEn4k-OGZCoOZDuGZ3w+GPNWHCqaJCv4pCECk2"
+"EaS4XCg-H9GNH10DE0t3GC3CrS3D1LB5qW3En03CECE2INC00HZBq4pCp8pCn03DpWJCrO3CbLi3hf00u8HiOmHCv83Eq0JDtK0t+NC0kKC004JOSZ3CmaJDtGZCu43C"
+"r4pDrKJe78jMC02DkCJDvSpCn0Z3fa00tumPM42T41IDkCpCpG3Ep8JCv43DsSZCu4OF+RC0oOC008Z36A11nKZ3DL12maJCEqO3MOD3IRC0CKZBr0Z5MHX3ye11nWJw"
+"Z6Gtm8ZDmO3Cn4ZDoaJCmGZ-dSXGdS11qCJmkWnCtSZDoa3CEep28KpCmKUMQBb0q0ZDq4JCoa3CnO3EtOZCQmg3aKZBo0JCrG3EvCZ3aj10ueX6R00F+FL7cCL74G3D"
+"ECm688ZCvuG3A0HDr0ZDquG6CujZS04DkSpCr4JEt4ZCsWZDrC3Ev46608JmqpmDt4JEEun6EWQ204Z4J-W-63WC6300r4aj0KZ3RM17uS3CoK3Dr8ZxTF0EuWJCtCpC"
+"mKJEuWpCn43EfTX3aj14sapCv8Z5GG11paZ-NCWGNC0Fs02Ek43EuaJDqKJDqGJEuu0hQujV80GDE0I3e0pCt4ZDvGJDsG3EIeM3XP1DoG3Cu83Cn0JEuG3Do0Z4yoW-"
+"A6WCA600tuWDGm1CrKpCo0pCvuWzS00D5idqRF0Bqu2Em83CqSJEmWpC13OoR7cyGOpCuKZCXmE3nS3EoO1AKuV53uI5300EXZB7qC3EoSpCmGZ4hc00qKEkIx72E817"
+"EiP7b5k3boG8L7oYCSpDpOZ3q015u03EvSJD+Nn06Ln0Ga38puYCEOZ60SZ4De02oG3EsBc54WJDEei7GKpCrSZDQSe641oCk4pDn8JEna3DtCZDqW3Ct4+K+lO0kiO0"
+"4K3CEWF2GSZCvKpDEm72CO3Dn8Z4yXWqA60CquoDr03En8JEqSpDruWwDKWhEOe4WO3CnS3CtOJEsKyy+lg3+ig34KJC1l27qK3DnOJEvSZ3bPHeTuzs3mpCkWJCnSpC"
+"m43DsG3Cu03EM0M6X603p0pDpumFN0nCm4ZCsO7e4m3FlSNPXjsGi5sSpbcPfLcSgiv8cSv8GmJRXXtL1S29lLdRqvJCtS3Fl8Z40e1KZG4FpHNOdL6Le9NPpXsRiHcF"
+"uuI8An0CoaZDImX6GapCuKsA1LXEd0G4+uJY0q0600I796G0A2294KZC1o16tKJDoC3Evum5Z00DDBepak1Gqu2CnaJCrOJEv83DpK3DrGJ8nwGEHW3EmO3CpO3EoaJE"
+"qW3DoKZ-j8WGj8W38V12qSpCX1h3vtX37PHGeAjy2mpCkCJDn43DuaZDoapDqK3Df2l3e013sKpDn4yO80ZDuuWxXuW+9ulG5qhG0KZ4NX06r0pCnOJEuuWJbmWDn8ZC"
+"EaN5IZW1OKZBrKpDt0Z3SB20nuWLSe1qXGmCkuWNF01EsapCm8HOZKo9+RC0oOC0ES520GZ3Bs12p0JCEig24GJCIKz8INC0CGZBoOZ3vsW4Cd00qumZO42TEG334apC"
+"1F04p8ZDt8Z3GGH0Nu-Y1uoY1GaDWSZBt4JEpOpDuK3EvKpCtSZ4VGYq5308pu2DvGZCq03CECA28S3DuqM5CKZBqCZ3nE27tKJEu0pCtSZ5RwW-53WB53W4-zX3fS29"
+"o4JEs4pCnGJEt8HQK8j53W0Dk0Z3CjW3Ut14qC3Dp8J1A5oYiG3EqCJDv8ZDqCpDp4+i+lO0+iO00WJm80HCuCZCm4edCC3EsGZ53jXsC604u0ZDv0Z3EG21nKZ3jOHH"
+"w42ZS8JDqOJDn0ZDEKt804Z-vLXGvL10r81M8mHEma3Cp4JCqum1S0WDbVlq5302ouYDEue200Z3AQ10suWfKu0VCaGn8aJDoum8f01CuSJDou-VV8qVV0WDEW52EyNA"
+"O43CuapCnCZ4mT11brYr530FpuoDvapDsWJEuGpCnSpDu81VC4GnEaa5aO3DmapDo4pCtGZ5ScY-MCGVMmZDn0IEk03DsOpDn0pCuaJDEuc91HB0rODy646n0GZ3Oa05"
+"va3Dr0ZD93F3ru2DqumQZWGCvSZ32B10pam5+NC0kKC0G838nuIDEqS6EGuAGOJCu0pCbukq5300p4ew0OZ3I115tCZCnOZCP2A1maZ3Ie16oKZCoSpCruHHbe27iOlc"
+"i0WDEGp9uCJEpKZDn0ZDr4JEsaJEn4qJQdQ9IOl5SK3Et0ZCmWpDQK76802DkuW2D01DoW3Etum8G00E+JN52HN5OO3DW4ZBsGZ3xY27mC3Cu0JCsKZ4rQXsaL00o4KJ"
+"K43CpKZCnumMPKo3K0IDkSpDouG58WWCuGZ3nF10tKm5+-a0kya00KZ3l1X3Ux03p43EouWOeGWCn465Ix91I8o4KKZCs0pCu40j0OZ8au25sWJDuSJCE0n54SZDEet8"
+"+dY1waY14OZD1d22mapDMa26G0JDm0ZDIW+4IlO0aCZBpa3CnCZDvKZ3t921rSZ5eaW4S911rGJW-Z0CtSZ38wW3WcW-B6WCB600tuGDHuG6VmGEoKZD1pA0s8nFOezY"
+"1mGDrS3DEiM5KOJCqKJCte1lDWHDka3EmOJDECv9K83EnWZDmuVn08Kn0W0EWWZ3Gg16n03DoKJErumt80mCXgXq5305ruICpG3EE8-9IqkB4SJDMGW2S8ZBvG3DmCpC"
+"EKIA00Z3duW-LCWGLC05v0IBouoDX519vaZCvOpDvCpCq40VIRC0GCZBv0ZDEixAO8pCrOJEqWJLGHmCtuWDk0GCEyHA00Z3QRY-MCWEMC03t038pum1X0GEE846403D"
+"ESnAImb4QhY1qOpDvO3CvWJEqSJDoK3C5eKPL0ZCrO3EuWJCr4JCsW3E+pb42nb4mSJCWq2EkKZCoK3EvOZ3ca23p8JEr4KjIlz00SZ3O+22n0ZCXD10v4UH1kUmhW3E"
+"v8pCsK3CpWpCvGJEoWZ-H9WFH900t4UjSOpDmKJDs0ZCEmc28WJEq4mUINC0qGZBpGJDp83DvCpCr83EEmR81bZ4Qq01s4Z3I331pKZ3BHX4NyX-WIWBWI01tCZ3+Y2F"
+"nGpCpWpCuGJDsWZDv4ZCruzbHmWCkKJEX+A7mGpCn8JDnKJwV6gPG8JDs8pCE0r9CK3DmSZ4hiW-63WC6300q4CB4OpCE8U34a3EEOQ2E0C8UBy50PZBv8ZCoSJEm03C"
+"oWZCoWpDbLC6WGZBsKJCrumtD0WCEau40GZ5KSX-tUG-t2mDXVh3xdW3wC36u0pDuG3Ev8UK2mIDkCJDo8ZDoWJDqKZ3nHIxtwW3L0XDp0ZCvuGfRuG3cu-j7upj7GmD"
+"s4KKuK3Do4JEoapCra3DpO3CpeUK2G3Cq0JDqG3CmCZCqWZCn8H084KKK0pCqK3DsK+K0KZ6k8Y-B6WCB6W4iz03qCZDpum3Z0WDEKV508Z4NsWq7D13su2EmuGee01E"
+"qG3DvuGZi4Yr1559uWJEmKJEmOZDtumPXul+d8a+d0mDXZB5v0ZDpK3EEem8CWZCr8Z4XyWqoR02ruoCEyq38KpDsuWZBu1nruWYLmGErG3EEaoCGW3Cr83C+3WC21WC"
+"4SJEEeI70GZ3VQ17v4JCpaJDtWZ5AdXqeL0EruoDq4JDs83EqCpCo8pDMqz2Xie3fBY3ok16tG3Er03Drumt8uVK2uIK2G0Em4eeE4TBGK3DmC3CE8m5Ma26IpO0C8ZB"
+"uCZ3TZZ3nz03uOpDqKu9bTX36Y30ruWCDumONa4Q+BA1TAA1u4Z3gq13tapDvuWUVm0DnSpDEOu5UxY10CJ8rHGDmuGSuW0DmOZ3fNJpqxmSau0Ci4MVEGzD1SX-63WB"
+"63GuvI2Ds8pDmGJEsSpDE4360KJeZBzY1WGDkCJO0p0DoGZCEeYD4KpCXyGONmHEn4pDn03CuuGxAWWDr0J1SxVn0uIn0WpCWq2DkaJCsGZDpWpDsSZ3Rb30q4AQIhW2"
+"0KJ8GG1DvOZCu0Z3AoY9Rh15vGZCt83CE4924GJDHSX-63WB63W4aS12pK3EEud2K4JCpGJCqO1va8DQ5u0hj0mDEqwB4CJEEiMDQqm5E4CA1p30nuWzQmmDp0ZCI0E2"
+"+RC0oOC00KJONGJDpCJEp0JEuCpCvGpCu81mH8ze4GXDkGZDrCZ3iWHPTGmCq44d1EA3uSZCsuWLH0GDE4684OJE+3j2+0j24WZDXe23nG3Dn4MrCSZDmWZ507Xq5306"
+"quYDnSZDsu0Znum+b0WCIys5EeZ6EmI58S3DtuG1SmmCtK3DEKQ2+lO0oiO08S38nO1lWuWwf0mDIqOAEiq2I3b0CKZBo8Z3Se10nu0rp4Yafe81ouY3yi34r83CpGZ6"
+"v1Z-XIWFXIW4aS10pu0cN0oCvS3EmCZDmGZ4lEXsB607m43DrCpDvCZ35Y02rWJD5yQXvwmexWmDsWZ3Hz21m0Z-YIWGYIW3ZQ32tKJDECc3C8pCsGZ3GLH0xfTn0moD"
+"vG3CpaJCp0ZCn0Z3gmI8qv08D0GDE0s60SZ3gw00tu0uR4m5+7A1T6A1v0Z3o+26rOpCtGZDpumdG81FGujMC0WCEWh2EKg3EyP50WZ3MGH0l6sTXU72sSJC1K61n8Z-"
+"HGXGHG11v4Z3y313o83Dn4Q5E4KCX2dt6301tuY3Jj25tCJCv8ZCEy+FMqI21OC5qOpCq0ZCEOYBXvd-H9WFH901v8Z34b04rKpDrWZ3K744uW3CoCZvLk05tu2Dv0pC"
+"Euv80aZ3h130q8HfC4wPKSJDrWJDnumov00D1-IGpwlK28ZK20mCXj71raZ3j546oKJDmS3Et8nl98z53WHDkCZDrC3CXga33G11nWJGR6GnC03CqOZ3Ez20tumSyGWD"
+"u8Hb8u-53uo538HxkuGi2H1Dva3EoOZ3jtWveL02tu2DE8+90aZ3p044p4JDv0JO6BnCdGXDq4pDqaZ37x03mapDquVbBuJbB0GEIqkB8OJDs40TO4pCr0JEtKJ16Bzi"
+"OWWCkWZ36-38p03EpOJCmKpCf1Gm5XHCu03Es83DEWqE8S3Enu-538q53u0N+umiOGmCo4YzEKeCImd7I-i2yGZBnaJCs4JDuSJErCJDsSZ8nz07pW3CtapCo4Z3QZ01"
+"oaJHowVK28JK20mDEC15Ga3CtSJDEKV8Ka3CuaJEs4KpIVn08OZBoKudOSZDpCZCuKZ6OPY3CTY3v-15qWZDuO3CEqV3+lO02jO0E4t38OpCquGS6n0CvSZDEejHXUcq"
+"B600r8XUu01DmSJCvuWzxeXtum18puYDt43CouGOouWF-0mD+BL729L74aJEXU61pSZ3GQ40mumnJ0WDEu8FUNU3KKZBuW3Dpu0Z410DX-90u81wL4oYEiHDaWpCv4JE"
+"r8JDnGZ-pRWFpR01q0Z4nz00qumwcWmCvaZ3OX11u0Z40dWqH90FpuIDs0JDmaJEtapDoG3EuenpAu0pO0HEvGJDnuW4Y0GCESU6X3j-eLGkeH0Dm8HSF0GEI8WCEWx4"
+"8aZCsOn9I8jn0mGDkaJEEmJ7GaZCnCJDEG78b1W3ik00s8nvDmWDvapC5dl-63WF6300ou08Du0I5HGEouWypuW+uOn5juSfVGmCkO1-JG0CuuWaSum0h4mhXm8CqGJC"
+"uC3CpaZDsKZCouFJgu3JgW0DmCJOOWGDmWZ3CX10nuWjnGmDs8nCuejSFGHDu8ZDrOZ3fD20mu0ec4cOXm81q4Z3s430nuGw4XGCvSZ-MkWFMk07q03DWKZBnaZ4+L21"
+"q4Z39K20oKSgIFA10GZ3OnJno10DEiM3EOEA0qY4ct00nu08pu0Z4n0Dt4JD+JWC2HWC4G3CI4t38GZCou06Dum1AWGCsOZxkO03rKpDmumGvWHDoCZCrGpCbPi33z11"
+"tGZ4KH23sOJDp44N1qj-TFWBTFGuv2mDEu7HGaJEvS3CEyH6I0U6IlO04KZBEykAa0JCu0JDp0JDqWZ50rX4eo11naZ3QH25vOJDnCpCMS3A+NC0kKC0E4t3EKr78SJD"
+"vuWPtW0DtWJHG9Te4W1DkOpCpCpDEGQ4G0pDvGZDYiQA0SZ3Ku11tSZ3--30quWQoulY1uZY100EMu724GJCEqtG483CEuSB00JuvAjn0u0+0XGEs0Z3dy10qumdzqwP"
+"KKZBmKpCru0nM0WCIW9E04Z3kEX-B6WCB600vuWrduWA1HGCuu0qFuG9U4YAQ3b0CGJDsOZ4zg20qumDEenoRuWCGvm2vGHErC3DpSZ3oVX-B6WEB6W4At43tO3CqumG"
+"cWGEt4Z3OLK8f8jY1G0Dku0gOWGEpaZ3MR40uuGTN4WhG0YDkO3EIuP28SpDmuGt11WD14c-A6WBA600numKA1GEECMJGW3EuO3EE8DDIeP3INC0E8c51+X3ZS44nCJD"
+"uOZ3UqGOQ3mCEK+5GaJEo8JEEai5+JU3+GU34GJCESo50CZ3o330rumEjm0EnWpDbNhq5301quIeXnnCuaJCvSpCquWCQKYYOKZBpGJEnCZ49-23tWJEruVpAuJpAG0D"
+"n81uUmXDtO3DoOpCou0br46cUhF4O4ZBvaZCnSZ3m-12n0JDE0KEDOCBo83EoGZCoS3EmaJEEeg61SX-bLGlbvWoDXWCk8Z3FL40nu08I0nDmKpCpuW7Duzs3GmCu4yA"
+"4C3DEaZBU4CBSGZBoKpCmSZCEq0LC0JCm4Z-UqWFUq0Cq4JDWqYDkC3CvGJCruG3g0XDpSJCp442QBb008Z3jd21uaZ3rD32nGpDYOe48CpDuuGVDW0Ct0Z3hQZ-PnWG"
+"Pn00n81ccum+21XCtaJEmumaNOnaB8TDGmZDka3Cq4JDsW3Cq03EqSpDDBF2quoDEyQFEuPBE0RF4OZCXSY-I9WCI9W3aQ35uOJCvOJDX182oKJDM0D8I7b0GGZBr83D"
+"EmBFG83CpC3CEqM6X103WKZBrumRrGWDnu0T1XGCmKZ-t7YFt722q43EISZ948JDE0490KZ3vX00u8X+GeTaBWmCt0Z3qxY3MIY3CgHWcuW1Au0lM0XDpa3Cq8n0HaIe"
+"+pz0kmz0IWf9KG3EuOJDtu0e2vW+w8ntr8T7D0WDEK0K8KJDtu0T9H0Dvu0TtKoY8GZBvum8o0mCEy680OZ3PGJ1Txln0qXn08Z3OQ21p4Z3Sh31n8Z3kb31nSZ41bWq"
+"5308quIEuW3DtKJCEauE8a3DrKO904Z3PkY3BK23naJEvuGrK10CIeyD+NC0oKC0EWmDE46FEey38OJDsumfV42GINn0Ee1K5d21nKZ35J11u0Z4bXGecvWjM4+i4WJE"
+"EG15+pY1+mY108Z3vKHGAHHCuapDq4Z3R730su0NEeTP5WHDtOpCoWJEEqyFcKrJCOZBm8Z3Qd11uGJ8fI0Cpu-A68qA68HoDn0DnG3DEi4MKCJEoGJDpOUn0uGG9uWV"
+"4nGCvCJCE4jM5bP8Ao0Do83DEqFA04Z3TR41mWZ-aLWFaL00ou0JkGIEr8pCnW3CmWJE1Rf4UCYsA6W3cm41pGZ3M123oO3DsOH3NumoAu0vKumg01HEnOZCrKeE+Jn0"
+"oGn0WK38nuoCmCJCv81na00DI8AAUt050GZ38F22n8ZDEm020GZ3r8KGPMSAXV45o83Em8pDEW5314c-53WC5300s4mUSSpCrGJEtSJEE0+80CZ4LVYqA601ruY3Z244"
+"oCpDv0Z3WR20vayrESf440JCX1HOjWmCmaZ-f9bFf953q8pDWumKFnWDr83EEaW20SZ3H3Y40zXq63W3ql51rGZ3Jt25rapDmaJCri86nSJDmCZDnu0qyW0Cp0J9du-Y"
+"18pY1uGDTXmCsOZ3vD20ou0CSGGDr81PO8DP500DEq3J0CJWjpmDtGZCE0785xUOnBn7oum-CnGCuWJEEio2+NC0oKC0ICo5ECUG0GZ3Wd32r4JCEug3UR534OZBI4JD"
+"EWkMEekG0aZ6Cv23qu2EpumOk0GEEOyM8S3CtuF1A841AGmCmaKK40JCE0zJ08Z3P431v4J829DZ1GnCkOJDqCJGvZ1EuKZDu4ZCX0HOSZGCsaZ3Sra3-V12pCZC+7b0"
+"25b00CZ5Sx15vCZCpW3CEG94ESfJ1mdqxXW3TdZ3GM40mu0nim0Esa3CUii2E8xJ0aZ396a3ZF20t8naGulK2uYK2GmCou0v-mmCnOJDEWkCCWJDrSZ5IcZqSFW3rF52"
+"s8JEEaF444JDEan2b1W3POZ3ZM10vumb4nGEuG3C+lH32jH30CZ32O30suGwo0WDECrCCCZCmaZ4p8aqA600rumjYWnDpO3CrOpCEicK9hD1WWZ36D13vW3EoumwN0mD"
+"EamOXDl-AhWAAhW38t48uuIEuK3Eu8ZDE0228CpDuKSaIlO0aOZBqS3CtW3Et4Z3zM21uaJ1Av0V8mYDrS3Co03EsO3Et0Z3v0b-63WF63W4Rx15nWpDqOJEIiV5C4JE"
+"q0Z3k2XqC600pumafuGuGXHEuOZCmO3CIq89XnD1oKJOCG0Cuu0VDuWiJuln0uZn0uW8N0IEpK3CrOJEpGZ4CQa4NsWqXIW3tZ17na3DnWJDtCZ3Yj40nOHV8WmCkWZ3"
+"CEb3ye30suWB9vVzJvJzJH0Dpu0WLH1Et4pCqaJegv0fQ8X4M0mCEtl6ECVAiWJCpCJEnG3Dt0ZDtOXUBG08s4owEONCIKBCCG3DnGZ-A6WFA600u4CB0GZ3uE42v0ZC"
+"EWI8UGz9ERC004JmRp1Em8JEra3Dqu0LWuWPD4c50aZ3rHZ4UT23t8ZCmul3K8a3K0mCECf9EmeCC03Cm4Z3b8X3lVXttUW3UW21t0Z3Af01nGZ31Ua50nGu80mCE846"
+"EuJA443DEKKK+lO0wiO0CG3CWWZ3Mr30mu0xBH0CmuGsP91la8T5300DEOG988JDmuG-T1WCIujC1ug3dyY3yu01u4Z3bR31r0Z-kgaGkg41qGZ3YSX3CG31pOZ36j50"
+"ruGn-4+QQNn08W3CquW29XmCvSZ33Oc4MiG05J2ErWZCvaJCpOJCEGLFIu+D+lY1kiY1EKSJ04Z41Ea3JCY38U50teUP5uGXYXGCmGZ36zZ3S+40ta+dXZW3IK50t4E1"
+"8SJDpO1scvln08Zn00mCEiLM0SZ33Z61raZ39vW3VAcuC601ruY3vE21vKZ3a863n8ZCpaeYEqi2SKpCt4JDm0ZCEiy30SZ-C6WHC603q0oDku09f1GCEab38WJEvuW3"
+"guTp0vmUZ0mCE0n2EWs8EumNfPX4xD21tSZ4i463v4JDuKCZ+lO0oiO0bRh3Iu10rumnb00CEWv2cRx1KOZBs8JCt4y408Z3xNc7U+10quW1YuGzc00DIOc2MCXP+RC0"
+"oOC0EuMHE4l9K03EsGJDquWX3LQuQpz0ECX7SaJDmSJDta3EEeqF56A2suYCEW6G84pDouGipuV9oOK9oW0DqSZ3W5Z3E212s83CXQC2oSZCIuK7IRC04CZBIe+PE8OB"
+"0KZ3WTY6IJX3qAc3tc50ouW9AH0DmuFoe94oeH0DquGac4WTb+10m4ELIiiKUpY1Iu39O0JEqCJDoSZ6YDY3dV10ruWZJXGEnWZ3rM60n8H1xuFK283K20GEEC7BEOe9"
+"EKpA0GJ8210CE0E2IhO0EmH3Ea9EO8JDsaJDu0Z6+-a3q+14nCpCrGZ3RK20quWeQu02FuVn0uIn0GGDm44KO43CqWpCtSZ34g50muG2xuTIJu0SV1GEEW620WZ3pz50"
+"qqwJ1p20numa61oDsC3CtOpDu8JPjuV7DeI7D0GDfgC4n8JDtWZ3Bj02u4ZDkFD50aZ4mO40nuWYrm0DsSpDXyG05pYDs4ZDsWJCu43DnaZ38+LOoxVn0uIn0GYCWaZB"
+"vWJEsGJDIGg31PG8f8U53WGDs0Z4b330ouGsS4WI1KC1rKZ3fk01oGZ3u9b3NJb-53WF53W4rq50tuWMn0nCnCpCq4MvMG-8E7v2S8ZBvC3Eu83CIKU50aZ3sxW3MiGO"
+"j0GDEacIO4pCvCZDs4Z518b-B6WCB6W4vs31p0Z33s42mCJD1Wi52sYqdw01ruY32ZY3CL25vS3CnKpCMiS3EGk20GZ3Yr60uumSGXmDp8Z-ueXGue11rKZ3b8Z3u+61"
+"taZ4ko30pumqduDt300DECQMEmGO04JOPJmDmOXWmu0KQ00EECI880JCnuGyA1GD+Fe42De40KZ4PxX38u10muGOHmGEp83CMGDNIZM1KCZBsW3Cpum0vWmCuOZ39sY4"
+"S0HGIHWCuuWiHX1DqWpDv4JDbci-I9WCI9W3kzW3kE31nCZ3uz24ma3Dt4Z3+cWq53W33M12uaJCEyi20CZ3HjZ549a3kz00muGMJu0zXGmDvu0-GuVt3uJt3uG9NGHD"
+"tWZDtOZ5hw61u4Z4QQaq5302ruoCECVIXyC0qO2Tt81FNumls00CEi0B84ZDqOHubu-P5uoP5u09DHWDu8HEjum+BnmCmGZCkhO0843CvuWNLHnCuOpCvWZ8u312oKZC"
+"Euf648pCIOEQ04JOsvVn0uIn0WYDm0IEkC3EuS3CnuGxX4ifIWu5QhO008Z34cW4Jb52vCJEMGGBI834C8JEq4Z3a830vu04U1GEbjY-A6GFA2WDEmp748pDEOzO80JC"
+"ouGSl10EcZP5Ei4844pDEimBEuZ808Z7wR43suoDpumBBX0CmaZ34M50qOtULPSsKH0Ds8HHk4yX00Z3Xc00pumvj9XEQ8zY1W0Dk0Z338Z3GXZ3ooa5XoGWVwGBO1GE"
+"EGy64W3DEuIQ+p72+m724OpCECvAGSpDnGZCEW-84GJEECW5UVg38GZBsuG0r5gh0WZ5d8MW8wmWFum5I0GDEqE5E8uE00J1NuFK2u2K2uGsUuWHpW0Cp0Z3Iga3JyYw"
+"QF00ruGs1v0HevmHC0WCI8y8XI62mWZCEur44W3CECC608Z-CGXGCG11sKZ3qlY3BGZ30541paZ4RMN06BzU8GWCkuGi5v0eCuWSNGmDuOH765yxEC1AK43EuW3Cqu0x"
+"l42x+lO0oiO00OZ3lL46q8JEs4JCouW9SWGEtKZ4PnYs4K24oaJDrWZ3B344u4ZCtGZ4hoKmh8Xba0GDEmvI04Z3eBJ8duln08Zn0OnR5nGEp8JEEef64WZCEGo8ECU3"
+"QRC04GZDE40D04Z3eo02oS3DIe1C1OC5rC3ErGZCXU03n43DvKqi+RC0oOC00WJOxXHCs8ZCpWZDE8tR443CsRx1Ee24883Esu0zJ0WDQGD58GZBn8neEum6DmWCnaJE"
+"Mq78+pz0kmz0ECo5E8PT8O3Dmu0a1vmRx4CaQRM18KJCou0gM8Xfz0mDMGlTXP11t0Z3RA14oW3EvSZ3YcW-EQYFEQ20tum8NumnC0mCXH70ruWIO817D8zJ2m0DkKpD"
+"1Q80vum7LWGCnOZ8PxX34v21pWJ0WRnJr4QV+hO0ze80tuWbGmGDp4JEE4q400Z3SlZ5-ebqA601ruY37672mCJEEC0AEqdRICs8EKh8E4U9Eaf64SZCYOW8+NC0kKC0"
+"EKaBESk908Z33da3VH40uOUqKm0DkaJDE8CA80JDv8HeJrudK4ZBpGZDsuGe9GXCuGJDrCJHmwVn08Jn0umZSH0Epu0knX0Cn0J89PHJ0AjA6uGykvWYsX0CnaZ3ZYb6"
+"tPY4KnW3mf47t43Cs4JEr0Z7bjb-VMb7VM52qS3DE4X584ZDru0FVWWDoSZ3+eb3n5XqF9W3bJ61sCZ3kJ21mOZ4B8JHzZ08tuY4iP60uuGASvG6vOH-Nu-J2uoJ20GD"
+"E408E47SCOZDpaJeaHmCn4OFINC04KZBEWF304Z3RD62sO3EEyQ4X9i3jx12u83EImhV4C3DIWnJ1SX-53WB53W4fz00num0C8X58uWSg8HKwejn0uGoyHWDmuGJ0v07"
+"D8X-OLixEW9REe4K4SJDEyLUb8g-63WB63W3vN31p8Z3Y140muGXNWGCmWZvQF01ruY3KtW38Q70uu0NtPHqS4Gn443C1s93mW3EouWPebqP+NC0kKC00WZ3a-00tumk"
+"Zvm9Xm0CuC3CIKZ4Ql0508Z3e950suGiA0WDEyD45bZ3v613n0JDv8HaLmWDmGJCIO8F+NC0oKC0bFB0ou0URvG7omWCt8ZDc7G9IW4EECjREyF3IqsD1vF1WCZ4BO60"
+"nuW63HmDuu07+u-0Aup0AuG8DvmTZGHEsOZDu8Z3tN31maZ49cZqB600ruWDQG0CtumeR0nCo0ZDnenMM00DIKjDE0cVKC3En8ZCrO1sRuFK2q5K0WJe9x0te0GCIGJD"
+"0SZ3cZWwWI01p4Z3ZaW3hJ20pumnK5WIXLX3MZ07taJCoC3EtWZ3GiL8YwVn0uIn0u0Zcu05Mv0w1v0r1wmySu04MuiMMW0DkSZ31eW3TF40v4c59b33WOZBruGqRWmD"
+"taZ3aL20pu-efOqefu08DnWCkC3DEay98aZDru04dek53G0Ck4Ek0CZ3JH71uCZ3RA41uWZ4pWX-t5WCt500quGaEumDE11Cr0JCtuWCk0mCIehAIZN008Z35K10rumd"
+"KGGDvuWzkae4ECK20GZ3-c75uKpCuGpCEWFP+tZ0+qZ0ICi7EKxK4O3CE0HB0CZ3J1KuP9jn0mmCk4ZCI8x5Eyv380JCoOnoG42ZEalG04Z5dSe3xAd-63WF6306s02E"
+"k4ZCpumZEGGDsu0nvGWDp8UB9WGDk0Z4m7Z3l4b5GNH0kA1yXum3X0GEEyUA84ZDp8HIRuVK28JK28nmUmHEvO3DsK3CrumrSGmCp8XmM8DQ8mWDkC3EEyuE4SpCE0YJ"
+"883DuOXGCW0DkaZ3QA28naZCmO3DoWJDIuH5+RC0oOC00WJH6mHDpapDm8ZCu8H61vWHH8Tn0uGi31WDIOhCK0ZCnWJDmaS0MqA6CGJDo4Z3K941p4Z5Hca-53WC5300"
+"vuG8L0WDEu8PEOM9CWJDoOZ4coWs5301r0Z3dDc3Wg20vumwGbD60CZ34ab3aX00rumnv4qP+ZX1TZX3CqKWNHGCnu0t1YGDpGZ702Xq6305suICs8pCEa48EScFYOHY"
+"OGZBrWZDvGJ9gumuBuFkA84kAGGEnumxauG7PXmDv4Z3Mc22tOJCIGV2URC0I8MM8S3Csum16rmhbP11mGZ3Rp54m43DuCZ5e6Z-C6WCC6W5Cq40vuGRlu0H7HmDmum5"
+"wvTf7GGCk4KJ04Z4RCJHH5WI5OC0uu0FQW0Eu8Z3kL70rOHcmulK2uYK20mCE0224OpDE85BGC3DuS3DE8l4cZJ7CO3Eu0Z3P2Y3Fxb3ASLO0G08ruWue00CE8154CJD"
+"Xjj45FY-53WC53W4Cq40quGlF1GEEGbS4SpDEeCOURC0E8EU0WZ3HX46uG3EqOJCnO1+MKCHCCJEr8Z3j223q4JDm8n6Buln08Zn00GDEaa5843Cpumvjumvru0iR4yy"
+"Q3u20WZ3c918q4pDnSJCqS3EM06XXqECo4JDpC3Cs03CtC3Era4Q+7b0k4b0Iir30GZ3UW04rapDv0Z3MSX58bYpyg02uuYDE0LBEKKN8a3CrumHW5MOXrj3ou40nuGb"
+"LuG3IOnyXuln0uYn0umMF00CES-CESJQ1dA0n818G8Tn04yy0WZ3lB83va3Ct4c01Ki3Hm15tGJCm0JDEqREEeKN+lO06jO0I8xWEK464S3DE4uIGG3En83C1hgq9e06"
+"tuoCrCZDpuGKxGmCuum2G6WI55b36P11nWZ3uCZ3Zca4RbW-B6WBB600vumjbuWiqv0b4vW+x10EMG1DIxY1EGFZ0GZ3Bpb3QQ32oSJCQKSEEqP508Z3dq01o4Z3TE51"
 );
-static sybie::datain::DataItem item4("haarcascade_frontalface_alt.xml",4,
-"Seu1A02Dq4pDsOZCm8Z3Jb11vWZran10quluGOiuGWGCp0IOBvtAK0GEIuv5+ZQ02XQ084ZBtuWIfWWCm0Z3vi21v4Z5j7ZbED01rCZ3oP22va3CE0T24KJEQAT5qapD"
-"pGJDp03DqWJEnCJDMpDB0GZ-a3Xpa3X5SyWQEDW3ENHOnvll6Oal6G4Ek4JDu4ZCqa3EpCJCmOJEvKZfgn15pSZDm8ZDES99ECr3X4dYDDW3AA13t8ZDuu02MWWCr8Zs"
-"qJW-b3Xnb3X58eZSjkG0ZuVhB8LhBmGBpu2EEK224WJEES99COJEoCZgQQ01sCJmH7SbCS3EuWZ3WMXYc601qSZ34K27vapCqCZDu4ZtQQW-13Xn13X3-gX3eXWQCDW3"
-"JlZ4xBY-hkWFhk0GnuIDo0pDn8JEtOpCqCJEoaZgRa10ruGGUG0EnuGjNW0Dm0Z3eHYYb60BpCZDn8ZCpapCs03EEOA5MdW2+-946-948O38mu0KDuGdmOdUzOXYuuFg"
-"1u3g101CkK3DruGlE00EEaOA40pDQYt54KJCEGt2SapDsWZDm03DECVEAEQ0i4JCt8ZDpK3CpCpDo4MkMFQ0+l946l9408Z3hoY3u4YQY6W6g7Z-uvYIuvY31P2BrOJD"
-"m4JEmGJCoaJEEet4AgH6qGJEta3Dpa3CtapDs4JDEqC4EAQ0mCJEp8JEqapCmGJDu0Z3WNXoz810quFcGOCcGu0XBum2UeMe1e1XB0WD+V32AT32X8A5nSpCnWZDECLC"
-"8W3EoOPOS4g74OJDXMY3SXZcIyZ3hh1AnaZDn0pCmaZDm0Zrmx00rulbGOibGGmDWu0ES8dVBmmDWa38EGnF+ZT26XT2eOZBnSZDr4ZCo8ZCEiWB4SpCICwEMwt2W8ZC"
-"uWJCm8JEru0rEG0Cue9pEW0CqaZ3SF16oa3Cv83DmOjVB0GD+R946R944S38Iif6wTQ0ION8+hE1AfE1m8ZBoGJDtOZDn43Ct4Z3x2a47MXbd60EqOpCoGpCpaJDma3C"
-"n0pCM6DByO3CqWpDoK3EqC3DoaJDsKZqHQ00ru-SGuySG0GCI4G3k1F10aJ8dw0dQu-J3OqJ3mHDk4JEnK3EsuWp31nDuCJCq8nUQO9g1uWUVumLImGDqW3DEe+EIkX4"
-"8GZDmumUrmHEpWpCoSpDuOjLX0GD+J746J74jzaS3n10va2p+dpAEbpAy0ZBm8pCu8pDuW3Cs83CvKZ3dcWYwW05nG3Eo03CEqd94aJEEa2EIEQ08KZCoumm71WCEyzE"
-"80JCsOD7m0GD+374E37404Z3fbYSyvY4nZX3+IY-+jWG+j04nu2CoWZ3hb01mKZ36E10uOHnTOfI3WGDnCZ3Ar38n0ZDnS3EoW3DIUQ0aCpCtKJErS3Cn8JvIOTSG0GD"
-"+7746774E8nAEu17ojq01KY3jVY-BrZIBrJOCHGCmuGDGmHDm83Co8ZDoOfQVGZCtG3CrOJCmO3EmK3Em42SAQu2uKpCmCJDsS3Cr43EuSJDnODAD0GD+3746374GO38"
-"n038EG7GgTu25GIUCv4rOuGiVuG8ju-6weq6w0aCkOJCsWJEp0pCqGZCuCJDueg-iWHDpCZCsS3CEa6JCC3EqGZbnc2ApapDoGJDq0pDn0Z3Z6YsB7W-M2XnM2HOBvWb"
-"p8dT75G9E0c4+-d6Azd6eKZBqC3ErCZDtK3DEuS4483CIG+4MIt0iKpCsKZDmGJCs8ZCnu0PV8P6502DmOpCq4JCvKZ3+l30m4kAAhl30KZ-S2XnS210vu0dG4IXgHt0"
-"0aZ3uyZ-BeWKBe05ruoCr43CIeL3EubI0WZhlt12qOJD1t80muWDNWGDrGZbd602sW3EEGpISWpCqK3DnCZCQV62+7A467A404Z3t2a3a5bQd6W7NrW-okWIokW3EM10"
-"t8nn8X1DuG3Er4JCgAx2SK3DqaJDm4ZCE4i60OZdXB2CpOZCqSZCpWJDnO3EmujYu0WD+VA46VA404Z3sqW4OuaRf6W3VB20nu03ZuFNDO4NDuGhku0tlW0DnOZ44fa3"
-"jAYZqkGWpZ0Et0Z34zX3-dZaqJ00ru0a2H1Et8JEqCZ4vaaq-x00sulfGOifGqMAoHx2IyU7+hD6IfD6EOL3Eue3S0ZCv83EoGJDEuT4AAQ00KZ33239p4JCvaZCsGJD"
-"oOfLDGWCmuWgh00EECs584pDsum+Teib60WD+7A467A400Z4Zd00uONH3u0xJ00E+Fq06Dq04SZBI4H84CJCE8L7CSJCp8Z4xWWbKr06qOJCta3DtuGHQWGDu0Z3i8aY"
-"lk00sumri0mCECA4C8pCoOZ3gTXpb6W-U2XnU213nW38mum58Otf14G904Z3VgX-zxWGzx01jOZ4sb03mSZCoumROGGEu8xvsmHEnOZCr0JEqum7mGGDtOvbLW1DuOpD"
-"uO3CEGkD8WJCpuGFeuig1uVfGOSfGu0u9uGB7f6b60WCI0QF+hl3Efl3SSZBsGJCr03DEKdDG8ZDqCpDIeS7Mku2aC3EuW3DmaJCpSZ3dLX3ArZYGD09rCJCrSJEtaZC"
-"qu0ukeDDD0WD+JA46JA44a382wl3E8890WZ3lkW-7tXF7t14tuYDtCZ3iF26va3Dn8pCruQf102DnKJEmO3DuWZ3GK31nOZbBD09rO3Cr8pDvW3CpuG6A0WDMdj30OZ-"
-"a2Xpa2X3IZaSxWW-K4YOK42GsuICqS3Dr0JCuKpCu03EtOZ4+1XcADW3ZNKef00CE05CUERC04Z3D+a3Gf04t0JDvaZrkF10sulVGeiVGu0mSfNSV8n3X42p+pq02nq0"
-"GqIDk0JC1vD1maZ4VX31rSJ9eQfG8uGyH0GCEWp54SZCE8cLU+0Ci0pDp0ZDnGZDs8JCt4a4EZf1+t746t7400ZZ1XW3WBY-0XWL0X03uuYDv4SN483CE4m58aJEueQR"
-"kmWDoKpDE0IN0OZ3J521nCZbrJ01qOZ4Xo24vaJEtCZ3AXWrnqW-+1Xo+1H802GC1ddQ2XW3tLX3cib74XWKRMX3Qcb3ZiY-DeWHDeW35523sCJEnuG1Y1GDEWW700Zb"
-"R73CmWJDo0JEvCJDv0pCruGWFveO80XCq8ZCs81WMXWCnWZ3MUXomD00tuldGOidG0mCEa74EeV7gTS00CZ5HGHC6xFRke2Rk02Dk0JEtCJEmaZ34xW4jJZfUi28r8ZC"
-"oGZCt83DEG620SZclk00puWRw0XCmW3Eoumb210DMt+40SZ-W2XnW210uuG7IuGBMfsf100EXiC0ruWeGu-2Aup2AWGBouIHWJ1EvaJEpaZ4hfK8eQvl6WGDu0Z3ab55"
-"nWpCnKJCYI99SOJCnWJEm0JCE01C48JEMJ990SZ-c2Xnc2H9ew0NDu7g1uFFNe5FNW1CvGJDp4ZCEyqJC0JDrKZ4e2XbEe01qGZ3HM11naJ8iImDsufz4m0EqO3CE4kB"
-"40JEEOTKMFx20SZ-e2Xoe2H8Zw0GNesf1e1ONuFFNe4FN0HCkaZDruGpQHmDrumD-8xJImGDp8ZCEuIGO8JEsG3DtSZbDe05q43EqKJEIy13EKsCQxq0+NA46NA4E0oM"
-"wLA4EG1C1-h-qJWGqJ01ruIWu10EEGUJ0GZ3fr30neAJ3GmCt4YSEGfNEeP30CZbVD35r8pCqKZDEKWMCWZDp8ZsCL60tuFfGOCfG0GCE8hIEGyQknq0EW6H1lf-bdWH"
-"bd03suoDv8nU5nHEpKZCv8JCoeQOpW1DsCJCmGJCE0FN48ZCUQ4HCKpCrOZ3rA42vK3CE4SAMFE60SZ-d2Xnd2X3lBbUd6W3eHa-c6WKc60GtuYCuKZDpGJEuS3CrOZC"
-"rKZ4edWc0X0CmG3DsS3Cn03DvW3CquGGkeuZBWXCpSpDrO3DECfJEKINMlRC0SZ-d2Xod210tuGw9u0icvcJ30mDEut7+he6Ife6IGJ3iS3Dra3Dua3DmKJCrumo8fuY"
-"QWpDoWJEn8JCnK3CvS3CqKZc6N44mK3CqCZ3Jd53o8pCnuWhk0WSY0rREuoR1G00AeISfL13QSmRI8pR0SZ-a2Xna213o0IEWuG0Ofse1u0Aru0O8u-b68qb64IeK8JD"
-"q8JCt4s3G03DqCZDIMj34OZDEurC8GpDs8nUZ5M4AQq0uGZDtWJCm03Cqa3DvKZDvezw4uVdGeSdGu-t98-t9um6XGWDq8XHRnWCmGZDXtifkq04qCJEnSZ3v114tapD"
-"nGJ8pf8g1GHDp8pCs8Z3Tf33mWZDsumvGeSI300E+t746t74Eq+40GZ369XQAD00ouH4Ku-E88qE8um7IGGCq4cGEWc34SpDEqwBAkE1CGpCqOZ3jq05pO3Dp8ZDEqq2"
-"EAQ0E88TG4ZCn0ZDEuA4Ee99EBQ0+Z746Z74IKXQ1hcQY601nSZ4yFa-+6ZI+6Z3Td01pKZ3s-57n03DoO3CqGZhTdW3Taa3zA25pGpDoa3CMsLA8KZCvuW7bv0FjWGE"
-"r4ZsFt10uuFUGOCUG0WCAU3208Z-sWWOsW08vuoCna3Do0JEEeU4C4JCoSZgVd03qS3Dmu07m8noJGWDmOfE80mDIeJDSS3CoOJCm0JCEy62E-q0+Z74AZ744a38E8dI"
-"sDdBEq52EuQM+7F125F184ZBp8XKc10CEiiACW3CuGJ9dQv7IuW0hum5mu0zRG0EtevqEG1DtKZCnCZ3eq51tSJWzBTtO00E+Z746Z74EaM5EuR2gLF1Ei47XYX-XdWH"
-"Xd03tu2EuuWhWuWZrH0Dvu0t3PgF8WGCtKZ39PY3AFd3EYXbU810rumMTnHDr8JCoS3EpuzkO00E+d746d74+ZABsZABKqIDkSJEu4Es44pDEOcP4W3CgQU2EaQO88pC"
-"su0DqX0CrOZdEk07uaZDo03CuaZ32g60quGU8uSz4uVUGOSUGuWV55sAgvq0EWuC1El-EDWHED04pu2Ev8Z4tF26nO3CqSJDp8HPM10DIIJ30GZ37td3Pu40o4ysQsIK"
-"0KZ4lG10n4Cr84JCvuWcM1WS6Nj30WZ-w1Xow1X3lNYVGtX3qad3abIoRg2aFaG0EK-VEy3JPCY-imXAim13j4ZBvumNW5oM44pCEme65-hc5910su0DruG-IHWCquW2"
-"r8Ppi00DEeh60KZ3qy60vumNZOjtO00E+3A463A4EioAwfS01CIEcwKo1G0DWu0ebvFzTe4zTW1EkGZCnGJCESKPG03Eva3DMqjUMUS0X5C2oGZDECUR04Z3K2Xa7704"
-"tOZCpOZ3AxImUJWDrOD3K00E+RC46RC4IG2H+5zJIiUTIWO8fHf-nDGVnX1Ek4ZDrK3EEiGK443CI4dQcc820KZ3sF44s4JEmaZ3U8Zc1W2Cq4JEnO3DpWJEpSJCu8nD"
-"6fyE50GE+VC46VC40SZ3vzHe-ecu68niLuGgQu-f18qf1W0DkWZ3GK69r0JEu43Et4pDu8n3Offu6GWCqum2mGGCquma21WCEi-GEoC40CZ3oOa3H260su0ZhODK30GE"
-"+pC46pC40GZ3tOY3eeZQd6GeK0GC1KW-AYWHAY02ouoDE41MKC3CtKJEpuGkUfACAm0DoG3DEGY9KC3EpaZCsuGfZv8g18XnWnmCuaZDES9OEGlIE-q0+pC46pC4MO15"
-"Eq0UcvhIMO15483C+-q06zq0E4s5O4ZCr0pDoCZ3xeX39Ieaje02rWJEEuRRCSJCtSZ3pWebkG44qKJDmGZ3s5e3gb10vej0P0GE+ZC4AZC41wk3IjYQZ601nGZ4q260"
-"qqoeEH6244ZCIWA2HCY-yQGty6YnO83DoWZDr4Z3Pb20m819WfOtLmWCsGpDE8B4KKJEsapDtePCOnIDnWJEnSJEtS3EmaZ3T5Xqd310vu-vGOyvG0WDEaFNsre41CY3"
-"PsGosw4n1uWX9bX8+FS0kCS088ZBvum6WHnCmS3DnGZ4HoXf0Y00tumwQm0EoSJCEW3M483EMsV5EKPKESr68a3EvuGhjeTs6uV2HOS2H818avmyQucZ3u0COvVTc8LT"
-"c4sQEWnDEq1AGS3CuKJEQoAJS8pDrO3CqaJEECO84apCECH6EIj144pDEC850SZ4HH10mum7RuCr6uF1HOC1HeeGTvWAfvWP+bsQ+dq0kaq004Z3z132q03CEKMZGSZC"
-"uO3CgA55IquF8O3CvuGbBGGEuu9hC1HCqGpDoumV8G0EpuGGbOT45uF1HOC1HuGDF0WDEqJIgbq0XSg4aMc-bjYIbjY3nPe3Xb50ouGjn00DMig4Qw728OpCtuGInHXD"
-"p8ZDraZ3MlZYDD04qOZDtCZ3oN60pu07+umfJvSJ3uFuGOCuG8HoB0GCwXQ0Eu72IWOI+hy22fy2EWZ7EelI08Z3J-71tCJXxguM8W1Ds43DrSpCEWG68S3Cuumtseue"
-"1WWDnCZ39124uW3CnWZ3XCdrADW-y2Xny2X7BL30nusI30GCESnD08J8cwFf184f14SbE4K8EesY04Z3u060tevrZXHEvWpCtW3EEChS84pCvOfZS0GDE0mZ4KJDE4Z7"
-"443EI8g9AZq0443C+dB46dB400Z3ixWUIy00muGtGul4F8b4FumaqHHCqKZDuOZ3p2f35MafWd04r0pDtWZ3gLf3gi20re95tumWM1mDESEa08Z38Rb3Ywdqe6W-w2Xn"
-"w210vuW1BfNu90GEXXa-XdWKXd03suoCtuGfLwmHu0HEra3EsewwKH2DuOJCm43EvKJDES1W0KZb8kW3fL80ruWoH1XCnG3EteTOIGGCmulkGOikG0GDXGeUfS60r4Ck"
-"+ZU2MXU2OaZBmSZCnKZ39q85t4JDrO3EgYU2EeGZ4CJEEyOW0SZ3weZdkN42nSJDIGKBCOZCvKZskC21n0Z-03Xn03X4PgfUY-X3zYZ3DqY-18ZI1830juGvAHmCtuGQ"
-"uW0EsaZ3mEZgJD02oOJEEiJ3GaJDmWJDEmH9IIG6EyRD4OpCEmZCCKpCpOZ3s4aqxJW-a2Xna2X3ljW3w+aQIkW5KD20quVH8OLH8u0+O0WCIaFc8O3EvuGfEeew9u0x"
-"sG1EsGJCnOZ32Z90mOv-nG0Dtu0y511Ev0JEsuG-LQDfpGGCmulVGOiVGuFJ3eFJ300EEiOR0OZ3QN71s8J8f20EgUr5eKZCoCJEsO3EpOJEIaXTIkq0E8r50WZ3SG30"
-"quWEou0am8zI3uFXGOCXGumffeNd6umfGuGLgvFaBO4aB0KCk03CpWJCs0ZCrCpCnOJCsuQx90mDI4s28a3DmuWuQuWx6geED00DEixMOGpCmCpCo4Z3UDbqwq01n0Z-"
-"52Xn5210ouGx98XQXe6z44SdEiXHUWoKEfP508Z3gXW3J3X-h2XGh211quY3eF11n8Z3XF63r8JEpuQ-UnIDqSZCuGJCuK3EuOZ544dZD70DnG3EuCZDnCJDuO3DoKZt"
-"TKW-h2Xnh2X3rk00qu0Uhe6p1uGWD81dhuFg184g1uW0zn2DuK3DnapCp8JEu4ZcKy82qapDEuBcEGlN8SJCqev1Q10CEC9MW4JDvWpCs0JDpu0t+9z55u-gGeygG0GD"
-"E4QKE8e9gHQ09K20nuGCPuF+Ju3+J0XCk03EvumSrmnDs8ZDpOJDt81N-00DIM77KGpDmaJCtuGm7nGEtaZDQw0F8K3DouG0Zw0YNw0ZtOzhQGGCnu-hGOyhGu0hQumd"
-"7f6g1uGuuuVND8LNDGmCk4yj8aJEnum78w0T210CEqA4QQQ000Z3wc23saZDt8XTaQv6UWIDp03CvaZCnCJCo4ymMdaO04Z31EXCAVg-GPgXGPQ83A18Uesf1uGjCvGe"
-"LuFQ8O4Q8uGdLu0d3Y0Dm0Z33s81qKZbZ604s43CqCZ39QA1vKZ38ZfbAe01qaZ3GQ72q43CEKOS04JGDuyy4uFJcgCJcwG8i10EXKgQZ6G0au0eDc8yE162IS77PCY-"
-"ogXAog12mu2CEimF0OZ3qi43mWJDpuGt5f8UDuGccYWDuaZ3RX21oGZ4aUfYRX04oWZDsOZ30S80uu0fnvGuQ8Tn1uFnGOCnG81cW5w4gLS0443DQiPDgPS0EK5g+7y7"
-"I5y7q4ZBoKZDvK3DvSZCsCZCEekeXEZbGh10qu0IN0GCEyIJ0WJO9h9EK0nCnWJCtumu21nCo8JDnuTs6uVvGOSvG00CXn80ouWV-e6p18HhNuWyaulD58bD5umrF1HD"
-"mS3CmuGnz0WCEK12A6t000Z3o651s4Z3ey24q4JEuWZa0zW3uoZ37P13v8ZCtuG6kPTcDuVRcwSRc6MJE4z2gLQ05GY3j3JQnvF55qB5E8q3GKpCpSJEE4URG43DtKJD"
-"ggCC4KpCEOQ5SapDmS3Ep8pCECZFAgH10GZ3QAc3isY3eP40pu0LU8j65uVwGOSwGuG6F811ffMg14ez0CJOtv-W8uqW80YCmS3Cp4JEmKZ3wn11v8Zbs788mKJEsO3C"
-"pC3CE4SgIuFBEIQ08apDvuG+hu0QYHmCpumyDADf1ulvGOivG0mCEquAwnzH1GY-03XK0311nuY36z63nW3Cm8HHOH0DvewI300DEGMSGSpDn4JCE0J6Ey-4AUQ0KKpC"
-"tSJEvuma4v0LguWNP8zf1uFmGOCmG0WDEuV7wbI60OZ3kAX3rrW-BDWGBD00pum2v00EE4j6CaZCn8Z3vhg32XWbIl03qCZDpu05N9HGx1WDEi9JEYQ00KJm93HCnCJC"
-"r8XqfeDd6uVnGOSnG81-Fv0bwesy400EXWg30zW-e6WGe6W3hc22oGpCEC4TOCpCsKJCp0ZhUNX3OA15uK3EpOpDISWKMM42CWZCr8Z3SFe3OvXt3O90nu0Pkul7Feh7"
-"F00CIuT5svYMIyW2+Vu5ITu50WZ3-qb3G110ru0c4XWDqOZgHD04rCJCnSZ34X20rumI6vWuKfOK300DEK-54C3EEaoE8CpCuumLAuS+4ulScQjScwmEs1mCk5r0MKu5"
-"+pn8Inn8EqEE80ZDnuWYQIWDruWnYQXrpOPFDGpCtS3Ct0JCuWJDo8pCpu0tofeg1GGDoum1556lI4pIQtJ3+ZdfAZdfI087wTv20aJWxxV7Z8L7Zm1EkaJDnGpCqume"
-"aw07L10Cb9bbe606qSZDs4ZDtumScWGCpaJmOh8g1WmDsWZ3Hh15vW3CvGJCISlLIBr0+3B463B4EyxYX9ZRIDG0au0TXulFD8aFDum5KGmCmu0vhLIE08ZcKk02r8ZD"
-"E44COWZCuOpCs4ZcjdW39b91o8Z35G34vCZDtOZsjgX-yPgoyPg4Oj20ou0aRfcH8WGCm0Y3f211naZ-b6WHb602j0ZBEu74CapCp0Z3FL11nGZ3eAdY72X3eye3-BA0"
-"puW4j20DUsR58OJEruGtC1nDvKpDq81ZPADI3uFSXOCSX4YV+nY4IiP5IuMSffaJ-M10mu09FuGanbm8+lA4giA44CZBEit5O8JDm83EmOZ3qZZhJ621sGZ3vuP8CZ0E"
-"uCZcPd24qC3EsaZ3WYW3Lv30ouGA7ADp1ulgGOigGuGO0gtmL4m8cyP5EbS0ESf4P8Y-87WC8703vSJDqu0fs1WCESVA40ZDI4S5Q+N3E052COJCn4Z3Cf50mu0RPg8t"
-"6u0HvGWDpu0AD1WCclEd04Z-DRgoDRg4WRbU9700nuWDoa3gEfS0ICkaPCY-B7GFBZGBnuY3RV41qWZ3Ud03vGpDsOnyGO9g80WDEqUj0WZ3RFB3s8ZCouGG1f8p1W0D"
-"vGZ3ej90uu0ePIGEvuDqcu-ycgyyc6MSwjS01CIEdwao1uFb386b3GHBru2En8Z3oYA0tuWHZGWCmuwBW0GDIaxF4CZCEOsV8WZCnefea1GDEGVm08Z3T5RW6OTpr0GC"
-"+VnfEVnfE8c7+T2DEq+FEypf0OZ-7SWH7S02j8ZBManf8a3EtuWvrImDpeQzd12Do0JDrW3EvaZ3lMA0pumqJf8T3u0yDm0EqWZCIeKn48JCQhd2+hnfAhnfEK3I04Z4"
-"8ldQwfG0buWDiQ1i8uaT34Yo00J7auVG5qRGECwSESrZCaZCvGZ3diX3K6dYRg02r83CEWwNEqn48a3Cqu0HPeun1mnCrOpCp0JCuuGZ33WDIuJRE-C2+ppfAppf0aZ3"
-"gRYUZfI8aw-AOwrAO2nCkSZDru0XzvW872GEEKsDE0Z5MMk1qCJCqGpDmGJCmC3Dsa3EU2mOXc83nG3Cn8HDxwWQH8jg1ulgoOigouGe2gNv6umYgwmCHasR+lq0zj43"
-"j4ZBquWm9X0EvKZ3CQ72q4JEgYgCKCpCu0JCvu0ogIGDn4sYIwY5EWdPCGpCt8J0oG0DmuG8E8zf1uFDHuCDH8nVt8NF3BHaFu0XXv-rNOqrNuWDHGnDq83EoCZ33m51"
-"oOZ3XWaZrJ03u8JEvuGDA0mCEir60aZcdX02v4JEEW63KK3DrCZCseTV1HGCpuVlXuSlXO8f1GGDWOXVXv-e1Ore1GGDouWrgX0CnWZ3zJ20s8PEg4yL56F2tOpDEGlG"
-"IUq00GZ3NO80uu06x0nCo0pCtezKl0mC+FJ46FJ404Z3DbX4ZrYQVXG1b0GC1Bi-oJWGoJ01muY3F0Y3wCC6vG3CoOJDsOPf1GIDnOZDpKpDnKJEEiZFEet2As32S4pD"
-"n8pDsG3CXX41sWZsL-30nuF7dgC7dQ1XPwmYWOsz9vW3Wu-e1Ore1uGAK1ZCrOpDn0pCvKZCnOJEkA8ZEyZeEKWA8aZCn8HF89fJ30HDnCJCpu0o411CrSJCo8EF8u-k"
-"XOykXu03l4MKsbiiImmEEyfW+xq02vq0aq2EkKJCuO3DpOZ3Yc41qOZ6-6Ybdd03s43Cru0i9nmCt4JCEWzZIkQ0Eilk0aZ3qA30nuWum00CMNwS44pC+-R86-R80CZ3"
-"HoZ3lIcQKD00q409+dQ0IbQ0CaZBmOZ3qS80nu0w9uWU7wwPZ0mCEuik80JEu42u0OZ3oFZYyJ07rK3EoCJCn4Z36721nWZ3-hbqedW--6Yn-620r8X-Eu0iGeMg1KG9"
-"I8nk+FeC+CeCEWU2E0iYECGBEu+UQYN6GG3ErKZDE0hH4SJDE4zD0OZaCD09rGJDoGZCm4JCru0Oe00EInq04mpBEizPYO5sOmpSq5sPbzb9wf03saZBouWLH8XBp4EK"
-"Eyg7+K20Q424Sm3SX9NPkHdFE8KCDiG4Q0YRbX7T+qICyyI198YRePo8n81cNN0M5Z90jKXEoy90IqEsDGL01KWD1820Wu-8pOy8pu0sD0GCEC6OgXa01Da-7GYK7G22"
-"tu2EEG8LEW23Ee8LosJUMGWiEGX3EqQsX0jZmFW3EZB3s8JCruWqN30DUJc5+Ndo2NdoIexBEiqMgLQ004Z3wza3B5HQjtrN94W3hjb3-HQ6ZuleFeYeF0ICkOJCt0JC"
-"s0Z3Lf40sumQ5fAIH00DEe-VEaV6EOUBE8pFEcS0WKpDtWZDuWJCvuW5VvWzReSk5ulHHOiHHuWU01WCEK4BgbS0Ia8BEyoK+pV36nV30KZ49j80tu0-hG1Dm83DsWZ4"
-"lBXbWk17rK3DoKZDs4Z3YpD1v4ZcKrZ3wW10ruGdVGmCmuW-+0WCI-HA+RK46RK4EGD8IGRJgTQ0IC3RE09B+VQ02TQ004Z3nb34ua3Em4Z3By92uGJDgQ06KCZDn8JD"
-"tuWCkw0rLwfO7GGDquWcCXGCq8Z33bd3NeeoDDW-85Xn85X3uWZ3ZqXQb6G0ZuGZiO655u08OaX8+FH1zEX3-5Z383A0rumZq0GEE4MlIqi2MM734CJDEm+rOa3Coa3C"
-"oOZdAn92rKpDEirCXaF2pWZCEm79AVS0+pM46pM4Iis9+rj1IijNPlhJUR00vu0o8an8+lS0ziCDtuoDsa3EnK3ErOJDv0Z7p1kbtK01paZ3KIC1uWZ3C2f3GJdbph00"
-"su0rK0GCIGl24CZCQZp4+tf86tf8EG+304Z3r7kQIEW3r6X3tvY-sKWGsK01muY3g-A1mCZ3jUA3vGZDsum0uOI0C8JC2uYkZxmqIv0RSwWadHGDqufJi11CoCZDpumX"
-"9n0DqGJCE0E8Ahs0+ZO46ZO4EWy2IeXJo1Q0Eu4R+hrsAfrs8qoDku0tX01Dv0ZCt4IT4S3DI4nFQ2H1O0pDpO3EqWZ3sgC1sSZdae04oWJEoKZ3Sw72u4ZDIq9dARQ0"
-"+FO46FO4EeWTwbz3EOAfE8Y29Vj-gJGdgpGBsuYCEGeAaGZCp83DpWZCmOJnrQvw40GDEqEc04Z3fAi3P+i3EjZY9l00qu0hWm0Dv4JCImK7EOmNANQ0+3O463O4EuaL"
-"EiGAoLyY1KY3SXW-5nfI5n93tu2Euu0myvWqDvG1ROnLRh9g1WXCsSZDs4ZCEqa54G3EEKuJAYQ00CZ3erD1tGZ3tDZ3RAfsBdX-W3XnW310tuGhKumdl97z48HXgvFa"
-"qv4aqvGAJ0WCE0bNGK3CoOJEMC65AQf1EWWJEOdXMCn9YgXYEale4aJEEGJX88ZDveTpZultGOitGKoewby2EKW8EOIFnjaCGVG01G0FV50IEeHIHCY-NKGlN0mCE8P3"
-"O0ZCpa3DpSZ3FekiZCg5ASY3jBg3VVA0q8P0AumdiGWDtu01C0WDEyJ7Qxs0+3E463E4Ei+B04Z3euYQkDGetKAF+FW22DW2ECN3GK3ErCZCE8HF4apDEyBrgUe4KOZC"
-"uOpDuuWhc2GCEqLPIYQ01m61v8Z3gMY35YgsFMc-BGarBGa38ZYU-QW47le3LlW-g6WGg6W3HF24pKZDs0Z3bqD3tKpCm8nP80GDIg88IOsgEaVkGSpDs0pCEOw5A+h1"
-"E0DGEGXq8aZCqumbkOTYIuVw39Tw3vGgs8dP8uWclvmzEuVf18Kf1u0I-wW6u01ErGpCouGeovAfxuWge3oCnSJCoC3DnCZcNrW3B267t03EvWZCvGZ3DSeqkGX-eFao"
-"eFa44lOmxfcz481Szul+vOb+vuGqK1mC1ch3fMC2uW3CkcL34OZDEuEmEClyG4JDmOpCMQF14GpDE4sPEuAT4KJDEqhaMZQ0+3A463A40OJO2hNz481d0vFz485z4WXC"
-"k43EsO3EEq-IKapDo8JDu810Fe9z4uW8Hv0Gj21DuSJEnuW5zu8z4u0F4pmCn4ZD1FA0uuj2dx-fGOyfGuFexOFexu0sZ0HCr0ZCoumVbmGErGpDo6rq4GJDE43dEKBY"
-"8a3Couv0FGnDvCJCtWZ3JMa31haKXxX8mhW9ivH01OYEUu-w39zw358zo5lFE8d4ISx2+788+488O4ZBn43CrWZ44Bb3xrchhdD1r8Z3aIA0t8X8PIGEs466Asq00CZ3"
-"f7e3msB1n4Z3-dbsb6W-f2Xnf2X3Huf4wqWQSQW3DTf3i2X-3XWH3XW3qp77t0pDsWJEt0Z3Xr41uCZg4X00puGmc11Dt0ZCqu0Inum5ze8g10GDXaA5rS3EqGpDEePH"
-"Mpf1+V+GIV+G0OJ0t9dJ38Xajv0Vqu-J38qJ3WGBpuY3MEf3He41sWZ3YMlhln93rCpCvuG9l0HDoGZDr8HGge8g1GmCuuGsE0mCEqew0WZ3wMfq4XW-dFardFa49VZR"
-"GD00n8nqawWH8u-z4upz4uWoem0DrCZDEO-NEShC44JDb1bbuF19pKZDqOJCs43Dpu0xUxm7rg8g1GGDoumPWXmCtaZ3+x30vejPluVv39Tv3v0dV8NEDO1z+40A+VQ0"
-"+SQ0EO-4K43Cr0JDnumBXwmULgfsEWmDnaZ3Csh3mo70ruWzHeOe10WDECJC4CpDEq5700Z35Cbr9DWta520WaG0amZPb56Tr9NP+eG2G4H0KmZSbD6TpvZ50m48WmpN"
-"+K38u0ICo0ICWqICkmpBV95900IEWW38q0ICWCJ1YG0Fl8bJ0W2Fqb6RqL6P+03FlqW24mpBIz80un3Te9NPpXsRiHcFmu2Cq8ZDmK3EpaZDsapDmG3DyyI6U8Jn0G7F"
-"iLcPqzbTXncFmuIDnKJCqSpCoWpCtOpDt03CyyI5TO3D0mWSfT6QHK3HmS3Co83Cma3CqG3EuKZDqmpBPuH0v701Lu30y8J21W3FXqIBWGdSbL68oG38jqI6dKYGLKJ0"
-"1KmAW8tRlH78kz6PbfJB0008E7Q00CZYX600tuVe1uLe1mLBpu2CtWJCtK3Cn0JCraZDn4pDbr2CmCZad60Fp03DnOZDn03EpOJEu8pDp8vf1mJDnKZCs0ZCnaJDtCJE"
-"tGZDMVQ00KZEw5WDG700Wu-f1eqf1WHEWS38p0IDkTq0S43CWS38n0ID+Zq06Xq08rIDkG3EnKpDoWZCnSpCsCpCrWZfd60FsGpCm8JErS3CrSJEr83Eu8vf1m3DuapD"
-"o8JEvOJEr0JCqaJDMVQ00OZ-d6Wmd606p0IEWO38ousf10YDWa38p0YCW8Z-kJWFkJ0BpuICuWJCuO3Cv8pC1o81p8Zfb60FrC3CtGJEp83CvWpCuWZDt8Pf1GpCu8ZD"
-"o0JEv0ZCtOpCp4GDEFF10SZ-b6Wmb601n8J932mCkPQ01JB2m0oC+Rf1EPf14DZBra3Dt43Em03CpWJDv43Cp42gMkf1yGZDr03CqSJCoC3Dp8JCraZae60FrGZCna3C"
-"qaZCnKpCnOpDtOTJ300E+ZQ02ZQ0GS38m0YD+j324038Eu52+l322j324q2DXBDBr0pCnSJCrCpCpGZDgwq0u83EqaZDta3EuSZCvGpDseff1G3CtaJCnOZCoKZCq8ZD"
-"nezy40GE+RQ02RQ0+xq0wxq08r2Ck0JCqKJEq4pDm8ZDqWJEvSZa+W0FoapDnO3DrWJEnOZDsGJCoOfI3GJCoW3Ds4pDnWJDraZCsODf1GmCmuFf18Cf1WmDW4JQeecX"
-"B00E1G22n0IC+df16bf1CqICk4JO8G2EvaZCt43Ep0JEbnaboJ0BrOpCn0JEu4JDn83CEGy2IYQ0yGpCqC3Cu83Cn0pDqO3Cm8ZqoJ01p4Z-e6Wme606s02DWa38n8dc"
-"6WGEWGJmO2mC+JF1AHF10PZBvC3DqO3Dv0JEnCZDoaJDkgf1qG3CpKpDu03Doa3Eq03CQIF1mCJDvaJDv03CsC3CvKJ0reiG8GmCouFg1eCg1uWiE8uv9uGrEu-v98qv"
-"9GKCkG3EpGpDvaJEn8JEp8pDvKZ3-W00r8Pz40pCq8JCm03EuW3Dv0ZDYcf1q4ZDqOJEtSZDsC3Cq0JCMFJ34CpC+NQ02NQ004Z39k02q0YDkLF15G20oumiBulZBuZZ"
-"BGIEk0ZCvOJEuKJD1oB3t8ZCm4ofMgj3CGZDpaJW2pXCpC3Cm4pDn89z4mZDn43DmSJDnWpCuO3Eq03EMJF1+7846784K038nS38sOdZBm0CW43EIiW2+ZU26XU20XZB"
-"mO3DmWJCuaZCpSJCnSpDgA8408JmZHHDuWJEuWZ3D210q89g1GJDmSJDqa3DmK3CvSJEs4GDEJF1+B846B84443CE4220CJ05ecH84W90KZ4g2X-IDWGID0Gmu2CoO3C"
-"s8JCnapDr8JCsWZbfd0Fr83Cua3CrapCr83EtGpDs8Pf10XCsW3EtKip0SJeaPjpJ0mC+38463840WZXd8X3A9X-c8XKc8X39k0BtCJCqOJDvGpCnKpDE414AwM5qGZD"
-"sCpDnC3Et83Dp8pDEG02AwM5uOpDpWJDpaJEpGJCrWpCoeTYBu-UGeyUGW0CWGZ40dWT3D02q0YCEGY4+Jf1+Gf1X941oOZ3mpW3DE11t0ZcsW0Er83CvC3Dva3EvWJE"
-"n0JDMkI3a8ZCn8pDoCJEq0Z3ZM10uejD8uVTGOSTGuGs9u05NeMe1uWWBWGCWWZ-DQWIDQ0GouICvOJDv8JEtSZCt03DuGZgrW01s0Z3gq08n8JEnOJDsGJEMse1GGJD"
-"pWJCE0u2OO3EnG3DoCZrrWW-r1Xnr111s0Y37LXVfqW3MXW-fqWKfq0HvuIDoWZCqSZDpaJDpO3ErSZDosT2KKZCmGJEtuGkOGWDpePAD0ZCqS3Dp03Em4pCv4ZDQ7j3"
-"0GZ-v1Xnv112s02CM0c6gzq01GY3dkGYlBpxQ4G04mpNEK52Een30OJ3Zul8SeY8S04Ek0JEqCZDna3Ep8pCvOJDmeg-9mIDoWJEqG3CnKJDm8JOpAPM80pCv4pCuWZC"
-"mSZDtG3CUBa40GZ-Q2XnQ210n4ya8O38uuMo1eHJDuV65uK65m3Ck0pDoWpDtCpCoKZDu4ZD13bYSX05tSJDo03CESH6GKJEvGZCMoV20GZ3IZ19pGJEt43CqO3DqOTI"
-"D00D+N94EN94E4B6ozk3E8r504JeNulM8uZM8umEIW3CmaJDo4JEtOJCnCpCnaZfIK0EoGZCu0pCv0JCqCpCvG3DMcq0KK3CqW3CvuWoTG1DvSZDu4ZqwQ00qulbGeib"
-"GuVI3uUI3KMI44JCEmH50CZ3aX03v4JDu8PEIWJDtC3DpO3DvWZDq4JEsSZd5t12q8pC1z05oapCtaZCMZd60GZ-I2XpI211r0Y3XXWQqQGmMxWN8aCj+7f1T792mu2C"
-"EWG8eCZCm4pDsSZCmOZCM2Q0C0ZCvWZ3pM15t0pCr8JCMEq0Eec6GapDt0ZCE8K80aZ3GUXoA210qulYGOiYG0GEE859Eqz4g5Q0E0S7EGK3UyC6ET52Ies5ECU7+RS0"
-"2PS0WqYCkWZDoGZDou0xH0XCt4pDqeQ8AGZDmSpCmGJDnC3DrG3Dpe9sYW3Dua3EqKJEv4JCpGZDqCZrlr00quViGuSiG0GCEaj8ojq50aJ0a0GCECn3+Vh1+Sh1CGZB"
-"qSZ3vp09v8JDmWpDsa3CqOgj6WGDm4Z32e08nWpDqCJCpCJDI+V2q8ZCo0pCnOJEtOpCmW3EQ3N30GZ-u2Xou2X3sW00oOtf10GCEWq5c447E9t044JCICA9nLf-uKGl"
-"umIBnuoDr4pCoG3CqKZ3T522qSJCckS04OZDEql3SWpDrWZDo4ZCE8E6AEe48GJEpuWQN0GEE4p68GJEoez9AuVuGOSuG0GCE8670WZTB700tennauVS38KS3uWafW1C"
-"nOpCq83CEuA64GpCM6H6GKJCu03EEyO5GCJCtGpDESSAA6Q0KCpDq43Cqu0kI0HCsWJEqOD9K00D+pD46pD4+ps0+ps02os0CCZBqSJ8InHEoOZCtapDuOHQc00DIcA2"
-"SGpDo03DnOJEEmg400J9-heo1GJDu43EmCZCm8ZDoa3CuumsIeSg80GD+xF46xF40CZ32u10oONDF0mDI4X5+Jp3AHp309ZBsKJDnOJDmCpDnG3CoK3CIKN8M2t08C3E"
-"mumahmHEnG3Em8JDrOPWSWGDo8Ju8W0EuSJ8bgzW80GD+lD4AlD48C38n8H4P87KA0mCEKd20KZ-GWYJGW25jWZBtS3CXja32z03u0ZDnegg1WWCvGZ36q27mO3DoOZC"
-"paZbVC2Er8pCn8JEr8ZCu03CqGJDMtY20KZ-Y3XnY310vuGVSuWrBeM+B0GEXqi-JWYLJW25ruIDn8ZCXP15pG3EvKJEMSC9MAr04SpCEWZ94SJCEut38KZCrefdNGnD"
-"o83EnOJ8ZZWCoCZsJW20ruFvG8DvG0mD+XQ0443DIiW20CZ-zrWHzr02su2EEep3Eik8KSZCmaJDsegnaGGDquW9U0YDmaJCm0pCq4Zce31EoGZCq4pCmGpCvSJDuC3C"
-"Ile40KZ-e3Xne310r4ydsbN80KJXpx-cpeqcp0HDkO3CnuWbpm1EsGpCoOpDn8Xnae9H8WmCvWZ4gkGO7ImCue9z40YDm4ZCuK3CvaZ3iVXtCDW-j3Xnj310nuGH8e7z"
-"40GCEeXC+JF1IHF1S8ZBq43DpSZDE0h8GS3Eo8ZCbnabpJ02qS3DEaw5SW3EmK3EuKpCMUZ7qOJCpOZDo43Ep83EqSJDQdVC0KZ-83Xn83HOCfdf146J+NQ0ILQ0GqIC"
-"kKZDEqm5W0JDq83CsKJDmuA-EuW08GIDoaZCo83DuW3DMsq00GZ3KW28maJEpCJDsS3CE8x5E7v2+VC46VC4Ee6EwPQ08a38vulf1ebf1WnCkO3EoS3DECw4G0ZDta3E"
-"kI15q83Dr83Dra3CpSpCmCJEE0l8EUJ3q8JEqa3Eo4JEqa3CmKJCMtz70KZ-Y2XnY210uKoWoD15IqgBXra-xMXJxM1EvG3Cv4JEmSJDs8ZDuSJEIei6Mgf10CZ4se38"
-"u0pCqOZCvWZCMEF1KKZCr43Dr8HkL00EEKCCM-32+ZA4AZA48K38nuWui00Dkzu21KY34FZ-mRZImR30qu0QpWoDtKJEp8pCna3DsaCdMcQ0GK3DvW3EES5CGG3DrCJC"
-"Q2r00GJeSHoCr0ZDuKJCnaZDM3r00OZ-72Xp7210numkL8NK30mCEao8+7r0M5r08GZBu44s4S3CE0PCCCJEp4ZgbT17o4pCva3CuaZ31Y01oCJW3h8+4m0DvaJEE4dE"
-"KW3DsKJDtuWGReid60WD+d84Ad84C838nKJOg8NK30mC1KYUdT11o0IPrvFQNe4QNGZCkSZCt83Co03EnK3EtumQcumPNOPT3uGlu0YCuS3Cp8JCoSZeuk03u4pCqu0d"
-"N0HErS3DuuGuGuSp1uFhG8DhG8Xvxu6p10GEX6a-rDWKrD00ou0saWoDnaJEsO3DmS3Es8hopGpCuS3DuO3EtK3CrSZCoeP-JGIDt8pDv83EuSZD1CWsSKW-h2Xnh210"
-"qumBI0GCEONDgHb40GJ0Y0GCESND+7H6I5H6iWJDm4JCuapDvWJCnePDj0HDoG3Dvu09g0HDuGJCmuGYue86546UOW3Ev4pCqWZ3ctZrpC20suFgGOCgG0mD1pP8+fse"
-"10mDX0g3EYW-Y6WGY604jGZBr4Z3ZeZ39y03ma3DouwdLGWDmumhcuWnpmWDp8ZD1whYe603qK3Dru09em0Ds8ZCE8e2I7X20OZ-h2Xoh2X-HeW+HeW3cW21n8Z31q23"
-"u03Cvum2jO9c6GXCmG3Cv8Z4Yy30ruWFX8foVuGI4HWCnumoQmGDm8ZCESK9EZf1+dA46dA49oiTrk00qOnF8uFjB85jBG0Er817-WHEo83Et4ZCMCq5MUQ00KZ3DP28"
-"mGJEtKpDm0pCQIe9uCpDpaJDmC3CoO3CmWZDmOzwO0WD+hA46hA4843DW8H-0PNbQumEj0WCXwX-sJWGsJ06mu2Cp0JDr42SG4JEtaJCEmi3A6tAqGJEs0JDpCJEtOJD"
-"rG3EQgBECKJEpWZ3jKY4ID20ruW86vyI3uFgGOCgG4yR08Z3SrWQOQG0a81FZ8nkau45Z0GDIWG6+pjBAnjBES15843CrumIeWHEuaZCt0pDgIs5OKpCr4pCmCZ3cl04"
-"q4ZDtKZaKK02q43DEiDCO4ZCsWpCqWZ3uBap97W-A3XoA310nuWF8etyfu0xGuGX8uXiQu4p14GIEyi9HGY-XJYAXJ20ouGSa0mDE07C8SJDrumB-eggmm2DsapCpOZD"
-"uWJDnWZ3UHaaD709rKJCqa3Dn8JCru04D1mCMR820SZ-k3Xqk3X3E9ZS8y20p42y0CJDdwqo10WDEK7APCY-A7GFARnf8mnCu8JCp0JCpuGFqu0rE9IjE9JZ0uobEHZD"
-"taJCpaZDtCpDma3Esu0t8u8JAuWBnuWRMGnCrCJCvKZrTH10tuF3HeC3H00Df0eS0zG0b00E+ByAQ9yA8KZBn8nz7XGCuWZ32211qWZgBU37pO3CuSpCv0Z3oQ22qWJE"
-"QAq3Ieh2W0JCuaZDoWZDmOjdD0mD+dE46dE40CZYf600pu0m-ulQj8bQj0KDk4JEnaZCtSpDrS3DmOZCp8Bv6G0Cmu0RjWXCtOJCmSpDMguDEylJ0OZ34N31qGZ4NbXq"
-"Ts00tuVwGOSwGuVKAuUKAOHKAGICr0ZDmGZCmCpCEW+CEaFGAMF1CKJCrSZ3nq23oCJCquWZc8vk6mXCo4JCtWZCm4AP04Ztcr20tuVwGOSwG00CAI-208Z5op40pu-y"
-"BOqyB0qDkSJCqGJCqaZDv03EsO3Dtegy400DEisAYuQKEm-9Aof10KZ3KP41maJ8YYGDtSZsul00tuFwGeCwG8X23vGj4fM+B4G908Z57KY4xlW-1XWA1X0Cvu2DqGpC"
-"r8ZCpapCtu0RSewxVWGDq0Z3zo43n4JCnumhfOvc6mmCtKZDEa7KEysD4SJDEOi4AZz20SZ-i3Xni310sumAPum+Qe6g1K09szK60SZ5F4X-EbXKEb14r03Cs8Z36M30"
-"vuWe900DIyr8M+G44GpCEy4800Z3Ql03oW3CuePrBuGNq0mDEuVIEupGEWYDEhS0+-G46-G40OZ3dUX33WaQA7GOovGsIuHVD8JIB4G04mpN1Wa50Ea5G+W-LEGVL2IB"
-"puoCmSpDnKZ3lf52oOpDoUY58GZCquWqBn1CnSJEmOJCuOfY8GGDr4gES0pDvK3Es0ZCEOc2EpS0+VJ46VJ4XcZULEG0ZO7b3uGw6bX8+ZS0zWC3tu2Dmu0jB00CESs3"
-"CO3Dn4Jv6eva34+00OZ3Ot03mOJEtu0toue17uGdZ0oDsSJCmS3CmaJ8yxyn1uVDHOSDH4om04ZVq4X3s9b3YsGQlvaa3GWCWum8U57j+dS0zai3hHZ3OV15mKJCsW3D"
-"MCPNE6d208Z3iRa3AY40uuWe1PfLS1nCnKZDpu0221nCpW3DmumcFeCn100E+pI46pI4EOBAEGE4gPL1EOBAEeR3+RC22PC20CZ3Br03va3Cv4IDCapDv8ZgN82DqG3E"
-"p8JEsWpDn43ErCZ3GgYZfD03uG3Esu0ONXnDna3Dr4JEIhR30WZ-B4XoB4X3raZWur40nuGYM812iu-RAupRAGIBpuIEtO3CmSJEE4NB0CJ86v0zXeP1iGJDraJDmS3C"
-"t4JEt43EvOvJ30IDqWpCsCJEoGZ5IVbrD120uu-2HOy2H0WDIuNJ843CWe6K30WD+ZQ0YXQ0S8ZBtSJCsapC1-B3vWpDnOn2HOvf1mIDpGJCtWZDnGZDnOZ3qkaadzW3"
-"L740qu0WW01DsCpCpu0JCuiz4u-2Hey2HuGAXvGdZesf1KMT+JdFIHdF0qY3Kz2CoC3Cna3Eoa3ErW3CvKO+MA62GKZDsSJCEKs8GCZDnW3DE8M6AcF18GJDtumZ801C"
-"o43CpuG4bPT+4u-3HOy3H8XEcvmB5f6g100EEuF7EKs6+VF12TF1GGZBvGZCX071pWZ4GM50u8XbtOvf100DEOY8CG3DuKZ3J410qe970nHDs83EtWpDouWRTGGEmeTK"
-"+00E+-G4M-G4EC2DkTQ0IaW25OY-UQWIUQGOGW2DsW3EvSpDvSJCs8H6Re9g1WWCuWZ3Fb13mSpCm4cMIUF1CKpCv4Z4ng55q4pCv0JEQZ42+xG46xG41wC0quGYNesJ"
-"3409EunOfvaJmkW4jiJ6ZuViBeIiBu06RuWtYv0KNHGEmuWTSOPuLv0MUvGhUum6MH0CpumP8v855GpDmCpDq83Es4pDqSpDqOD6R00E+dG46dG444ZCI0ZF04ZTOi10"
-"ouGX8uW1Ta2o+NQ0wKQ0KCZDsCJDqu0TIGGCnK2SAUL348ZCEiLM4a3CE498EyyAMgs004Z3TO11s8Z5QOb3mVbpXXW-Y3XnY3X38VX3r7YQfDW3PyGOjvF458445WYC"
-"kGZCtCJDta3DtuGtJHGDs8H4Ref1AuWzV1XCq0pCnuGODu0nifeI3uWAFHoCvS3EvaZDoSZDEavJENQ0+3C463C4QaYFoTh1IecIE4QB+VQ02TQ005ZBvKJDu0pCm43E"
-"mOpCp0ZDgArQOG3EoOJCv8Z3Rv53pGJEsOfj6uGvSHmCuuGsPG0Cru06z8T1A0GE+FA46FA4Ea+4ESt8gnq00WZ4E6c-boZIboZ3LX49qa3Ds43Cr43Ctum0Peg+EWpC"
-"v8ZCuCJDuWZDqS3Eq8ZcMf27oSZCsWJDoWZ3JS20vuGEAeSJ30GE+JA4AJA4+FL3oFL3Ee7N8CJEruWGfvGxf0GEQsAA4K3CEKY7843Euu0JZ1mDEOu8A+E1Eym9EmdK"
-"EyVG4GpCEmYIEBQ0+p946p940SZ4S2XStWGOhvFb685b6u0sQ10EEeB9CapDu4Z3mab5iFXbak00rumKe00EEmHCEG1SQU-ACGpCnGZ3kA11r8Z3DQ40pOjGI0GE+l94"
-"6l94Ei5NEyIEgvE1IGk6+Jf1IHf1I4ZACCJCp0Z32IY3iK10p8nZSO9F8uWiaXWDmKZ3-q43n8JDqevmQ0nCu8JDtuGL5nmCvSJE1KZpDDW-Q2XpQ2XWWJa5d5c-OZXI"
-"OZ15jGZBpOZCEixHO43Dv0ZCpKZhc6W3zWY3d112nGJDEq+4MMZ7CGpDpOZ3D640quWDNG0CqeTJ3uVcGeScGu0WXuNDUu0jLu0O8OXADuayEuXJDuFp1e4p1G1Ck0ZD"
-"r4Z3YYd3Utb3H8da5r43r4JDvuWUDv0koGmCv4etAch1uCZCu4JDvKJCn03EvCZCreT0Au-jGOyjGuWM8eNn14m8sHS00GZ5HyW-37WI3702j8ZBEKmGeCJEvGpDrSZC"
-"pK3Cg6N34CZDEGrT4O3EES844S3CE8bFAcS0CKJCt8Z30S40ruWgD0WCEG0TENJ1+lB4AlB4EKdKIe94kvj1MutG0KZRGEW5eYG4ZuVtGeItGu0IAGHDnGZDsKZ4SnX4"
-"TccYS3X3cG76qapCv0ZCou0YDf9aDu0AxG0CquWVA0GCEqOR0mZq67W-S3XpS3X3dNbSq7a3RbX4sYa-iNXGiNX41Rc35da3OI32p03EEuW2A6Q0GOpDsSJDE487EGv5"
-"44ZCMwj6CGpDmaZ30V11p4Z3Csc3CIXpdDW-O3XpO3X3vFXSnzd-3fWP3fW3i749sSZDr0pCp03CsuWLcPwAUGJDoKpDva3En03EuOpCuumJSeO35m2DmKJEuS3EuWJD"
-"tGZugF71n0Z-O3XnO310te8deK09EOJ6ffaJTY00uu0XZan8+tG1zs04nuoDs4Z3c353u8JCmumMSfAs6G0DsuG3K0YCv0JEsGJCoOZbuDc3XI31oSZ4WwZ3F8YrQz21"
-"n0Z-z3Xoz310nuGXSeNyL4G9EeT3+F82ED8204Z37G56oKJCvapDmuGMq00CICBIMoa2CGpCo0Z39k30uuGjo0WCE4HWAQt0mKpCqGZCu4pDv8ZDq0ZtqN11n0Z-64Xn"
-"64X4luXUg6GRJvVg1eKg1u0O8uWQ+mHEqaJDu4ZDo48vA+h14GJEEOQOSOJCnKZCqK3EEaB9AEQ084ZDpuWn3n0Ct0pCEuE9MN-7443C+FG46FG4IKMEE0E4kPY2Eu+2"
-"+RF1IPF1C8ZBvaZ3fO21vaJ8uWmDpCZ4OU10r8vbD00DEG1Ra4pDuapCq0JEt8Zc3413sCpCouGGK10EEO03QVRT443C+JG4EJG4IqAIo1K6bjK8CxFGP84GPWIBsuID"
-"uW3DpOJCvum58XGDm0Z4ekYbqJ01sSZ3Vs27n4JEn0ZCqSZc1H50qu0Cn1XCsWJEpuW-reDwQGGCmu-1H8z1H0GCEKcFoHx2EKE4ECY5+JVGAHVG0CZ3fP67tSpDvOJE"
-"qOZ3UGd4X6Ybg600rumMZXGEt0Z3Kk62pWpDQgx2CKpCs4Z3ie44rSJDq0ZsIr21n0Z-h3Xnh3X5SEaUXA50q4YpXyg-LDWILD04qu2CqCZ4Qa80vuW6ZGmCveAyQmGD"
-"sO3CEqBCOCZDoGZCsSZbqd05qGJCpC3EEm16GKJCq0pCMNqO443C+tC4AtC4EmMREak3kPg1EqLM+7L6M5L604JOKXmCrGZ3rBY47XY4TQYbKD03pSpCnuWXmHWDquWg"
-"Nevzw0IDpKZDqKJCuOZ337Y41IboEy01n0Z-m2Xnm210q46BEmACgbQ00GZ30lGmdQ1QDuVHD8JHDWHEoGZDt4JEE8wCGOJCmapCE0n3Qcl6G43Eva3EEi+50aZ3oCYb"
-"N91DpSpCuWJCn0JCs03EoSZ337Yqe6W-t2Xnt2X7+MZSu6K0buFmru5mruWy6H0Er4uYE0i644JDES12Asv208Z3Xv57tCJEuaJDu8Z4lscYTk00r8XL0H0Cuu0SAHmD"
-"vuWOGwif1uGQkulBGghBGAnYDfdJ3K09cqv2QPB4EGxA+BLEA9LE04Z3z034vWpDmKZ47o71q8Z4NeWbnD02qC3DEOpBK4ZCsKJEm8AmBGHDmaJDpCZ3p642vGZDEiE4"
-"IlS0+RB46RB4UeFKsTX204Z3vbZ3jpHgRuKp100DXwJ6ZulF5qhFbH92pSZDEGdCO83Dr43DpaZa9s02p8pCI485EaWLXcWdjX22rGpDEWv3GSZCsO3EQ-d4EaPA+Jv0"
-"wIv004Z3KlY4TbXQZR00t4W8EGJS+hO36fO3OWZBoOJDt0Z32Z31r4Z35EagfG13rapDruWgBWWCmCZ3YvXcdf42rKZCEqEXK0JEuKpDnu01O8zS3u-sGeysGKogwzJ1"
-"Eiz20WZU0LG091GETGY-qDGVq1GCEqrD843Dqu0DFvm7sP1IlfP0HGpDqKZDtW3CmSZDm8ZDvOfNWGJDqapDq8ZDvWZDsa3DpumE29jp1uV0HOS0HKsKwrS05GYWCSW-"
-"B7WPB703vKJCou0LPuWQ31GEMa6DQkS00CZ3Jw31p4Z6NfcbzfW3Lu20sum241XDuO3DvuG0J8zo1u-8HOz8HuWHg8t7d4McE4aO+RB2APB21dk39H74nSJEvKZ3PNZ3"
-"DYYYzfW3cg01mKZ3B390uumIxOvF50HDnS3EruWex1WDIWhSMdW844JC+-H46-H40SZ3ssKm4R7w6uGlvvFf1e4f1uGOq1mDEGNHEq+2883CpugT5H3Dr4pDsCZDuaJD"
-"nSJEtu0wcuO9CWoDtCpDsGZCr8ZDsumaA8j8WGGCnuF7HOC7He1ktO7B020CMWv30GZQPf00uu0tSu0yoO1VAuVv6qTv8qoCkuGI3wW0MWHCuSpDvWJEIS+50CZaUfW4"
-"Za41qSZ3BL21oOZ40OZZD707qO3CuGZCoKZ37C30s4a0IlH1+3K4E3K4EygcoP+5IqL9+J2GIH2GaOZBsOJDsSpDvCZ3JY01sKZ5GSec2R00muWdtm1CuSJCu43CvevE"
-"YvW-1H0Cuu0WU00CEW7JMVXD44JC+-J46-J4I8UbwnH1QyJS08Z-4mWH4m04suoDtGZ3T993rCZCouWujuwJ30mDE4Z8EKfICa3DrKZ3bNZYFD08s4ZCnaJDs4JCEKJA"
-"4OJCQJi108Z-t7Ynt721r0Y32me3ZZWPGCg3cEe5BGc-1LYG1L21tuY3qg72nOJCEe558WJEnOn4OP9+40mCEynUOK3EuW3EoGZ3WZccMz09uSZCu0pDtGJCnumwgOTn"
-"60WC+-H46-H4ECdAE8V2szH4Mmm9Eye7+lQ0+iQ0Em280GZ4Xl20mu0An10DEuq2AAX2EmXdEGpPKO3Dn0pCsuGdyeeJ3uW9dXICrKpDu4pDqKJEnOzUKHGCou-pXOyp"
-"X0GDE82226iHICPM+-o6Ezo60KZ3qQY3AQ47vKpDt8pCs4ZgtJ00oumka2YCt0JCq8JDrKZdVOZ3zt64u4ZCqaZ3qDa3GZep6X00oul+GOi+G8HqGGWCW4U604JPguKI"
-"K4G8E8gF0aZ-XQWHXQ00mK8+8GZCpuW-pXGDrWZ3eMXYED02r43DEmALES9AIu2RIEF1O8JDoK3EvaZ3X551oGZ4WjXqb6W-H3XnH310p8HGAA71F8Xv9ulNDObNDuGn"
-"VwWqkuWnNXmDtCZhuUX3m5g4b370ou0ADu9P8HWCpuGyNIHErSJEp4ZsPi50nul2egi2eQXEDW0DWKZR7yG2bu0NDvFH8O4H84icmW3DsSJDsapDoCpDoKZc-W04uWJD"
-"uCZ4wH52q4ZCEKy2Egf1EqqJCOZCnOZ3OF40suzpSuV2egS2eAnv9fNf181AFuFf1O5f1m3DkKJEmS3Cn4pCt83CpSZCkEQWCK3Dn8Z3Y161uKZ30Gc3FhdYf609q8pC"
-"ra3CvWpDvu0tGA+G8uVhGOShGumINu0fX8tz44icEOS5USb4Ivh1I8OJ1OY-pDWGpDW4k7Y3CJ22mapCEG2I08ZgNE24qWJEvCZ30xZ46VfcB782sOZCEGGTG8ZDtK3E"
-"EKK9QRx2+xA46xA4ESrG4C38oH48E0O3Eax8+Bx229x284ZBquG68vm1U0HCpOpDnaymMsH1uKZCuOpDtWZCn4JDvCZDoOfiSum7C00CEOVB4OpDEm3gUpL3+tA46tA4"
-"XjY-qDW-qDWVqD02jSZBEexIGKZDoSJDEu5O443EISBAMg48GO3Cp8JEIuoM08Z3EBZb9iX4JH12o03CE8vU0CZ4RJZpueW-UXgqUXg3UUf3EAYPSl00tu0IW4E4+tH1"
-"2rH1KqYDka3DtuWqmXnDmGJDoO3DMq5GMYt0GG3CuG3DXVY3FKA0oe9Og0HDpSpCruWn82GCEaOfQNqM44pC+JD46JD4+Zt0+Zt0EYt088ZBuum8nGYCmK3DtCJDn83D"
-"I8aDMUt08G3EquG8YwWYbW0DmKZcB1A0ruWGwn0Eo83DECeL0WZ3OgWqtDW-z3Xnz310ou0UZu0CufsT30WCEmf4EOBY+Vt02Tt00aZ4eA91t4JeUGmCuu0G0wgse0WD"
-"EqXW48pDEabW0SZ3EpfYYf01pKZ3g022vWZDEORH0OZ3Pcbqe6W-y3Xny3X-sDW-sDWZsD07j8ZBsW3EpaZ3pLB6tW3Em83Dvewp1WWDtSZ3zZ21oKZ3lLaeSZ87p4pD"
-"sKJEuKZ3wBZ3i820o9YJvw0Bv601YSs2s0sjIKGkI0Jk04Z-mYgomYQnARuzXuG2CusBC8H-D4G9+hv02fv048ZBEuEd4CpDE8-24KZDEuBFXiicGSW3p720uuGHOwWJ"
-"Jwmw3fec3GmDmumRfuWRE00EES58Q-Z5+FDgEFDgIiBAw1a51KY5lPZ-omWGom01ruY3ngc36u66mWpCpC3Etegg1uW-1HWCqumSY1WCEKLI0SZbRI10tuGjvmHCvWJD"
-"mC3Dv4otINt0+lV86lV8Iy9WwbQ00CJmixGdKuFg184g1WGBruI8i1HEv43Dou0VtIGDq813COvK3umH+wmjZY0Cm8Z3r+gctiX3Bp60muGOMvWmH0WDQZnC0CZ-F5Xn"
-"F5X6JxdSm020vu00TumRnuVg1OKg10GEEKhFECCNSO3DuOpDraJC5Vibf60DtG3CmSJCtSpCr8JEmKZd8P57vC3DrOJEm0Z3MoA0uezLC2GC+ZEgIZEgMaATgrZ2E8n9"
-"+3r0I1r08GZBnu0LqH2CmS3DtC3DsWpDgYp6EiNXC4pCn8Z3QNB1s4Z33iXYYQ01pGZ3TL61u0Z36-00o8HiM8D+4ulAHeiAHuWqXf7+40GCE4l4+ZQ0IXQ0aOZBoGZD"
-"r03EmaZ3mO31tCZ5RjbbED08qaZCpS3Eu0JCEGuj00Z3mjXYe606sKpDv0JDuumQqYWDr0Z3jIXpe600qu-rXOyrXW0CWaZ3v5iREDW4ruc3BsW-sJWHsJ00tuGDY2mD"
-"EiidIWGH0CZiYTe4sB37n03Cv8ZDpaZ38kWYe601r0Z3W+e31wRuGuGDEADg1ul0Hei0HuFK38FK3WGBouIGU3nDmapDpuGkF1WDMG55M6r0OKJEm0pCn0Z3PP71uKZ4"
-"llcYf600quGG330EEi-UC8pCpGZ3MnYqf6W-T3XnT3X6wbbS4fI1auWCWOnGD8YBE4H0Me3hIONHUScA+JaAkGaAC8ZBq4Z3m9X3TSa3mBhhwOh3H552p4pDEeEI8KZC"
-"rumrqeOp1uG4wGYCm43Ep43EnSZDE4A2ItS0+BG4IBG4I0YDkzH1IqQKc0n3IrS0EKNiPCY-C7WBC7W3LjB0nu0+N2HEnSpCt4izcIp30OZ4Cr02u8ZCEKGN4SpCMcUM"
-"E80k84ZCuu0Vd2GEEaJYMBs6+tHgItHgIKVRoTn90CJ0aul0EPb0EHXDkC3CnOZ3ux32t83DEqNigcQ0ES4eEiUB0SZ3uqB0quPg10GDEKBUSSJEsCpDpCZDEuufINt0"
-"+JjCAJjCE04XwnaGISxM+hO3IfO3IGYeEeUOKW3Du8pCseXHJgfw60WCEKvOEivm44JCEOBLIkD44C3DECmC0CZ3Tpg3s-cspwX-2ago2ag3veW37fYQ9sW3CXb3oHX-"
-"weWHweW4H5b4zZA1m8Z3S3X3P2ZYOS21oCZ3Pf43m0pDmuGmgfPmNuGDAuGb0HHEs0JEsWJ0r8jI3uFrGOCrGuW-XuGfo97z4aG9Eq9GMu82+xf1kuf1Ei9G00Z3jE41"
-"r0Z3I6Y48neYc604sGJEv4Z37411q8Z6IpZYbX04qaJCqaZ3WG40tum3zuj0nuFsegCse20CEy-4EORBgbq0I4sHEynK+JQ02HQ0EKn9GC3CrS3D1h22qW3EEC9CAEQ0"
-"I0mHG8pCn03DEisXQkyO4KZDEefqEKzoC83Eq0Zsxn80nulsegise2GE66cA04Z5ySc-aAZIaA32jOZBE0MfEKVQE0zO8SJDruwOgGnCrapDp4Z3jAj3i1YbWEY4umC7"
-"uCZCnaJCqOZ4G9apnJW-uYgouYg4ZfaUvzc4uqNmLw-I38qI30GBIy15KGZCr0JEnumyT0GDkE088KJDmOHGiuGQv0GCEqjEEIF1eCZCs0ZDm4JCs8JEEK-jMtu2+lBg"
-"ElBgE8kNImH6gLF144pCI86Z+FZWEDZW1h93nCpDtu0ch2WCEKhi0CZbBZ81q0Z3Qj72oa3CEOym4OZCM2I9CKZCm4Z3j843pCJEuuWyjejf1uFpGOCpGuGVFvNf1umX"
-"W9nHMvFv985v9mmCo8JEEaS5E4420GZ3k1XYRQ00m81WZGGEtuWpD2WDUEA4EeCWE07e0OZ35aju+WW-pYgopYg3tMj3zMjQ8DW3Q8g3BUX-Y6WGY6W3qVB1pKZ3Fz25"
-"uS3CoK3DEq8CA6Q0EO628SpCpuG0RX0Ep4ZciYg3+FC0vuWGYA1shujkLuVhegShewWMB0mDE8vDg9Q0Ia8FEm3W+Jf12Hf14WZBEawNSK3DrK3Dqa3EEidEc2Y4EOwJ"
-"EKuhKOJEqKZDqePg3Y0DoGZ513D4vW3Dq8ZtNOb-mYgpmYg4ICf3PW00jOc3guGnUwmTGuM8Z4G8EOj6HGY-HrWAHr0AouICmKJDp83CpaZ3J+31q4Z4cuXdaX22m83C"
-"EKRJ0WZ4JsWcxQ02rOpCEmeQ8WpDmuGcAgjxJu-regyreAnnoeNp1K09cSP5EfR5wCXJ+lS0zii36U10puW-Txm303WCE0HSbmibf911tCZ3z740p8HZ8GmDqefegY0D"
-"tSZ33p60muGJnXGEtKZtC7W-73Xn73X3NTgULl00nu0oS4Mcf6aJB7W-wTgPwTA1puY3m471rSZ4WN12oG3Ew2KC0WZ4ZD43rCJDt8XXFfuzBGmCnuG+UvmcM3nCsG3E"
-"mOzWb1GC+7IgA7IgE4-7wLv01CYTKEW506h-ULWKUL02pSZCE0OfEC2E8GJCo8BN51nDr03EnuWDRJmDrumaU00FEYS00SZ3ys05t0pDsaZDIes3Qd13+xT8AxT8EypX"
-"Em8Dkjo1Ee13XZGQJw-E5uoE5mGCkGJDE4idECSkCWpDsKZ5ixbbxK08pWJCnSpCm43DEWbT00Z3C9gYnD03rCpCmu06LwGrvGGCouWRnOK4HG0FluWsh8IJcZ1FpHNO"
-"dLsNcym2aSJEk83Dv0pDsWZ3s+02nSJCEyeZ+K20DcB7y0NOoLcRqvZ3RKJ3B4X6WuMPuHdFj43FlKG2Yq6Bca6BIK6B5Wb3w4b9K750y8pd0uZebNWD1820WuFXYuCX"
-"Y0mDE4sFoPg5X2k4Zjc-E9WGE9W35p08rSJDr8pCua3EEe8iMkwKiG3CnaJCrOJEv83DpumNB8Py30XDu0ZDmum-E2HEvG3EqujAcrJr14GExdG0bii-hTkChTk55480"
-"me7dfvmmuum9aule18ae10XCkGpDp4UMEWGGEq+BIerCQ++0GCJDn43DEi9cCapDqKZ3KiiZlF04vOJDt4Z3lq03mO3EvumZpOqx3q6acXq0+-Q46-Q4EGOTIKC3gPP1"
-"QiKI+RxdEPxd0CZ3fi10nu04JX1Dq4ZDn8ZCIKXBMs93KKJDrSpDmu0BB1GCEeOFMMXB0CZ3y220uuGE8AXeCPDMJuVLYeSLY0WCXcf37fbQe6G2bOYqAu-F7q-F4KZB"
-"EaHeCOpCm4Z3fQ11q4ZhBJg3MoE3uK3Euu0pKG0Dq4U2E+q0EOyd8W3CuOXNIwm1efyJ3ulL4PiL41GCI8P4oPf11CY37aGYpNv4H402yybFE4wgP8Y-67GF6xGzOoGE"
-"pOpDEeVNCKpCtSZ5YvabkDW33533oG3CmuW5IGmDquWCQven1u0vMH2EuSJDvW3CpSpDM-Z3+xa8Axa8EWdc0OZ35XXRkDW3rQg4NYZ-aKXGaKX3Sg79vaJEo4JEs4pC"
-"numyFB1SuOfl6G0Dmu0COmGEn8ZDEa1vQIZB8K3DuuWzR40D4SpCIuXdA-s0+hoC6hoCEYQ0+VQ0oTQ0Emxk00Z32e04pWZDq0Z5gCZcGD01u0Z3VH62uSZCEWjLEuVB"
-"I2r0S8JDqOJDn0ZDEGFJQd7H+tO46tO4843CWumKY87ug8XZHu0aQdA6+RF1TQF1puY3S679mCJCnGZCqW3CsOHvRPff1GWCsu0or20CEO1C0OZ3UnYaok01rGZ3mHi3"
-"VZ52mWpDIuEJAtq0+-4H6-4HIihbXwcPBRX3UKb3+Oi-a6WGa601ouY3Beb4kk72nCpDX0d3pXXba602pSJEEKHrOa3EqCJCtSZc6y10rum-l0WDIihR84pCteDCBxVH"
-"HOSHH4M8E4KNgHQ0I0lTEGK4+Vf12Tf1GaZBmGZDEeFO0CZ3HOC2nSJDI0+PQ6gLEe020GZ3dB13va3DrumVK8vx400DEOEJ84JEtu0idumzveSI3umg3vVfYfRfYvW3"
-"iedf1uGH4vVf18Lf10GCEOsdEaY4C03Es4Z3Tsh4IrWbb601pSZ3I+j3Nx13p8JCsumQG8Pf1G0Cvu04uWWCr8Z3CkesG9Y-X2XoX211W0Z3KrGGVOMy4uWdM1WD1GY-"
-"DDWGDD07muICpapCrOZ3HRB3naZDvuWI+OI+J8p5Cu26h2GDI8KC0KZ3yy10mu0jRAPa6u0SV20CEyVa0SZ38s70uODr2wVxbfSxb1mDEuCLE4svo9Q0443EICa4+BQ0"
-"29Q0C4ZBsGZ3yW50m8nYWxW5Y4CbQMu208JWj3GCI0AsEaMQIUQ0EWLLEmG4483EEONNYlsH00Y-lJWllJW4b8a3lddQd6W61we-PQbIPQ52quIEES38CCJCu8Z3MV51"
-"o4JnM20DMwjN8CJDvum8xJmCu42UcAfAEuWlEKLCEC0aQ-gF+p946p94EKq6ES54gPQ0E8KC1Rf-WdWGWd03j4ZBmuWNbu01qu0+K2WDM0fAMsq00CZ3lyD5pOJErSJC"
-"Ey7vQM5GEKLIEuVX80pDtuW02PAARW48y4IBj02ToLMPW4JDWqIB+e08L401yybBE000WamAW8tRlH78kz6PbfJB0G28WmZPb56Tr9NPsK30S028y8NPZHtS+O1000I0"
-"VH3EW4ZCWG38o0IBnu2FlepR04G04mpN1G26p02DW438oKm84mpBIz40em3Tfn6TbHcFmmpBDe01yyYKG20ayG7QoLsSez6RavZDkOJEna3Ev8JDs0ZDv0ZDq4JPj03C"
-"qmpBqLn8zu0VW02FiLcPqzbTXncFmu2DrKpDqKZDmSZDnGJDnSZCyyI5TO3D0mWSfT6QHK3Hra3EmOJDvSZCp83EnWZDmmpBPuH0-701LuZD+5GFd2WDweN0sa20+VQ0"
-"ETQ0SO38n038p0YDkTQ0GO38nC3818W-d6WGd60HuuYDqSJCmGZCraJDu0pCtC3EcUQ0yKJCpG3Eq4ZCmCZDuaJDtKZad60Foa3Dq0pCp43Dra3CqK3DnOzf10mD+VQ0"
-"2VQ044JCbn40qusf1K095WY-EDWFED0Ij8ZBt43EoKJEv8JEsSJEpC3DoOAg1mpCv0ZDrS3En8pCrOJEqWJEIYQ0uKpCtSJCu4JCt8pCt0JEneDg100E+ZQ02ZQ00SZX"
-"d600uKey0GZ-DDWHDD0Hpu2CoGJEqaJEn03DsW3Do4JEXKA1rmZZqJ0EpOpDvO3CvWJEqSJDoK3CQIF1u8ZCrO3EuWJCr4JCsW3EoOTJ30GE+NQ02NQ0Ca38s0ImSgcc"
-"64m8+lq0Mjq04WZBXS3BuaZDv0JEuCZCvK3DXOA0p8ff1WnDoapCn0ZC1V94vK3CmSZaBD0FqWJEoCZDr0pCuCJEqaZCu8jf1GWCmulf18if1KiT8W38pusf1GYDW43D"
-"WW38n0oC+FF1+CF145ZBsS3CrKZDm8ZDr43Cua3DpOwf1m3DpGJDp83DvCpCr83Ev03CIUQ0yKZDvOJCpWJCqCJDpa3DoaZrd600nu-f18yf10GEEqb2EOS2gvq0443C"
-"1KIOGvFg184g1WKBtuICqCpCuC3EqKZDuOJEn8JDccQ0y8JDv4ZCu03CqCJCoKJCrCZbf6GWsZYCpW3Ds0JDq0pDtOTg10WC+dQ0AdQ0C838o0Y3yYWPHk01n0J0Z4G9"
-"+J426H4201ZBm4ZDp4JEpOJEuapDoGZDMwu2yOJEo8ZCta3Cm0ZCu8ZCuWZaa60EqOJDnKpDra3EoKpDmO3DQJF10CZ-a6Wma606t02CWO38nu6J3GGEWa2f+hq02fq0"
+static sybie::datain::DataItem item4("haarcascade_frontalface_alt_new.xml",4,
+"mOJXwwln0aXn4K3CEOi74aZDXg61raZ3Pre3gEbtsnX3ux22pGJE5k81mCZ3-JMfeX0Dk0Z3FD51q0Z3I8d3ntKe9xVn08Jn08H-pmWCuGJCE8VL403EX5k34gWqA6W4"
+"BPX3hL16qSZCuaZCtOnXzumGimGCoaZDE0r6E0p2MCmY+NC0oKC008JWMX0CoKZ3zaMGGxWPHvjY1m0DkG3DIqeJE8C24CpCMaKE1pY3Tt03tOJCmumwwuWQP5Ie+-a0"
+"kya00CZ3L4Y3QGd3F120uuWUK0mD1LWshO00puGZYHHCo4JEsCZ3wrMP3xGwQWWDp8JOjW0Es8Z4J6a-53WF53GvtoGDmWZCI4DD84JDsumBZvzj7GGDkumMS0WDEKh4"
+"E8yO00Z6EI43quIDsuWNn818D0GEEW0I+RC0+OC0KK38j8ZBnu0fsuGB8GmDpu0Ar4KKQRn0EShIOOJEmOZCoCZ3GbP8G4KKEePF4KJEECTP4a3DEikZ+RC0+OC00OJ1"
+"6pGDqO3CE0GC0GJPT4oAIRC0GCZBtaJCEu-TEK0F04Z3Y9H0l68k4KJDE8J7EqgOCWpDo0Z-NCWGNC00tumG9GWDou0VU0GEEi8S08JunPkK2uWFNwW6f0WDEqEW08Z4"
+"M-HOOGGEruGcduWkp1GEE4Y9XSY-TFWCTFW3LL40ouWly1WDIqA94CZCMWqNIlO04GZB1x00m8nZV00DE8sLfrD1ruY3II60pumuIu0Rj0mD+pq4+mq44K3CECn508Z3"
+"Av00ruWEcn0DtKpDI8F7INC0CKZBqKZ3+ga3-qe33mZ4BvH8A20DECDQESg5Xeg6-je-dLGldHGCmuWgEu0zJ5Kh48pCE0AMkdKCESyV4SJDXlF4qWJDt4JCB2WCEaDN"
+"CK3EvCZ3bBd6j4Y-63WB63W4WsZ3RF29tCJEq0JCuSZDv8n0PeDZ1u0CRX0CtWZ3lo20numgWL6tEGjC0WZ3mxa3Mb01vGZ6eGX-63WB63W4gj81tCZ3tJ43sa3Cuu0H"
+"O8XeY8jpAu0mtWmDuOZ3DUe4cza5UlW3Bg12n4JCEeo7CCZCsGZ3+OK0Txln0uYn08HDavmGnu0uSGWDru0wB9Xu+8jn00WCEyrLEe4dK8JEpWZDrOnR26AQ04Z3V7c3"
+"lM10quWIT8HELuln08Zn0umVcm0CpKJDE0r48KJDuum239+V8umtonGDpO3CE8430aZ3d3HIHvWl7HmDmuWBamGDrCJEEKiA+lO0+iO0IWLH88JDruWlTGGEvuW5W9H7"
+"cej5300DE0I5O43CoWpCoSJ0D5Wh1151vGZ35eW3g8Z3d+X-G9WGG900sumiOuG94ImDpuWz91HDsGJEmeky60mD1Ci38z40numoQMd5KKpDtaJCuu04K10D1Pb-B6WG"
+"B6W3lzW3X-00s4yzEWJIgNn0E06DXZ91uSZ3XiW3r8I9B2mCEm8X0GZ3x5e3g+82sGZD+t72+q72ESjcCCZBr0Z30C10n4uE0GZ3q8b3m2Xpw312ouYCXZZ3qT10uumH"
+"Wb2T00Y3AZX3p0HHH1GCECHJ1qj-XIWBXI00vumUyWWCvOZ3ny15vGpCsa3DICTBQRn0803Dpumw5ImDquG0P0mD9ce3xn11vSZ3nV51tOZ3Ug11v8JPoxVn0qHn08Z4"
+"xn51nOZ3CjZ3F854nOJDs0JGrgzY1WGCuOZ3a8Y3ot50su02P42T5Bl3CW41v0Z3jH71sCZ41sW-63WC63W3a811qKZ43k40tu04GwWQNQUpAG0CmuGQc10EEWjC1pIH"
+"v008EWhYEeDFWSJEpOJEpK3Do4GO+NC0oKC008Z3Pn00ruWSjvGIEvm4q0mCIGPAIlg30GZ3wd42uGJCESzWECG6Mye800Y3KS9AnOpDm0JCoGpDq0Z5hrX-63WC6300"
+"p4wPK8JEmSZCt8nkxHGCmOHV88jn04ysECaI08Z3oZZ36DQACY2DkapDqGJEs0ZDsumc410EfDl-NCWBNCGvtwWpF00CEiu7Ei39ISP8Ipz04GZBESs8Xz55qCZDrK3D"
+"ICc7Xie3SC82oWpDEWK20WZ3dAHOjuVn0uIn0GGDWen-fX0Cm0Z3baA1nCZ44nXsA601oSZ3WT50vuGyuGmCsOokbGmDmuGYV2GCE8O30aZ3rDY-53WF53W3Nh90vuWw"
+"I0WCEu530KZ3xuI0a9jY18n3DvmAHvGmyWmDsCZ4vYY3Jr11tKZ3Pb04vSpCqSZ300e-A6WGA6W32J51rCZ3Sud3Y5g3woG1a9TP501DkWZCouWzHnmDt0ZCEavEXyGG"
+"F1mDEWR9EawNGSZCq43E+lY16jY14W38EuNg0aZ3E164v8ZDrWZ3EEP0yfzY10WC1041r8Z31j72q0ZDQi+58CZBv4SGE0lcEG734SJDoTW2ERHY4WZCMQHY4aZBEyVG"
+"KC3DvC3CquWIhHGCvul59Qf59IGDou0M881aummCuSpCE4qR8GJCsuTp6u09Cn0EvWpCESmSICn4b0b3y-21s4Z3nq12mC3EEGTQIqf5+p71km71E0RJ0aZ3yv63p0ZD"
+"vuGJ8XGEqCJHIATB2WXDkWJCsOpC1Ll3wr80uencHuWO1wWCdvmE9uW99bc2+BK1zAa3ms43nuICruWbbGGEruWtfG0DnKglIRC0Eea4EuOU48pCEeoR48pDQOo40CZ3"
+"+a30ouW2EvGYuH0CrOty2OiZs0GDEetc44ZBE4nTOWJDm8JEtOZ37zg3QjXs63W4fo71s4Z3ecA2nGpDQKe3CCZBmKZ3jBe30k93tK3CsOHUIuFZ1u2Z1uGiD10CE8hQ"
+"Ea67E0k4MSE9Ixi14CZBEOIMKaJDn8pDrum4O8nyA4s58C3DqumWu11Dq8pCmuG64wlp6eZp6uGiDHGDkuW4ZW0EpaZ3hS83tWZDsumND8zY10WCIOyQE8G24K3EEa6P"
+"Qay5Eeg20GZ3vQ61p4Z3L0X5Psg-B6WCB6W3Qx23oKpDo8n-H0GDEu8608J8g8zY10GDEKhMSKZCpS3DtG3DEK9G1FLuK20DEOC7G43ErC3DEe72Uen7+J6CUG6C8KpC"
+"suWM1XmDuCZ3P315sS3Eq4JDIGo2IhO0IeAaESmh00Z3Ne10pOILVwWAQW0DsaJf6u0A7vFK2u3K20mDXJ94tG3CoKZ3iOZ3yG90uKEbIh52EuAQ4CpCESuRECIhEi9a"
+"1yQ8YImDuuWMWKQQ8KpDm8HXBu-s3uos38XskuWp-GGDtuWwC1GCEyyQUBl1EipJEuqF4WpDMKw69ce3fb11m0JGXvGcdum77vGvEuVn08Jn081QLH0Es4gN00Z3Cl62"
+"n43Ec31448ZBEKh7CGpCvOZ3Tw71rCZ8+z10mu06GPXVu0mDUS7c+lO0zie4tjf3GD80uumcd0GDEGi4boXsG900suG3l2GDIiOKY8E3EKT3E4gTEqjZIKPHf9l-53WB"
+"53W4tS21uCZ3OIb3op83qaZDn81OA8Dt34CBESjB0aZ3YL51mWZ7ffZ3R1Y39xX30bW32H50ruF4Gu34GeXiD1mDIiSBEWrD08Z34SXvNC02uS3CEyEd4WJEEG8O4C3D"
+"X6h3R611t0Z3iYe3QFb3f1b-3bWG3bW3osa33b01o8Z3VhX3RHb3brWt6309puICvK3EvGJEru07s0mDQCQZXHl3yO10q4Y84KpDEab71ch-I9WBI900qumMZ4mN0CZ3"
+"7c41vSZ3APgu3bW3PH62nWJDEiVb04Z3pTc4amI8C20EEi+EIyXXEWQK0OJvAuln0uYn0WGDWqY3y342tWZCECzd40ZCEGABYdM144ZBE8e3EmSTKaZCpWZDsagKEWN5"
+"K8JDu03EouGCUAHeYuFZ1u3Z1uGQL1GCEKWASS3CnGJCtKZDMyR2IFA1Emr8EeqQS4pCvO3EoSZDbtZ3uL11uOZ3Cz41tOZ3jNd3GzW-53WF53W3xN41nSZ3dpQOOwGv"
+"c9X8w8je4u0oNm0Dq8pDE0UkGOpCnWpCXGTmp3mCE4YdGSJEuKJEE0SUM8I8+3b0k0b0Im-UEGoc0SZ4F1a3OO20qqEMYv1lY5+kO8ZBp4JDoGJ8oHmDuuGhD2GEXGNe"
+"evGqk1mCI0L60aZ3HDK0Nuln0uYn00GEEaq20SZ373f37O81vSZ37LetDY11quY3WA70vumJ-G0EuuGzqbGn8OZBtuG6gIGCnuWBY00DEiL2+NC0wKC00KZ3ehA1u8Z4"
+"JC76u43DpGJEs8XZheDK2GWCoumnJw0FluW8dfnVV0WCEuUKE0iPEKaN4KpC+BfD29fD4KJDEacCE0BFEiPe04Z3fDB1qGJGBhTn0W1CtaZCtSJCE8nF8CJDmOnHcvGM"
+"9uWaG01Ev83Dmu0a2wFme84me0GDEOp9Emm3XE00qu0Gi0mDI40IINC00GZ3vPB0v8H8kuWEGO1+e5udEOcKECWCEu3JE43R+-a0+ya0EqkBGW3CrGJEEm1EECtL4SZC"
+"1Gcq53W3Ik02t8JDEGsIEOkGfyGWVwmwsGWDpuGBT8n++w-x6upx6uGiD1WCE4zF80JCru0Kiu0LKQ+1AGWDkumHoGWDtuGnhv0fl0mCffD3quoDsu0elY1ErOJCpOpC"
+"QCXH+-91T+f3ns40numuu1mD1M51qKZ3ifWvzO16ouYDpSpCquWOSwGLGwHF5wW6xwG8O2WCE8YGEiA8+pO02nO0IqkB40pCE82jEyrb4GpDEel89PhphO00oum6Mu03"
+"Au0CTgXH15KQ4WZCEa8CESsQEexdD4c-q0X8q0X3Nh93vu2DquG4QIHDtKZCqWZ377itDh02suIEE06C8C3EnuW2f8orQI0DkuWCLuGapuGN900E+-JC2zJC4KJDEaML"
+"40ZCIKPP4OJDE0Wh4SZDXU60quiVV8HSc0XDrKZCou090X0CuOJSN0WCEOII4CJEEqoP0CZ3+0HAix-Y1apYIqkB04Z3o310suGQouGKU10C1OiqZI00su0MFumey0WD"
+"1J31rKZ4f6a3Ik04rSJCsGJGjv0yv20EI0IF+tz0kqz00OZ3chA3ma3DouWJRH0Dpu0zp81OM8DpA81tTumxW0mCEaKMEKc6XGd4a8a3B1g3Pv13oKpDruFJg84Jg0WD"
+"Iys3E8q4IyuAEOLj4C3E1TWsH900pu06Tu0kcuG3y00CMaSDE0j74SJEEK0F84pCnumebvFJg84Jgu0jDHWCk8H1r1XCm0JDsu0um8XTH8TK2G0Dk81aJumyh2HEraJE"
+"vOXeUu0F2H0Cnuma8WmCnOZ3EVg5wtW-kOGtk81jD1WCES4b8OJErumri2mDMiZ4INC0Eq9BEqAKEGPUEy-E5jP05pWCo0pDIK588S3EsuG1364Q+NC0kKC00GZ3Os03"
+"mSJDmuG2G1nDtKZDp8XnJ8Tn0u0OMGmDouG6gI0CsuGTFKts04Z4aB81vSZ3PDY3dhW-53WF53W4ul70ouGa0H0DnuWhn1GEEOgIUZ5304Z3mpB0suGAs0GDE84Dc0d9"
+"ECzVC0ZCmOZ37y01v4Z-oRWGoRW3qs41uuY3Kq00o8XuaoWCn83EIeoHIpO00OZ3qT40ouml61GD1NF1mCJ9r5Ix88JEmuWYY1mDECTT00Z4lnZ-H9WCH9W3sS21rCZ3"
+"ni04vW3Es4Z3sQfuB6W3PP23vSJDpuWvLu0bif1gEu0C9YGEu8Z3h4b3rC50tuVfsuJfsGGDsuGxkO1l1JGEt8XZi1WCIexJIhO00GZ3rxb3gGh40pg3-AJG-BHqcumW"
+"i20EEKHY8apDt8nrPulY18ZY1uGtUm0Cs4JDEuB388pDsu0yF8k3K4YYEmnF0SZCGNi3oM60mu0N+vmSU0GDEKPaXik-53WB5301t0Z4sbX4aIB5n0JDmSpDEqiAUVW2"
+"4KZBEuEl1R10q8nU7N+EXLX32cc3+l95nS3Eu4pD+lz02jz00SZ4chA0oumEium3cumrZAlbYWGCtWZ3BaY37UB2mKJDIiF61550pu0YNWmCvSZ3hi21v0Z500a-iOGt"
+"i0mDEGkE4OZCE0L7KWpDo4ZCnu0VNvzY1umclGmDnuWXs0GCEOQJMWFG1KC1tOZ34OY3Po41uCZ3JbPOjuVn0uIn08H8Tv0tI00DEurLEaaNMKkEUBK24CJCEmThE0tY"
+"CKZDqGZ4QY12WGZBES+X8WJCmu0UEvGDQw-538q538H8TX0DsGJGjwW6w0mCEy0DUBl10KZ3LMY37NZ32A42tWpCY8K200Z3PsC0su0cEvmynQn2YuFZ1u2Z1u0n93mC"
+"EO7XEy7kE8UI0SJniezP50GDESnMEeopE0ej0CZ8FG10m4Ye0KZ39oX3tvZ-MCWHMC00suGl90WCEuccE8MoCSZCoWZvu841quY3eWZ4-h11rOZ4tzSG-308EmPA8K3E"
+"uu0An2WCE4bA+J492H49CSpDWWZ3bN51n4Z32fg3VvGA0fT530GCEm3DEW-O8G3Eo8IE52mCES9OEepj08Z3Nw40tuFUf94UfHGDtO19NuWCz1GEEW4l8WJCr8ldRY0C"
+"t8Z3T1Z3NL70mum1UKoYbxC1rOZ34H21naZ3ecG1NuV53uI538XRFuG9q2GCEGXHEK8UMy+nIRn00CZ3Tq00q8nc63mDEKYb9g81WKZ3+r00vum-twG-uumdw4Gt+RC0"
+"TOC1u0Z3Z810ouGrPuWTvumSewk9220EEmK90SZ3vr30ouWWn5iTEiP584ZCouG4B5uE0GZ3pDg-53WF5302n0IEEq2R8CJCruWKw6Mak3A1GOZDmOpDI05KC4pCsGJg"
+"EvmTm0GDEaeJ84pCvuWLW2WCIyX4+hO0oeO008Z3Nz11vWZ3poW3-+80mu0l2PkA6uWaDJ0DvuWLG1WD1ZN9pH08nuW43vmAMXWDsGZ3DMi-MnWGMn00uuG9NGWDqumm"
+"o0GCE8jH0CZ3neYtxXW34l10tuWGau05XumXiuHlH0mDE4HOEexT4CpDEaeEXOY-A6WCA6W5Qx11sOZ3Y3h3mCZ3WCNGBBjs30WDEKpUGGJEp43EEmXh0OZ7AoX3by73"
+"tC3DouGT920EEGx4IWV3+hz0kez00KZ3W+10tum5WGGEmu0uS2GEEiIL4KMBUpY14WJEIC29Ga3Cu83CEy1fXHC1WGZ3SZ01uSJuA0GDEumNMCk2+RC0kOC0XRh37w10"
+"nu0HP1GCE0mLIaMJIlO04KZBEuq9KO3CtGJDouW1xQXsXuG4i0mDEidR4WZDEGuF0KZ5SZW-53WC53W4Wq51m0Z3Q265m0JEoS3DE4QXUpz008Z3mNA0n8X1hvWn8enN"
+"U4yAEa97EmiAEOMO+t+P2r+P0KZ3Nh93pu2Cpum5Jw0bJ10EECXUXRbszXW3y8h8on11p0JKH1GDESF4E4fECGJCpOZ6TYf-H9WBH9W4KQY3Ox60qu0-b1GEECZ9ctz0"
+"E8v244JCIiHs403EECT3HOi3-UZ3-E41uGZ3FjY5kuX-63G763GEEKo5E0jf08Z3xs60oumf+2WCXietNCW3gY10tuWlH00EE8X2Mqi20GZ3rK10ruGvuX0CsSZ7iua-"
+"53WC53W4x5D2uGZDECXPCG3CpKZ31XfueLW3Zg80tuW4pum9kQIsa1GDEW4G44JDEqEr08Z3pgh5Fcc-B6WBB600oumv-0GCEmRW0KZ3q260uuWOC8EZ100DEaCm1DZ3"
+"Y2D1q4Z5RzIOTxW7SuGRAmWDmOZCE4qHX+d-63WB6300pu0mHuGKK1GEEWEk0aZ30BdvJr12suIDEG8MEWnAGWJCnO3DMa0AESy60SZ3lu10numqQ2GEE40Y+RC0+OC0"
+"0GZ4Mx30puGlC1HEqG3DuuWEzuzy6uGKB2GCE8RZEuMGCK3DuKJ8L7oYEyw7EG4E4SZDIKsj+NC02LC0WK38j4ZBr4JDmumTH0WCI0PVI0pII-FOX102v83DEKGD84pD"
+"nu0Ym42Tbv20qumLx2GDE04944JD+paB2naB0aZ3bQZ3UP11qSZ3+UY3z5TfT8je4uWAdXHCt8ZCvG3EESq4Qa-4EOxHGWZDpKZCE0lHC8JDpGZ-dLWHdLGvvw0QMumR"
+"NwWsQI0Cm8X0PAjn0GGDku0IbuW9F3WDEe-AQWNlEGK24WpDEiSeIiJX8SZDouFt384t3u0Jku0qCu0egvWbXWGDvGZ3+XWs53W3SB43vWJCuuWasGmCs8ngnu0Ha00E"
+"EmJDCSJCn8Z3s2D0tuF+Jv3+J1GDEeSJ84ZBquG+sv0d7vmwcI0DruG4C8jn0GmCku0sU3mCE0dKIC15MCF9E8730aZ3fTY3Zl13qOZDruVXIuJXI0WDMSjc04Z31sd3"
+"HvD1mWZ3k1YwXq00tumOtIWCuO16SeH-5vmMCuWPL3GDEu2E0KZ38Ph-YIWEYI00sumrQwWUy9HC42XDs03DmuWaSuzvDu0bMHmDsu0ZgH1DmGZDsCZ54nW3GhW3r310"
+"ruWXw1mDE4YrXSY-pRGtpJWDmu0tav0iA5GqEaw50aZyRyh3d8j4Ks30vu0971WCHtY3uzZ3mRa3lGc3v6Ue+vFk7aFk4O3CEmDPEasLEKYO4K3DE0xEIiZ4IRn0E4t3"
+"8W3Cuum2hv07a10D5ff3WqW3dr10mum6oIGDtuWCiL0t+NC0kKC0ImSJEiC804Z3BlC3o8ZDmOXnPgjMC46l4GJEEG36EeT9f2b3HGX3Zm10mumVnGmCqumvJw-Y1upY"
+"1um46n0Do4JCEqq4EykK0SZ5qCYqB601quY3iGY3cX45n03CpWpDIKl3EOe40OZ3m791nWZ3lx12pCZCf8g-B6WBB602s0oDIO3h4OpCEKGO8WZCqekMduWve0mCE4Ft"
+"4a3DEO4T4aJC1IImimmDp8JEEahYCWZDq4Z3YMX-A6WFA600t4Gn4apCIuI80GZ38Vd5K-Wq3HY3P542nSpCE83bEW4V0KJRQpGCkS3EEGid4aJDEKrW0CZ6r2e-A6WB"
+"A6W35Hd3R-B0ou0y4v0g9GmDm4IAINC0XfD0ruGMPHWDpuWDkunNnWmCk8Z30l60r8nBUm0Cu4pD+l72wi724O3CEaSJ0OZ3p514maZDoSZ3cPc46FXqPF00quGPMZ0D"
+"t4Z3go71mOZ3E0UGuW08ruY3tRf3uy10uuWPJ00E+-k12zk1MaSJ4CpCEeZEC8JCtOZ3XkY48ieqQF04pu2DqKZ3IS82tG3EM40PDOi3zQX3pE61mGZ3YRZ-GGXFGG11"
+"s4Z3-NX3b171oOZ3moj3Gvj4RR10puyuem0DkKJEEuL3EOXbECL7Q0K2GOZBmSJDI4SA883DnuWm120D1mj-LCGVLu0oD1WCEieeEupREKvAEuYUYRn004Z3bZ75q03C"
+"vOpDEueLQW0cECJ3883Eru0gl2mCEexw0SZ4dmX-63WC63W5Sx11tSZ3H-01mKZ3+M30r8nLC8z53umNd3GCIiaN08Z3AOC0vqOeEynQ4KZDEmlq40ZDE4OQ9Ba-C6WB"
+"C6W3jzW35SY3-KQPNQ1If8Tn00GDE0KxE8PGX873vCpCuKaEEWM7E4f40aZ3dM41p8Z35hZ-H9WFH901r0IGH1mDE8cfIWG98CJCpOUK20mDESM3EywC40JCEGr608Z8"
+"d122tWJEIajZCa3EqKZ3sVX-63WF63W49tKuh2GEE4-N4apDISrMcdF4IuPMEiL6EKQRMuIAXTX3Hw31tCZ3TD83o4JEuOHvbuVK2uIK20mDE8B6EeyYE8iVE8Wi4WJC"
+"cVn08KZBquGqKuWasvGOYh1khLaK4OJCIunN0WZ39Z40m4o9+RC0oOC0XZh31071q0Z3LoA0quWAtuGKLeDQ58HpunXDvWZCrS3Dqe17GuG+G00DEmxh08Z3OK50vuGr"
+"rvVK2uJK20GEEy050KZ3kri39070pumlCOk9N0XDkSJDpumAyuGvJImDpOYgfGmDou0nUX0ErOZ3v740nu-eVupeVGWDo8X0s81bTv0QWuWvBLoYQBA10GZ30r60puWV"
+"4JGEquWC262T1152rSJCEW+LEqo288JCuuFK2u3K2uGeexGiPwmrMJ0EpuGIBWGCn0Z3CyWqH900oum3NGGDmuGNIYGDrCZ3s9H363GEEOEU00Z3+5Z4jhb-YIWFYIW3"
+"At41nuY4OGe3KtD0uumKvA1fV8zpA8nF86adEGRe8KJEq8niW42ZEmr60aZ3Xl60oumusO18bule4qfeEeSJ08Z3D0PWUI0CnuGEL1GEkhW2EOyq0WZ3KvB2sOJDEm-K"
+"bme3q2Z3OCa3VoK0DNo9+RC0oOC0EeSJ4S3CEK49EOCv4SZDsx2FSSJDoKJCn03EXH12tGJC9551ruY36820ouGmSY0CoWZ3lxQ0Sx-Y1uoY18X9NuGWevWGgI1Du8JE"
+"sCJ9geTK200CEqM64GpDESCK8WJDuOnixumvAm0DqKpCEOoa0CZ3gFa40fZ-63WC6300s4AQKapCm43EmuWOE0WCEqKIXsiqZIW3oY11u8Z3jI41s4Z3nZh8Qha3CcD1"
+"mKZ3s7Y3t190puFZ184Z1uWwWxm69w0PxumDT1WDM4MAIBA1Eq9C0CZ33pd3RW20m4gL1fZ3MQY3Vnf3nC51mKZ4RrQ0NuVK2uIK200EIu720KZ3TyB0u8nUoHmDq81W"
+"v8jn0GXDkCpDnWZ3laY37k42uWZC5VX35A10puWy-o0CsW3DEG220SZ3QWW-63WC63W3Dv24sOZDn0Z3YHE0mumnk8HVR8Tn0uGyjJ2Dt0JDtaJCqSpCESHJXGd3uH32"
+"sCZDEOI9IWTZQuPB+lO0zi80pum3u30CE47V0CZ4Ow61qaZ5Qrgq1iX3Log3GLY3rsMONqYYE0nmE0PLEur404Z4uKH0SxVn0uIn044j4OpDEKEiIusW48JEgNEAEy05"
+"0WZ38514p83CuKZ3OjO0k208Emcl4OJDEec20GZ3iq70nuF9N849N0mCEeRF1p92nCpDEuOEEaXSXbdsF9Ge4vW7NuWnBJGDs8o3K0GC1mj3tZ21oCZ3nMHn2vlY1uYY"
+"1OX+n2mCEWUVE4le0SZ3LWO3bPSQxGGCkuWaE0mDEasE40JCEqmgX0HOLGGEruGMqAHjO00CEG-VX8g-63WB63W4MQ27nKZDmGZCn8Z3BVB0qO1IFAzA60HDkSpDquWP"
+"1Z0DoWZ4GAMSRxm48uGm7vWtlGGEsuVy68Ky6OHsQwWKKxmb920EEuw40aZ4nEXqI901puY3CM81tKZ3CWa46gHgcvm+G0mDEGA70CZ3TpE0se1JqxDZ1008T40om0IB"
+"n0ICsCZDWqoCkK3DtCpCq4JCo8ZCsaZDp0JPj0pCyyIQkHNPovMOivqRaLsS+e08Lu39ymMPXPcLXnMTb9p50WA8WOZBmGZDr83Eo83CnSZDsaZDuKMBm438qu2EmWpC"
+"nK3CpWZDu43Cp0pC1S11yyI77n0FlybFL860yq138028y86Y0008LOCHt0oCk03Cna3CsaJDoS3CqC3C5KC0ruSn0GqCkaJEsSZCpWJEmC3CqKZDqaJ0kI48ruYCoWZC"
+"m4JCr03EvGJCsKJ8cuVn08Jn0m4EW4ZBp4JCp0JCvKZCo8pDvK3CnujY1G4DkSJCo4JDu43DpKZCmCJDr8J35ppDsKJEvSpDsS3DqW3DoKpC1SX-A6WBA60Iv0IBnuoC"
+"pS3Dt0JEr83Do43DoKa1I3b00HZBn0JErW3DvWpDnOpCrG3D5yQ8BIJDp4pDm4pCoOpCt0ZCpKYe+RC0TOCIq038ou2CuSZDt0JEpSJCu0JDoKoY08ZpG90HruYCm8JE"
+"vCpDr0JDt8ZCmGZDXG7HW4ZBtKpDvWJCv8ZDo0ZCtS3D+3b0+0b0KHJCWqoDkK3DvSJEqWJDsGJDua3CoGZtH90GsuIDsOZDmapDq0ZCrSZCsCJIHH4DkOJEqapDr0JC"
+"uK3Cn83EnSJ0Tx-Y1uoY10YCW8ZBq43EuKJ0aHGEn4oHXeYsB60Fn83EsSpCv4JCma3DsOJDr4Wh80oCk4aHa83CvKJEnWZDrKZ-B6WHB60Jp0IBouIEpK3Eu83Ev0JD"
+"vOJEuKJeS8j530aDkK3EmS3EsS3Cr0JCt03Ev4WIXQ6Esa3DrGJCmaZDsWpDp4ZD+Rn02Pn04H38ruoDrKpDv8JEp0pDo8ZCquk53WJCqO3DqK3CpKJEpG3DqWJIG1aC"
+"kSpDr8JDvaJCo0JCq03Cu4g0+3b0o0b00KJWXYJCpGpCpS3Cq83DrWpCrKZuMC0Gpu2EpOZDm4JEt8JDtaJErOJ1lY08ruIONJWDt4mNCO3DuOJ2Txl53uY53GaDW4ZB"
+"sWJCsaJEvSZDp8JDmGZxMC0EmWJDraZCuOJDvGpCv03EbHCCWOZBnSpDoO3CuSJDt4+Mfsd-53WB530Ft0IDk0JDpKJCtWpDqCpCmuGE8uDe40KDk4pCuSZDp43EvCJC"
+"rSJErKa-01oCkO3EqSJEnaZCoKZDv8pDfti-53WB530Ju0IBquIDuS3Dt43Cna3DtOZDr8JG68zs30KDka3EvOJDr8JDs8pDnCZDoaSy8GZBu4+na83CvS3Ev8pDs4J8"
+"duln08Zn00GE515Cu83Ds0pCp4JDqGZCu4gPINC0GGZBr0JE1PF6rG3CtOpCuKN5eSZCp0JDsSJEp8JCXUGv8u-Y1qpY0KZ3Kh00kKAma03Cp8JCtSJDsSJeYBjn00qC"
+"kGJEsSpDmWJDuSZDqO3DtaKK0LZBoGpCp4JEoSZCva3DvaJDXmk-63WC6300n4OeqapCtC3Em0ZDmKJDpKJDcpz0y4ZBn83CrCZDvapDv43Dp4JoR338quIEsWpDn8JE"
+"oKJEECM200JHevFZ1u2Z1WXCW4ZBmCpDXAE6n83Du03CoOUn0WHDk43Du4JE12F5qG3DpapD1jP05ZnCvKZCnCJCjj20nKm5+NC0kKC08D38nu2DvSpCmK3CrOJDqK3E"
+"uCJmh00DEVW20HZBmW3DvaJEuKJEpCpCmCpDfRBFruYCsa3EuO3Er4pCn0pDpKY9+NC0oKC00GJWX2WCEec2WC3CmSpDmSZDmKGPIBK20PZBpa3Dn03DvKpDrW3CrOZD"
+"X0HmnBH0AG1DoOJCvSZ3kiW-B6WGB60Br02EkC3CsKJEpOpCEyW244pDICD30CZrB60Et0pDrKpCvWZCtC3DsW3Cb+4HWOZBsa3EpKpCoa3CrKpDuOJC+Nn02Ln00OJ8"
+"BIJCoWJDta3Cr0pCm8JDm8nWAejn0GJDq4pCsa3Cu0JDqCJDnOnA9m18ruoCoCZDq4kkKOZDrWJEpu-P58qP50mDEmB3KCJEvGZCmuW8FWGCr0ZvCh0FquoCpCJEs4JE"
+"mG3CqWJEoqoY0LZBqCJEuOZDnWJDnW3EoapCXUi-MCWCMCW3jz02nSpCEiB3CCpCqKJG94qoQlz04KpDb254nWJDp0JmQ8nLC0IDkK3DpGZCs8Z3Ih01p8Z6JYW-WIWB"
+"WIGusY1ErWJDtW3CEGq2CCpDu0JWMfTn0mmCoGZDE0W2OaJEp4JCu8J45Z2DoOpDrGJEr43DtuWSC4GO+NC0kKC04O3CXaIub1IEo43Es8pCsCZ4liWqKC01ruY3Tw04"
+"o03EsGJ8mHGDvK4E01oCkKJDmOJCn4pCuC3DpWJC+hY12fY10OZ4iz0BvWJDnKZDm8JEqOZCEeN4Upi2ESq4OC3CnWJCm8Z3t+00tKVjuOpCmOpCrapDsSJEnC3Enu-Y"
+"18qY10WC1i7Bra3Dn8ZCs83Dm83DM0p2Q3b0yKJEu8JDqWJDvG3DtGpDv8JSLumF9mGDnCpDESe400Z42vW-G9WCG9W4iz04oa3Ep0Z3h215p4ZDs43C1nis6304nC3C"
+"tKJGIHXDpa3DmCZ5SqGeb1ZCqOJCn83EoC3DuOpCXmk-63WC6300q4w6aS3Dm8JCmWZCnWJ026oxQNC0I8H5EW-4KKJDmK3Ct81jA4QP40JEEau280ZCqKQQ5SX-WIGd"
+"WYYDr0YCka3Du83Co4apCO3CpSZ4NMXs530Aqa3DvOpCuW3DpKJWbKoSa0IDkOZCuWJDo8Z3Ye02nWpC+hY12fY10OZ3hz07mCJCoOJDvOZ3YyW3TR11brYr-a00ru0L"
+"FWGDn0ZD3FW3s311mGZ3o616tCZDuOZCna0t+hO0keO00SZ3CG12t83DEal44O3EIKY451bqcL04nuIEuWZ4J016v4ZDtOpCp424E0v24a3EE0B3Sa3EqO3Do0ZC54c-"
+"63WC63W4iz0DsSJEt83CuG3Eta3EtKJf58jn00aDkO3DqSJDm8pCtGZDqa3Cq46O1550m4S-WOZCq4pDs0ZCruVNM8KNMGXDv0IBruY31g05qKJEu4JDEGi55mdq6302"
+"pu2E5kE8va3EuS3DsOpCHOSWqWYDv4JCtCJDrC3DsK8k+Bb0T950tum8NWWCqSZ3HO12qCpDEyw40aJec9Tn0uG8QmGCu03EEug2CW3CrSJJHXGDkOZ3F211s0J8A6+q"
+"+li2+ii24SJCEO53mCZCt03Cu4pDuGJDtOJHG9Te4WHDk8JCmaJCE4v4K8pCqGpCs811DumJQ0IDt43Eu4ZCvGZ3eEX-MCWGMC01t8Z5Mn03tapCpumOE0WD1LTOIgTu"
+"DGGCruWHMWGEsaZ3rY10nOIuD01Ct0JDqumWI00CXPF0r4kp+3b0k0b00CJPM0GEEWF2SaJEm0JCm0ZC5TWqC60GpuIEtKJEq8JCpG3ErSJCtSJH-7oeq83Eq0pCu0ZD"
+"sWZDq0JCEC-2+RC0oOC0yG38nuYCrO3EtW3Co8JCmGZ3YUXt7e01quY3r611pWZ35D13mKpCuaaEEG250CJmg3XCpKJCs44j5Xc-B6WBB6W3iz04m03DuGZ3Yc04s8JD"
+"sCZ4kdXsRF04vW3DqaZ3i915v4pDnG3D92ACnuYDpCpCsO3CqWpCpumCB4Ki+NC0oKC0SO38j4ZBnWpDEOF4C03Cm4Z3QJH0b9jn0GIDka3CqaZDqW3C1l21pKZ47ZGn"
+"ox0uDG0Duu0xUWWCqCZ5qqW-B6WBB600tumXNWGEqWZ3CrHGEG0Dq8nQA8T5301Dk4JEvumlPm1CmGZCuSpDoKKEImi2aWpDoOJCt83DqSZ7WoX-53WB5300u4ER4WZC"
+"Eil4S8pDv0JEs4ZCYNn00KZ3Dm10sumAOG1Do4JCn8Z56PHOiW2CrW3Ev0pCq8pDnu0lCuFe4u3e40GEEaI84S3CXoD8mGJCs0JCq4JE1+ZqG90BpuoDoKJEpa3CvK3C"
+"EuX70GJ1lwm7AuWzLW1CoGJEuOZCEud7+RC0wOC04W3C1OC1vSZ35F12nCZC1rB0r8nFSeDB6m0DtWJEEWr300Z3N420rOHCJ008EKT600Z3OD10r4wV4WpD+7A125A1"
+"0WZ3+y14q03Er0Z36t11n8JelvW3C8zY1m2DkO3EoCpCv4pCnWZ3PY10oaOe0PZBpSpDuW3DnGJErKJCpaJC+p72+m724WZC1RA7p8ZCsW3Eu8Z3N-Wwz613ru2Dru0V"
+"IGICuSZDmO3En4JD1bJOoZHDmG3Eo4JCEy728SpCmKqP+lz0zjD1uCJecX0EvSZ3VP10tuW6P4qjU7l1KCZBsa3CnuG-TmWDuSpDE8r65Oi3-V10vuGhTmHCtaJCmSZD"
+"su-Y18qY100D1Oi3OX10q8nCGWWDnKZwFr11suY4lW10ouGcJm0EnK3DLp26u4JCpKpDu4gW4O3EQeO6+pO0kmO0Iej7EaJ2aWJCvaJCrKpCp0JSx9sGb8sobGWCk81N"
+"W01CmC3Et8niOKuYXY66v8pCs4JEsu0eaGWCruFDG84DG00EbZBDtC3DsaZCmG3DrKZDnCZ4PnWqYI07ruoDnCJCqWJ060HCnWpDt4gi1OC1uaZ3Yo14m0JDp0JuvMGt"
+"+pO0kmO0EGo50KZ3Da17raJDmO3Cu0Z5PdXsuU01o4Z4-d07vG3Cu4JCnKJOX5wP8CJEo8HQF0GCXb10vOHOJuVn0uIn0u09Nu0CLWIEoaZDnS3DmGJEqKcaEJN6E0w7"
+"iOJCr4JEma3EoWJCu8Y7DGpDsSZDn83EtGJDmSJEm4HO+l1AYi1A4WJEEit88GJDuuWhYuWoRWWCq4ZvUq04tu2CoSJO53GCE8V244ZDf1c3kT21qSZ3zX27oCZCvG3C"
+"sOJn4v-Y1qpY0aJvuo0ErKpCEiF4G0JDta3DMeJ5QFl10CJ8F7oYK43DuC3DrKq-1N44oSpDnOJei11DpSZCruFQ5u3Q5GGEn42ZGCJCsKZCEOL7bRL9h8jn0GGDkuGV"
+"Bum6e0mDEOE440JE5yQuGpHCuO3DtaJEouG+L0mC+7B625B60aZ4mzW3Pg13n83CpumWAW0Cs4J829jn0WYDk4JEnKZDuapDmuGYS0mCb0H06J0EuuWzBG0CuumtKW0D"
+"r8JRvvF63K764apCEWr9E049WC3EvGJEnapDru+7D0WCEu1AaGpDr8JEs0ZCmKJ1kwmyUWICt4JEvWpDpaZCqu03O4Eq+Vn0kSn0EOo5SK3DvOJEraZC1Gc3GPYvSM11"
+"oCZ3MTY36e03uC3EpeHyX0ZCkO3ErSpDpaZDuOJEI0W5+NC0+KC00KJOMW2Cp4JEraJEsK3Eo4Q2XeYqoR00ouGiO00DEe55KOJEuOJCsOXYV4EkmSJEtC3EuaJCn83D"
+"t8Z57+W-B6WBB600s4YAICn8SWJEnO3Cr8ZCISy6QBl1E0I2EK96K8JEr43CqKo316A2rGpCEKgBX9JmDMkp+NC0kKC00SZ39e03u8pCo4M6CGJEoaZ6K-WsRF01qWZ3"
+"NW22t03EEGL74OJD5fJmjG0Cv4I90CZ3J111vSZ5N7X-63WB6306u0IBsuoCmum1dW1CsKZDo03EMq12IRC08GZBruGfi0mDESG3GK3Cs03D9OC0ruWZXuW2AW0DtWZ3"
+"sVH2Nuln0uYn0aUk44pCEOM9GWpDpWJDEeN64KMBMBb0CKZBoCZ35l17tSpDsWpDmSZ6ct04qu2Cr4Z3sW26nSpCnCpCuuVrluJrlWmDm0JGI10CE4-88OJEs4Q7443C"
+"chr98KZBr4opS4JEpG3EnG3DfARHIH2Ev4JEpWZDuOpCE8h9XSY-C6GFCImDmuGSFm0EmGJCEGy6COJDn0Z3u2XwB602oa3DESQ4KKZDqG3EpeXOMW0Dk0Z3dw01m4Je"
+"9p0CqGJC5Xc-H9GMHXmDm8JONGGCqumEjm1CpO3Eqa3CnKOMIZM10OZ3Zv17sWZCmapCs8Z3UlGmu5ueW0JCmS3Cp83CsumAIuVXj8KXjWmDmCJ06ZGErGZ3o213m0ZD"
+"t4CCXYWq6300t8HroG0Em4o200Z31fX7u01DtSpCnW3DmOJCmK3Cq4Z-H9WHH900qu0aSu0KO0WDEWW5CK3Em0Z5-eXq6300ou0Hd0GDEapCE4oA8OJEv44dXm86nWZC"
+"r8JEmuWBNWGDm8Z5mJX-I9WBI9W3Wx19qGZCpSJEvGpDt4eI00J819DQ54ee8S3Cvum8NuWqI0GEM8V2XTX3bm15n0ZCu4JDESb8IiL2+NC0kKC0E0k7GK3DvGpCE4k5"
+"0KZ37sG1a9Tn000D1b31tKJGG1WC14GDAY0DsWZ342Y30Y02oaZD+3t3+0t38S3Ctu0H9WnCv43Do4JEEyl40KJG7uj2A0mDEm9CE4a60aZ3my11n0Z8s013tWpCuu0d"
+"LW1CoK3EvGZC+BA129A10WJmjGWCqu0ihuWEBumbX00C1nisMC01sCZ3Gk07uWJCna3EuWZ4VlGOMuW1WGXCoW3DnWZ-MCWLMCGvvwmPgGICtaJEmGpDrKZCbTXqBe09"
+"puYDoCpDrS3Csu0JdG0DvOXB9umJG0JCpO3CuWpCt4ZCtO3EISKA+Vn0kSn004Z3Wx12vS3EX-QnmI0CtKwP0KZpz314quoDmKZ3tx22q0pCEin5IKc71KCAqCZCu0JC"
+"uGZCsWZ3XTYSH90HyyoTb5sQ3nMOpDNQcbMPoDdFYKJEc4JEGmJRXXtL1S29lLdRqvZCn43Fl8Z400W2MKSE8npSq5sPbH5QoLsSez6RavJCk0Z3iN20n8nbAGGDt4qs"
+"0iIGsfp904XF+a80DW10WqHY14WXwc31t4Z3QXW3e937tGJEvGJDr8Z3rFZtuE05pu2Es0JDE8WCO8pCq8JDoWZ5fC11suY3he19sSZCrG3DqSJEpOHjHu-G5qxG04Z3"
+"aQ31t0JHdoXCrC3CnGJDv8UV4m0DkC3EEqcBGaZCsC3CEOO7EiW3Eq9B4SJDEeh7IOv70aZ3o2Y-7wWD7w02t4pCEiX6GO3DnaJDE4e6GSJDtKpCIC-CIBl04KZBEKN5"
+"Xo30uu0OhG0DtOn79mmCkGZCE0cCE8F6GWZCtaJEb8g-B6WBB6W31+14vaJErGZ3-f32vOJDESD7c396G8pCmKpCEST84SpCE8041eKPtI2CmCJCta3CtCpCEikE+lO0"
+"2jO00KZ3sr03oS3EpuGeMWGCo0Z3OfYt5301ruY3m6Y3fp25t4JDsCpDQW52Iy8Ee03DpWpDnG3CoS3D+FnA+CnA8SJCs4uzmWJEmaZCmK3Dn83Dv8Z44jXq6O04quIC"
+"tWZ35SX3w212vaZCMmk5e0IDkC3Dq0ZDq8pCECN848JDMaC5+-a0kya0EWy584pDo4GnEqn7ISV7UhO0O8ZBuaJEnWJWZZ0EoSJG05sm1lC9p83Ct0pDta3EmuVRBuKR"
+"BGICu0IEkKpCmKpDEaUA0OZ3SlY4cHXsA6GmoYWCqaZ3ex22r8JCf9i3Qw08s03EqKJCpOZDEOLEMGVD+hO0keO0EmkB4K3CEaj6XQ11vSZ3Ok21brYrUI03qu2Cq48e"
+"bI60tu0HDqYYGG3CqSZDXO20ruGOeu-fA8qfAGWCmuGlDu0RcuGSDGnDsG3CsKZ4TfWtB603t4pDsuW4u0HDtGJCr811VKoYEut74OJCEOwEC8JEtWJWxu-Y1uoY10WC"
+"EKj9SCZCoGJDo0pDEen78SJEo4yxIB334CZBEi4788pCvuGQ9G0Eru1M+mHDkCZDvSpCq429Eq0FIC93+NC0oKC008Z3ij00numesWGEmCZ3Oz21sKZ4OeXq6302quoD"
+"Xm85taJCtaJDEOc6X0H8BoXCpSpDqa3En8nm010E+7CA+4CA4SZCI0u70GZ38l04saJEo4Z3z4X4JsXq6302ruYDEeC4WWZCt0ZCsCZDt8XrOumWEGZCoCJDmaJCp83E"
+"s83CvuFZ1O4Z1W0DW8Z3nmW3LH34n0JEuaZ3dSZtcLW3eE40rumQcm0Cma3CP3F4quoDp8Z3rDY3Tl23oaJEv8Ha8uVe4qPe08Z4-z12sGJCEyK4OS3Eo4JErWZ4yLZq"
+"SFW35I42v0pDECD90KZ318ZBom06tCJEuKpCuumWE0mDXSY-63WC6308s02EkWpCm83DEe22KO3CqC3Dt4Q7I3b08GZBsuWCFuWcY0mDXqj579X3X420o4IZIyX3CWpD"
+"r8Z3-AX-53WC53W47V10mu0UE0oDm43CpK3ErOZvHkW39m31paZ3k545s8pDqGJCMCg700Y3ll21paZ3bA21q8JOuxlKPuZKPWmDoWZ3K312oSpCEKS64CZCEip90aZ4"
+"E0XqC60BsuICuK3EnWJEn0JDEWpB0GJYY23DkS3Dv0ZDoaJDrCpDECH8EuD2+pO0omO0Ca38jWZ3eO24sCpCoGZ39p11v4JfU8z530HDk83EruWg8vmNjW0EmaZ4DaIm"
+"FY0EqCZ3eJ21pOZ3RIa-JbXGJb12tC3CEWzA803EnuWVr00DE8hG0OZ4vXYqB606ruoCs0ZDquGlG01DqKpDpenG9GmCkum9DGnCraJDuGZ3maKQkule4qfe0CZ3f934"
+"sKJCoSZ3RKJeW0mCIq03INC0OGZBrK3EoaZ32y14oW3EnGZ5LzGGd5MBK83CvSJCsuG5vuVe4uJe40mCjZh36p13vOZDouW6h81VN8jn0GmCk8HTVG0Cmu0wHGGCpunI"
+"5vmtr0oDs83EoK3DuaZ3CYHPju-Y1uoY10mCE8P70KZ3HC23u83DqumoPKg1INn0ECK280JDvuG0Nu0Db0GCMO+9Xn2DtGJEq0pDoaJCq4ZCpKZ-dLWFdL00p8XM+0mC"
+"EiA5Euu20OZ3SkWvHbX3RD20muG26vmUTWGDn4JntvGV8WHEv83Epa3CE0i70OZ3dyZ3hkW-B6WBB600r4cU4OJEEev408Z3nN10p8Fx910CEGHDEqdEC4JEsKZ5uyIO"
+"tvWjem1CoapCpG3CsuW2juVn0uJn00WD1p24tG3Do4Z4EhW3rLX40WaqMC01ouIf7HXCvCZCsOZ8lUHJHnmDn4ZCECiD40pD+hr8+er80SZ47t40pu08a02EuaZDmK3E"
+"taZ4XZWq5300quGbzW2Du8JEt8ZDo4JEnen0o0WDEWYJe43CnSpCo8JDq0ZCMKJ3+3b0k0b0bVB0mu0XXWmDmSZ3KjH0lP+qKWGCt4Z3Ik31q8Z4plJ9GKoYCCJDt4Z3"
+"EO42sGZDEKOB+7b0+4b0Eys34C3DX2k3D440ouGoo40PIlO0EGkGCKpCs8Z3BL43t8ZCtqGnaGZBmC3Dp83DuWZ3Mb01sSZ45vW-B6WBB600qO1nN8XVw0HEqO3DmuW1"
+"8PEMCuGm80GDESB5ESJK4aZDI4435T62na3EIqJK0OZ3XnW-RFWFRF00q4ULOC3CpaJEu4Z3xE42uGZDbaYqA601quY3+Ha3oNa3iz30re1yW4M54C3DECeBEih584JC"
+"nuls38as300DbRB7oapCsKJEm8Z39r31rOZ4kz00oOzJPW0DpSZ36n17s8JDrGJEp8Z3YoGOLmmCt8JEEe6D8OpCnu0tBv-Y18qY14kj00Z3Fn23oa3DruWxI0WCIiKF"
+"QlO0GO3EmCZCEG72CSJEo8Z59aI8Bwmn1XmCpaZ32LY4dPX-QFWEQF01qGJmhuG-sGWDtumkFXWCn8Jwi9jn0mmCkS3CXy60uumAxWWDnaZ6wV2FruoCnGpCp83Eq83E"
+"oO3EqO1gBulP5qhPCGJDW4Z3mt10uu0A4nGDtOZDEis8UNM1EuR48CJDruWu21XDqS3Er8Hkc0GCESW74C3CEOfEGC3CoOJCEi06+lO0+iO0I0XHKK3CuS3Esumy80GE"
+"E4T41Ubq7e02qu2DEKGA0GZ33712vGJCQC-EXi80tuGN51GCE8OAEOlB+7b025b0KS38ouIDpuWWDmHEoWZCuC3Cv8nQAuTn000CIiPE0GZ3iH41qSZ5GwW3VP10nu0d"
+"n0GEEuJC08Z3FDX-B6WFB606u0YCk8pDnumAuWXDp03DsWJCIWRCINn0IC5DSGJCsaJCrWJE1b50o4WhE4BB4OpD1l22vaJDEKE9+lY16jY10aZ3Kl21n8Z3BX16t03E"
+"m8pDu81dQ8Tn0ume+mGEpaZCEGjJ8GpDveXCgG08pum7-mGDvW3EIO2FE8F51mj-QFGVQxWnDHmCkKuJEii9443EESmJXyks8o10suW0ImmDnG3DEuBL0GZ6iz01quY3"
+"l+40vu0DLuGQT0mD+lO02jO0EOSJ8SZBquWIAvGFnuGur0WCIqL9IpO0e8ZBo0pDrCJDmK3EEmnK0OJ9Mx0V8u0BL01Dq43Cm8nWa0mC+7l1+4l10KJvt2mDEi9JEKy6"
+"8OJEpuGdDuzP5mWDkKpCEK9M8a3CsumYEH0EuKAK1b63nSZDq4cAEKL70aZ4inZ-I9WCI9W47t46oWJCsC3CrOnciOX-IODV84Mn8OpCmumybmGEsS3Db+a3eu47u83C"
+"s83Cq4Z3vv30vu-JT8qJT0GDEqNL0KZ3gga3nd11m0Z3ItHWN9DK200DEKZG4a3DEi19IO9G9uQWXwGPhu05U0XCp43CtuVbzuJbzmnDrK38jaZBsumk+umgb01DnKZC"
+"o8XkZ8DB6WnCkaZCt4JCE0-9ICvMImO21OC8naZDmS3DoGpDEebF08Z54ea-YIWBYIW4jz02mCpDEOAGGSJDo8pCEiy4cZ53aOJCpCZCr8pCu8JenQH1a4oe4W3DE8R5"
+"OCJCq03EsaZ43Za-63WC63W3Rx12sOJCECo3GOJDrSpCEqL4UNC0X251oWZ3nA52rG3DEe5F5RHutYmDuWZ3VfY79fY-jOWFjO00uuGjYGGCnK0P4SJE1gA1t8ZuB603"
+"pu2Equ0yXG1EvWJEm8Z39PL0lwWG9u0wN0nDtGZDmuWlsuFJ5v3J51oDra38jOZBq0Z39H30tu0qcGmCsekV80GDEqm54a3EE0ZGKOZCs0JEuu0kF4KKEye4G43EnGJD"
+"E4X24WZC+tY1+qY1OO3CWCZBnCJOz9Hc-m0DrC3D1GcqSFW41050ouG+A10EEqq64SJC5f33WGZBouGaQmmDv4JEEGS444JDb8g-SFGVS3WDIuNLCWZCo8Z3tvX3OO41"
+"uSZvxe14nuYCuWZ3o843sC3DpuWz0vmeC4WnEG+5G03Dua3EEODA0aJQpxln0uYn00XCWWZBtumm511Dt8JDnumuP81pWeTB6WIEr4ZCvSJEpW3Eo4Oz9KC2tuICX4E4"
+"m0JDoaZ3kTZ4M3Z-53WC5300pu0s6nWCpaJDEOy6KaJDna3Em8XEQ8jn0mmCka3DEiFOSaZDmCZCt43DQuTDEewM0GZ4NZ04mSpCtaZ-gxYHgx25sG38vuoDESyDXbj3"
+"-ja5qqZq53Guu2mDESqO8KZCu81UkOHV80XDk0ZDqu0D7nGDvWpCIGdF1Yh-G9WBG900r4wPCaJEpGZ3eW25sCpDn4pCIO8FIRC00CZ3Zp2AqG3Cn8JDqOJDpaZ8PoY3"
+"fq32oWJEEetI8a3Cta+p+RC0kOC0IibFOOpDuK3CraZ3Fy01p4Z5MsZq5A11nuY3OKZ3kdY3sH41tCZ5U1Z3iJ10muWE2HnDqCpDqCZ3Dlb-C6WFC6GuuI0Eou0bc8HQ"
+"oW0DuaZvrbX3gw02mapCEqr38GZCquG-J5WhEyQH48ZDEycHO4ZCs8JDn8JwFx-Y1uoY100EEqc8GWpDoWpCEOD5E0G45UbqG9W3A+X3so30uum3910EEmAL5KC7puID"
+"n8JCuGZ3KE23oOpDuOXTMuVn0uIn081xavm0b00CEqgLE47BM8APQRC08SZDuuGBTHWCruGhZ1mDQK34GGZBr8JEEi65E0TJ88ZDqOn+Duln0qXn0SZ4Rv36t0JEpWpD"
+"m4Mu0SZ3ygav9e06r0pDtOpCmu0R1XGEqWZ56NZ33b00n4ecEKXE4KZDEmuNXCg-63WB63W4RvZ3xQH0A30DEG68Mq12Ux72CO3Cu8Z3WO32mKJE1eG0l208IqAM8CpD"
+"suGiOmWDmG3DMOeA+RC0kOC0IOJN8OpDmuWzuuWE41GDglP5aKZBpSJCuKZDmaZ3rn11sSZ4luG05J0Ctu0KT01EvOpCouGWPK0t+NC0kKC00CJOxXGEqCZ3yI50s8n-"
+"Y1mCXMWqMCW3PnW3U840n4Ah8aJDmOnjb4OFGGpCuCZDEuBIGGJCv43EbDl-53WB5300qumZEHICtSZDmCJCmCZCESnII8p2URC04aJE1dE0mu0YOv0x-K4KEui8Em7A"
+"843En4eg08Z5WvY-63WB63W4Rv31rGZ3lC26vW3Epa3DtOHpqej53WGDnOZ3vqX3KfMbB6oe00Z3e467mG3Eu83CqaZ-63WH6300suWZ9vmAGumL+u0OC0WCI0x4IlO0"
+"I4V204Z3fh10qu0L51mDIGyIE8w7aGZDr8ZCtaJEnCZ3g2a-PnWGPn01tSZ3Eh04q83Cr0J8guGmiG0Dmu0g98zY10mCEGw90SZ3opa5NRa4UlGON0GCEWAG48ZCE8wP"
+"ESiF14c-H9WCH908u0oDkG3DuWpDEiA4EmBL08Z4KpWq53W3Eh01n0Z36I40vuGIP1GD9lj36A13tGpDuum0A1XDp8JCqu-Rg8qRgOnoDnGDn4ZDE8-24GJEEOCIIWTM"
+"I7b04SZBEOuN8WJCtuWlqGGEne12eu0LQ0XDuSZDqumVWm0EsSZDIOvA+lO0kiO0EiSJ44ZBEGC8CaJCmCZ4JhY5j7aqEh07puYDqW3EnaZ4aAY32XX355H8CwWr8mWC"
+"sW3C1+30neHHXule4qfeSWJCWaZBqapCEuD2O0pDoGpDtCZ4WbYqB604ruICm0Z35g11pKZ3W-20sOnnU40t48JEI4XEISSP0SZ54WX-53WB53GutwmvN0HCr0JCqu0S"
+"WeEDGu02yGWCqu0GPvGtXvmSDKCBIm72CKZDn0Z34m30ouWak5m5+NC0kKC0Eqj7EO534G3DXz83q4JDp81O39jY100D1z40nuWO-GnCr4JEoWZ5CtGe73oCn0JDoS3E"
+"m4Z3h8Z5JYW-53WB53W4Tx15p4JCv0pDEGG7CSJDr4Zxfc20vuGIovG5vGnDm0pDqGZ4sgW3JkG0630EEyaI0GJfdv-Y1upY1K+jE01248JEEaYCE0q7bsXqC606pu2E"
+"t03DtuWgP10DEuU5MmF61X60rumigX0CrWZ4vPa-XPXGXPX5At40quWqovGU80mCECAPI4nBIRC04KZBE40280pCouGGgnmDta3CECb2bme3bGc3BD11v8Z3m7c-9eWF"
+"9eW4At43vCpDu4oyKCJDn0pCm8nCc8Tn0G1DkK3Ds8Z3GM41uOZ4w0M1kwWfEvW74HXDt8JEnOZ4hcY-H9WFH9W3Ux14sC3DpKZ3ubH8+8-1A0mCIOBBEm1400Z3JjJo"
+"hu0SdGGCuuWdImGDtOZCE8z3+NC0+KC0Ca38tuY3HTKG9G0Dru0wF81kQ8DV8u0Dh0nDu4JDv4ALEelL5uQOLumgW1mDEeoS4K3CE0wA+NC0wKC0EaSJC4ZBvKJmXY0C"
+"uCZ3UY20qOEOM0ZCkWZCvO3DoWJEnW3EEuhH9pY4ao60ru0EYHGEtuW3zOHOJu-P5qxP0aJOvvWR11GE1s34n0ZDpGZxp723ra3Cmu0KFHGEpu0bS0mCEK36Xi82uaJE"
+"EaaGEqJ500Z3Kcc-B6WFB6W3ss30nuGnsm1CmCZDqOZDne+W45kjS43Dn03Es43CXhZ4JEX3NnW4q+41uaZ3Uh02qaZD5kZ-A6WCA600pu0yPGGEtumG5vWbXu1f98T5"
+"3m0DkCJEES-J0aZ3nGY3dILnP7wUEGsE04Z3vFb37qJIcv-J2uoJ2Kkj4OJCEytN40JCEqNJEK13UV68EKe60KZ3zwX32512nKJCMOi7EqX2CWJEnSZ3qW51t8Z3XnW4"
+"4+W-63WB63W41O36paJDvWZDmumhhuWFm5MaQ7v2K8JCp8pDoumrX1GEEKdM1eK06Z0Cq0Z3Hx51o0JGK1GC+B5E295E8aZDWuGFC1WDEa724WZCEKs688ZDr4gu0CZp"
+"k422suoCE4P50GZ3RH11tOZ34kGO5xW+D02DvK3CsaJCqOZ3LwZ-ZtWGZtW39t46uuIDs4pCuumMzmGCuCpDMyb3IRC0C8ZBtKZ3+Z31mWZ32B70seHUfX08ruY3eda3"
+"C1HuCuXi7vlK2uYK202EWaZBsOZCoaZ44J24pCJDpaZ33gWsTF00suW1w10CEqzQEyhAYer94WpCEiKPEGL7CCZDsKZ5JfX-53WB53Gut2XDrK3Co40WEaa30KZ49KYq"
+"53W30Tc3snZ3cl60tumZrKMnECk2XV01o0Z3AI32s8JCI41D+NC0TKC0uumnDH0EkumNe1nCq0ZCouW5K0GEIij5Q3b01jF5pOJEqSpCE4U3QuH3Ea2V0WZ3jb11pGZ4"
+"hwKg-v-Y1apY8W3CnumVZWmCvSJug10CXQE1sWZ4dXXq6300suWHv10CEWu7EyG94GpCMKY6IiV3EqVI0aZ3HX32sC3EMe44+RC0kOC008JW0v0eXG0EmuWFQuWXD9Ue"
+"4uGET5+jE8Z3C43Cv8JXh7GnIi5TEGtBCOpDmCZ6Y8d-53WB53W4kL40ruWxc5+RCWpCqSJA1fzY1um-lvW5UGWCuumxzbaEXi85u43CvCJEEGYS08Z3DAHe+vln0uYn"
+"0u0WLvW15HGCo8nOiu0mQumf98Tn0mHDk8JEoO3EpumUyGGDnuG1y5WhEOYCEaFJEW68EGFK4W3DIK92+NC0kKC0EiaBEGRPbUX3+Y30m8HNE8Tn0umG94EjS03ErS3D"
+"sSZDMWa55T63oWZCquWHE00CEyE5bxi-53WB53W4KQY3lF55m43Cs0pCEaZ6Iij5IRC00KZ3WW20uuGCJHXCtG3Eq4Z51nGOtXXDpCpDvWJEEyMH443CImgB+RC0oOC0"
+"ISSJ0GJmbI0Dm8Xp+HWDtOE6U00DXU61pOZ3Nx41vOZ3paIHw44Q8GpDqu00p4mO4W3EfDl-C6WBC6W3kz03qWpCmumFa0WCEKgC00Z4FmWq8e00ruGnG5Cy8WpDnumL"
+"F00CEWn21BF0su0tGvWNnvWAoG0DoKMB+NC0kKC00aZ3mYX3dt20mu0l52WDE4iWbieq6301nuY36570tuGVBvmKZPncT4KK0aZ3yt50nuGSM81Hwu-53up530GCIyNL"
+"4OJCEW+GE4xA0CZ3jLI8h8z538HIC10CEOyW0KZ3fn40v8n0Z4WnWWpDoOZDo4ZCtumyEHmDq4GO+pO0kmO004JvuYmDm0Z4fLY3Tha3U9atWqW3a652sapCES-F4W3D"
+"E8i2XTHuKvmNT00E1404tG3CrGZ-C6WHC6W3cS13n83CvumD220EICQJ04J05BzY1m0DkOJCEi6PEKWPCSJDpSZ8FN22pK3DE4wF0WZ3Ko13qKpCs4CH+Vn0zTX3cqKG"
+"DJWDqumcGuG7Z0GDMuuBIRC08OZBo8XlKGGCtumpwHGEoOXcO4Gt4C3EEe78Eio280pDq81f9uln08Zn04Ek4KpD1A52mCJDI0AU00Z3BPYsKk00puGmv0mDEiTECapC"
+"maJZYwm0O0WDEScDC8JCvCZ3uBZ-SFWGSF00r8XgE0GCIKuV04Z3t-Nea3GPQ7YM0CZ3WZ50muW5oGmDseYkzumjYH0CouG0320CEGLN0aZ4iEX-B6WCB6W3-Lb3iHX4"
+"Fk03sGJCsOXHi9zY1uGb1n0Dp43CEu2FEmxCImP71BF3sO3Dq4aQ04Z3aBX6bUZ-MCWBMCW4nL40s4cUEGgC0aZ5VkYtXI01suY3XS80r81SQvWg7QHB948k44JDIi7D"
+"0aZ35L30puViOuJiOG0En81yaHnCsaJDtaJoke+7eu0QWmGDqOZDEC580WZ3zEOWh7EkE4lXEG924K3EEmpGMeL2+lO0kiO0EaRF40ZCEmXF403CESTZ483EctUJEmKI"
+"4aJCIemGE8RK0aZ4n2I8Aw0vQ91Kr01EtKpCpOHM9uVn0qHnEWIJ0KZ3kG31nKJGB0HEqSJDtOUMC0XDkCJDou0YivGq36OZMK34EGmW80JEmu01RGWDp4OG15h-63WC"
+"63W4KQ21s4Z3-j11v8Z3pJc39dWtQT25pu2EoGJDEOCSCaJCmGZ37fHmR74Q4G3C1-E5rWpCu0JCjDl-C6WBC600ouGwI00EEaiV0WZ3xEb3ZOM819Ty600DEK624GpC"
+"E8SKCaZDo4Z7gj31suY3y6X3+e12u0JCEeUTE0z3+NC0oKC0OC38tuIEu4Z4od10quW3jPn5U8TpA4Gn48pCEawH0CZ3h170s816cum0su05F1mD15B0t8XS5vFK284K"
+"200DEyR4EmYFaK3EsKZCmOpDnWZ4gBXq6309tuIDq8pDoWpDuuGtUuG4Bs4KC03CuGZ3yQ14nW3EuSJoDw-Y18pY1K+jEK9CC0JCtWZ3QE70uOneN8jy6GmCkuWcCumv"
+"G1HCpOpCmeXQB6c58C3CnuG8o1GCEWGP04Z5TsY-MCWBMCW4Cv22uaJEEW4OEOcL00Z3NAbvoR00su0dOW0EvGZ3UJ80munD611DkaZCnum7o1GDE8rA44JD+FB6+CB6"
+"4WZCEmaBEmMREaD20KZ5cZe3zoWqH903quIEu4kC8WZDquWG9G0CpaOeC4ZBuKZ3Pf52mOpCE8s6M89F+lO0oiO0EmaB0KZ3kp12m4ZDEuR2EqpaUVW2EOi7EimB00Z3"
+"qX40sumL9rc58KZCouGA1v0FavWni4ow+NC0oKC0Ga38ou2CEOnGWK3CoS3CtaJDu8Xr29jP5uGjAGGCtuWT1IWCpuGwD8Htcu0V8uG0O0WDEe2VEC2A+ZmM2XmM8WpC"
+"muWrXv08jumdrG0EsuGjuH0DuuTy6m0DkCZD5k90num1HvGOMqoYCGpCqCZ36v02q4JDE8PY14c-B6WBB600p4uFEGPG48pDIew4Eaw5EqH3QNn0E4ZHC83CuaZ3uFZ3"
+"DaL153WDEe6EECyEEWAH8OpCp81fauVn08Jn00WCEO+GEaZ60SZ3-b32pCpCEyXPglO048JEEG0IEOoV4GZDf2R8dmmCmO3CE4e40SZ30n60tOX+DulP5qhP0CZ4VJ51"
+"rSZ3wd50mumNVG0DrOneD9DB6uG4l8XlH0WCEe+A4CJDYWW28CpDuu0UZGGCou0Na00CbXd-63WC63W3Ko50mu02d01Dm0JDnu0dUu1tFPCcp56tE0i708Z3eb93vC3C"
+"s4IrEer9EKZEECDb4WZDECJEnUi-muc7mu61uCZ3iJ60t8H8WHGEr4wP40ZCb0aqXI01quY3pF17s0JEsGJCmSZ3UXJPMuWl7oGDsOJD1g40su04Pu-s38qs3u0bSH1E"
+"pCpDtSZ3Wy03nS3Dt8nvI8zs30GDEuYM4OZCEuZW4WpDEGwUfjD2qu2DESVD4SJCEuY70OZ3VdN0SxV53uI530mDEyyMEy6O0OZ31a92nGJEMmi2IJn04GZBEGX98OJE"
+"nuGq01WCEq-41uQOhWGEvKZ3Bk05mG3Dp4JC+Be429e4MOIJI4q24KJEE4fC4WpCM875QlO01uA0tu0SQ20DEu55IiP71Oi3z6Z3QOe3zr62mC3EbnY-B6WBB600v44j"
+"0GZ3lHf3FD52oSpCMGaMINC0ES5340ZCE4hV8WJCnuGKvLKEEip5E44404Z3BUb3Bne5pxX-53G7530DIGo5K8pCsKZDo8XVK2WCE4dLcli2EG49Em+V00Z4z9b4n2Y3"
+"p0HPiZWDmWZ3aZY3tEJGevln0uYn08Hkz4C8Xn82tGpCEaP5Q8O36RM104Z3c050s8nA900CEShT5kU16Z2DsCZCo43Dp0pDtu0cSwln0uZn08HS5HGDvuGF9W0CtOZ3"
+"Q1ewVW25puoCn8pCEWAbEizL4GJDIOpCXT10ou0qF00CE8+6Em5b+3B621B60GZ32OZ3DX50m8HMCuW-h0mDEeeCQBA10GZ3xm00puWz610EI0GUXG71WKZ3Owe3Mic3"
+"QDb3goHGowVK28JK28X0sumSH00CISL4G8pCqK3EYxR448ZBEyXc0WZ3Rze37981tGZ7kz00nu0HE0nDnKJDquGzbvVt3OKt3WHDWqIDk03DEmJV4aJDEac2E4EDUZW2"
+"4OZBEiZMES+GC0JErWZ3j+O9CY0DkSZ3vUc3BM90puGvHPH4HuVt3uIt3uGNqHGEuuG9t810-mmDpCZD1idszX04vWpCoWZ3jz00tuWsGsEkE8pS0SZ3GZe3TL80vuH8"
+"0vVn0uIn081XB2WCE0CZE8WOE4AQMatHIRC088ZBvumj02mCEa6L8S3DsO19z5s5EWM9GOJEtSpCEKGU0GZ5cNY-63WB63W3bSX3Wd90puWIf0WCIygeXQWq5301ruY3"
+"oYe3Uc63rS3Epum3eK4KEujD08Z32pa3AvY3l8L8ixVn08Jn00GEEeq4EmS9ESYUK4ZCqKJDt8naB8jn00XCk0pCt4ud44ZDEatV44JCMui2E0c58a3Enu0OM0HErK3D"
+"nuVgE8KgE0GDEyDL8WZDsuWmd9X5du0MsvDk7WHDk0ZCrOJEX511qKZ36kGABoWDkaZCEaaJC8pDo8Z3MIJPtv-Y1uoY10GDE8E2E0cd0OZ3YtW3vMe6nLgplfI8pvGA"
+"auWhVvGDE8oWIu0Ia10DEiO80WZ3tFd-cLWGcLW3eq40pu0pT00DEumT4GJCEWN4IeFNI3b0MSuO0OZ3KAA0rumSNamhEut848ZDE8Y44OpCEik200Z-0iXG0i10ru0J"
+"kGGDtum9Vw0F6XmCtKZ5FSYqtUW3DZY3jQ72n43D1xD0tO19QuW+DuGKQ1mCEmC8EipQMC92+3A1T2A2rG38EC3SXa35vW3EnWJEESaP1QbpG9W30iX3kw70vOHzG00D"
+"MSQ4EKFLeO3Es4ZCnGZDpSpDQ408+NC0oKC0IiaB44ZDEKoD00Z3RYY32wX3XZWqPn02su2CEOcX08Z38Fe3DFe4BPJ8BoWDpS3DEqQ70GZ3HZA0mam5+lO0kiO0IyDL"
+"EmC584JEtumBcu0Yc6OeIRn04GZBE8OS4GpDESr34WpDE0wIXOTm3vGReIGEnu0sA1WCE0kF1SX-63WB63W3cAg3Nie4Ds60t8H1FwmWA8j5300DEyeKEyfE04Z35zZ3"
+"qXO0kwmyyG0Cmu080HWCuumx810E9Xc-53WB5302u0YDE44S4CpCX4F1raZ3CxN8AATn0GGDkuWETIGDouGbkm0DrGJDQKUT0GZ3OOZ3CIZC5ZX-53WB5300vuGf9GWC"
+"vuWChmmCoSpDIuJMUd+512A0numRg9nMWHGDvOXuG4aP0KZ3gI40vuWTCXGCu0Z5OHY-53G753WDIe4PECibEWPe44JEEKo31LWsKCW3yxc30f56sKpDuKZCnKK-E4xC"
+"0GZ3gQ67oG3Dn8JDpOJgyvVn0uIn00GCEq1ACSpCsCZ4R4e3JbA1sWJ0y9jn0um03I0EruG1DuGx9WmCnKZ5xXW3+W62oKJDECbGE494QadV+RC0kOC0I41V8GZDrumK"
+"T10CEmWLEih6cpH30WZ3OoW3Pka34x30veX1AGGDkuW8ouGpFumpU20DQmfU+RC0kOC0Eqs3ESca4CZCIqMF44JDMKuOIlz0XHC0quGh8wWlFWmCuaZ5CSHOoJWDp81Y"
+"oumxyW0Er8Z38yW-53WC53W3ZSX4Jd30ou0zawGuWK4pQNC08SZDmuGJ8wWoRvm2h20EjM61tCZ3Agf30Ve3aUe4G3c-53WC5307r0IEkapDtGJOon0DqOpDEyeNU-a0"
+"ESxSECUDEWcU40pCE0MN5KC0puGrvvG3W1WCECB348JD+3K221K2EKIJ0GZ30i71qKZ40O91rGZ3clevcL03rS3CmuGLTv0e7w01ALWnIS8OGW3Co0JEEeAX4KpC+JzB"
+"2HzBE0lc8CZBru0qMuGUR0mCEmsCIOa3I7b04KZBE06TEyV40KZ3DY40va+dXrY35+74qaJEn4Z3LVa-C6WHC600u4CaE8758K3CquWxevmhTwzY1u0cOuWCp00CE8Pg"
+"E8L91eKORp0DpOpDMmAHEyyEISm3+Rn0oOn00aZ31mc39s42tWpDE815EiKIXAkqB6W3wEd3Fk70v4kE803EnaaEEOn68SZDouW0nvGV8uWC-54Q+RM1zQ60tuWfYIHE"
+"qOpDq4Z3xMA3sCpCv8XCh8Ty600DEaBMESk64WZCEWoTQeCAEWV3Eif6EW1T84pDrulT1QaT120EQKIJECx98WJEpum-L0WCYa276Jo58WZBmuGEkXmCtSZ3JG81n8Z9"
+"dwW32H20m8HuPv09cAn5Ru-Y1uoY1819NG0DruGZXYGEuOZ3lcYyU-64vGZDmKZ39Z24uK3CsSZ58PHGHH0EouGXroWCpaZDEe0j5ch-63WB6300pumG9m0Cr43C1uB1"
+"pCZ4tYJGsAzuDGWCkuWpLIGEvumbwvmKRbWI1b60p8nhnwmD1vG0E4GO+RC0oOC0IKo5Xk10oum09XWDtOZ3ap91brYuTF00nuGQ8IGEuuWIi00CQ0HJX+d3agd31LZ3"
+"-lY-X+XHX+11tKZ3pi01nKZ3ed31s8J1v1WCYZW2EWlB883Dnu0peoGEvC3EQuL6ICLDEyOM0SZ3Qne4JDX-YIWFYIW4vs33mOZCsumDPHWCmumaVAXcD8ze4GXDkK3C"
+"o4Z3Mr80tuWHC2mCMiUDEO92G4ZDqSpDE42G0GZ3HIe-63WG63W3Tx14qKpCrWZ3TYB0tuGVPLOGIRn0EWdQE4348aJErumsA1GEIag5XZh3XLe3GU50muG7ZenaSwFt"
+"3u2t34Ek4SpCEangI8oO0KZ3ZSct9e03qu2EtuWLW20EEu07XuNP4N4K08Z3lHX3PE22sKZCMuY7+NC0kKC00aZ3weX3aW40quWVHX0DuSZ35OXtRF01puY3TR61u0Z3"
+"0Vh3Qjh4+1H063GCEmd4483EEWGc00Z33cf-MCWEMCW3cq40ouWT7vWlKYHDq03Ds0JCbiYqMC00ru0vD0GDXUc3WYb3NQI0l6wP4WJDE8+WE8dACCJCv0J8jxFZ1u2Z"
+"100EMeaB80pDru0AgWWCo0Z3P2X3RnWqNC00nuWgMGGEuKSsCOZDv8JoM4WnECzSG4JEp4pCEmPBIOk4+RC0oOC008JGIvmV81mDEO8G0OZ35q70muW2AeDZ14iw44pC"
+"Eij70aZ3ArLACw0SF00CEyG400Z34RX7Zdh-OCGVO00EEOo504Z3fcW3Oi33rCZDqOXi6fTn0WWCtCJeowWu3X0DpOJ9F4oY08Z3MOA1s4Z3pdZ3B2R1SxVn0uIn0uG0"
+"s0mDEiUJEu1AECD8oN344GJDI4yHECy6EepCLAg34i71t4Z33WX3sia-3bWF3bW5dqK0VH0Ct4anE8ZK0CJmHgzY18HPouGG71HCta3Et8IvDu0Zq5u-4KZDbqIe3u-Y"
 );
-static sybie::datain::DataItem item5("haarcascade_frontalface_alt.xml",5,
-"OGZBu0pCq8Z36W05mS3EqWJEgAF1qKpCr8ZCs83ErGJDtOJCEyQ2AEJ3yCZCuOpCm8JEuCpDs03EpGZr9D00quVf18Sf100E1siUoJGfMuVy4uLy40GDEmT2a8JEpKJE"
-"qCZDmCZhnJ0DmG3CrG3Dm0pCoG3Eo4Zbqq06r0pCqK3Ds8nIFWGDpOZsQQW-22Xn2210tumjE0mDs5420SZ31X00tuVG8uKG8K8yiGpCsCJCn03CsK3DsuGLBOIeG823"
-"G4G0ku74yO3EmG3EuW3EqG3Dv03Cr4ZbmJ09uWJEmKJEmOZDt4gMM-I308Z-+1Xn+113u0ICs8XMGe6b60GE1G20n4W9+JU2+GU2eWZBv0ZDpK3EuKZC1h21o4Zgb81E"
-"rCJCmOJErSZDtG3CoO3DMQj3yC3EvK3Du0JEp03EmKZCmOZroJW-+1Xn+1X3lq00uuGAIesf1mXDWS38u0IDWuVE8OKE8m3DkG3Cs0JCv4JCpaJDtW3EMWj3MAJ3yKpD"
-"q4JDs83EqCpCo8pDrGZbED0DpSZCq8ZDuOpDqWJDmGZsd6W-z1Xnz116o0IDWW38uucf1mWCWa38E484+RQ06PQ005ZBuWZDoK3DmC3CvS3Ep0pDgsq0e83Ep4pDuKJE"
-"tO3EXKdbDD04r0JEu8JO7H1EtS3EpWZsqJW-+1Xn+111nGJWHx0ZBecJ34G90SZ4CkW-g6WHg60GpuoDvSJEoWJCmGJCtSJCnSZgfd06pCpDoK3CtuGAI01CsK3Es89K"
-"30IDoGZDrW3CoGJuCGWDrOjCD0mC+B846B84EcQ00GZ4jqW-3ZXJ3Z1Hnu2Ds8pDmGJEsSpDmSpCvKZDEaj3MMJ34KpCEi02SGZCq83CnaZDQcj3OCJEn4pDn0Z3Bk03"
-"uGZDrOzmO0mC+B846B84Eu54Eis2oHC61K24q02DWCZ-HDWIHD0GquIEnO3DsC3EtOpDoKJCtGZ4IkWbvLX3Pj0AqaZDoW3CsS3CnOZbHDW3X812t83CEmb44GJD5KZo"
-"jf10pu-WGOyWGGWDWOOg10WDE8v2+ZQ0MXQ0y0ZBmCpCrWZCr0JCn4pCq4Z3O0XYIk0Do4JDtWZCq0pCvGJDv8Z3QEXYTx01r0Z3Xr09nWJCoapDp0ZCp8zw90mC+B84"
-"6B84fXY3ljWRUQW6GFX-uLXIuL17jCZBrCpCvCZ3TS15pa3DpW3Dg2o5WO3DsKpCn8ZCqKCf0CZbVx0DqWpDoOJEsaJErSpCr4ZsVx00pu-XG8zXGaOqgbQ0IiA4E4s7"
-"+pJ32nJ3OKZBm43Dq4Z3+WW3+612v43C1xfbLk0EqOJCtOZDu0JEo8JDmWZCMMv2yOZCqW3CtGpDsaJEtCpDrKZrHDW-62Xn6215n038m02Dwrf108Z4LFHqSA37G4G0"
-"4mpN1S42p0YC1GW-6yWF6yW3OM1BuWJCtCpDmSJDtGZDESf3AQH1qKZCo0ZDuaJCtSJDnCJC16kYMK03o03CmumiBmmCqWJDEGB4MNS0+ZA46ZA4ECI808Z3uLXQiDG8"
-"cJWCmul2Aua2AGKBnuoCqC3DpCJEtW3CpO3CqOZhjD07m43DrCpDvCZ3N9Xeok04p0JCs4Z3Gs03nGZCtuWmQuSO8uVgGOSgGKMI0WZTrH21nOJPHwHTa8LR3uGqB4wD"
-"+ts02rs0G4ZBtKJDEis7S8pCsG3Dr0ZDIGw7QUJ14SJEEK82G4pCm8JCEKl3MoN3XB12sapDECw78SZCveDVDuFpGuCpG4IX00ZVE310n81mauVJXeKJXuGBAmHErOpC"
-"tGZDpuGCaGGEvOPf1mWCmC3DEqv7OOJDqa3EpKZc9520muW-BWWDt4J0jHGCoeTf1u-oGeyoGGmDW8HfG00CkXH1443EI4s5Ue15I1t00SJ9kN19+d0Aga0AXWCDo8ZC"
-"q4ZCoaJCv43Do8ZbOsW3Bt09qSpCnaZCo43Dve9cDuGBKmnCq0ZCoSJCo4kJI-j10GZ-f3Xnf310nuun18en10WC+NS0oLS0i4JDrSJDu4JEsG3Eu81KDe8f8WmDqaZ3"
-"Jp17oKJEq0pDmGZbff0EqSJDrWJDn0pCmC3DvSpCMZ550GZ-74Xo7410ruWeNetof4G9IOa2+B13E913GCJDvaJCEW2AGK3CtWpDs2a7KOJDp0pCtuW7PWWDr4Zb1O1E"
-"q03CqOpDmapDtKJEoGZDMN+70GZ-64Xn64X3ssW3IbXQCf00s4yqEy+2+t+2+q+2b+0BnSZDpGJEvWZCs4JEEyC4Agq0G0pDq0JC1FD5nOJCp4JDQ6Q0OaZDq4pDqaZ3"
-"Q021maZ3YkYo6f00quF1HOC1H00C1de396YQY600m4wCE813+FQ0EDQ0e4ZDrOJCra3CnCJDXWZ3vxYXtw23oWJDv4ejKWpCs43CreP-GWHDo43EmWZDEyk60SZ3bkYr"
-"oQW-z3Xnz3X3LzWUelG0ZO2nBuqT84W71GW-clWIcl05sGZDnCZC16A4u0JCn8Z4msWbxU1Dq4JEnOJCrWpDvKpCrOJOre8MF0IDpW3CtapCo4Z3mC11oaZrOz00quV7"
-"HeS7Hm08m0ICE097gfs0MGH90GZ-fDWIfDW3002CtSJDm83Dua3CuaJEs8XOPO9wBGWDo8H7AWnDsCpCoWJDQY+2qG3EtS3DmG3EsWZDm8pDESP608d839Z3X8J04KLg"
-"smVCcKYC0GZ--3Xn-310nuWIZeti60GCEWx5Emh908Z-qQWFqQ05uuYDpGZDEym8OapDs43EqOZgQv13r4JDvuG-9WHCvO3CqGJEM+O3qCZDt43CoKJEp43EpKJCXDep"
-"d6W-+3Xo+3X3lyWUPQ22n438E0JB+-q0Ezq0W4ZBpSJDnSZDmuGJh0XDm8JCtOw4MmIDuW3DpSZDtO3DoaZ3s5YaS31EqKpDv03EpaJCvKZCr43DMVp30GZ-S3XnS3HO"
-"c401gLF1XGg35AX-UXWHUX03nu2DmuGZpGGEvum1rW0Em8ZgrJ0EpKZDmK3CvapDvSZCqW3EM2L3qKJCpaJEqKJCqa3Do4ZDXDepEDW-T3XnT310u4OqEa87sTQ00KZ4"
-"3XW-e6WHe607puIEpGZCuWZ3ai24v8ZDs0ZggGHWqZYCuWJEo4pCrOZCme9HeWWDsGZ3Mv11saZ3b930pOz-V0GD+tB4EtB40OZ34XWSff30nuWpB0GEEKt8+tf1+qf1"
-"E4L3uCJCvOZDv83EpaZCsG3Et8vop0mCMGrA00Z3wI21sKZ3MEZZddW3pj19uC3CpaZDsKZCoOTSr0GD+l94Ml9404Z3oTXRCDW5R2H1duVf18Kf10KCkK3CuaZCu0JC"
-"sW3DsSZDsKycMg05qKJDu8ZDrOZCsGpCmKJCQIJBaG3DnG3CrSJCpKZ3qA10teTJ3uFdGOCdGWWDWKZVe600s46S1KY-c6WFc60GruICva3DqS3Cq4pCtS3DoKZgbf33"
-"qOZCp8nQD00DE8C70aZbQQ0Es4ZDuaJEpSJCnGpDnKJDM7a40KZ-W2XnW2X6ry30p8dJ30mCbei-Y6YLY622q8ZCEK87EWO584ZDs8xDDWGDrSZ36-15uKZCp8JDUAP5"
-"ECX2Xn75sOJDpG3DQVF1+NA46NA408Z3f830nOdc60WCICi61OY-FDWFFD02nuoDEu8GaaJEvS3CpW3DsWJXqRPXGGJDoOJEr0JCu0JDp0JDqu0Nheed6WpCv0JCv03E"
-"maJEsKJCpCZrFk00ruVXGeSXGu03yeNw90GCEmLBEmY4+dU22bU2q4ZBrSJCsSJDvaJDpO3DXbXfsq04qOpCpCZ3VP23o0pDv8X0Neuf1uGDDW2DrSpDoKJDoGJEmejJ"
-"3uVXGOSXGu0qJedppuWVXuVppOLppumAIm1DnCZCvaZCmuGIS00CIG84MkY4K8ZDuaZDmumt2H0DtuGSj89tE0GDECS5ECFCG8JCsG3CURQ0+J846J840aZ35mXUh8H1"
-"auWpauFz484z4m0Dk0ZDE4998WpDmO1319nske9z4G2DrOZDmCJCsa3DEuY7Ms0FqGpCoa3EvWJErC3DpS3EE8b2Atj30KZ-32Xn32X3swW38mXQSx00ruW1PuVG8uKG"
-"8mYDkSZDmGpDu0JCvSZ3lx30r8nBjO9J3W0DsGZ3pc07v0JEpK3EvSZbEm32sO3EIe35KSpDmKJEvuTc6ulWGOiWG8X6Nedf10GCIGND+VQ0ETQ0O8ZBv43Cm0Z32215"
-"u8JEm43EgcY40KZ35G37mCJEqOJCnCZdrP21pCZ39F30vumOjuWzmOzZB0WD+78467844C38EWN5ov7C1sk3lgX-+WWI+W01pWZ3sr38vOZCvWJCuSJEIKU2Qoq0Eau2"
-"WC3Ev4JEtC3DvuWKhueF8moCqaJCpC3CnGZDtWJ1reSy40WD+F846F84EiQ7+HT7MuFGImUAIqu2YiO6H401yyb4SuH7ZulgaeZgaOX0N0YDp8JCoO3EmWZaA912naJE"
-"E8z740ZCESV70WZcik08r8ZCu83Do8pDEyw240ZDM3A40OZ-W2XnW210qumTVOt1B1GDICW2+F1AED1A08Z3Bd05uCJCm4ZC1l41pCJfIufN8GmCuuWKDWnCqWZDvC3E"
-"Q6E6O8JDp0pDo4Z3M642n0JCMNaC0OZ-X2XnX210p4s844JDsfl3I45F1GY-LKWGLK0GjOZBp0JEq4JDo4pCtOpCt4Z5NvacMKW3LO49tWJEpO3Du43DtOParGJDpS3E"
-"v0JEt0pDmOJEpejPh0WD+BA46BA41lh3ejYWoHa4wMJgMu-y4Opy4uW71HnDoSJEv0Z35EZ3w2aYhB25sa3Cq4JDEeIGC03EqSZc6e02qSZCEq89S4ZCsaJCn4ZDQtq0"
-"+-94A-94XKA0oO7O8K0904Z3urGnvw-e1qpeC8ZBuOZ33fJur3XCrK3Du8ndGO9z400DE464W43Dv83CpC3CmuWRtuOO80JDqWpCmOJCmSJDo43CQt2F0OZ-V2XpV210"
-"nuGOQ8dI30GC1GY-jFXKjF12ouIE1t23oaJDrumGI00EM879Q6E64CpDEitKCSZCrWJOQeP+EuGmm0XDpa3Cq8nUaeThBuFeGOCeGuHCm88jk8H3A8Njk0WD9FU4auVT"
-"3qNTEK57E4s7GOJDt03E1CGWkw865W0DoCZ3V935vOpDqa3EUYH18aZDvumKSG1CraZDpWZtA7W-33Xn33X4v-a3jkWQ4312q0IEXai-6aXI6aX4Cn3BnG3EuKJCoGJD"
-"sGJCMUV7WGJEuW3DtKJCqummG00DQ29HEGtAOWJCnaJEvKZ3AxYswQW-03Xo0310quGN8uGEOHGBnKCcE5L31KI0ZuFf1e4f1GnDkW3Dv4Z39e56sKZDmapDu8nGXO9l"
-"6GGDqummamWDn4JDECCBQQL3KGZCoC3CmuWlGG0EvumKh8jJh0mD+BC46BC400JOb00D1KWQf6G1bum1PO1P8u4p18HyQan8+BH1zA11quIe70ICuapDq43Dp8Z61-Xc"
-"Il07rSZDp83EvaZ37W40sevQX8HefWGDtWJPnI0CpODT30mD+ZE46ZE404Z3oKbVkeW5qGX-48ZI483Gou2DnG3DqSJErCJEoGJDpOZgFA13rC3Cuu0SpWHEp4ZDuO3D"
-"MQJLGG3Do83DEueHK43Do4JDmOT+i0mD+ZC46ZC4MKK8o9y7E4rIEmY2+-n32zn3a4ZBvKZCp43Em0Z3wY12maJDgMQ0OGpDmKZDpGZ3fO40ouWR199pQGWDsuW9jm1D"
-"uCZCv4ZDoeTRI0mD+VC46VC4EuDEE0EEgLH1EGFJE877fIX-nJGdnZGCkCZ3OPY4D050q8nIOfw5U02DmOJCoOJCq4Z3y+X33rWaurW31+08o83Em8pDpGpCM7z20SZ-"
-"33Xn33X32eWUmJW4GFZ-lJWJlJ0Gqu2DtCJDqapDtaJDmGJDpSZ4HGXbMQ0Fr4ZCv0ZCpSJEmCJDvGJEt8fI38HUNWGEuWJmDZmCmaZsXXW-43Xo43HX9hN7FuWnQK0A"
-"ImY2+pq0zn42j8ZBE0JACWZDuWZ3jN22u43DIaW2MYQ0CCJCpKZ4aA64rapDmaZ3dlWZDD08nSJDmCZDnaJCECxFEay5ARI60SZ-53Xn5310r81Y49toQ0WDECxC+hc4"
-"Efc4G4ZBpOZDEmEJS83DsC3DrKJDoMJD84JEpuW8Au0EeGmDsOPJ3GHDp0ZDuSZ3Su14u4JCuaZr4a10tu-mGeymG4c9IufBobf1XKA0nuFwnu4wnuGC61mDX-F2r0pC"
-"EiVOEW64Es94e4pDtW3Cs8JDu83CEOvCI6F1OG3EpOJDtWZ3IP20uuW1FPjKDuVdGuSdG0WD+nBO4W38EO+EUG-H+-E1+yE180JCqumEQ0mDECkA04ZgMT64pOJDqCJm"
-"RH1EuKZDu4ZbnKZ3ti43tCZDtuGlpu04tOjf1uVeGOSeG8HYauVha8Uha4MIS8ZCvCZCpW3CEu398KJCm8PyTmnCqa3Cv4JDmu0kWH0Es48kIAf10OZ3R522mGpDEiLJ"
-"ESj6ABf10WZ-R2XnR210rumGIete18nQivmOXulXB8aXBWXCkCpCnOJDE0QHKWJDrSZCs8X-OOPE8uGcHvWVhmmCv4JDEKP5I2F1EuEQEKO5KOJDpa3EquWubvyf1u-T"
-"GeyTGu04-umSkesa60GCUC4H+7U225U21B90su0xjXXDmWJEpCZCQcq0OK3CnGpDpOZ3Ix03oS3EoOfSGu05jmGEuWZCEWuC8S3DvODv510E+B746B74Eqi3w5Q0UawH"
-"+3Q021Q0EypAKWJDuWZCsuGhHmmCtWpDgwi3WO3Dt0pDuWpDnumfH91eOeux4G2DsKpDm83CuOZDE0K60WZrSd00uu-SGOySG8HoT8nFXuMI300DIGu2EqF6+lI32jI3"
-"Xj45nWpDqOJEISyB84JEqO9b6uGjBmnDuWJEuOZCm8nGGfOf10IDoK3EtKJDmWZ3po10qumHAuSx4u-SGOySG00DESiL13dQa6W6xZX7cva-VdWAVd0GnuIEpK3CrOJE"
-"pGJDvW3EpCZhapY4Iw07nWJDtCpCtaZcs2a3vm61sGZ3y2c3zEXsOc20uuVTGeSTGuWBmu749vmBNuWADulI38aI30HDkWpDnumg9mHCqC3DnWpCnewE802Dv43EnCpC"
-"v4Z3ES31sSZbI+10suW8DW0Dp4Z4ha60qezso10E+J746J74I49GIqW9gzq0I8eGMWB6+FF1ADF1Emf5OWpDv0ZCvSZ6HQbYGx01nWZ3oX38oaJDvG3Do4pCM2U2Eqx4"
-"Iix2G0JDt8ZCE4Q8EFF1+J74AJ74EK89+Zf1gZf11Vf3ur63m03CnuGQduGaRe8f10HDo8pDmu0cL0HCqWZCoe9f1WmCsCZ3bFZ3KZ52nG3CQtqH0WZ-q1Xnq110vumx"
-"HetBm81cgvGQLuFy484y4m3EkCJEv0JCtapDm0pDtOJEMSfQMw32EmTHG8JDm0JDEqjS0KZ3TwWZ+W00tu03UG0EnuWKYHGDmuWgGuyI3uVTGOSTG0GCM8FQ0SZSlJGm"
-"xwmBDu-f18qf1mZCkK3DmSpCsaZCqWJDsa3CoUf10WZ3tEZ3O731tKZ3dLZaIx0DrWJDu8JEv4pCs4ZDnWJGHeyf10GE+d746d74EGs2+5F10KZ-8kWT8kGWqwWpB1nD"
-"tCJDtOfI30WCEKJAWGJEvSZDpG3EuuGdoveI3G3CoCJDpSZCtWJCtKpCrOTYl1GE+N74AN74+hq0ohq04qIDEWqP0CZ30W06uCZCmOZCtegu90GDEu6JEOBVE8BT48pC"
-"MIXEGG3ErCpDEu3208Z3Q5IGIuyI3u-UGOyUGW0CWaZ39qWRnJW4THY3PZX-VdWGVd0FtuYCsOZCnG3EnK3EvapDoOX8rOfJ3GGDn4IS4O3EEq0J0SZ49mcYED01pOZ3"
-"cl38vapCmKJEnK3EMFB60aZ-x1Xox1X6qfaVDdL8cwG7huFYBe4YB00CE0VV48JDECJK00Z3-YXax1H8U3mDEOF3G8pDoCZDE0B4AMQ0CGJEvGZ3bDb3i7OGW8jiO0GE"
-"+l746l74E8kF08J8-P7BD4If00Z-CDWJCDW3hG5AmWZDqK3Dr43CsWZg8zX4i241vKZ3a963vW3CpOPF8uGTq1GC1PX3Ku41sKZrJ940vu-UGeyUG00CESzG6kuJEGaB"
-"EidG+pq02nq0qGZBtC3DpOZCm0JEv4ZCEWZVc+39KCZDnKJDtu0CY1HDv4ZDnO9J71GDESFXaWJDoOZDp03Dm4ZrQA20vulVGOiVG0WCISQ7obu94C38Xg10puFZBO4Z"
-"BG0Ek4IP4GpDIuAGC83CrWZ4MSXbRQ01qGZ4Yt46ma3DpKZCtum2Cfez4uGLXWGErSZ3U912sSJCXejp1XW-+1Xo+1X3eObUbNY4xFc3ug60oKMJEz9B04J0V4019CY-"
-"KMXAKM12tuYDE4lKEyFN0GJOsG0CqOwR3WGDnOZ3Cd74oKZDvKZ3KcYaMr03oOJCpuWUcGXCnC3DmaZsJa40vuFfGOCfGuGpNfNo14m8vKgJ87W5qMX-w4YJw42DquIC"
-"mG3EpSpDtKZCp0Z3U-df8700oumfY0oCo03Ena3ErGZ3UkWZIEW3FB10puGaTv0-z00EQZ82+NC4+NC4+NC4+MC44GZBEStCEW190GZ3xg60s8hmimGEsWJEEWZYE4XO"
-"0OZ3rfXZd605sOJCsO3EEi3AEac9MJz2443C+RC46RC4Xb41p0YSi9X3oGX-h9XKh91FvuIEuaZDqKpCp83CvW3CmO18F8wt6WGDs0Z4fa60ouGoz8P55WGDrKZ3ua12"
-"oG3DIW2PMtiN443C+dC4AdC4Ee5J0OZ3EeWRNlW3pWb4lua-leWHle03muYCtumag1nCnCpCquGb80GCIkN3K0ZCvC3EuKYt0GZ3izebc600nuGCkn1DnCJEpOZDnuGt"
-"WfSX8GGCmu-nGuynGuGAS0GCovnAEir5+JQ0YHQ0O0JCp0JEmOZ3+qG8dgftxu0qNv01G1HEt0JCru0sle8y4u0npuWNUGnDsKpCtCZ3Ciaqa6W-53Xn53X39570numU"
-"fuMI300CI4xHU82HE962EC6HES9O+dY22bY24qIEEuXYE0jXESuW0CZ3IPbfYXW31Q51qOZ4KY33tGpDmOPDKWGDqWZ3fU42m4JCEGSI0KZrPs01n0Z-h3Xnh3H863GD"
-"sfP38O38v8XvKvV45OK450GCXW31o0Z3gN25vCZCmSpCgUQ0ESX7SCJCt43CpWZDE4YOQQH1a83EmW3CuG3DuSZ3TdYqHA11n0Z-h3Xnh311v0Y3igXS1zW4TWY4AYW4"
-"RsW-urWAur01ruY3X+61nCZ36R64ma3Dt4ZhHA10uu0-AvGXN0nCtWpCuO9UDuWZI0GDE8XMXHC0tumn79T65uFwGOCwGu062g7vKX0EWaZ35mZ-EDWHEDW3ZJ56uOpD"
-"sapDvu0lqGGCpug7F0nCoKZCo4sW0GZ6tVdZ-Q01n4Z3WP70muW-UXGCsGZtlkW-f3Xnf3X3t9Pmyfcl64m8EG35+lf12jf1GCZBsWJDE0UO84pCtu01A0WCooq0843C"
-"vu0ev1nCuOpCvu0zOeef1mWDoKZCEKEEO8pCqS3Dn8ZtlkW-53Xn53X3ipY3kwbRd6W36oa3Brb-pJWGpJ00vuWyFXmDm4Z3oa40qumx9AHtnevakGWCmuWSmu0nCvWf"
-"APPyiGnCs8JEq4Z3bm65v8ZCsOJEQhf1+JA46JA4E4NK8S38vucf1uG2-Kyl+df1+af1I0B9eSJEoOpCm4ZCn4JCECDSA2B9GGJEs4pDE4MPEGNI08Zcia92sSpCEaDO"
-"O03CvCpCmSZtHrW3ul10juI3BO3WgvFVSw4VSwWTG0GCEKGDgzE11GI89duxEnw20aZ4JZ80oqW8+t52gq528qoCkuWeE00CE4M5GCJCnKJEM89EMks0EChY48pDEqQU"
-"8apCrKcDAAH1CKZCuCZ3Kl20vuGeI0mCQxCG04Z3Eta-A7WkA700suWfp4ofgfS00OZ35nc3AbHABxVg1qJgSCZBvSpDnGZCEKXJ4GJEEK-BEGL3Qcc48OpDquGMCY0E"
-"uWZ3qCYcjk00vu0vcmGDna3DEq180aZswQ00nu-mGOymG00EMehBovw2QuKD+ZW2IXW2EilR80pCmuGOXw0abvgO8umkkGGCsumAmW0CvKZcmh11s0Z3Ym80puGcRvWl"
-"rODhpGGCnu-nGOynG00DEm32+5vH04Z3ni70t82WCv475KmGPCY-qDGVqvGAo00EEaCS0SZ3TAa3vHdbk620ouGNMw0ARumOo0mDQQN34KJCESgLW43EuW3CqOZCsuDo"
-"1uFnGOCnGeX1o8t+a00DXYX3S4a-OKWGOK09jSZBq8JEs4JCou0FzmGEtKJCI4c7QY35Em4K0WZ31n83u4ZCtufgbn0CuSZDEmuREarc04Z3XfWpVyW-kQgokQA0v4Q6"
-"E4s5g5i1EKiGEuSP+hH1AfH1EOvRCapCoaZ3rd31u8Z36na4ZyWcg60CqOJCq03CnKJCoKZCtum1nfuQ8W1DrC3ErGZCE8g2C4JCqaZsZyW3DSX-hXWkhXW3J-40tOte"
-"291eruGk7v-rB8qrB0GDEeUZG8ZCpWZDECWM443CwgC4CaJCs4Z3rh90ruGFHAv5KG0Dn8nuV0GC5W00vuW969TK3uloGOioG0mDEKg9E0wAg5r00SJSrvFg184g10HC"
-"k4JCquGEbvmvDwGE0A1J4ffkBWGDn8Z383Z4vK80tu0xTeuJ3mIDt0ZDo4pDoW3EvSZ39IXrbyW-nQgonQQXvxG79f6g18n919XsQu-9Fup9FW0EkaZ3eCg3Tz61r8Z3"
-"YlM9eQvz4u0neH0Emu0Ef1HEq4JCsev8UuW2a1mCE88HEmvR1KZqGDW-D3XnD3X44ha36BdQe6W3OAX-KwdLKw70ou0yQ2GEECVAO0JDnWZDo8JnV2mCIMY7aKZCvaZD"
-"mCJEpaZ3fzJW3h8K3mmCpKpDEu5MC43Dt8Z5sbape6W-sQgqsQg3iteSRGX4PnX-6XWJ6XW4r911q8Z3sd21p8Z3IHfb1962qaJDEq-LC0JDvOZ3MHXbmd23nC3DsuGb"
-"R2HEoW3Dr8XR0ATe1uFRXOCRXKOy+hU2chU2G0ZBm83E1vD3r0JCm4c6MIQ0KKJCnS3CtuGOl1GDEivbEscE0OZ3CR26pOpCt43CsuWaA2GEIyfCMtzC04Z-mQgomQA0"
-"ruX78ecy48XG8uFJ385J30WDEu1T0KZ3eF45s8pDqapDkgCLEK5H0CZ3glZ3Y0A0pe9LIGmDm4SnEq1F0aZ3midsK910ouFhGOChGuFxkuFxkG0EkumxkomDsOpCEekB"
-"8SpCnewwk0GDEy1704Z36v74sO3Er4Zb4u1Dp83EoWJCva3EsC3DpCZ36qdqxJW-E2XnE2X3WNa3hjbQHDW3E-X-g+XKg+10jumaBu0uEuWmHumbR10DIiU2QE42CW3C"
-"vWZ3DF11rKZ3XnXcxqW3++83pa3Cmu0ZHXGEqOZrJkW-uQgouQA0ouGJN0GCEyl8gbQ0IKc9IqJ6+Nv22Lv2ES424CZCEOrY00Z3uD30numlIf8lQuWiAHmCsumKgnGE"
-"pWZCUYOD443CESZTK03Eu8pCt8nvW9DJ3uFKXOCKXOX0RwmlefMf18X1q8XAUuVf18Kf1m1DkWpDvGpDpumf711CuC3Cu8Heae9zO0WCEWWiGO3CrKJDIuqZIg84KK3D"
-"n0JDv8Xfk0WDEiGTQ-q0+h846h84I8QW0KZTo810n408Xqi-A2XGA2HOD1GCEele4S3CEWOD8SZCsePDDWWDvaZ3+Hf3kN90qe9vFvmjPHWCnuGlGomDuCpDEuzHItq0"
-"+7L867L8EOy9wTl804Z31yW-uBYKuBY4To45vOZDsWZCEu8TEyN2c+374KZDIGt7EOOI883CsePG800DEecTK4pCmOpCu8Hr4fzI3uVXGOSXG8Xf7vGWae6z48nFSuW2"
-"fv-I38qI3GWDkum7O1GCImkS0SZ3kDXhfd01p4Z3SEX3s+42p0pCQ6A9E4KEeOpDv4ZCpWpDuGpDQhl8+dhfAdhf08Z4efc3-HYQf600t4G91GY-f6WGf6W4ax08vGpD"
-"oaJEpGZDEmLKIIF1ECDBOSJEqa3EnaJmOQPqJ0XDrSJDtuGWTvmMG1mCXcYpqJW-sQgssQg3WSXVJth4t7Z-7dbM7d52oC3DEOaLEynP8OZCvOfc6OPB8WGCpSZ3yq20"
-"puWLFI0Euez3NulecgiecAnr90WCEiydgfp000Z4qdg4IPd-HSXFHSX4NzX38cA4mK3CnSZ3XEcbJd06m8pCtGJDouGvT0GEEyJPIQQ0E8vYaGpCmWJDpW3DpOZ3kPYq"
-"yCW-p1X-p1X-p1Xnp1H8cw0u7o0Ds03CEqJ74apCM2JD8CJCouWJp00CEyI8EW1AIQQ0Ei-4aKJCn4JDp8ZCn4ZsOk81nCZ-l1Xnl110t48lwHGGI40jEST2+Ne12Le1"
-"CWZBn8Z3rXX37pb3eA20pewoxGGDm8HnhvGh12WDEeBEIYQ008Z4Uj21raZ3ge52nOpCQRT20CZ-27Zp27Jn9AN5c0GE1El3bAY-e6WGe6W3+qA0vumIeH0Crumo+WmC"
-"pWZgP8X3qrA4nGpCtCZ39YA0oePEoo0Dv8pDEyqRO83CsGZCuKZsAx00puFTGOCTG8XldumNQe6d6816YvGwnu-c68qc6moCk4ZCrCJEt0ZCoWZ4Ope4cbYc1F12nCZD"
-"IiKRG0ZCnWJDE86gEI07E4+TE0DJGWpCuCJCY-t2+B746B74E8I3IKy4gXQ0IWfSEGl3+7r025r0EyrW8OJEsu04jv0MP1WDkoF80KZ3LLB1qCZ3fk50vumxkAP+4uGP"
-"QuGs-I0CquGWaejL4HGCpu-TGOyTG00E1MTOie6g100EEOdLEyPF+ZQ02XQ08qYCkuWZe10DEard4C3DEqz8ICy4M6r0WOJCs8pCpKZCtumi6IWDvu84SuGsCp0Esa3D"
-"5nX3jaXtYQW-u1Xnu110v4IXwzbB44pC1KI8gce+EzmA0aZ3pxG6Zu-3huo3hGGDkum01JmDvu0MY00DESgcosS0ECyW0SZ3gAC0rumjaOfT3WGEo0Z39G65u0JCqWpC"
-"ESfaEtx2+tcfItcf04Z3DYZSKi20n4Ig+p2CIn2CIix2EKQ2ESwHCaJDt0Z3HYfYUZ10n4Q504Z4etMePO9Amum0gYXCr83Eu8JEEC5qQ7a4+pafEpafEeYOI0kUgjH1"
-"04Z6Ye80ruF75O475G0DkuW25I0CsuGAmomDqaJCMCVdMkH1GGZDuW3CEmXHEmCp00Z3GhdYiXW3u830mu0IhGmCrumQ8ujg1ulqnOiqnumpzAuldumZLulYWfaYW1KB"
-"ou2Dt43DsaJCma3EtSJEquArTu0iLwG5S20EEqckUUrbGK3CmCJEEuQm00Z3iFZ3lhXqrJW-o2Xno2X5YZXUZrW4DMHp-wFd6u2d60nDk43CpuWdZvWIqvmsx8n2FOPM"
-"IGJDuKZDpa3DnSJCt43DtuPENmoDo4JDpC3Cs03CtCZuYr00qu-iGOyiGuWKputz44w6IakU+BX269X280ZBnumMtHHDrapDv0Z3u6ZbKD30muW1iH0Cmu0W9ZGEmKZ3"
-"oGXYoJW3hfZ3nWA2sGJEESe9Mh7J04Z-qOgoqOg30dW4s-iRRQW32Kb4CEj4XMXJCeW3ZLJ6Yu-R3qtR40ZBECfNE8BD4SZCEuk3E4H3A662KKJCpW3EpuG-xG0Ct4CX"
-"IMW2e4pDq43CmK3CpCZCEaalQlC4+BbfABbfEel3IyLmgLS01GY3VEbR4700n4C-0WJ3ZuVn1qJnESY2EqqCCGpDqaZ3mRj4A4dY6705tCJDpOpCEqOZCC3EoGZ3rHYZ"
-"BE00tuGEmGGCuuGQkHGCq4QcIRj1+dE46dE4IeJc0CJ85gsn1u0stvGfv1WD+RQ0APQ0CGZBtGZ3+4b390B0ru01BB1vgO9AA0mCX-01mOZ3rv72u8pDE4K3AkQ0GKZC"
-"v8pDE49M04Z3DHh39BXqh6W-i3Xni3HWlxWgf8tTD4G9Eem8c9t0IuJBPCY-oDGVonGEkaZDEK-2GKJEsSJCX4j4U-XcbY02o8pC1VC2u03CE8UmMoJ1EOmp4GZCEyug"
-"4GZCEi7gMRO8+dffAdff0aJm-xWjHfMT30GEESd9+dHBIbHB0WZ31x21q4Z3ea90mumi93GEIGbEMEt0Ee6CEueBKGpDoWJEoe9wbnmDo4ZCEyC50aZ3RThthR50nuVc"
-"cgSccwFPPwEPP20EE4CXEiNP0SJmEwWImQAraW0DqGZ3Tdg3FJY3bXbb5OX3QkY3uB14maJDmGZtouB1nKZ-G8ZnG8Z42XW4eyZQFD00nuGoYRIs6w4KAGGCo8nSwul3"
-"Cga3CoGEkCJCECXJW4ZCnW3EoKJDtuAecuWZ9XnDn8JCvOpCE8dCIQb28GJCsuGHLH0CsuWwr0GDUZ18+xhfIxhfE0YboPs3E4kfE4xW+tR36rR348ZBEmZR00Z3sA12"
-"nKZDEymrXDdbPK00ru0Zz0WDEm7AEGurES52Ao828GJDsuGDhXHCnaZCmaZCUlF9+3ifA3ifIKwK+zy5ECVNISZPY9S31-T6Yu-Y8eoY8mGBouICEKgTESf44SpCEWsS"
-"bwZbB700qumwXwmScxWjEHGEte9vXumT5IGDvuGXSxW5EgTfr0GD+7J467J4EiKL+jS01GIEew4F54W71GGAixlo1eZo1WGDqOZ4Ii64qWJDuSZh9P13pSJEnuWBMwW9"
-"2IGCtum7deOb3WHDoKJDvapDEy-38C3EtuTrEvl1dwi1d2mCEW8Hwv58EGbAEalTUOA5ErS01aa3nsN4au-p1uop1GmDkumof10CEaAv8KJEouGAHeAP5uWiru0GPvWA"
-"DvfG8X0DvKZ3+Nb35L60vummIPT9CulBdgiBdwep1K09Ea43fXdJD700ru07aan8+pS0zmC7ouYCmKJDpOZ4I253p8ZCveQCTG0DquGc69Xz4X0DnCZcaiD0ruGwP3mC"
-"ECLAEm1dEinRElx3+FrfAFrfMSx308ZU2BZ5wgY-sDWJsD02nuYCEa384K3CEKX2CSJDtOZgot02rGJDEOceIeBNE0QJM2e20GZ3VDk396JOpwG1N8jg1uVPHOSPH0GD"
-"1Ri4BxcQCnG0b8XET8Ms84mGMiO49GY-sDGVsXGBruY3EPB5t83Ct8pCEq5moEyQEqzm8SJDmu0e9I0EruP6lpWCsC3CEqwfGC3Dq0ZCEu9IItS0+Nd86Nd8IiArEWV3"
-"gnS0IeOiEWe2fagJ2LW4csK6ZuFp1u2p1uWSCuWjIpHEq0JCuSZDvuwov2GDE8Qn40pDEalM08Z3rfXbPEW3PAb3Y632oSJCEuSkMxm1+FwfAFwfI0cow9rEXPNe0vlJ"
-"OebJOGnDtCZCtKZ3pT70uum+r8f4p00EE8-pGOJDuaJCE8ZDEqG5AAe28G3EnuWS2x05QWWDq4ZskD90nu-edgyedwlYHulYHOeYHuW5QumDOx0rtwGDp00CQccX08Z3"
-"q470nu0y3nmCuOJDQccXEiqlEO4T84ZCquGS0fD5EuFfdgCfdAnfi4eygbJ1IW46EKQ7fcZ-MKGlM0HCk0pCruWSNXWDrKZ4l7fgkC11qCZ4IgW39k10vumib8P55uG8"
-"S20CEiqJ0KZ3jDXtXDc-cUgocUg6JjZTJe10nOHltvVWseKWs0HCkCZCr8Xs1nGEvGJCEWjHgoS30GZ3Aw20numI7HWCt815O8P65GGEqumdMuGfjvGingjl6uVPHuSP"
-"H0GCEe7QofCN0CJ0aWmCWaZ-HDWHHD08jWZBmKJEuSpCEWEeGKZDqa3CkMt30SJ8cY0Do8Z3Wc50pu0vhxOg1WHDtSJEnWJEEmPMEWIDQdQ0+hqC6hqC+Bi1+Bi16Ai1"
-"Ey8GEG290OZ3zzW3Gz90m8PY8uGuH21EsS3EtuWYO00EQUS0EqbE0GZ3HL84qS3EnOZtwlW-BVgoBVg3rlWVIeH0aON4Qu0mTcX8+Bk1TBk36YW32e80tuGAw0WDEWkj"
-"MUY948ZCE8y3E8yCCWpDmaZd-sW3nkD0mu0h0vmIaxmWA0WS6Fho04Z-fVgpfVg3MXJ8cgcX8u-lD8-lD0GDEyyz0OZ3KL41vGZ3uo70neQ0J0JDmGpCq03EoS3DsK3C"
-"ImXWATL18228WmZSfT6QqzbTXncFmuYDrapDrS3CtSZDvCJEpaZCyyYSLu12yyoN5G01A0I31G0FVb134128y4IBj02ToLMPW4ZDu0IBj83708ZA0q0BW8tRlH78kz6P"
-"bfJB0G28WmZPb56Tr9NPkC401405y8NPZHtS+O1000I09o2CW43DWO38p0IBnuI0fMHfH401yyL0aWHDWO38n0oC5C21yyYKF10AyGNQiHNPav3CyyI3AG0Fl85a0m7F"
-"qXcSbD7Qln6P+q2Ck0JCnO3DuCZCva3Cs4ZDrO3Flan7oq80Cm3RbPMClHaCnWZDoW3DvKJEp4ZDoK3DyyI5TO3D0u2f1m3DvaZDsKZCv0JCnSZCsC3EQJQ00aZEt5W-"
-"a6WXa607n438q02DW8ZRa601nCJ1YWGCW8J9aAZ114G04mpN1S42r0YCLCY-77GF7ZLCkGJDqG3DtapDu4pDs4pDsKJPj03Cp8vo1mJDm0pDsWJCuGZDs43EsKZCIkS0"
-"yKJDmCpDoSpDvCZDvCJDqCZrB701t0Z-B7WmB7GP6Pdo1WmDW4J8awVR3eKR3GaCkK3Cp0JEma3DrKpCu4pCpGJ8d20DIUQ0yGJCoa3Eq43CoaZDqG3CnCZbd60EoGJC"
-"sS3Cm4ZCqS3DmO3CQVQ004Z-d6Wmd6W-oDW-oDWWoD0HjWZBoa3Ct8pDoSpCrOJCmO3CgoS0yK3Dn83EsWZCs4pCpSZCu0ZaC70EqapDqGJEs0ZDsKpDm83EQBk14SZC"
-"+pS02pS00KZXzKG0ZaR6EnJ10SZ-xKWPxK0FmWZDo83CvO3CnCZCtSpDt46bMkJ1GGZDmKJDXd35qCZDrK3DMYS0yK3EtaZCoWpDn4JCoWZCpKZsKE00puFo18Co1mGC"
-"p02CXOgT7S06q02CW438sus170mCImC2HCY-7SG-7GaCk03Cm0JDm03Cu0ZDq4pCraJ8CR9O5GJDoS3EuK3DvOZDnOpCs4obEAD2uS3Cr83Cv4pCs03Cv8JCseDp100D"
-"+pS02pS0SO38m0oCW43Ck9D20SJ9AJGCmuV27OK270ZCkaZCn8JEo0JEoOJDXT00u42gMIt0yKJCoaZDmapDmG3CnSZDpaZayK0EpSJDrKpCsapDpGpDsGJCUZm10KZ-"
-"e6Wme6GOpnGCt02EkXQ0Ead244pDEud2Ied2+3r0z158mu2CoKpCuS3DECY2G4ZCqOpDMkA2uWZCoOJEnapDt0ZCq0pDu8ve1WGDtaZ38g06oOJDt83Dn8+t60WD+FQ0"
-"2FQ000J8w5G1o5S38O38o4QF+FQ02DQ0WqoCk4JEsW3Ds4sIGW3DuCJEkoq008J0nWGDo0Z3+m00m4YtAIF14CJEEeV3W0JCpa3EsK3Et85m6G0Flu0KF8IyEW1FpHNO"
-"dLsNcWb3KWpDkOJEsu0pAWXDp03ErapCEGG2+K20QS02im3SX9NPkHdFnS3Flqm2He18kL6UqvJBnmpB5aW8+yW9HuW4R-G1OH08nuoDE00Foy90IWu3DGL01KWD1820"
-"WuFeCOCeC4wb0WZTWo01q0IOo3WC+pa06na04LZBu0pCnSpCuSpCrSpCrGJCsOwb5mnCqa3EvWpCvu0t8WGDnKZbNM0DraZDna3Ep83CpW3EtaZ30bW9l0H8E701rWPE"
-"M7G0vGg-ToWnTo01u0Y4VoWSp615u0ICo02D+FR4IDR40aZ3cZ0Cp0ZDvGJEm4JEqCZCnOwf1GXDu4ZDsCJeTIHEtKZCu4ZaRM04qGpDuKJWcWnCqCpDvK3EIRE2+Z73"
-"EZ73GS38s02DkXP1CK38t0Y3E0HgNMrQH405yybFu0IET8Y-STG-SnGBnuICEyc2aKJErCJEm43Dn0Zg770ErK3ErS3Cs8pCpapDu8pDMIR4uCJDtWZCr43CmGZCna3C"
-"r8Lk5Kp0Uvs0+V736V730WJXl3GEkTS00WJ9e3mC+dg26bg2XKACmOJEuK3CoapDsG3DtOXiHefgAWpCsK3CpOJCoaJEr43DtSZaiD0Fp0JDmGZCu0pCoWpDr0ZDn8DR"
-"3uFKCOCKC01EW4JDWuW9LeM1900EEOg204Z-vQWJvQ0Gnu2Cp03Ep0JEt83CnC3CsCZ44-00q8PhAWpCsCJEmaJDn8pDrWZCrKZc4-0BpG3DsCJDuG3DoC3CIGJ5Adh1"
-"+x436x438G38r4yb0SZTc6W3D610tuFJ3e4J3mGDk0JEI8g2Sa3CuSpDuOZDbOgbCD0DoWJDv4JDt0ZCrWJCq0Z3bYXYgg00r4sIEmD6O4JDq8JEsaZqCDW-HnWnHnW3"
-"fX10qu0UFe6J340908Z3JCX4ptGjs6H0KmpN+O38tqX8+dh1TdBGuuYCrSZCo03CpCJDrOZCo8Zib51CpOJDoCpDqS3DqGJCrOPnMu0jFW1Cq43ErC3DEGQ40SZq7700"
-"tuF6E8C6EenkF8dBJ0mCEi66E076fWi-c6GFc2JEkapDuCpCoKJDsS3EXi60mOQ9Am3DtK3Cp8ZCn0pCr03CpOZDIch1SOZCnaZDqOJEIaf20KZ3Gt00oPSWTu-VTOyV"
-"T0WCE8D50OJm+gcR3mXCWS38nO38ruV55eK55m3Ck0pCtG3CoKZCv8ZDvGJD1Qg9eyWCPFWB0s16pC3DpCpDrumHJm0DvCJEQQh1q8pDu0ZDoWZCmGpCqKpDMRm4kSq3"
-"14WDfeW-YyXJYy10nuGDT401g9Q0C4JDWCJmTxVI3OKI3W1DkWJDqWZCEyf4KapDnKJCteQ5FWJDnaZCnW3CuSJCvOpCr0Zbkr03pS3Cm4g700Z3bW11oaZsRrX-w2Xn"
-"w2X6eqWSc6W3U3X-2eWK2e04j4ZBuOZ3Xk08mG3Cu4JCnWJCgwK348JEEiL7EWj4C4JEoKZcxV1Er0JEna3DqapCoapCtOZCQ-u6+tB46tB4IGW2+5F1Iy72+BF1M9F1"
-"E4d8iO3EuW3Ev03DnK3Dp4c5E6F1SO3EsW3DrWJEEWd8IOp6E6W2mGpCn8ZCrWJErW3EnOZ3lXWoKQW3mhX-KGYkKG22t0IC1wC0su6J34ja+BF169F1iqIDkWpCt8ZD"
-"o43DouWSUGGCt8nsUOPgBWpCsCZCnWpCvOJEm83CuGZbPG26r8ZCnCpCruG1K01CuapCs8ju90GC+l946l94443CEaI3sDU244JCEq3200Y-F9YJF92Fnu2Dt4pCtCJE"
-"r43Cs8JDs8hGIm1Et0ZDuCpDu4eyU2r0uGpDm0ZDr03Et03Em03CnOT2K0GC+x94Ex940CZ3kpXRFDGm+wmzZulOdOaOdu0wJWWCoaZ3nK20nuWBY00DgUl3aCJCvK3E"
-"vGJErOJOTG0Dr8fYBWHDnG3CvK3D1512rSpDE8I7ERF1+x946x940aJmo5IggXU20aZ349X3sqW-e6WHe601quI8oWoCm0pDuapDtC3Dsegz4WYDp0JCuKJEm8JCnu0s"
-"ZOf-OG3Du43Dv8JCm8JCqOJCqeDsE0GC+3A463A4EWC7wzu2EWU2E015+Vj32Tj30rYDkSpCtWZCv43Es0ZCo83EkIg6I8f7aG3EmOJEoC3EsOZb+110ru0TIG1Cu8JC"
-"r4Z33UYsSQW--1Xn-110num7IumASecJ3GGCo8HENuFMie4MiuWv9GHCpWZCsSZ3RZ13tKZDr8PZLG3DvK3DnCZCnCJEsWZCtuWeEeev9mZDuOpDmGJDtO3CnK3Dt83D"
-"Mx32+l746l74Ia12EOl9g9Q0E4g6+R47IP47OKZBnSJEqSJuCJXDqC3ErGZgmq08r4ZDqGZCtSJDEOSB843Eq8fb6mnCpK3CsGpDvuWxVWGDo4ZrPZXC5-H01ulVGOeV"
-"GuGUe0WDIKB2c1wB0SZ3bmW4nLX4FMX-7FXA7F16j0ZBn4pDqu0g9mGEn4ZCXvaa9D05oCJCr83DX914tWpDn8ZcvW06oC3Dq4pCtuGbDGGEnu0GPeSE80WC+h746h74"
-"G038m02Ew5p51GY3xxGAYA3MJ4G04mpNIan3P8Y-47GF4xWHbm2Et0pCqGJEoapCvSJGyheyEm1DsO3DoapDnuG7XGGCuuG5Du835WmDo8JOUn0ErWpDEa15IpG108Z-"
-"M2XnM210v4SXwbK3EWbA+dK3IbK30HZBu8pCn0pCmWJCqC3DvOJDkoG1e8ZCmWpDr43Dq03CEWl9IoG1q8pDoCJDp8JEnKJCnKpCEui6Eds0+BL86BL80WZXc6G89xVf"
-"18Lf1WWCkOJmzGoCm0JCs0JEqG3DkYO5q0pDv8pDt4JDtS3EpK3CM69A48JEECs8SWJEoG3CsGZDX1epb6W-L2XoL2X3uHYU7rW4TeW-7rWK7r01uuY313Y3mi07qCpC"
-"mOpDp8Zguf16uWJDvK3CvuWRNW0CsGZbd608sCJEr0ZCn03EEG1B4SZDMxV208Z-K2XnK2X3nk20s8nlD88M800EDRB0yuF+tO2+t01DkW3Crumlt0XDoK3Cmu0qTOwf"
-"1WJDnapDoKZDu0pCr4ZCrSZb7r0EpOJDsOZDpWJEqOJDpCZCMpd608Z-L2XnL2X-EDWzED0Fj8ZBoGZCm4JDv0pDrG3Cv8xYLWXDnKpCqOpDE4L5803Cq4c6A642GGpD"
-"sCpDEqC44OJCEiS5MVD608Z-L2XnL210o8Xfd8dCNuG4FumxTu-EIOqEIuWxEmmCtKpDEqQ2KGJDmWJEqOPfBmYDpSpCqG3EvOpDvCZdezX52X32p8ZCEyFC8OJEtOju"
-"9uFaGeCaGumiY0WDEyZ7c1F104Z30kW3CqZ-Z6WJZ60Fn0pCpWZCvapDo43Dta3DoOve1umXd0WCEOO5CCJDn4ZdRm1CnWZCqOJCnGZCrCJEvu00nuiE8uVaGOSaGuG+"
-"beNE80GDEKG8EOW2+dk32bk3aaZBqGpCo03ErSZ3M233t43EpOga6GXDvKpCp0Z3Ij34vC3Dp8ZbnA20quGGjm0Dv0JEEC150WZtkxW-F4YnF4Y63SXVfzX5NHY-ADWH"
-"AD04uu2CoSZ3Xz17sK3CqKJEtOZ48kWbnJ05rGJDmOJDEu+6EGh8E8l5EAf1K8ZDuS3Epum7ZmWDpW3CM7O50CZ-M2XnM2HOh4ibg1F1EKTGE405+xq06vq08GZBnuGJ"
-"aGWDvuGgRm0Dp43CbOgb3t10suGqum0EtWZDEKJ34KJDMQh8KGJDt4ZDq4gBCOpDnCJ8RhCz40mC+d746d7444pCEqSCE8fEgXQ01KIePu-J3eqJ3umE8G3CvGZCo43C"
-"qGpCp4pDv89c6WJDoGJCmOpCoCpDna3CoGZcSv25oW3DrGpDEC8G88JDt4IsEJQ0+V746V740CZ3-L10oONt90mC16VOlPHuJu-ADeoADWGBruY32b22mOJEEml7GC3D"
-"pWJE1hfcoJ00puWxzGIEmWJCv4ZDu0JEI+X4WGJCtapCsWJEnuGZrGWDtejy4ulUGeiUGumRQ0WDwff1EaKHEKuG+ZQ06XQ009ZBmW3EuOZCm0JDs8JCna3DggGE0GZ4"
-"-b27n0JDnaJDvaZ3-WaYQQ03rC3CnuGLIum07vWDU8zYB0mC+l746l74Iuo5wXQ04038Iyu7+7LAA5LACCZBoCZ4XGY3Ua22uSpCkUQ0qCpDv8pCqSJEmW3Co03CEO44"
-"EUQ0C8ZCmSZ4qK43tWZDpeTf-0mC+l74Al74+-q0o-q04GZBEG7440ZCEK02GSJDsCJCg6aBEC+BO83Ep4JCmOZ3N4Yc2X07n8ZDtKpDvSZ31l42m0JDMxq0+h746h74"
-"Eeb6EaS2g142U8J8+ZU26XU2EyZB08Z38c46q4pDmCpDvuWvHe8NQGHCvGpDsKZ3pq44u43EsCZb2t18qaJEqK3Co0ZDEyy70aZs+N20pulUGeiUGuG+H46Jg9Q0+hG8"
-"cfG88q2EkumyRmYCp0ZCqWZCn83EnGZ3-WWdBkW3UC40rumpRWGCpaZ3qXWYmJW3dn15mCZCm8pDEiE4Udq0+-746-740GZYAk00qumvfuGASu-I38qI3uGYBGGDpuGI"
-"OWHEuWZDn83EQcu2m03CvSJDpS3Cq0pDn0ZcYU2Do0pCvWZCo03Dna3EuCZ32TXp9kW-x1Xnx1X-ADWzADW3Wd0CrKJDsapDqOpCqKZCueAjO01DuOZCn4Ys0WZ3YHYd"
-"xN2At8JCsa3Du8pDmSZ3JWYqIQ00qulUGOiUG0GEImt9oz9G0aZ44kW-vNYIvN24ru2Cs4Z4Hk12oSZDE8e8gwkAEaRI48JCEaB8803DsuvnJWICu0JCu0JDvGpCouGN"
-"IOTBD00D+d74Ad74+Rf1sRf1mCZBt4pDqSJDn0JDmSZ3GvaglL10ruG+CuW+CG0DnumgdePrEG0Evu0isWHEs4pDuWJCQNn50GZ-z1Xnz112s0YDEq59ozM50OZ30OY3"
-"52a-LxWHLxGmNYWCnSZ3Lp40nu0zPG0Ct898I03DnS3Es0JDvSpCt83CUIy44KpCEWVCSCJEtGZCoSJEQd320GZ-u1Xou1X-BDWyBD03quYDoumH912Et8JCo43En0Z4"
-"V8XbWd05qaJEt4ZD1K03qOZDmuG9he8u9WGDtOZ3g254nGpDqWZ3ZjYrNQW-t1Xnt110r4c90aZTV8X4tSa-WdWKWd0Hj8ZBn03DmGZCvGJCvCpDo8pCIOU9UUy4SCJC"
-"u0pDnCZDEyQ9QQU28G3CvuGMN10CEqUL88ZCoOjgT00D+Z74AZ74+-q0o-q05AF1qOJW1J0Cqumu6v0W+euqEGIDtKJDv8JDnS3EESEF0CZb9U24r0JDnSZ3na54mSpC"
-"mKZ3f2Xo9k00quFTGOCTGu0AVedqEuGLSvlEk8bEkmpCkCJCva3DuaJCnOZDsWpDkQdDEOwBXLX3ms11oCZ3KTYYmJ01s0JOznHDuSZCv4pDnOLSE9IqhOJ4kOY9C10D"
-"+Z746Z74Ee32wzE1ESu2+xE1IvE1WCZBt8pCsWpDvuGKJmWCoW3E5skcLQ02pW3CM4SEGKZDn43EMUu9iK3DnK3EuC3CsGZCtOXcLuiI3uVTGeTTG0GCsrI30GJmvwV7"
-"u8L7uuGHQXHDn4ZDnCJCECn7s6hL84ZDp4c6EuxN48JDQgsEOCpDm8ZCnaZ3-fb3x7Zrka20qulUGeiUGK2XX9bR5FH1bu0pTuFYBO5YBmGCq03EEGtJXza3eybYMQ04"
-"s0pDoaZ35U25sW3EmGJEMoIAEqA44KZDEeQJ44JEES35I7U20KZ-u1Xnu1X3nW51p0YUUfa36-Y-UfaJUf4GquIDp83Cn8JCrSJCq8JCs8ZgHx05p8JEoGpDES8L4SJE"
-"Euu2IQQ7eK3CuWJEs8JEn8JDIOBBMRQ0+d746d744a38E8rJovX4443CECl3EmW9+VU9+SU9CKZBn8Z3fU38taJCnSpCo4JEg+X44G3EEKuJSSJEq83DoWJDE0Q5Es32"
-"O4ZCoS3CuaZ3iY01q4ZsTW30ru-TGOyTG00E6QQ0Xai-b6WKb60Avu2ErWpCnK3En0Z42WWiYdW38x02taJEIyqN4O3DMk-6iOJDrOJCtSJCpaZCu8kAD0GD+d746d74"
-"0KZ3rP30n42XgPf10KJ0Y0GC+-32Iz32Eu-6EufK4aJCEipG4K3CEWWIAMf1EiSLaW3Dv83Dp4ZDq0ZcDS1DnOJEmGpDo0ZDsG3CoGZ3AiYoXd00rulTGuiTG0mDbOgR"
-"Z6W48Fa-mwZKmw33quYDquGADGGCv8XcIHWCregb6GGDnumFp0WCEWr244pCY24LSSZCr8ZCr0pCE4fB4W3EMRq70KZ-r1Xnr110vuG58O77IKYf+pbDInbDEmVGWOZD"
-"qS3Co0JDmum+eOHEYPvBD4sGeGJEp43EsaJDmO3EUoq7Eel8W8JErCZDu4JEqODnJ0GD+d746d740WZXd6G8Axlf1ubf10mDEeGH4a3CE802CaJCtaZ4JAYc2F11uaZ3"
-"Dr44ma3Cu8JOT8vu9G1DqO3DuSZ3Cy01rKZ3vlWrZdW-w1Xnw114n438v0Y3m5ZQNQG1aum3puFBD84BDGmCkuGl1nHCs0JDn4JCsuWgQPQyW0GDES1LaO3CtGJDoCJE"
-"oKZby11CpGpDoOZDoWZDs4JCruDsG1GD+p746p740KZXc600t8XGIuFxVf4xV9nPLG1CmKJEuWZ3xQ63tG3Cn8PMQGWCnuWD80WCEiA4CSZCo4ZbkJ00r817zuWGRHmC"
-"suW7UODI3ulTGOjTGu0lb87HUPXTGulI38bI3GIBpu2CpOJCuG3CEOJ7Eu0GICF8QAF1CC3EsGZ7zo31oCZbAk01qKZ3xG27pWZDrGJCpOZ3xTXocd00su-UGuyUGOHo"
-"VfMy44yk+Zf1MXf1IuNS0KZ4+5d4C8bh+WW38+22nW3DECR2CWZCpaZbnJ0AqGJEt0JEr03DuGZ4tobqGD00su-UGOyUG4sAEGPOsr748G38nu0JVuVdYeKdY0HCkOJD"
-"nuGihnGDt8pCE412bzabdd00ruWDXHmCtuGwbW0EsCJO4geVGG3DoC3Er83CuO3CsSJCveThv0WD+x746x74E0c6Ei9IoPF81KY3IMX51XW82cH41uGyq10CEal3PGY-"
-"M6ZBM63Gtu2EqO3EsCJEq0pCrWJCs4Zhtz12mSpDEu7RG4pCsaZDIe+9AoS00KZ3yv56rSZCrCZCsuWlpPTT3uVfGOSfGu0TxuWJIes650GCEu+BEaPCcjS00OZ3vbI6"
-"Zulo1uYo1u05K0GDEGsO44JDEWkH0WJobRfb3m0Do8JEXE05u8ZCqGJCEaTREgS0E00FEuY50OZ3WvX3OfcpbRW-B3XnB3X3bn60nuGfxeso14m71GW-wMXGwMX3neW3"
-"LI31maZ3JL13vW3CnOfGzmWDraZDEmnFEyvE44ZDEek3AAQ08GZDtuGDPWHCqO3EpaJCEmQFEBQ0+RC46RC404Z333X3szXQY6G1auWzvaMR+hq0zf41ouIeCWWDpaZ3"
-"VS43uOpCoeA8FG0Do81u+W1EuKpDnK3DEWZ4AUQ08KJDtu0QkWHEsSZDqCpDQ7zU0OZ-63Xn63X4emX3okWQd6W4gvY-d6WKd606j4ZBr4JDmu0+bWWCv8Z4NKa3XyWb"
-"Y456r8JDv83Dsu0FuHmDn8XVlf8g102DmS3Dn43DuKZ3Mt41nKZrAI20suFoGOCoG00E9NdSle00uuG7w4sS+BF129F148ZBEu0C4GpDE8QLEaG60SZgLr71qOZ3jV56"
-"oa3DuKJDn8Xxgeuf1mHDuWZDpKZCmuGLbvGxaPjO8uFoGOCoG0GEXSg3yjZQFD00v4ofXza-d6WGd6W4Xb55sWZDo0JCECsC803CreQOpGGDtuGfsmXDn8ZDu8pCqe9A"
-"Hn0DqWpDE4d2EymR4KpDE0K6Exf1+-C4A-C4ImkFwbQ01KIeRu-VDeqVDG0Dku06SGYCv8ZCnWJDsKJEoI7L48ZDEuoCEmG484pCpevgq1XCua3EpuWh2vGQU00EQdKF"
-"0SZ-E3XpE3X4tfaSt9X4qHL8fQnH8uqVDq6T+x35Ev35a4ZBqOJDs43EvKZ31r02mGJDg2cG8C3EvuGPqH0CrO1KhOfh5vGTCv0IbvmeKHWDseTlm1mD+FF4AFF4ICm3"
-"XWgQTKW3UuX3XuX7krZJD7G095AGHGY-ueWAueGe21GEEGVQEOx7EaoO00Z4HYWb2s00ruW4qvGn02mDEq2FQgeGOGJEoSJErKZ31X72raJEEuc2ABK10SZ-O4XnO410"
-"uuWP2v0vBeMp181e7vVQKOLQKG0DkuG8RXnCp0ZDs03DE0UEgA92q8pCtSZDmC3CrG3CqOZDQ+W54K3CEuD9SKJCo8pCtK3DEiWAEZQ0+JF46JF4XrI83A7mI4sS+Rt0"
-"gRt004Z6+730m8ngpWGEnaZ4DIXbSV14qWpDsOZ4-G84v43EtOZcjxY3PW82mS3EEKbOECbO0mZqD7W-t3Xpt3XXrO10muFDM86DM0WCE86L44JDEGxX0GZ31180tegI"
-"j0GDEGVHWW3EmS3Eqa3Euu0uwfe1C0mCEevFC0JEn8Z3ZV70reThD0mD+pF4ApF4+hk1+hk1Egk148ZBEerHe4pCn0pDo8ZDmGpCIOZ5MMt04K3DECvM0aZ3+GZ3v6bc"
-"3120uuWhy00CEqhQ8C3DvejlC1mD+FI46FI4IGEVwTB25GIe29tWAuVj8eLj8GHCkGZCn4Z3Cf26pKpCsSJDneAj800DE8bJKapDuOJCmumxZOfWAmWDsaJCESWDCOpC"
-"q0Zu2R50tuVHHOSHH8npr00Esr435GY-UVXKUV12mu2CE8xAX934nKJEu8Z3e2ZZZY24napCqGZ3lW51pWZ3ouWalE24oSpCoaZ3K254uO3DnKZ3DWXpkYW-05Xn0512"
-"m0ID+5Q0Ems6+3Q0c1Q04apCMqx2C43EnCZcWn3BvSJCtCJCm0pDmaJEIqGCAgj1q4pDu83CuCJErWpCuSpCQdSD0SZ-u4Xqu4X3KrbT3fY3MmGWhdA3+xP3guP3E8WF"
-"G43CuaZCIywH4KJEE0h6IAq08OJDvumv71mCE4zOQEfQKCZCma3Dt81FYX0CmWZsZV40uuVCHOSCH4IVEGW5gTP3E8hQ+3Q0I1Q0EK580OJO8WXDoS3En03Ek6HL8G3C"
-"ruGOM0GEESZF4O3CEmVKAUq0CKpCmSZ4TD40uuWTgeTFF00E+lG4IlG4E8C7sHP308Z5avOR7vL2Hulo1Obo1GGBruWfevm2GHGCt8HhUvAxt1nCqGJDm8Hd6n0EuS3E"
-"QsBO0KZ3b538oaJEp03DvOZCQlfJ0WZ-84Xn84X4zHX38ebQnDW4B-Z3UeW-oVXGoV1AnuICoWpDoO3CrOZ3md91q0Zhf751raZ3RqXjzH13s0pDr8XOQ1XCq4pDoezn"
-"Z00E+VG46VG4I4w20GZ3Mr70n8HorurJ346K0GZQpD00uumTW4+0+tj12rj1EO58G8JCvOJE1K00seHVteet6uGMFG2Dm0JEsSJDvSJEESIXEcJ108Z37987rSpCpO3D"
-"oKZs3Q40uuV0HOS0H0GEQK0BgPS00aZ3aBZ-VRWKVRW3uC41tSZ3kC21mKZ3CI70rOnNROvCFmnCuOJCraZDuuGNRuGPv8vnBGJDo4JDsSZCuK3Cs03EuuWpTfynB00E"
-"+7G467G40CZ34AX4jwdQf600pu0nk91B7wFJ384J3GWCkuG5LXHCqa3DqSJCECh4IWtBMcQ08KJDnuWUJ1WCXb11vCZ3A7YYGD01qCZ32w30vu0QL6ItM3h70WZ-S3Xn"
-"S3X3Bf50oumORe6g1409sTib0CJ02bn8+B-2g8-2fM13tCpCnumDKuG70PvYPumTvu0zlvGDIHmDsuPpUmmDua3EEmcFKa3EqKpDpOTR+00E+VD46VD4EulEwji7fYZ-"
-"9xXI9x1HjWZBqCJEvapCoKZCvSpDt83EI882Mks00GZ3nB90tuWQbWmCv4Zdwj70ru0D72oDp43DqSZCnaZtqlW-R3XnR3X4ybZ3UsWQhDW4x6d33YW-feWGfe01jGZ3"
-"jv1Ar83DvWpCt0pDu4ZhyQW3gy51q0Z3ze50vum7rfvxLuGuoG1Dp03DtWZ4Infqab10uu-uGeyuG0GCEeQBw9z2EiS5E4z2+Br0A9r004Z3GD85oG3Cm4pCIGyT04Jn"
-"yQvz44Q98aJEs8nDkvmbDQPP801Eq8JCqu02Xvm9Hu0pgeSP80GE+hE46hE40OZYe600t409Xag-HDWHHD06puIDrGpDuumOg0mCEW47kkkCCOpDrCZ3N885q8pDsSpC"
-"1hcZaX01t8Z3dQ32uKZDESZZE0dDEZQ0+tE46tE4EaVI6AOEE4M6knE4EO9W+Rz2IPz24GZBE8fOX171oWZ3ZGQQmPPm68nw9HHDpWJDtaZ3yzWbyf85qCJDt43CECrS"
-"4WZCEeqCIdH10aZ-g3Xng3X6hmYS3gY8hmY-mDWHmD08su2CoO3Dpa3EEW7P8OJCnugcZuW+6IGDmumf8GGDrumeY9965W1DvaJCuW3CE4QJ04Z3r2are6W-h3Xnh3HO"
-"c0GCEajHsb62+xbRYvbR00Z3Eya3SA95mO3EsK3CQoHC48JDEW3fGSZCoS3EEG4IQAQ048pDEqsc8aZDou0qsPjTD0GE+RC46RC4E0sG0GZ36mYQY6W4B4P0auV7F8K7"
-"FmGBou2EEKbRIqGg0aZ3zVZhoY22vGpDEGS800Z3zTA1oWZcYX00oum1H2GCEe8fXygsADW-73Xn7310uuGbs1GCwjL35KY3g6d-f6WGf6W3lh11t0Z3Ly40vuGV11WD"
-"EKnLA6158GpDruWmoW0CuGZ3isb3oGZYTX00rumcUGWCquGiBmWCu8JDQNf1+7C467C404Z3IKYVkJ00t4G9XCg-MQWHMQG8a2mCEeAC0WZ3oz21oaZ33yYYa6W36N93"
-"n03DtuWCkI0ErufA51HDqGJDpuGQY2mCEWhaM7jH0aZ-W2XpW2X6oJdQlJW4heIOgvlH38aH3mGBpuIEEG9Y00Z3Z+X3iuc5G4fbXd04q8JDu8Z3js54s4JCp4Zcxu16"
-"rK3Dqa3Cru08AXGEm4ZsKB60vuleGOieG0GE1oE0nO79P0GEbEX3GlW47b10yuFYxP2YxnnCk03DuCpCquW0PuWly10DgAzACKZCpCZ3Te72pCJDIWr2Iw32KCpDu0ZC"
-"tu0Xpo0CrWJCQli60aZ-X2XnX2X6C3ZS8k00vuGMNuG2Auly4Oay4m2DkCJDtaZCuWpDrWZ3H5YhcTA4sCpDnWZ3lab3+CA0uefF8umsT1WDEGRiKW3Dr0JEoezQF20C"
-"+7A467A4ECDM+rr5Qug60GZ-f6WHf60GruYDsOJCm43EnS3Cq4ZDpKZhGDW3aL18mKpDv43DtCpCQ2cK1K60su0zG1HEr0pDru03ZfCeGGGCmuVeGOSeGGGCo8XsaANK"
-"3uGyJumoDwVyJeKyJmYDk0ZDtSpCpaZCmOZ3bH90u8HyJO91xW0DsCZ3Qh52uKZCE8VIQcuA8KpCnuWguwGyf0GCEaSBIdj3443C+B846B84E4pLwHy71IF1o0Y-d8eI"
-"d8e4X958tC3EnO3CvapDMaOAAcU2OGZDuWZDrOZ35oc3xSXbXO60su0srum0MW0DvCZ3jccsX6W-x1Xnx1X3pReUEDNO99XNNOHG8u4YXuGCKu0WNaW8+F62gC628WZB"
-"suWwfYnCtCZCs83DE00DEucFMkr5Ee2L0CZ3Y931nWZ3A1gb3911o4J8+xWIP1XCpOpCtOjKSGGCmuleGOieGKoeIy74gHx204Z3g520nuW4Wwlg18ag1uGxDYGDpSZ3"
-"Gz15uW3DtC3EEWeTA+s0IaWN0SZ3b2e3vj00qOvR3W0DvKZ3JAZ4XN31mCZ32thqvQW-W2XqW2X4BIYSb600m4oebUX4okWJnD00uOXj+unVNulS3qdSEuNVOKZDmGZC"
-"n8Z3CB92q43CI8fFMsN3GKpDtG3DEGUG483EEShTQI15EqI4EC2cEe1Q0aZ3p4XqD7W-A3XpA3X6CeWSoDW5HxcPB700s46bE0659CY-B7WBB704nuYCsGZ3iE45rW3E"
-"uG3EoMbU8CJEtu0ia1GEEuL84G3CEGy2EIf4G8JCt4JEIqXlEKDGUVm1+7F467F4IK2AwLfPIS35EaQB+BQ369Q38CZBrumjB02Dn4ZCo8ZDvOZhnRA2s03DXJY3Wr60"
-"tO1L7gOg1W0Du0Z3bq57mC3EsWJCmCZrWN11n0Z-o3Xno3X3GxcUgaX5qma-tlWItl04pu2Cm4Z3k216r8pDmGpCmaYfMU-2EyfFIWxJ40pCE47GUIDbXY41n4Z4Mc80"
-"n4GD48NQUOZnEy5j1GGrUuLFeHGCmuVyG8TyGuWG4A7eD81cI48++-q02zq0a4ZBp4JCp0JCvKZ3G+51vKZi3060tuWXZv0JJoGDo0pCEiQGAwq00KZ48624tSZDtGZ3"
-"MBbrdN10nu-zcgyzcwmLK9ez4umVtulJ3eaJ3WGBnuY3DA13t0JEruGLVuWA7QAtB01Dn0JEruGcy0mDEWI4EWvDEUQ0G8JDp4pDEeIm0OZ3BXcsSlW-tRgotRA1t0Y3"
-"vHbSreW3drh-QAeKQAe31W98mWpDsS3CvCpDEqgT08Zahb52r83CEiXC4SJDI0QaXMYYX600numG-11EnaZCs8H0yvTe1u-vGOyvGuWwSgN+w6m8Eq32MOU2rQR41G0F"
-"V9H5gaX8+ZW2kWW2KSZBrGJEtu0qB1WDEO8g40ZCICz2MQq3Iila80JEtumvjwmCTAPgN00DEy9ZGSJDm43EEKuGQV+704Z-LSgpLSg-PHXzPHHOj11DnW3Er4oE0aZ3"
-"6CcbjDW3Jq63tCJEnuWZ9IWDsOv4+0mCXI02o0JEE4OPEaS8MFh4+7nfA7nf4G38EydbovG1EC75+lq0Mjq0EGOGSK3Eu83Ev0JDESRA0KZgrQ01sKZ3ED46sS3Cr0JC"
-"t81ycf8554sI0KJmlxmhovDyL1GC+BnfABnfQ8a7onlk04Z3RuZ-d-XKd-12mu2CEKLT0SZ3swf3lCKukheZI0GDEuRT0GZ3K9X33-Zc9a31oSZ30724vaJCo0Z3MYYs"
-"sxW-DSgoDSA0qOeHPumvXvmMKuVfB8KfBu0kB912qwG4bnGDuCJDMyjBMMf1KC3EpOZDm8noPYmDvaZ3uydYADW3pc82sOpDEeD9CO3DuOZtd6W-T2XnT2X-LQWxLQGo"
-"L2GCEiNm0aZ36bX3f2ecCG11mWZ3LZ70uu0BHHmCvefFEwWIj1WCEuzS4KpDEis3UNf1+Z946Z94EesOEa74gj05EeoG+pE1InE1GKZBmKpCEqZU0SZ3Vra36wcf9r00"
-"ru0yIYWDp4Z3F+Z3tZXaVd04pO3EqSZ3rl42oKZDE8CNQl32+Z946Z9404Z3fDc3aLdQd6W4RQY4ijY4+TX-8kWB8k00qu0GFZ0Dt4Z3wJi3TWYhzJC3ra3EvumVMYGD"
-"s8Z3x9bbEh11qWZ37312o0JEEiIi0SZ3gnZp19X-MSgqMSg3pIfSIqPmMw-f18rf1GGCku0zxm0Ds0pCEmtlE0jmc+q0E0l81p56rG3CtOpCuOvJ3mGDt8pCEy0G8apC"
-"oumk9QDUr0GC+dlfAdlfESQcISs2o1r00SZ3QJY3IFZ5xxW-HDWBHDW3-I46rG3Cm0pCou0wz0WDkIbKEWh98SpDmuGRe2WDEiIRIgF14KZCIi3DEKe9Ca3DvaZswJW-"
-"+Rgo+Rg3hdWUgFHm-wFqfO5qfumSh0GEEGsN403CEK7rISL5Asu2C4JCo0Z3sL30vuWra0mCEyJDAQU2KGJEsWpDnu0dU1GEEG25QhD6+llfMllfE8JDoHp5E4+7+JD9"
-"QHD9XGg3E-B0quWiHW0Du0Zc6833r43Duu0nFxWLlI0Dpumafu8f1mmCvKZCEuvA5hi3FNbqNQW-b5Ynb5Y3EqGmPgsF88nLtv03Zu-F88qF8u0TLvWw3o0CrOJDE0p7"
-"MySoMsu2IqVVEqAM4apCIq6eQsE10OZ3F191uKZ4p9btbmX-uRgouRg3pzX3fmXQd6W4r0b4B2j4cdWLGMHOGwnM6v-j6uoj601Ck03DouGwMuGitYmDmSZ3SpjYGK02"
-"sCJEEyO8OaJDtK3EmKZcdFX3AHX4BXC1naZ4mVjrikW-LSgoLSg31nXU57G0ZO7n1OX0FxFn1e4n1G0Eku0FBpGEpOpCE0R584pDreATDG0Dt8na9XGEu8Z3gchc4gZ3"
-"F4g4uzg3NT50u8+oBullGeilGumbQuGq7wcZ3umwGxmd8acZ+ps0kms00GZ3mja31Ki3yXA3oK3CreQLjuGULGmCsuGiRoGDqCJDE85KAsj1GKpCoCZDEKTTE0tDIuKg"
-"Itj1+FC46FC48438mum2g00CkbQ0EWXo8838ou-LRhqLRZGCkSZ3P+Z3RkC4mGJCr0ZhPT17qCpCpaZDnaZ3Zq81uaZdQrf3Qo30su0vRoGCuWZCEOlgIZQ0+NC4ANC4"
-"08Z3Z4aUOIa3AKc4qrW-8YWJ8Y02nSpCEuz60CZ39Rf35mg3WyWc8YW3a9X3-0E4uKpCm8Z3fLZZID06rGpCq8ZDouWPNmmCoaZDMFi1+RqfIRqfI0MWozn3IGnG+7aH"
-"I5aH04Z3AC82rS3EEqxjEKOk00Z4hgXce602p83DEixFK0JEvCJCnevzpGGDquG1V20DM43r00ZsZMA0nuFIdgCIdw0Sy5ifk9g1I8qDEiG6I0Z2+Bg1TBA0ruG4N3mD"
-"EK4K4WZDEGdBkgXc0KZ5E3j3iad3DRcbmj25pKJDmOJCE8klEWPG04Zsl910pulPXOiPXuGhWg7-d00DIOQL+Z5oEX5oGSZBvWJDEeHBECnYEamdgERNEmwNESTD40ZC"
-"E0O8EWj8AQF14GZDEqWrEKAh4SJEEu8mQRF1+FbC6FbC44JDISmL0KZSFDG0a0GCEeum+-q0+yq04OZBE0rc44ZCI0ZCC83DtGZgb460quGvTvGGovWXGH0DtO9ZmuGN"
+static sybie::datain::DataItem item5("haarcascade_frontalface_alt_new.xml",5,
+"18pY18XIk0mCEqmU4a3CEmzR0KZ3Sbgt7l10nu0EMImCu4s000Z3r3b8R9a3Rq22pG3CEmzXEiz3EyD2+RC0oOC0IyDLE4-TEmjaO8JDmW3Do0JWYADZ1GWDku0neu0w"
+"rmWDs43CUOkHEW68EGaB0WZ3lLa3Cba-IlbFIl51uWZ4dSX3c+Z3fI40r8nL-5YAINC0EuCA4a3DEaNj483DEqbaQSD50CZ3D1X3cVX3pM10quGXM5CH+pz0kmz0E8WD"
+"Ea9AE8KW0WZ3ZiA0mK4pQNC08CJDruWPdH0Cm4ssUO0R8GZBouW0xmWCnGpDE4jY04Z4CyW-53WB5301v0J8k3XDqKJCruGr0nmDoC3DI4L5QNC0Eyni00Z3nta3MU70"
+"v8IDG81F4HmDu4CCIi59+hO0weO00aZ3OkY3iXg37hg3I9Y3ivhv8e01tKZ3H231m8Z3md20nOXBf4GOGOpDtWZCEyOX84pDruG-tvVn0uJn0u0gYIWDsuWmYvGdJwWz"
+"aA1KOejY1WmCsaZ37830tuWhYw0jE5WhEeq4C4JCrGZ3l4Y3Ay00uOHM-uF53q75Iukc443DEiWGC0pCvCZ3FrXv0b00quGFxIXDq4JEvOZ34o50seXPx4wU4W3EE06R"
+"4WZDEqvT51h-53WC53GurIGCsu0L92HCtOJCtump762GIhO00GZ3SJ55tCpCnG3DEut2U0m64KZBESMYOO3Eua3CtOZ3yWY-KCWGKCW3Tfg3qY70ru0-jOoY0ATn0uGn"
+"RGGDoumKRvWhfHmCtOnqNuGPWGmCo8HUXw03HW0ErWJ8culY18ZY1GWDWu0fm1GCIqab8WZCvuGpuKGPIJD58KZBq4O6MOo78KpDr8HgM4Wn8W3Cmu0cBnmCt0pCE8E2"
+"+h72+e720aZ3+NZ3Kb20tu0LT0WDEq75IWZ4IlO0Ee4P8aJEmOXbuumnzLWh00Y3BRh3LEf3dv60n4Qn+-912z91EuVD4SpDEGrS4a3EEmN644pCb0aq53W3Vn42n43D"
+"EuVQE4QN0CJ2kY08puY3Mm61tSZ3FZA2vKpCMOn8+3b0o0b0XFB1rSZ3vE71mGZ3Jsc3E9gtfOW3FKc3-w11maZ3P8d3YyRha1GCEewcE86PEy0WQyki+JM1vI60vu09"
+"D1GC5Qb3pVh3BbY3bqYv6300uuWfP2GEEeYM08Z3DdJHvuW3HWGCoaZ3zJY45OB0taAV+RC0kOC0IeSk0WZ3McC2t8ZDE0HNECFOURC004Z3VL80o8XK2vGrHg1LF4QV"
+"GSJCtCpCEWDd4CJCECWUXCg-63WB63W5-N36o83DsSJEnumfTwEDXvW5UWWCrWZ36na3m3f6VzKHfXWCuGZ3DNA2qaZCEGg4+RC0+OC0EaxS0aZ31KY3vq21qCZ3Z+HW"
+"N9Dt300DEiFpEu0F00Z3zU40venFduWYtuGeGoGDoSpCEmr90CZ-y6XFy611v0Z3The3Rv00nu0uvHmCpuWWl5oxINC0E8D508Z3l951vKZ3wH30tKuw11b35KY34k72"
+"uOpDEeAkXOY-G9WCG9W3YSX4dUi3fSB2saZDEqLNUNn0EuUj0GZ324b3vJ62mGJDbyW3lj71uGZ3oy17oKpDrWpCs4Jo2vV53uI530WDEO-A80ZCtu0xGx0s22GDEGQU"
+"UBD50GZ3CZ40uu0jAu0wLHWDo81KA4M50CZ3Gx10puW6ivGEpQXzDuln0uYn0u0ac0GCE8AH8KJEmumeQmmCvGJEclO00SZ37j10ouWnlw0ZVeX-QuGwA1GDEyaO0OZ3"
+"0nZ3XAX-QFWFQFW4gh90muGG900CES0G0WZ37vGmeATqK0WCEy5d0SJO7xWJRu0lA4mhbxi3PC21t4Z3WAX3j3K0Nu-Y1uoY18H0iH2Es4pDmO3CmCJDEugJ5TWq6300"
+"ruGuDuWW6wGq6xmbf4EFXnD0suGrHX1EvOpDsOZDECa6+RC0wOC004Z4Rx10ouGCBGGEtu0V0vWDBuTK2mGDk4ZDE8lJ8WpDuumNlOn5SvWG9uG2IZmDn0Z3St01oaZ-"
+"j8dGj870vum8DvmaXwmlUIGEvuG4R5oHURC0ECJOE0epEeu4GW3CpK3EX5MHHv0e9v0gVHWCq8Xwvv-Y1upY1uGW13GDEybj44JEEugU04Z3XOit5301quY3azW4LLC0"
+"suGGTeH5KHWDkuG7320EE8YCEqwN00Z-iOWGiO00n4kjE0qFECYnE8V60GZ5p9csnR00numcb2IDmKpCvCJEu4Jpnx0Gr2mCEC924SZCEW46Mmil+lz0kiz004Z4Jo50"
+"oum3x10DEK-TEq3iklz0EKrBEeKK48pDE08fIOg5XjD0uum7NmWCvSJDI0MVMOSQ+7A1T6g3Zqa3PSD0suWEIW1Ep0JDuSJCctY108Z3+Pg3bFj3oIh3ZGSen6c5EmBB"
+"0aZ3LcA0numCL0mCEa12+RC0oOC00OZ3bb62tGJCEKeC8KJDtu0ZZ9kaBW0DkWZ4QsZ341C2n4JDQmnAEmt84SJDEydL1EB0ouGVZu-s3ups3uW93IWDnu0LHOnPs0GC"
+"gRTpGGZBvSJCECdF0OZ3CLC0puH4DJICkSpDt8pCt0JDE8He0WZ6knW-G9WBG9W3Hob3+t61tCZ3zP33oWpCn813K8zzGG0Dk8Hnm20CE0CL4OJDE0O5XCd3E410v48+"
+"EyddEWCJIWFC+NC0oKC00aZ34U12pOpCEWcTEKcl0WZ5k6csrUW3Rl21n8Z3w-h377g55n42W8ZBE8iT08Z3jH11mSZ8fuX-A6GFAwW8D1GCEif60WZ3tY91s0JuLPUG"
+"9WmDk0Z3EJ54uWJErKZ3UBd55uL8YonDp0pCnWpDuu01W0mD9qj-63WB63W3+lc3YKj3QT21p8Z3iWOf48DK20GDEeLpGOZCm8ZDEa4E4CZDDKC1puY3khD1s4Z3nd30"
+"r8HDm4qPULC0INse0CZebDg3YB60n4aC8a3CquWxJvVPZAPPZ2GEEmkc8aZBr8XU4vWwLxGwQOUB2GWDkuWPp0GDEWc3XLB0sOn6duWcfu0jM2WDEag240JDE04UkXM0"
+"6l2f8aZCpu0AE5ci4G3CESK9EiwpYVW1I0Mc8WZCoummNImCvuGkK4WhEGu2EO9sEWSjEOqKM8QSYrY0ENC0EyfD403CEqEn0aZ3ebZ39WO8f8jy2umrCp0EtS3CEqNn"
+"8GpCuOn675Gn0KZ3-Ob3dk50rumoLxVYOuJYOGGEouWCT1HCtKpDqu0RQ3GDEafO0SZudq10qu0VTvWI+nmDqGpCEWr2HV02pWZCEKE6E4GJ00Z3JYL8Xwrj3uiY1u03"
+"611DoCJDo81eCwmwwL8uIV6Y0CZ3dda3GoY37S50nu0Lo5WhEO5AEugeEWTUCWpDqWZ-EugGEuA0vuWwQ2WCEaPV8OJEou0s+vmsJB1wB8jn0uG3X1WCECnHECoHE0hK"
+"XKTPQZWCmCZ3bkd3Lz62mOZDEyh4+lO0oiO00WZ3ZT12mSpCE4NOEySOES-7UVF3EeOQEG+4ESxIECrWMGGT40oCECM8EuYZEOBDESPLb8g-G9WBG9W4D0X3+OZ4zI91"
+"pCZ341IGrADM8G0DkumGmw0Y0vmievnOL108E4pF4SJEEuiPGO3CsKpCMKND+RC0kOC04C3CE8HoKGpDsWZCsu0lFZmDsCZ4XUeqzsW39ej3ZiZ3KJ60r4sQ5bJm1HGD"
+"pumQ6HWCsu0BJGGDqKqP+lO0zi81p4Z3VkHO6YWCt0Z3zG41mWZ5jfes6300puWab1GDESq5EuLDIa+6bi82t0JD1S10nu04D00D+NlG+KlG0aZ33t45nu2DqCJDEGWH"
+"0SZ3NS90t8nkeeDt3GmCoumXW00CE8VH00Z7t-W3g3X3CHX3zF10uum4yLai+pO0omO0IWkB08Z3-6E8v0JDtW3CuOZDktWHICyY0CZ3jXX3l2a5kUHON00EEGX6ECwS"
+"4G3D+pPv6nPv0aZ43t43r0ZDou0qZ00EEylEMSrXIVx1EKiXEis44apDEqQU0KZ5LJO053GDE4A8CKZCsSZ3rx80vO1M9u-53uo530GDIKRXEK2XEqd340JDEKsOUdc9"
+"1g80pu0mVuG3N20CEisY5BF0ou0O320EEywRCS3DsOZ3zSO0NuVn0uIn0WXDWWZBq0JEEqwBEaAhECq61UbqA6W31bW3fsa3S4Loj4Wh1F42mK3DEW9sKGpDoapCmuV1"
+"XuJ1XWGEpSZ3Bh00vu0lDuGPo1WCESF6EOJ4IlY1EKAGEuLc0SZ3N+21vaZ69Nd3S873s4pCtuWCunmDpa3CQW5Z+hO0keO00WJecvm3cv0ECX0EpOZ3-7Z3qQXqcLW3"
+"r6a3nlh3AwB3s4ZDrOXAn5Gt00Z3SFe3ji00v8XGs4Ye+RC0kOC0bVB1nWZ3yrj3tG40num2I5WnI7b04KZBEaNF4SZDEafDEyXZMmdZEu634KJE1Pc3Zte3neLHevln"
+"0qXnEGSJEuR2ECC7E0o74GpDEyJdUlj60CZ3Me10quGyMvmsNw0kr6ITXm80nu0ZJvmGg3HDp0ZDqKm5+RC0kOC0IGSJGW3DrGJEMy-pCCpDv8J8C2mCMtxGE0oKEq0M"
+"Eu-94K3DM08BEK92I0g84apCEabq+p2f6n2f0aZ34ta357B2p8pCEm-HXH80p8nOl8jK2W0Dk0Z4VLZ33GY34WW5dXGe-n0ErCJDI8pkEC7t+NN52LN5MCBwE4q2EO8i"
+"EWdkEaOIUNv2EKO4E4oVEO1E8SZDqOYhAvmsT7yB4CZDE0vtIic2+Bb0o8b0ICJN0WZ3LkA1q4Z3ac40vumhguDz6WWCkaZ35h50oumMmuW4D00CX9M8C20CEeUQEemR"
+"0SZ4b+P1NuF63u263umeYwGbkGWCpuWl+1nCrCpDqu0eM8z53u0KqGmDsu0gDHWDpumRBdStEy1HC8ZDqGZ5Jq40tu0GJ66z+NC0kKC0GO38puYCEuQiE03S08Z3y3E0"
+"s4YYQRn00CZ3cF10numsaxGgq2GC1QI8A2GDEmUQESxj48ZDEWhF+hO02fO00SJmqJWCrumLFY0CpaZ3ifa5S0dqwU00puWiKum+CHGDquWhP20CMm5CXnj38X77s4ZD"
+"nC3DsGZ51sW-B6WCB600u81gR52B0CZ3DY10nummP1GEUpz0GOZBrO3CE0usE09ZCWJEoCJ8M7AQCOpCvWZ47r10rumXfOn7yuVK2uIK2uGDd0WDESei8GJEpuGKHgHF"
+"bBzY1uW+dumv2wWwGmmCoCpCI8gFXdB0numov0mDE8lr0aZ3qZX-vUWFvU01r0Z3KkW3iRD3r0JDouWhMd4K0OZpoRGniG1DqOJCp8Z33bb5JxKHG1mCEa58I43BEmsL"
+"brY-A6GFA2GDEqx8KC3Do83EmumXD81vhv0g9eDe40GEEKfDEqprKCJDuOpDpuW2I48e0OZ3aAA0r4MA+tudErud0aZ34t41nuY3DEd3UD80ruWwV10EICO3IRC0E4Zr"
+"Iuoa0aZ4Gcj6y1i3zXW3zNX3dM20mumcY8n8pu-Y18pY18nr93GCE47d00Z4kQTGOvjs30HDkCJCruGNQuGoJJWCteHP8uWDD0GEEyJ7Eitg4a3CEG4J+lY1wiY1ECBw"
+"Ey-P00Z3+Dl3TY92n8ZCIm85IlO008Z4f752q0JEEyylEeI31gU8BwGlZ1GCEKyD4SpCESFK+RC02PC00KZ33+b3yJ40tum4y2WCEC6QIe53IRC04KZBEGEcEidpEGbq"
+"8O3Coas5ESNBE07IC03DsGZ3yqW51NY-SFWBSFW3Wo60n81SeuWJvGWCru0GIuTG900DEiNLEeUS00Z3mt10oOX2LwG0IH0EuumHCv0GavGPg8XBBuVn08Jn00nDWqYD"
+"ku07u30EEGTrE05BMaUAIt72OKZBuSZCnCZ3atW3yTE1rGZ4haW3XfY3rq72vaJEEevs4KpC+JdP+GdP4aJDEiNLCG3Dn0Z3hC51raZ3z7D0n4mUQ3b004Z3cVE2v8ZC"
+"EGeOEGgQXLSOS30CEGuV04Z5P121saZ-iOWGiOW3fJc3LO10uuG8uJWDouGJb5ULQNC0GCpCvCpDEaaQ00Z3ZGY6kZZ3V163tOpCv8HU810EEezt1mj-LCGVL8nwQ2mC"
+"EC7KK43EtCpDquGkk62GI-a00GZ3WP10puW6u91Da2GEICEBbRB1vWZ3G6l3qBi3IRK8hxVn08Jn08X9NWmCrKZ3ex20t8XIgaM5I7K2Ea-4EiWREit9EWsIMaa5IWL2"
+"4aJCEyLH08Z3Aha6GgZ-B6WBB6W3MH71uKZ3Hhj39C21t4Z39jZwWIW3uab30372tSZDEK4k1bJm21GCEGNW00J8h0WDXvT0NuVn0uIn00mC1lY3MWF3nCJEq4Q70aZ5"
+"y5iqH9W3hae3+a54oOZDoKZ4quG0l6yAEe9J4G3CEGI8Eax8+Rn02Pn0I0XiE4Q9G8JDv4JDEeQa0CJvMfjn08XjD20DEaG6E4zL0KZ7Nn01qOZ3V971nCZ3J3i3AlL0"
+"TxFZ1u2Z181VLH0CnuWQcvG6wuG2j8neV8z530WDICZtE8JiESoi4a3DQWVNE8WIEqc+4WpDE8aRECdg+RC0+OC0I01Vu83DnC3EoapCrO3Cu8pDnWLDbr2CrmpBfv6T"
+"b9dRXncJlHMPpvZ2WKH0Wm3Rb5cPM56RrPp50WA8WKZBoCJEq8JCt8JDoSpCnCZCpKMBm438puIEn8JEm43EtWpCrOJEpGJC1S11yyI77X0FlyL6Y10FTm02W02FYX80"
+"q128m0IBn0ICvOpDWSZBo0pCqaZDpKZCp0pCtSpCouTn0G4DkSJEvGpCu4JCuapCqOpCmWJ0kY48ruIDm4pDuW3ErGJDvWJEva3C1SX-53WB530Ou0IBsuIEoOpDo0JE"
+"s4JEoWpCsSZDbr2CpuyY10aDkapCm03CvSZCoS3CvOJDraWn4HZBsa3EmW3Dua3CuGZCqCpDtuln0uZn00LEWqoDkOJEvS3EpWJEnGpCvGpCtaZt630Gqu2CvaZDoC3E"
+"rWJEoWZDtaJ0A52ZuG3EmW3Ep4ZCnGJEmGpDu4ai+pO0kmO04S3C1OC9p4pCmK3DvWZDoK2D1riqC609puYCuC3DtKJEp44F84pCtKqE81IDk0JDtW3Es83DoWZDsKJC"
+"s4Z-C6WEC60Jt438nuIEsK3CrWJEsS3Dt4JCo8J8mBTn004DkapDu03Dt0JCp83EoSpDraoYKOZBpa3Eo4I9OGJDtWZCqSZ-53WG530Ho0oDk4ZDqSZDm0ZCt03EmSpD"
+"chO0yGZBsOJCnO3Cn4JCq8pDp0J2k248suYCo8JCpSZCn8pDrCZCva0t+pz0znDKtC38j8ZBq0pDuOpCv8ZCq4pDnO3C1P00ouCt3GYCkCpCqO3Dqa3D1P52t8pC1eKG"
+"G5WneOZCm03EoWJDr8ZC+Rn02Pn00GJ06JJCm8pDvOJEnaZDqC3EuOkn0mJCk43EpOJDpaJErCJEqS3CjP1FquIEpWZCoO3CqGJCtW3CmuFQ584Q5WqDr0oCkO3CnS3C"
+"o03DsK3EmOJCbP10quyY1mJDkCZCr0JCvaJDrOpCr0pDDt27quICnOpDn4J1ZXGEsOZ-RFWHRF0Js0IBnuoDo4JEt8JEt8JCrGZDo0JOx9TK2WXDk8pDuSZD1z35pCZD"
+"pO3D1Q20nKcBmGZCsa3CuaZDvWpDv8J0Xv-538p530mDXU64uOpDo4J0e1HEpO3CuK0VIBA10DZBq0pCq4JDmWpCuWJDnaZC9AAHruYCqapDpOJEmK3CvSJEs43D+VM1"
+"+SM1CX38jGZBqSpDtC3EvW3DuO3CqSJEX-cqI90GpuYDn03Dn43Eu83Dm0JDnCJmt5Mte03Es8JDv83DrWpD14j3QWW-C6WCC604v0IDkKJ0+IICmC3EtKpCvWZDXeYq"
+"B60Fqu2EuGZCsKJEraZCs83Eq8X08KAQEKQ2CWZCqGJWYI0Epule4uZe4W0Em0Y34b07qOJCnG3EoCJGHJWDm4IGIRC048ZBX879p03Cn4ZCt83Do8YV8W3Cn43CvSJC"
+"v8pDsGZCu8Z3hfW-B6WBB600u4Ek4CJDXH78mGJEu0pCnCpDY3b0OGZBpG3CtaJ08HHDoKJEt4JqjGWDouGG9GWCp4Gp44ZD+FK22DK24WZCXP1ErW3Em8JDmOpCoSZD"
+"oa3CXeYsYI05r0pDva3EX4Hm120EXKTXY2JEs8pDqaJErW3CpWpCfhW-vUG-v20EbdBDnK3EoKZDmOJCpSJDnGZveL08pu2EoOJDm83EbbX7+jGWY21EtOJCsumbBm0D"
+"rOJC+Nv22Lv20WJvvY0Co0JuhXXDu4ZDtC3C5AgqC60DpuYCpCpCsW3CvWpDpKZ39kGeHvmpA0pDqGpDt4JErSpCvS3D+Jl12Hl1CXJDWKZBuGJEsSJCmW3DqCpCta3D"
+"1riqSF0FruICtSZDmCJEs03CpSZCpai5C02DkGZ3ii08maJEnWJEtK3E+7b065b0eO38jKZBtGpDsCpDXJ54r4pDqWJuO9TSF00DXKD8uK3CvKZDqCJE1EPBB2YCqOpC"
+"sC3EtWZ3UY00ouVk78Kk7G0EtumV8GICr4pCn03CqSJCIWe2YpO0SOZBp4JDmSZCEyr3GG3CsCpD1UI8C2IEmKJCrGJCmaJe32WD5wZ-TFWCTF00uu08D00Ebc05n03D"
+"rGZDMea3I7b0GGZBt0ZCEi14SSJCtO3EvK3Cfi8Gsu2DvSJCr4ZCrKZDmSZDmKJ8cuVn08Jn00GE1550o4sT84ZCmuG-GWGCt4J819jn0mmCkOJDXc48vGJEoSJEtWJD"
+"1eKOSpYCoSZDr8pDuWJCs8JSkuFQ5qBQGb3CW4ZBoOZDoOJEvG3Ds03Eo4JCrujDG0KDk4ZDs43CmWJDvO3Do0ZCuaOeyCZBuSpDs43Em43Du4ZCqSZ4xoW-53WC5300"
+"nuWV8WZCv4JEqG3CsSJEoKZCnGJ0y9zY10qDkCpDrWJEq43EuW3EmaZCmuWZ94oYu0ZCpW3DtWJCuCpDqOpCp4GO+RC0oOC0K838suoDp8H9FmWCta3DXHU0x9jpAW0D"
+"kGZ37c04s4JCu0J8+1GE1kU0532DvKJDuKpDvaZ3kG10oul4K8a4KGGEp4Oeq0JDoC3Dr0pCoW3CpSJCcV340LZBvSZDpaZDo0pCmGJCmSZDU0I3XdC9uC3Cta3EnGJE"
+"nasy+Rn0kOn00GZ34b02q8JCECm4SWJEpKZDuKJCEa-2IpO0uKZBvKJDvCJEoaZCv0pDtaqcXU6Epa3EvC3CvOZDuK3DmaZD+BA1+8A14aJDEm+34S3DX-A2qGpCI8E2"
+"EyR2IRn00LZBpGJEuW3Eo0JDr83EoKJE1eK057wM4K3EE0i3G0ZCnGJC+Rn02Pn00OZ3dc0CqKpDqCpDuK3CrC3DvKYYQNC0W03Dv4JEn4JCtum+J00Ef3AAW8ZBvGJC"
+"rSpDnCZ3EG10rengBuFK2u2K20mDE4S4mGJDpapDo0ZCsS3CrSZwEh02ouIDECn5WS3Et8JCu0JEpqoYiKZBo43ErWZDv8JCsuWH9G0Dru0b8uln0uYn000Ebo10v46Z"
+"OKJCvWZCmOZ4b8XqLCGWXo2DuOJCmSpCqapCvKZ4CcGYX20C1pE7pKJDq8ZCvSJe2uVn08Jn0WGEW4JeS0mCEOD3CW3DmaZ3BOXvnR03p4JErumqK00DE8U34O3EbDi3"
+"Ue07u4pCrKJEoaJmh0GE5pe-53G65pWCm03C51LWy3HCmK3DmumrAOkP502Dk03EtOJDv4JOS3GE1nJGv44K0CZ3Gb02oKZCMmP55qj-G9GLGnWCm0JC1p2Do4ZDr8JE"
+"vW3DvK3EqOZ4h-WsSF04sS3DrSZ3xZ13r83DnaWIXm84v03EmKZ4AX13va3EnOHAKuln0uYn00WC5Oi4KM18vGJEv43DqKJD1Phq630DquICoa3DoK3EuCZCvCJOd53Z"
+"0KJuCZGCtWZ3Tg10n8HhJuln08Zn0GnCWOZBnaZ3TU17vGJCo43EuKZ43sWq5305ru2Cs0JCE8C24GpDEKG30aZ5Dh00tuGsPWXDrCZCp0ZDEKQ559h-53WC5300q4oY"
+"eOZDmSJCsaJDoSJDE8151mds63W3sI1Ap8JCpaZCmKJEp8Z31WGGH1HDvOpCsumlCmGDrO3DDch-H9WBH900r4Mt8SpCnuG1JWXCo0ZCq8JDICp2IN34GGZBnS3D1ZD7"
+"mCZCqGpDu8JP67+p00Z3hG17mOZCvK3CnCZ-C6WHC6W4fS1ErW3DrKpDm0JCqS3EvS3CEKe2QpO08OJCruW1RmHEnGJDmK3CmKCtK02DkKJCv4iHG8JEoWpCEac5XvY-"
+"C6WBC6W4mz03rKJCqumMH01Ev0ZDuaOMIRC08GZBmu02DWmDm4JWfImDt8IANWpCs0pDuKJCoOZDuO3CvOJGpwln08Zn000EEGO34G3DEue7OSJDrWZCoGJnggTk70nC"
+"qSZCvumo80GEEmz5Yeg3aGpCmG3Do0JEqWZ3fDX44RX-53WC5300v4MtiGZDt8ZCra3Em0JCpumQEGGPjOz530JCkOJDvC3Cqa3DsOZDEmk71eKONWGCqOZ3JbW3MrX3"
+"VaX-B6WFB607n038uuICs0Z3Aj00nu0kOWGDuCJWOfDK20IEs43Ena3Cr8Z3FM10oKIrEGi58W3EquWa80GDEeL4+NU32LU3883Cn40P44JCXhRG6J0Dt4w7UJK2WGZB"
+"uO3EoOpCvumPUWGEvaZ6r01Bsu2CvC3EnOJCs4JC5Ea4xtW-RFGVRJGCou01RmXCs0pCtS3CruGlHWmCvOZu630FsuYCuGpCoKJCo83EpCZCrqwPESV880pCtumFQuWw"
+"I0GCIun8+RC0oOC0IWo5qG3CqO3Dp0JCuaZDoWJCIu72Ipz0OKZBrSJDm0Z3RH14sWpCt4Z8zA21mGZ3Ou11mKZ3G022nWJD+pO02nO0IWo58CpCq4Kp00Z33712vaJE"
+"XTXq63W35u1BrSZDo4JCqKZCqW3DMCV2E0j2qKZCuG3EoOpDrKJDoCZDISk2+Bb0k8b0EWo5CKpDpOJf201CtKZDv8XTKeDt3GpDp03Ct8JEnKJDrG3Cq81o84GnKOJE"
+"m43Cm4CZ4S3CEmY2+Bl1w8l145ZDWCZBmOZCpSZDvC3EtO3CoOH-ZeTV80JEt43EuO3EtCZCqKZCUeg3K4ZBtG3Cmu0U8GGEp4KL0KZ3OWW-A6WCA604t0IEk8Z3NqW3"
+"p215rSpCoW3EEaq2I-a04KZBE4g8a4pDtKpDtapDoGJoKG18quoCrGZ33+04mSJDmKZ3qMX-A6WFA600uuGXI0oCrK3CtCJEmOZ3yK10sKyfIBB6eKZBpOZDuWpCuSpC"
+"Eys3443D5hT0630DEic2SaZCmSJDt8JE+ZW22XW2a4JEWqYDkO3Dr8Z3+e15uaZCta3E5mdqMC0Cpu2DpKJDnWJCqKJDsumfC4QiXP15nO3CrCpCEmZ60SZ3vzGWyuVK"
+"2uIK2GWCm4YAO8ZCnaJEuaJmrxGcXuDV8m0DkSZDEOg5EyX9GG3Dt0ZC5zl3Ab27vCZDr83Ev8Z3ux11p4JGowVn08Jn0uWwIGXCpCJCtOZ3s314nK3EuKZ38jWqA602"
+"ru2CI4g34a3DEeN84CZCY0S40OJ0X1HCo03CtuW2baIe+NM1zM6Do838puICu8JEtCJEqKZ3d620s8njT8Tn0m1Dk0JCs0JEoumo8umZVOnLFW18ruICv8JCEas3KGJD"
+"oOpCsaAV+NC0kKC0IOo5uW3CoSpDqapCo03CoO3Du4ULI7A1E0S48WpCnumbEWmDqKZ3SJHWAI28ru2DnSJEnapDEiKAC4JEvGZ-LCWGLC00q8X0RuGhh00E1bC0ouG6"
+"P8UK2uG7DmIDsSpDmaZDuGpCt8Z4pxG06JZCqCJDs43EsC3EvaZCpOnHXuFZ1u2Z1uW9NGWCtu0pTmGEt8ZCImR2XeYsH900v8nffWGEv0JWYIWCsK6nEaM7EOV3403E"
+"EWEACapCvaZ-sUWFsU01oOJWW2oCuKpCo8ZCmKJ08BnQA8Tn00HDk0pCn8H-CW0CmaZ3+DIgbvW9N0oDpGZDuOZDnCZ3hZI1SxlY1uYY1WnDWWZBr8JDEyC8SKJEs4ZC"
+"pOJEg-a08a3DvuW9900DbFh6aeH8AI1CuWZDv4Z3XgX34mI1SxVn0uIn0m1EWqIEkGZCsuW4lumQYumYS4WnIlz0ESEAGWpCsOpDIW6808Z6Lc26WGZBoWJDsuWVZWGD"
+"oSZ3GhGn2vln0uYn0uW9N0mCEm84WO3Cma3CuS3Es8V53GIEnKZCr4JCpK3EEC975ug3NiX3rW20n8npFWmCtSZ5pqW-53G753mCXNh3pB10rKwuCC3Eo4Z4rsXqA600"
+"quWsBWIDmG3Cp0pDmG3DvKST1KC2uK3DEKnBGOZCs4pDEqx7Xod-53WB53W3iz04pCZDm0Z3uB12sW3EEWN6cps3WO3CqCJDuapDnuWPn0WCIiZ85KC0quGHGm1Ct4JD"
+"t4pCr81gJuVn08Jn00WCEKW2a0JEsSJDqW3Cr4J0l9XbD8zY1WmCkaZ3So05ua3Co43E1APX9w0uDumENGmCmuWXemWCmO3CXPd-63WC63W4iz06pOJDsS3Em4US84JD"
+"tKQ1QRM11K41o0Z30C23t4JCv8I2bG3EvWpCrS3CvCpCpGJCvO1rHuVK2uIK2m0DW4ZBEOt6aC3Dm4pDra3Es8Z4QdXq53W35q04n8JCmWZ3fQ10munsXumU80nDm0pC"
+"vuWVF0XDsGJEnul538a53WGDW8Z3bc03pCJDvuW7qmGCv4ZDYNx10KZ4br00sumLFu0RF0GCIGe6EuJDSW3Doa3CpapDXtW3axX-RFWFRFW3Rx14qaZDuOZ3YMZ3pOY5"
+"UgXqA606ru2CnWJCp81ArmGEu03DjL15ou2EoSJCEen8X1Z3VPX-53WF53W4Bv24rCZDuWZ3l423ma3DnOXCZ8TCGWGCk8Z30WW3+e13tOpCv4XnOKZBnG3Eu8Z3KA13"
+"rCJEseHENuV53uI5300EEOr744pCEyO3IO-A4S3DcZQA0GZ3zc14tOZDuSZ4iD20s8XY9u0uD01CoK3DquGSP0mDEeMC+Vr9wSr9u83Cpa38j8ZBvCJDuKJEvuGFSu0a"
+"B42yQ734qGpCmKpCo0JEtWJCsGZDIiZ8Ei72aOJDs03EsWZDo0Z4HyY37yW-B6WBB601q0Z3Mn00uuWnFGGCm4iz4GpD92aqiO00qu0pAG0CquWIJ00DECO5Ym72W4JE"
+"m4JCvS3Dpu0fSeHkVuVK2qLK4GJCXm80s44n0KZ3yK30num2A8ke4W0DkCZ3ymW3xj00uuGqZ8nn84wPO4ZDnSpDn4Z31O33rK3Dqu-LCupLC00DImj7iC3EmG3CuaJE"
+"tO3Dtu0QMujV8WWDk8Z3s821vaZ3Us12q03Df7A0Wu09NWGDr4Z3Fc11sKZ36bGvFxFZ1u2Z10mC1Y53p4pCouGBSumHSG0Dp40PQZM18CpDvumuhumBfmWCrWJDbGd4"
+"FB25rWpCn4pCEuo2ESi3+ZM1wWM10GZ4SxX3+P33nSJEuuG4gGWCv8nG9eTt30WCXLD3m8JEnu0uU00EQCU30GZ3AR34r0pCm0Z3Px11oWZ430Y-B6WCB600ruGnRWWC"
+"u4Z3QbY3yX00uumjOuTIJGYCkK3Eo0JEoW3EE8uA8OJEtK8Z00Y3Zv23vapCo8noAuGkCuFZ184Z10YDW8ZBoWJDo4Z3ic00uumHE81D88zy602DkSpDuOJEp0Z3ZE32"
+"pS3EDAA1tuY3PA14sGZCrGZ31z10mawV+Rn0kOn0Eus3C8pCmKZ3O+X31w11s8Z4QRXqdLW3UW2CmaJEo8JCo8JErKpCoOnWI01DkOpDnu0WFm0DmO3DESA9+hO02fO0"
+"EeaBC8pDt0Z3nHX39s01pGZ4u8XsA603vOJDtuWLUGHDuS3EqGZ4NiW3-r03qSZCpuG2FGGDnuG8vu-J2OqJ28XIk00CEGtB843CpumbBG0DvOkn0GWDku06cGGEquW8"
+"VuGD-aUeI0Y2aOJDv8JCqGJEsOZ3NyY-XIWEXI00ruWIkmHDtSJDoS3CtumhEGGEpKmUQlO00KZ3BE13m0pCo4kf0KZ5sF17WKZBsWJDpOZ38U14u43CqWZ5WoX-LCGV"
+"L0GDICf98WJDmumpxGmDpuWvNeUK2WWCkSJup8HvhGmCnu0IH42T12A2pSJEE0t9C8ZDrSZ7ItZ-63WB6307o0YCkGZDoOJeCZnDuS3EtKJC1idsnR01nGZ3CNY3UD21"
+"o4Z3BAH153oCkSJErG3Cu0J886yZXQi-53WC5300puGC80GEE8084S3CE882483DI8p2I3b0I8f9eO3DuaJCu4JDnWJDIWF6Eu05Eu024CpCEOA9E09AIy65+NC0oKC0"
+"Iaj7G4ZDqWJDEyn38W3DtuWRpuj83v0cO0HDpW3EnuGsKG0EuOoByG0Cn4m30WZ4NGZ3tuH8YwFK2u2K28XRFu0RiGIEm4JDo0ZDma3Egpi2EabGEukCG4ZCq8pCMGpC"
+"XL12vK3DEGsEO4pCrCJCqaZ-Q2ZEQ232o0JDI4f98OZDp81X39nc31WCcRM1SCZBtKpDvCpCX503vOpCuK+E1OC1nSZ3at07uOpDvGZCu4Z-ADXGAD10r8XIkW0EuaZ3"
+"w+32pG3DE8VB08ZuDh06suYDoG3CnuWT80HDqSJDqOHjb4cBCKpDnSZ3cX33tCpCmqkp+7b0k4b0EeaBSOpDuCZCs8JCE4m6ECJHURW20GJWAYnDvO3Et4JCEOhAIK5G"
+"G438uu2CEKHEOG3Eoa3DqGZ3GhY-MCWFMC00vuWYK0HCt0ZDtumW+0WDXWVe58jP5uWV11mDECK4O8JDpSpDsKZ4v8I8A2mDEex604Z3bP13tOJEo8H9SulY1uYY10WD"
+"I4NHEC9C4O3CEOT60CZ3QYIeYhzP5GmCuuWIxW1CtW3Dn0JCQShA1qD1qCZ3ADX4eN20pOnz1vln08Zn04YAGG3CpaJDEGeC4C3EEe53jykO5ZaQDb47n8JEtS3Do4Z3"
+"Hp10ouXliGICk43DpCpCuapDEeN34KJD+dP52bP50OJusoGEr43CXwC6n8pDp8JEp4YYQ3b00KZ3yR44papDrKJ16u0084Y9GOJEuKpD1552pSJCE08D+Nn0wKn0GOpC"
+"WCZBECF4I8IB8C3CpuWr5vTCGuGcL0nDt8ZDuum2S44f5uA1WGZ3fB36tC3Cv8ZDruWfV0GC5SX-VIGdV2WDIyVDC83CtSZ4dh24qK3DvOZ4ZjXsSqW35ZW3nH36o0JD"
+"oaJCt4241Oi3AoZ3Q945oWpDmOpC+V532T530OZ3mL46p0JDn0JDm42HE4pAXLXqG903ruYCtu0OU00CEuu4EyCGEKC21KC6pWZCmGZCu81MdGWDs8Xe9u-Y18pY1uGs"
+"UGnDtCJDmOZ3kV32m03DMKh6IhO00GZ38Z2Ar83EmGJCpOZCtOZ5V3X3NbW3H213qSZDruWCB00CIO12+NC0oKC0bNB3raZCuuGuD0GDEWJBgNZH0TZBqKZCoCJDu4pD"
+"v0JEoG3Cfi85ru2CuapCE8LDKKJDpS3Dnu-xX8qxXu0ADHWCk81+6HIEma3ErK3Eq8JDXjdqH90FpuYCvK3DpKJEmK3DrOJDqK3Z40JDEWp5Eyt80aZ3UWIXuwFt3u2t"
+"3umR510EEmgHC8JEmaZ3La31oOJ0a9Tn002DkWJDt43Dq0Z3uxW3GcI8F4KKEKoDe83DuapDrSJDpS3EIG25+NC0TKi3dq40qu0YoGmDr81iE1WCEeI61mdqsU01quIu"
+"J2mCEyzGGO3Cp43DIGD71OC3pW3CsuGZB0WCQahE+pY1wmY10SZ3S5X3Eo30vuGNi0mDEyF2UO-2IRx14aZDEmbI04Z37Y41p4Z56PX3e-20uu0A11GEEajD4CJEQ4K8"
+"+lO0kiO0C838nuY3OqY3JQ22v0JDEaG7XaYsA607tCJDtKpDn4Z3w+W3m9H8p9n5+KAnCCZDpaZ3IQIPoxVn0uIn00mCESP5i0ZDmGZCqaJDqOpCmumByO+j7W0Eo8Z3"
+"G5b3KaZ4PcK16xGwKGHDt0ZCvKZ37b01s8JQoxln0uYn000DE4D30GZ3nR43napDsuWvZOVjYmHEna3Ev4pCru03AenbmGWCkuWyvum8XuGaFv0Yx40t+NC0kKC00KJ8"
+"Bwmw1HGCpuGRF0GEEGM4kpH30KJmNGHCnKJEvSZ3kFK0l6kpEmLK88ZCquGW80GEMm7A+RC0oOC0Eij7Xlc4JpGmp3GEIWj5IRM1EqR44apDIyY3ICzD08JGQw0eV0GD"
+"EulC4W3EIGeC84JDo81TMu-Y1uoY10mDEWZ6CapDtWZ3GV24nK3CnKZxiE30uuG4m0nCv4pDoumh791KA4YYOOJCv0ZDoSZ32z32paZCMO7J+NC0kKC0E8o540pDEu+A"
+"EiBBCG3EsWZ+F900tumsXGXCq0JDuKJ2k68emWZCp03Eo83CuOpCpGZ-LTYGLT21taZ39322sK3DE8v200Z3Y511oCJOvfzJ2uWNKHYDnW3EpK3DqaZCjNB4quYCv0Z4"
+"-D41vOZ3gQY5rgZ-A6GFAI0EmKGnKOpCq83EvumeDHGDv8HrP8Tn0uW+uumtDXGCmWZ3AS11oGJogWHDkKpCvCJDEOXFKOJEm03CoulU8uZU8G0EnuWdV0ICvWpCp83C"
+"nKJmm0WDk3K2O43Dv4JCvWZ3Q4a3SzGP3318ru2Dp8nV5X1DoSpDpGpCM8J3+lO0kiO008Z3Sv01tCZ3EX50numa3HGDnKiZQlO0Emo4E0e44WpDEqi40aJAB2WDEeJJ"
+"EqaG5FF2t4JDEmN3+NC0oKC0bNB3qO3DnuWt+umyZG0DnO+s30YCk4pDo4ZDq0Jux2WCEyu7DhY4Z128t4pCuSJCm0ZC+NQA2LQAECIJC4ZBr0Z3qxZ3HJ11m4Z3lE30"
+"b9U2RnmCpSpCEWl81uA1uCZ4BcW3dw05oa3EuCZDEi8DEqA6+RC06PC0bRB0n4wu0OZ3MM33rWJEv8HqFeDgEGXDmGJDvGZ3kS53q8JDs8XPD4s50KZ32752t0JDMmA6"
+"bEW-I9WCI900su0CB0GEE4S780JDtuGNn00EI4z308ZpYM54quIEqKZ309a3fS13u0pCr4IrEOG9IqhL8SZDqu0gBWWDo0JON0WC+pz0kmz0GS38jCZBIyyB0GZ3lz22"
+"pK3EgZ+5iSZBm0JDr0JEnC3EnuWZtqMtEKPMaSJDv43CpSpDr0Z3RHIOkuln0uYn0uGacuWqT1nCr03EtuW781GCIGh6QBA10GZ3Yl40ruGoRuWGCOXHM4wP8SpDsu0z"
+"1XWCvaZ3DvY-53WG5300vu03l0XDpG3CpuGrMu0kQ00CkRn0SSJCq0JEuWpDE802483DjZB0ruWL21mCEGA9EO3N4K3D+pz02nz0ICIJSOpCv4JCp0pCEuU84WZDICIJ"
+"Qlz04CpCEK3M84ZCtum4N1mDfHS05Z0Do8Z3pP15nOJEsGpD+pi22ni2ECIJC8ZBn4Z3O816m4ZDrC3En8VsUWWDqGZ3N740muG0KHWDqKFk08Z3Ry20uu0hBGGDoumt"
+"Pul53eZ530HEo02EkuWCV0XCm8pDmuWXeGWCq4CgIlO0GKZBo03EEKjIC8pCvKJmzNWhEu3F8KZCtu0zGu0g4H0CsulWI8aWIum8DXWCkSZ3JaX3pF24q4JCqCZvuU01"
+"suY36mX3u765mW3DpK3CLp22m43EEiKOE0s68SJDsOHGXuVe4qPe0aZ3jz00tumXtGnDuKJDqaZ3vWW3jfWqXIW3I+51mGJO4pWDqKJDE0bL1b30W4wnE8530aZ3F5c4"
+"4OL0NuVn0uIn0uGsUu0luu0aKHmDmuGNOPkY1G1DkaZDsCZ3d3b3veX3q5I0kwG4Yvm3UGnDmGpCv4Z3CsKGnwVn08Jn08HsU0GCEWfNESl9EW18MGAHIVx18CZBpumZ"
+"um0Cm0pD1I20pKts803Dvu0DGuGLzGWCoOnCmuln08Zn0uGRFGHDtO3Dp0Z3OMX3pVZ4zcWq5301quY3oH31vWZ3OO41t8Z3IFK9BImDkumJaWHDpWpDv4ZDE0KD15h-"
+"53WC5305u0IBnuoCEOmMCSJEsOZ3bU10tOE5UumlbHGCtuWpDGmDquWmY92vDWGCs0Z3KC23tOJDmuWcGul3KuZ3KGHEv0IBuuY3H510p4Mt4a3D1BP8hezP5mYDoWJE"
+"n4ZCrOpDv0Z3FFK9Cwm7Au0EN10CEuBB0CZ3nwI0NuFt3a7t04Z3aq46su2CmOZDou0Zb1HCtapDmK2ZQRC0KWJDpKJEr4eX0aZ30aJ8G4SB0KJep9niOmGDqS3DMSsK"
+"+RC0kOC01Gc39Rb3yX21r8Z3ld10uum-I8Tn001Dk8pDnaEk483EEOy8fi83ru2Dq4YWK8ZCq0JEmuWE3v-Y1upY1uWsUumgOXmCt0Z3P-23n83Et4KjQpY1C43Dp4Z3"
+"s546o43CrSJCoKKEE4EIX512saZCEW6GEGpL+NC0+KC00CJOMmGEoOJCEiL4OWZCtCZDvOJ0y9jn0mXDk03DqK3CouGDkuWp39IV80GEE4pAEC-20CZ4rmb4C1X-G9WB"
+"G9W47v24paJCvaZ3k363s03CtO1yS8DQ5uGWj0mCE8qFEG9PCS3Ct8J1l6+p403CEWvF8O3CsuWyv00D+pO02nO0EGRFESLN1o94uSJCoCZ51sYqB6W45lX3oqX3rp33"
+"vKpCq4Ir1KC2rO3CEOM7COZDsaZ3c5HPju-Y1uoY10WDECYCOS3Dq4ZDoaZ3wK12oGpCIOh8IRC08KZBvu0uG00DEeXPEmSKMyf8402DEitG0SZ3+X02sO3EEqv25qj-"
+"63WB63W4Yqa3zRc3-G22mKpCEahG1KcqH905puICsC3CEy-9EuQ440pDYyH3EeYH0aZ3Lo51pWZ380Y4WeW-63WB6300uuW1TGmCpu0Svu0OHuGV+umAPezY1umscnWC"
+"q43CEyn24apCjie3OC24uWpDuaZ3PqY4Pab-YIWFYIW4Rx11qaZ3zv14uSZDv4Z3mV31brYtiO00t4+hWS3EsKZDrS3Em8IGauGo0XmDtSZ3v352v0JEIW5B+hO0keO0"
+"04Z4RJ50oumDw0HDmGZDpu0puukTP0WCEqKNK43CoO3Cr81WG42T00Y3JV46qSpDp43DquGub00EfDl-G9GNG1GCEiMH0CZ4Cv44vGJCmaZ3yxJeSeDK2W0DpWZ39533"
+"mWJCmu0gT5IrfjD1maZ3c422o0pDEy+D+RM1+OM104Z4kz01sSZ3aG36sGpCp03Du8nUR8Tn001DkSZCsuW2lW1CtSJDr83EIqz2EuH30SZ4+S11tWJmJI0EoOna8ulY"
+"1uYY10mCXQ61oGZ3Kk42m4pDE4lCMadDUBK2E8S98C3CsuWWQ00EP2A0quWLauG1O0mCEG7O0GZ3ZcW-63WC6300quGhEX0DpCZ3bj52o0pDEGKRcpj7EmrJEmjNEWQ4"
+"08Z352JLH11EpOpDpuWySGGDnuWbF5MB+pO0kmO0IeDLEOQI883DmuGM2XGCpSZxoRW3tP41pOZ37sY3TQY4LEHONG0Do4W000Z38061taZ5vUY-63WC63GvuIGCmuWd"
+"LG1EuK3Cs8Z3EKYtj422puoDI00REqVOEeS6Me-4IGf98S3CuuWMH91w88XkCuln08Zn00mDEm12C0pCqWZ3lV53s4ZDvOHkQez534ubIKpQE0RQQSEK40IDXrTGk2GC"
+"EKDD8SJEq8HDDuVK2uIK28HtU0GDICV8GSJEmC3EEuiDUhO0KGZBqOJDouGEQ10DIKoQMm8940IDMGhR04Z3O-43r0JCvuFoRu3oRWGCnaZ3LJX3Xx31nWZ3sC60quG2"
+"Auzj7u0pDGGEuOXSg10CE0O61Rd3UqW3y9X3Q515n43EsKZCMKJ3+hO0ze81o0Z3w8X3x350ouWgXn0DvS3DIO66Q-a08KZDqu0U6XHCmSJEnSpD9NH8A20DEipF4W3D"
+"EiIREKY2+3A1w0A108Z4+N30quWH9v0V8u0NY1mDIWDDIBl1Iu6Q4CpDESwN8GZDt4Y51yQOsHGEouGxcuWosW0DrCZ4efW-B6WCB6W3Yq42m8JDECiDEuG7Ey6O1PWs"
+"53W3JN65vO3EoCJCEaVL0SJnKaej8WJCquWld1HDt0pCs4GO+NC0oKC00CZ36v00oumRKGHCq4JDv4Z3EAZtQF04ru2Cm8Z3r761v8Z58ba4wj01WOZ39b6Br8pDnOZD"
+"pOZDrSpD5SX-LCWBLCW4Xqa3fr39r4JCrS3DqCZCo81C+8j53GGDkuWyEHHEu83DrOJeLPX5X028quoCv0pDr4Z3Iha3p-20q4Q0+RC0oOC00KZ4k9ImTYGEoaZ4OWW7"
+"rsXqdcY3Rx50suGawnmCoCZCMi14S0YCk0ZDp0pCEW3Q0aZ3p0X46UX-53WC53W4bS12mSJEXm30mKif4SpDX5fqMC05puIEmGZDEO4B403CEiqKD551ruY3Pd32mSZC"
+"Ea7TEu5P19h-63WC63W4bS11vaZ3lK13oS3Dpu06PuWU88DK2m0DkWJEEeQF0aZ33TY35QIHv4iGEumJ0GZ3KyY3PQa4wNX-53WC53W4bS15vCJDv8pDEKNK4SZCEOd8"
+"UxVDGOZBvSJDECKC4WZDb8f60iX3jfY3OO70numizmGDma3E14c-63WC63W3JQ22mSZCEq184KZCEyoA0GZ5JpWpi4Y30t74pOpCraZ3bhZ3NjN1kwGYNHmCquWXgmGC"
+"vaJEEC065SX-XIGdXImCmumOMv0r8uG3luGK2HWDr8nLC8TK2uGSI1GEEyvH0KZ3a610run-hv0M9G0Cnu0Y1vG+y1mCDFa-63WB63GW01WCESU8E4NM4K3CEiYCXPXq"
+"RF02qu2EEqZM8GJCouWjpG0EpOnx9umCD0YCtG3CuWpCu8Z3eud-cLWGcLW5Zqa3-740ouWFt4oG40pDEWP3IRC08CZBvuWNKvGaEW0En4Z8zD22ruICEmwSWKpDq0pC"
+"rO3DqaGt+lO0kiO0EiMH84JCr4uc8W3DsuGKkLwoIt05ES0AW4ZCp43ErOpCqu2TP0HCuWpDruWR21HEu4ZCsOXCDuVn0uIn000DXN50numXB0GCIKh6E0o8U3A1EqWI"
+"CWZCoWZ3Y073r8ZCnOHoDuW7e0XCoaZDnuWwb10EEOT9XikO530HyyoTb5sQ3nMOpDNQcbMPoDdFQWRWKmpBpHNOdPn32Y1FcLMOqLdS9q00WeIp1I1FoLsOqDdNd786"
+"p0oDW43DW816OqWL94WDE882p0IE1SY3AdH7cG0Fl83N0W2Fqb6RqL6P+03FlqW2LmI6EPtZ0GHCW838nWZWF208t0YCWO38q0oC+x80+v80GS38nK38IidOLiS01anp"
+"1403n0ICm40AEqFETSY-U4WHU402r0YD5aF1j4ZBe1WBj7G014GiG838p0YCkK20+t806r800SJ1FAXXgqHz+q808a38rKGZ+hQ0wfQ0KG38m0ICo8eg1W0DWCJ0duVg"
+"18Og10WDXz21m0Y4hZWQT403s0ICp44F0GZ-i6WVi600p4mQ0GZWG2G1DMe3+pZ0wnZ0C43DW4J0JwGI6wM81K0A5Of-H2WUH204t02EWKJGROtM30mD1C20r4qHkOB0"
+"+pr06nr004J0200E2sr00SJ96vlp28ep20HCWW38n4wSsrH004JGr7ma+pQ0wnQ044ZDbol4TwaQTD04nO38t0IGev-Z0etZ00GDfmXVF200r4Cs08JmXxIj0u-E2eqE"
+"200D5FY3WRcVRDGmb0GC+Fz12Ez1Xk90q40Qs1901SIuLBp71uZJ64Y+2L20+JK06HK04838EGEQ0WZWmK00u40A4O38E0sQTbe-G2WHG200r4cw00ZYZ900u4iJE0H3"
+"+-80oz8044JD1WF0r8ud440A08JGvxl-7ud-74mY443C2w-1EyJ2443C+3J162J10aJuH7Cls9l00aJ861WCEmi2+-Q0szQ00CJnoAO44umuBuG2Cu-s6ets600D15HG"
+"MON714+Z1iY-E2WUE2GJJuNg90GD1X31n0J8OxFh1O7h1W0EW0Z4zeWVT4W3HdW-uVWWuV00v4KDXtlTE200v4+Q04Z-S4WXS400m4sAXyXTF2GW80WCXsY-x8WUx800"
+"tKog04Z41KIllvpi6GGEW40Z44pD+-80+z801Wc3JyWTT401n4J1FwlEF8eEF0GDIef2+P54IqY2+t806s8004Z3tb00s4afwrH0IuY21WY-x8WUx800m4286+521SIn"
+"CP7O20GE6L20+F826D820WJvE7g0wHK00CJ0fu0zF8dj08HKC8a90u-j0Oqj00mC5cfVVNG0c44YoDB00KJ1mw-gFuvgFOu6F4g2EGO4oLB00CJOoBa90uFQ1O4Q1efO"
+"3uVO3OQO3GGCuaS1svg0C038naJ0eu-CB8uCB00EEeU4Eud4s1900WZ3seG8buVW4eNW4eHpLOOlJ0GCXHg-0lWW0lW6yEX4bsXQBT00m4Y70aZ3twWBc0W-DBWHDBW3"
+"lr00p8Ol6umPL0mC+Bn56An50aJ1bvWTc8tpFeHJCu0EyqZG+pH06nH0Ead244pCEAL100J0eu-B58uB50GCEKC40WZWRyG1duW6H8ZB5u-71Oq714UrAsE40WJ0HwVR"
+"DeORDWGCn0I8iwNM30GCE4q31wfCU4WFAh00numiL8a90uFH1O4H1uW5A0WDXcfWoBGmtvmXLvly28dy2uVMBuVMBOJMBumg84u4snH00OJeqwV8EOO8EuV5AuV5AeT5"
+"Aum0I0WD6AM2b4K0d8Z53uFy2O4y24yQEio40KZUL7W3X6X3bfd-TWWVTW04s0IDWWZWqGW3UTHeuvFZ7e7Z74Q9E0S32gY6Ei931ehCj6WF3J02q0IE6L20+BT069T0"
+"EWu31ahTbEW3dxXGsnW-D2WHD2GGRv0KQuNeO40AESy2+pm22om2IG9308ZWG2W4gsH0HAZq1uF81e4810WD1hTufOth140A1ye-EiWWEiW42zGG3P7a0Km925e2+8l0"
+"0OZ4x9H8lvl97Od974v3sHB0EmI60WZ-Y9WcY9WXI7GHY5s6+JC1wHC10OZ3woWXnBGurMaO+lQ0wjQ0+tV3+tV3wqV3ICs8EWj8sjZ00SJO16o8+xH0wvH0EKt40GZW"
+"+RW3CQX3FnW-w8WUw8W4BnWYx8W6GnW3x-Y-CiWSCi00s46D2Ys6EOQ7Xvd-T4WUT4W3Yv00tKg0sfZ01xl3KnW-U4WWU4W39MXXdF00v4Gk1da-9BWU9B00tK2Y+Du5"
+"E0H2EK82+pQ0wnQ00SJq7Qtg18n5MumrDu-Z0etZ04rE+5m4HjZ-hjXWhjHP17+f22I0EO93+FQ22EQ2E8c36EP1Iu5415l-k6WUk6W4neW4NQYTU400puWSI810Zu-M"
+"3etM3OHyfu0mBONa04qPIy87s490+GQ204JeZx0sKu-j0etj000C14PG0Pdj000Cfaj-ehWWeh00v819S88dIuGe9u0zZuVP2eNP2G0EW4CJ+v800aJWA7+1+Zs1sXs1"
+"EOQ7443E2cs1XNc4dWY-F2WVF200o4aEXKeTw8G0e4On+p7B2o7BEKQ2EapEw190Xn70n8aGTu-GEOqGEOn2Wut9kuGIKumeiuVh1eNh1u0pLu0ABOtg14KxEK82+t80"
+"wr805FYXE2GnMx-Z0euZ081oZOetB0GD14f-gRXYgRX-U4W-U4WEU4W3pA10nOev342GIG93+pZ0+nZ0I4PB62901WY3CsW-WlWYWlGWTB8IJumNMu0nAulp7edp7u0f"
+"9uW3OO7w3qWZ+ty12sy1XRA0quGV9OtZ04GiIiHA+tH02sH0E0X5+rF3QuG9wzP2IeP2+K20+Na1ELa1EKJ9EiUHobU7IC8C04Z3BSY-3YWU3YGmlwWrdOtZ0u0GXulx"
+"2uex2uWVZO85LuWDgumJPuF71e7710GEMON2Ag01ECAH+d916c910WJ0e58dsnQ05Sh-F2WYF2W3ukYa8PGHCx-j58uj58nvLOuH60mCXnNOex-r6utr6u06s0WCX4YT"
+"k6W3zuG0FwFhf88hf0mDMwZ05Lc-+8WY+8GWu99VGu0MhuVF28OF28nwm4+QsrQ0IiA2E4j3+tZ0wrZ0+tH0+tH0sqH0XNF0n4ATsrH0EqN5EiP7+pH0wnH0EmpBECi2"
+"sr80443CDbZCaOWFJ6X3QxHOz9J90uFz7O4z7KucEOy3sHB0Maj41aY-qVWTqVW4-XY30vWTF2W4t7Y3jYW-F2WUF2W3fbJg6O7a040AEaSCoqQ0+8T01aa3t0X3zEe-"
+"aaXSaaX3ITX4w4ZTr2W47WX3S2X-55WU55GG6x0cHu73B40AEKS7oLK0ECf42L20+Vn06Tn00GJWp4GasDK0ECx4EaV3+BK0w9K0EOaE6kd2MyM6wi43+lH0EjH05BfV"
+"wBX3fB20nuWlB8pp1u-Z0OqZ0818b0GC6wH09cUuNxVa0eNa04gt5WcTx800m4ClEWf4+-80wz80EitB1OlTE2W5b4a-CZWWCZW3YmWauRY3KjY3SCMleupJ54e1Ea5E"
+"+3K0w1K0bERnmPdG1agtEi82+t01wr01IO236wn95SYG2HXF55W4MqXGc0W-cEWHcEW6VCXWmwG1Bw0vBuY+1u-Z0eqZ04ohX2ZUK7W36MX4eQX-F2WUF2W30XG0xhtZ"
+"04m9XfX-F2WUF2W3ZW10nu0PLOtZ04m92rH0+4c0IW822P20+BT069T0E8JCI8OAsHB0ECJCIWiF+FK0wDK0EyNHEeuBsv801OY3mmWCD2WF25GWPvWKIuVomOOom8nz"
+"pu8f344X+B082A08Em32EmL2sDK0XeX3ecWC35W-V9WHV9W34uX3k-WVsZG0e4Gj+tQ02sQ0EO626YI3EK62+VI3AUI3EqqFAwaE44JCb1eES4WFmBGWNvWbCulq1edq"
+"1On8cudRV4ceEun3+t80wr8004Z3v6H0ePNx2enwMu-IP8uIP4k6X0YTE2W3dvW3LJX-mZWUmZW-S4W-S4WES4W4A4He1ON718nV9uWo8ul71ed71um0a8nkbOtZ00GC"
+"E8s9XFjC9BWFxDW4zMaGc0W-ELWHELW3JdZ39dYTq2W3mdK8fvlG1edG1u0XD8n2HOdZ0464IOI3+lW2sjW2EK370OJ8lQdZ04opI8y5+tH0wrH0Eej7EC122UAA0KZ3"
+"oeW-mBWYmBW4i8bXvRW4JtY-wRWYwRG0ux0qcO981u0VUuVi1eNi10WDXWeXus40s4WkEWGC+-80wz80+3I0+3I021I008Z3JtG8ow7O38nYEulQ78eQ7e1QK8u691GC"
+"Ey+B1EeC-HWF0N00q4Gt2P20+3S161S1EG8AXhlT45G1qwmge83j0ulZ0OaZ0um4M4iKsv805pTWIulZ08eZ04is+nk5EmJ2E4E3+-t0wzt01S60o8OjCKi-5Bb-SRWT"
+"SR00t8H2GutSBu0LN4aD+lH0wjH0Iel96c01ISxFEev2+-80wz80EiT4Ee82sLi0Ea06+Ns1AMs1Eii6ISR9sv80QGN4+NI12MI1EyZ4EaO3sv80MKB3+ZIC2YICESd5"
+"EuQ3sr80XAY-kVWYkVGOS3GCECDEsv80IeY2IGI6+B+0w9+0IO35AgX1EqX6Eiz2+-80+z809fiVNxZ4EOX-V0YYV0Y4v-XX9BGPw5SH+F71wD71Ea22Iyq2srZ0ICYM"
+"Xkh-j6WVj6W39ub3TNaTF200nuGX09naCuVh6ONh6uWTG9HSNOtZ04MVXoh-E2WVE2W4tJIGROtZ00GCEWPA+Rn6AQn6Xmg3f0XTE2G8hwW3LuV71uN714+nAU57IKcH"
+"IaaC+790w590XdX4mfWTV4G0duWge8JM3u3rB8HGP8a90ulHBOaHBu0YOuWfX8ueROXeGeJnYuZj000D1jQWX93t0ulj0Oaj0u0HBOeK5OH9OuFg798g79nKAu03NOtz"
+"1Km91lf-S4WUS4W3taWXE2W3i0X-D2WYD2W36hHXBuN7181oYvFvA89vA8H8iutx281NL4yR+tQ0wrQ0+FHG+FHGwCHG0GJGcMI8sni0I4NCIGI3+3I0w1I0Ear61TgV"
+"ZRJ0e4gB+Z03AY03D-aTX4W4rNb3AmW-W4WXW4W3sFZWhh00oe15Sul078e07u0HEudcO9XBZu0wNu-o9eto90mC5KlWx8W37XW-h-WYh-GWEve2bvmrUe7BT4IP+dR4"
+"AcR4ECrL1ScVx6H0eu0I8uFIce8Ic89a08HXRKiT+7c026c0bNjVsFH8W4KP+JQAAIQAXSeViTGee81zXul71Od71uWWe0GCEyK3sfI10SJu4u0q9ul34ed34uGQdvG4"
+"AOdZ0uGlZ4GZ+pH0wnH0Eea46U-41Nj-KaWbKaW3QjXVt8GWr5iq+lH0wjH0EipFAssNIyjGICJ4oWZ0+493I4+L6T20+B936993EePAE4u3szb0Eav5EyC2+JK0wHK0"
+"IybE1FjTE2GHWvltneetn4wY1GWTE2W39aIWNA3q1uVg1OKg18XtA40Rsv8004Z3WKM0Fw-g1etg10GDIqSO+9a1EWUGXhe-D2WUD2W5-QXWjRY3LoHePxlZ0eeZ0uG3"
+"9eNg1aWZ+pr12or1E406IOE2wz80Eaj2ICi8kur1+S91EmB42L20+pk06nk0ES7D6kL5X4a3TgW-F7WUF7W36aGWKw7x240A+xI2QwI2I290Iur7X0YCI7W-j6WHj6W4"
+"aoY3QdXUX9W37ya3uBZCF2WFX9W49HaGc0W-r2WHr2W4dIH8MRNj00GEbOT0fuY53u-Z0OqZ0unHI88P200CESXJ1sbC65W-H2WHH2W31bXXfdGeuvF-Ie8-I8HiHuWd"
+"LONh18HuGKcWkqQ0+8c0bZaGc0W-25WH25W3uPX4pHcTr2W3LIc4hsY-Y9WUY9W3uKX4kgZTF2G9hvWvZ87H18HBO8a90uFH1O4H1uW5E8n6dONj0umdTuWjDu-G1etG"
+"18HOvuGGROdZ08X0avWiD8tG1qqXw4J4+FK06DK01oYXq2G0c8ui0OHIDuli0eei04kIESr8sXM0I8YPEuD2+VV0wTV0EGt2Agp01SYGJCWFzHW-vCWdvCW66LaW1CHW"
+"MK2-k8J1+Ne06Le0QmMP+fw3bNfgGP0Gqb6RqL6P+mpBVvZ2W028WmJ38m18WmZSbD6TpbW514G6Q4G0i43EW438o0YDWqICkKHF14WGd006p0YCW838puY90G0Fl83N"
+"000FDK82mmpBDeG5IbXJsz8000ZaE200muVZ0OPZ0WGCWKJ8W8871G08t4m9+pH0AoH0XWA0tedg14ofGC38t0YC+dQ0sbQ0SS38p0YDW43Dwv80KS38n038su-Z0OuZ"
+"04Wy44pC1qcT8B03p0ICo4GA0KZ-W4WVW404n438nKJPoONa040A8O38o4qz+7R0s5R008J3hvdi1K0A0WJ0ww2a0uIK44G0443CXOaGd0W-HGWHHG00n4Ys0OZWs200"
+"n44P1jlTs202p0IE6P20+NB06LB00OJ8W40RsnV00OJ0U3mC18WBh5W-F2WHF201nGJ0hP8o401DWa38n428+-80sz800KJ8UW0DW4ZUU4GXxuV63eO63WmCWWJOh2GD"
+"wz80OW38u0IDWKZ-1SWV1SG8d2GD6+k05q80oOZx2uVE2OKE2GnCW438nSZWv8GG3JGCtuV07OO0746v1EdTMD05n038t02D+tH06sH00aJv40WCEw80E8M2+J+0wH+0"
+"0WZaE2G0qwVZ08PZ00GEb8eTf600u4og1YW-mHWUmHGOwY0DWCZWE2G0q2GC+ZQ0+XQ08a38reup64W90CJ83vlY5OdY500E17eZR401nGJ9fwFn2e7n200DXIl3ahWT"
+"u8GPX3WD+Wg1+8A20GJ0e8a90uF95O49500EfqXXV900n4wr+3c0A2c0Eev2+v808a38uKQt+7T0w5T0XYOuVP7q100EXmQ0HwVx2ONx2GGCm81EE8epD0GCIKe30OZ-"
+"S4WVS4GGRY0DWWZWS4W3Lh00uu-85ut850GC1MW4FgWTh6G1e0mC1QZ-QIWZQIW3YvWTG200uuG+BumV8u-Z0etZ0K0++3I0+3I0k0I0EGE2443C2YY21SY46wWBRDWF"
+"gK00rKyR+ta22sa2+JK0+JK0AHK01560nu7B54qN+Fl0EEl0EmN3EuG2s9l01OY-LqWYLq02u02C5ScVD2W3mE10nulV38eV300CXTk33YWTF2W3R7X3C5XEBBWFmBG0"
+"FvmHCep90u-68Oq68GGEW4WZ+1c0I4o4+Vt3AUt30GZ3vzW33NXT55W3cxW3+qW-EUWUEUW5moWVrzW5moW-rzWWrzW3W910u8e68WWDWOJuAwl61ud61u0-B0WC1niT"
+"e600vu0qJuGBB83t5uVn2OKn2u0FI40+sv80Qus20GZ-E2WVE2GH17qesz805SIGnxV71eN7100CE882Eiq2sz8000J8kwGQPuVL38OL3GGCo8PLA0GC19l-j6WWj6Gm"
+"3P8h14OR+lQ0AkQ0Eu16XQcV0SH0e4+y+xX12wX10KJO13WDEUG5E8R4+dZ32cZ3bqX3nFXTBB01n8J1bu-Z08uZ00mDXa80r8OF70mDESb20KZ-F2WXF2W3dcX3elXY"
+"+u00numnG0mC+h71+f71ISQ66kP508Z-F2WcF2W3xbGO9B8810WC1od36YW-BKWXBKW3KxWVzbW4xVHGsx-Z0etZ08XLG0mC22F244ZCI8r2+7F2A6F24438EuU6sn+0"
+"1BB2o0IE+li0+ji004Z3F-XX9KGXwvm+Cu-g1etg1umBMu0VL88714mj+RY12QY10WJ0u7cM2+801Gh-BsWWBsW4H4YXF202r0ICMuq5+3O2w1O21z00nOekBKCjECV3"
+"+lZ0wjZ00OZ4YHXVJe10tK6v+Z432Y4304Z3wLX31wWTw800nuGtB4g0oiQ02Hp3Eui72P20+x636v63Qep7+Ta1Iiu4IOQ2kaj4+-806z80IOE808ZXeDX3J1X4+9YE"
+"GGWF7500muW1O0GCEWn2+dB0wbB00SZ4SWWZVz00oulR6OeR6KS-XJlUAA00n48m1GW-L7WTL7W3iXXYOCW3IYXFD2WFG7Gu49K90u-X2uqX20WC1PeVPHGHP5qYsub0"
+"+KB01ZhHc0W-s2WHs2W6SkWV3c00t465+Fy2AEy2I853EGS4wPe0bHlGSHWF5500t4QE2P20+NK06LK00aZ30WGm0Rdj00GEX+UOyulu6edu6GGCs4cpEKg8s1901WIP"
+"PuVa0uNa00mCM290I4y5EWq3+3I0w1I0EKg5443DXGhUW4W30kW3-sWCiJWFb9W4MDXGc0W-b9WHb9W3QwHGCR7j08X-au-QFeuQF4ax6w80IKQ4E4T4+BT0w9T01AZX"
+"YFX5RIY-M4XWM4X-S4W-S4WES4GGEK4fsbZ01SY3dXWSiBW3NCYGb0W-hBWJhBW6OXYTp202r0oD6bJ7+x806v80MOG6+9o1MOG60CZ-gBWVgB01nKJGW5cVsnH01WY3"
+"M2Y-kBWWkB00tKMU+5R5E0x3Xwa-8GWU8GW6Wz00n8OX9812C4k8oyk0+pZ06nZ0EGp5Eyq4+5901WIW5BpZ0uZQ6uWz840j0OZDd0W-s2WHs2W4LeW3ZIYTa9W4Le00"
+"tu-O2OuO2814mOuy28nF8u-N9euN9KsL6+L4Ia+2XuXSK7Gu49K90ulq1Oaq1um0WK4zs9T0EqT304J0wwFg3e7g3GGEWuGSoud+EenaEuVQL8OQL4CI6oc39VWEy0X-"
+"g6WHg6GGD8HOHOdg1uGSA0WD1xl-7+WV7+00nu0lJuN-6aGj+tl16sl1E0v9E019snH004J8P4cf+Ri0wPi01uO88QdZ04wrXoa-g6WUg6W3HhX4IzXTE2GG678l+lH0"
+"wjH0Euu404Z45dWTF2W4rzX46dW-8BWT8BW4uT10r4a6s1905l61nKZ339Y-H2WTH2GvyuGuVO7a00mDXOKWSw-Z0etZ08n1tuGAJOtZ0Km9+xc6Awc6XtUO1RdZ0umH"
+"X8njCu-g1Otg10GC1A72t0IEwv80Iut5Xbk-RDWURD00u4E6ESJ7srH0QGf6+3032203IWo5XxiTF2W4EaW5EkXBk6WFZh00muGPKu0-K8Z90ulP7OaP74KNAQs11SY3"
+"HuXCE2WFq2W3N1XGb0W-p2WHp2W5qoGW9hdQ1K8n1ehCs2W-H2WHH2W4L1XXG2W4fDX-F2WYF2Gm65kasvH0Max9+hA22gA2ES12EGx6sr80b7Im5ulg1edg100C1EZY"
+"bE00mum5L0WC+-t0A+t00GJGExGjeO781Km91pWCW4WH0EW4HnY-EFYWEFY3vuHfMPNj08nmo40twLB0XWl-A-WWA-W4hAY3T1ZTq2W3syW3VaWDq2W-pGWHpGW-faX-"
+"faXEfaHfguGSOOd718HMGum6F8Zq1ul718b714GZ+rM3jKa-QVWWQVW4CZWWxZY3tTH8Sulz8edz80GCEqo7EaO2sjQ004Z3ecGmjv-Z0etZ08HIz88xTuWpYKYqkCF2"
+"+ZZ06XZ0IWg66UOA04Z3hKa-4tXY4tX3VjXXE2W3oJX-D2WYD200nu0J252XwXZ0MeG9+7G126G1Eyv66ox2ESM6EO6D+ZZ0+XZ0+Jr0+Jr0sGr0EWmD6A+0E834Xfd-"
+"S4WVS4W3b410sOOzD4qnEOd2+-80wz80E0L41PXT6BW37sGujxVZ0eNZ00GCEOQ3EK94sv8004Z4gmX30dW--JWT-JGA3wdOPu05KuVZ0eOZ0umZhuG-9Ot614UD15c-"
+"Q4WUQ4W3S+WZIDGWIwV1Y8O1Yu02L40+sfH0Eqq3XGa-Q4WWQ4GuDutqHacT+tY32sY304Z3Qn00quGWBO771K0A08J0euVYAeNYAOn0Q8uK30GCEC52E8Y2+-80+z80"
+"E8525GfUW4W31JH8OxFa0e7a0uGJR8XrGOtZ0uGLD819uu-Z0etZ0umafu0NVud05a0AXIW-H2WUH2W4rKJWVR7810mD18f-F2WYF2W3Zr20nuGU9OtZ0umeW4W9+h71"
+"2g71XRA1n0ZUE200puX0guFh1e7h1KaEAk+0Ems5ESq2+xH0wvH0I0M4X4hVi6W4BmX-TaZWTaZ4uOaXCpW4XIZ-DpWYDpW4O6IujQd7181NQuFGCu8GC4eT+pZ0+pZ0"
+"Pn30p4cv5pYTV4G1euGmF8pM3uZLKuGRZu08DuVyV8OyV4g0Ii+EsPB0I4K6E454oPB0XTgGb0W-o1XHo1X3Jr30suGuBO7j04MoIGs4oGB0+-806z80E4S8b0YTF2G0"
+"dum7DulZ0edZ0uW2eum+CONZ08H8BvVh8eOh8uFdJvFdJ9DdJ9ntl44osHK0I0B6Eu23+BT0w9T0+JK0+JK0IJK0MeGF+bPA1OIe3BZG1u335u0MB8K90u-n3Oqn38nL"
+"E1GC1SWTt7W5HbY3AaYCs2W-H2WHH2W5jmXVeRZ4F4X-E2WYE2W5p2Z3FiXUV4W6tiX-XWXWXWX44qWXG2W-F2WdF2W4yeWXUaW6G5b-U4WWU4Gng98W34W9EWr2oei0"
+"+0u0Ei272L20+-k06zk0EuF3I8cGs1c0EW85Ema3+p03+n03EGq75DcTF200t484ECt4oCK0+xH06vH01Qd3HZWWsgY4yob3LIX-H2WUH2G8WeeB5K28+-91E+91IaEI"
+"+rB7ES14EGFB+pH0wnH0XghYWFY4ZQXGyEYF-D00v4wu2P20+Bc069c0X1OX5RNy24m921l0AHB0EuP3+7682668EKR6Igb80aJ0duVPM8OPM4qNE4L3s9K01NY4UEX-"
+"PYXVPYX3GfaXF200u40A1eh-T5XUT5X3gN50qu0REOd71KOCEOFL+-H0wzH012i3+GZWE2GGav-wH8uwH8HnR8exWu05XulxWuexWeHcY9elB8n+T5aO+pQ0wnQ01wVG"
+"JO7h1u0W2v0hNuVZ0eNZ0OXRm88LruWlHuGTQulZ0edZ04wY6sG75ae-0KWX0KW499H0IQNg10GC1ye-oHWYoHGugxWuAOdZ0u0HguWFLuVg1eNg1eHZHvde8u-NbuvN"
+"b8HPB52XsrH008Z3KJY3DNX-U4WUU4W-w5a-w5arw5a3dUKG-O7H1uGANvW39uFO7e7O78n1Ou0N8udZ0Kcf+3K322K3Euh76k01Eue61Pe-S4WUS4W4ruWXi0X3EUL8"
+"2vlZ0edZ0umU8eO6h5WZIqvJ+-80wz80E8Z5XkYTu8W48aW-D5aaD5a4qgWVyXG905yq+d91wb91EaO608J9oAu718XrHvFPC88PC81VWPer6um9AuFLju8LjGGCqK6n"
+"2QA51SY3DGY-l6WUl6W3kqXX8jW3kjG8XuVM3eNM3KGzEmE2wjZ0+pH0QoH0IeLC00JGIR7a0umNR0WCEKs9+pQ0wnQ05Wl-V4W-V4WBV4GmDwNo2OX6XuVsG8OsGGGC"
+"vqclwnQ01WY3OCb-xmYWxmY3DVYX3sGfHwmERu-sGOtsGuWFH0GCEGXPsbi0E0g3EeV4sai0+mg4ES120aJ0wwFj0O7j08nMJuWfKO7j0818O48d+-80wz801Ba4N1cT"
 );
-static sybie::datain::DataItem item6("haarcascade_frontalface_alt.xml",6,
-"L1HCvKJCpumPTIWDmeTODulIdgiIdwWkLedH8umdfuFd685d6u07sYGEuCZ3Qv22rCJCEOFEkUQ0C4pCmSZ4Qgd3IyGmIhuJ3WGDp8Z4OBh3tYk35TbsFDW-p8Znp8Z3"
-"Pw80sumGNecd60GEb9d389j-FDWFFD01quY4YFD0nuG5xAX3yvQH88H9jGHEvSpDrKZ3gsfbr910quWCyWGEm0Z39KY4qrWpNk00pul3oOi3o8Ho9uG+Je6g1uVtCPMt"
-"CHWCku0xXI0Co4yPCO3CpSZ5SwYcjd02qa3DEyfi4W3DEu8P0CZcTG16s83EuKZCoum-LGGCuuG4D9Dg1uFaGeCaGuWfTvWDIe6g18XBixWy9uFK384K3OnPNmGCoOJD"
-"Ey4zEmJiQA+90SZ3l3A1vSZ8DWWYpJW4c233nOJEtu0WI3WCEyB4IFQ0+h846h84EG0Vw1v2MC0A+VfBETfB4SZBEG7H443CEa9w5OGXoR9caum4dA1kY0HEnOpDsePt"
-"zm2DvW3CrKpCvW3DsGZ3sqYsQQW-92Xq92X3G5YSVx00numsz4g5+dU22bU24q2DEKrm0SZ3fED2uSJEESCngcQ0Iysr4K3CEuSt0OZ3wNabRQ01m4Z3mWa38z51s0Z4"
-"uWlpGD00qu-r2Pyr2PXX-8dJXuGtYvVWLOLWLGGDkuWxMumMBGGCruGUn8xCnw01t11CqaJEuuWYiv08kguz40GDEaA20OZ4aM92rKpCEKzSIVQ0+RjGIRjG+3r0g3r0"
-"EuQm0SZ3e-22qCpDEeiA0aZ4IkWbuJ00q81oeI0Euu0ekH0CruvrJ0WDECs8ECaS0OZ323XsIk00quFYGOCYG0WCE8LIwTW708Z31pKWuxlG88aG8m1EkCpCoS3Cmu0Y"
-"ewmaWcuzMgU28KZCnuGhpvW33vWeiPvdaWmCvKZ34W46n8JEq8JDmuWe-8DK3uVYGeSYG0mCIWDgEWrDgD4PEG67E4hs97A0AuHap4H0Ee0Y0CZ3kzJ6auU-J8H-JW7T"
-"e9NPpXsRiHcFj0ZBmGJCoSJEpC3CuGJEsGpDrmpBPy11A0I71G7FiLcPqzbTXncFmuYDnK3DrGJCvOJEoaJEp4ZDyyI5TO3D0mWSfT6QHK3Hr03Ct0JDq83CvS3Cv4ZD"
-"umpBPu12yyoN5GG5+G0FVb134128y4IBj02ToLMPW43Dq0IBj83708ZA0q0BW8tRlH78kz6PbfJB0G28WmZPb56Tr9NPkC401405y8NPZHtS+O1000I09Y2CWa38r0YC"
-"WqICk40gLGQ4103FVv3CW43CWK38n0YC5C21yyYKE10AyGNQiHNPav3CyyI3AG0Fl8rZ000FvG8NjKZBmapCm43Eva3Cm43Cm8pCnKMBm03DIYQ0yCJEtKJEq8JCpG3E"
-"rSJCtWZbe60Eo83Eq0pCu0ZDsWZDq0JCQZQ00KZEx5W-e6WXe606n838n438oOdg1GGCp4G904JDhwap14GI08J7au-p1qpp45ZBoKZDuS3Em8ZCn03Dr0JCt4Yp0CZa"
-"E70FqapDv4pCu0pDsC3CrC3EvOfp1WJEpaJCuCZCpKJCsW3DrSZsE700sulp18ip1mnCW4JDWC38pusT3GoCW4ZDWC38n0oC+Vt0+St04XZBm03DuGJEtSZDs8JDsCpC"
-"ouAg1G3EqGJEt4ZCvaJCt43Dr89g1mJCsCpCpOZDmG3EpCZDm8JEQZQ00SZ-e6Wme605n838t0oCwLt08838uK2g+-H16zH1S4ZBnWpDvC3C1403nGZDmaw7M6r08KJE"
-"m4SzWW3CqO3DvCJDp8Pg1m3DvGZCs83DuOZDvOZCqCpCQdQ00WZ-f6Wmf600rO8g10GD+VQ0UTQ0WOZBna3DuaJDoK8nCG3DpCJOFPPn6m3DnaJErKpDv03Cq83EtSZC"
-"IQQ0yKpCoWpDoOJCt83DqSZCmKZsc600vulf18if1umQ8WGEWaZRsJ04v02EWaJeRuVz4uJz40aDkO3Eoa3EraZCta3CvOJCoeQd6mJDq43Es0ZCu83Do4JCn8JCIQQ0"
-"yGJEmK3Eua3CpGZCt4ZCq0Zrc601r0Z-c6Wmc606r02CWC38tucf10XDW038n4sS+RQ0+OQ08roCkS3Cs8pCq03DnO3CnGJCvGJODPvy4WmCt8Z3IW08maJDm83Coa3D"
-"IUQ00KZ3sX09m0ZCqa3Es8ZDtej4AGGDnu-f1eyf1GXCW4ZCWKZRe606v0YCWG38ru-G8OqG8uGNDGoCvSpCvGJCnCZC1N30s8vv9WZDqS3EvOJCn43Cn4JDmKZbAD08"
-"r0JDmC3DsWJDEm+24WpDQVU24KZC+FQ02FQ00OZ3FkWUqkG1aOtiB0mDXWU6ZuliB8ZiBW2DmWJDm0JEqOJCoumkBKykMws0WGZDu8pCpaJCpuWWBGGCoOPO8mZDpSpD"
-"uW3DnGJErKJCpaZCQNH10CZ-B7WmB701nKZ5pkWSgyG0bO1jBuF3A843AGqCkapCo8ZDuW3EoOpCra3EmWJeOOPP80HDqK3ErumPFGnDs0ZDu4ZbbX0Eq4JDmG3Eo4JC"
-"u4ZCvSpCU-h1+BD46BD408ZYf600ou1NDuFg184g1WIBnu2EvSJEu4JEtuGGB4yKXagbJD06pOJEm4JDvuGGI0nDtS3DtePm603DvS3Cq8JCtaJCmSZDUxH1+FD4AFD4"
-"0GJWOZWDWWZR2R00nKO-8C38qqog0eW7PAH41W0FVvJ095sTHGY-XKGlX4Cw44pCX064q0ZCrCZ3SGXbeR0DmK3CrOZCuK3ErWJCrGZbTK07qWJCnCJDtWZ3Hm03sWJC"
-"qeT75u-pGOypGuW0FmGCr0YDkbS0CS38u0I0Zu-CAOqCAW0Ck4Z3zG1Au4JEv4JDrCpCmSZaZ60Eo0JCt03Em0pCuS3ErapCMwY2uGJEv8pCs4JEs8pDvKZCreDwL0GD"
-"+hC46hC4EO82C43EW4ZSNl04u0YCWOJ0auVf1uKf1G3CnSpCqOJEo03DqKJDs4atcaW5oOz0kqu5OKpDnCJCqWJ06GGCn8n+9eOZNW3DuaJEqWZDm0JDp0ZDoGZt8DW-"
-"63Xp6314n02DW4ZT7DW36OX-CUXICU14nuIDs4Z3JT18r0ZDmW3Cp03C1ZhbkJ0Eq8JCrC3EuWJEq03En4JCQEJ6WCJEoO3Do0ZCn4ik4aJEQxE1+RC46RC4EyI6+dN3"
-"YdN3y0ZBnC3DpWJEoaZDnS3DmGZ3cxWZ8D00n4ClW4JEma3EoWJCuOfe1GpCtOpDs4ZCuS3Dr0pDv443ENj60OZ-23Xn23X3oMXVY600tu-6Fus6FWZCqK3Eo83DmSpC"
-"mKZCq4ZaGQ03t0ZCt4k-04Z3zL10nu0o9uuw40pDqSJEmOJEoCZCvG3C1KZqZ6W-+2Xn+212q0IEXCA0qu6x40GCEq970OZ31zW4d9XCbOG01m0FVv3DE8s3PCY-wdWB"
-"wd0Gpu2ErKpCt83Cu0JDta3Dm0Z4SoXb9l01qCJOT6cRG43DuC3DM+s0OK3DoSpDnOZ4jf01pSZ3H5XqC7W-d3Xnd3X4RyG85gMHUK09Eui6cnS00WZ-LsWPLs04ouoC"
-"nOZ4XU16p4pCv4ZDs8XFFO9p1uGPUmYDvWpDnSJCnSpCn0ZaLs0EqOJCuO3DtaJEoOJCmapCQR550OZ-e3Xoe315m0ICq0YCsj971KIv6uVAAeKAAm0DkWJDEG74a0pC"
-"n4ZCm0ZDnaZ38YWbh60Es4JEnKZDuapDmO3Em8pCM2q38G3EuuWlPm1CuOZCuW3DrezaI0WD+dE46dE4O038nC38o0ZTJAH1b42igbt01y10quI90u-H5qxHi8ZBqOJE"
-"vapCua3DvumNA8xmSmWCrOZDEWx8C8JEs0Z4ehXZIS0Dm4pDnaJEuSpCv83DoKZsTi10su-3HOy3Hqk4svG4fBX7f3XMIS02p0YDLCY-B7GFBx0KbmHDqaZDvKJEo4IN"
-"Eq-7Ekd2q8pCtWZDtWpCo43EpWpCMYw8q8ZDuKpDtCJEsWZDvOJDEKk2Ipm1+lG46lG40WJOL6IWgnm1DdE0pqsa+FQ0zCg3lAHewWIEraJEsK3EoK3Cu89VAWWCnCZ3"
-"N+07vWZDvWZDnOZcaR0DvSJEtC3EuaJCn83Dt8ZtgDW-C4XnC4HWmx04HO7pNKgEEeI9M8B2+RQ0zOACouYDva3Dva3Ev4ZDmuWac81WZevQFG0Enu07Tm1Er8JEr43C"
-"rOfg1mHDrGpCn8ZCo4k74GJEE093Ixq0+7H467H4IG23XigQEDG1aOY7Ru455a2pPGY-C7GFCx0yNWWCp8JmaZ1Dv8JEqCZCk2B2KG3EoKpDvumXKmGEvCZDMsK98GpD"
-"mKqE0CZ3WF21vSZsu410suFEHOCEH81hDGGCqe7zD0GCE8T3Eqv3fTdJF700q4APPCY-E7WBE704suoCm4Z3GE27sKZDo03EvaJPR2mCIMK1CGJDu4Z3U922rKJCEGq4"
-"0GZafm00rumeKGoCs43DtW3EmKJDQpA50SZ-a5Xna5X3EVX3fmWQQE00u81Y8uXUAu-f1uof10XCkGJCpKwGOSpCuK3Do8ZgjI1Er8pCo03EsSpDtO3Et0pDQkP6K0JD"
-"nSZDp8X0EWmCpWZsiR00tuFQHOCQH4u+4038Eun6gbQ0E41BEW430CZ-GtWIGt09nu2CpC3CpOJEsuGnBWGCmWJ9hQfK3GGDr4cX84JEp4iz0GZd4Z2CtWJEnapCuO3E"
-"sCpDm8+g1u-HHOyHH0WCXsX3UVXQg6W4TxX-9RWK9R0Dnu2EmGJCnO3CpOJDn0Z34LY3uzWbLY04r8ZCvGZ3dR25rO3DqWpCM+k44G3CEm5840JCEm43403DUN920SZ-"
-"Z4XoZ411p0IWQ3GCszZ2EWj7EW03cTi1EuwB0GJ7auV85uI8502Ck0ZDnG3CtWJ8G31Eqa3Co8vm6WZDoa3EsWZCmapCs83Cp0ZcUf08m43Ct0pCo0ZDEex904Zs1220"
-"tuVGHOSGH0GCEYS0IO3B0OZQ7700q4sjvek-67WF670BvK3DpaJCp03CsS3EEGM3AAt3qSZCoWZCu0JEm4JEmW3EESFDEYJ4SSpDp43Eq0ZDEO534GJCUBk1+ZJ46ZJ4"
-"843CW4Su443CkXJ184ZCW4Su443C+Bk1A9k140ZBMmVD0OZ3c332rW3CQos0q8ZCsaJDnC3Cn0JEtWZDE0G7AQQ0SKJCu8JDoa3CESlC8K3CoeThK0mD+ZH46ZH40KZ3"
-"Nl00uO7-BK09EGb2cHJ10aZ3xlG6ZuVR3qNRi8ZBqGZCpSJEvGpDtu0x9G0Cr4E0QYA2W8pCt0JEt43DquWHfuWreeuo1W2Dma3EnKJCm83EnuWAaez8O0mD+-J4M-J4"
-"1xjTyk10quWpPaZgEXS3Emf21D10oqIy+xS0zuC6nuIDqa3DpuW0p0GDEuh704Zhzk14tSpCtKJe-0WC14WcBQ36qO3EmGpCmum3JWWCvOZt8tW-Z5XnZ514t0oDWOZT"
-"xM20v8HRF0WD+lJ1MjJ1q8pCv43Do4JEu4JCrK3EMkR9CSJCqOZ3hAY3+vY3zXWagz04qS3EpWZ3d-25m8JDua3DUlJ1+ZJ46ZJ4IiP3I0Q6gb135K20o4SufsZ-CDGV"
-"C5SuC4ZCqKZ4UgY3BB30nePLMGWDpuWkPm1Eu4JCvW3EuOPQFumBXWHCo83Eq43Eg7k10WZ-G4XnG410s81lb87tq00EIuT30aZ-Y6WIY60Fou2CtO3CnSJEv03DtKJD"
-"oaSlMsR3qCZDoCpDrS3CsGpCq83DYY82i4pCs03EuCpDn8pDsu0Ka0WSYumFEWaF1GGjpRZ7ze2y+00E+3H4A3H48838nuW5p8NPdaG9+Vs3ITs3G8ZBvS3EEOG4ICp3"
-"80pDm81uq0GDIwP3eGpDmKJEp8JCq0pCE4nC08ZatJ0DrGpCoW3CnW3DoO3EvKZ3tbYHg601yyY302a8X046yC7TXTMPVPYQCWIEmuYCrCpCqapCmuGiuGXCna3CyyYF"
-"b0GBlp1Fm5cSbv6T+4O9DiG4Q0YRbX7T+qICyyI19Kr8PzHHRK0MEWj7ciGG0mZCV2W4u2K3K5G05OJ0Y008+R-06R-0EyQ4EaR7gfP1Eqe908Z-sFWJsF0Fmu2Cn4pD"
-"t8pDqaJEqKJDo42tvGRFX008oCrAiC3Es0JDnWJEp8pCqu0JC8fH20WDEeFEWOpDoK3DqGpDvuWMXOaH2KXSv4T01apd+x+06x+00SZ4pvYSfgW3KgZ3bSZ-ppYGpp25"
-"mu2CoS3Cbk50ouWVpuW1ceud1G2DpWJDsK3Dv8ZDEWVF0GZcV601tKZ3MBa4oI42v8pDMtwC+BF56BF50aZ4XmWUV6W3PPY-YmWIYm07jCZBsGJCvKZ3xd35tKpDrC3D"
-"ImlDMgO10KZ3JwY3wf04u0pCpGZcfE36pGZCpCJCruWmrumdHOTf1u-xKeyxKuGGwuWune6v40GCXIGO6vVVA8KVA0ICkaJEvK3DmaZ3Bf00ru0z+OwbFGmCou0J41WC"
-"E4M40CZ3C9YagJ0ErG3CmCJCta3CtCpCpCpDMdS3+pC56pC5EKS30KZUKQX4BLZ34EZ-c6WGc606quIDoS3EpuWSnGHCo03Er4Zhz4X3naa3DV44t4JDsCZc344DoapC"
-"r03DpWpDnG3CoSZszWX-iIXoiI10qKupobIDjna-UGYIUG2HquoDua3Cv83CrGJCoGJEo4ZDXnabcm03q4pDuuGvnGmDouWNpuP5HmnCqG3CsGZCpum58XWCrOZqZ7Z-"
-"iIXniIXYb6GYmxFf1e4f10HCk4pDo42fEizGI8GGXGgb7I15oWJEv43EE023CWZCt4Z3Q8YY7I1Br4pCo0pDmSpDvW3CYZ-5+N856N850WZ3nX31n0JegPckCvWOR0GD"
-"IyDJ9Al8YgG41G0FV5GIEOY2+B62A9620aZ3T72ArS3CoGJCs8ZCs8Z5rvYclDW3qs00ou0kR0nDoKZCoePYR0HDs03EqumwpmWDq83DQ-s0+B856B850OZ3PYZUbN20"
-"t409EqM3fai-UBXAUB13nuIDmuGEwW0Cm0Z3Oh42p0pDX5db7e02q03DEaW2Imw28SZDtOvsgGHDq03DtOJGM0HDmW3DuOTO8ulXKeiXKGGCW8HvS8t1AumluuG2Julf"
-"18af10HBsu2CuuWb90ICvSZDq0ZDrSZ4u4XdDD0Bt4pDsWJEoSJDtGJCEKxEEYH1ECM4SOZDn8JEp0ZCYVs9+B946B94EaE704ZUHVHOj1GCEWL3+Nl32Ll3aCZBp8ZC"
-"qKZCmSZ3dD33taZCv4cJM+h10CZ3MrZ3FW15mW3CuKZDQ2Z5KCZDvSpCq4K54aJEIiPIEd94+h946h94+-q0w-q0S4ZBn0pCtGJEEmP9COpCsKZiTR30t46KWSJEnSJE"
-"rSpCmevLD0YCpSpDqa3EnGZ3BLZ3DWXpe6W-Z2XnZ2X5rgY3HiaQeXW49Ba3EpX-HDWHHD03j4ZBquG2P0XDvaZCnu0Bb00Eg6X24KZDEKy8SWZCt0ZCsCZDQkL3CGZC"
-"oCZ3Ks06p83Es83CveDcUuFgGeCgGuVe68Ve68XWPmoDpaJEn0JEuaJEvaZhYX32o8JDEuqKC03Cv0Ze2y02qSpCEmX2E4-2ES-40aZqSr00nuVgGOSgGuWzK5yUgzq0"
-"EuUH+R42MP4204Z3qFX3RK27tWZCnaJDuCZg2y05paJEv0pDECzJCK3EtGZ3bFYZ6X09qCZCtCJEuKpCuuGTUuDC4f23P4G0s4s5+VXMETXM04Z3Y-40qu0sDecND409"
-"E4IL+xU22vU20XZBuC3CoGpCt8JCs03DpGpDgM-40GZ3hPZ3uTa3+242paJDIM-40OZ3yzJmM3HEv03Et8E1wu-f18yf100CX9C0vum8HOsf100CEiU2ECF7+tU22rU2"
-"Ia1800Z3lv16t0JCmCJDuuWWPfuuOuGISWGEsSZ3Xa42tG3DESh6Egq008Z38c44qSJCq8Z3xXWtWYY-Z6WmZ600v4oV1MlQZ600v81T7v-wPvqwPnIBouYCtCJCs03C"
-"p8Z3SA30vOnr5PPaBGWDnuWlAn1Ev43Cra3EtumIxe8g100DEOb28OZCvu0F1HGEq8k6WuFg18Cg1uGzJe7c6uWLDumEDuVI3OKI300EEu99SOpCp83DqKZCEKiFISJ3"
-"Mwj3WKZCuKpCq4JCquGaXG0CvOvDDmmCuGpCEuzJEOX24OpCEi25E-u2+R84AR84IGYAEeU2gzq01KY3vcZ-FkWIFk0AnuYCmWJCpKJEtGZ3qm41s0Z41XWbFD05rCZD"
-"mO3DEKp8CG3DrSZ3HWbYFD0EpG3DtCpCraJDuG3EmWpCMVF108Z-72Xn72X5tLXSXxb4AgX-b6WJb609ouYDr4ZCtC3Cqu06EvWCZOQXGG1DrK3EoaZ34r33oW3Enefs"
-"TWWDnaZ3z217mapDnOpDvOZrCk00ouVXGeSXGumJ05eqkrq0Iy-OXWg-ddWGddW462X3yu33vOZDouGGT10CICu7Mwq00CZ4ZF41m0Z3DL21nCZ3HIYYED0DrCZCtOZC"
-"u8JDqWJEmGZ32LYotJ00oulXGOiXGu078umAqe6g18HebvlaQuaaQG1DkaJDs4Z3v131qGZ35U30oegULGnCvO3CraZ3c3Z3u-acyS40ruWqa02DmSZCv43Dn8ZtpJW-"
-"12Xo12X3GqW-qqWuqqW3Dk0AqCJEm4pDt4pCmOZ35PbaLX21t0Z3+T30quWWoWGEr4Z3+MZY8DW37C53uCJEmuW02nWDsWJDIt7408Z-z1Xnz1X3hG30oumkUfMI381K"
-"q4ez+7F165F140ZBEWCN0aZ3-c20ou0lk0mCMQvDOK3CqaJCsGZ3o742vOJDEOvOAEQ0q8pDsOZDm8JEpC3DmO3EQ3SM08Z-w1Xow1X-YdW+Yd05j8ZBtG3DECkASCpC"
-"mGpDrKZDImu2MMf1i8ZDt8ZDp8JEp8ZDsOX1oeeg1K8yGSJCn8pDEatEQB8O08Z-z1Xpz1HmJAdldu04S401+BJ329J38CZBpuWqDH0Eu4SOCWpDvSZglL11qKZ3Pw04"
-"oapDoOZ3irWbss12s03CEKBOSSpCo8JDq0ZCMdy408Z--1Xn-110num+-uGkTucy4GWDWuWZg1WC+VQ06TQ01N91o0Z3RX47t0pDuWpDq4ZbCC59p4pDnKJEq43DouG5"
-"ifve1mGDoCJDEaWRESbL4OpDE8X208dnK230oulUGOiUGuWpEude1uVe1uLe10GCEqu4EiUFCKJDt8Z3pschGx04oOJDpOZ3ap53tSZCoef-WG1DmC3Dp8Z3qz43q43D"
-"suWV3vSf1uVUGOSUGum6I0GCEunMkXq0EiK3X1d5gqWJkHIOgbX8+Vi8gSi8EWbCm0ZCm43EvGZDq0JEo8Zh2cY3v911rOZ3rO20suGg39vCNW1DrSJCvW3DEqQD8OZC"
-"tejhK1mC+d946d940WZ3SdGmvgMo100EEqAFEauM+Zh12Xh1E06ImCJEvWJCtO3CmW3Ds8ZgTXW3o911p4Z3Aq23nWZDruGTBeON80WDE8d2WCJDv0JCqKJCn4wVA3t0"
-"0CZ-R2XnR2X3wmZ4kiYQd6W4HCd4W+cQWWb6QuM1YuFS3q7S1hj3SG22sKJEECiE4G3CEys9AoF6KG3DpSJEsuWBImGDrGJEE403AMS0ES8MIGNSGOpCn03DEOWGENS0"
-"+VB46VB40aJO8vGbGeMn18nlDvmNIuFR384R3W0Dk0Z3x063oa3DruW5fGWCtuw1K0ZDu0pCoC3EvWpDv8ZCEWrMAUQ0SO3DpS3EpCJEEGzJE4N6IRn30CZ-v2Xov210"
-"ruWL1f7g14G9bLf-f6WHf602j8ZBEmuTaOpDvGJEt8JCo4Zhmt12pS3CXT13uO3CouGmWP9yTGJDp43DpCZCuGZCu8ZDuumdbvSK3uFmGOCmG00EEG826sh1E4K8+ZQ0"
-"AXQ040ZBEmmP843EquGqWWmDsOZ3j8XZpJ06t8pCrKJDnuGfdWmDuKZbmrW35B10uu0BP01CoOJCoeTGR1mC+-B4+-B4+-B4A-B4GGZBr03EE4bHOKJCnaJCt8ZiEI70"
-"quWsN10DEKZ94a3DUsF6CKpCt0Z3JIb3kbb3NJbrsJW--2Xn-210t4OzEOCNgrf10SZ34YW4QTX-0XWF0X02ouIDIGO70aZ3hc43p0JEregLNuGLpuWlyv04+u0Jk89i"
-"B4MW4G3CE8GT4KpDECdHMVQ0+7C467C4IKhDECJ3sTQ0E4q3+FF1ADF1EyJ804Z3-b77sC3CqO3EnCZ4MyabDGX3X477q4ZDv4JDuaJe1Ovf1WGEsSZ3Nr02vaJDEanJ"
-"MFJD0CZ-53Xn53X4sMXUSNb4dXW34XW-EDWIED02q4ZCEGCDSS3Cu0ZCtW3DgUQ0EmjP0CZ3K3a4CLc3TjWYhdW3E573ra3Eu8nA22mDQ3K80CZ-73Xn73X4Y6ZUEI20"
-"nuGox8HbIuVz4uJz4u0Tzumf90mDECYE8WJCpen-EOPRpGGDsuGPcGnDnG3DsOZ3VAbaFD05qGpDn0JEEqJBE8rF0SZrFD00qulfGOifGuGmVftf10mDM8A4+-u2Azu2"
-"4SZBEmhUE4NF04Z3kH71oGZgC917o83CtKpCr0Z3zv50v812BfeJ300DECJBGG3Dn03CI4OJMFHD0GZ-b2Xnb2X6vSXTFlZ3UX30n4im+xq02vq0E0v28SJDnumSz0HD"
-"qOJEpu0+1f8aBmXDrCJCo4JDvuW8KHmCnuvQ321CnSZDq4So0CZ3dXarQ080qu-WGOyWG8168uGfi8tF84sR0SZ-ADWHAD06muICq83Enumq4QXwVPfw400DEG028OpC"
-"mu0ZGHGEsumwge8H3GICqWZCmOZCmGJCESnXQVRC0GZ-z1Xoz1X3JSH8cgMe10GC+Jq0YHq0KKZBrC3Drum69v0ReHmCvugUGW0DuaZ3kT10uuG8vH0Dou9py1GEEyAN"
-"EaBGC8pCn0ZsvWW-eeeoee80puWBDet8I0mCEuI3+ly4Ijy4CqIEkOZ3dVe3h051q4Z3mCJnJQP8huW47XGCnOZ3yp22ua3DEKB4A+q0aKJCvO3CtGZCqSZ3oQes-420"
-"quFWGeCWGu-J38-J3uGYEHmCtu0pB2nDr8ZCpu0mHOwUfGIDs4pCp8JDoC3EEu47EO02AYQ0Ee47EOgBKCJCq03Esuzz4ulVGOiVGOXqT8dE8u0t1wVE88LE8mGCkOZD"
-"1-25vOJDrSpCE0S9cMQ0ESfGOW3Em0ZDrGZ4x7ea6k04rKpDuWZ3Hgb5TfbrPSX--dep-de3bAd3s6bQSQ00t81Wpu-UGeqUG0HBpuICnKYD4SJEEOU24SZCgoq0CC3E"
-"q0Z3dW85vWJEm83EEyQ2Aoq0eKpCvS3DtSpDqO3CEWYTMdSN+tVYAtVYEOCB4W38ofjUE0RHEiPA+h742f74GqYDkG3CESAS0SZ3AC51pOZiY810r8nINuWEvnWDoO3C"
-"EGSEAQQ00GZ3l+13nWJCq8HUL00EQhu2+l74Al74I8CaEC6Vgvq01KY3ina-zbYIzb23puICp4UrE8SYG03DrC3DICZ9ME42EGuN48ZCEyGDEeZEYcKFEeBEGSJEnaJC"
-"EG9SMBN5+3WYA3WY00Z3ssXUe600muGYQ4g6+7r065r0EOj3CWZCo8Z3G744t03CuWZbkXb3m6Z3hx83sC3DpuWtBAPc600DEWrC00Z39lW3+Rbsd1d-ydeoyde47ybU"
-"Ek00vulZB8cZBG0EkuGvo0WCEG-R04Z3kV30puQnYGGEru0K6oGEpW3EEKpNMQy44SJCXzA4m0JDoaZ3KTdrzb20ruVVGOSVG8HjR9nJLesy4KG9Eyb9fjaJsOY3EwY3"
-"yPY-bgaIbg46jGZBoCJEruWmxGHEr4JEu0Z5xXZbYZ19pa3DsKJEvaZDmuGFzuWt+e8m6GHDna3DvCZ3Fs03tCpDvuz55uVgGOSgG8XbGQdP881A4vF6FA56FYGEkSZ3"
-"XYd3aX00num0cug14X2DuapDr0pCuKZCuumuYP9WVmWDmO3DEKPcCKJEuCZ33ReqlmX-+deo+de3N070puWsHPM4-4ysIyN3+7P525P50DZBvapCq4pDnCZDpSJCnCJD"
-"Im4JQoq0m83DrG3Dm4ZCrGZDrCZdokW3iE84oWJEoGZ3SiasQy80rulfGOifG8HzbuWSzesf1uW2ovGKhuHPHvK650GEEO0KXZGgyuFudu3udWXDtWJDmKJEEiD84CJC"
-"MUS004Z358d3ldb3wF90tu9udGYCmCpDtWpDqCpDEmzWMdN3+ZVYAZVYEKN3wjR5Em3P+NC4ILC4MSY2EmoK00Z3zn60qu0yleO-OuGsdWIEpKJCqG3DoG3DpevNRXWD"
-"oOZ3Wo96n8ZDoKJCoODmGuVz9gSz9IGCr8naVO7jFvWgzu0xiu-G38qG3mHDkO3Et83EpuGxiuGaauwU2HGDouWiLGnDu4ZDuGZex946pKJCo43EquGcCnWCsS3EQVY2"
-"+pJ86pJ8fTaSiyJQ7vVxTuKxTGGCku0hFH0Cpum-MAX88egPIGJDtO3EpWZDn8JDrO3DrePgQm0Dr8JEE0vAEGiU48ZDESU5ApNA+VVYAVVYIulAEa27kHh1E8m8cmy2"
-"+3f1k0f1WCZBt0JEpWpDmuGO80nDtW3CoeQjLWGDmSZ3P5A0uumWFH0DuefTNImCnuW+9u0Jm1GDE0iLIBW20OZ-x4Ynx420tuGS7vmFCf6g18Hb7vlgQObgQGWCkuWt"
-"O62hOGJEnKJEnKZ4sv20q89ZzWHDqO3Cu83CMSO3403EMsr50GZ4ew57sW3EqGZDmGZ3n8coGDW-2eeo2ee3HvY3SKcSuJG0buWCcuFONe4ON0HCk0ZDtuGqim0DrGpC"
-"EyTUg6r0WKpCt43ErO3CvuGNz0WDEWt2Acl3EyOTSCJEmWJEsCZCEOmDM7r0+RC46RC49-f3BRbPKrGoWw00FuVLDuJLD0mCE4OYiC3Co43CsO3DuO3EpORhQGGCo8HF"
-"IwWOh00CMsU2WKZDqC3EpOZCr8nXf0GCM3DB+hRYEhRY04J80wm9Ie6g14G9EKL3+p+EEn+EGKZBnSpDEKAfS0pCo83CqOZCI4s5MUJ3OG3DvapCvCZ3Ev40muGm9Afl"
-"LGGDoumVbX0CnWZ3K6A0ueDBhuVk9gSk92WDXag3pjWQf6W4dYJmYw-bB8qbB0HBouIDquWBC1IEuWpCvGpDmSZgxv23rKJCsuG1-W0DpKZ6zcWZvJ02q0pDEavACG3E"
-"u8Z3rAervJW-c2Xnc2X-Vaa+Va41suI8b1GDECYXEWh648JDg2r0EKM504Z3rd30quGcLwmPae8g1GZCqOJDo8pDvaJCpGZCrumt9wiI8uFJXOCJXuWCc6Or+-q0M-q0"
-"WGZBq83Cr03Em8nKhwWd7wGcBOPy9WmCuCZ3yed3ZCd3UZ90qOvz40GCEWnY08Z3tV50pu0V6QzJ3ulonOion8nXfe7g10GCE8s5caNSEH-4Q0Y7+BY7A9Y7OSZBqG3E"
-"uSZ30131nKZ3MxZ461ZbA700qum9JvGyJwW3B20EEWSXA6t0ES4KCS3EsWZ3Ts01o4Zs6Zc-NceoNce3KrZU97G0ZO7o1umGwbX8+lo3sio38KJCnuWrInHCqaZCrWJC"
-"pewXNmnDq4pCsWJCtuGKnHGEnuvqGumI62WDEqhEGO3EsSZDMdd4+BPYABPY44pCIiUgEO0Ncjz2443DIqUgEigW+pz2+mz2Im+7E0rHCaJCmCZ46p50s89AFWnCsG3E"
-"u4JEIujIEW-CMUJ1Eyj4C8ZDu0Z3uZ00nu0L6fit6uVQ9gSQ96oVIerAgHQ0ECxg04Z-Z6WKZ604vu2DvCZ3hE12mSZCEaHV0GZ4F3XbLlW3Fha3XZZ3hs62qWZDMUd4"
-"EK1D0KZ3Ew40qu0GN20EMRIS+dMYEdMYEKNF+XQ0I025+dQ0MbQ0E0H6EKXdG4JDm43DEiWHMUp8EumY0GZ46+f3J+Xd6CACpCpCrOJCmOZCu4ZCuu0mruyI3uloGOio"
-"Gen4Z8dSIenKSuVSIeKSIG0DkuWhQG0DquW88G0DnumW0vGAAOvI3G0Dsum0BoHEm4pCr4JEoum9-fuN80WDEyYHKKZCtW3CnuG5iPzLS0mD+hM86hM80WJWARev0vGt"
-"Qu-f1eqf18HBSoGCv0pDICmF8KJDn8BvPnGEp0pCE80PEih90SZ33rWYe601qKZ3v311u0Z3oYb3IlWqHl00tulZ2PiZ2vGcL0mCEus5off1EKC4EOeJ+t322r32S8ZB"
-"u8ZDo8JEEWEY4W3DEWkKc2r0EaK6CGpDtaZ402c4ObeYe603r8JDtuWztHGDu81ONQj6d1mD+ZC46ZC4EGn8I0b4gXQ0ES0XECTa+-c46zc4E4CQ84JCpumQImmCpKJC"
-"QGNPMUF10KZ3hF36mCZCrOpDvuWSg9Pw9G0DruGkWvGrfmGEoaJDECb2Exf1+VC46VC40OJWtxmpAfsf10WDE4l80SZ-tJWJtJ02nuIEEuBIW43CrCJDn0pCm8x2ooGD"
-"qOZCEyIbCWZDoWZ4ocbZED00tu0REXWDt8Z3SR51n8ZrrlZ--Zeo-Ze3BLc5HcYQe6W4rgX4XxLXtx4oGuWwucX8+3m3g0m3O8ZBsC3DpKZ3jS33tSJEmOBuLWmCqKZ3"
-"x+63oOZCmu0x-fPS3moDnWpDr0pCrSZDoSZ3TYWpnDW-u5Ynu521s0Y3LwgSUCY3b2X-dxYKdx21tuY3xdPWVxGEXW0Dv4Jnz20DM+l3OaZDtWJCraZ34k01nSZ3LnZZ"
-"lD00ouW7IXmDv0Z3dF51rOZrsGX-+Zeo+Ze4HzfUhWY4Hzf3neGQkvFJ3q7JI8A4WaJDr03Dq03Epu0DOPvmzGZCu8JEsGZCuaJCuWpCuuvfTIYCqCJDmWZCnapDE0wW"
-"MZW2+lFYIlFYEyM8oPL3Xjc3jFX-6eWG6e01quY30n80vuma9GHCmOpCqKZ4LrWb8D04qKJEm0Z3kjA0vuGokuWYtv8I3m0Eva3CESsN00Z3pvasnfZ-vZepvZe3NIYU"
-"8D00numta8XrBKij+Zq0zXa3DK80nu06sn0CmCZDISrTIgE1qKZCp43Dn03Es43CnKpCQUmU08Z4ukA2ua3EEeMU0aZsEM10uuldGOidGumNg5IVgT521CY3GrGYexaL"
-"8uGhXaX8+BS0z8C0ru0suwmtKwmz8vG2TAHLNePQ3uGM11GDIeDhEacMQYO84K3CEO7YE0NjEuxWMd050WZ-+2Xn+2X-fDWzfDGmn2XCs4JDt4sCE4tf1AgYOqY3jV23"
-"mSJEnuG3bGGCruWzYu835uG7k1mDE0alCSZCtGZ32m50oPiST10E+dB46dB4Ei0cwjG1Ee5WXre-AKWGAKG8XoHCpaJDvWZDmumtU9XFcuOe1WYCnCZCt8JEuWpDvuG8"
-"3BfcB0HDmG3Ctu09C20CXwW333ZpX6W-o2Xno2X3JBdUAJI0ZuGMmaw2+dE1Tck34Gg3UQZ3AD82m4pDEKkNcYb4GOpCuSJDEK1WC0pCtOZ4FJfY7DW3v026r0ZDv43D"
-"sum07QDMI00E+7B467B4E8F6ImC9g9h10CZ4V440ru-f1eqf1G0EkuGC410EEqBXG43EpSJDkI-JC8pDraZ3uJ86uSZCp0ZDuOPQhuGYIumKTIGCvuXvPwSJ3uFUXOCU"
-"XOXuEAtQ45m8+tq0Irq08aZBsumeL8XkF1nCpKpCv81OYffD80XDuKZDquWFp2GCEGyMQUEL8WpCqu0jRXnDv4pCsOJDMlu70WZ-C2XnC2X-WbazWb46tuYDrK3Co4IS"
-"E0o70KZ5o-abd602r4pDE0VWG8JDt8pDEmnSIcf14C3EEyn3483CEGMS4OZCEaXREpq0+NiGANiGbWg3twYQqJG0buWZGu-eaeqeaGHBuuICuCZ3iZ11o8Z3ij21v4Zg"
-"sw20o4CPKCZDvGpDp8nfw8fg10GDE4FT08Z3dLD0ouWDfQz3j0GE+VWC6VWCICUn+5YY5KY34eb56XWJHr00tuWU8cn8+d62ka620aZ34Rj3z1X3sWTWkhAp10XDnC3D"
-"muGM4vGAGH0DpOfm6W0DsGZ3Kx92vKpCEGeOQdQ50aZ-eDbneDb3dSX46hgRrDW35Gg47hc4y2XJB701r0Imex1Kyulo1qZo8GZBuuWP9H0Emu0xuuGGdggCAWGDqKZ3"
-"Y3X3ov11n0Zd-X52qCJEEWYUGa3EnOpDEuCsIBZ70aZ-Z3XnZ3X4Grb3RXbQ9700tumuQuFBK85BKWHBpuIDsW3CIa844WpCE4qWgsC9GOpCqG3DEGKG08Z3Wdi3dLZZ"
-"Ql01sWZ3-lh3M182m8pDE4UiAVk10aZ-43Xo43X4+EgUsrL0bumTKwFXXe4XX00DEKfEEiz9Ea5OECcEgM-CiKZCv8ZDuCZCqCpDrumnh8fv6G0DmuGXbwWO6X0EnGZu"
-"Lse-A3XnA3X34CYUeeb3WtZ30Xd-A3XGA314nuYCrOZ4zJ50rum-wH0CmeQf100DEyUA0WZ3el82tGZDbbXYED02rGJDEGOrGWpCn03CEWMBMRF1+xC46xC4IewMwDaY"
-"I8kLEefT+VQ02TQ0GqYCka3CE8+YK0ZDmCJDnu04fPAqGGGDuuWBh0WCEGaY4G3EI4a4AYQ00GZ3B383ta3EvumzL2GCEiU8ERF1+3D463D4EG-4X5bQTQW5bXW-8caJ"
-"8c42ou2DEmk38G3CsuGawGWDtugB15GD4CZDEqEg4aZDEWCMIEF1GKZCqS3DEiaR1870uumJkvif1u-pGOypGuWNDumG88tQb6G9ECO30CZ-GDWHGDW3Bh10q81kp00C"
-"EKU7IaVMA2S5E4KVEKo38WpDnuG9XOvoaGmCsumxjo0DuKJEEK5RQZgQ0aZ-E3XnE310qumGGvm+JesI3e1Enwle1eae1umON4aqGG3CmWpCEaVM4CpDIw67EqVb4KpD"
-"EyjeE8grEe9JEsE10aZ3ZiC0numXm8XUz10FIVq0+hC46hC4E8RFEa27g9Q01CY39kW5IrW-mqWAmqW38s80nuGWIwWuU1mCEK7ugA4KEK17O03CrSZCrWZ3T1ebjJ09"
-"qWpDoOZDo4ZCtuW9f2mDM-CJ443C+VC46VC4EeTCICPqgXQ00SZ5SBh-13cI13MOAnGEt03CISNKEWOeEmFIAsE1EmrAaOJEpGJEmO3Eq0ZdU211vKZ3SE30uu0AwH0C"
-"ru087gSa6GGCmu-dGOydG81t9uNBDu00AuWgBuVJ38KJ3mHCk4ZCmaZCquW1Pumqd2GCkUu24OJCE8AsEG0t8SJDpuGmTeey4mGDpK3DEyFY0WZ3Nt31qKZrvc21n0Z-"
-"+1Xn+1X3pYZ4s0ZSCDW3tr50qu-D8OqD8mGBnuoCEyVY8a3Cnu0D8uWsOOwXBGWDo8nqiGGCtu0RN0GEEu8OAYQ0CGZDpWZ3GFb3FVX5C2ZqGDW-+1Xn+1X3X6L04esf"
-"18Hn2vmG1bsJEv+4EKvvP8Y-+QGt+Y0DkKZ3e+C9o0pCr8pDr8JDmeg2ZuGzlX0DnSZ3nq71vCZ4TTfa9701qOZ3XK75o4JEpOpDQ-lL443C+x946x94EepAw12KXOg3"
-"FbX-txWHtx05suoCnGJEESmSCOJDrGZ3NqGOmP9rQGmCuuWUI0nDn0pDsOgS5wmv8oWCrS3CEmFxEq6PIhW2443C+3A463A4IydaXsXQnD00vum1Pu0CAaMS+-q0zz48"
-"nu2Dr0JDvS3C1LE0nuWF5QAg100DIeDo00Z3e8e34-ccIh12sO3DE0QqE0HVEKD2QZQ0+3A4E3A4EaB9wvQFUqQF+ZQ02XQ0EmW244ZDXhl3Ut60vumrU9fLDGWDrumC"
-"EBHN23GEECKXIs94CGpDnKZ4X570vuWX9fz4ZGGCmuldGeidGWWCW0ZV5FZ3b3c-5FZL5FZ35m33pCZDvuGLAB1NDevPrGHCvK3DsOZ3xN43uCJDoOve10nCmCJDvuGT"
-"IGGDuumBHQjhkGGCmuVdGOSdG81Wzu0Jcgsx40GCEaY2+pl3Inl304Z3N8B1nSZ3jbA0tumWy1WDIOzHMUf1EWMn04Z413f351h3JiYZ+WW3UEi3pCd39L50puGd5Bz1"
-"AuleGOieGu0OQ4ibs9nqIKlhEGcY96lJAeG09vWemunDJxVl6qTl0qY31vc3woh3aH73qSJDtuggQmWDpKZCE0jwE0-REiT2MgH1GaZDma3CEWeEEyeo0OZs+QW3E-40"
-"juIB1u-KUguKUgO658HFVvFKSe4KSuWO0YGCuSZ3EA40oumf51mDk+nXEOZlEevKKCJEn03DquWEreeT3GGDnu0u1p1DmK3EpW3CnuWc8uiT3uVccwSccAHpaw0Xdvs7"
-"5ulT3OlT3GGDku0mVuWvTGnCnKZCtSZ5zSZbiRW3c912qCJEEucH4OZCUsWgIujEEGEE4W3CEueCQFF4+-hfA-hfEC9bIKZWgrS01GY3EyYQ1LW3thH6ZuFG5qBGEmpn"
-"8a3En8Xpu00DES-sMIb20GZ3Uqd3Mi90pu0a0hvAg2GCEifg0SJegw0wmGGCoOD+Bulscgisc6ClEGkJoHS04G38Iiq3IqF9+7Q0z4g3sl00vum07oHDuOJDo0ZDtuGE"
-"9fe0M0oDrGZCt83EtWZ39C40ne9M61GDEGnYE8HC04Z35OX3zgWmrK0Ab1ICnG38jqYFA0I51G0FVvY30m38WmJ8jq28ozsRq1YRlHMPwq20a028yOMPXHNToLcDr007"
-"W02FoLsOqDdFM000W4mN8K38oKW0GqICkmpBwu60140ByybFr0oCW838n0YC5821yyYKD10AyGNQiHNPav3CyyI3AG0Fl8bZ009FqXcSbD7Qln6P+qYDkKJCtG3CnS3E"
-"m03CnWJCv4JPj03CqmpBPGIFDm78Wm3RbP6TVPNOiv3CkCZDvapCm8JEt4pCsC3CsW3FlKH7sG30C8NQdXM4rGKDnC3Cn8JCn4JCuOJEu4ZCyyI6U4m-1GG5+OJV1KoU"
-"8GdSb5of0KZEw5WDg0W-d6WJd608nC38nG38s0YDkbQ044ZD1K20p4ohbiQ5A7H04mpN5a40tq19+-S0kyS001ZBm43EvaZDuGJEsKZDn0JD1rGDkBZZ0uYo1mZDsWJE"
-"nS3EvGpCsC3DmCpCIgS0yGJEo4ZCm8JErSZDp0JCrWZsA700sulo18io102CW4pDW83CW8ZRA7G1bGGCmKNTomJ014G8Ap0CW43EkK20+lS0ziS8AJpDpGZDuaJEvKZD"
-"qO3Du89b3W3DvWpCp03CuO3DsaZDr0ZbA70FnWJDv4JEu0ZDpOJCna3Eqejo10mD+hS02hS0443CXfcUJE03n0oCW401g9v08038sqn8+RS0zOCHruIDmWZCn0JCs0pD"
-"saJDo8ZCc+L1yGJDtG3DoG3CoWpCvOZDmOZaLE0ErKZCo4ZCnS3Et0pDn8ZCUNv00WZ-B7WmB702r0ICXaiSKE00u409XhGABxFg1q3gy8ZBm0JDs0JDm8pDmSJErWJA"
-"e2mCIEt0yKJCp4pDqGpDq8pCvC3DvGZae601pWJOLJIEvW3Eu8ZCvCpDQFt00aZ-e6Wme603n038t4cB0CZRzKG1bmmCW4pC+hQ06fQ0KqoDkSZDuuGg802CuO3CrC3E"
-"qWJOJPvg1W3DpOJCt03Cn4pDrW3EmGZbUK0DrGpCqC3Cv83Dq4JDrWZtUK01o0Z-h6Wmh603r0ICr4id0KZUh602nK3818W-LDWGLD0Bmu2Cr03EtWZCtWJEE4V21PkY"
-"DY0FqO3EoSZCmWJEvK3Ena3Cv89K3mZDuG3CsCJEt43Cq8ZDpCJCM3r048JC+NQ02NQ0K43CWG38q4ofg1035K20o4G9+NQ02LQ0GqYCk8JEI003Wa3CpCpCvC3EsuAK"
-"30ZCv83Dr0JEmG3EqOJCMkQ0uKpCmO3Cva3CrSJCvSJDtuzg10WC+lQ02lQ08K38t4IXkbQ0GO38t0ICYGZ2+7g1T7AHj4ZBrSJCrC3Em43Dn03DrWJE5UF0qOfe6GpC"
-"t03CrSZCoKZCoSpCrOfI8W3DpS3EnO3Dn4ZCrOpDv0Zsfs01oCZ-d6Wmd6W4LeG89QNK3uGfD0mD+3r061r0q0ZBn0JDnaZCq03Cr4JDEq42MEQ0u4pCt8pDq8ZDr83E"
-"vC3Ct8Pz4m2CsSpCs43DsOJDuOJGIeTz4u-yGOyyGW0DWCZVY6W5YyW-X6WIX609ouoDna3Ev4JEru0bBm0CoO3Cg2F184JCo4OlOO3Dn0pDr4Zc0X08oKJDsOJDnWpC"
-"X0B0ouTI3ulyGeiyG4Op0WZT-W00t8X3AWGDWCZ4l3X-nJGdnJ4Ck03DuCpCtSpDvapCv4pDqSZb8D0Cq03Ds8pCtGZDuSJCvuGDFe8bIG3DqC3EvOpDn03Et8ZDr8+w"
-"4uloGOioG0mCEeC4XraQhJ00r40908Z3tqW-Z6WFZ60GvuIDt0pCtOJCp8ZDnGJEn0Z4wWWbJQ0EqCJDraZDv4pCmaJEoW3EUg328aJEr81+BG1DqCJCnKZsmJW-e2Xn"
-"e210uuW5K81uEeMg1GGCq4W90OJDgwaSI00EXqS6ZuFS3q7SEi35q8JDpSJCoKJEmS3EpWpCMcS00KJ8JomDr83D1802m4JCIch1yK3Cp43CoG3EnCZDr83CpaZs97W-"
-"c2Xnc210m81rEumiBeMo1KG904Z3WHHQpvKo1umEK8HdD0WCDKY-B7GFBx0UDmWCqKpDXn21maZ3odWaxK0EqaJDm83EtapCu4JCta3EMgS0y4pCvWpCr43CqC3Ds8pD"
-"rCZsA7W-83Xn8312q0IDXzcSm912n438EG-2UWN6EXS0E816EC-2fek-57GF576au4ZCpOJDs8JEuaZDr8JCs8fn1uG1FmYCvaJCt03DvG3Cu0ZaGE00q8Xq8GYDmWZC"
-"v4ZDoO3CMRS00CZ-Z3XnZ310nuGaD00CXkbQGEG0bWGDWOJBawan1GWDWumv84X8+RS0sOS004Z3jsW3CY05tGpCnKZDMQL1G43Cm4ZDIy15C0pCs4Zdos0CvGZDp8ZC"
-"nGpCmSpDuum+PuyMR0mC+JG46JG4Eqt504ZU7Z00s4Yw0GZ3cUX-7ZWF7ZGPgHGDvumJKW1CtOZCqWZDM2J1qCpCn8pCoaJEqSJEqW3DQIQ0uKZCmWpCq03EuCZCrK3C"
-"mezm80mC+tF46tF48W38n4oWoTV5Iu92EWg7+JQ02HQ0OCZBvG3Es0Z4Ei15pa3DtS3DEKR3Moq00GZ3QG13sCJEs4w30WZdYY0Dq8ZDn0ZCuSZDsOpCo0ZsRz00pul-"
-"GOi-G0GEE8Y2EGI6k5H1MqD7EO13+tq02rq04LZBoGJDq03Cn8pDm8pCqK3Er4YgM+v548pDEGV5WaJEp4JEsG3EtOfIP0GDI4l7SSJCrK3DrOJDEGz5IRF1+NG46NG4"
-"Iyv50GZT2YG1a4cKM062Enh10SJQPwHf8uVl6uIl6GHDk03Do4J8LYmCp0Z3jsGPsP9p1WXDvWpDrW3CEuI4GK3EuOZCMY82qSJDo43Do4pCnCZCuK3EQxa20CZ-h4Xo"
-"h410muWHPuWPUetT3Kyw+3I161I148ZBEmq8i43EvSJDmCpDpCZDpOgT3umCWumWFG1DpSZDtKZcp41DsC3CtGpDvSpCv43Ev4J0r8jT3u-CHOyCHKCoE8N6gbQ05GY4"
-"LMIfVuaT34Iy0WJ7au-T3uoT30qDk83EuGpCmWJCtGZCr8JDnegeK0YCvWZCpCpCm0Z3Hw11sGZb-l0Fr0ZCsWZDvSpDpWZDqS3Dsez-BuFMHOCMHWXDW4JCWW38oDP9"
-"I8P90WJuJKIp+dQ0zaA7nuIDma3DpKZ3bz00numrc8naPOv75WJDp03EqGZCn4JDtWpCsaZbjz0DpWpCoapDmWJDtOZCm8Ztt410pu-DHOyDH0WCESJ4EWEAgLt008Z3"
-"3m00ruFo685o6mHEkCpCq0pDvuGic01DrKpDruQK3W0CpSZ3xe05nOJCvaJCE0BAE6b50aZ3SZ28t43CnaJDrGJCQ7L90CZ-M4XnM4X-bZY-bZYZbZ2Fmu2CoWZDsSJC"
-"q0pDr83CtuWGUeuLWGHDm8JDsaJmYJ0DruGaP8Pa8WZDv83Em8pDoSZCo83Dq8ZsQK00quV6HuS6H0GEEm9A0GZRoD04t0IEWOZ3-WX-PKWFPK07muICt0JCvOZ3jwX3"
-"1RYcHz08qaZDm0JDoaZDEmh90KZc6g28nGpDsG3DoaZDXJ30v4gVEd820GZ-r3Xnr3X-hDW-hDWZhD02jCZBEiT6KGpDuW3Dnu0uc00EkEk1mO3Cp0ZDpS3CoK3EpCZc"
-"jq13qWZCsuWYdGWDpuGLO00CQtX80GZ-W4XnW4X3lV10nOdY8umDOuVTF8LTF0KDkKpDsaZCtSJEsapCtKZCr8X-BOf7HGIDo0JDrOZCn43DECq30SZbNK04q4ZCvOZ3"
-"cf02vGpCEmM7M7Z20GZ-U4XnU411r0Y4fsW3DUYRk5Z3UlW5UcX-RKWHRK01pOJPGmHEuWJCuaZDvevrUmXCo4ZDr8JEuuWPbGGCqevBAmoDsWZDn8JCqOpCtSZ4wPXq"
-"RKW-Q4XnQ410num2AudQn409EGy8fCgJas00qOn2JuVXguKXguWdlWGCs4Z4DB34na3CoKZb7704s0ZCoOZ3Ga25ra3EtWJDM6k4OGZDpS3DuaZ3cz00vu0-beTR3uV5"
-"HOS5H8XzUuG8Re6R34cQEGm4nKgJ87W6NPH4ZulmDeYmDWGBquY3YM2BnapDt43Cpa3DuKJEgYJ440pDEOs3EKZ84WpDIe72Ag130KJem0oDv4JCqKpCoGZ3xgWqKEW-"
-"u4Xnu410tumQFuWYKeMp100E1GY--ZYK-Z2GruoDo03Dp03CrCpDt0JDq8ZgdQ3DqO3CnWpCr0JCoGpCraZc8Y07ra3CmCJEp4Z3z531r0Z3DyXqe6W-J4XnJ4X-0WX+"
-"0W16suoDrGpCp48i4KJEEKb4b5bcBY0Dpa3EoKZCm43CpGJDqKZbKG20q40B08ZBxQZqf6W-K4XnK4HXMhNgPKIp+FZ2IDZ20PZBp8JErOJEtCZCtS3Cp8pCIaz2QYQ0"
-"u83CnKZDp8pCv0JEtKJEr8fIFG3DmKJCpK3EvapDu8JCuuTKR00D+FH4AFH4Iaf4+Ti1ImR9cOs9ETi11aa31vY-8RWI8R01nuIWSZnCo0JDp4JEEWV8b+XbAI1DqO3D"
-"oC3EtaZCsKpDuKZ3VgYZ7R05rGpDqGJCEGnCC8JDpOZs1m00ruF6HOC6HK2gwrS05GYTC700sumMAan8+F92sC92KSpCsC3Er8XZN0nDpO3EtOwa80XDna3Eru03Tum7"
-"M0mCE4IAAoS0mGZDt8JDr83CqaJCs0Z4ytZp2L00rulGHujGHuWDue6b8accEev6cb23EiO4EKS9+hv0Afv0uqYDkGZDrW3Ds83CsaJEou0cxewp100EEmy6W83EqGpD"
-"pGJCvO9HTWHDm4JEm03CEmV3EOvAQpLA0KZ-25Xn25X6GUYSDdH1aONp1KscPCY-REGVR2mCXm5AtCZCnCJDnaJCrKZh3E37qC3DqW3Cp0Z37B21pWZdB70CpOpCs8ZC"
-"v0pCu8pCuuTNf0GD+VM46VM44S38I8LForLA0SJf720D+pm76nm7EeID8K3DvuGgnuGcgG0DnKQGMkD2mGpDs03Cta3CuK3EoOZe2A2CtCZCm83CtCJDtG3CsumwW8TG"
-"5uFQHOCQHumox0GCEWk7g1K14G38XaA0ou-f1Oqf10KEkapDtGpCsOZCqGZDtCpDo8XACO9j8uWSuWIEuK3EvGZCmCJCuOPjK0oCsCJDmCJEv8Z32m10ou0id8zf1uFI"
-"HOCIH8Hqs8XJze6g1env0HGCpulg1Oag10IBquICqO3Dr8Z3QM25rGJDoK3E1JibID0DrKpDm0ZDqS3Ep0JEsCZ3BqXZJY0CrapCu0ZCma3DqKJEruWYm8zg1ul9Hui9"
-"HumaKON7-u0ZW0GC1GY-ujXGuj16jCZBrW3Eu8XEzGnCpOJEqaZh9W13pKZDuu0id0HDt4ZCuefaWW1DpCJEnC3DEen78O3EvuWFO8Tg1u-9HOy9HGGCm81EY8tpgGGC"
-"m8H8Tu-hbeqhbW0Dk0Z3hs23r03Dtums3HGEoeQK3m0DqCJEEe42KOpCuOJEq4oSA6r0SK3DpOpDtO3EEmI78aJDuezTi0GD+RI46RI40CZ3JHXUc410q409+RI4IPI4"
-"aq2Ek8JCuGpDuSZ3yn23o03Ds8X0fOf+4m1DmGZCoa3DvuWaFG0Cuef+40HDnSZDouGgYumY9H0CveDUi0GD+VI4AVI40CZ3BXW395ZRbQ00s4G90CZ3shY4PjXKd410"
-"puGqga19+7y2g4y20LZBvGZDtGJCv0JDmOpCpa3CIeX2ME72CGJEoSZ35l36u8JCt4ZDpOfWRGGDsuWmwmHEtO3DnSJDqu0aFuy750WD+VI46VI4ECUH0OZTwlZ3y820"
-"oul+xua+xuGNR0YCnSJDpC3EvCZ3f4Z36Z40qPOnCvGRiumI7XnDpOJDn4ZCMsPFiG3Em03Eq0JEnGZCquWJAOTNR0WD+tF4AtF4Q4P60SZSmDG1bu0oza6S+pq0znK8"
-"c2GCEe+BWCpDvWZDsaJDtOv0TWnCvGZDmK3DEqXBCK3CsSZdr05Bu8ZCo8pDoCJEs03E1ecq8DW-K3XnK3X4skW3emYQLK00tu03Au01TuFf185f1u0UNG0CtuWgHvWe"
-"v0GCII4Ee0ZCnCZCqaJEmCJCEK3HQ6+5GapCrSJEE08B0KZ4pVasADW-j2Xnj212s0IEI02BgDQ00OZ3I820uul2Aua2AWGBruY3rj09oO3EnSZDtO3DoO1dgufO8GIC"
-"oSJEra3EqS3DEGSBIcO6aKpCnG3CoKZCu8Z362Ytj340sulhGOihGuG8u401gXQ0EWzB+J2EIH2EKKZBr4JDnKiOXa61o8Zg6NX3Xb16q43Ev83CvuWrEOfJ3WGDuaZ3"
-"9k36tC3EpSZCuu0f88jy4uVhGeShGumULetf1GGCn8XWnuVMDeKMDmIBsu2Cs8ZDo8JCu8Z31452ma3CEiA4MEU2Ei-Ga4JDv8pCtWZDnOZc0g2Fr0JCsGpDtS3Cq03D"
-"u4JDtezz4u-gGOygG42XE022oLQ5EuLC04Z31GX-i2XGi219mu2CvGJDpK3EquWT2H0EtuGgOeOv90HDoO3DtO27EPv4PG0Dn8XTb0HCo0pDu4WTQJQ0+RA4ARA4+tq0"
-"otq0qGZBtCJCr0JDnSpDv4JDEyx4coq0SG3EtaJCva3EE0LFX9YbRQ02uaZCEq6BEKbJE8FGQZQ0+RA46RA40GZXD910quFJIu5JIuWSxGGDtumlh0nCnG3Etu0hm4of"
-"MA42EeLIe83Em4pCtKpCuaJCQ+YD04Z39Y28oWpCo8ZDm4pCQ7jI0OZ-a2Xoa2X3o+X3CrbQ3X02n838Ii1H+BF169F1CqYCkKZ3JU31qaZ4bg41m4ZhOV34rWpCtKZ3"
-"Ik04v0pDtSZdSK26vWJDt0JDvu0STXmCnaZsTx00tu-VGOyVG0GCE8z408ZTSx00o409+lj3Yjj3G8ZDmSJDEOHN88ZCm8Xhae8d6GGCou0WX8neE0WDEa3DIIF1uGJE"
-"rK3Eo4JEp4pCs8JCreTJ30mD+784A7840KZ3CF12o02Eovq0I4-4Ei62Mqj3I5-40KZ3nFH6auVfGuIfGWIDkGpDtapDmapCnuGnIHGCm81mLOv3A0GDEml344pCEuzG"
-"Ga3EvWpDI+S0CK3Cn0Z3AL20mu0Zn0WDUdH90SZ-g2Xng2Hm3BnR8e6754Cn04Z3WlY-EeWGEe02ruICEeI5WGJCp4JDpO3DuOnZee9g1WWCtCZ3pl05s8pCqGpCEqBI"
-"A6H6CGZCoOZ3xw40nuWjA1mDXqjpWr00tulhGOihG0GEEuY4EeOHgXQ0Ee6AIW87gPt00aZ505J4ZuVT3qNTeGZBta3Dqa3Ema3CEy8IsUo8iGJDm0ZDsa3EpOJEv815"
-"Ce8p1um9QnGDuSJCEGCDESLFMVZ20SZ-I3XnI310s42pwno3IyhF+JD4IHD48qYCk4oCe0pDv83EnO3EtSpCg+G6qKpDrSZDrCJCnSJCta3EEWCCAcQ04GJD10Z3yN10"
-"sKq7QdQ0+ND46ND40aJmh7cKkLt0IS8JE4R3+xH12vH1Ims50CZ39M40vuWtKvGK599oLGHCuW3DpWJmHwmfb5OvAMQ00KZ3iA69pG3CrS3DoO3DreDX51mD+7D467D4"
-"Eaz2wHQ00KJPkvFtBu4tB4OzCO3EmaZ32334mW3Do0ZgEJY3yc51tWZ3jy03s43CqePeo00DEiVMEmNHK8ZDvO3EpezRN0mD+JD46JD40aZ4iZXSv521v0Y3i8a-d6WI"
-"d606suoDqWpCn4Ig4KpCEaS5gUS5KKZCra3DoumP711Dp4pCpOvnLmnCpKZDpaJDmu0NlG0DquGyt8zP8ulqGOiqG8npyuGQMfcy4uGVd1GCE4DI+7F125F144ZBEKSM"
-"aCZDvS3EuSJDn0Z5QXbcFe08pKJDoSJCn03CE84208Zbe6GWhJ1Cv8JCqSZ3aW20nejUI0mD+FD4AFD4+RO3+RO3AQO3WGZBtO3Dr4JDv4s108Z3AxY3XAXcE703mC3D"
-"qu0AU0HCnaZDrePNdnGDtWZDEOsEEeO30WZuzU30uuF+GOC+G81HZetKFK09cuo3E9r30GJQN20DQy-2+pz2gmz2mOZBu0ZDsOZDmCJCqSZ3wVbgU-43qSJDs8nOfvWA"
-"S1GCQkfImOZDtS3Eoa3CoSJCtKZ4bj30o9IJmvmAm501rCWD50dAl070uu-7Hey7H00DEqz2ESEOg9K11KY3tYW-VrYIVr26puYDs03Esu0ViHXCq4JEqOZ4MOXcrD02"
-"pOJEEeWR4S3EESgIE8FQAYZ2I8PN0GZ3uZa3g1Y3KsYqg6W-w3Xnw3X4a6YUf600pumtFvmXeu-w68qw6uWp8HGCquGWPn0CpapCEey5Ikz20GZ3Tj39q4JEvOpCuCZD"
-"sOPdI0GCEq1BO4ZDmK3EsCZ3clYr0s00uuVzGOSzGumYc8HKTv6J3uGhRP2GCLP5H402yybFECbGP8Y-NKGlNG1Dk4ZDtWZ37b63s4pDtuWsUPgu600DEyUPGCpCnG3D"
-"E8L60aZbmY01rWZ3eC12uWJEE8BM4CZCQNUD0WZ-p3Xnp3X4DjZ48LdQB700ou0TU8H4QPXDMulg1qZgGWZBsGZDEqGH443CEGuG4K3Dko82483C1C01mWZ3ZU61pSZd"
-"yv12p8JDE803G8ZCrK3EEaR6IVH1+JF46JF4E0D4IWd4kfQ01KIOIvFhDe4hD0HBpuYDnu0vD11Eu8JEv81uB5MLMYD7KK3DuCJDrOHs31GDY+o60WZ3A755tapCt0pC"
-"EOn4Q-H1+hF46hF4I0V22YSDIiQ3U0V5EzH10KJPtLn8+Rt0zP71nuY35j10tuWS01WDECHBs2gFiWJEv0ZCmOpDnW3DquWQMfOZ8GWDmu0iCHHCoa3Do4Z3onWsB7W-"
-"U4XnU4X4BQd3dwXQVKW4UDd3BMa-DYWGDY05ruoDt4JEE85AEivD44pCM04DQMZ2O4pDn43Do8Z39v32t4pCM6oB8C3CruGW21GCE43H4KpCEqw3IxH1+3I4E3I4EmSG"
-"EOI4gbQ0MSMN+JaUcJaUEemEE4oKS03Ds43DuGpDksm98KZCnu0h310CECdI40JEEWf7AUt0SGJCtW3EmC3EXcB2n83CQdM90WZ-75Xo75X30mW3yUXQE702nC38EK2G"
-"+lk1Ejk144ZBEKW2CWJDvGZ3Ljb3-EMmhh9U3m0Es0pCE0L684JDouGXO9vfUG2Du4ZCv83CmapCEGcFU7rB0aZ-Y4XnY410uOXLF8Nje8n8TuF4sO54s0qDkWJEoOZC"
-"t8ZDv0ZCvOJCtew4dGGCt81HqWHEsK3ErOJDUAr0SapDnSpCpa3EEC230CZt3F20vuF0HeC0Hu0a8etZPu08w56K+di16bi1EOjTK8ZCqOpDvu0Hf1GCEC8LcAr0WGpC"
-"q8JDua3CuuG4t1mDUMn9e8JCoW3Du43EsGJEXjbroX00vu--G8z-GuGeo8dK30mCEm4MceX2ErZ2CG38naJ7ZuVFA8JFAGGEmumb0oGEvC3DES1808ZgAB10q81jtGWD"
-"vumyGG0CvumJMfen60WDEmwB0KZ3N9Y3AQ50puzo1u-9HOy9H0GEEG+2EeJEkPi100J0bu0GMulFA8aFAGWCkuG5WWGCnaJWoYGCu4ZhQs76r8ZDo4JEnuW8CmWCpSpD"
-"UoVJEenK0OZ3Fm51t4Z4cf50ofS7M0GE+RG46RG4Eae4wv62E4CUX9d-c6WGc601ruY3U881qGZ3B124vOJEq4ZgJS23qW3CquG2cX0CnWZ35gdbiA12tW3DEuzGS8JD"
-"tK3EpOJCQhg70aZ-24Xo24X3uGe3AwXRFDW3LOX324X-gAXGgA1IjaZBm8pDpC3DnOZCvOJDq4ZDv4ymM2G4Eut20WZ3DU14sSpDmOJW3h8+4mGDpKpCEK+M0KJWuBXu"
-"U8zJ3uF0HOC0H0mDEq25wHn95GI8HdIgEDi1XkX3EcX7a4X-4RGt47MT0aZ3hU30mu0owGmCvuwTKm0DtG3CEKWD8aZDnu045PvLiuWIuumJV1WDEG9X0CZtv260vuV0"
-"HeS0H4A6+Hi1E4I4+Fi1IDi1IeM900Z3tH10mu051I0Etu0wXeu+jWWCqOZ33551mKZ3ijZeFZ77nSJDm4pDt4Z3rZ21q8ZsxO30vuV-GOS-G8Xl6vtpu1GDEeQ3EeMK"
-"+Bi129i1bKABuOJCt0ZDm0pCrGZDEy7AAMQ04KpDEqKTEG6B08Z3lLYc0V12s83EEuP94OpDEWl7Ydq0+FD4AFD4ISHH+zh10GJ88xFm685m6mGDkaZCEeF6CapDmCZ4"
-"WsYgh023r4ZDvum9VHmDuuGkd10DMY620CZ3xu65t43CsWJDE8mTMZ62483C+JD46JD408Z3Tv10nu0lyeMQ8KG9EyZLc1i10aZ3KIH6Zu-l6qzlKqYDk8JEquWp2oHE"
-"uapDp4pCneAXDGpCuSZCm43DuW3CnW3CpuW0Ru8Z8WHCq4ZDpOpDEi0E403DQNZ2483C+ZF46ZF4IK25EuSGgnS0I4y5Em45cnS08C38uqX8+lS0ziC0s8nv9m0CnaJC"
-"EORa88JDmewb300DE0X80GZ3UyW3AtadQc81p4J0qumNkWGDmCZsKO11o0Z-P4XnP4X45QZVA7Ge-uW9TaYo+ZQ0zWA2nu2C1+F2va3DEyPEEufHEu-2QEX544JCMexE"
-"GCJEpa3EQUPYCCpDoCZ3tB11t8Z3hK30sOzKWGWCmulzGOizGGGCqOXRK97xgXGCs0Y3jcX3L1Y4wfa-g6GFgwmZ80XCoK3Dou0z72HEu4JCuOfdl0IDsaZCtG3CmWJ0"
-"60mDUQM90WZ3fB33oapDru0OP00DMpkC483C+FF46FF4Iu82Emz2gXH1Iq82+NF4ILF4KqoCk03Csu0WeW0Ep0Z3iGZh1sW30V89m4ZCuO3EuWJCoum0AuOm6u0GYHHE"
-"oaJCr4Z3hvYr7531o0Z-s3Xos3X-FDW+FD00tuGyE0GCE8tROKJDtS3Ep4ZgZb12qWJCEyOP0aZ3nX01nKZ3+bZZg60AsSJDv8ZDu03DrGJO7BjkNGWCmu-zGOyzG0GC"
-"EGn9E072gDr0IK3aEOIF+VF12TF1EaBAOOJCs8pCo0Z3ro10tuWtEfOXDuGqQuGc9wGfHIGEpum-gfue1GJCtSpDoCpDmKpDsWJDuumEReicIGWCmulpGOipG8XiM2GE"
-"srL6ICD7EmJ6+J422H420aZ3db82oSpCEC1U08Z3uBZ4skWc2H1BvG3Cm43Cv0JDoOJDI8mFAYQ08K3DvumKAmmDrC3DE8RBMhJ6483C+BD46BD4EyAN08Z3f6YQBDW4"
-"REY3aGX-f6WHf601muY3hn14sCZCq4Z3sy72nWZCIM0B0KZ3d-56n8JCmaJCuumEGAv+VGXCta3Ct8Z3knY7A9aqCDW-H3XnH310u8HDA9dv94m8E0yG+hq02fq0EGU2"
-"44JDEGBeE0VI00Z3W1XaY6W3+D49rS3EuaJDrO3EuePlcm0DvSpCESDNOS3EqSJCpSZr6D21o4Z-93Xn9310m81PB8dIU46PEG-7+BQ029Q0KaZBuO3Duu0uLXnCo83E"
-"oOpCI0J3MoE10KZ3Td05o0ZCsOJEEWtLMAs54CpDE4xJK43Eua3DrumGfvqD8G0FlumhY2mSUu66OmpSq5sPbzL+c0HCmGZBtuW8OX0Ev4Z3+065o83CmmpB+O20QmA6"
-"Sm3SX9NPkHdFE0T3DiG4Q0YRbX7T+qICyyI19825pO24p813pK0M00YCaZ90y83e08nZas0L14G1s4W800Y-C9WnC9W49cX31kbQIMW3Lde5Tyb-KtWJKt01vKZ40N93"
-"uKJDvuGEn89y3uGdCv0rOwmJAG0EnevbnumVbwWNCuG+uHGDsuD2OuFQNQCQNw0NM8ekQ6G9IKe2+B-029-04OZBMCcX803Ctum9OHGDpeQACGmCvuWgzWWCnCZ32B80"
-"vumLbuet8mnDqO3DqaZCpuGLr00DE4iDEhp1+ZQ02ZQ0Muz8oX2ME8g2EK23+JQ02HQ0ESt3EuUR0aZ3qr72r8pCk+0SSCJDrWpDt0JCEqZ54C3EUIQ0KKpCuW3Cv4US"
-"C4JDqGZrDtW-4BXn4BX3Z5b3sMaRkJW-sCbPsC53nuICtu0lc1IEsOJDtCpCrSZgNy35q8JDsKpCEuQY4GpCEOlcIIe2CKpCu8Z3gKZ30XA0m8nPdfiI3uFnIOCnIumb"
-"UuGgDesa681K-v0wIula6uZa603DkGZCpKZCsW3DpCJCEqE9IC+RQggZ0OZ33jZ3NF90tu0flOPNb0GDEqQS08Z3R944uS3Du4ZrUwX--AXo-AX4ukd3T0YQc6G0b8XX"
-"Auly4Oay4mIBouIEvCZDv83Cp8Z3Df61maZ4rzWbf605rGJDoGpDEygTCCpDoGZ33pXYNQ0Bq0ZCmCZDtWZDmSJEEioFEbe2YKT2cCX214W9XdW-+AXn+AX4wWGOle6g"
-"10mDMyT2+diFAbiF1d91tCZ3YIb3h042uOZDbzacVbX3wJ70ruGlOw09H00CMY48KCpCnS3Equ0S80WDEGlQMRQ0+7i467i444JD5AlSL+MSEv-FnvqFnvGQzvWEsH1E"
-"uaZDmCZ3xMaa8k02qCZCEqYa04Z3uD63mCpCsefb600CEGDGGSJDs0ZDECmFIdq0+ph46ph40SZ3t-XUhM40tuGmju-g59rg5X2EkC3DtO3EoOJDqu0cA2mCoAXG0KZ3"
-"7ac3eoA3nK3Doeff1u0bAvm4PIWCsumheu0XgeCF8ullIOilIuWUSuG2DudI3uGF800EDVPjs6H0EG7iQaq6HGY-9pXB9p16puICqaZCouGijHnCs03EuWZhS021p4Z3"
-"t4Z3l5Z4SCdcoD07t0JDoKJCo4Z3SjXtyEf-T2XnT2X49CbTLKW6CpX-KKWJKK08nu2DqCJDsGJEEiu88OJDtO1IOffO8GmCouWl510CEq7cMuO8AA62GC3EnSJEECic"
-"8G3Em4AYIdH104Z-Y2XoY2X3adW312XQZXW4eIZ-1SYK1S25jGZBoWJDEigSOKpDu03EsOZirY95p0JDnOpCEGKNESBZcUL3G03CvS3DEWA444ZDMdZ5E41O0qYBxHWD"
-"peW-RThJRTB0s4idwfs85GI8GR1fGuq6500EEC8DPCY-QKGlQuWwHIWDouW-D10EEGAW0aZ5aqgbTPX3ts02vS3CEac40OZ3pZcbPK00rum46XHDoOpDnWJCIOI708do"
-"QBZ-83Xn83X3zbX3e140m8tS3uG2BwGSVQso10WCIGvP0KJ3Yulo1qZo80ZBmu0wAIGEuuWsWvmJ4QPn1GGDp4QB4a3EEG9A403DQgfc48ZDEuGFK8JEmS3Ds4CuMVJ1"
-"+VE46VE4IusHEeN3gTJ1I8HQE8tHfGi-Y6GFYY0EkGZ3xT15u0JDm0ZCEWlEIeREMUQ00CZ3zI70mumDkPncDO9R3GWCmumi4YHEsGpDoapCEODAEps0+hE46hE4I8xM"
-"wvj1EejQ1CY-FAXGFA10mu0QdXGEuOZ343A4s4ZCpSZdxyW3l881oSZ3nS62vaZDMsgFC83Es4Z3ik55mOpDpa3CQJl9Eat2+Vj1wUj1IqpPXudS8DGf9uVe1OKe1WGB"
-"puY4Q+65oa3EuCZDEiA7gI5G4CZDE8hQEK1lCSZDnOZcpHZ3NO82sapDEi+58a3DtuG1fuCI3u-uGOyuGuWRM1mCsry24a38Ey8i+RQ0EPQ044ZBEiKE4SpCEm-604Z3"
-"mDR9cQfx40GDEGOXGSZDu43DECR308ZbkJ00puWt5XHEpW3Eo8pDEmjCMNf1+RE46RE4EaOgEei6gnq0XOg36fW-JQWGJQW37960ru03+uGD3vm80wQ0zHmCt8H2u9XC"
-"Jw0Ahg9b6mGCrSJCECMNEuOE0OZrdlY-UmhoUmB0vumvDuWdt8tf181TDuFI5P5I5H2EqK3Dv43Cm8pCEexO08JPEfvc6u0UrwWe-wWSM9XMjee6FG0Dr81bAXGEpCZ3"
+static sybie::datain::DataItem item6("haarcascade_frontalface_alt_new.xml",6,
+"F2W4OxHeL9pZ0upG1u05K8K90uleKOaeKuGg8O8rOeHg8u-iH8uiH4WZ+VJ2+VJ2cSJ2E8-504JOxP7q1u0RT5sn+hl1+fl10KJW-wmIBOtZ040AMyb6+790w590IKE5"
+"6c120aJWN5cV+-80wz80ImuJ6+H00aJuauWVFu-Z0etZ08XVFOuZ0eH0cu-EE8uEE4SrI8P4+vZ00aZ3CxG8lAZd4uVU4OKU481bLP8S600CEqI4EWZ8+-80wz80EK5D"
+"XPZUSDW3jsGeluVF2eNF28XfeOOF2endGuVF28OF20mCXHZ4FRdTV400pK4F+p74Ao74Eq636Qk218I0gu-E2etE28H7je8+70GDXCa-B4abB4K1cvtxF8Xx-uVHJeOH"
+"J8nH3vWnAONF2Km9EqS2+-Q02+Q0EGp3+rH0ESX6+d+0Ac+0+7F2+7F2s4F2MmDC22r5IyG8E033+RG1wPG1QyoS+Dh1Iyz5ECZ5+-80wz80bQWX-LH1d4IHoWi06zz2"
+"MiRUsO20+Vs16Ts1Eei3EW93+LK01WY3qhX-rxWWrxW5kJZWG2W4CbHGa9ZH1uF81O4818nGE8fQ74aO+hs12gs1Ean7E0b4+nI11WY37LX-V4WVV4W3NTXXZVJ0c42H"
+"+pQ0wnQ0EuUBEiW2sXa1XEb33YW-D2WUD2G0dv0HVONZ0aIgEay3+hG4+fG417hV9RI0qwVZ0eOZ0819Ie8714st+-80A+801UTupRdg1umFou0LduVg1eNg1umoh4CH"
+"+jQ09WI85vFo288o24sK+zX10aZ4FFX-lHWWlHGRluNqV0GCEyq5EGg3+tQ0wrQ0E4436kg11OI0DAJg1u3y7umkY8K90u-p6Oqp681eifvnL89oL8XbBeZxLu-j0Oqj"
+"04oG+dM0+dM0scM0IyB408Z32VXTNHW44TNvIBp72u-G1OqG100D1EZ3tfWTG2W4LwJevv-E3etE3ulmGulmGeZmGuG9LPO71uGCyuF71e8718XViOeZ0eXtauFTA88T"
+"AumXYfOry91yX4Ky+di0wbi0EKA2Agu4E44829CD+ON11VhGb0W-yDWJyDW3+bWVdpX7qLZ-wDWUwDW3+bG8JxduGuWLIPX6E8Jq1upG14mJEmH2+JW12IW1Ea3BEWx2"
+"s1C1Eu0JEux5oGB0+BT069T0XqX4JpWTE2G1d4co+-80wz80QiV6+DT05SIu89pZ0uZq18XWO9a90uFH1O4H1uWinu0nQPtG14W9XniCp2W-D2WHD2GW+QOoEum7cuVo"
+"EeOoE4ubX4eVQ4GflvVTB8OTB8HN0vmQUOtZ08nUhvmGQuFm4e8m4uGwe8O1C81G6vVV3eOV3u0DC9HDBQ7818XFdu03Uulo2edo2umzHuGgEutiDa0A+xl1Iwl1I290"
+"IqXH+-80A+80IGw6ECaFszQ05SY-APWYAPW31gH0sRdZ0u0G8u0-OuFN3u7N3umqWu0EDPdZ0Km9+p74Ao74E4UMIG76sz805fZ-q5eYq5e-8sb-8sbE8sLHTAu154ga"
+"IOf7+765s565IyMWXGeTh600nKQ0XQf-F2WTF2W4ubYWojW4nbY-D2WXD2W41gXXg6W4XAY-VvWYVvW-w9Y-w9YFw9Y3i6ZXi6W4fed-j6WYj6W3FweXE2W4exG8Kx-n"
+"2Otn28X9H4i8sPr0IWU8ECfA+-80wz80EyaEEKl7+v801gf-CWYWCWIWAvWANuNZ0aGj+hH0wfH0E49411XTD2G0B6kn+pO1wnO1I8c7AUnIE8W2E4O3wix3+0X3IOx8"
+"IC+3+tk0srk00OZ3RYY3DcXT55G1dumLe8pZ0uJj08nfc8a90uFEEO4EEu0YPu0FE8eRB8nXz46foSB0+7906590I0J2AQfAI4q7IK+J+790w590EeD61vZTM7W3U7X3"
+"clZ-D2WUD2GeuMiIsv80Ey32EeyF+-80+z80E0546c3J1OY38qX-S4WUS4W3kjW3lJaTR4Get9HXzvV34ON3440zE8L8sr80IOr9Iau4+x80sv80I4DI6QQ3IGM6+N71"
+"AM71EihN6Q12Iy0HESd2+tH0wrH0Eqa56w801pl-D2WYD2GeeL6B+fZ0IW6IEqH3+Rr0wPr0X3l3Y8XT9BGGSvWPjv-g1etg18nMW8Xf3QtZ0K0AIKGP+xH0wvH0EWN8"
+"04Z3T4ZTG2G0dKKGkS+0+C-1EyC2EWF9+hd22gd2IOvM0GJOWPdj0K0AI8t7oWB0+J-16H-1XcY3kCYVrBG0e8nIVusH18XVS8a90uVj0OKj0Kud6Ub5bvSOew-63et6"
+"3K2q62c65UZ3WpWC45W-U4WIU4GGAReKCKm91Ec-F2WUF2W5WyXVW9W3RsX-D2WYD200vu07h4gCwzt0ImXC10f-x8WUx8W30mWXMQZ3UYY3SWW-D2WUD2W4DocXE2W4"
+"gbd3OGX-F2WUF2G8SO8rD4W9XmXC6BWFWNGG4AK90ulU3eaU38X6DuWvRetN282g5v-G1etG181KPPux2K+h+3I0A2I0IuC56+80IuC5+-80A+80ICfOI4DEwzQ01Dl4"
+"BZYUzRW33qWEI4X-b9WKb9GGY98nSuG7E4IH+Fc0wDc0ECyI6ku1EqX6+hu1Agu1Xbb3GDXYT400nuG5AuV0b8P0bOeK5uGazu-g1eug1uGI-P868uFaWAAaWwmYEut5"
+"88H7VuFD9e8D9umdd4cLsb010WJ1qwVD28OD28HqSPu5Fe1BrulSeveSe9XUNw7h1u0wp4e2+ll42kl4IO6WAku4IKSjE842+FG1wDG11aVGzuV81uV81uI8189a0uWD"
+"N48UoWj1+Bh169h1IaeF62j0Iq29ESk5+-Q0wzQ0IqoE66R9I8l9EqU8+-80wz80Ia85Iy-4sr715WY4Xna-l6WUl6W31-WYG2W3bUf-F2WZF200n8XBYOuq7uGwHu-0"
+"VOv0V4I8+TqDIKa6+-80A+80QCr2+5F2YCr2+ti0wri0MCMK+v80ESx7+7a3A6a3EawIXofVJsg3+q20nuGQLuVM3eNM3uGfp40a+nsAEGI6IyFk+390w190E8uLI0TB"
+"sb71EOF2Eaw5+lZ0wjZ0IC2QEqg9sv80ICe5Ey+6+-80wz80EO+5EGiB+ni01WY3aXW-MeWWMeGe3ueF240AE0F4oqZ0+4H4E4k4EekD+Rbl2Qblbm10quWh9Otr18np"
+"9umnOOtj08HhMAq90u-i8Oqi8e1pquN-18XcVulv5eev5ulH1ulH1ejH14Oy6cM2ESM5+ZM2AYM2+FOA+FOAwCOAIiTHEaQisXn0Iqg2EOL3+-E1+zE1QSbT+XD25WY-"
+"PgXZPgX3AXW3DmWTV4W5J3X-yLWWyLW419d3u2iTE200n4ylIKoQka25+x916v91ImJ22Y3n1dW-D2WYD2W3-DIvyQ7718HAY91dJuF71O771uGXf8HaROtZ0u0x4w-n"
+"2uun2eXDL1WC+DST5W20p40Ao4m1+pZ06nZ0I0A92kA4EOoCXwh-D2WUD2W3vJX48YWTj6W4rqc33gWCF2WFKZGeD9K90uVG1OKG1umze8H-cO7j04m9EWX2oDB004Z3"
+"X2eGc0W-q2WHq2W3ZYGOyPti08HeNuGoUule3Ode3umwTOOZ0ulXxulXx8ZXxuGPSOesj4KWXMd-05WW05W422XW6vW4DoX3kjXCG2WFsCW44DbGc0W-3AWH3AW5kVXW"
+"e9Y439I8h9Jj0u-Z0OqZ0uWGE0WDEO73sDn0QqG60WZ--bWV-bW4S8Y4AzbTG2W6Kfa-twbWtwb3GaHWOwdZ0u0RfuFyN88yNumBIuWtJONZ0um2AuGluuFO8e7O8u07"
+"wu0rC8OxN0GCEaHL+xr5Awr5XVg4DpXTV4W3qeW5kzZ-UNWTUN00nuWlIKqpw1901WY4ovY-H2WUH2W49CZ3FaXTG2W49CZ3gnX-09WV09GnY4oYs1905WY5okc-n6WT"
+"n6W5fYWVutW3hLe36XW-U4WVU4GQRv7UH8nX8v-Z0euZ0uGHOvW49Otg1uW2PulG7eeG7u0HX4Ur+j43MqNLEyV8+hZ0wfZ0QkZiISO7EW78+-80wz805wjXeOGfi4oh"
+"+li0wji0EqhCEeY6snZ0Eqm2EyE2+t80wr80+pH0+pH0wmH0fBjV2hGwI30D+pH0+nH0ISRNXQfVg6W4GWX-i9XWi910m4Mv6wo7QKY8+-802+80+-p1+-p1wyp1I8DA"
+"6sQ0I8DA+7Y1A6Y1EaX3Ieg3+nZ0E4l30SZ-ABWVABW3ZQZX1KW3S7X-0KWY0KW498Z3sfWTR4W47fZ34hW-2KWU2KW3nFX4UhZTF2W3nW60n4Gb+-80wz80XdSuHxds"
+"B50AEOrG+BV32AV3I8V81ziTW4W4ohX4OqX-MgWTMgW3-qGGFBuPD0WCEKq411aCUXWFc3H0F5G9+pg32og30KZ5XLXVRRW3kbX-d9Wad9W5D9bXHjW5D9LOmwFs1O7s"
+"1a2r+1+2EKg5+t80As80IGu6Ia4XsLl0IKu6I4P3oKc0+Rf46Pf4Iyj7ESP8s190I0XIES5B+tQ0wrQ0XDJAnQ7a0uVX3uVX3OKX3uWESuNP2uWLp485+NK0wLK0Iu59"
+"XqgT45W5ssW3m8X-G2WUG2W3JmX4u1aTG2W3n-GmFulZ0edZ04E1AAu0EiZFE8xG+x80wv80QycB+fZ0Qi48+pt22ot2ESLQICf4wnQ01WY3zcX-H2WXH2GWJuWZWO7F"
+"28HQ46Ga+-Q0wzQ0EKy5IWb7sz80Eeu3EW4O+tR1wrR1EeUbAU4X1SY4JhYBfTWFmYW36lWGb0W-mPWHmPW3GLY3XzWU15W7-HY-G7WVG7W3FuXXiYGWMwV78eO788XZ"
+"P42Xsrb0Qapj+Zdi2YdiECH2XAWTE2W3Noa3AoZ-vDWUvDW87gXTE2W4UCNW1B3x2u-n2Oqn2u-Bmv-BmfpBmv-D9u-D9uzD98XOgwGgLOdr1Km9EaJ2oOT0+8C1bJYG"
+"c0W-y7WHy7G8j58n+9N31WY3BVX-WcZWWcJPSuW2wOdH18Hklu01Ru-g3etg30GCE8D46+45Ied2IOp2kSf1+-Q06zQ0Eab7XSeVT4W3HeY-wNXWwNX42mWYZjd4h4Kn"
+"TwI71uZy28HRzAa90u-G1OqG10mCEyl6Ey8FsHK05SYGzLWFr200tuWfU8a90uVj0OKj081IEOOvkMUTEWnT+Ve0wTe0XJYXE2W324Y-D2WYD2W4H5aXGdY6B1j-6PXW"
+"6PX6KSbVIuX-XNWeXNW5+5XWLsG0eu0TCulfA8efA81gu8v97amZoL31I0Fu+Vo1EUo1+RK0+RK0+OK0E8G56Il0EOWBE4B4+-01wz01M4xJ2ALB5SI0FApq1uVB5OKB"
+"5u0hO00EEm0Bs9U1Iil5ICB4+390w190EC42AEZ4EKb6IGI7+xQ0wvQ0Eqy85dYTV4W3QAa3QIX-U4WVU4W4J4Z38BXTF2G1dulbXeebX4sC6AM2E8u7ESp2+lQ0wjQ0"
+"5Kl-S4W-S4GES46lI44EsjQ01Yf4U5a-U4W-U4W-U4WjU4W5x4ZV-0NWTw-n2eun2uG+Ku03I8O8T8HkS4uU+tQ0wrQ0Ie78EWv4+nZ0QmNG+-80wz80+lx4+lx4wix4"
+"I8dEEO+2svH01SY4aDbR9rW6RyW-IVlaIVVe4u-EGu-EG8oEGum6M4StsHK0E8v6E8R3+7c0+5c01NaYtjW3ZKX31hW-F2WUF2W4sjG0iPN718nnh4aO+-80wz80EWx9"
+"6w80Ia34+x80Aw80XTbXE2G0qwVZ0eOZ08Hg4LgbsjQ05WY-2HaZ2Ha3LSX3rWXTF2W3sCb-PBYYPBY3Loc3DOYTD202v0IDm0oCWG38ou2FlybFA0I11W1Fl8NPZHtS"
+"Ly09qb6RqL6P+03FlqW2Lm20ya1DoC3000I7Q4G0i038m0ICu0ICm0IBnuYQ0u3A00XDW038s4m90CZBc0W-G2WHG200n4mPCG38nGZUG2G1e0WC1WY-X4WUX402s0YD"
+"E2908W38su-Z08vZ00GC1H12n0oC+zH0GC38r0IC1aY-l6WTl6G0b1WC2w800OJ2Bw-g1utg144oXK80uuN710GE5090vO3a0uZy24WJ8038nup90u-y2Oqy20XCW438"
+"q88H1WWCW8JG8wFW388W3G0EWuFH1uFH1uCH10GC1g02q0YD+fV01SIGmAJD4uZ+1mmCW4pD6P20+dV06bV01z52n0oD6QB000JOtNma+xy0svy000J0JMgvsrW15WIW"
+"YvtH10GD6P20+VK0ATK08438mK+AsLB044ZC1WROgvVH1ONH10GDXK40r8Or10GDXGT8W83H1ul71ea714c544382IH10GJ0t6o7+390+19040oDXkbXgE03t0IEWepC"
+"6uJg34M600ZHd0W-55WH5500vKcV08ZUY9G0c4QF+BK0w9K0OK38v02DWKZUD2G8-WWCWKZ-D2WVD2GW+2WD2sh10aZ4Ua00puVl68Ol64cu4W38+nZ20SZ4Ch00qulZ"
+"0udZ0mmDW4JDbNhTOI00taiR08Z-g6WVg6G9TWGEWaZUF2W3Sf00n4cU+VI1wTI1GC38t0oC2U010CJQUxVZ0uNZ00GC1u80q8OE2GGCrq82o8+02P911Kh3lcWCc0W-"
+"LIWHLIWbq2G0c8KZ0upi04uK2L20+BB069B01U01n0ZWCQ00v4G9443C+tl36sl38C38uuG4A0GC+bT10CJ1c4UI+FT0wDT00OZ3NW00mOOa0mGCn0IDIG62o090+OT0"
+"0OJ2e0WDsO20+VT0ETT004Jmtx7bE0GE1Wj3jpW-QHWUQH00vKY6+1o11OYG3hW-S4WJS400qe8164M6+3u0I2u0EWf2+hH0+hH0jeHI1xNZ000EIGo2+VC22UC255i3"
+"d2XTiU01nCJ9dwlXF8eXF4mP6w80Eu52+3r0A2r0Ima4EKp32oH0ICm4+-z0+zz0Iqd3EaA3sz80bQKWNAp85uVu3OKu3ul71ul71eZ7100EEqL31zZTU400v4m9XuX-"
+"CMWUCM00su0D90GE2gJ3CO38nOJ0KwVh1uNh1K+x6os40WJ0s20D+V+06U+0ImA3ESz4srQ004Z5TPX-YmWWYmGeIQ8w34yG+R71EQ710KJGKOeo240AEe43+pZ02oZ0"
+"EeI6Eez2snQ0Eee40CJ02uVPIONPIumQG4mPsr808a38uu0lAuVv3uNv300EIiS3+zV20WZ-D2WbD2W3Od00o88ME4W904Jmmw-f1Otf14MkE4R6+TQ0Xpk-G2XYG210"
+"s4es+rE304J8O84xCu3NC0mDEqy22P20+-r16zr11w60u40RsDK01SYGE2WFq2W41oWGc0W-q2WHq200n4wq6wv004Z3VE10pulP6OeP60WCMcK108Z38AH0FwF53e75"
+"3ul71ul71Oa714uB+1f5Iic7E0k2+dT1wbT10SZ3HfWXHL10tuWaG4eD+-80wz800OJ2ev7t58nv9u-Z0euZ0uWfOuWf8u7a040AImK4+3I0+1I00KJetAuZ0ami+t80"
+"2s801OV2hPNB540A+xH0QwH0E8U5+5d1EuR2EqF4+li0wji0QKz2+jZ00WJekuF-Bu8-BuWkAu00Se7h14mZEOM8+xH06wH0EaA2+TG1Eq95EGv2wbv6bKa3BnW-CPWU"
+"CP00t81LAOuq1uGrWulVQOeVQuGOU4O4w9T01nk4x6X-yfWTyf00m4ML1KWTF2G0Y4YrsiQ0+iJ204Z3OpWHd0W-yaWIyaW3v6X-3lX-3lX83lX3h0HmNRtG14+h+Bn3"
+"AAn30GZ390HP+PtZ000DE0y604Z-AdWYAd00o4a4XAkTG200oumy9KOD+7l0s5l01Vj3BdWWh3Y4yoGWkBZW38qy200DXkdGd0W-pBWHpB00qKIhEWFAsXK05WImo8tj"
+"00GE1OhGc0W-s2WHs2G8V4Kz+vz11WIGCgJO4uVa0OKa000EXSKOnQdH1en0KuVZ98PZ94gwM2I0bea-VCWTVC00q4sX18fTW4GHcv-Z0euZ08HrFOe6MKYrE0RA+xH0"
+"wvH00aJGfwWi8Od710GEEOR2XuX-CJWVCJ00nO9N540AE083w0P2+xr06vr0E4M4I0K4s1I00KJGb9XpSuVp2ONp240+EC9222h204JWM4Y8+790w590IOJA6om10OZ-"
+"F2WcF2W37g00numoZuth10GD1SY-DKWWDK01t0Y3n2YWb1Z3DPY31xW-i6WUi600o4eL0WZWQM00o4KyEe33+-80wz80I4W9XBhTi6W4taY-AuWYAuW3CGIvQRtZ0uWI"
+"cu-9Feu9F00CXYf346ZTE2G1d8qv3upq98Hsj8a90uVB5uKB5KwA04ZUr2W-35Wc35W3rgXYH7W3neY-H7WYH7W3GeW3ih00teN71a0AIuh9+la1wja11rZ3QNXTY9W3"
+"DD30nu03Eu-Z0utZ0uGqiKG1w190M4E8XNW-CYWUCYW35C30num9GONa04uc+VD4AUD4IqU76cQ244pDIaN9+hj12gj1XJcYE2W-D2WbD2W5MuXWKa00m4CJEOB4+dr0"
+"sbr0ECc5E2P31LZ-0hWW0h00t8XmAut61um5UumGGul61ed61uGLG4ga+nX31WImyBpS4uJr68XBh8a90uVr6OKr6u0hD81wPOt148XId0WCESI3+NK0wLK0Eii30OJO"
+"eR7a0umVfOnsSulx2Odx2aCi0OZ-ORW-ORGsOB1AdO8a00mCXoj-dTWYdTW--8W--8WF-8GWsfup2uWTtulp2uep20GCEyN262a3EmB5DFd-FBWTFBGGv4OLsrr0Ee-8"
+"+3J1A2J1IqG4IOm9sz80EGH2EyJ2wua1+8J1IG14ECkCoWL1+BJ169J11iO1GQdj0uVo98Qo9ul0Tul0TeZ0T81BI4yuszH00KJeRvmFOulh1edh1u06EuGuBOOb78nO"
+"NulLn8eLn8HSC81FPO78140AXfgCV4WFpB00t81NHuFj0O8j08HjpO8Iru04BuWVi87j08n9E8a90u-f38sf3u7+14cpEGE3oHB0Qq-E+tE62sE60aZ3ebGGoQ7728nX"
+"GuWVPulB6edB60mCEyi2XBkTF200puW-KuVpN8PpN40Z+5T0Iap2Emy5o8T0+3c061c01EE0nOus74W8IuT7+pQ0wnQ0EKY3ECDHsjQ044ZCUWv8kW62+S51E8i4+lP1"
+"AkP1ECQ4EmhAsDB00GZ4zr20uu-p1utp1O19E8u96KceEmH2o4K0+xb06vb0EOhEIGy2+rH0E4F2+ZKD2YKDI4P3EKdBsv800OZ3EdW3RTX-iBWUiB00maQa+T-3I4H4"
+"E8k4+-80wz80fzjWPIW6IlX-5PWW5PW3K4XX91KImxlE28eE2umw8uWBIu7h140AM4t8+tQ0+rQ0XFcXce10n4Wa1ji-eFWUeFW-PmY-PmYEPmIOQ5iisX+0XbLGmx-g"
+"1utg1K0P+Zr0+Zr0rXb4-oa3e1ZTT4G1du0FM8ZE2upO7KgK2P20+Za16Xa1+JK0+JK0wGK0Xbd4oAYT45W3XDJv2uYf8uV71eK71u0N8OeW80GCEe5HEyU2o9T004J1"
+"nwGcKuVj0ONj081MUOe5300E1Sh3drW-45WU45W4nFY3EMXVI7W49oY-zRWWzRW3H3L1JQtZ04m9XjiCi6WFaEW4gwWGc0W-7AWM7AW4sbYTr201nKZ3L9XFqUWGs2Gu"
+"yBa90ulj0Oaj0umsW46gsHB01OY30WWSf5W3QHYGb0W-o2WHo2GRlB8iYq6ywmH2IXM0+lcGIkcGEG862Qm1ICi9EKZ4oeM0+NK0ALK0ImG4XugTv7G0eO14IuVW4OOW"
+"44uV6w2CISRI+hZ72gZ7IqG45pWUW4W8+-aCn6WFc900p4mjIuA6+Rb1sPb1Imu5AQT0Eup2+-a8A+a8ISs3ESP8wLK050f3j7X-b9WUb9W4GTYXG200t4o7+-80A+80"
+"1Ud3LRXVdLa421X4LOZ-W4WUW400sumBD4sXs1R0bhf3YtX-EBWUEBW3BcW3IvWV-Zb4PRX3H3YCG2WF4E00qKSewyW1+hL16fL1Xta30fWT35Gui4AM+7T0w5T0beA0"
+"qOOTn8XvQum6O8dG1eHEsu-zQ9uzQfX1m8936uln4een48XAmOugB81fD4ku+JT06IT0EyO2+5q5bqg3UXXCJ7W-mBWHmBW34kW4W+YVnBW3DSY359X-2SWT2SGOPvGa"
+"FOdZ0815C8ngVulZ0OdZ081KF9vZ0u05Pulr88er8uW9RuW2DON7100C1-Vm6u-g1etg14aEEe44sv80X-g-2FXY2FX4CzZ3jpZWE2W3d9b-g6WWg6W4r-50u884K9HW"
+"puWqNu-g1etg1u0aZOe05u0ghuV05eO058HID89yH4cuwug1+O12IWs3X3h-AGWUAGW3ekYXq2G0c8KZ0upi0umDA8K90uVs5OKs54YoMUz8EmOC2Qz8EeBCwK20+JB0"
+"6HB0ESq6Eax2sLy0IWPB+Ns3EMs3XDZXmLW4IxGmb8pW2uZz18ooE9Z90u-G1OqG1uGdqO8lWuG2quGN8uFU4e7U4KGzXPiUH7W3jZH8Hx-Z0etZ08Hh7vGV9OtZ08Xq"
+"guWZYu-Z0etZ0uFO2uFO28DO2O9534W92En01LeGb0W-ICWHICGJ5wNSBKLX+7w026w0XxeVE2W3JeJeAuVZ0eNZ08oJRPd43Km917b-F2WUF2GmbvGcGOdZ0eXpIvVZ"
+"0uNZ0uWM-uWKAutg140AEGS2+RL6AQL604Z3SHYV2+b4mFL869Jh1u3a681pK9a90ulV3OaV381qf4cvsHT00aZ3mVHGnxFT5e7T581yLuGPEOtZ000CXRj3KtW-F2WU"
+"F2W4wzW39JYTF2GBUuFW9e8W98Hp8udkHq2r+RK32QK3Iym5EIi2EGU4IK7F+-Q0wzQ00WZ7RzWTl6W6tEX-HGWWHGW3N3Z3rsWTE200tuGCBumXF8344ulw3Oaw3u0X"
+"KPOw3uG5FuFw3e8w30GCE0O9EOM3snH004Z33qb-9NXY9N10n8nD8v02HO7a00mD1WI8iwVo2eNo20GEIyy42gj1ESvLXVl-E2WUE2W32bc3qaZTS4GYE4qO+N-4wL-4"
+"I003XBjUG2G1euWhRuVM3eNM3On3cutz7uGRWulo2eeo2uWuiOev3uG7Pvlv3eev3eXwRu7o2Km9E0c3oaQ0A9H21Ch-sMWWsMW6aPZVsmH1d4IroKB0+VR16TR1MCk2"
+"+v80XzW-D2WYD2W3m2Y3yuWV2YG0eumuMu-W88uW8O1YDutZ0u0LM44F+h91wf91MqdJEe94sf910aJm65m9+390w1909RT0fP7a00WD+390U290IW-R6w911WY-+8Wc"
+"+8W3qMZWX0Y3QZY48iZ-hFWUhFW3upW3OibTk6G0cu-w3euw3On+k8eg45S-ESDS+lH0wjH0EWS8EaA5+f+01WIGXvVU48OU481LZOOoL8n+CuloLeeoLuG1v4C1sjZ0"
+"EaDFEKk2+Z71wX71Iuv36cF300J8kwGJBuFF2u7F24WQEWZ8srH0XPU87vV71eN71umbTOO+C4GZ+xY2AwY2Em+6bEWW4GY4atKWTAJh1u3f940KEyJ5+V092U09MK82"
+"+bb29Na-25dX25d3spW3iEXTX9GX1xmX88pG1ulCAOaCA8H9j8nqsP7a0K0A2ET00GJuW8a90ulj0Oaj08X+J0WCEunIsPB0EqK9I8x9wus4+ie05wb4BoX-l5WUl5Gu"
+"28X78e7k08Xy94c7+-n3wzn3EyK36MaMIaGIE8K5oy80+KK0E8WV2L20+pV0EnV0E48E04ZWjXG8L7m9oGB0+-806z80E4V504JmBedq14KhXNdCF2WF35W3++XGb0W-"
+"q2WHq2W4LVY3YaWTq2W47Ca3hzW-cRWUcRG1e5wV2+80ECJ6+Jz32Iz31JfXCKI0cuGye87q1u01X8K90uFq1O4q181mqPOj881Mbu-N2euN20GEESq66Ek1Q0J6+3T0"
+"22T056UOdQtN28Xz94Wj+xk0wvk0IicG1WcTF2GB5vl71ul71ul71ei718X0DOe7146M+hR36gR3XtX-y8W-y8GMyumVBOeZ04yQ15c-9BWZ9BWXMxGH9N2r+pC2snC2"
+"IS2DEyy3sXr0ICgUEar2+-80wz801Ti3xsWVABG0e8HNnuVa0uNa0uVJcuVJc8JJc4kFICH2srQ01Gh-m9aZm9KHyuW-POtZ0K4F1Yd-y8WUy8W3c1b4XgcTF2W3Lva3"
+"uLY-E2WZE2GWGPdZ0uWEBvGn9ulZ0edZ08XfDuWgPPdZ081GFuWaCu-Z0etZ0uWT9euLgawa+V5J2U5JE4z66Ui0E4z6+Ri0AQi0M8EC+TqWECF35GW-UOWTUOGp6wt6"
+"ReHCGuGMguFa0O7a04cBEuPHsPi0X0TmJxVZ0eNZ04mPEeiBsr80IO04+lH0AkH0E4u662O31GRWlvFE2e7E2uWneeO-4u0uB5WZ+dQ0wbQ0E8C7b6WWg6W33cZErBX-"
+"uvWHuvGOk4qd+1yNEK5FECN2+JE22IE2EGRC1qcVdFGeFAn64wFi1e7i18HXI4y8s1R0E4y5ECa4+x80wv809IdVj6GOP5Ih+t80wr80IOBVE0T4sjH05SY31VXCeFWF"
+"uCX41iYGc0W-nBWHnBGOM5kFsHB0EGDBEe7ZoCB0+t806r80ISZG6wW3YWq7+-80wz80EGfPIioDsrH0QOpUwKV6+4T0IO+8ESNH+NB0wLB0X6bYr2G0d8aZ0u3j08XO"
+"19a90uF+1O4+1OHRVutpQuW+V4sn+7K026K004Z3cWcVE2GH5wWJUu-Z0etZ08HBEOOF8KEH+-80A+80EumIIep6sHn01SY3PbWCT4WFV9W3gtWGb0W-U9WJU9G94vNq"
+"1KKx+3c0A2c01rb4azZT25W32nW3AGY-sQWVsQW4blZXYrW4XbX-ZrWYZrW37RKmtRN71464EOd7+Bz1w9z1+dNK+dNKwaNKECv26QB4+pDMUoDMQaIc2MxKEuuPX8j-"
+"i6WUi6GW9vWdKONE2uWoVuVMYOPMYumPN88718nfWulPDeePDKmy2cQHECQHEqkB+hQ0wfQ0DAdVT4W4ZHKWPA3H6u-76Oq768n0LOuL38HPBv-76eu760GCE4rHA2u4"
+"+lZ0UkZ01-gXF2W4JWW-9BWZ9BW4k-cYE630m48eE418+xZ0wvZ0MayC6oi0ES8B0OZ-QDWVQDW6AMYVE2W4+7XGS4WFUcW4E1XGc0W-0EWH0EW3d0X36wWTvMW3p1He"
+"zwFd4e7d4uGPdfOtO9XUxuVr6eOr6u04POunKu0uGKy-+7U5s5U5Ia3a1KlTg6GOx9HYCuFh1u7h18o8HO7a0Kmj+tY2AsY2IW35EO07sz80IGGY1wW-PIWWPIGGJ88h"
+"WvWGJu03GulZ0edZ0enDKud9sOnDKu-3DAu3D6Sg6A-1Im721fZ-NDWTNDW3UNX3lyXVWwW5NzXGH2WItMW3cbY-u2WXu2W3qYY3QKaTlBW3W7IWquFd488d4OHEEONZ"
+"0uGwK4Y6+t80wr80MWD4+TI8XPd-BYYYBYIeFAH7Oe771a0AEOj8+3l0w1l0Iah2EWFCsnQ0IWXF+-80A+80IqBGII-8EW6A+-O42+O4Ie1OEC82svH0ISfB+xZ0EwZ0"
+"IGN22oi0IqNXXqg-QDWUQDW3CQHvevd7181RMvVh18Oh1a8K+b+0MSR4+t802s80E8eL6gQ0IuV71WY-LRWTLRW3dFJPQPNg1OHw-uWJBu-Z0OtZ08Xeg4mz+z80XNM0"
+"fu-Z0utZ0u0AA88rTeXoJ0GD+Rr0+Pr0ImT5EOl7svH0IKjB+-p1A+p11he4gPXUG2G0euGIBulM38eM3umm2QeeE8HtkvVh1OOh1uGz299tDAH1uv-XA9uXA1WCXDZa"
+"rwKfyw-o2uto2eHnPutE2K84+li0Aki011X4r5cTQDW4+CX35qX-uHWUuHW4SGM1jP7a08nLl6ayoiW2+e63ESk22L20+3Y461Y4XDkXTIW3HfGeXBZi0uVZ0OKZ08XC"
+"c40Rw5K0ECKS+3c0A2c0ECN2A2T01SY3E0XCT4WFF7W3bNXGb0W-25WI25W3BmI8RedG14m9XleCq2W-F2WHF2W4qpO0xRtZ081SBumDGule3ede3Kmz+xH0+xH0vuX3"
+"vYYXE2W3OzZ-h6WYh6W4Had4-AZTi6W3H5X3+yXEyRWFmBW4Nlf-UdZYUdJA4vdtH4W92HK0+CB0ECUM2L20+Jn06Hn0IKMS1rkUe5W3iRY3fcW-ZEWUZEW3f910o4I+"
+"sz801SY3VyYCE2WF25W4uAaGc0W-35WI35G2ow7yK8HcY84X2OKj0u0tDepp2uFj0O4j08Xlu4EHsXM0I0D21Pe-BKWUBKW-lFW-lFWslFW4jJcYcIG1e8u+1K2b2P20"
+"+pV06nV0ISuQ6Uy2IG17E4P2+pV0wnV01gb3wlaTAAW3zfW3SsW-D2WUD2W3K0H0DwNLC40A+J25II25Eur66kk8E0f3IWV8+pC4snC45fZ3w8YTi6G1d4mZoyP1+di0"
+"6bi0IW-7EKgFsz80Yy0a+xH06wH01ZfWOgf30vfGU4WG8OG0Y401+JK02IK0Eus72k37EuSjE4W6ou80+GB0Iur82P20+ZV06XV0IaP3AQZTEKZ4XnZ-vQZWvQJeD9HM"
+"JONY28nykumvV8ZH1uF81e481evTPa0AE4Z3+790w590Ea17IqNIs1I0Iih6XDa-F2WUF2W4DP50rOOg34mjEGyE+-80wz80XEk39OYTT4G0c4wUoq80+8u0IGgJ2P20"
+"+Bc069c0Iit4AkH4ICu2EKb3+lN1wjN1EiSMXfkT35W3TcHeJvVZ0eNZ08H4AOeso8XMruWcWu-Z0etZ0uG3Rv8714KO+xO82wO8ECS2IWFWsfQ0E4+7ECM2+pH0+nH0"
+"QKVB+1p7IytE+Vi0AUi0E0R5EKP3AMz9bKa-tLYWtLY-dJd-dJdEdJNOzw0Sc8umF5gkEGs5srI156XEBNZ-iKWHiKW3WbW3K-WToBGW2xGXauV348O34umRDudtCu0f"
+"8uGxHuVZ08OZ0uuQDOXyeu-rfQurfgnzLu77140AXGa-SIWWSIW4keW4--aTw8W4lAb4Iwb-l6WWl600nuW39uN81e1pluF818881umaCOO7k8X6TuWeJuV71eN71u0R"
+"C8HBHedh140AEaJ2+-H02+H0IWQK1AbT+8W49oc-iFWYiFW4k4X3W1ZTF2W4JQSedRdk54Oe2P20+lR16jR1EacT6IB01OYGD2WGQkW3iXW3fTX-Y6XTY6X4AjX4-tWU"
+"e5W3pUe3G3ZCG2WFr2W4m-eGc0W-e5WJe5W4kHcVyCGPoxmwIuFp3u7p3uGlBOuNb8H+TuWFFu-Z0etZ08n5FeO7181NBuVZ0uNZ0uF71uF71e371uGMhOeg1uGSRuVg"
+"1eOg1uWgwOuIRumDM4QSoet0+Jr06Hr0EyvHAIo41ue4+bX-F2WUF2W4K3dXR7Y8KyX-KDWWKDW3f9X3dmWTeKW4wcX43MY-W4WUW4W4LOX4ldhTH2W3j920nuGonuFa"
+"0e7a0umUc8XMAOtZ04m9EKBDou806Ta1E4I5+dM32cM3IexoEiv2sDB05SY3H4XCq2W-1EWH1EGetQeZ0umBNuVZ0eOZ08nocvWLHe7714AJ1Za-S4WWS4GG8x7AXuGM"
+"9uVZ0eOZ081WO9XXb9O7181oNhJrMvZx28nZku-j0euj0u0CkvmFKONj04W9E4y7o4T0+CB0EuMH2L20+Bn069n0ImRTIIW1IKU2sGB0+-80Az80EKO3E4D2s9K0EW-4"
+"MmDP+lx2sjx2IqJG6YU2Iy4S5ih-F2WTF2W36XXXE2W3rhY-D2WYD2W7HnYUh6GfRx-Z0euZ00mDESJ96ci0IePa1zZ-h6WUh6Wcb5a3x1X4VUZDPDWFDGW407H0TBpC"
+"4u-V3OqV3umKiOOO2uGuBulq1eeq10GCEKiC0GZ3gdWTDGG1e0WC1WY-U4WWU4W3rAXV9WX3o9H849JZ0uJq1uGX88K90uFq1u4q181UGut1dKIq+NU7EMU7EStCA6G3"
+"5WY-2qWZ2qW3YvaYG2W4soh3boYCK7W-l6WHl6GhJ9ehYumkOuVkIeOkI4mOIch4402D69f4+8l0EqK6+Vh4AUh4Iq0KISfOwL31Xyi3QEXCJ7WFr2W3jyX5-jWCd0W-"
+"w7WHw7W3pnWYs2G0d8Oj0eHwu2mD+JB0+HB05POOIRdQ1uWuV4W9+7t1w5t1IWw3E4M4sv80IeXtEq+5+-80wz801ee4N1aTF2GKUP3h1upX2OHQfeJ90uVX2OKX2uGV"
+"TeOq1uGZKvVq1eOq18n0E4eDs9K0bPZ3oCX-H7WUH7W57raVRMW3sna-3laY3lKX+wW4NO771KSA+VZ2IUZ2fdaTE2W5oNXE6BWFhBG8nxG4BuFS5e7S5umlAuWjWu7J"
+"Uv0DG81esvlN2edN2OHMAuNPQvGoM8asJuF24e4248nkyPeGp50AEeK8wqN4+7906590Q290IKgCXoj-z8WVz8W5Z4YV9mW4M0HGCxFF2e7F28XHWwWf8OtV3enh9vlZ"
+"QOeZQOnInPu718n8nvld4eed4eHKcuNgGeHG8uF81O881ulF2ulF28aF2K4f6wZ01wd-U4WWU4W3x0ZYwHW4yyGGzuVSJONSJuWxMu0TBOdM3umWpL2H+t80sr80ESZ5"
+"EOB3sr80ESO8Xeg-D2WUD2W3g8H0qRNZ0uGMGuGvTuVa5uNa5uWfXvWiPOdZ0uWpD8HrEuF71e7714UpEWUHwv80jGa-D2WVD2GG07gPwv80ISb3+3+062+0E8u6EWYc"
+"wz80E0b2XYY-v8WUv800oK45EuOBsvH0IaR9MGaB+J+0sH+0X5ZXj6W3AjW-i6WYi6W4uoKWCPN718nVY4mZomH0+az2IuD92P20+pY26nY2EyCL6IB01OYGD2WFp2Ge"
+"B9K90uli0Oai0ull4ull4eZl4umyCuW2UONz1uWcmu0Gd83z1uF71O4714YoEGSA+9i5Qme4+Jl42Il41DXXtRW5VqY-A0ZWA0JWfKObsjQ0IqI22HCF+qk0EO372L20"
+"+7T065T0XiX3vcWUp2W3BaIu7v-N2etN2ul-Uul-UeZ-UuWLJOO-AumCY4oG+d32wb32ImQC2AOX1OY-8GWY8GW3FbGGlRtD2uWcK8X6CuUf7KUfS8NPZHtS+e08D401"
+"yyL6C048WO38m0ICq0ICu0IBnu2Flq17+W200aJ0eWGEW8ZBc001yyYCT10AyGNQiHNPav3CyyI3AKXKPu40y8pC0008TeH01mXCW4ZDWO38petZ0GYCW4pDWO38n0oC"
+"+-80sz80Oa38t0oCWOZUE205n038t0IC1Sh-E2WTE204t02EWGZWS404t0IEWGZ-R4WXR403t0ICo4mywnH08S38n4IG+hQ0AgQ0C4ZCW8ZWT400v4mZ08Z-F2WXF2GB"
+"U0WCwvH00aJ2s2WC+Zi0+Xi0KK38n438q8Oo20GDXHUGYvlv3edv3GGCn40+0SZWV4G0e0mCXma-H2WVH200s46n0WZWW4G1d8481u3n4GGCm4KP2T20+tI16rI1Xy14"
+"m0oCWGZUc9G0e4s608Z-75WV7500v4gl1ecTDP00v4gl+Nu0AMu0S4pCWC38n0IEwz80H6g-5EWV5E00n4WQ04ZX6E02n0ICbbe-MGWWMGG3vBut60mCX8B1WCZ-+8WV"
+"+800mK6D+f821YC2n02E+tQ02sQ08W38m44f2+801W20nuGG9uFD5e7D54sL0OZWoK00oKgv+3J122J18a38meuB50HEW838u4Gk+VH2sTH2E4Z2EuN2sL710OZ-5BWb"
+"5B01nGJ9Put59mGCq0IE1-a-7BWV7B00mefn2um1CuVn2eOn2K0P04JGKONh14+G0WJ9nAZL38aQ7W08naZHc0W-fTWHfT00p4gaEyb2sPB00CJo-xlV38eV300E1z30"
+"r88P200E1OB0ruFxAO8xAKmZ1+fTU4G1Fwlz7uez74mYXhlTF2W6TWW-sVWWsV02t0IDAYR18a38rKKO+lI1wjI184JDW4W0+T9304J0p6aEout0+Zr06Xr000ZaE202"
+"m0YD+t80Es8044pDXTbX9PG0eumxFuF498849GWCW4Ot+fa18K38v4Kn+hZ02gZ0+Rr0+Rr0sOr01ZjYtA10o4z-+di0wbi0Uue4+H710SZ4DxW-sVWWsV00oOfo28XH"
+"JuVsBeOsBGGCv4Q-6Q711zE0nu-F7OuF74kE62Y1EK85XmX-IMWUIMW-pyW-pyWEpyW3JFH0sR7F70WC+Vi0MUi004Z3EpWYje02s02D1sWDbFWGie02o0ID6P20+Jj1"
+"EHj1E803+9s1Emk3EKQ5oW91+CB00GZ-o2Wbo2W4qT10numMMudz1GGCu4m0+Va42Ua40SZ31YG8yR7a00mDXUd3MkWC55W-I7WHI700quG7DumpJOtZ04opEiK6+B31"
+"+9319lF1o0ZUF2GoxJWCmul71ud71KMf1DlTU400n4seXGjCj6WFoB00nOHCG00DsO20+FT06DT00OZ4zPXVbEG0c84a6upi0uGbP8K90uli0Oai00GCEOm2EGO2wTM0"
+"Eie6+NM3AMM30WZ4PiXV1500uu0gJuVq7OOq74y80OJGyO7714WZEmY4o8e0+hQ06fQ05+Y4XZXTF2GOH8XbPulO8edO8unQI0GCw19004Z3YC10o4ma+790w590I8d7"
+"62L100Jm64QL+-80wz800aJOSPeM30GEXeX-QDWYQDW4hk10p8uM30GD11l-SDWYSD00v4YX6wo2E4x4E434+Ze32Ye3XLiXohX5nn00qu-E2euE2OHJCOdw3uV718Q7"
+"1umNEOuE24AlEuO3+Zr0wXr008J1ux0dBOe71uWJOepLAu3Q70WC15Vegx-l5etl54e20GZ3QfWTs2GW0B1GFu-Z0etZ04cLXCD0te7a0a0A04Z3OZW-kbXTkbX3njW3"
+"wDYTV4W3EJX-UIWYUIG0d9HWAOdZ0uGYQ4+R+Bl0w9l0EqK90WJ0GQdZ04m9EOW7oaQ0+yk0I0V22P20+xA26vA2I0M8XGjTq201nGZ3lrGWtuYN28Kj00mCX0WFc0W-"
+"r2WHr200m4IP08Z3IiWTs2W4gXW33qW-w7WVw7G9V4eEs1905SY3V5XC65W-W4WJW4W4ziXVVkG8k2mCXia-OCWUOC00p4IY6oh71SY-XNWYXN00s4AB6AD20OZ3HiGW"
+"3xV71eN718n5RuGRKOtE200E1yOeuv-Z0etZ000C1gdX5aHP2wVH8eOH8GGCm8Xpe8OMNKmj+t23Ms231JdVG2W6MNX-C8XWC810r4gb4038+jT31SY3UkW-tHWUtHW4"
+"wx00oumxNO7p20GCECi40OJ0euVa0eNa04i8AUY1bpc4ATYCG2WFURGGBQa90ull5Oal5u0ChOea74W92js1+CB0IPx1+BB069B0I0Z76EB0IiTB2IB004JGkAa90uVj"
+"0OKj04IG6IB01OYGD2W-d5Wtd5W34hWYQ9X36QHWL0WDs0j0+FK06DK0ECL604Z4LiYTnFG0e00EEqw2orZ2bIiGd0W-s2WHs2W4-fY3KrWTr2G0Gw0wVuVFAOOFAu0y"
+"M8OyH0GCX0Kupv2H1uV71OK710GDXlj3a8YWT4W5z6Y-FYWWFYW47G10retZ04Wj1Kh-E2WUE200nuWy88XzFed7140A04Z351X-k6WUk6W33zYYG2W3MjW-F2WZF2W3"
+"52H0xBeSj8HvKuWcjuF81e7810mCfChVG200q4m9+-80A+800KJfk4gns1a05W20t4u5+t+0sr+01gd3KtXUF2G0Aw-UCeuUC8nYGe8CKumbR4wloqH0+Cv1IKhB2P20"
+"+3J161J1Eec5Ii95s9T0Qa+C+Bf52Af5Eyt2IKk6sz80IuS9E8v3+7J1w5J1EmI3ECt6sv801OY3H+WSH7W3PWWGb0W-G7WJG7W4cgWWJDZ4r4YGW9WF6A00v4sN2P20"
+"+RB06PB0XM71nWZWNwGmlumQGulz1edz148CIOr6sTV0EaAEIWlA+NE1sLE1E4IA6EN11qeGV2Y-f6WIf600nu0MAuGLCO77140A1vk-bfYWbf20t4mQEKi6s190I0DE"
+"EC44+lZ02kZ004Za0J00m40AX4YCz8WF-DW4IlYGc0W-M7WHM7W3G3X4gAXT55W3iUZ411X-55WU5501nCZ43uWZPNZ3+sW-YpWXYpW3ALZXqBW3KSIeiul71ed718nh"
+"mumlRONh181cLulKKeeKK0WDMoQ0Iye5+lQ0AkQ0I0-76gC6+7E5U6E5EyW2X5iTi6GmnvmLPulE2edE2uWzs0GC1WcTE200vu0RDu0DIu-Z0etZ0eXtKu7ZM8X4cum3"
+"Iu-Z0etZ04Ab59gTU400n4O35aY-tVWTtVW3VTZ3EpYWE2W3QpW-gCXWgC10r48KEyR4sz80Eu43+J71AI71Ea-6Aw80EiDA+x80Aw80MKsG+DU4IeDAEKm4+Vi0wTi0"
+"EqEFEeH3sbQ0Emo91pg-5BWU5B00nu01qO80542pIq52+tH0+rH00SJXrv7CG4AA1nk-g6WUg6W-T4W-T4WHT4GZSRtE200E1SY-1KWY1KGux8nx4PtZ0uGB61mCECZ2"
+"+xQ0wvQ00OZ4zQaVJ2IOO5uS+Zr0+Xr0X9k3UDYTS4G1d4SH+-80wz8000Z3hOX3P+WTF200mu0vF4yh+lQ0wjQ0XhSXFv7Pm4GAEmZ30KZ-X4WVX4W3pY20p8u864SI"
+"+BY1AAY104Z3foWX1nG1duWIBuVF2eNF2uGkp4UqsnZ0XTk-tCaYtCa3jFXarHGGkxWuGuV1AON1AumQduladulad8iad00D5EdWvHKW3xmBpu-G1euG1O8lFuG68uGS"
+"GuVZ0eNZ0uF71uF71e371um0T4aysjt0EqDB1zk-8GWU8GW4ZXHGLOdZ0u0BA4ebwzIEbLi3-RY-s2WUs200u4y+Eeq2sPB0IGx7+-F4A+F4Iu75Asu7EK122HS2+y75"
+"04Z3FsYGc0W--HXH-HX3woXYLLa3ZRHGWuFf3u7f3482+FK0+FK0+EK0ECbCIq7EsTe0Eac4EmEE+FK0+DK0IWh7EeL2sz801WY3SDY-utWWutW4EdHWsO7a0uF9ru99"
+"r81IjOuZ0Km9E0x4+JC1wHC1MWbF+Xu4E0g81sW-y8WXy8W31XWVE200numJBuVfFeOfF4276gQ0XmX-D2WYD2W3VDXXD2W37Aa-D2WYD2W3Z+YXdKW4k0H0EwFn2e7n"
+"2umaZuGUF8O+U81dY4kY+790w590Ia9C62I0IiB4+3I0E2I008J8ZO8a04waEWI7wzL21ya3A-WEd0W-SWWHSWW48dWXt2W4Udb-75WY75W5gLY3zxaTAP00q4QlIKNG"
+"+-I1wzI1I0AM6sy3Iea7X1Y-F2WUF2GGy4mP+Vu0+Vu0rTOA9A8a000DEmo4+R11AQ1104Z3a130s4cPs1a004Z3w-00o40A+7R0w5R0XqgY0OI0d816Bu2yGu3CCOH+"
+"kuFZQ88ZQu0dSu0-K88+LL2-Eu76oPB01ya3cqb-hAYWhAY4M3YXlzG1d8ej00WDMWd3+NB02MB0XKK8UuN+M40AE4S9+7X126X10CJ2vx7a00mCE8b3+304A204+7z0"
+"+7z025z0Emy8A661MyrH+BC56AC5ECs5E8y72sw0I8vDE4+9+7F1w5F1IyJE66525SY3lpWSyG00t4Qg2P20+RG26PG20OJWcQ8uT5IH1pkEMGWFeMW4pEY3qWWCS3W-"
+"s2WHs2W3ZBcXg5G0c8qG1upi0uGGP8K90uli0Oai04WhI0qAwvv1EGW81wkC15WFq2W3Q3XGb0W-q2WHq2W3YwGmlOti0uWeE4w3+xr0wvr0IC350CJG9QtZ04UTEei3"
+"+ht62gt6MqsB2g07IyNIIC54k4E2+tQ06rQ0boWXlOH97vmZAu-h1eth181NQumRHOdh100E1dY33eW-U4WXU4GObB8-H4sV5aY-j6WUj6W4IrYX3zLXtepMevJ348X4"
+"LuW3Zu-G1utG1uG1k00DE0w3sDT0E4y3EWW7+xw22ww2E092Ee33sz80f8j-hYZWhYZ6XNXVX9W4BgX3E1X-X9WUX9GmM7EYsnH0ECZIXrd-D2WUD2W-RIW-RIWERIW-"
+"Cea-CeaCCea3+1Y3lBXTf6W4ybW-t8Wct8GuzOdZ0OXJYep2Aulq6eaq6uGJNfucA4UY1nkC0KWFcKGaMwlj08ej0umaCOOj04W92IB00GJOw8a90uVQ1eKQ1uW1x8Hb"
+"CP7+10GCEuYIES49sfM01odGc0W-s2WHs2GePxWodO7j0uW49ummS8pi0uVZ0OKZ0u-n3u-n3Opn3en9OvdoGKm9EuE2oqH0+ep0I0sH2P20+FK06DK0Eax2EW4322z3"
+"04Z39rW-zoXYzoX4SgWXXXGBWuVM48OM481zN4C1s5l05SY-l6WYl6W46GZXiOG9U4Wj+J62+H62IOe6EO88wzH0IK1GEuW4oKl0+-i06zi0ICY5Iee3s5900GZ4QZX-"
+"Y4WZY4W3vgIeFO7a08nnpuGUCuVi1eNi18XICuW5HOtZ000DE4Y3XuX-l6WUl6W7XBXW+HW4wya-LUWYLUW4-jXXW4G1d8qx3e4n5u0wBu-GN8uGNuHnS8OfR0GC1XcG"
+"6EWFt2G9zBa90uFh3O4h3uPVh1mDECx3+dY9McY9QGP2srn01U30u4Wlsun0+SK0Xuc4xTZDd0W-85WH85G9W89j2eej000EE0d22fj0+NB06LB0fKa33iWXj5W3dCY-"
+"65WZ65W35oXa+cW3xuW-QKWUQKW6AFXWsrY4dbX3a8XCG2WFCAW6GWW-83cW83c395YXyQX4YrW3rfW-jRWUjR00t4CO1cZTZ9W6DXY-jAXWjAX3Lea4uXWTF2W3xwY4"
+"NbWCI7W-2EWH2EW3lyGO6AeD6u0Ni81M9u-h1eth18XobOeF20GDM4Z7+JcA2IcAbsYZ+8b3ea00q4wD+3I0w1I0E0fL6ga2bXb-lKWXlKGYvvW4ePdp2a0AEip6+-i0"
+"wzi0I8V66290bYb-F2WYF2Gu+x0qBu7K64aFX-cEWRWF1NG0a44QwS20+R116P11E0U46+rCEe661je-oBWUoBG0sxVH1uVH1uSH1um0VKSvsnn0ImkH1Dh-RCWURCW-"
+"75W-75Wt75W4mSY3DkaT75W4U1d3ahY-75W-75W-75W-75WM75GHd998CeOY4KAG1WY-j5WVj5W46wWXEWG0eu06Gu-388u388HsjO8a0eXxdu-Z08uZ0eH8jee+S4MG"
+"+-802+80Eu766sH0EeF7Em92+VZ1+TZ1EaV86w80Iy6W+-80A+80EWwM6oJDIu6M1Qi-T4W-T4W-T4WjT4W6R+XVexG1dum2d8pT48a9900CMKA6+Zk32Yk3I0z86EL1"
+"ImK72rI12PB0EWmF2P20+lT2EjT2Iim9+1V3IOZV+tx6Asx6IOkN6kC6ISC8Eil2+Zn0wXn0IeVK2ce5EKu7XWl-D2WUD2W3ilW3ZcaVi6G2euWJI9363uFF285F2u0Q"
+"wu7gN8n9G8nHJulobOdobuWq7v0WCON6A81sXv0GCulh1edh18HrHOeTd8nWi4KF+tH0wrH05Qd4lYWUV4W5Bhe-quYXquY389ZYG2W3I9Y4KYe-l6WUl6W3Asa3MjaT"
+"U4W3sbZ34XW-D2WUD2GOyAHpKPdZ08XJEumLEuFF2O8F281kEAujG8n3v8Kj68qs68nmD8q90uFe4O4e48X-H46NsTK05SYGF2WFs2WLUlX-r2WHr2W3ojZXtGW49NLu"
+"18p+1u3j0uFcxu9cxu07IO8Q14W92UM0+tWPUsWPECQDAsY11+d3EmWCd5W-r7WHr7W34Q20nuGkaOdg2uGDC8X+bu-Z0etZ0O1VjumZJP7a0K0AEy93+390w190XeXY"
+"0ZZ6qcX-kpYWkpIW1xGqAvtOGb0A2Pw0+-Z06zZ0ECSH62u91OIGpBJh1upC4OHhRepvqvli0eai0umcseems8XUtKCC+Ft1wDt1Q290EezE+-80E+8004Z3sca3Q4XW"
+"1EW38yX-RxWWRxW4YJZYRxKehulxp8exp4sUEGK8wjH0Ea1410f-v8WUv8W3LyWXE2GOUwVZ0eOZ08n8FMkzsrH0Eya7ICnQ+tH0wrH0IulW6Uk4Iqg81Za-F2WXF2W3"
+"5fYVuMW619Z-WKXWWKX3paGeHQ7h1uW3H4qEoSR1+BP169P1IGy56cd2IeuAE4i9+-80wz809vfWS1Hn3vWaDu-Z0etZ0KeJE8r8snQ05SIWvv-Z0etZ0uGNhOeZ04QA"
+"+t80As80Eip36s801OY-D2WYD2GHH4yhsbQ0IuHFEqS8+B71w971IeAO1FYTF2W3ijGe0u-Uf9uUfvmDo8nTj88a0umjAGGCtuVo2OOo2uG8WPOa5uWWWuFa588a581I"
+"lOOh1K2r1ji-y8WUy8W4o1X3NEaTi6W4sVa348d-F2WUF2W4lWIehPtZ08HTZvm4ou-Z0etZ0ummdeew8uGmFuWbhvVa5eNa5uG7BOuhBum6y4Qb+t80wr80Eyl7XyXW"
+"mEX439OOfxVa0eNa08HU9vWx8OtE2u-Z0uvZ04gRX1iVvYH0eumYLuFKq88Kq8X+3vW8PO781KSjEWD8+-Q0wzQ09WVO4R7a040A1Rh-PMWZPMGA8Q7a0KAmEmf2+l71"
+"wj71ICa66+Q0IGE4Eux2oyQ0+4N4Im0D2P20+3+261+2EC7DIOcWsHK0EKy9IauPoKB0+-806z80bqXYg-Y3ZqK8JBpZ084H148n2P20+NB06LB0IG85IW0YsLK0IWNS"
+"IeNGoSB0+7906590ImwbE+2FEiu82b0F2TK0IGd62T20+VB0ATB0Ie4D22RH1SYGE2WFr2GAKwlTIOeTI4ewXHaWrOW6rpe-w0ZWw0JeI4kvsje0Ead4Xhd-JKWUJKW3"
+"lIXY53e3eZHX5w-Z08uZ0u0qUv709uWj49aD4u3O24G81GW-AFWVAFW3iNY3SeWTF7W5vEX-duWWduW4ozXXT900numQAuF+qe8+qKwS6cP3QGJ9+xH02wH018V04Otg"
+"1uWNG4Cc+lk0wjk0+hYS+hYSweYSI0M5AYz1ES-3Iq84+J19sH19Xwe4qvXUj6G0e4Ih+lKC2kKCQOYewz80Euf75Sh-U4WUU4GOKf8wBumEh4mZ+li0wji0I4kDEiP9"
+"sbr0MuL21aY-U4WUU4W3LJX3lrWTF2W4T3MmYul71ed714ih6wW4EKx7+tW4AsW4IitA66Y15SY3ZZX-h6WUh6W3V4b34rWTg6W3V4LObxVg1eNg1K+n6w8004Z4NAHO"
+"-v-n2Otn2uW8uumrvO7714IfXUh-D2WUD2W38NXYeeW4P9Y4ljWCv8WFScW3sfWHc0W-moWHmoW3LIIWDOtG1uWqeumLI8pi0uVZ0OKZ08HUJ9HmnOtZ08H7Lu0wnu-q"
+"1etq144OXpZZ5VX4fBX-W4WUW400n4Ga6MRB5SY3kYW-F2WUF200mOXibud718X9kwVr6uOr68HMT8XEgOtF2OnHWu0sM8J81upW340K1Lc-s7YWs7Y3gvIPiRtj0u0m"
+"au0cKulz2udz2u0FN4Av+nMD1WY3raX-H2WWH2W4hGZYO7G1e8ur18nY98a90uVp4OKp48nJUfOh3aEB+JL42IL4MWt2+HT0EGb6Xjg-PLWUPLW3TCb3oTaTnBW30id3"
+"ndWCcEW-f6WHf6W3xBXXe6GuHwlRIeeRI8nqDu05ZOt614ib+dQ0EcQ0EGyG6oH0Eei5+3d1A2d158l4L0XTT4GGq8HKQuln2edn2u0APO8aXuGeAumQDuln2edn281a"
+"Cu-jCu-jCuojC81I5vd3G8ncbuGeBul71ed718XLtu0xFOdE281wuuWSNulE2edE24A06w80UeD6+t80wr80IyY2Iit2wrH0E82BM0KY+VT3sTT3I0UJ1LXTG2W4S-Ke"
+"huFF2u7F2umcGO8idKEyXQW-U4WUU4W4+iZ42qWTV4W4fRX5UXW-l6WTl6W-09W-09WG09W-i0a-i0aEi040nuGVuv0Vue7i14qPEW17+3a0w1a0XPiYkFGuwxVx3uOx"
+"3ul71ul71eZ7181Yq8uj68XQCumZ8u-M3utM3eXQP8O2060Abug-H2WUH2W34MXZL+H0D6UT+-80wz80Eym3XvbWuuZ6Edb-0jXW0jX4HudWcrW3l0e3SYX-gFWUgF00"
+"nuWUTOelB81iY4mZoqQ02vG418I048Z90ulZDOaZDum1UO8j04W92r80+CB0Emv22L20+BB069B059e-WNW-WNGkW7Wy6w80E4U4+tc1Asc1EGY4EmO32kb8EKd7Iul6"
+"+Jn0wHn016i4C-eTDUW3zYX-F2WZF2W3SU30numc7QtZ08nbdumGX8JV3u3y2u0oN8K90uFy2O4y24mh6cFDEe4YE8KA+3T0w1T0E4AH66N1IyV3bbX-BiWTBiW3eqY3"
+"i-WTE7W58yZ-tKXWtKX3NAJGJONZ04W9+lT6AkT6EyH9Ee88wv80Eac6+RZ0AQZ0Ey07EyOWsjH0EeP5EKv2+NZ0wLZ0XUeZe6h4GKXE-oZF3GW36FK0TB3A4u-04uq0"
+"48Hh1wdtHeXiqulUY8eUY00EEiE26Q01Qqc4+dt02ct0ECkK1dlWskW3g9X3WQiCk6WFJ7W4vZXGc0W-K7WHK7W6F5XVK7W6e2b-K7WWK7W4ggZ3MWWTaEW3QlW3msW-"
+"L7WYL7Gmhv7o88nkIuWsOuFD4e7D4enwRvtpP8n2J5IH+-80wz80bqg3UaXTj6W4aQX4RbW-7UWT7UW4icX37UYTF2GmKw-ihuuihuGgi4IXsv80IeR2+Zi06Yi0bigX"
+"E2W-ODWeODW4BQgXG2GHAx-71eu71ulKGulKG8aKGuG1OOus648d+3k2A2k2M89CE403sni0IiJ3IGD2+h+02g+0EKb2EOQ8s590MaoKEeb2+790w59004Z3mUY3-siT"
+"G2W4o+Q0twVc58Oc54GP2+n4X6Z-5mWY5mW4sYX3nnWTT4W4ecW32rY-T4WUT4W4j3MHLO7a00mDEWE91nZ-G2WUG2W-yHW-yHWGyHW4ytA0ou0EtON8181GNMkI+xr0"
+"+vr0bXi3RtYTH2Gm+6CL+3V522V5I4qV6290I4cFX5c-29WU29W4YwZZkOW6jfX-F2WUF2W4OsW3c4YTk6W4J7Y3t4X-+8WU+8GWwLimsz80QmMJ+pZ02oZ0Iita1SlT"
+"F2W4qli-5+YY5+Y4iig3y0XTF2W3ACb3hgWE1uWFsw00v4AD1Oh-K7WUK7W4LrcYs2G0FwG9Ru-Z0utZ0uWrX8H+MfdH1eHil0GD+Fu0+Du0EGKJEcP3X-cEJ7W-Z1XH"
+"Z1X5qfbVrwG0cu0pAu-g1utg18nf90GC+XleX4j4peY-iKWUiKGOi81TQfNE2umMT8199voGFuZV3uWWI8K90uFq1O4q1uWNM8H03P7j04m9EaH7wDB0IauL0WZDc0W-"
+"q2WHq2W4xJZ4EVbTr2W3YbY3QeY-pDbWpDL8iw0s8OOUJ48Dwy80+aV0Iuz3Ey73omM0+RK06PK0+Fs8+Fs8wCs8EKN3E8D7sDT0X0a-31XZ31Hem9XjLOtZ08HJTAKY"
+"kuZq18XtS9a90ulq1Oaq1uGfIuGxOO7j0u0vvumNhuV35eN358n5Teer7uGuWuWeI9Zx2uZG14oy2L20+7K065K0EKCEAIB01SYGE2WFp2G0X401oWD0+FB06DB0EmS2"
+"EqB3+Pj5EGo3E0PAwu2I+OB01ya32oYEd0W-u2WHu2W4TzbXOnG1d4u5oSK0+OB0ISOS2P20+NB06LB0fIkXRBI0euGjHulH18eH1uGcr6GR+Tg61WIfxucS84GI1hi-"
+"jKZWjKZ4VhaXDFLHO7c+sPB0EKW22P20+pV06nV0IudH6UJ5XKKGAwV19uO19uGb98u+1u-e6u-e6Ope68nJG4YhsHg1IGG2ESo2oiV0+NT06LT0QOJ52cR2I4DO+tV4"
+"AsV4IGvjESt8szH0IeyYE01P+-H0+zH0+VG2+VG2IVG21gbYycG0d8Kb9uZM6uGJt8K90uFY2e4Y244N14fTu7W-IKW-IKWDIKW4X3e3xkYTr2W42QX3ANX-nfWUnfW-"
+"45W-45Wq45G9O8OiXumhBuW8XulG1ulG1ulG1ulG1uaG1u0EEOeE34W91VdCnKWFjFW4YEI8fvY99uVx3eKx3On00POT6umvnumUh83a0uJj08n4o9a90ulj0Oaj0uG8"
+"we8ToOXrjumTHuVH1ONH142H04Z3UnZTzHW3Rq00nu-HJeuHJuGOR8fPR0WD1SYE2WY-j6WHj6W3sBXXyzW3vYHOx83O2uVZ0OKZ081z940RsjQ0ICZ7ECK5+hZ0wfZ0"
+"E0gAEeI4sv801OIePA371u3V3uW1i8K90uVG1uKG14qn+9OoUKAF+-J0wzJ0ISiLEyA2s1K0Ien61JhC15W-S4WHS4W3nwW4WDXVF2Gm20mDQtH0K02FVvZ2WKG0KmZS"
+"bD6Tp5X300I7Q4G0qG38o02DW43CWqICkmpBLKZJd004o0IDW8ZRb002s0oD6L204mpBo080em3Tfn6TbHcFmmpBDeG5svvi00nCW038n4WQsDB08C38n4m904ZDq2W-"
+"F2WHF208o0YCW4ZDW4JDw1908838t40A8K38pu2H1uFa0O4a0GGCraIXwz80K4JDWC38ru-71Ou71WGEWCJ9ZONh1GGCmK2i08Z-j6WVj600q4myAsQ0bD11nOZ-k6WX"
+"k602t0ICXS80se7814rE+3I0+1I0C43CWSJ9ngth10GC1891W8Z-CBWVCB02u0oC5XXTE2GGZXGCW4Z-D2WVD200v4K410fVE200n4oG+-802+8000ZadFGOOvlv3eev"
+"30GC1t12q0oCwnH0C4ZCWOJOSv-g1utg1Kqd8838netZ0WGDWSZ-E2WZE207t0IDWO38nGZUE200tao70SZ-aFWVaF04m02CWWJOgR7o24m9X+YSpVG0X401oK20+Jj1"
+"6Hj10aJOF1082Ej100JX7ulb4eeb40GCAII11Gh-ZKWYZK00nu0m9Oeb4KMeECH2+x72wv72X550s4QAsrb0DnE0uuVE2uNE2ul71ul71eZ710WC5XZVjVGeCvWLAu-g"
+"1etg10GCEm-28O38vetg10GCX1E0s4qO+Zh2sXh20KJn0vdG60GDECP2X1e-D2WTD200vaUnEA710SZ-cFWZcFG0t7KFsPr01VMmsxV71eN71mGCp0ICXAWV8BG0e4ec"
+"+7P126P10CJGbwmM8Ot710mCXKT86vlh6edh60GCEaG20OZXz802q02DXoY-F2WVF2GvkRuZ000C1LF0s4Kp+lr0sjr0+xH0+xH02vH000JPuOtE2uHRBulM3udM34w+"
+"1vZTE2W-7jWd7j00qO9w300DXfk3VcW-U4W-U4W-U4WjU400v8HMDuNi60GEbDk-opWXopW-w8W-w8WDw802s0YDEG63+1q10OJGB30EXoY-qHWUqHW-U4W-U4WDU400"
+"r4mz0aZWXO00u4m9+Zr0+Zr0+Zr06Zr0E0d26IG1Xl30quFM3O8M34Ko6gQ0XLk-f6WYf6GfGwWU9Ot7600D1XZ-HCXYHC10nKGQX8YTG2G2e0mC+V+06U+00SZ4lB10"
+"tetZ000EE046ESE5+J71sH710aZ6+IXUS4W4UcW-UrWXUr00u8fZ040j+t80As800KZ3+9X43nWTT400r4G904Z-ABWYABW39GX4+8XTG2W4USX-ELXYEL10v4ad2+X1"
+"5ue-Y9XYY910u8fZ040j+t80As80C4JCWaZ4roXUg6G0du0HHuVM8eNM80GDIw800SJn3vVtQ8OtQ4AQEaA3+bc51WI9Sul71ud710mDIgZ011c-w8WZw800qum-FuGo"
+"IetE2W0DW4Z3JgW-pkWWpkW3eZW3bYXVbiG0e4UPoii0+4w71wB0nOq90u-YNOqYNuGCK4SJwLK0Eu44E0E4oLB00OZ3vuWGc0W-q2WHq200mum49u0OKONj04W81GW-"
+"PWWUPW00n4wsEih2sv805SY3EFXC35W-T4WHT4W45dGWFOtZ08HvFu-Z0euZ000E1alX-l00u4enXKa-j6WUj600v4mZEG35svH00aJ0F6Y7+-80wz80ECL5boYUG2G0"
+"e42r+NC12MC1IaS6XDiTW4G1d4Gaoqi0+KC1jOa-OQWWOQGgj4mZsPB0Eid2Eud2wCQ5+SB01yK8yhp90u-g3Oqg300E1BSW+Otj08HlOKa9+BE3s9E31WV0dvNm642H"
+"+VK0+VK0kSK0IyZ96c0200Z-8WWc8WW-75W-75Wt7500u4Is6Mq05SI8-xt+3u-G38vG38X2K00E6Eo2M4350GZDr2W-IFWHIFW3yXXXE2W32eGea9ZG1uVZ0OKZ08XS"
+"84ELsz515SI8jw-Z0etZ04Ow6w80EuEA+t80As8004Z5FCYWhJ00o8nAQeZ26uKC6uVj0uOj0KkTEuo7s5T0IWc5X9g-mOWUmOGXAW0DWWZUF2GiGeJV3uJH100EECiA"
+"Eql8+Ve0wTe00aZ6z+WT4500v4mj+Ze0AYe00CJmLAnuhO7a0mmCW4JE1WYEAAW-rGWHrGW3tz10o4wLs1901SY3WwWCj6WFJ700p40I2P20+JB06HB0ESE5EIz2Ea-5"
+"+Bq2EAq2EKQA+f51I8x91QZ-bEWUbEW3gcW33OXVyaIul68D+3I022I00OJ0JQOn40mD1SI0HwF81e781445EaJ9szk0QWn2wut0+0l0EaBB+J31AI31Q8+3+HZ3Y8+3"
+"+BK0w9K018F0nuWsjOtG100E5g00pulZ0udZ0umpN00DEux3sv80MOU9ECp9+JL3sHL30WZ3ya20nOOd4K0AEGC3+390w190MGqC6wQ00SZ3RwG0GwVF2eNF2en8GutU"
+"c8n0F4YH+-H0wzH00aJ8i2GC2ED2Ii3C04JWuulF2OdF2qY7+f+0Ie12XTe-j6WWj6W3tPYWXRX6ya00qu-Z0utZ0GGCoKgS+vH01hTuIwls68es6umhkOu3B42g08Z-"
+"gqYXgqY3lwI8kQt15427bteC9BWHORGOxfJ-6u-n9Oqn9KWY08JeLgNj0u0dB0GCE0uDoOB0+7906590IaK3As1200J0EM2sky01+OK0Iem52P20+RB06PB0EiI7IW37"
+"+PK0M4l9oHB00OJ0A5+KoO20+JB06HB0IqV3IQ26+37DI27DEqk96Io1Mip6+V512U51bwj3UdZTG7GnK6og+NW1wLW1EyT7EgQ0ESm4+pH02oH0E8f76QE10SZ4KYY-"
+"0JWW0JW3s920u8O+D4W9ESm4o8r0+m21E8j32L20+Vt06Tt0+Bq1+Bq1+8q10GZ4mHZVxyGuavV71uO714g+XHkTuDW-GDZdGD30q8Px8uGmY4EI+N01wL01+dZ0+dZ0"
+"+aZ0ESo86kQ0Euv5+JD3AID3I03FEyHAwbZ01Bc3UCX-i6WUi6W3yhWYE2W47e00suVZ0uNZ0umNrK6l+rH00SZ5kJX-rMWWrMGONPup644NEGm2oKR1+3P1+3P1+3P1"
+"62P11wa3oNZT9BW4-dY3IFX-9BWU9BW3mgW3QcWTE2W4hl10pumjBuMZBuW1O8K90uVq1OKq1u0wtOui04W92r80+C120WJn0eJHPuli0Oai08nCsuGZledP1u0YB46E"
+"oOM0+-80Az80402CE4U2+1jHEGaHC838o0Z-3AWV3AW3VwGeg8ul48nKvu-tNeutN8nKjuWMTOth18HTNu-Z0euZ0u0phu0TuOdZ00GCIip4EWA2kCw0+tZ06rZ0EGU7"
+"XNcTE200q81Keu-Y5PuY51GDIOA2+T5I5S20num1VuF71O7714UX6YZ0E0b3+VZ0AUZ0EaUCAQyH0aJ92vWw8vF71O771KcB17jTv8W-ZgXdZgX452ImWOtZ00GCXMGO"
+"Qvl71ed71umKhO8v3uGE2v-u3euu38n1KO8o20GCE8N5X8j-MDWUMDW53OXVEZX30pY-ySWZySW3ZKX-S4W-S4GES8nLDPeJA0WCEG23Xig-7BWU7B01nCZ5M8XVRX00"
+"nu0m9u0rB9pE2uZd94Uy1mjEJza-KRWJKRW37iWV0Y00muFkLe9kLO149OODe4o7Eqy7wyS32PK0Ied81aYCj5W-65WH6500pKiH2kZ60CJ8+xFZ2u8Z2ulg3ulg3OZg"
+"3umeKO8E40GDImL2w8T0+lQ06jQ01zk3ksWTzRW3nKX3-5Y-rGWUrGW34d00p8eaw0WDX1e3iKZ-dYWTdYW3haY4kxWVR4W3MTY-eAbWeAb4raWXAGG1d8au3uJ248Xw"
+"e8a90uVN2OKN2GGCr4m06ok01WY3wGX-kBWWkB00o4mQ6290jpa-F2WWF2W3iEX3hVYWadI9nw0fA8Jk5upr14mJXSa-63XW63X3ld00numF9Pt63uG6Q4W9+dw0wbw0"
+"XP10n8HxnOtZ0uGFQ0WDIyF2+d31+b31ES23+91AQCI9s8T0+Fu06Du0+RC1+RC1sOC1XjdYKLW3lYb36-Y-f6WUf6W3TQX4pxaTu8W4UcZ37qXSzDW4k9aGc0W-H7WJ"
 );
-static sybie::datain::DataItem item7("haarcascade_frontalface_alt.xml",7,
-"Aac3twZoqJW3EIf-RQWmRQW470aTSta3BsY-qGXKqG11jGZ4Bxf3SD40n4ks4C3EIut5MQF14G3CI4pSECQJCSpCnOZcGDW3-Ke30N22n0pCEOLFIRF1oep814W-QyWX"
-"Qy00numn6vmqre6K38XCxOYJqu-YBeoYBGHBou2Dm0Z3py21m4Z3Ky40oOHLbO9K3umkrY0DrKZ3Rbd3svdbUQ0Er8JEpK3Em8JEpOJDrCJEMZ5Z08Z-a5Yna5Y319X3"
-"ReYSDaMm3BHHgulZB8aZBum9PmHEuSJErS3DnuWhW2GEUUBF0aZ3pNC0ouGhev0HSOvZB0HDmS3CmuGBk1HCtaJCpumgguCz4uFdGOCdG0GCEKM8EGu5knq0E8aAXHd-"
-"Z6WGZ601puY3fK62oCJEEKpfCKpCtGZhST13uSpDsuW4f2XDpOJEmu00eeuc6GXDt8ZDqGZ5KVA1tOZ3Inhpd6W-+1Xn+1X4FyYUfGZ4QXPmWw-f1eqf1WWCq0Z3Pbb3"
-"stA0oum90wmTtefc60mCE4aAS43CrCZDrSJDEWHSAUQ0WKJDs4JCmapDuu0rXGWCrOTTS0WC+x746x740CZ3CTZV9Vb4B7e4EiZ-f6WGf6GWpJnCoK3Dt8Z3Lde3u8gb"
-"QuX3JV90nuWwIwW3mAnRhuOf10nCmWZDn4W0CC3DsGZ3foXpCDW-a5Yna5Y3pZZ3rIYRoJW4oSX-7seI7se3fUSGS3mCEy1DC4JEv0ZhSj96sKZDm8ZCqu0uQX0CuaZd"
-"C782sCJEMmcF0KZ3jbbsbdW-12Xn12X-dgXzdgX3Y520su0vcY1DvCJErW3DUgy444pDEKEBEm794CZCUAM84CJCEaGV4SJEE86FEO9DMVu2+t746t74EKv7wby4Ea52"
-"EOW2+t742r740SZ3DWB8oCJDmKZCpG3EEqn21B90sOv1ZuGPi21Ds4pCouWV2xWIo8Px4WmCs8Z3aLB2m83DMW9FEtE1+BM8ABM8IWNlwr741KY3a8X-+1XI+119tuoC"
-"q8ZCu03EouW-qY0Cv8Zh6j20vuWCs1WCE0Y48K3Es4sWAcQ0Eay7CGZDr0Z3eR61n8Z3obbof600pulFXOiFX8Xu9e7g18Xu9u0pTuVE8OKE8GICkOJEt0ZCu0JDEa-S"
-"803EsegYBum9wYWCpSZ3yYX3iIhbxVY3Vd46nWZCuOpDmu0y9PTZSv-bxgybxwmQaOXnLv6G881wcvlg18bg10XCkGJCnu04gwmTGvGlJwQg1GmCn8Hom1GDEO990SZc"
-"HD02pKJEEiZFKWJEr8JEmuTUt0mC+x746x74E4Y4w1r0M0C6+RF1APF14qIDEqn740JEEOIiGKJDn8ZCks3C08Z4Vd44maJEvGZ38vfb6R60qu0uO3GCESyICSpCsSZs"
-"1W20puFWGOCWGeXhs8Nmw8n7IuWQ8OnH8uavY0GDQ83798Y-kFXDkFX3eM92tC3CECOkC4ZDrGZi+S10uuGJSnnDuWJCrGZDmeP650WDEyc2E8Ro0GZ3inXrCgX-wkho"
-"wkh6XnbSBdY4CUb373X-e6WGe6W3nkW5fSb3mE31oKJO2OoKw8pC2u2vRxmvv2nDtSJCmuWp-0WCQIT7E8aT8KJEmuGLQx04Rfje1uldGOidGumv94ykon8FEiCV1dh7"
-"H-ZCx4G01umRh8HLAumQIuFo184o1WGBsuY3JeD0uuGNnwWkVHmCmeARIGHDuSZCnCZ3xt13rWJDtuGMqfOCAW0DtaZ3-G13vaZCpuWb6fT7tu-nGOynG81JheNu6u-X"
-"8OsX8umRhGGCmuGpq2HDvaZCs8RCPv07Qxm+B2WCEafr443EM6k1EmggK0JCn4pCp8X85PzRh0mC+ZC4AZC4ECCKEijMszY218Y-B5YIB524ou2DsCZ3upD3vKZDoum+"
-"SB1AFO9hQ0IDpCJEpSZCnKZ3sP20ru9Y8GHCnSZDpaZ4Tp91uWZsZ2b-DkhoDkB0uu0CoedJ300EE8vAXoX--rWG-r02puoCEqlha43EtCpDq83CqGZ4XsedXT13nCpC"
-"u8nEE3GCEuKfMkK8E8xAGGZDmGJEECA2QhSh+lukElukEmnDE0qLkvq0Xna3F3X-d6WGd6W4VTX3Fb23oOJEt81jQPfI3GWCsuGkNw03U2mCEOneQQV7Ee47EGXbEWSh"
-"08JeceSoG00D+dC46dC4EWCBw9Q0Ea5I+7Q0I5Q0EOW2GWJDpa3D5J21t4JW0Af1AuGv1JGEvumyoIWDvuWrxe8E8GWCpumv1wmVBnWCsOZCEmb7E3Q0+3WCA3WCXqfU"
-"gJG1auFgB85gBuW2y8n3tHGEqu0TBuWlavWkLOvw4WGDr8Z3g7S8mXGDu8Zc+4Y4Sg12sG3CEmiHMin8EZQ0+3C463C4EyKDEurbgfE14W38EW3WUew2+Rl3kOl34GZB"
-"EW6K88JDvu0GhnGEsC3Dg2dB4KZDEquWXD81o8Z3R1iaHQ05qGZDv4JEEyT2EuJi0WZr5a10quFmGOCmG81pEfdh6AnsLu04NvVa68La6WGCm4Z3dpj3Nt71oKZ3x0bY"
-"nJ02sS3CEyW24SJDEuvT0aZ3zuYYnJ01qaJGGm1EuSpDn83DteDpw10D+pJ86pJ8Iq0WIGa4gjq0MGKhIiX7+NgG+KgGEStQ0GZ3KG22vCJDEu4r4SJCICR5Qk9E48pC"
-"EywS4SZCECBKISbaAgQ00CZ3qW61m4Z3ha52rOJEEuyCEFF1+7A4A7A4IeZMEqt7gfQ01KY3xnX-tJWItJ01tuY3eh2AvOpCr8pCmCpDtCZ4kqWbf6W37110quW9Op0E"
-"vC3DYkmeEiF6EC5F8GJDvu0riBz+T00D+p746p740WZ3T+b32dWQe600uuWNo4ez+JY4EHY4eaZCsSZCmaZDnaZCIaSCEG42Mou2KOJEp03CmumlBmmDmaZDE4FhA6r0"
-"EK3Q403EEeN8CW3DoGZsOXe-uhhouhh56-90uusf18nJEv0fGaofEz+4Q8PZ+77HA57H8qoDkumqE20EESsbOGpCvGpCtaZfA7W3Za10sum0o21Ev83EsePrP3GDEuQF"
-"4WpCE4Wm0aZ3ffgroDW-j5Ynj520tu08muWkBecS3K09Eez2cjS00aJOvcn8+FZ2kCZ2SSZBp4pCmK3DEyjc0aJOk8HsBOPb3uGYN11DtKJEp4Q204Zch910rumG+u0J"
-"RIXCuOZDr4ZrNqY-yihpyiB0mu04o4ymgnS01Rk3XTX-ToXITo11nuY35Cl3C5A3tGpDnuGdSeAT3mGEtW3CEqOIGCZCu8pDQYMhE8e9EaRI4O3DEKGfEGBvA-820KZ-"
-"A3XnA3X3xKZ4c6bQe6G0aOYyxuaF54oxEK35+ZRFAXRF4SZBESMeSO3Cm8pDmW3CEu9VggS0COZDn4Z3mjf3fS30puW2je827GWDoum7IXmDo4Z3M3E0oejYmuV5xgS5"
-"xI0EWumSI8tcS0GCMWwL0OZ-bsWLbsW4rO23sCJEouGpQ5ugAMQ3EW08GO3Dqa3DXk10tevxfu0hrWGCs8Z31D60uu0NI9Du6uFwwgCwwAnqmgdjyA1b8wGmSu-eDOqe"
-"Du0kVXGCm8Z3Wgf3djD0puGgxeue1GHCnWpCsKZ31UE3pa3DtePH300DEOUAC8ZDmGZ3Pu70mezM-uFmwgCmwwmzs4OoszZ7IqY21hh55YW-YXWAYX02puYDE8NDE4di"
-"GK3EmOJCMWCEQg354CZCECWlE87N8CJDmuWRceex4W1Dn4ZDt4JC58duto90ruVyGOSyG8X1CxG1Pe6k6K09Ee8VfSA0AuWsVuI00G2FVv3DW4pDWC384D38ou2FlybF"
-"yyYSbD6TpvZ2W8J00W2Fqb6RqL6P+03FlqW2WmpBcLMOqLdSbPpA0m7FqXcSbD7Qln6P+q2Ck0JCt8JCvSZCvSZCnK3Ds83Flan7o860qn3RbP6TVPNOiv3CkOZCtWpD"
-"s8ZCo4pCpOpCsK3FlKH7sG30C8NQdXM4rG4DsO3DoOJEmWJEsa3EtaZCyyI6Ua0s0yL6+00FTm0GW02FXqIBWGdSbL68rK38jqI6d008wa20Di28ozsRq1YRlHMPwq20"
-"8028y8r41W08WmZKK5G1VXICp0ICWC38s0IBnK2Wo8E0140CyybFnG38n0ICWO38pKm8+FQ0kCQ0OSZBuOpDo4J8xmIEpO3CuGpDbr2CmCZae60FpG3CpGJCr03EpW3E"
-"r4JEp89g1mJDoGJEtCZDv0JDmapDvOJCMZQ00OZEx5WDH7W-e6WJe606u02EW838ousf1W1EWa38o0IC+dq0Abq04HZBqSpDtC3EvW3DuO3CqSJEu4Yf0GZbc60Ds43C"
-"q4JCuWZCq03Cr4Zcc60EmWZDoKJEoGJDuSZCqa3EMRQ00SZ-c6Wmc606v0IEWC38pucf1mGCm0IEbDd-DDWGDD02ruIDXy9An0pCuSJDpa3EsGJ8cQ9J3m3DuW3DoOJD"
-"vKJEoOZCuG3EIoq0yOZCmC3DvWZCqGZCuKJDuGZrc600uulf18if1W0EWSZVc6GOlLg6+BF129F1eOZBvGZDn43Du8pC1F62s0pCcQQ008JOLWoCm0JCn8pDoGpCm8ff"
-"1WJDm4JCmapDnaZCtO3DoWZsQQ00vulf18if1GHCq02CW8ZUDDG0a4Cm+t322r32C4ZBpKJuA32Cqa3EmCJCpSZgpJ05qC3DmSJE1a35r8JDvSJCMUQ0SOZCuCJCo8pC"
-"XyA2nOJEItq04O3C+VQ06VQ0C02CW4JmxfMG80nDW038s4w6+xq02vq041ZBmGJDuW3CoK3CsCZCtOZCv8Pb6WXDr0pDva3EXuD3n0ZCtOvx4m3DsaZDoS3DvaJDu0pC"
-"uCpCMBQ004Z-Y6WnY607n0IDWG38nKZRZ6G1b0WC1KY-BDWGBDG8bIZCnK3EoKZDmOJCpSJDnefE8W1EoOJDm83E5R91qCZbb60Er83EtOJCsW3Dua3DrOJCMh324OZC"
-"+NQ02NQ00KZYa602t0ID+FQ0kDQ0q0ZCmaJDpaZDu4ZDtCJCIYq0yCZCpCpCsW3CvWpDpK3EmaZbgJ0EmS3DqSpDnaJDtCJEtGZDMZq04C38+lI32lI31tc-HQWuHQ0H"
-"ru2EqaZDt43CuG3DpCpDvG3CcY32qKJCtSZDmCJEs03CpSZCXmjZIx0DqWJEsS3CvaJCuapDrWZslJ00qu-f18yf1eef10GD1JB0Wu-SGuqSGmHDkS3DtOpCtu01GGHD"
-"nS3Du4J8c2GDIsq0yG3Co03Er0JErO3DpaJEt8ZbDD0DoGZDpOpCuS3EoK3Cn8ZrUd00suFUGeCUGWGCW4Z3GxWSIx01n8J0bu0VGaSbIr944438IGC4+Zl3EXl305ZB"
-"nKJCp43CmGpDnC3DtKpDgIt0yOpCnK3Ct8JCtW3Eq0ZDpSZaE709qa3Cr4JDq43CvuGvBGWDmOz65uldGOidG0mDXWQ8FBN1A4oprWgJC700uu-o18so1mGCka3EI4s2"
-"W43CqK3DsS3Er46cQon3qS3CoGJDvWpDnSZDuaJDM+y2qO3DvSJCr4ZCrKZDmSZD1AWoGG10sulmGOimGmHCo02CWC38quco1GGCpKAG0GZ-33XH3313jKZBouG68WIC"
-"o0ZCp0pCnSJCoOAg1WmCsKZ3Ok07vGJEoSJEtWZbuM1Cr8ZCtOJDoS3Eu4ZDoK+6EZQ0+JC46JC48G38n4imojc40GJOovlnG8bnGGKCk8ZDs8ZDva3DqO3Cu8JCnKZf"
-"d60Dr4ZDs43CmWJDvO3Do0Z3nsWYDY0EpWpDtOJCu0JCqWJCoGpDQdH1+NC4ANC4G838t02D2Qk10WZ3WsGpb30F+BG6g8G60PZBoaJCvG3DmOpDv8JDo43DIOC4MUF1"
-"uSpCtK3EvGJCuW3Eu0JEouPRI0ZCpW3DtWJCuCpDqOpCMF150SZ-63Xn6312u0IC1UlSEY00v40904Z32mW-73XF7316suoDpO3CnumrJGGEquGS88XkLOf9FG0DquGI"
-"K0XDn43Em469QEO3qGJErK3ErSJEv8JCt8ZCQVQ0+lC46lC4M0s5oPQ0Q0s508Z-TQWITQ0Gnu2Cr8pCqK3Cp83EmCpDnGZgxM15rapDsCJEE8p5G03Dn0pDQ+W2qWJD"
-"vK3Ep0pDvWJCqaJCMtg60SZ-D3XnD3X3FG10pOtf14Yo+pq0Inq0Eqg6u8JCs8pCuWJEpKZDuKJCs4CdMsq0uKJErKJEpaZCv8JEmSpDnOvG8W3Dpa3EvC3CvOZDuK3D"
-"maZrG310tuFqGeCqGu-w98-w90HCk4pDqumnGW0DqCZ3gE10tuQJ3umTQG2Eu83CrKZCu8JDMIF1OGZDmK3CrWZ3L-10muWSU8DND0mD+3D463D4EqA4w5v20OZ-GkWN"
-"Gk0BruYCqKpDqCpDuK3CXKNQCP9G8WJDmGJEnaJCn4pDoWZDsWZbF31Doa3DnKpDt4pCsKJCsKZ3xaXoFk00tu-pGOypGG0DWuG9X0WCwXJ300J0c0WDEao3I842EDm3"
-"CG38nOJ7Z00F+tW2gqW240ZBEWi3eCJEt83CoOpDmKpDMIH1u8JDr0JCtS3Et8JCu0JEpOPR3WIDo43ErWZDv8JCsu0GK0GDMts0+dC46dC4I884wHU50WJ86xGQXuF2"
-"A842A0nDkCpDvuG88mHDna3Eo0ZDv81SIOvf1W3Dq83DuOJCmSpCqapCvKZcka12qa3CEal3SCJDrGZCoapDMVQ0+RA4ARA400Z3Ck02p02EoTA4bzMexasR+pq0zn43"
-"nu2DouGXN0GEEqz4CaJDtWZgOr09rCJCvKJCq8pDqu07U0WDMcQ0aG3Cu4pCrKJEoaZ3OrWtGDW-d2Xnd2X4Or00qO7g1K09XkJAdwa55aooPGY-B7GFBpGBou2DIqr2"
-"C0JDq0Z3zUXhMl07q03EtOJDv4Z3AY01vOZ3sVYYC31Dr8pCuaJDm8JDoKpCoaZ3+YWpaRW-C3XoC312m02EIya4gLU5C4JCWWZ4nUX-SKWGSK0Ij4ZBo4ZDr8JEvW3D"
-"vK3EqOJEvu0sBe9Z80ZDtGJDtaJCqCJDoGJCEyZ4AYQ0Xo19mKZCvW3CuaJEuejVD00E+pC46pC40aZ3tFX3lcYQe600vuWwVuGGKa6T+3r0k0r044ZBEqw7eW3CvGJE"
-"v43DqKJDIqC4MYQ0uGJCoa3DoK3EuCZCvCJCrO9DAWGDoKZ3-316nS3EpOpDsuGjDeCK300E+tC46tC4+3r0s3r00PZBna3DoSpCvGJCo43EuKpCIm62MUQ0GK3Cs0JC"
-"Eeg4KGpDn8ZCnOv4AGmDpuWrBmnCoC3CsOpDnu01Yuyf1uVpGOSpG0mD6QF1Eu2AEej6+NF1ELF1eOZDmSJCsaJDoSJDEitAg2H60KZ3Xp28p8JCpaZCmKJEE0B9EMF1"
-"GKJEsCZDEqo6CKJDsGZ37fWpc6W-D3XnD3X6QC20n8NkQ0GDEitA8K38tulz4eaz4uGNDWmDp4Z3Xc25o83CoGZCQI-784pDqu0xEG1Cp83DqSZcby02rC3CEywAO0ZD"
-"oaJDm4ZsbT10uuloGOioGu0DD0WCEax2gbf11GY3mQIoOw43AuGhmaX8+hh1seh1uK3EqKJDt03CnGpDuapDm8HlX0mCIsR8GKZDnK3EEinBK43Dr0JDmOP9Um0Dr4JE"
-"EKR3K8JEoWpCveT9U00E+xE46xE4EmE4EKj6ov771KIPMw-558r550JDr43DtCJEtWJEmO3EooW24G3CEe478S3CnuW4AGmDtePammoCs0pDuKJCoOZDuOZtaN10uuFq"
-"GOCqGumVSeNamWmCWSZ4AeW-zQWGzQ0Gpu2EqGZDrK3EtKJDu8ZCqWZ4YXWcE314pGpDoaZ3iA10vu0hpOPYNWIDqC3CqGZCma3DuumDg0WDIxC40WZ-E3XoE3X3ZuXU"
-"c600nuG-fuFpV85pV4ykm43DsSZCoKJEu03CnCZ3LKZYdS3DnOJDvC3Cqa3DsOZDmaZ3tZXYVX03r43DsuGHKmWDqKpDEaVDMFQ0+ZC46ZC400Z3kBYTmJ02m0ID+7Q0"
-"M5Q0GWZBnO3CEyE604Z33M32rWpCI4j6MUf1aGJEs43Ena3Cr8Z3zw20oOPRImGCuW3DEuf40KZ3gKYtUu10uuVeGeSeGWmCWKZ4ySXQWX01nOJBdQMO80GCE862XjM2"
-"ZulO8eYO8mGCk4JCEKC4KapDt83DtuGbBOwmGW3DuO3EoOpCv03CoSJEvaZbqrGOiX1EnOJCs4JCEWD2M-s00aZ-33Xn3312q0ICQOC4gjS00WJ0bumcwulk68ak6WIB"
-"tuYCs0pCtS3Cru0XcWmCvOZgf6W30T39p8JDn8ZCuCpCoe9nGG1Dsa3CpSZ3oZZ3YYY3caZotr00vuFnGeCnG8XehuGcLeMg14G9EyY208Z-IDWHIDW3+M1CmGZDqC3C"
-"nWJEs83EnOXRIOPP8mJDrSJDm03CmGpDsWpCt4ZDMEwAq03Ds03Dq0JDnO3Dt43EMN620aZ-73Xn7310puXyJeMg10mCEq77+dC4MbC4G8ZBpC3D1h80mu0ZcWGEvaJn"
-"5R9g1W3Dn4JDtOZCn43Dr83DuGZbSr02r8JDEaiEO8ZDtKJDr8Z30sYpIDW-93Xn93X3GxY32uXS93H2bu-sQ8rsQGHDkKpDpOZ42j05mSJDsaJDIOx2Qw62qSpCm0pD"
-"oaJCrKJDq03DMME9OKZDv0JCm0Z3At02t0JCE0XAEdQ0+xC4IxC4EC3A443Cw9r000JOI10C+Ng16Lg1y0ZBmC3Cs8pCtOJEpWpDs0Z3TdWYtkW3Ow29uWZDuSpCoGJD"
-"oevpV0HCtG3CmuGRIGGEp4e+M-y70aZ-f2Xof210o8nD1P7J340904Z3bkY4L6Y-ldWAld03vuYCmu0va02EuWJDtCZCuWZ4ogXbqJ0DrCpDo4JCtSJDtSJEt8ZcqJ03"
-"qCJDqu0gXG1CtK3CrSZst440vulfGOifG0WD6QQ0EOu5+NQ0ILQ0iq2DkCJDr0pDpa3CsuGNkGWDsKOyM+R5aKpCsO3EuC3EtCZ3q5Y3KZXY4yW3S31Bp4ZDv83CtKpD"
-"oa3DIJm30aZ-d2Xod2X4G5YUTCI2bulMSObMSGXDkO3Dr8Z33a30uumunG0EqeQ3PmoCqCJDr43EnGJDrOZ3nhXaid06r4ZDmKpCpuG0vWmDpKZsFM30vulhGOihG0GD"
-"DFdRQQG8fAn2Fu-z48qz4u0b-0mCES178a3EvumwEumLauOc6GmDsuWfm00CEK7CECNDIAQ0EK25KOJDoWJEouGFl0mCMNTA0aZ-h2Xoh210m81X4Pdok0GCIeP5+hiB"
-"AfiBS8ZBoCpCnSZDEeB9K4JDuWJDrOAYGGGDm8ncVGGEqu0381mCEK72AEF14KZD1077n83CmSJDo8ZsMn11n0Z-92Xn92X3G9X3MbaQrq02u0YDIqkB+R842P84KCZB"
-"nWZCvuWeVGGDruWji0mDgonIOG3CnO3Cv8Z3k912m4JC1xiZc603naZCnu0HXG1Dr8ZDpOZrEW21n0Z-62Xn6210v81G88NJ3u0Smu0NSulx48ax4GKBnu2Em8pDtGJE"
-"p83Cm8ZDqWJ9dQfv9G1DmW3Ep4Z3pz14tGJDn4Zcnq0Cq4pDv4JEtK3DvWJCveD3eGGCmu-WGOyWG0WCEGBEIqj3gzq05KY3ePIAg2W2EGeJk400E0fJIa82PGY-pkWA"
-"pkW31g39vC3DsWJEqGpDouGnsew6500DE4p3WSpDmaZDuGpCtufCtWWCqCZ3fI44sC3EvaZt1g31n0Z-f2Xof2X3SnXUqt30nOHNSunsu8Lp1OnVD4n8+pS0zmC3nuYC"
-"tumJ1nGEt8ZCEaO500Z4p9XcA318v4pCoWZCva3CE4Z208ZbPEW37646m43Cu4ZCtuWHqOzm9HGCmu-oGOyoGGGEWuGgV0mCkTv00aZ4PbX-C-XIC-1BquoCpWJDp8ZC"
-"o0JDXaA0peQrBmGDmCJCEO47K83Cma3Do4ISAQk1C8JEqSJOYJXDs4pCmWZsm911n0Z-D3XnD310veuCAumLAu-Lt8rLt00EE4L5EaxHSKJEs4ZCpOJEkYH14a3DIaQ8"
-"0GZ39310ouGIheuf10WDEKE98OJEnuGSvG0EuumkLfy5KGGCmuVpGOSpGuGVD00EECuAgLk1EGe9EWZ29Jk-qJGdqZIBvu2DoOZDpKZCo4yW443DMakGMw82SKpCoWpC"
-"sOpDI4eH08ZcEd44q83ErOZ3Lq42r8pDEqs5IxC4443C+-C4A-C4EuY762i1EyQD+tf1Irf10CZ38H28s03Cv03EtWZDssf1aaJCr8JDn4pCrWZ3wtZagy01raZ3iS50"
-"n8HvXGmCtuWN81WSYyBMY6AM443C+tC4EtC41tfSTlW3csW-TlWKTlW3vRb3Pba3Ar04pWZCnCZ4eFZbED0CqKpDpK3Cq0pCmS3Cq81nMfez4GHDuK3DqWZ3+R51s4Z3"
-"JnWsEDW-H3XoH3X34uXUYC21n8Z4n9X-5XWI5X05nuoCpO3CE0+EC0ZDuWZ3ySZfH3X3Ft17pK3EvSJCn4Z3OHXbED00uumg91YCmSJCrSJCpKZrGI40nu0FQuFyRfBy"
-"R9Hgwe7nL81BI56K+FD42DD4mqYDk0JEsSJDqW3Cr4J8310Cg6r04CJEEek6SWJEm8JCuSpCUw5708Z3I931p0Z3qT51o0Z3RRYptJ00nuFrGOCrGuVK3OVK3u0iVGXD"
-"rOpDu0Z3W212nKpDMmh60CZbCqI0sGWCmuWQBnmDn4JEM2g1qG3EvWpCrS3CvCpCpGJCQph644JC+RD46RD4EmLLwbF1EqzKE4b9+3r021r044ZBE0-EaC3Dm4pDra3E"
-"s8Z5nmZbc607qCJDn8JCmWZ3m230m8nK9v8e6G1Dt03CpaZ37622sO3DE4FEI-q0+xA46xA40aZ3R830oe7wW91MIO2lQuqhGWGEW4Z5lqY-xkWGxk0GouICv8pCpKJE"
-"m4pDu4JEnOZgl210rummS0WDESK8EeN8Qgd4WC3Eq8JEmCJEtu0HF00CUNv5E8tC+Ji1wIi1I4uF22cHE08C1hk-M-XFM-10ruGLh01Es43Et8HTJ1GC9FibqD05r0JC"
-"u4pCE018Eu1NQEi1G83EoSJCESyI1pF0sejSc0GCEyVM+ZQ0wYQ0ESb4EiC9gbm3QSdM+l5PEj5Pi0ZBmSJDpO3Eu8JCsu05mGGCo8Pl6GHCo8JDmSZ3WZ33tOpCveve"
-"1GHDnG3Eu8Z36XY31bb3K9ZqNKW-j2Xpj2X3yqWS+Nc3v1JevuVI38KI3umCtWGDnCZ3jt16p4pCtWpDr8Pe1G0DtumkSWWDuSZ43p40sO9mpGnDm8JDqGZ3nS33tC3E"
-"o4Q8I7Q0+RA4IRA4IyjLo1m318Y39qY-e2XIe219j8ZBvCJDuKJEvuGazuG4P8nMDOvg1uGapGIDp83CvS3EnO3DE457AE62qGZDrO3CuO3Es83CuSZCYlL3+dA46dA4"
-"EugO04J05e6y4eXCeuVg1uKg1WGDkWZ3YG41n0Z38y03qSJEn8BYSmmCn03DEmRA0GZ31wYbok09r4JEm4JCvS3Dpu02+uGo49DL3uFhGeChG0mC+Jr0kJr0bH50s4CN"
-"KK3Cu0pDnuGgLeww9G0DpuGOQ0WDECrIE4KJ0GZbl219nOJCtSJCnS3EouGa1PzScGGCouFWXuCWX0mD+HQ5Emq5EGhBM4v2EHx2Ey5AP8Y-kTXBkT15nuoCu03DE02H"
-"CSZDqSZ382Zfu911s8Z3bd41vaZ3T-31q0ZdYd24saJDr4Z3vT32sKZCU-jO44ZC+-C4A-C4Mus50SZRTKG1auGzaaoo+dQ0zaA6nuYCp4pCouWRzuWfzG0Dp8XYhe9j"
-"Bu0bBvWdVu0G80GDQUbM0GZ36J48p4JCpa3CuSZDEy+KEpH108Z-E3XnE310seu650WDMmL3+Ni1ELi1G4ZBqO3DE0k80WZ3Jk51oaZ5TrWckX00ouWP8m0CoaJCEGlG"
-"0WZbYS31q8Z3ml02p03CEqkG483EQ7t508Z-H3XnH311n4Z4fsbTHDW3YFLOHvFlB84lBuWNDmGCoWJCEW+HEed44W3DMsq0W8JDu83Cv83EuuWuT1WDEO+4AAX2OKJC"
-"taJEp8Z4fTX3gi10yOTJ3uFMXOCMXuWx90WCE8F9+9X2E0i9IWA4Ezh104Z4tKI5Zu-55qx5E8O3483EEmQK0aZ35D70uuGJD8fghGnDuOJEp0Z3--62pS3EMwY20SZ3"
-"GY24sGZCrGZ3XD40meTNe0WC+VN86VN8+ds0sds0KWZBoC3Cru0Z4vWW2HWDoOH4XPfWSGJDpG3CvaZCo4ZCoaJDruG7jeOR3m0DsSJCEWQ8CG3CsGZ3HyasjDW-B3Xn"
-"B3X35Sb3lPYQiDW38wc-FKWKFKW3gX71oSZ3-Q31m0Z31tX3KUaZ9D03vOJDtuG3XHHDuS3EqGZboQ04nGpDoCZ3v025r43Eo8ZDUxG1+lC4AlC404JeBumwWfse1aG9"
-"0GZ-FMZJFMJmq2GDEGeTCKJCmCZ3qaH8nfef10WDE0YK4a3DEinGEioBUcGOE0oGW8JCqGJEsOJCoujf1ulnGOinGuOf10GDXai-a6WKa6GO9HHDtSJDoSZ34M11mKZ3"
-"UKZYZ601qKZ3Zd23m0pCouGaGevedvG7UHmCsuGgom0En03DUZr508Z-03Xq03X3JCYTxdW3mrGWiR1M8uVD8eID84sHC43Er0Z3MT10tu0bVuG+tf8f1umVsHmDq8XA"
-"VXmCn0ZcMu14r4pCtaZ3XL55oOJDtSpDQVq00CZ-v2Xpv2XWZ6W3AIa-Y6WKY603ou2DsumAu10CEKr5CWpDr4Z4b5YbXk02r43DEeTKE0IV88JCsuGrJe8D842fCG3C"
-"u0JO7v0kDODD80mC+R94AR94IKOAEyi3kDf1QK1N+V3KAT3K40ZBEKyJE4QH4S3CEaa4EeOPAkq0E0uKaO3DuaJCu4JDnWZ3fhaYb600suW+GGmCpuWuEvGgoezia0mC"
-"+F94IF94EaK3oLSF0OZ3njY3Ju10o8nHDu-x4uox4GZCk4ZDqWJDm03DtW3DtuWqlv0vJevaGWHCvKpCuWJCEyFB4W3EUkaW40JC1q20u8nUmHmDpuTg1u-aGeyaG00D"
-"Q4BEkrq0Eq0N+tO5IrO548ZBEGGQeaJEm4JDo0ZDma3EkMr58aZDo8nFk1HCoGZCpumTYfOK3mGDvK3DE4AWK4pCrCJCquWg8uCvJ0mC+V94EV9404Z3pkdSstX3sAa3"
-"C3OQGvqbGWGEWGJ7YulS3uYS3uG1AmYDsC3Dua3Cu0JEsKZ34baYMK06pSJDtapCp4CY8aZDpevbGWGDnSZ3Pu17uOpDvGZCu4ZtjDW-N2XoN2X-jDWyjD0Cj8ZBuWJE"
-"vGpDmC3DqumwZ1WCgAr5GOZDoG3CE8-7G4JDqSJDE4WUEws0G0JDt4pDEWcUCSpCp0Z3D3XqkDW-O2XnO2X3xxdVZX00muWTN81Ktu-l6upl6uW1ZmXDtWpCoOZCnuWe"
-"w4yJAoq0eGpDvKpDvO3Et4JCEi1NMMM8E0mL0SZ3QB84vG3DqWZ3gaXqZ6W-Q2XoQ2X3P810pumG8uck600EIOMQ04Z-G+ZIG+37puIEnS3CsSZ3bT80s4uZgc7MCGJE"
-"pSZ3aJ26oKpCtSZDrefALXmDnaZ3R775rG3DtOJEUJmD0CZ-U2XnU2HOD1GCEe-EgbQ0IGmDEOeO+RF6IPF6EKEDEiMAGC3CuC3DEKJAAwq0C0JDpWZ3F285mS3Eq43C"
-"EyJIA6F1CGJEqCZ3VcY4s750pez4GHGCpu-dGOydGuGYLumZa87O881bVu03Auly4eay4mGDq0pCE4MPC43DpWZ3TgXaNP28r4ZCvSpDq8JCEOVFUIDOW4JCqCpCpWJE"
-"tumgS0GD1vWpoJ00qu-dGOydG00CIq37EuoB04JnovKu9uGOS8XfzvFI384I3GXCkaJDn0Z3dp06n8pDp8JEpuQJwGIDoWpCqCJEtKJD1O00sO90Z0XDvWJDtuGg8mmC"
-"t4pCEa2FIZQ0+7A4A7A4EisUwPD6IWfWEaa4+ZQ02XQ04CZBEGA9IyWO8C3CpuGhevm+EePIIWnCrSpDoO3EEq2F48ZDQEL30GZ4RF34maZCsKZ39IarFV41nGZ-a2Xn"
-"a2X55IYSbc20ruW5yuVDX8LDX00DEWcJ0SZ4kq51qKZ3KfX4-WWcam10vum6c0WCEuMA8KZCvu0C7wuc6uWu2w0eFIXCuS3CsCZsMM10quleG8jeG00D2EfB98Y-ddWK"
-"dd06p0JDn0JDm4s5EWMNgwY98KZCtu0A19Hsfu0nx8vz4G3DpWZCmGZCuW3Du8ZDseDmCHGCquleGOieG4sJEa-9gvf1Xza3AE30oKCm+-74gy748GZBtuGkx0WDEONU"
-"C03Cq8Z5rFebEDW3TW59r83EmGJCpOZCtumJXeeJ3umbEvWSTnWDrOZCE09MMxp50GZ-32Xn32X3zSX3NteQc6W3Aed3Via-RQWGRQW3b8HW220EEqS70KZ3c8cbV730"
-"t8nASWHDu4pDv0JEUYrKGK3CuapCEqrSKKJDpS3DneDv010D+p746p74Em9E8O38nuce1u0VYvFxxO5xxGWCk8XUPYGEmaZ4UG91oKZgZ8X3iX09qCJDv0JDqKZDruGN"
-"cuOI3G0CruW5ou0nCXGEvCZ3IjYqcdW-02Xo02X3cd00sOduO0GCESL3c8E6I5x21yH04uF558455WGDkWZ3eb93oa3CvuGhxHWCsegKS01DuKpDnuGCTHnDtK3Ct0Zb"
-"O7b3AN19m83DuapDrSJDpuGeHAzo1uVeGOSeGumSuuGVG8t2AuGdn1GCEam8+VH1ITH1ECwHGSJDnaZCEOKSE4iDAAA44GpCEeO3Emma4O3CEqC6I+52GKpCu0ZDEmF6"
-"Q0pVQdh1+BA46BA4XHY37lZSb6W36Gc5QUc-YXWFYX02muICEutW0aZ38160tuGlJOPN8WHDnaZDnS3CEGRF8C3EpevgBum2JwmyEumdsHmCvu0r7vSI30GD+BA46BA4"
-"0KZ349X3ecfQUX00ru0rWvG1Au-e1eqe1G0CnuWuXvGWJnGEmKJEEarZEUq0mSpCrSJDt4JCoK3Cp0Z3ugXYtQ00sumRAGYCsWpCsCJEr8ZDQBNA0KZ-T2XoT2X8myZQ"
-"a6G0bum4Bvlz5faz5vGa5YYDmGZCqaJDqOpCmu0I2gAeGm0Eo8JEE4hIEinc0WZ3BWYYh600quGaTn0CoaJDEO-44OZCQx2C0KZ-W2XnW210p4cJwPgG0CJOEv-f29rf"
-"2vGkRXmDs8Z3rIb3j+60neRxAnHEna3Ev4pCruWdLOfc60WCEGMV0CZ3u280mumDzfzKD0GD+7A4+7A4+7A4+6A4EKL3EC8d84JCpuWHXmGEq03EIop54GpDI8I3O4JC"
-"raJEtCZ3WqWYCD04r8ZDoaZ3O0d3A910v4MWIhf1+t946t94EmWRwTDGESg6EaZJ+Zf12Xf14KZBE064I0-6EOl34aJCIi+4QAP580ZDvO13U8nIuP9rT81dMXGCuWZ4"
-"poc4Ikdqc6W-T2XnT2X4jn40qONrK1GCEWDGEapF+ZQ02XQ044ZBEua6I4aLG4JDm4JDoIxR0WZ3uT67paJCt8pDqGZ3M4aZED03s4JEmuWke2HCpCpCv8kc6u-eGOye"
-"GG0DWuGfG0mCkD42E4P5+RQ0IPQ0Ea6940pDECmNEiAOE8sRY+E10SZ38a45oG3CrWJDMcq0KOpDu8pCmu0V211EsCpCqezsOuFrcgCrcA1+W4MAkLU2Mq9g+Jp5AHp5"
-"K8ZBuOJDquWtO00CEaQ948pCk6F1iC3CrGZDnW3EpK3Dq8nmBeOI3u0599XZHIGEsuGOJfTnP1GD+h746h74E8F8E8v9kTQ0EOz908Z3H3c-JxWFJxG8dIXDpGZCuaZ3"
-"5XA1raZhEt80qum2GnnDv43CuWJCm8HEzfuf1GHDrCJEpKZ3R363sa3CmuWLI8Dc6uFVGOCVGuWE84cBgTQ01CY4m4d-c6WFc604jKZBnaZ3MA72m4JDESJ30OZi8F10"
-"numWIIGEuuWGCw0zWOv8IG0Dp8XGMI1DoSpDpGZ34Fgpd6W-NRgoNRg3T6J84Atf1umunuX1-uKaLuG8Pu0NNuVo18Ko1GHDkCpDpaZ3ipY4dA90nuQl320DESKAEiz9"
-"8WpDnumBh89o10WDEGnI4KpDEyd44aJDIanaIZS0+JA4IJA4XOgSWX00numhB42g+VW22TW2I4L3CGZDq4Z37X80uuGgqP9Mb2WCEWhi8O3DmumeGGWCrefcqPHv5nnD"
-"nC3Et43CmuWiI8Df1uVdGOSdGu0AEvWTHf6R3umVWvGFXule1Oae10GCEaga88JDuuGoiG0Cnu0glv0HI0GDIcW2GKpCpSpCEGnIX470uumMheek6W1Doa3EuCZDEGOS"
-"EqIDQdW20OZ-S2XnS2X40ifUnq50vu0h05sI+FF12DF1EqueEaH30OZ3aG73rWJEvO1glPvENu0vPvG0THGCnuGc51WDQMZ90KZ3R3B1t0Z3lKZ38FZrVZX-2Sgo2SA0"
-"m8HPz8ty4uGXow-KD8sKDGWDvumR0X0CrSZ3ugccJr02vGJDEKnZ0SZ3tA71mCZb6p29mSpCuW3CmSZDqu01swz8YvV-cgS-cwmoTu078eMy4uGDXu0wiuFI3O4I3u0E"
-"s9n5d10DEWgP4CJD1AeYRZ19t03CrK3Cv4pCuu0PK20CMU32OGJEtSJDv4Z3n163r0ZCqezsOuVqcgSqcw0-guNaV8nGhu1ryvq-9u0GAumQSuFn184n10WCEaIAEOZ6"
-"4WpDE47d04Zh0-61qGZ3wEg4dlZ3mfXd7l02tSZDEyYZ08Z3gMXtpnc-FRgpFRg3Q5Y-0jYu0j23jaZBsuWfwwWcnuG1w00CoIh1SSJCq0JEuWpDEaF408Z3n8XYTX01"
-"rCZ30GX41Q20mu0rNgDj6ullGOilG0GEECbG6s52EK1AU8N3+J-9gG-9G4ZBsCJEEOF60CZ3Tc52uOJCIa47Qo524CpCEmblE0WHE0w7Mw05GKpCq8ZCEq6CG4ZDvO3D"
-"UdEB+7jfE7jfEKOU0OZ3eJbQzQ02n438E4x20KZ-wJWHwJGm+wG20wmH82HCsKpCuu0Tvfel6mWCsG3DEWTZ00Z3+MB0suGRQuOJ30WCIaRPEGJ68KZCtuD7E1mD+pJ8"
-"6pJ8Iunc04ZUuI70mumgBumP5wlf1Oaf1W0EkSZ34N43m8pDmuWoNHWCq8X+dOvJ3GGDouGMr0IEu8pCvKJCt8ZbTna3Xz00tumXaWWCp0Z3bPhrtJ00tu-dGOydGum+"
-"Eu09heMJ3uGtqvW2Au-+EOq+Eum-D1mDEOcDEaSJ0GZ3CJZasx00sumyxGYCr8pDmW3DpK3CQsK3O0JCuWJCnWZ36g31tKZt8M60tuVdGOSdGumJqgNG80GDIaXE0SZ-"
-"Y6WHY600su0uw1mDEute8K3DvuW3IewIP2HDmK3CquW280XDqKJDp4OlAAF14CJDX5h3eO21t8Z3gchs8DW-S2XnS2X3ErW4lxgQ9DW6dF10sq8y0eWBMPN01G0FVv0H"
-"Pu0X84n8+B62g862Xn60puGO01mCEKrjE4vlIos0Eu3J0CZ3uxg3NYZ4YybY6701saZ3G345t03DpaJCEaSFQRS0+hL8EhL8EW67obUHMqN8UON3+7Q0z4QeEGHCnO3D"
-"qaZ3jH53uWZDqOfe1GmCpuWzvH0CmuGZGGGCqe9K5w07dwW-Yum74IWCouDWz0mD+RL86RL80WZ3aOYUM520uumoBuVNI8MNIGHDtO3Dp0Z39wY3RAYc5D04v4JDvWZ3"
-"dT92t83D1pdY5D00tu0JEXHDpWpDv4ZDE4kSQNq0+7L867L8ESAGw5h10aZ-nQWNnQW3Hqb3TJC8taZDs8pCrWpDkgCGE8O30SZ3Kt10tu0o6wfo0XGCs0Z3zi41tOZ3"
-"P2e3MvaprZX-3Rgo3Rg3wdW31leTnQW3wiY-eThJeTB6uuICr8ZCpumM8GGEquWWE8XM8efeB0ZDoWJEn4ZCrOpDv0JCQ+q00GZ34Wd4n861tWZ3h6dsFDW-P2XnP210"
-"u81jo97b64ooESn3+Bw269w2yOZBm0ZDs8pDo8pDnSJEt0JQFfvf101ErCJDvuGGHvmivvPdQWGDr0Z3q9h3TT61qSZ3eyWqFDW-N5YnN520t8naf8dwsumaGumcQu-f"
-"18qf1G0Dku0xxwmZNXHDoaZCq03EkwZ488pDnOXcGGWCuuWjC9fZV0HDqGpCruWsP11Dma3Cru011vif1u-ccgycc2mDESeBEaZLgPF15GY36kW5tSXJdkW8jGH2Zul1"
-"AeY1AGWCku0w-YmCt0Z3CT63n83Et8HxFP96F0HDnGpCnu0VD2XCn0JDtuGi5fuP8GmCu4yk8OJEoumrA2mDE82KIlS0+hB46hB4EKqPXeiScNa3w7Z66aX4CJYJD7G0"
-"9vmrLu-Z3xqZ3J1EkaZCs4Z3ZO26u8pDpOJEs8HYIOvp1uWdrmGDm8ZCE4ujEKYAIgv0EuLa0SZ3vgc3ag01rGZsdR00uu-vGOyvGO1OFA7KlAHv17Cwfmi-sDGVs91V"
-"D0nCv4JEvu0BIZWDm0Z3YkgZMN12rWpCEWEYSaZDqCpDmSpCIEQ0ECsF4CZDE4nn0OZ3-qdsKoX-ZRgoZRg42mZ3kKeQzKW4ApKEaA5S3u0sSan8+VS0zSC1nuY33fi3"
-"Gf06uSJCoCZCvegR3uW9yu0N-uGq3IGEreP0WmGDrO3CEmyFCOZDsaZ3cLYrLf00uuVwGOSwGu0cbfdo14m8vOgJ97W3+mG6YuFo1q3oeqYCkS3Dq4ZDoaZCEeeV4GpC"
-"k+Fd4KJEEmD90GZ3P6Y3Q4hcfIa3G8g3oA15sO3EmGJDUVJ1+3H463H4EqLG04ZUG4X39GZ3Gqa-vfWHvfGfuGWDouWcW11Cu0JDp8H0Hg8E50nCnOpCmumiMv0Yc8AE"
-"5uG-NoGEr4JDEOb5Utbb04Z-4Sgo4SA1t0Y39Rb3izdPipa4rfW3pyb-SRWGSRW3WZ84p4JEu0Z39PY3xSe40Ddb3Y08r0ZDn8ZCq43CIS0aEiK9EAb2E4nqOS3EvapC"
-"vWZ3d2isLKW-6Can6C40v4c9Ea-2gXQ0IWhiEKS3+ZQ02XQ0I0spEuNk8WpDsuWewOnFQPvQFG0DtuW2HmnDuOJDsKpDuuf4Ru0Xg2nDtS3Drum5Vwml69j+Bul4HOi4"
-"HGmDWuGRFutAAu0v210D+VQ06TQ0CqYCk8Z3xv78r03DsCJEu03DogrD08Z3OeC4n0ZCs0J8r1mDM2Z2OCpDqSpDp4Z3H0f3-3ZsGDW-J4XnJ4X5mmeSWsW4JlY3NuZ-"
-"FDWGFD02ouoCEGQ8EOcL40JEEiAYgAZH1Bc36g63mWJCmu0Jg8vf1G0Dsum2du0AkH0CtumguPzf1uFxcgCxc2mDEmVMXGeQtJGpVw-G8eqG801EkSZDtuWCnnXDqCpC"
-"mG3Eo81lIOvd6m0Dt8ZDE0TPC0pDtKZ3spaae601sSZ40A31tWZ3ltWu-z80vuVyGOSyGOXGMAtC6LsJ+xf1Ivf15Ul3LEA2m4pDE4XR4G3CbWgcVQ07o8JEnSpCmOZ3"
-"-a30uuv9F00DEWiJEa2D0CZ483jsGDW-A3XnA3X3aZZ4GgZQGDW3tkW3NkW-BOXGBO15jSZBqCpCE4cnG83Ct8pDEW5TEyaCM2r0EKhO8W3Emu0Sc0WCMeTRA+U20GZ3"
-"vO43tCJEtumdo20EE4xP08doOt80vu-iXOyiXu0k79XIsf6g1uWbI0WDEeWKIu35+Fk3sCk30CZ3kl81q0Z32+82nCpDoEk3Ey1c4CZDEqcOEOvKMADJE0wm483D1t90"
-"ouWMVvDK3uFhGOChGu0pfuWqCP7g1uGNPu-d6eqd6uWVdH0Cq8XHNpGDmOZCEi4Kc2r04CpDIOSwEK1rE42AMYQ0KKJCuS3CuuGdlAHpI0WDQZF1+l846l84EyU22wJ3"
-"XLd-zCYIzC24quYDmCZ3RkA2o4ZDEeDf0aZ4kdWcUQ00suGNnvWuU2mDE8HBQMS50SZ3E1g3bQY3yhetyT60vuldXOidXumYGuWW-eMz48Xxg5cT+RF12PF1E4CqIaOI"
-"GSJEmC3EESbTcsq0Eiyj08Z3RNZ3nNf4jVkYTQ06rO3CnS3CnuGKi2GDEGqDQtq0+p846p8416l5vgXRf6W4EKY3mdW-8XWG8X01uuY39L62u43EECorGGZDoGpCXegb"
-"HDW3jBa3vIi3sW72qKJEMUv2Ii2AESL9G4JCuOJDU3aH+pkfApkf0SZ37xY3soaQf600u409+-3FIz3F0CZ3vH90quWPR1HCmGJEtOR-XYGDsGZ3-V96n0pDv4pDtev+"
-"VuWAN0mCESdo04Z6fEbqldW-E2XnE2X6kJiS9DY6+Wi-nJYJnJ22nu2DEOcdESZ4EmKr4S3EkYaHGS3DtCpDE8mp8GZDtegg32WCEqzKKWJDpO3DruWV3hSg10WC+Flf"
-"AFlfQm64oXZ4I8uZE8+4+dF12bF18CZBmuGy0HWCmumM-uWfGBXI8O9GD8XMS3IEsWZCp4ZCm4ZcELg3be01u4JO-wW8v2mCM-o508Z-rRgorRg-HDWzHD01ruY3nI27"
-"tGJCq4JDv4Z3OsMmXg9g100CEGSDC4pDv8Z5gvfbu815nKJCr8pDEa1S8OZDrejK52WC+RlfARlfEGi3EiQ70qYP+fX50Xi-tJWJtJ01ruY3KK80ruGGt20DEKPh0KZh"
-"ed21paZ3tBE3oGJDsuGpGefoTGnCv0pDr4Z3t6g3eUcrod00ou-pcgypcwW9SeNpW9H0ZuGc-ulz48az4umClwmazu0Ge0GEEOS408ZaPx20ru0tCvWEO1HDsCZCpumH"
-"Qf8bBGWCmuGpdvWVX3GEE4m8Mps708Z-cQgocQg4kXbUxo90mu0emulaB8baBuGROHmDv4s200Z4fw00tO16aPfy40nCv03DsumGVH0Cmum+JRfy4umkh0GEE0dR0OZ3"
-"Hxk3AaZq2XW-A2XnA2X347O84A7BN4G9ESx2+-dEAzdEG4ZBraJEE8ha08Z47U21t8Z4q8Xbzq04qWJErCZ3mS10uuGeOumf6guK3GGDquWQg21DnWJCuu06OwDH8ulZ"
-"GOiZGuWkYu0Nw87d64Sl+tPAErPAEutKOapCraZCt0Z3tiY4wpbYzA23sapDruGUgH0EsKsK0OZa+WW32t11r0Z3EJd3ll80vOje+1WC+RgfARgfE0lD08Z3WoaQZ6G0"
-"aOHtuu-9Nup9N00CEe5RE40t8aJDoumNTvGqgeue1GGDouWE-pGDv0ZCEOWlEaWT2Mq002ZBp0pCqaJEnaJCvaJEqCJDqmpBobsPeHtNs56R+mpBVL014e08D401yyL6"
-"CG48WmJ8jq28q9NPb1YCmW38jqYCS0WCg0G3i0YSlz6TWusRaLcEj009W02FcLMOqLdSbvoG04G0KmZSbD6TpvZ500081a8Bv0ICq0ICWC38j4ZB1aQ5b6H04mpN1G22"
-"r0IC1OI1ZG0Fl8rJ0W2Fqb6RqL6P+03FlqW24mpBI190Go3Te9NPpXsRiHcFjGZBnaJDp8JEmaZCv03EsK3CsKMBm03DyyI6a8Za0m0FiLcPfO5JmuIDq4JEpaZDtK3E"
-"mSJEr8JEyyI5TO3D0apY41ZBqGZDm43Es0ZDq83DpCJCteTg10GEwmN0+dQ06cQ00WJ8f20DsbQ0GW38nK38byi-f6WFf60HouYCrWZCmOJEr0JDm0ZDmSJDXWA0p89g"
-"1m3Du4JDtO3Dn8JEnOJCuCJDIYQ0yO3CoS3DmW3EpWZCt83CvKZre601n0Z-e6Wme600m42XC43DWGZRID03m0ICt4G98838oulg1uZg1mIBsuoDu4JCo0pDuGJOQG0C"
-"tKsKMkQ0qCJEu0ZCtWJEsW3En43CQkQ0uKJCuCpCmKpDq0pCrO3Dquzg10GC+lQ02lQ004J83oGCu0YDkjQ004J9hY0EWCZ-h6WHh60Hmu2Cn4JCrGpCma3EqO3Ds03E"
-"I2r0yK3Dp4ZCp43ErOpCqOJCp0ZaGD0Fq43EuSJDvaZCoa3En8ZDoeDK30WC+NQ02NQ0K038m0ICmO7f14090KJDY2W2HlR41W0FVvJ0U401+-s02zs001ZBmGpCnOZC"
-"qCJCrOpDv0pDMcs0yGpDpWZCoW3CoC3Cr8ZCnOZa470DsKZCoaZDn8JDuW3Eu8ZLfD01yyY3BXGziZ1FpHNOdLsNvx4Ln0JDkSZDn43CmSZDv03DoapDm03FluZ90qoG"
-"im3SX9NPkHdFo03Flqm2He18kL6UqvJBnmpB5aW3wWG36XyS+mpBe5MOoDMOpDMOaLsNc9tRkHNOiPMOZLsNXn6T+e0Fly6SbvsOszrSqzcSXTMP+e0"
+static sybie::datain::DataItem item7("haarcascade_frontalface_alt_new.xml",7,
+"H7GPwvteAqgUw0c0+831IWn9E8O2oiD0+NB06LB0EGS8E0-62s4900J0UxVsEeOsE00CEGp208Z3OhXTy7G1e4Wbs8I0+WK018Y55abDe0W-A5WHA5GJqAeC6uWKyuGH"
+"M8Js1upj081ng8a90uVj0OKj081dZOO9RqaZ+p256o25Q859+Hq01WIXoQZH1uF81O481816f4ynsre05SYGtcWFL7G2sAq90ulj0Oaj0KeyISvJsTB0Eif3E0x2wagE"
+"+WB05rOewBpi2u-j0Oqj000EICs4+nV0EGDGEKS5+t80wr80Xqg33cXWPK00o4mAEGI7+Jn1wHn1I42AEGf5sHT0Iaq2+Jc0AIc0USa4+zQ0QSa40OZDm6WFZ9W3e4X3"
+"QGXEd0W-a9WHa9W3apY4ksaT65G0d4w5oKc0+KB0IysB2P20+JB0AHB0E0T6I89AwLB0QKxD+x072w07Iqt6EWk9s1905SY3TXWS65W4Q2aGc0W-65WK65GHCweL6LkU"
+"sTB012I83ep90uFk0O4k0OnwdutMNumj8vGiEuVX4eNX481Oh81K9Ot+1K0AfgX-JtWTJtW3HcX3wbWTF2W34EZ3ryY-D2WUD2GmCu0MrudOEa0A+NQ1EMQ1ICm4+fnM"
+"EeK2+xH0AwH0My3O+zt0ESF5EWx4+di0wbi0E4x71ScTu8W3G4b3+dW-u8WVu8W3JzW3x6XTE200n4Kw1Kh-F2WUF201t0Y3nOcWQVW4xBX369X-F2WUF200nuWbZ48t"
+"IwH0+JA32IA3Mw80fig-D2WWD2W40130nu0MTeN718H+PumSI8Jh1uZq881hJ8a90uFr6O4r60WDES15XbbTs200t4m91IiCr2W-F2WHF2W4RJY3Y8XTF2W4-EImnv-Z"
+"0etZ0umn90GCEeIJsz80X0a4Gqb-hKWUhKW-U4W-U4WEU4W5TxW3TlYTV4W4kmZ3ccW-W4W-W4W-W4WkW4W3UtXXCBW3pYX-BBWYBB00num4SuWtmO7h1Km9EmW7+hr0"
+"wfr000JmD5Ursz8000J0HwGo9ulM3edM38nkq42isz80IK0FEmW5+-80wz801hjXw8GWP6uU+t80wr80Ee77E8o222O4IK8N5eY-gnWTgnW3joY3d7XTi6W4GaW-YdYX"
+"YdY46PH86QdZ04u-Eiq5+ZI52YI51vf307XTF2W3MbI83vlv3edv3KeJ+N71+N71kK7100Z3HZXWLuW3c7H8nw-718u7181cHuWpjOdh140A1ji-1TWW1TW3-gGmGgtZ"
+"04kq1Lc-dFWTdFW4e+X3LFXUE2W3ZqW3vyW-F2WVF2GnWud-Hu0EjuVZ0eOZ04S7ISH8wnH01cf3l3YCeFWFinG819K90uFtBO4tB81S8Puc4e1rBvFx288x2uGwK8Hq"
+"EetG1uWzCumVp9tG1umDG8K90u-G1OqG10GEEC03XYhTq2W45iHWnu-43ut430GDEy2662901WI9lvVa0uNa0enB1vdg881RTuWkQuF81e8818149e7i1428Xyg-W4WW"
+"W4W6SWdVge10t4M6IC22+BU1s9U1IWh41gdTFBG1swm8Du-h1eth1KkZEOnKsz805LVGFxl71ed718HvGO8bC8XdZKSd+tQ0srQ0EeO66w80EKNC+t80As80jNlWEUW3"
+"gRX-XpZYXpZ3cYW42rYTw8W3FNX3EiW-g6WUg6W-T4W-T4WGT4W4Y8YV5KW6p5d-4KWW4KW-U4W-U4WEU4W5neWV9BW3zWb-8BWY8BW4vUa3ZkXV8BW3w6X-g6WWg6W3"
+"WMY3iNaTD2W3WVHOLvlZ5udZ50WCX6f3WiYTF2G0euGGQuVFE8OFE00CM290IWS9XCj-W4WUW4W4z0YXBeW6Gva-y8WWy8W4QyHvROth1K0AEuK3oyH0+8I3Eq04EWl6"
+"+F682E68I4aC2wTCIGt5EyY9+da1wba1Eec9EWdDsDK0XHHX6xFW8O7W88HrCuG6LOdZ0uGSBuWzEeJyRuZq18nqA5qhoWV0+BR369R312i3UWWTr2W3q8Y-VNWZVNW3"
+"viZ3wgWTE200nuGOLum7DuF718971u768a27+RRL2QRLI4g3EGk2wnH0E0232131+ZZ06XZ0IyPXEGF3sz80IWB6EiZ3+tt0wrt0E8g3ISj4w1901WIGXvFu588u5a6M"
+"2kpE9rJemuVd4ONd44eTEyz5+XS21WIWUwVmy9Omy9Hfe46ns1a0IGv411a-hFWUhFW-caX-caXFcaX3BRK88wl71ul71qY7I4N72UP404Z3QWW3G9XCj6WFQRW6+fW-"
+"0gWW0gW3ZkZXq2G0c8ui0u0u+8K90uFL5O4L58nd29nPEOtz10GCE0PH04J07ulD4edD440QA290EC-E+-80E+8004Z3xdXYG2Gv4uVa0uOa0eHBCuNT6e1p9uFT6e8T"
+"6KW++z80IeW9Xkd-+8WW+8W30h00nutS6uGHc0GC1SY-F2WUF2W3jmGnFPNN3uGHjumNo83n4uFx3O4x38X7BwWaPOdZ08ny7vmPwuV71eN71ummYOHHEO7a08HF98Xk"
+"Wu2i8upu5umQ09K90uFH1u4H1uWdyuNBO4Ql+364A264QGR6+vk0I0oDEK67o4K0+pH0EnH0Eqv2+j01E0Cb1dj-U9WUU9W4yXYYRyW3VpW3UkW-F2WUF2W3OII0dPtw"
+"24W92fd2+ek0ES+22L20+xS06vS0+7K0+7K0w4K0Ee436+S0EqQ8XSc-E7WUE7W3hNX3yBXTE7G0cuWmGu-T3etT3uWe88nsCOdZ00mC50f-AaaWAaa5Y4ZVJIG0cu-6"
+"18v618feF81u94sK+VZ0wTZ0EWkBEy27+zZ11WIemwFiC88iC8Hi4fOelK0AEKJ2oii0+a91I4nB2P20+h916f91XVk4+hZTnBG1ZuWeV9Nj0uGJN9K90uFj0O4j08nF"
+"WuG1UO7j082OPvlY2udY200DX2kXd1I0euWeTuFIC88ICuWXL4s6szH0EKO5EqSA+xH0wvH0I4x76IyBIaq7Em5K+-80wz801NT8WO771um3+uVV3eOV348d1XiVtUJ0"
+"e48n+Ng52Mg5I8NC1tjTV4W6FqZ-F2WWF2W3ULHmBPdZ04W9EKm2oi91+R716P71EOI4IiBIsv80EaULM4UKk8M3+-806z80bHbYrHGOx5O3+xH0wvH0Eew4IyV6+vH0"
+"Ee68+ZpQ2YpQEC371GWTD2W4gSX395XCS4WFAUW3VbbGb0W-G7WHG7W3ZxWX9lH0DA1APuVN2ONN281Yo4oqs5K00aZ3sUJOXAJG1uF71O471u0Cl8H53PtZ0uWIT9nD"
+"Ku-Z0etZ08XV1P8-HuWgXuGX8u-q6utq6KmyEO4B+vH0Eqp61aY-y8WTy8W3dZGGx8u79fnppeZAFvpV34mJEiG4wS20+Nc06Lc01vZYL7W4O4Y-K7WXK7W4KZZ3eFYU"
+"L7W-55W-55WE55W35WZ4bqYTt2G0duGWG8pY28a+1uWX98a90uV+1OK+14aNE0x6+DB0EKPQ+FF22EF2IOd22Mj3IKM3+ly0Aky0Iqy3Eaq4snH0X5g5WgWTH7W4Fhf-"
+"DYWYDYW4lCebQv40tuGI9e37GeKY2uGjeuWdC83u0u-Y2OqY28Xh9OO3J8HDCuGEC8pZ0eqj04qswaA9+NB06LB05Ee3pAYTb8GXNu0l88Jj0u-Z0OqZ08HPGA1gBQ7a"
+"0K0A0CZ3SrW-H2WUH2W47850nuWch9Oa08X6bu-LK8uLK8HfI8Hce8Oa0u00MuGUYu-C8OtC8uGnV4upsz80UqE6+t80wr80bHO0iPdZ0Km9E4J8+-80wz80XYbXE2W3"
+"vYW-D2WYD2W4GhW3UrXTS4W34sX3rVZ-coWUcoGnF528sv800KZ3mXb3BxX-g6WUg6W4Xte47lYTG2W3SdW3NZWEPMWF-MW4YMa3X-W-t2WUt2W4VL50ou06JOtj0K0A"
+"1oWDH2WFt2Gud8nBjf3A0uVw5OKw5u05v81qUO7k00GCEm3BECu7oWK0+SB0X4fGb0W-q2WHq2W3dsG8Y8ejO81AHe39Hv3j0uW6Vu0mN8Js0uFj0O4j0uGH88nt9O7Q"
+"1uW084qs+R-0+P-0I8u7XziTF2GP-4SL+N81wL81IiI4ESD2sz80XKVHWvFa0u7a08XR84+js1905SI8V8JF2uZO28X9i8a90u-O2OqO24Y7E0XE+1F81WIHFwlH1udH"
+"1KKPEiOBsPK05SY3lsWS65G0swWZKul458e458XUYvWDNPdj081lauWIK8Zj0ulr1Oar10WCEqr2E4j3sz80Iez4Xul-F2WUF2W3-vGedx7KV4aOEO52w1w11ya5tbW-"
+"u2WVu2GWavGWKPtH1umiRwGWZuFy4e7y44mz+RK0+RK0ERK0EGl8EOI8sLK0ESG2Xpd-55WU55W3CfX3JqeVQkc49bGeQ00C+Nc06Mc0MQT01SYG27XFtOW4uofGc0W-"
+"XHWHXHW4ojGGDQNr14AWXBXUHFW6oWWEc0W-s2WHs2W4L5NuLPdj081g4vmRMu-N4etN4uVm8uVm8uJm8KoX66L25Sh-hEWYhEW36dX39WWWsOW4LyX3OgWCm6WFRCG0"
+"FvWoiulP28eP2KmZ6on05SYWs2W4uxXGc0W-RCWHRCGoTfO0LKmj6AG5I8242T20+ZB06XB00KJeNOuj0Km92z80+CY0bqcGc0W-r2WHr2W3g2YYXyb31FY-OXWYOXW3"
+"7th4umXTMKW3A+JfCxlaKOdaKeXtJ0GC2693XWA0n40A+790w590Mec22290EOz2+-80E+80IKWgEqf4svQ0ISvDE4R3+xH0wvH0Im8V6IZ1IyD9+JZ1EIZ1ISXbEyP4"
+"wzH0bzd3qnYTqOW6bEd-3yXW3yX3UYY3uMXTs2W3BsY36FY-K7WUK7W3l4H8iwN7jc0AEef5oKK0+3J161J1ImY6EWy3szH0IuaI1Eg-F2WUF2W3nEOOlRdZ08Hpk81N"
+"auVC5ONC5uGCF401sv80EaK2EmK9+t80wr80bQfXE2W41ia-F2WZF2G0b91ZCPd71umYc1GCX-c-V4W-V4W-V4WjV4W3O5YXBPW37Ua-APWYAPW49Rf3V5YUh6W3T6c3"
+"qAX-h6WVh6GGbwWlzOtZ081F8v-05eu05umYGumxK88tbKSs1XlC5KWFghG0F52r+dj12cj11DMXLOtH144PE8KG+RT0+PT0ImCIE0J6sz80EmY3EOK4wzf8IOCFEeyB"
+"omM0+3m161m1IGL86QL1Iub5+RL1AQL1I0xHXyXU55W4Xga3dkW-hEWUhEGWrOuZ0u0Vm42h+t80wr80MKlP+vB3EeZDEae4+t80wr80IiN56AU1EegB5+W-F2WUF2GW"
+"svVn4uVn4uSn48HLCOu4gKm92kN1IGBD2P20+N316L31EeQ4XPXZ-CHO2vF8T888T8XnBOOQl8XHdvWKEuVZ2eNZ2umRDuWtNudn4uGnWu0S883v5u3K7uWgf8K90uFr"
+"1O4r18HiR8nBOOtU58n1p8nIR8Zj0uVa0OKa04Av5BdUH2G0e428+7+126+1bvLWaPN81Km92D+5+OT0I0C92P20+RK0IPK0EG92AMK0E4i5+JK02IK0+NyA+NyAcNyA"
+"1wb3nXWTz7W8kba-YHWUYHW4PBKWARtZ081bAu0SHu-Z0etZ0K+U1BXTF2W4ivJ85v-Z0etZ08XdgQeg3Km92Hu0+ew00GZ43hQ86vVRHONRH8XbFvmDKe7H18Xte5Uv"
+"+NK0wLK01ZN8iQtZ0uWng4I7+t80wr80EuI5AQd855MmDuFh1e7h18Hh+4AMsrH05SY3PmWCF2WFX9G8IxW99eZ4EuF36e4364opAAc0EG17+7c0A6c0ICD6AkrAQipN"
+"+JUc6IUcIe466kD91WY3hSX-m6WWm6W5Cmd3VLXTd9G1e4+loTc0Imr72P20+Rc06Pc0E8hBIeP8sLB0IeQCIqJAkSL1+mn0EqkZ2L20+JB06HB0I8v4Eyz5wHB01zg3"
+"KgWCq2W-F2WIF2W3a-a4p5XUG2W3pTZ4vkW--LWU-LGPQ4eFs190I0EE+xW1EwW1+3I0+3I0+0I0Iizf1blTW4W4Ijd3INX-l6WUl6W4MMZ3+uaTF2W45fW3nbg-FBWU"
+"FBW3pd30ouGQtOtZ08n6w4U3+390+190ESNA6QL11OY3HWX-T4WWT4W3ADXVh0H8+uGrJuVZ0eNZ08nX8uWGXPdg1u0emOHJXu2l5uF25e4254UZEIjD1WIPTvF81e78"
+"1uGAUOOkP4cUXPk-D2WUD2W3LnX3EXXUj6W-HqXdHqX3PfGWDPtE28HTa4yI+hZ02gZ05gaVlwd3w8HPOvVh1uNh1Kan1qlTV4W4woJ8AvFF2e7F20GCEOzI6gJBnyX-"
+"PZYWPZY8uEhWV4W3A4Z-dAXWdAX5WJX3vYXTG2W6usWE0vjF5hW3nmW3MaWEd0W-mKWHmKW4hpXWMUX6ccW-K7WWK7GPP5gcwHK0EaQ4+Jx3AIx3IKhV6I+25SIXJuYe"
+"4upq100EEKX42P20+BT069T0E482Eyp6+H5CIuVFEGyEoPB0EO2X2L20+NB06LB0IyF61CfTv7W46JY4M7XBg5W-F2WHF2W4e0YX8AW5Wab-hgXWhgX4GGYXE2W3eXI0"
+"cuFA7e7A7uGBUuWsMOdg1uGZDvGRMuVZ0eNZ0uWC0vWO9OOZ04sn+RZ0wPZ0+RJT+RJT+OJTEC036+s71VMWmu-g1utg1eHnfutjC8XSKuFmHe8mH4yFE0V2+DC919c4"
+"dvW-ABWUABW5nVYXV4W3avW-VcXYVcX4f-WX-6X4wLJG2vl71ed718HW8fuQU8X8j8nIKuVa0eNa0uWWFuGTBONU44Ig+Vn5EUn5ES52XklUE2W-taWctaW3jsWXE2GG"
+"i7MX+NP1wLP1XHU0hfupUK4E+ZG12YG1bfb3maXTj6GPQ52s+di0wbi0Ee631XXWW4W4KOf-H2WYH2W4mXXWF2W38CZ-D2WYD2W6tAXWK0X3mIHGpBJp2uZ0CumHaAK9"
+"0uVlAOKlAeXmVudQb8HFU4guoGB0+-806z80X5OGXfO+7K8owmS5+KK01yKWXfp90uFk0O4k081zEOOY2u-53uv538HrRuGOVOtD4KE9ESc7+V31wT31IuvE6wH00WZ3"
+"oya-eEWYeEW6pHcVqBW4are3AmW-U4WUU4W3-0aXqjJWruVZ0eOZ0Kq46kQ05SY-GGWYGGW3o9X39IZT8BW39Eb-tqXYtqX4thXXCxIvq6mZ+ZZ0wXZ0ICKK5taTU4W5"
+"1nZ44gW-94XT94X35IHO-wOl5ulb58fb5eHziv7a08Ha75Ii+tj1wrj1MqtD+Ha3I0o6Ey37ou80+ej1QWLC+NmC2MmCI8eD6w915SIWt8Nj0e15lvl6MOY6MGW2WqG0"
+"8mpN+K130128n038n438p0ICWqICkmpBTmXEe000n40AG438n0oCkS20OmpBoLsOqDN4IX2Fqb6RqL6P+03FlqW2LCL6F10FoC3000I7Q4G0Ga38t0YC1SfTG2G0d0HC"
+"WK38ouYZ0u3J04Gt08ZHd0W-r2WHr206u02CWO38se7j0mHCm02CW838su-G1utG10mCXiQ0ePtG1mnCW4pCW838ou-Z0utZ0WGCs0I962WCw1901WIG92GCsKT0+xQ0"
+"6vQ0C438nGZZl6G0dWmCWCZDF2WFa903q0ICtOa90uVj0eKj04o60CZXa900q4mt+Jc06Ic08W38uK4FsDc08W38v4Mps8K0+pH06nH08a38vKoWsr80C43CWaJW0xFy"
+"2u7y2G0EWaK4sv80X4K9JxIm4u-61Oq61GGCqK8T0CZUE2G1d4C2o0L1+-80Az80C02CW4JGMON710mDb250vulg1udg10GC1B43q0ICretZ0K0A08J0eu-71et71WGD"
+"WKZZG200t4S++-80A+805P10ouVF2uVF2KLFMki00KJGZvZj5ulo2eao20GC1RTu-Oto24y+EG82wKG1+Sa11yKWFep90uFk0O4k00mD18fXt2G1dumx98Zy2uZj000E"
+"EC422P20+NB06LB0S4ZCW038p02D+nM00CJ9y30D+Z31+X310GJ8lwW68Ot+100D1WR8LxFv5u7v50XCWS38qO8O9WWCWWJ0KQpq1uVh1OKh100EXhc3QfWTU400v4m9"
+"04JWVvl07Od07OH788OVAOH78uV3B8O3B4C-EoH0EeA2+t802s80+Vr0+Vr0wSr0XghXbF00suFv38Av3K6m2I7100Jud0WDXEbB8BWFgK00qumtC8a90uVV38LV34qN"
+"+1V20WJ0r6yb+tt0wrt0XuHew20Ewr011W20qKI-oOK0+3I0I1I08038q88a0K8n08JeLvMr1aWj2T20+RB06PB0C43CWWJnAPtK5GGCn4GkEWy2kOB0+-806z800aJW"
+"wuGPEOtZ00GEECg2+lO2EkO2+xH0+xH0suH00SZai6W30uW-h6WYh600r4cv0KJOkR7h10GDfuA0tuFW3u7W348TA+z41SY3TsWS-DW3E4XGb0W-kBWHkBGm8uWN9u7L"
+"540Abyc-LLWVLLW3ldWX+f00pu0nB40A+p01sn0104Z3xfWXE200nu0jEuF3Be83B4Qt6w808038ruVZ0uOZ0mGCp0IDbNlTyD01nOJ3FAdx20GC1zU829Z90u-x2Oqx"
+"2W0DW4JhWRdj000E1WY3kHX-X9WVX900o4iRXNcTG2G0e4sf08Z-X4WVX400p4zrs1900CJ8Oxlu5eeu5uWEGu0VO8OgA0GC14f3WjW-19WU19GfV3mCEGB226I000J8"
+"X00C+Ba0AAa0Eqg526I0E0o304ZFqdW-XDWHXD00s8fZ0uWH8uVZ0eOZ04oWXPZWTRW4dpGmGvlF2edF20GDDDXUz8G0GMgD+-80wz80443CIuy52+3404JvkvliF8ei"
+"F4yJECL6sfr00WZ30eX-D2WXD200vKKo+jH0E0O4EyS2+dQ0wbQ008Jj9O771K0AEqK3o090+yw31zb3cuWEzlX-DGWHDGW4yEXXFM10nOXp9e3lJ8aj0aemwO20+NB0"
+"6LB00aZ4NnWVZE00v8n+8ul3B8e3BuW2W4KxsTV0bXi-kHXYkHHW-20EXOjTF200rKAu0OZD5AW-f6WHf6W41gWaU9W3RAX-u8WWu8W3VhXXE2GWaxVC4eOC40GCECb2"
+"6k2344ZC5Vc-7BWW7B00qu0GEO8RR8XhS4Y7+Rt26Qt2E0v4+H+0+xH0UwH0ESH76oQ011c3YqW-S4WUS400vaogA++8EC141sfB3+WFrM00vu07F8a90uF34O4348ny"
+"LOOA5KGt+dI1AcI11Ja3toWTeKW6wzX-pKYWpKIGwOeZ0u0nGu0MbuFO2e7O2uG2U4qn+fL21KY31+W-uMWWuMW3sQ20n4G1srQ0Ea+5EaJ2+Rj1AQj11il-W4W-W4GE"
+"W4kpEYj10SZ3SpWDU4WFEGW3TuW3r0XCpGW-DGWHDGW6PW00tedq1Km9EiD3+-80wz800OJ0gPOq10WDf6bE35W-U4WIU4W3dIY3ojWTmBW4-qH8UuF44e74446M08Z3"
+"z6XTF2G0duG0Q83h1u3O2ennh00EsO20+FK0+FK0+FK02EK0EKZ766T0ESd9+3T0A2T0Meu4EmO8s5T09W20qulaIOeaI8X6KO8a00GD1He-F2WZF2W3tSX3bZXUV4G0"
+"d4oho4l0+li06ji0Em126w80EGy5+t80As8004Z3S710o4A2wrH0IiP91Sh-U4WUU400s4+yEOb5s190IGWBEud2+-80wz80443DbRcWxaW3T7X-eTWYeTW4XRH8pQd7"
+"14m9ECCBoqH0+iR18a38qOK90u-x2Oqx2ulG1ulG18aG18ncGuNlN00CE842+-k0A+k004Jma0mCXllTI700num4o8n8guV788O780WD1qcVf+W37RHWKu-Z0utZ04UQ"
+"EK93+rn3IWk2XLeCpBW-EBWHEBW3pDZZl6GG15Yr+xQ0wvQ0I8gA6c82IaNB1xa-F2WUF2W3voWXtj00ru0FG40AkSC4+lQ06jQ004Z3RXWX5+W6yEZ-hbXYhb10tum3"
+"Ze7w3427EST3+pH0wnH01F42s0IEwr80EqbA0OZ3eCX-f6WTf6W3DE10s8eCuu06YuVgKuOgKu0zj0WD6sT71cfG0YWFZTW6yaY-31YW31IOq5gZ+vb0EGs904Z3PkW-"
+"I7WUI7G8P0GCIC-BsPj1ECe8M4-8+Bc0+9c0IO82+Lj10KZ3A6IO+v-Z0etZ0uGrIuGQJu7a040AE4W6+Rs12Qs10CJ8WO84N8XgYuWIKuF81u781ulk5ulk5OZk5u01"
+"cO8I6OXixu-H68uH68X8PumIPOdM30GCEWb55Hc-QDWTQD00qKgl+bi0EynE+t80As80IKo21alUS4W3+EY3WLX-S4WUS400u8HSZuNP74Mv40YCEOO8+hQ0sfQ019S0"
+"vR7714W9E0y8+t802s80XNlVlQW344HupBJZ0u3P7umo88K90ulJAeaJAu0vfO8KT0GC1UG0FwFN2e7N2umxQuGvROdp1umCXuWQBuVZ08OZ08XpPutp10GEE885XmXC"
+"G7W-h6WHh6W3-+YXYKW3XMZ-KIWYKIW3eeGGZQNg1uWPB8KHaul61Oa61umbEe8tA8n+NeJjAupT34O9ESU2+pS0wnS0Iyu2+7k3+7k3c4k30aZ3pQHmxOtp181XVulw"
+"2eew20GCE8TAI8J5s19044JC5kWEVJa-W9WHW900m4O204ZXHXY4bOa3NuY--8WV-8GeduWnEOt71uGUe4cV+VI1wTI1E0dF6ki0EOBE+lQ4AkQ41If4HYZTR4GpGhZM"
+"cuJ348XecuGU9ul34ed34u0DWO8m4O1iBe3m4uVx2OKx200EEuY36Yc10WJWpuVQ6eOQ6uG8MOeN20GEXnd33oY-jfWTjfGOuPOnP81L94um+x80wv800WZ4pTYVpVH0"
+"qwVZ0eOZ00mDIGs2+1oIEeR217a-Q4WUQ400tuG+FuWRFOd14Km91VlCWFWF6GGzT8Z90uVU3OKU3uGhZ40j+H16EmJ4QSA2kuk0+SB01ya3ama-SsYWSsY536ZVxoZ4"
+"tCHG8AJj0ulH1eaH1uWcAuGujOt+18HeQ8qZ084H14gb2P20+NB06LB0EWxG6IB01OYGD2WFp2GWVAK90uli0Oai0uGsM8nY+OtP1eHbSulwJ8ewJ0mDICV7443Cwz80"
+"b5l3G4Y-5AWU5AW4UeIWPPd718X+z4w3+-80wz80E8Q6Ee47sv800SZ3GjGGnxlZ0edZ0OXYmudv481+4v0lLulZ0edZ00mDXcI0e9O71u059uVo28Oo2On1qeuSGu0D"
+"AuFQC88QCuGSX8nLKON714O3Xfk-MVWXMVG0hvNy84Ca0OZ3KoXBUSW-2KWH2KW3yvW3TgXUS4GWQ628+pH0wnH0XLbZnHW37eX-3nWW3nW4aEYZYOX3rb10vulu3udu"
+"34IfM0J2sPi01WY-P2aaP2Kff5m+s1900WJeGw-vKeuvKe164vtL3eXD5vlDC9eDCrEf+1Y1IWQC12X-PDWUPDW-U4W-U4WGU4W3I7XVi6W5sKa-h6WYh6W3GtWVAeX4"
+"wlW3AOX-g6WUg6W4xrZXBZ10muGGDuGT9u-Z0etZ0umbi4mP+ny11WIWDuVp78Op7u0m84KF+P71E843+NZ32MZ3Eqi408Z3LfXTE2G0dO1hJuVp7ONp78HiBuOUQuGV"
+"F4GA+-80sz805sT8mQd71engJuVbA8ObAKsCIm94s19000Z3NzGviv-h1eth181TQfOCi0GC54PGrxVa0eNa0u0GfK4g+5I0EyM7wqr0+8y3EGtH1GWqp20dyyYPb56T"
+"r9NPpv3FlCMOpDMOaLcFAmpBl1NPkDcTVD7Tl9NOdLcFA0"
 );
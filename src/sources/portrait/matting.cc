@@ -13,6 +13,7 @@
 
 #include "portrait/math.hh"
 #include "portrait/graphics.hh"
+#include "portrait/interrupt.hh"
 
 namespace portrait {
 
@@ -33,12 +34,10 @@ enum { BackSamplingRange = 3 };
 enum { FrontSamplingStep = 2 };
 //混合范围，边缘向外（背景方向）的距离
 enum { BackSamplingStep = 5 };
-//混合范围，边缘向内（前景方向）的距离
-enum { FrontMattingRange = 10 };
-//混合范围，边缘向外（背景方向）的距离
-enum { BackMattingRange = 30 };
-//前景色分类数，越大越准确、越慢。
-enum {KFront = 4};
+//混合范围（ProcessingProfile::matting_front_range、matting_back_range）
+//和前景色分类数（ProcessingProfile::matting_clusters）由处理参数指定，见MattingPolicy。
+//前景色分类数的上限
+enum {MaxKFront = ProcessingProfile::MaxMattingClusters};
 //球体映射的球体半径，足够大即可
 enum {SphereRadius = 0xfff};
 //Matting前景色和背景色最小距离（欧氏距离），太小易被噪声干扰，太大则精确度下降
@@ -334,24 +333,28 @@ void _StatBackSample(BackSample& sample,
     sample.mean_back_color = median.Get();
 }
 
+//前景样本，前景色分类数k_front是编译期常数（见MattingPolicy）
+template<int k_front>
 struct FrontSample
 {
     explicit FrontSample(const Point& center)
-        : center(center), back_sample(nullptr), kmeans(KFront)
+        : center(center), back_sample(nullptr), kmeans()
     { }
 
     Point center;
     const BackSample* back_sample;
-    KMeans<cv::Vec3i, DistanceOfVector<int,3>,
+    KMeans<cv::Vec3i, DistanceOfVector<int,3>, k_front,
            MeanOnSphere<SphereRadius> > kmeans;
-    cv::Vec3i mean_color[KFront];
-    int mean_color_squeue[KFront];
-    int mean_color_modulus[KFront];
-}; //struct FrontSample
+    cv::Vec3i mean_color[k_front];
+    int mean_color_squeue[k_front];
+    int mean_color_modulus[k_front];
+}; //template<int k_front> struct FrontSample
 
-void _StatFrontSample(FrontSample& front_sample,
+template<class Policy>
+void _StatFrontSample(FrontSample<Policy::KFront>& front_sample,
                       const BackSample* nearest_back_sample,
-                      const MatBase<cv::Vec3b>& img)
+                      const MatBase<cv::Vec3b>& img,
+                      const Policy& policy)
 {
     front_sample.back_sample = nearest_back_sample;
     cv::Vec3i back_color = nearest_back_sample->mean_back_color;
@@ -375,13 +378,14 @@ void _StatFrontSample(FrontSample& front_sample,
                 <= Squeue<int>(FrontSamplingRange))
             pixels_diff_vec.push_back(sphere_vec);
     }
-    for (int k = 0 ; k < KFront ; k++) //随便初始化kmeans聚类中心
+    const int k_front = Policy::KFront;
+    for (int k = 0 ; k < k_front ; k++) //随便初始化kmeans聚类中心
         front_sample.kmeans.InitCenter(k, cv::Vec3i(k,0,0));
     front_sample.kmeans.Train(pixels_diff_vec.cbegin(),
                               pixels_diff_vec.cend());
 
     //统计每个分类的颜色中位数
-    Median<int, 3> median[KFront];
+    Median<int, 3> median[Policy::KFront];
     for (auto& point : PointsIn(sampling_area))
     {
         const Point point_sub = point - sampling_area.point;
@@ -395,7 +399,7 @@ void _StatFrontSample(FrontSample& front_sample,
     }
 
     /*
-    Mean<cv::Vec3i> meaning[KFront];
+    Mean<cv::Vec3i> meaning[MaxKFront];
     for (auto& point : PointsIn(sampling_area))
     {
         const Point point_sub = point - sampling_area.point;
@@ -410,7 +414,7 @@ void _StatFrontSample(FrontSample& front_sample,
     */
 
     //将结果保存到sample
-    for (int k = 0 ; k < KFront ; k++)
+    for (int k = 0 ; k < k_front ; k++)
     {
         front_sample.mean_color[k] = median[k].Count() > 0 ?
             median[k].Get() : Normalize(front_sample.kmeans.GetCenter(k),100);
@@ -432,9 +436,59 @@ bool Found(const MatBase<T>& mat, const Rect& area, const T& val)
     return false;
 }
 
-}  //namespace
+/* 边缘混合的参数策略，MatBorderKernel按策略实例化。
+ * 前景色分类数KFront总是编译期常数：FrontSample和KMeans按它使用定长数组，
+ * 聚类（Train、GetTag）和Alpha估计中按分类的循环次数固定，可被编译器展开。
+ * FixedMattingPolicy的混合范围也是编译期常数，用于预设；
+ * RuntimeMattingPolicy在运行时读取混合范围，用于预设以外的参数组合，
+ * 分类数按ProcessingProfile::matting_clusters选择实例（1 ~ MaxKFront）。
+ */
+template<int k_front, int front_matting_range, int back_matting_range>
+struct FixedMattingPolicy
+{
+    static_assert(k_front >= 1 && k_front <= MaxKFront, "k_front out of range");
+    enum { KFront = k_front };
+
+    int FrontMattingRange() const { return front_matting_range; }
+    int BackMattingRange() const { return back_matting_range; }
 
-cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
+    //profile的参数是否与本策略相同
+    static bool Match(const ProcessingProfile& profile)
+    {
+        return profile.matting_clusters == k_front
+            && profile.matting_front_range == front_matting_range
+            && profile.matting_back_range == back_matting_range;
+    }
+}; //struct FixedMattingPolicy
+
+template<int k_front>
+struct RuntimeMattingPolicy
+{
+    static_assert(k_front >= 1 && k_front <= MaxKFront, "k_front out of range");
+    enum { KFront = k_front };
+
+    explicit RuntimeMattingPolicy(const ProcessingProfile& profile)
+        : front_matting_range(profile.matting_front_range),
+          back_matting_range(profile.matting_back_range)
+    {
+        assert(profile.matting_clusters == k_front);
+    }
+
+    int FrontMattingRange() const { return front_matting_range; }
+    int BackMattingRange() const { return back_matting_range; }
+
+    int front_matting_range;
+    int back_matting_range;
+}; //template<int k_front> struct RuntimeMattingPolicy
+
+//与ProcessingProfile的预设（Fast、Balanced、Quality）对应的策略
+typedef FixedMattingPolicy<2, 6, 15> FastMattingPolicy;
+typedef FixedMattingPolicy<4, 10, 30> BalancedMattingPolicy;
+typedef FixedMattingPolicy<6, 10, 30> QualityMattingPolicy;
+
+template<class Policy>
+cv::Mat MatBorderKernel(const cv::Mat& image, const cv::Mat& mask,
+                        const Policy& policy)
 {
 /* 1）找出所有边缘像素
  * 2）计算图像上每一点与最近边缘像素的距离（一维距离）
@@ -444,7 +498,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
  *    采样点求平均值，作为该点背景色。
  * 5）F每点作为中心，一个指定大小（FrontSamplingRange）为半边长的正方形范围内采样，
  *    分别找到B中最近点的背景色，
- *    采样点减去背景色后映射到颜色空间的球面上，用k-means聚类，k=KFront，每个分类分别计算平均颜色。
+ *    采样点减去背景色后映射到颜色空间的球面上，用k-means聚类，k=k_front，每个分类分别计算平均颜色。
  * 6）FrontSamplingPoints和BackSamplingPoints之间的像素为混合区域，
  *    对区域内每一点找到在F中的最近（欧几里德距离）点f，
  *    在f的采样分类中找到接近分类，分类的平均颜色为前景色，f的最近背景采样背景色作为alpha计算依据。
@@ -455,6 +509,10 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
     const MatBase<uint8_t> _mask =
         MakeConstWrapper<uint8_t>(mask);
     const Size _size = _img.GetSize();
+    const int front_matting_range = policy.FrontMattingRange();
+    const int back_matting_range = policy.BackMattingRange();
+    typedef FrontSample<Policy::KFront> FrontSampleType;
+    const int k_front = Policy::KFront;
     cv::Mat matte(image.rows, image.cols, CV_8UC4);
     MatBase<cv::Vec4b> _matte =
         MakeWrapper<cv::Vec4b>(matte);
@@ -462,6 +520,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
     //1)
     std::vector<Point> border_points;
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:1");
         border_points = _GetBorderPoints(_mask);
     }
@@ -469,6 +528,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
     //2)
     MatBase<std::pair<int, Point> > border_dist_map;
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:2");
         border_dist_map = _GetDistMap(_size, border_points,
            std::max<int>(FrontSamplingDistance, BackSamplingDistance) + 2);
@@ -485,13 +545,14 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
     //3)
     std::vector<Point> front_sampling_points,
                        back_sampling_points;
-    std::map<Point,FrontSample,ComparePoints> front_samples;
+    std::map<Point,FrontSampleType,ComparePoints> front_samples;
     std::map<Point,BackSample,ComparePoints> back_samples;
     MatBase<uint8_t> border_mask(_size);
     MatBase<std::pair<int, Point> > front_dist_map;
     MatBase<std::pair<int, Point> > back_dist_map;
 
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:3");
         MatBase<uint8_t> sampling_mask(_size);
         for (auto& point : PointsIn(_size))
@@ -517,13 +578,13 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
                 sampling_mask_point = 0;
             }
             border_mask[point] = (dist <= BackSamplingDistance+1 &&
-                                  dist <= BackMattingRange+1 &&
+                                  dist <= back_matting_range+1 &&
                                   dist >= -FrontSamplingDistance-1 &&
-                                  dist >= -FrontMattingRange-1);
+                                  dist >= -front_matting_range-1);
         }
 
         for (auto& point : front_sampling_points)
-            front_samples.insert(std::make_pair(point, FrontSample(point)));
+            front_samples.insert(std::make_pair(point, FrontSampleType(point)));
 
         for (auto& point : back_sampling_points)
             back_samples.insert(std::make_pair(point, BackSample(point)));
@@ -540,6 +601,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
 
     //4)
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:4");
         for (auto& back_sample : back_samples)
             _StatBackSample(back_sample.second, _img);
@@ -547,6 +609,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
 
     //5)
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:5");
         for (auto& front_sample_pair : front_samples)
         {
@@ -561,12 +624,13 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
                 &back_samples.at(nearest_back_point);
             _StatFrontSample(front_sample_pair.second,
                              nearest_back_sample,
-                             _img);
+                             _img, policy);
         }
     } //timer
 
     //6)
     {
+        CheckInterrupt();
         sybie::common::StatingTestTimer timer("_MatBorder:6");
         for (auto& point : PointsIn(_size))
         {
@@ -576,12 +640,12 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
             cv::Vec3b& back_pixel = *(cv::Vec3b*)&raw_pixel;
 
             int dist = border_dist_map[point].first;
-            if (dist > -FrontMattingRange &&
-                dist <= BackMattingRange &&
+            if (dist > -front_matting_range &&
+                dist <= back_matting_range &&
                 front_dist_map[point].first >= 0)
             {
                 //最近的前景样本点
-                const FrontSample& front_sample =
+                const FrontSampleType& front_sample =
                     front_samples.at(front_dist_map[point].second);
                 //采样背景颜色
                 const cv::Vec3i& back_color =
@@ -592,7 +656,7 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
                 //std::cout<<SHOW(pixel_sphere)
                 //         <<SHOW(pixel);
                 Mean<double> mean_modulus;
-                for (int k = 0 ; k < KFront ; k++)
+                for (int k = 0 ; k < k_front ; k++)
                 {
                     double distance =
                         front_sample.kmeans.DistanceOf(pixel_sphere, k);
@@ -641,7 +705,45 @@ cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask)
     return matte;
 }
 
-cv::Mat MakeTrimap(const cv::Mat& image, const cv::Mat& mask)
+/* 预设以外的参数：按profile.matting_clusters选择RuntimeMattingPolicy<k_front>的实例，
+ * 从k_front开始依次尝试到MaxKFront。
+ */
+template<int k_front>
+cv::Mat MatBorderRuntime(const cv::Mat& image, const cv::Mat& mask,
+                         const ProcessingProfile& profile)
+{
+    if (profile.matting_clusters == k_front)
+        return MatBorderKernel(image, mask, RuntimeMattingPolicy<k_front>(profile));
+    return MatBorderRuntime<k_front + 1>(image, mask, profile);
+}
+
+template<>
+cv::Mat MatBorderRuntime<MaxKFront + 1>(const cv::Mat& image, const cv::Mat& mask,
+                                        const ProcessingProfile& profile)
+{
+    sybie_assert(false) << SHOW(profile.matting_clusters);
+    return cv::Mat();
+}
+
+}  //namespace
+
+cv::Mat MatBorder(const cv::Mat& image, const cv::Mat& mask,
+                  const ProcessingProfile& profile)
+{
+    //预设参数使用编译期特化的版本
+    if (BalancedMattingPolicy::Match(profile))
+        return MatBorderKernel(image, mask, BalancedMattingPolicy());
+    if (FastMattingPolicy::Match(profile))
+        return MatBorderKernel(image, mask, FastMattingPolicy());
+    if (QualityMattingPolicy::Match(profile))
+        return MatBorderKernel(image, mask, QualityMattingPolicy());
+    sybie_assert(profile.matting_clusters >= 1 && profile.matting_clusters <= MaxKFront)
+        << SHOW(profile.matting_clusters);
+    return MatBorderRuntime<1>(image, mask, profile);
+}
+
+cv::Mat MakeTrimap(const cv::Mat& image, const cv::Mat& mask,
+                   const ProcessingProfile& profile)
 {
     const MatBase<cv::Vec3b> _img =
         MakeConstWrapper<cv::Vec3b>(image);
@@ -661,14 +763,14 @@ cv::Mat MakeTrimap(const cv::Mat& image, const cv::Mat& mask)
         int& distance = border_dist_map[point].first;
         if (IsFront(_mask[point]))
         {
-            if (distance < FrontMattingRange && distance >=0 )
+            if (distance < profile.matting_front_range && distance >=0 )
                 _trimap[point] = 127;
             else
                 _trimap[point] = 255;
         }
         else
         {
-            if (distance <= BackMattingRange && distance >=0 )
+            if (distance <= profile.matting_back_range && distance >=0 )
                 _trimap[point] = 127;
             else
                 _trimap[point] = 0;
@@ -0,0 +1,83 @@
+#include "portrait/preview.hh"
+
+#include <algorithm>
+
+#include "sybie/common/Time.hh" //sybie::common::TestTimer
+
+namespace portrait {
+
+//抠图人脸大小的下限（像素），再小GrabCut无法分辨头发和肩膀
+enum { MinPreviewFaceSize = 32 };
+//抠图耗时超过预算的这个比例时降低抠图分辨率，低于另一个比例时提高
+const double ShrinkBudgetRatio = 0.8, GrowBudgetRatio = 0.4;
+//每次调整抠图人脸大小的比例
+const double FaceSizeStep = 0.8;
+//抠图耗时指数平均的权重（最新一帧）
+const double MatteTimeWeight = 0.3;
+//跳过抠图时估计值的衰减，使之后能再次尝试
+const double SkipDecay = 0.9;
+
+PreviewEngine::PreviewEngine(
+    const MixTarget& target,
+    const int face_resize_to,
+    const double budget_ms,
+    const ProcessingProfile& profile)
+    : _target(target), _face_resize_to(face_resize_to), _budget_ms(budget_ms),
+      _max_face_size(profile.matting_face_size > 0 ? profile.matting_face_size
+                                                   : face_resize_to),
+      _profile(profile), _tracker(profile), _session(),
+      _matte_ms(0), _last_output()
+{
+    _profile.matting_face_size = _max_face_size;
+}
+
+PreviewStats PreviewEngine::Render(const cv::Mat& frame, cv::Mat& output)
+{
+    sybie::common::TestTimer timer;
+    PreviewStats stats;
+    const TrackingResult tracking = _tracker.Track(frame);
+    stats.found = tracking.found;
+    stats.rendered = false;
+    stats.face = tracking.face;
+    stats.matting_face_size = _profile.matting_face_size;
+    if (!tracking.found)
+    {
+        stats.milliseconds = timer.GetTimeSpan().ToMilliSeconds();
+        return stats;
+    }
+
+    //剩余的时间不足以抠图时，沿用上一次的结果
+    const double remaining = _budget_ms - timer.GetTimeSpan().ToMilliSeconds();
+    if (!_last_output.empty() && _matte_ms > remaining)
+    {
+        _last_output.copyTo(output);
+        _matte_ms *= SkipDecay;
+        stats.milliseconds = timer.GetTimeSpan().ToMilliSeconds();
+        return stats;
+    }
+
+    sybie::common::TestTimer matte_timer;
+    SemiData semi = PortraitProcessSemi(
+        frame, tracking.face, _face_resize_to,
+        _target.crop_size, _target.vertical_offset, _session, _profile);
+    PortraitMix(semi, output, _target.crop_size, _target.vertical_offset,
+                _target.back_color, _target.mix_alpha);
+    output.copyTo(_last_output);
+    stats.rendered = true;
+
+    const double matte_ms = matte_timer.GetTimeSpan().ToMilliSeconds();
+    _matte_ms = _matte_ms > 0 ? _matte_ms * (1 - MatteTimeWeight) + matte_ms * MatteTimeWeight
+                              : matte_ms;
+
+    //按抠图耗时调整下一帧的抠图分辨率
+    int& face_size = _profile.matting_face_size;
+    if (_matte_ms > _budget_ms * ShrinkBudgetRatio)
+        face_size = std::max<int>(MinPreviewFaceSize, cvRound(face_size * FaceSizeStep));
+    else if (_matte_ms < _budget_ms * GrowBudgetRatio)
+        face_size = std::min(_max_face_size, cvRound(face_size / FaceSizeStep));
+
+    stats.milliseconds = timer.GetTimeSpan().ToMilliSeconds();
+    return stats;
+}
+
+}  //namespace portrait
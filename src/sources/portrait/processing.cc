@@ -2,45 +2,44 @@
 
 #include <cassert>
 
+#include "sybie/common/Time.hh" //sybie::common::StatingTestTimer sybie::common::TestTimer
+
 #include "portrait/exception.hh"
+#include "portrait/adaptive.hh"
 #include "portrait/algorithm.hh"
 #include "portrait/graphics.hh"
+#include "portrait/guided.hh"
+#include "portrait/interrupt.hh"
 #include "portrait/facedetect.hh"
+#include "portrait/pyramid.hh"
+#include "portrait/semidata.hh"
+#include "portrait/video.hh"
 
 namespace portrait {
 
+//默认的裁剪范围（相对人脸大小）。经验参数：裁剪出超过所有已知证件照规格的尺寸
+const double MaxUpExpand = 0.6;
+const double MaxDownExpand = 0.6;
+const double MaxWidthExpand = 0.4;
+//指定裁剪规格时，在裁剪区域以外额外保留的范围（相对人脸大小），为GrabCut和边缘混合提供背景样本
+const double CropMargin = 0.15;
+//经验参数：人脸上方至少预留空间为脸高度的30%
+const double MinHeadSpace = 0.3;
+
 cv::Mat PortraitProcessAll(
     const cv::Mat& photo,
     const int face_resize_to,
     const cv::Size& crop_size,
     const int vertical_offset,
-    const cv::Vec3b& back_color)
+    const cv::Vec3b& back_color,
+    const ProcessingProfile& profile)
 {
-    SemiData semi = PortraitProcessSemi(photo, face_resize_to);
+    //最终的裁剪规格已知，只对裁剪区域附近抠图
+    SemiData semi = PortraitProcessSemi(
+        photo, face_resize_to, crop_size, vertical_offset, profile);
     return PortraitMix(semi, crop_size, vertical_offset, back_color);
 }
 
-struct SemiDataImpl
-{
-public:
-    cv::Mat image; //CV_8UC3 R,G,B
-    cv::Mat matte; //CV_8UC4 R,G,B,A
-    cv::Rect face_area;
-public:
-    static SemiData NewWrapper()
-    {
-        return SemiData(new SemiDataImpl());
-    }
-    static SemiDataImpl& GetFrom(SemiData& wrapper)
-    {
-        return *wrapper._data;
-    }
-    static const SemiDataImpl& GetFrom(const SemiData& wrapper)
-    {
-        return *wrapper._data;
-    }
-}; //struct SemiDataImpl
-
 SemiData::SemiData() throw()
     : _data(nullptr)
 { }
@@ -81,6 +80,11 @@ cv::Rect SemiData::GetFaceArea() const
     return _data->face_area;
 }
 
+MattingPath SemiData::GetMattingPath() const
+{
+    return _data->matting_path;
+}
+
 cv::Mat SemiData::GetImage() const
 {
     cv::Mat tmp;
@@ -90,9 +94,8 @@ cv::Mat SemiData::GetImage() const
 
 cv::Mat SemiData::GetAlpha() const
 {
-    cv::Mat tmp(_data->matte.rows, _data->matte.cols, CV_8UC1);
-    int from_to[] = {3, 0};
-    cv::mixChannels(&_data->matte, 1, &tmp, 1, from_to, 1);
+    cv::Mat tmp;
+    _data->matte.CopyAlphaTo(tmp);
     return tmp;
 }
 
@@ -103,31 +106,251 @@ cv::Mat SemiData::GetImageWithLines() const
     return tmp;
 }
 
+cv::Mat SemiData::GetImageView() const
+{
+    //不持有内存的Mat头
+    const cv::Mat& image = _data->image;
+    return cv::Mat(image.rows, image.cols, image.type(), image.data, image.step);
+}
+
+const uint8_t* SemiData::GetAlphaRow(int y) const
+{
+    return _data->matte.GetAlphaRow(y);
+}
+
+cv::Mat SemiData::GetAlphaView(int y, int& first_row) const
+{
+    //不持有内存的Mat头，行块创建后不再修改
+    const cv::Mat& tile = _data->matte.GetAlphaTile(y, first_row);
+    return cv::Mat(tile.rows, tile.cols, tile.type(), tile.data, tile.step);
+}
+
+SemiData SemiData::Clone() const
+{
+    SemiData semi = SemiDataImpl::NewWrapper();
+    SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
+    data.image = _data->image; //图像创建后不再修改，直接共享
+    data.matte = _data->matte; //只复制各行块的引用
+    data.face_area = _data->face_area;
+    data.profile = _data->profile;
+    data.matting_path = _data->matting_path;
+    return semi;
+}
+
 SemiData PortraitProcessSemi(
     const cv::Mat& photo,
-    const int face_resize_to)
+    const int face_resize_to,
+    const ProcessingProfile& profile)
+{
+    ImagePyramid pyramid;
+    return PortraitProcessSemi(photo, face_resize_to, pyramid, profile);
+}
+
+/* 执行PortraitProcessSemi，按人脸位置向上、下、左右分别裁剪
+ * 人脸大小的up_expand、down_expand、width_expand倍的范围。
+ * face_area为nullptr时检测人脸，否则直接使用（原照片坐标）。
+ * temporal不为nullptr时，用GetAlphaMatteTemporal复用上一帧的结果。
+ * adaptive不为nullptr时，人脸检测之后按期限选择抠图参数（data.profile仍为profile）。
+ */
+static SemiData ProcessSemi(
+    const cv::Mat& photo,
+    const cv::Rect* face_area,
+    const int face_resize_to,
+    const double up_expand,
+    const double down_expand,
+    const double width_expand,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile,
+    TemporalMatte* temporal = nullptr,
+    AdaptiveQuality* adaptive = nullptr)
 {
     SemiData semi = SemiDataImpl::NewWrapper();
     SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
-    data.image = photo;
-
-    cv::Mat image_gray;
-    cv::cvtColor(data.image,image_gray,CV_BGR2GRAY);
-    data.face_area = DetectSingleFace(image_gray);
-    data.face_area = TryCutPortrait(
-        data.image, data.face_area,
-        0.6, 0.6, 0.4); //经验参数：裁剪出超过所有已知证件照规格的尺寸
-    data.face_area = ResizeFace(data.image, data.face_area,
-                                cv::Size(face_resize_to, face_resize_to));
-    data.matte = GetAlphaMatte(data.image, data.face_area, cv::Mat());
+    ImagePyramidImpl& levels = ImagePyramidImpl::GetFrom(pyramid);
+
+    data.profile = profile;
+    levels.SetPhoto(photo);
+    data.face_area = face_area != nullptr ? *face_area
+                                          : DetectSingleFace(levels.GetGray(), profile);
+    CheckInterrupt();
+
+    //按剩余的时间选择抠图参数
+    const int face_size = face_resize_to > 0 ? face_resize_to : data.face_area.width;
+    ProcessingProfile work_profile = profile;
+    if (adaptive != nullptr)
+        adaptive->choice = ChooseQuality(face_size, adaptive->deadline,
+                                         profile, work_profile);
+    sybie::common::TestTimer matte_timer;
+
+    data.face_area = levels.BuildLevels(
+        data.face_area,
+        up_expand, down_expand, width_expand,
+        face_resize_to > 0 ? cv::Size(face_resize_to, face_resize_to)
+                           : data.face_area.size(), //保持原分辨率
+        work_profile);
+    data.image = levels.image;
+
+    //在抠图分辨率抠图，需要时再放大到输出分辨率
+    cv::Mat matte = temporal != nullptr ?
+        GetAlphaMatteTemporal(levels.GetWorkImage(),
+                              levels.image_grab, levels.image_init,
+                              levels.work_face_area, work_profile,
+                              *temporal, &data.matting_path) :
+        GetAlphaMatte(levels.GetWorkImage(),
+                      levels.image_grab, levels.image_init,
+                      levels.work_face_area, cv::Mat(),
+                      work_profile, &data.matting_path);
+
+    //颜色键抠图和部分结果的耗时不代表模型估计的流程，不用于校正
+    if (adaptive != nullptr &&
+        data.matting_path == MattingPathGrabCut &&
+        !HasStoppedWithPartial())
+        RecordMattingCost(face_size, work_profile,
+                          matte_timer.GetTimeSpan().ToMilliSeconds());
+    if (!levels.image_work.empty())
+        matte = UpsampleMatte(matte, levels.image_work, data.image);
+    data.matte = SparseMatte(matte);
 
     return semi;
 }
 
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile)
+{
+    return ProcessSemi(photo, nullptr, face_resize_to,
+                       MaxUpExpand, MaxDownExpand, MaxWidthExpand,
+                       pyramid, profile);
+}
+
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile)
+{
+    ImagePyramid pyramid;
+    return PortraitProcessSemi(photo, face_resize_to,
+                               crop_size, vertical_offset, pyramid, profile);
+}
+
+/* 执行指定裁剪规格的PortraitProcessSemi，face_area、temporal、adaptive的意义同ProcessSemi
+ */
+static SemiData ProcessSemiCrop(
+    const cv::Mat& photo,
+    const cv::Rect* face_area,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile,
+    TemporalMatte* temporal = nullptr,
+    AdaptiveQuality* adaptive = nullptr)
+{
+    //保持原分辨率时，人脸大小在检测前未知，使用默认的裁剪范围
+    if (face_resize_to <= 0)
+        return ProcessSemi(photo, face_area, face_resize_to,
+                           MaxUpExpand, MaxDownExpand, MaxWidthExpand,
+                           pyramid, profile, temporal, adaptive);
+
+    //裁剪区域（见GetCropArea）在人脸上、下、左右超出的范围，相对人脸大小
+    const double face_size = face_resize_to;
+    const double up = (crop_size.height / 2 - vertical_offset) / face_size - 0.5;
+    const double down = (crop_size.height / 2 + vertical_offset) / face_size - 0.5;
+    const double width = crop_size.width / 2 / face_size - 0.5;
+
+    //加上余量，但不超过默认的裁剪范围
+    return ProcessSemi(
+        photo, face_area, face_resize_to,
+        std::min(std::max(up + CropMargin, MinHeadSpace), MaxUpExpand),
+        std::min(std::max(down + CropMargin, 0.0), MaxDownExpand),
+        std::min(std::max(width + CropMargin, 0.0), MaxWidthExpand),
+        pyramid, profile, temporal, adaptive);
+}
+
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile)
+{
+    return ProcessSemiCrop(photo, nullptr, face_resize_to,
+                           crop_size, vertical_offset, pyramid, profile);
+}
+
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const cv::Rect& face_area,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    ImagePyramid& pyramid,
+    const ProcessingProfile& profile)
+{
+    return ProcessSemiCrop(photo, &face_area, face_resize_to,
+                           crop_size, vertical_offset, pyramid, profile);
+}
+
+SemiData PortraitProcessSemi(
+    const cv::Mat& photo,
+    const cv::Rect& face_area,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    VideoSession& session,
+    const ProcessingProfile& profile)
+{
+    VideoSessionImpl& data = VideoSessionImpl::GetFrom(session);
+    return ProcessSemiCrop(photo, &face_area, face_resize_to,
+                           crop_size, vertical_offset,
+                           data.pyramid, profile, &data.temporal);
+}
+
+SemiData PortraitProcessSemiAdaptive(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const ProcessingProfile& profile,
+    AdaptiveQuality& adaptive)
+{
+    ImagePyramid pyramid;
+    return ProcessSemi(photo, nullptr, face_resize_to,
+                       MaxUpExpand, MaxDownExpand, MaxWidthExpand,
+                       pyramid, profile, nullptr, &adaptive);
+}
+
+SemiData PortraitProcessSemiAdaptive(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile,
+    AdaptiveQuality& adaptive)
+{
+    ImagePyramid pyramid;
+    return ProcessSemiCrop(photo, nullptr, face_resize_to,
+                           crop_size, vertical_offset,
+                           pyramid, profile, nullptr, &adaptive);
+}
+
 void SetStroke(SemiData& semi, const cv::Mat& stroke)
 {
     SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
-    data.matte = GetAlphaMatte(data.image, data.face_area, stroke);
+    //内容没有变化的行块继续与其它副本共享
+    data.matte = SparseMatte(GetAlphaMatteScaled(data.image, data.face_area, stroke,
+                                                 data.profile, &data.matting_path),
+                             data.matte);
+}
+
+void SetStroke(SemiData& semi, const cv::Mat& stroke,
+               const ProcessingProfile& profile)
+{
+    SemiDataImpl::GetFrom(semi).profile = profile;
+    SetStroke(semi, stroke);
 }
 
     static cv::Rect GetCropArea(const cv::Rect face_area,
@@ -141,19 +364,122 @@ void SetStroke(SemiData& semi, const cv::Mat& stroke)
                         crop_size.height);
     }
 
+/* 人脸位置为face_area、图像尺寸为image_size时，
+ * 按crop_size、vertical_offset裁剪是否不需要在除头顶之外的方向扩展。
+ */
+static bool CropFits(
+    const cv::Rect& face_area,
+    const cv::Size& image_size,
+    const cv::Size& crop_size,
+    const int vertical_offset)
+{
+    cv::Rect crop_area = GetCropArea(
+        face_area, crop_size, vertical_offset);
+    return crop_area.x >= 0
+        && crop_area.x + crop_area.width <= image_size.width
+        && crop_area.y + crop_area.height <= image_size.height;
+}
+
 bool CanCropIntegrallty(
     const SemiData& semi,
     const cv::Size& crop_size,
     const int vertical_offset)
 {
     const SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
-    cv::Rect crop_area = GetCropArea(
-        data.face_area, crop_size, vertical_offset);
-    return crop_area.x >= 0
-        && crop_area.x + crop_area.width <= data.image.cols
-        && crop_area.y + crop_area.height <= data.image.rows
-        && data.face_area.y >= data.face_area.height
-                               * 0.3; //经验参数：人脸上方至少预留空间为脸高度的30%
+    return CropFits(data.face_area, data.image.size(), crop_size, vertical_offset)
+        && data.face_area.y >= data.face_area.height * MinHeadSpace;
+}
+
+//ValidatePhoto的参数
+//检测人脸时，照片缩小到最小人脸为这个边长（像素）
+enum { ValidateFaceSize = 40 };
+//计算清晰度和亮度时，人脸缩放到的边长（像素）
+enum { SharpnessFaceSize = 96 };
+//清晰度的下限，经验参数
+const double MinSharpness = 40;
+//人脸平均亮度的范围，经验参数
+const double MinBrightness = 60, MaxBrightness = 200;
+
+PhotoValidation ValidatePhoto(
+    const cv::Mat& photo,
+    const int face_resize_to,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const ProcessingProfile& profile)
+{
+    sybie::common::StatingTestTimer timer("ValidatePhoto");
+    PhotoValidation result;
+    result.issues = PhotoOK;
+    result.face_count = 0;
+    result.sharpness = 0;
+    result.brightness = 0;
+
+    //读取失败等原因得到的空照片
+    if (photo.empty())
+    {
+        result.issues |= PhotoNoFace;
+        return result;
+    }
+
+    //在缩小的照片上检测人脸，只需知道人脸是否多于一个
+    const double scale = std::min(1.0, (double)ValidateFaceSize / profile.detect_min_face_size);
+    cv::Mat small;
+    if (scale < 1)
+        cv::resize(photo, small,
+                   cv::Size(cvRound(photo.cols * scale), cvRound(photo.rows * scale)),
+                   0, 0, cv::INTER_AREA);
+    else
+        small = photo;
+    cv::Mat gray;
+    cv::cvtColor(small, gray, CV_BGR2GRAY);
+    ProcessingProfile detect_profile = profile;
+    detect_profile.detect_min_face_size = cvRound(profile.detect_min_face_size * scale);
+    detect_profile.detect_coarse_face_size = 0; //已经缩小
+    const std::vector<cv::Rect> faces = DetectFaces(gray, detect_profile, 2);
+    result.face_count = std::min((int)faces.size(), 2);
+    if (faces.size() != 1)
+    {
+        result.issues |= faces.empty() ? PhotoNoFace : PhotoTooManyFaces;
+        return result;
+    }
+    const cv::Rect face_area = OverlapArea(ScaleArea(faces[0], 1 / scale),
+                                           WholeArea(photo));
+    result.face_area = face_area;
+
+    //头顶空间
+    if (face_area.y < face_area.height * MinHeadSpace)
+        result.issues |= PhotoNoHeadroom;
+
+    //裁剪：同PortraitProcessSemi，按默认范围切割（只取ROI，不复制），再缩放到face_resize_to
+    cv::Mat cut = photo;
+    const cv::Rect cut_face_area = TryCutPortrait(
+        cut, face_area, MaxUpExpand, MaxDownExpand, MaxWidthExpand);
+    const double resize = face_resize_to > 0 ?
+                          (double)face_resize_to / face_area.width : 1;
+    if (!CropFits(ScaleArea(cut_face_area, resize),
+                  cv::Size(cvRound(cut.cols * resize), cvRound(cut.rows * resize)),
+                  crop_size, vertical_offset))
+        result.issues |= PhotoCannotCrop;
+
+    //人脸的亮度和清晰度，按固定大小计算，不受照片分辨率影响
+    cv::Mat face_gray;
+    cv::cvtColor(photo(face_area), face_gray, CV_BGR2GRAY);
+    cv::resize(face_gray, face_gray, cv::Size(SharpnessFaceSize, SharpnessFaceSize),
+               0, 0, cv::INTER_AREA);
+    result.brightness = cv::mean(face_gray)[0];
+    cv::Mat laplacian;
+    cv::Laplacian(face_gray, laplacian, CV_64F);
+    cv::Scalar mean, deviation;
+    cv::meanStdDev(laplacian, mean, deviation);
+    result.sharpness = deviation[0] * deviation[0];
+
+    if (result.sharpness < MinSharpness)
+        result.issues |= PhotoBlurry;
+    if (result.brightness < MinBrightness)
+        result.issues |= PhotoUnderexposed;
+    if (result.brightness > MaxBrightness)
+        result.issues |= PhotoOverexposed;
+    return result;
 }
 
 cv::Mat PortraitMix(
@@ -162,25 +488,45 @@ cv::Mat PortraitMix(
     const int vertical_offset,
     const cv::Vec3b& back_color,
     const double mix_alpha)
+{
+    cv::Mat result;
+    PortraitMix(semi, result, crop_size, vertical_offset, back_color, mix_alpha);
+    return result;
+}
+
+void PortraitMix(
+    const SemiData& semi,
+    cv::Mat& output,
+    const cv::Size& crop_size,
+    const int vertical_offset,
+    const cv::Vec3b& back_color,
+    const double mix_alpha)
 {
     const SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
     //决定裁剪区域
     cv::Rect crop_area = GetCropArea(
         data.face_area, crop_size, vertical_offset);
-    cv::Rect crop_area_in_image = OverlapArea(crop_area, WholeArea(data.image));
-
-    //替换背景
-    cv::Mat result = Mix(data.image(crop_area_in_image),
-                         data.matte(crop_area_in_image),
-                         back_color, mix_alpha);
 
-    //如果上下左右空间不足，扩展边缘
-    cv::Rect crop_area_extend = SubArea(crop_area, crop_area_in_image);
-    if (!Inside(crop_area_extend, result))
-        Extend(result, crop_area_extend,
-               cv::Scalar(back_color[0], back_color[1], back_color[2]));
+    //替换背景，如果上下左右空间不足，同时扩展边缘
+    MixCrop(data.image, data.matte, crop_area,
+            back_color, mix_alpha, output);
+}
 
-    return result;
+void PortraitMixMulti(
+    const SemiData& semi,
+    const std::vector<MixTarget>& targets,
+    std::vector<cv::Mat>& outputs)
+{
+    const SemiDataImpl& data = SemiDataImpl::GetFrom(semi);
+    std::vector<MixCropTarget> crop_targets(targets.size());
+    for (size_t i = 0 ; i < targets.size() ; i++)
+    {
+        crop_targets[i].area = GetCropArea(
+            data.face_area, targets[i].crop_size, targets[i].vertical_offset);
+        crop_targets[i].back_color = targets[i].back_color;
+        crop_targets[i].mix_alpha = targets[i].mix_alpha;
+    }
+    MixCropMulti(data.image, data.matte, crop_targets, outputs);
 }
 
 cv::Mat PortraitMixFull(
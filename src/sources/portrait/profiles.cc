@@ -0,0 +1,67 @@
+//这是对profiles.hh的实现
+#include "portrait/profiles.hh"
+
+namespace portrait {
+
+ProcessingProfile ProcessingProfile::Fast()
+{
+    ProcessingProfile profile = Balanced();
+    profile.detect_scale_factor = 1.2;
+    profile.detect_coarse_face_size = 24;
+    profile.grabcut_iterations = 2;
+    profile.grabcut_scale = 0.35;
+    profile.grabcut_init_scale = 0.15;
+    profile.matting_front_range = 6;
+    profile.matting_back_range = 15;
+    profile.matting_clusters = 2;
+    return profile;
+}
+
+ProcessingProfile ProcessingProfile::Balanced()
+{
+    ProcessingProfile profile;
+    profile.detect_scale_factor = 1.1;
+    profile.detect_min_face_size = 128;
+    profile.detect_coarse_face_size = 32;
+    profile.face_detector = FaceDetectorOpenCV;
+    profile.matting_face_size = 0;
+    profile.grabcut_iterations = 3;
+    profile.grabcut_scale = 0.5;
+    profile.grabcut_init_scale = 0.2;
+    profile.grabcut_region = GrabCutUndecided;
+    profile.color_key = false; //结果与GrabCut不同，需要时显式开启
+    profile.matting_backend = MattingSampling;
+    profile.matting_front_range = 10;
+    profile.matting_back_range = 30;
+    profile.matting_clusters = 4;
+    return profile;
+}
+
+ProcessingProfile ProcessingProfile::Quality()
+{
+    ProcessingProfile profile = Balanced();
+    profile.detect_scale_factor = 1.05;
+    profile.detect_coarse_face_size = 0;
+    profile.grabcut_iterations = 5;
+    profile.grabcut_scale = 0.75;
+    profile.grabcut_init_scale = 0.3;
+    profile.grabcut_region = GrabCutWholeImage;
+    profile.matting_clusters = 6;
+    return profile;
+}
+
+ProcessingProfile ProcessingProfile::Preview()
+{
+    ProcessingProfile profile = Fast();
+    profile.matting_face_size = 64;
+    profile.grabcut_iterations = 1;
+    profile.grabcut_scale = 1; //抠图分辨率已经很小，GrabCut不再缩小
+    profile.grabcut_init_scale = 0.5;
+    profile.matting_backend = MattingFeather;
+    profile.matting_front_range = 2;
+    profile.matting_back_range = 2;
+    profile.matting_clusters = 1;
+    return profile;
+}
+
+}  //namespace portrait
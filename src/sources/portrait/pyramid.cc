@@ -0,0 +1,97 @@
+//这是对pyramid.hh的实现
+#include "portrait/pyramid.hh"
+
+#include "portrait/algorithm.hh"
+#include "portrait/graphics.hh"
+
+namespace portrait {
+
+/* 如果mat的内存空间同时被其它Mat引用（例如已交给SemiData），
+ * 则放弃这块空间，下次写入时重新分配，避免改写别人持有的数据。
+ */
+static void ReleaseIfShared(cv::Mat& mat)
+{
+    if (mat.refcount != nullptr && *mat.refcount > 1)
+        mat.release();
+}
+
+void ImagePyramidImpl::SetPhoto(const cv::Mat& photo)
+{
+    this->photo = photo;
+    gray_ready = false;
+}
+
+const cv::Mat& ImagePyramidImpl::GetGray()
+{
+    if (!gray_ready)
+    {
+        cv::cvtColor(photo, gray, CV_BGR2GRAY);
+        gray_ready = true;
+    }
+    return gray;
+}
+
+cv::Rect ImagePyramidImpl::BuildLevels(
+    const cv::Rect& face_area,
+    const double max_up_expand,
+    const double max_down_expand,
+    const double max_width_expand,
+    const cv::Size& face_resize_to,
+    const ProcessingProfile& profile)
+{
+    cv::Mat cut = photo; //只是ROI，不复制
+    cv::Rect cut_face_area = TryCutPortrait(
+        cut, face_area,
+        max_up_expand, max_down_expand, max_width_expand);
+
+    ReleaseIfShared(image);
+    cv::Rect resized_face_area = ResizeFace(
+        cut, cut_face_area, face_resize_to, image);
+
+    //抠图分辨率低于输出分辨率时，另外缩小一层
+    const double scale = GetMattingScale(resized_face_area, profile);
+    if (scale < 1)
+    {
+        cv::resize(image, image_work,
+                   cv::Size(cvRound(image.cols * scale), cvRound(image.rows * scale)),
+                   0, 0, cv::INTER_AREA);
+        work_face_area = OverlapArea(ScaleArea(resized_face_area, scale),
+                                     WholeArea(image_work));
+    }
+    else
+    {
+        image_work.release();
+        work_face_area = resized_face_area;
+    }
+
+    ResizeForGrabCut(GetWorkImage(), image_grab, image_init, profile);
+    return resized_face_area;
+}
+
+ImagePyramid::ImagePyramid()
+    : _data(new ImagePyramidImpl())
+{ }
+
+ImagePyramid::ImagePyramid(ImagePyramid&& another) throw()
+    : _data(nullptr)
+{
+    Swap(another);
+}
+
+ImagePyramid::~ImagePyramid() throw()
+{
+    delete _data;
+}
+
+ImagePyramid& ImagePyramid::operator=(ImagePyramid&& another) throw()
+{
+    Swap(another);
+    return *this;
+}
+
+void ImagePyramid::Swap(ImagePyramid& another) throw()
+{
+    std::swap(_data, another._data);
+}
+
+}  //namespace portrait
@@ -0,0 +1,299 @@
+//这是对SemiData::Serialize和SemiData::Deserialize的实现
+#include "portrait/processing.hh"
+
+#include <cstdint>
+#include <cstring>
+
+#include "snappy.h"
+
+#include "portrait/exception.hh"
+#include "portrait/semidata.hh"
+
+namespace portrait {
+
+/* 数据格式（所有整数都是32位小端序）：
+ * 文件头（HeaderSize字节）：
+ *   magic[4] = "PSMD"
+ *   version             格式版本，当前为SemiDataVersion
+ *   rows, cols          图像尺寸
+ *   face_area           x, y, width, height
+ *   band_count          半透明像素（0 < alpha < 255）的个数
+ *   section_count       段数，当前为SectionCount
+ *   sections[3]         每段的offset, size
+ * 段（起始位置按SectionAlign对齐，便于mmap后直接访问）：
+ *   SectionImage        图像BGR，snappy压缩
+ *   SectionAlpha        Alpha平面，先按PackBits行程编码，再snappy压缩
+ *   SectionBand         半透明像素的背景色BGR，按行优先顺序排列，snappy压缩
+ * alpha为0的像素背景色就是图像颜色，alpha为255的像素背景色不参与混合，
+ * 因此只需保存半透明像素的背景色。
+ */
+static const char SemiDataMagic[4] = {'P', 'S', 'M', 'D'};
+enum
+{
+    SemiDataVersion = 1,
+    SectionAlign = 64
+};
+enum Section
+{
+    SectionImage = 0,
+    SectionAlpha = 1,
+    SectionBand = 2,
+    SectionCount = 3
+};
+/* snappy解压后的长度不超过压缩长度的这个倍数：最省的复制操作用3字节表示64字节，
+ * 约21倍，取32留余量。用于在分配内存之前拒绝声明了过大长度的数据。
+ */
+enum { MaxSnappyExpansion = 32 };
+enum
+{
+    HeaderFields = 9, //version到section_count
+    HeaderSize = 4 + HeaderFields * 4 + SectionCount * 8
+};
+
+namespace {  //数据读写
+
+    void PutU32(std::string& blob, size_t pos, uint32_t value)
+    {
+        for (int i = 0 ; i < 4 ; i++)
+            blob[pos + i] = (char)((value >> (i * 8)) & 0xff);
+    }
+
+    uint32_t GetU32(const uint8_t* bytes)
+    {
+        return (uint32_t)bytes[0]
+            | ((uint32_t)bytes[1] << 8)
+            | ((uint32_t)bytes[2] << 16)
+            | ((uint32_t)bytes[3] << 24);
+    }
+
+    void Check(bool condition)
+    {
+        if (!condition)
+            throw Error(InvalidData);
+    }
+
+    /* 把input压缩后追加到blob末尾（先补齐到SectionAlign），
+     * 返回段的起始位置和长度。
+     */
+    std::pair<uint32_t, uint32_t> AppendSection(
+        std::string& blob, const char* input, size_t length)
+    {
+        size_t offset = (blob.size() + SectionAlign - 1) / SectionAlign * SectionAlign;
+        blob.resize(offset + snappy::MaxCompressedLength(length));
+        size_t compressed_length;
+        snappy::RawCompress(input, length, &blob[offset], &compressed_length);
+        blob.resize(offset + compressed_length);
+        return std::make_pair((uint32_t)offset, (uint32_t)compressed_length);
+    }
+
+    /* 一段数据解压后的长度（段头中声明的值），
+     * 超出压缩长度能解压出的范围时视为数据损坏。
+     */
+    size_t SectionLength(const char* section, size_t section_size)
+    {
+        size_t length;
+        Check(snappy::GetUncompressedLength(section, section_size, &length));
+        Check(length / MaxSnappyExpansion <= section_size);
+        return length;
+    }
+
+    /* 解压一段数据到output，output必须正好是length字节。
+     */
+    void UncompressSection(const char* section, size_t section_size,
+                           char* output, size_t length)
+    {
+        Check(SectionLength(section, section_size) == length);
+        Check(snappy::RawUncompress(section, section_size, output));
+    }
+
+} //namespace 数据读写
+
+namespace {  //Alpha行程编码（PackBits）
+
+    /* 编码：每段以一个控制字节开始，
+     * 0 ~ 127：其后有(控制字节+1)个原样的字节；
+     * 129 ~ 255：其后一个字节重复(257-控制字节)次。
+     * alpha通常大片为0或255，只有边缘附近是渐变值。
+     */
+    void PackBits(const uint8_t* src, size_t length, std::string& output)
+    {
+        size_t i = 0;
+        while (i < length)
+        {
+            size_t run = 1;
+            while (i + run < length && run < 128 && src[i + run] == src[i])
+                run++;
+            if (run >= 3)
+            {
+                output.push_back((char)(257 - run));
+                output.push_back((char)src[i]);
+                i += run;
+                continue;
+            }
+
+            //原样字节，直到遇到至少3个重复的字节
+            size_t literal_end = i;
+            while (literal_end < length && literal_end - i < 128)
+            {
+                if (literal_end + 2 < length
+                    && src[literal_end] == src[literal_end + 1]
+                    && src[literal_end] == src[literal_end + 2])
+                    break;
+                literal_end++;
+            }
+            output.push_back((char)(literal_end - i - 1));
+            output.append((const char*)src + i, literal_end - i);
+            i = literal_end;
+        }
+    }
+
+    /* 解码PackBits到dst，共length个字节。
+     */
+    void UnpackBits(const uint8_t* src, size_t src_length,
+                    uint8_t* dst, size_t length)
+    {
+        const uint8_t* src_end = src + src_length;
+        size_t i = 0;
+        while (src < src_end)
+        {
+            const int control = *src++;
+            if (control < 128)
+            {
+                size_t count = control + 1;
+                Check(src_end - src >= (ptrdiff_t)count && i + count <= length);
+                for (size_t k = 0 ; k < count ; k++, i++)
+                    dst[i] = *src++;
+            }
+            else if (control > 128)
+            {
+                size_t count = 257 - control;
+                Check(src < src_end && i + count <= length);
+                const uint8_t value = *src++;
+                for (size_t k = 0 ; k < count ; k++, i++)
+                    dst[i] = value;
+            }
+        }
+        Check(i == length);
+    }
+
+} //namespace Alpha行程编码
+
+std::string SemiData::Serialize() const
+{
+    const cv::Mat image = _data->image.isContinuous()
+                          ? _data->image : _data->image.clone();
+    cv::Mat alpha;
+    _data->matte.CopyAlphaTo(alpha);
+    std::vector<cv::Vec3b> band;
+    _data->matte.CopyColorsTo(band);
+    const uint32_t band_count = (uint32_t)band.size();
+    const cv::Rect& face_area = _data->face_area;
+    const size_t pixel_count = (size_t)image.rows * image.cols;
+
+    std::string alpha_rle;
+    PackBits(alpha.data, pixel_count, alpha_rle);
+
+    std::string blob(HeaderSize, '\0');
+    std::pair<uint32_t, uint32_t> sections[SectionCount];
+    sections[SectionImage] = AppendSection(
+        blob, (const char*)image.data, pixel_count * 3);
+    sections[SectionAlpha] = AppendSection(
+        blob, alpha_rle.data(), alpha_rle.size());
+    sections[SectionBand] = AppendSection(
+        blob, (const char*)band.data(), band.size() * 3);
+
+    const uint32_t fields[HeaderFields] = {
+        SemiDataVersion,
+        (uint32_t)image.rows, (uint32_t)image.cols,
+        (uint32_t)face_area.x, (uint32_t)face_area.y,
+        (uint32_t)face_area.width, (uint32_t)face_area.height,
+        band_count,
+        SectionCount
+    };
+    memcpy(&blob[0], SemiDataMagic, 4);
+    for (int i = 0 ; i < HeaderFields ; i++)
+        PutU32(blob, 4 + i * 4, fields[i]);
+    for (int i = 0 ; i < SectionCount ; i++)
+    {
+        PutU32(blob, 4 + HeaderFields * 4 + i * 8, sections[i].first);
+        PutU32(blob, 4 + HeaderFields * 4 + i * 8 + 4, sections[i].second);
+    }
+    return blob;
+}
+
+SemiData SemiData::Deserialize(const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    Check(size >= HeaderSize && memcmp(bytes, SemiDataMagic, 4) == 0);
+    uint32_t fields[HeaderFields];
+    for (int i = 0 ; i < HeaderFields ; i++)
+        fields[i] = GetU32(bytes + 4 + i * 4);
+    Check(fields[0] == SemiDataVersion && fields[8] == SectionCount);
+
+    const char* sections[SectionCount];
+    size_t section_sizes[SectionCount];
+    for (int i = 0 ; i < SectionCount ; i++)
+    {
+        const uint32_t offset = GetU32(bytes + 4 + HeaderFields * 4 + i * 8);
+        const uint32_t length = GetU32(bytes + 4 + HeaderFields * 4 + i * 8 + 4);
+        Check(offset >= HeaderSize && offset <= size && length <= size - offset);
+        sections[i] = (const char*)bytes + offset;
+        section_sizes[i] = length;
+    }
+
+    const int rows = (int)fields[1];
+    const int cols = (int)fields[2];
+    const uint32_t band_count = fields[7];
+    Check(rows >= 0 && cols >= 0);
+    Check(cols == 0 || (size_t)rows <= SIZE_MAX / 3 / cols);
+    const size_t pixel_count = (size_t)rows * cols;
+    Check(band_count <= pixel_count);
+    //分配内存之前，先按各段声明的解压长度检查尺寸，
+    //损坏的数据不会因为rows、cols过大而分配大量内存
+    Check(SectionLength(sections[SectionImage], section_sizes[SectionImage])
+          == pixel_count * 3);
+    Check(SectionLength(sections[SectionBand], section_sizes[SectionBand])
+          == (size_t)band_count * 3);
+
+    SemiData semi = SemiDataImpl::NewWrapper();
+    SemiDataImpl& impl = SemiDataImpl::GetFrom(semi);
+    impl.face_area = cv::Rect((int)fields[3], (int)fields[4],
+                              (int)fields[5], (int)fields[6]);
+    //人脸位置之后用于裁剪（GetCropArea）和取ROI，必须在图像以内（同Inside，
+    //但按减法比较，数据损坏时x + width不会溢出）
+    const cv::Rect& face = impl.face_area;
+    Check(face.x >= 0 && face.y >= 0 && face.width > 0 && face.height > 0 &&
+          face.width <= cols - face.x && face.height <= rows - face.y);
+    impl.profile = ProcessingProfile::Balanced(); //处理参数不保存，SetStroke时使用默认值
+    impl.matting_path = MattingPathGrabCut; //抠图流程不保存
+
+    //图像直接解压到Mat
+    impl.image.create(rows, cols, CV_8UC3);
+    UncompressSection(sections[SectionImage], section_sizes[SectionImage],
+                      (char*)impl.image.data, pixel_count * 3);
+
+    //Alpha解码到Alpha平面
+    cv::Mat alpha(rows, cols, CV_8UC1);
+    {
+        std::string alpha_rle;
+        const size_t length = SectionLength(sections[SectionAlpha],
+                                            section_sizes[SectionAlpha]);
+        Check(length <= pixel_count * 2 + 1); //PackBits最坏情况
+        alpha_rle.resize(length);
+        UncompressSection(sections[SectionAlpha], section_sizes[SectionAlpha],
+                          &alpha_rle[0], length);
+        UnpackBits((const uint8_t*)alpha_rle.data(), alpha_rle.size(),
+                   alpha.data, pixel_count);
+    }
+
+    //半透明像素的背景色
+    std::vector<cv::Vec3b> band(band_count);
+    UncompressSection(sections[SectionBand], section_sizes[SectionBand],
+                      (char*)band.data(), band.size() * 3);
+    impl.matte = SparseMatte::FromAlpha(alpha, band);
+    Check(impl.matte.GetSize() == alpha.size());
+
+    return semi;
+}
+
+}  //namespace portrait
@@ -0,0 +1,168 @@
+//这是对sparsematte.hh的实现
+#include "portrait/sparsematte.hh"
+
+#include <cassert>
+#include <cstring>
+
+namespace portrait {
+
+//需要保存背景色的Alpha值
+static inline bool IsBand(uint8_t alpha)
+{
+    return alpha > 0 && alpha < 255;
+}
+
+/* 按tile.alpha划分半透明区间，返回半透明像素的个数。
+ */
+static int BuildSpans(MatteTile& tile)
+{
+    const cv::Mat& alpha = tile.alpha;
+    tile.spans.clear();
+    tile.row_spans.assign(1, 0);
+    int color_count = 0;
+    for (int y = 0 ; y < alpha.rows ; y++)
+    {
+        const uint8_t* alpha_row = alpha.ptr<uint8_t>(y);
+        int x = 0;
+        while (x < alpha.cols)
+        {
+            if (!IsBand(alpha_row[x]))
+            {
+                x++;
+                continue;
+            }
+            MatteSpan span;
+            span.begin = x;
+            span.color = color_count;
+            while (x < alpha.cols && IsBand(alpha_row[x]))
+                x++;
+            span.end = x;
+            color_count += span.end - span.begin;
+            tile.spans.push_back(span);
+        }
+        tile.row_spans.push_back((int)tile.spans.size());
+    }
+    return color_count;
+}
+
+//从matte（CV_8UC4）第begin到end行（不含）生成一个行块
+static std::shared_ptr<const MatteTile> MakeTile(
+    const cv::Mat& matte, int begin, int end)
+{
+    std::shared_ptr<MatteTile> tile = std::make_shared<MatteTile>();
+    const cv::Mat band = matte.rowRange(begin, end);
+    tile->alpha.create(end - begin, matte.cols, CV_8UC1);
+    int from_to[] = {3, 0};
+    cv::mixChannels(&band, 1, &tile->alpha, 1, from_to, 1);
+
+    tile->colors.resize(BuildSpans(*tile));
+    for (int r = 0 ; r < band.rows ; r++)
+    {
+        const cv::Vec4b* matte_row = band.ptr<cv::Vec4b>(r);
+        for (int i = tile->row_spans[r] ; i < tile->row_spans[r + 1] ; i++)
+        {
+            const MatteSpan& span = tile->spans[i];
+            for (int x = span.begin ; x < span.end ; x++)
+            {
+                const cv::Vec4b& pixel = matte_row[x];
+                tile->colors[span.color + x - span.begin] =
+                    cv::Vec3b(pixel[0], pixel[1], pixel[2]);
+            }
+        }
+    }
+    return tile;
+}
+
+//两个行块的内容是否相同
+static bool SameTile(const MatteTile& a, const MatteTile& b)
+{
+    if (a.alpha.size() != b.alpha.size() || a.colors != b.colors)
+        return false;
+    for (int y = 0 ; y < a.alpha.rows ; y++)
+        if (memcmp(a.alpha.ptr<uint8_t>(y), b.alpha.ptr<uint8_t>(y), a.alpha.cols) != 0)
+            return false;
+    return true;
+}
+
+SparseMatte::SparseMatte()
+    : _size(0, 0), _tiles()
+{ }
+
+SparseMatte::SparseMatte(const cv::Mat& matte)
+    : SparseMatte(matte, SparseMatte())
+{ }
+
+SparseMatte::SparseMatte(const cv::Mat& matte, const SparseMatte& previous)
+    : _size(matte.size()), _tiles()
+{
+    assert(matte.type() == CV_8UC4);
+    const bool can_share = previous._size == _size;
+    for (int y = 0 ; y < matte.rows ; y += TileRows)
+    {
+        std::shared_ptr<const MatteTile> tile =
+            MakeTile(matte, y, std::min(y + TileRows, matte.rows));
+        if (can_share)
+        {
+            const std::shared_ptr<const MatteTile>& old_tile =
+                previous._tiles[_tiles.size()];
+            if (SameTile(*tile, *old_tile))
+                tile = old_tile; //内容没有变化，共享原来的行块
+        }
+        _tiles.push_back(tile);
+    }
+}
+
+SparseMatte SparseMatte::FromAlpha(const cv::Mat& alpha,
+                                   const std::vector<cv::Vec3b>& colors)
+{
+    assert(alpha.type() == CV_8UC1);
+    SparseMatte result;
+    result._size = alpha.size();
+    size_t color_begin = 0;
+    for (int y = 0 ; y < alpha.rows ; y += TileRows)
+    {
+        std::shared_ptr<MatteTile> tile = std::make_shared<MatteTile>();
+        tile->alpha = alpha.rowRange(y, std::min(y + TileRows, alpha.rows));
+        const size_t color_count = BuildSpans(*tile);
+        if (color_count > colors.size() - color_begin)
+            return SparseMatte();
+        tile->colors.assign(colors.begin() + color_begin,
+                            colors.begin() + color_begin + color_count);
+        color_begin += color_count;
+        result._tiles.push_back(tile);
+    }
+    if (color_begin != colors.size())
+        return SparseMatte();
+    return result;
+}
+
+size_t SparseMatte::GetColorCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0 ; i < _tiles.size() ; i++)
+        count += _tiles[i]->colors.size();
+    return count;
+}
+
+void SparseMatte::CopyAlphaTo(cv::Mat& alpha) const
+{
+    alpha.create(_size, CV_8UC1);
+    for (size_t i = 0 ; i < _tiles.size() ; i++)
+    {
+        const cv::Mat& tile_alpha = _tiles[i]->alpha;
+        const int begin = (int)i * TileRows;
+        cv::Mat dst = alpha.rowRange(begin, begin + tile_alpha.rows);
+        tile_alpha.copyTo(dst);
+    }
+}
+
+void SparseMatte::CopyColorsTo(std::vector<cv::Vec3b>& colors) const
+{
+    colors.clear();
+    colors.reserve(GetColorCount());
+    for (size_t i = 0 ; i < _tiles.size() ; i++)
+        colors.insert(colors.end(),
+                      _tiles[i]->colors.begin(), _tiles[i]->colors.end());
+}
+
+}  //namespace portrait
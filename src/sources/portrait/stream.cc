@@ -0,0 +1,314 @@
+#include "portrait/stream.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+
+#include "sybie/common/Time.hh" //sybie::common::DateTime sybie::common::TestTimer
+#include "sybie/common/Uncopyable.hh"
+
+#include "portrait/facedetect.hh"
+#include "portrait/mailbox.hh"
+
+namespace portrait {
+
+namespace {  //StreamPipeline使用的组件
+
+    //在阶段之间传递的一帧
+    struct StreamItem
+    {
+        int64_t frame_id;
+        sybie::common::DateTime captured; //读取的时间
+        cv::Mat frame;
+        TrackingResult tracking;
+        SemiData semi;
+    };
+
+    //一个阶段的计数，各阶段的线程写入，调用者读取
+    class StageCounter : sybie::common::Uncopyable
+    {
+    public:
+        StageCounter()
+            : _processed(0), _failed(0), _total_us(0), _last_us(0)
+        { }
+
+        void Record(const sybie::common::TimeSpan& span)
+        {
+            const int64_t us = (int64_t)(span.ToMilliSeconds() * 1000);
+            _last_us = us;
+            _total_us += us;
+            _processed++;
+        }
+
+        void Fail()
+        {
+            _failed++;
+        }
+
+        StreamStageStats Get(int64_t dropped) const
+        {
+            StreamStageStats stats;
+            stats.processed = _processed;
+            stats.dropped = dropped;
+            stats.failed = _failed;
+            stats.last_ms = _last_us / 1000.0;
+            stats.mean_ms = stats.processed > 0 ? _total_us / 1000.0 / stats.processed : 0;
+            return stats;
+        }
+    private:
+        std::atomic<int64_t> _processed;
+        std::atomic<int64_t> _failed;
+        std::atomic<int64_t> _total_us;
+        std::atomic<int64_t> _last_us;
+    }; //class StageCounter
+
+    //覆盖所有targets的裁剪规格（人脸上、下和左右所需范围的最大值）
+    void UnionCrop(const std::vector<MixTarget>& targets,
+                   cv::Size& crop_size, int& vertical_offset)
+    {
+        int width = 0, up = 0, down = 0;
+        for (size_t i = 0 ; i < targets.size() ; i++)
+        {
+            const MixTarget& target = targets[i];
+            width = std::max(width, target.crop_size.width);
+            up = std::max(up, target.crop_size.height / 2 - target.vertical_offset);
+            down = std::max(down, target.crop_size.height / 2 + target.vertical_offset);
+        }
+        crop_size = cv::Size(width, up + down);
+        vertical_offset = (down - up) / 2;
+    }
+
+} //namespace StreamPipeline使用的组件
+
+struct StreamPipelineImpl : sybie::common::Uncopyable
+{
+public:
+    StreamPipelineImpl(const StreamPipeline::FrameSource& source,
+                       const int face_resize_to,
+                       const std::vector<MixTarget>& targets,
+                       const ProcessingProfile& profile)
+        : source(source), face_resize_to(face_resize_to),
+          targets(targets), profile(profile),
+          crop_size(), vertical_offset(0),
+          stopping(false), capturing(true),
+          detect_input(), matte_input(), mix_input(), previews(), results(),
+          counters(), threads()
+    {
+        UnionCrop(targets, crop_size, vertical_offset);
+        InitFaceDetect(); //各线程开始前初始化
+        threads.push_back(std::thread(&StreamPipelineImpl::Capture, this));
+        threads.push_back(std::thread(&StreamPipelineImpl::Detect, this));
+        threads.push_back(std::thread(&StreamPipelineImpl::Matte, this));
+        threads.push_back(std::thread(&StreamPipelineImpl::Mix, this));
+    }
+
+    ~StreamPipelineImpl()
+    {
+        Stop();
+    }
+
+    void Stop()
+    {
+        stopping = true;
+        detect_input.Wake();
+        matte_input.Wake();
+        mix_input.Wake();
+        for (size_t i = 0 ; i < threads.size() ; i++)
+            if (threads[i].joinable())
+                threads[i].join();
+    }
+
+    StreamStageStats GetStats(StreamStage stage) const
+    {
+        switch (stage)
+        {
+        case StreamDetect:
+            return counters[stage].Get(detect_input.GetDropped());
+        case StreamMatte:
+            return counters[stage].Get(matte_input.GetDropped());
+        case StreamMix:
+            return counters[stage].Get(mix_input.GetDropped());
+        default:
+            return counters[stage].Get(0);
+        }
+    }
+
+private:
+    void Capture()
+    {
+        for (int64_t frame_id = 0 ; !stopping ; frame_id++)
+        {
+            std::unique_ptr<StreamItem> item(new StreamItem());
+            item->frame_id = frame_id;
+            sybie::common::TestTimer timer;
+            try
+            {
+                if (!source(item->frame))
+                    break;
+            }
+            catch (std::exception&)
+            {
+                counters[StreamCapture].Fail();
+                break;
+            }
+            item->captured = sybie::common::DateTime::Now();
+            counters[StreamCapture].Record(timer.GetTimeSpan());
+            detect_input.Put(std::move(item));
+        }
+        capturing = false;
+    }
+
+    void Detect()
+    {
+        FaceTracker tracker(profile);
+        while (!stopping)
+        {
+            std::unique_ptr<StreamItem> item = detect_input.Take();
+            if (item == nullptr)
+                continue;
+            sybie::common::TestTimer timer;
+            try
+            {
+                item->tracking = tracker.Track(item->frame);
+            }
+            catch (std::exception&)
+            {
+                counters[StreamDetect].Fail();
+                continue;
+            }
+            counters[StreamDetect].Record(timer.GetTimeSpan());
+
+            std::unique_ptr<StreamPreview> preview(new StreamPreview());
+            preview->frame_id = item->frame_id;
+            preview->frame = item->frame;
+            preview->tracking = item->tracking;
+            previews.Put(std::move(preview));
+            if (item->tracking.found)
+                matte_input.Put(std::move(item));
+        }
+    }
+
+    void Matte()
+    {
+        VideoSession session; //各帧共用，并复用上一帧的抠图结果
+        while (!stopping)
+        {
+            std::unique_ptr<StreamItem> item = matte_input.Take();
+            if (item == nullptr)
+                continue;
+            sybie::common::TestTimer timer;
+            try
+            {
+                item->semi = PortraitProcessSemi(
+                    item->frame, item->tracking.face, face_resize_to,
+                    crop_size, vertical_offset, session, profile);
+            }
+            catch (std::exception&)
+            {
+                counters[StreamMatte].Fail();
+                continue;
+            }
+            counters[StreamMatte].Record(timer.GetTimeSpan());
+            mix_input.Put(std::move(item));
+        }
+    }
+
+    void Mix()
+    {
+        while (!stopping)
+        {
+            std::unique_ptr<StreamItem> item = mix_input.Take();
+            if (item == nullptr)
+                continue;
+            sybie::common::TestTimer timer;
+            std::unique_ptr<StreamResult> result(new StreamResult());
+            try
+            {
+                PortraitMixMulti(item->semi, targets, result->outputs);
+            }
+            catch (std::exception&)
+            {
+                counters[StreamMix].Fail();
+                continue;
+            }
+            counters[StreamMix].Record(timer.GetTimeSpan());
+            result->frame_id = item->frame_id;
+            result->frame = item->frame;
+            result->face = item->tracking.face;
+            result->latency_ms = (sybie::common::DateTime::Now() - item->captured)
+                                 .ToMilliSeconds();
+            results.Put(std::move(result));
+        }
+    }
+
+public:
+    const StreamPipeline::FrameSource source;
+    const int face_resize_to;
+    const std::vector<MixTarget> targets;
+    const ProcessingProfile profile;
+    cv::Size crop_size;  //覆盖所有targets的裁剪规格
+    int vertical_offset;
+
+    std::atomic<bool> stopping;
+    std::atomic<bool> capturing;
+    //各阶段的输入
+    Mailbox<StreamItem> detect_input;
+    Mailbox<StreamItem> matte_input;
+    Mailbox<StreamItem> mix_input;
+    //调用者取得的结果
+    Mailbox<StreamPreview> previews;
+    Mailbox<StreamResult> results;
+
+    StageCounter counters[StreamStageCount];
+    std::vector<std::thread> threads;
+}; //struct StreamPipelineImpl
+
+StreamPipeline::StreamPipeline(
+    const FrameSource& source,
+    const int face_resize_to,
+    const std::vector<MixTarget>& targets,
+    const ProcessingProfile& profile)
+    : _data(new StreamPipelineImpl(source, face_resize_to, targets, profile))
+{ }
+
+StreamPipeline::~StreamPipeline() throw()
+{
+    delete _data;
+}
+
+bool StreamPipeline::TryGetPreview(StreamPreview& preview)
+{
+    std::unique_ptr<StreamPreview> item = _data->previews.TryTake();
+    if (item == nullptr)
+        return false;
+    preview = std::move(*item);
+    return true;
+}
+
+bool StreamPipeline::TryGetResult(StreamResult& result)
+{
+    std::unique_ptr<StreamResult> item = _data->results.TryTake();
+    if (item == nullptr)
+        return false;
+    result = std::move(*item);
+    return true;
+}
+
+StreamStageStats StreamPipeline::GetStats(StreamStage stage) const
+{
+    return _data->GetStats(stage);
+}
+
+bool StreamPipeline::IsRunning() const
+{
+    return _data->capturing;
+}
+
+void StreamPipeline::Stop()
+{
+    _data->Stop();
+}
+
+}  //namespace portrait
@@ -0,0 +1,85 @@
+#include "portrait/tracking.hh"
+
+#include <cassert>
+#include <cstdlib>
+
+#include "sybie/common/Time.hh" //sybie::common::TestTimer
+
+#include "portrait/facedetect.hh"
+#include "portrait/graphics.hh"
+
+namespace portrait {
+
+//跟踪的搜索范围：在预测位置的四周扩展的比例（相对人脸大小），另加上一帧的位移
+const double TrackMargin = 0.25;
+//搜索范围的上限（相对人脸大小），位移过大时视为跟踪丢失，由整帧检测处理
+const double MaxTrackMargin = 1.0;
+
+FaceTracker::FaceTracker(const ProcessingProfile& profile)
+    : _profile(profile), _tracking(false), _face(), _motion(), _gray()
+{ }
+
+void FaceTracker::Reset()
+{
+    _tracking = false;
+    _motion = cv::Point();
+}
+
+TrackingResult FaceTracker::Track(const cv::Mat& frame)
+{
+    assert(frame.type() == CV_8UC3);
+    sybie::common::TestTimer timer;
+    cv::cvtColor(frame, _gray, CV_BGR2GRAY);
+
+    TrackingResult result;
+    result.found = false;
+    result.face_count = 0;
+    result.full_detection = false;
+
+    if (_tracking)
+    {
+        //按上一帧的位移预测位置，位移越大搜索范围越大
+        const cv::Rect predicted = _face + _motion;
+        const double margin = std::min(
+            MaxTrackMargin,
+            TrackMargin + (double)std::max(std::abs(_motion.x), std::abs(_motion.y))
+                          / _face.width);
+        cv::Rect face;
+        if (TrackFace(_gray, predicted, margin, _profile, face))
+        {
+            result.found = true;
+            result.face = face;
+            result.face_count = 1;
+        }
+    }
+
+    if (!result.found)
+    {
+        //首帧或跟踪丢失：整帧检测，只需知道人脸是否多于一个
+        const std::vector<cv::Rect> faces = DetectFaces(_gray, _profile, 2);
+        result.full_detection = true;
+        result.face_count = std::min((int)faces.size(), 2);
+        if (faces.size() == 1)
+        {
+            result.found = true;
+            result.face = faces[0];
+        }
+    }
+
+    if (result.found)
+    {
+        _motion = _tracking && !result.full_detection ?
+                  CenterOf(result.face) - CenterOf(_face) : cv::Point();
+        _face = result.face;
+        _tracking = true;
+    }
+    else
+    {
+        Reset();
+    }
+
+    result.milliseconds = timer.GetTimeSpan().ToMilliSeconds();
+    return result;
+}
+
+}  //namespace portrait
@@ -0,0 +1,47 @@
+//这是对video.hh的实现
+#include "portrait/video.hh"
+
+namespace portrait {
+
+VideoSession::VideoSession()
+    : _data(new VideoSessionImpl())
+{ }
+
+VideoSession::VideoSession(VideoSession&& another) throw()
+    : _data(nullptr)
+{
+    Swap(another);
+}
+
+VideoSession::~VideoSession() throw()
+{
+    delete _data;
+}
+
+VideoSession& VideoSession::operator=(VideoSession&& another) throw()
+{
+    Swap(another);
+    return *this;
+}
+
+void VideoSession::Swap(VideoSession& another) throw()
+{
+    std::swap(_data, another._data);
+}
+
+void VideoSession::Reset()
+{
+    _data->temporal.Reset();
+}
+
+bool VideoSession::IsLastReused() const
+{
+    return _data->temporal.reused;
+}
+
+double VideoSession::GetLastChangedRatio() const
+{
+    return _data->temporal.changed_ratio;
+}
+
+}  //namespace portrait
@@ -0,0 +1,267 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <exception>
+
+#include "opencv2/opencv.hpp"
+
+#include "portrait/portrait.hh"
+#include "portrait/algorithm.hh"
+#include "portrait/facedetect.hh"
+#include "portrait/graphics.hh"
+#include "portrait/matting.hh"
+#include "sybie/common/Time.hh"
+
+namespace portrait {
+
+//测量人脸检测（直接检测、先粗后精、HaarCascade与旧格式分类器）、GrabCut（只对未确定区域与对整个图像）
+//和边缘混合（MatBorder与GuidedMatte）的耗时，并比较两种GrabCut范围、两种边缘混合算法结果的差异
+enum { FaceResizeTo = 200 };
+enum { Repeat = 5 }; //每张照片每种算法的执行次数
+
+//两个抠图结果Alpha的差异
+struct AlphaError
+{
+    double mean_all;    //全图的平均绝对误差
+    double mean_border; //边缘区域（MakeTrimap的未确定区域）的平均绝对误差
+};
+
+static AlphaError CompareAlpha(const cv::Mat& matte, const cv::Mat& reference,
+                               const cv::Mat& trimap)
+{
+    cv::Mat alpha, alpha_ref, diff;
+    cv::extractChannel(matte, alpha, 3);
+    cv::extractChannel(reference, alpha_ref, 3);
+    cv::absdiff(alpha, alpha_ref, diff);
+    AlphaError error;
+    error.mean_all = cv::mean(diff)[0];
+    error.mean_border = cv::mean(diff, trimap == 127)[0];
+    return error;
+}
+
+//两个GrabCut结果中前景判断不同的像素比例（%）
+static double CompareMask(const cv::Mat& mask, const cv::Mat& reference)
+{
+    int64_t count = 0;
+    for (int r = 0 ; r < mask.rows ; r++)
+    {
+        const uint8_t* mask_row = mask.ptr<uint8_t>(r);
+        const uint8_t* reference_row = reference.ptr<uint8_t>(r);
+        for (int c = 0 ; c < mask.cols ; c++)
+            if (IsFront(mask_row[c]) != IsFront(reference_row[c]))
+                count++;
+    }
+    return count * 100.0 / mask.total();
+}
+
+//执行Repeat次人脸检测，返回平均耗时（毫秒）
+static double TimeDetection(const cv::Mat& photo, const ProcessingProfile& profile)
+{
+    cv::Mat gray;
+    cv::cvtColor(photo, gray, CV_BGR2GRAY);
+    sybie::common::TestTimer timer;
+    for (int i = 0 ; i < Repeat ; i++)
+        DetectFaces(gray, profile);
+    return timer.GetTimeSpan().ToMilliSeconds() / Repeat;
+}
+
+//按不同的分辨率（百万像素）比较直接检测和先粗后精检测的耗时
+const double DetectMegapixels[] = {1, 12, 48};
+
+/* 转换前的OpenCV 1.x格式分类器（同make/common/Makefile的HAAR_CASCADE_XML），
+ * 可用环境变量PORTRAIT_OLD_CASCADE指定，用于比较转换前后（cvHaarDetectObjects与新式特征计算器）
+ * 直接检测的耗时；加载失败时不比较。
+ */
+const char* const DefaultOldCascade =
+    "/usr/local/share/OpenCV/haarcascades/haarcascade_frontalface_alt.xml";
+
+static bool LoadOldCascade(cv::CascadeClassifier& cascade)
+{
+    const char* path = std::getenv("PORTRAIT_OLD_CASCADE");
+    return cascade.load(path != nullptr ? path : DefaultOldCascade) && !cascade.empty();
+}
+
+//用旧格式分类器执行Repeat次直接检测（参数同DetectFaces），返回平均耗时（毫秒）
+static double TimeOldCascade(const cv::Mat& photo, cv::CascadeClassifier& cascade,
+                             const ProcessingProfile& profile)
+{
+    cv::Mat gray;
+    cv::cvtColor(photo, gray, CV_BGR2GRAY);
+    const cv::Size min_size(profile.detect_min_face_size, profile.detect_min_face_size);
+    const int min_neighbors = 2; //同facedetect.cc的MinNeighbors
+    std::vector<cv::Rect> faces;
+    sybie::common::TestTimer timer;
+    for (int i = 0 ; i < Repeat ; i++)
+        cascade.detectMultiScale(gray, faces, profile.detect_scale_factor,
+                                 min_neighbors, 0, min_size);
+    return timer.GetTimeSpan().ToMilliSeconds() / Repeat;
+}
+
+static void BenchmarkDetection(const cv::Mat& photo)
+{
+    ProcessingProfile direct = ProcessingProfile::Balanced();
+    direct.detect_coarse_face_size = 0;
+    ProcessingProfile coarse = ProcessingProfile::Balanced();
+    ProcessingProfile native = coarse;
+    native.face_detector = FaceDetectorNative;
+    cv::CascadeClassifier old_cascade;
+    const bool has_old = LoadOldCascade(old_cascade);
+
+    std::cout << "megapixels\tdirect(ms)\tcoarse-to-fine(ms)\tnative(ms)\told-format(ms)\tfaces"
+              << std::endl;
+    for (double megapixels : DetectMegapixels)
+    {
+        const double scale = std::sqrt(megapixels * 1e6 / photo.total());
+        cv::Mat resized;
+        cv::resize(photo, resized,
+                   cv::Size(cvRound(photo.cols * scale), cvRound(photo.rows * scale)),
+                   0, 0, scale < 1 ? cv::INTER_AREA : cv::INTER_LINEAR);
+        cv::Mat gray;
+        cv::cvtColor(resized, gray, CV_BGR2GRAY);
+        std::cout << megapixels
+                  << "\t" << TimeDetection(resized, direct)
+                  << "\t" << TimeDetection(resized, coarse)
+                  << "\t" << TimeDetection(resized, native)
+                  << "\t";
+        if (has_old)
+            std::cout << TimeOldCascade(resized, old_cascade, direct);
+        else
+            std::cout << "-";
+        std::cout << "\t" << DetectFaces(gray, coarse).size()
+                  << std::endl;
+    }
+}
+
+//执行Repeat次GrabCut，返回最后一次的结果，平均耗时（毫秒）写入milliseconds
+static cv::Mat TimeGrabCut(const cv::Mat& image, const cv::Rect& face_area,
+                           const ProcessingProfile& profile,
+                           double& milliseconds)
+{
+    cv::Mat image_grab, image_init, mask;
+    ResizeForGrabCut(image, image_grab, image_init, profile);
+    sybie::common::TestTimer timer;
+    for (int i = 0 ; i < Repeat ; i++)
+        mask = GetGrabCutMask(image, image_grab, image_init,
+                              face_area, cv::Mat(), profile);
+    milliseconds = timer.GetTimeSpan().ToMilliSeconds() / Repeat;
+    return mask;
+}
+
+//执行Repeat次边缘混合，返回最后一次的结果，平均耗时（毫秒）写入milliseconds
+static cv::Mat TimeMatting(const cv::Mat& image, const cv::Mat& mask,
+                           const ProcessingProfile& profile,
+                           double& milliseconds)
+{
+    cv::Mat matte;
+    sybie::common::TestTimer timer;
+    for (int i = 0 ; i < Repeat ; i++)
+        matte = MatteFromMask(image, mask, profile);
+    milliseconds = timer.GetTimeSpan().ToMilliSeconds() / Repeat;
+    return matte;
+}
+
+int _main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout<<"Usage: " << argv[0] << " <files...>"<<std::endl;
+        return 1;
+    }
+
+    ProcessingProfile sampling = ProcessingProfile::Balanced();
+    sampling.matting_backend = MattingSampling;
+    ProcessingProfile guided = sampling;
+    guided.matting_backend = MattingGuided;
+    ProcessingProfile whole = sampling;
+    whole.grabcut_region = GrabCutWholeImage;
+
+    std::cout << std::fixed << std::setprecision(2)
+              << "file\tdetect(ms)\tgrabcut(ms)\tgrabcut-whole(ms)\tmask-diff(%)"
+              << "\tsampling(ms)\tguided(ms)\terror(all)\terror(border)"
+              << std::endl;
+    double total_detect = 0, total_grabcut = 0, total_whole = 0, total_mask_diff = 0;
+    double total_sampling = 0, total_guided = 0;
+    double total_error_all = 0, total_error_border = 0;
+    int count = 0;
+    for (int index = 1 ; index < argc ; index++)
+    {
+        const std::string filename(argv[index]);
+        try
+        {
+            const cv::Mat photo = cv::imread(filename, CV_LOAD_IMAGE_COLOR);
+            const double detect_ms = TimeDetection(photo, sampling);
+
+            //两种GrabCut范围的耗时和差异（以整个图像为参照）
+            SemiData semi = PortraitProcessSemi(photo, FaceResizeTo, sampling);
+            const cv::Mat image = semi.GetImage();
+            double grabcut_ms, whole_ms;
+            const cv::Mat mask = TimeGrabCut(image, semi.GetFaceArea(), sampling, grabcut_ms);
+            const cv::Mat mask_whole = TimeGrabCut(image, semi.GetFaceArea(), whole, whole_ms);
+            const double mask_diff = CompareMask(mask, mask_whole);
+
+            //两种边缘混合算法使用同一个GrabCut结果
+
+            double sampling_ms, guided_ms;
+            const cv::Mat reference = TimeMatting(image, mask, sampling, sampling_ms);
+            const cv::Mat matte = TimeMatting(image, mask, guided, guided_ms);
+            const AlphaError error = CompareAlpha(
+                matte, reference, MakeTrimap(image, mask, sampling));
+
+            std::cout << filename << "\t" << detect_ms
+                      << "\t" << grabcut_ms << "\t" << whole_ms << "\t" << mask_diff
+                      << "\t" << sampling_ms << "\t" << guided_ms
+                      << "\t" << error.mean_all << "\t" << error.mean_border
+                      << std::endl;
+            total_detect += detect_ms;
+            total_grabcut += grabcut_ms;
+            total_whole += whole_ms;
+            total_mask_diff += mask_diff;
+            total_sampling += sampling_ms;
+            total_guided += guided_ms;
+            total_error_all += error.mean_all;
+            total_error_border += error.mean_border;
+            count++;
+        }
+        catch (std::exception& err)
+        {
+            std::cout << filename << "\t" << err.what() << std::endl;
+        }
+    }
+
+    if (count > 0)
+        std::cout << "mean\t" << total_detect / count
+                  << "\t" << total_grabcut / count
+                  << "\t" << total_whole / count
+                  << "\t" << total_mask_diff / count
+                  << "\t" << total_sampling / count
+                  << "\t" << total_guided / count
+                  << "\t" << total_error_all / count
+                  << "\t" << total_error_border / count
+                  << std::endl;
+
+    //用第一张照片测量不同分辨率下的检测耗时
+    const cv::Mat photo = cv::imread(argv[1], CV_LOAD_IMAGE_COLOR);
+    if (photo.data != nullptr)
+        BenchmarkDetection(photo);
+
+    sybie::common::StatingTestTimer::ShowAll(std::cout);
+    return 0;
+}
+
+}  //namespace portrait
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        portrait::_main(argc, argv);
+    }
+    catch (std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
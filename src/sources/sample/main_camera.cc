@@ -5,7 +5,6 @@
 #include "opencv2/opencv.hpp"
 
 #include "portrait/portrait.hh"
-#include "sybie/common/Time.hh"
 
 namespace portrait {
 
@@ -20,6 +19,21 @@ const std::vector<cv::Vec3b> NewBackColor({
         { 240, 240, 240 }
 });
 
+const char* const StageNames[StreamStageCount] = {"capture", "detect", "matte", "mix"};
+
+static void ShowStats(const StreamPipeline& pipeline, double latency_ms)
+{
+    for (int i = 0 ; i < StreamStageCount ; i++)
+    {
+        const StreamStageStats stats = pipeline.GetStats((StreamStage)i);
+        std::cout << StageNames[i] << ": " << stats.mean_ms << "ms"
+                  << " (processed " << stats.processed
+                  << ", dropped " << stats.dropped
+                  << ", failed " << stats.failed << ")" << std::endl;
+    }
+    std::cout << "latency: " << latency_ms << "ms" << std::endl;
+}
+
 int _main(int argc, char** argv)
 {
     //初始化摄像头
@@ -31,54 +45,53 @@ int _main(int argc, char** argv)
 
     //窗体
     cv::namedWindow(WindowName, CV_WINDOW_AUTOSIZE);
-    cv::namedWindow(WindowName + "_src", CV_WINDOW_AUTOSIZE);
     for (int i = 0; i < NewBackColor.size(); i++)
         cv::namedWindow(WindowName + std::to_string(i), CV_WINDOW_AUTOSIZE);
 
-    while (true)
+    //一次混合所有背景色
+    std::vector<MixTarget> mix_targets;
+    for (int i = 0; i < NewBackColor.size(); i++)
+        mix_targets.push_back(MixTarget(
+            cv::Size(PortraitWidth, PortraitHeight), 0, NewBackColor[i]));
+
+    //读取、跟踪、抠图、混合在流水线的各线程中执行，本线程只负责显示
+    StreamPipeline pipeline(
+        [&cam](cv::Mat& frame) { return cam.read(frame); },
+        FaceResizeTo, mix_targets,
+        ProcessingProfile::Fast()); //实时预览，速度优先
+
+    StreamPreview preview;
+    StreamResult result;
+    result.latency_ms = 0;
+    int key;
+    while ((key = cv::waitKey(1)) != 27 && pipeline.IsRunning())
     {
-        //拍照
-        cv::Mat frame;
-        int key;
-        while ((key = cv::waitKey(1)) == -1)
+        //每帧显示人脸跟踪结果
+        if (pipeline.TryGetPreview(preview))
         {
-            if (!cam.read(frame))
-                throw std::runtime_error("Failed read camera.");
+            const TrackingResult& tracking = preview.tracking;
+            cv::Mat frame = preview.frame.clone();
+            if (tracking.found)
+                cv::rectangle(frame, tracking.face, cv::Scalar(0, 255, 0), 2);
+            cv::putText(frame,
+                        std::to_string(tracking.face_count) + " face(s), "
+                        + std::to_string((int)tracking.milliseconds) + "ms"
+                        + (tracking.full_detection ? " (detect)" : ""),
+                        cv::Point(10, 30), cv::FONT_HERSHEY_SIMPLEX, 0.8,
+                        tracking.found ? cv::Scalar(0, 255, 0) : cv::Scalar(0, 0, 255), 2);
             cv::imshow(WindowName, frame);
         }
-        if (key == 27)
-            break;
-
-        //开始计时
-        sybie::common::StatingTestTimer::ResetAll();
-        sybie::common::StatingTestTimer timer("All");
-
-        try
-        {
-            //抠图
-            SemiData semi = PortraitProcessSemi(std::move(frame), FaceResizeTo);
-            cv::imshow(WindowName + "_src", semi.GetImageWithLines());
 
-            //针对每种背景色混合背景
+        //有新的抠图结果时显示
+        if (pipeline.TryGetResult(result))
             for (int i = 0; i < NewBackColor.size(); i++)
-            {
-                //混合
-                cv::Mat img_mix = PortraitMix(
-                    semi, cv::Size(PortraitWidth, PortraitHeight),
-                    0, NewBackColor[i]);
-                //显示结果
-                cv::imshow(WindowName + std::to_string(i), img_mix);
-            }
-        }
-        catch (std::exception& err)
-        {
-            std::cout << "Error: " << err.what() << std::endl;
-            continue;
-        }
+                cv::imshow(WindowName + std::to_string(i), result.outputs[i]);
 
-        timer.Finish();
-        sybie::common::StatingTestTimer::ShowAll(std::cout);
+        if (key == ' ') //空格：显示各阶段的统计
+            ShowStats(pipeline, result.latency_ms);
     }
+    pipeline.Stop();
+    ShowStats(pipeline, result.latency_ms);
     return 0;
 }
 
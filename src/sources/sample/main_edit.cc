@@ -27,7 +27,7 @@ public:
         : _semi(semi),
         _window_name(WindowName + "_edit:" + _caption),
         _drawing_front(false), _drawing_back(false),
-        _canvas(), _alpha(), _stroke(semi.GetSize(), CV_8UC1)
+        _canvas(), _stroke(semi.GetSize(), CV_8UC1)
     {
         cv::namedWindow(_window_name, CV_WINDOW_AUTOSIZE);
         cv::setMouseCallback(_window_name, _OnMouse, this);
@@ -53,7 +53,6 @@ private:
     bool _drawing_front, _drawing_back;
 
     cv::Mat _canvas;
-    cv::Mat _alpha;
     cv::Mat _stroke;
 private:
 
@@ -67,7 +66,6 @@ private:
     {
         SetStroke(_semi, _stroke);
         _canvas = PortraitMixFull(_semi, cv::Vec3b(0, 255, 0), 0.4);
-        _alpha = _semi.GetAlpha();
         _FlashWindow();
     }
 
@@ -105,7 +103,9 @@ private:
     {
         _drawing_front = false;
         _drawing_back = false;
-        switch (_alpha.at<uint8_t>(y, x))
+        if (x < 0 || y < 0 || x >= _canvas.cols || y >= _canvas.rows)
+            return;
+        switch (_semi.GetAlphaRow(y)[x]) //只读取，不复制Alpha
         {
         default: //在边缘点下鼠标，什么都不做
             break;
@@ -186,6 +186,11 @@ int _main(int argc, char** argv)
             throw std::runtime_error("Failed open camera.");
         cam.set(CV_CAP_PROP_FRAME_WIDTH, FrameWidth);
         cam.set(CV_CAP_PROP_FRAME_HEIGHT, FrameHeight);
+        //预览时跟踪人脸，并实时合成到目标背景上，便于调整姿势
+        PreviewEngine preview_engine(
+            MixTarget(cv::Size(PortraitWidth, PortraitHeight), 0, NewBackColor),
+            FaceResizeTo);
+        cv::Mat preview_mix;
         while (true)
         {
             cv::Mat frame;
@@ -194,7 +199,13 @@ int _main(int argc, char** argv)
             {
                 if (!cam.read(frame))
                     throw std::runtime_error("Failed read camera.");
-                cv::imshow(WindowName + "_cam", frame);
+                const PreviewStats stats = preview_engine.Render(frame, preview_mix);
+                cv::Mat preview = frame.clone();
+                if (stats.found)
+                    cv::rectangle(preview, stats.face, cv::Scalar(0, 255, 0), 2);
+                cv::imshow(WindowName + "_cam", preview);
+                if (stats.found)
+                    cv::imshow(WindowName + "_preview", preview_mix);
             }
             if (key == 27)
                 return 0;
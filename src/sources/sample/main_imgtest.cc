@@ -30,6 +30,12 @@ int _main(int argc, char** argv)
     for (int i = 0; i < NewBackColor.size(); i++)
         cv::namedWindow(WindowName + std::to_string(i), CV_WINDOW_AUTOSIZE);
 
+    std::vector<MixTarget> mix_targets;
+    for (int i = 0 ; i < NewBackColor.size() ; i++)
+        mix_targets.push_back(MixTarget(
+            cv::Size(PortraitWidth, PortraitHeight), 0, NewBackColor[i]));
+    std::vector<cv::Mat> mix_results;
+
     int index = 1; //显示的文件索引
     while (true)
     {
@@ -37,22 +43,27 @@ int _main(int argc, char** argv)
         cv::Mat image = cv::imread(filename, CV_LOAD_IMAGE_COLOR);
         cv::Mat image_show = cv::Mat(PortraitHeight, PortraitWidth, CV_8UC3);
         image_show = cv::Scalar(0,0,0);
+        PhotoValidation validation;
+        bool validated = false;
         try
         {
+            //抠图前的快速检查，只显示结果，不影响处理
+            validation = ValidatePhoto(
+                image, FaceResizeTo, cv::Size(PortraitWidth, PortraitHeight), 0);
+            validated = true;
+
             //抠图
             SemiData semi = PortraitProcessSemi(std::move(image), FaceResizeTo);
             image_show = semi.GetImageWithLines();
+            cv::putText(image_show,
+                        semi.GetMattingPath() == MattingPathColorKey ? "color key" : "grabcut",
+                        cv::Point(0,45),
+                        cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(255,255,0));
 
-            //针对每种背景色混合背景
+            //一次混合所有背景色
+            PortraitMixMulti(semi, mix_targets, mix_results);
             for (int i = 0 ; i < NewBackColor.size() ; i++)
-            {
-                //混合
-                cv::Mat img_mix = PortraitMix(
-                    semi, cv::Size(PortraitWidth, PortraitHeight),
-                    0, NewBackColor[i]);
-                //显示结果
-                cv::imshow(WindowName + std::to_string(i), img_mix);
-            }
+                cv::imshow(WindowName + std::to_string(i), mix_results[i]); //显示结果
         }
         catch (std::exception& err)
         {
@@ -61,6 +72,14 @@ int _main(int argc, char** argv)
         }
         cv::putText(image_show, filename, cv::Point(0,30),
                     cv::FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(0,255,0));
+        if (validated)
+            cv::putText(image_show,
+                        "issues " + std::to_string(validation.issues)
+                        + " sharpness " + std::to_string((int)validation.sharpness)
+                        + " brightness " + std::to_string((int)validation.brightness),
+                        cv::Point(0,75), cv::FONT_HERSHEY_SIMPLEX, 0.5,
+                        validation.issues == PhotoOK ? cv::Scalar(0,255,0)
+                                                     : cv::Scalar(0,0,255));
         cv::imshow(WindowName + "_src", image_show);
 
         while (true)
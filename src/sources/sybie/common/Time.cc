@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <queue>
 
 #ifdef _WIN32
@@ -494,29 +495,40 @@ TimeSpan TestTimer::GetTimeSpanAndReset()
 
 //class StatingTestTimerGlobal
 
+//可在多个线程中同时计时，统计结果由_mutex保护
 class StatingTestTimerGlobal
 {
 public: //static
     static StatingTestTimerGlobal& Get()
     {
-        static StatingTestTimerGlobal global_instance;
-        return global_instance;
+        return _global_instance;
     }
 public:
     void Add(const std::string& key, const TimeSpan time)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         _stat_map[key] += time;
     }
     void Reset(const std::string& key)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         _stat_map[key] = TimeSpan::FromSeconds(0);
     }
     const TimeSpan GetStat(const std::string& key)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         return _stat_map[key];
     }
+    const TimeSpan GetStatAndReset(const std::string& key)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        TimeSpan result = _stat_map[key];
+        _stat_map[key] = TimeSpan::FromSeconds(0);
+        return result;
+    }
     const void ShowAll(std::ostream& os)
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         for (auto& pair_key_time : _stat_map)
         {
             os<<"["<<pair_key_time.first<<"]"<<pair_key_time.second<<std::endl;
@@ -524,6 +536,7 @@ public:
     }
     const void ResetAll()
     {
+        std::lock_guard<std::mutex> lock(_mutex);
         for (auto& pair_key_time : _stat_map)
         {
             pair_key_time.second = TimeSpan::FromSeconds(0);
@@ -532,11 +545,17 @@ public:
 
     ~StatingTestTimerGlobal() {}
 private:
-    StatingTestTimerGlobal() : _stat_map() { }
+    StatingTestTimerGlobal() : _mutex(), _stat_map() { }
 
+    //在main之前构造：VS2013的函数内静态变量的初始化不是线程安全的
+    static StatingTestTimerGlobal _global_instance;
+
+    std::mutex _mutex;
     std::map<std::string, TimeSpan> _stat_map;
 }; //class StatingTestTimerGlobal
 
+StatingTestTimerGlobal StatingTestTimerGlobal::_global_instance;
+
 //StatingTestTimer
 
 TimeSpan StatingTestTimer::GetStatTime(const std::string& stat_key)
@@ -546,9 +565,7 @@ TimeSpan StatingTestTimer::GetStatTime(const std::string& stat_key)
 
 TimeSpan StatingTestTimer::GetStatTimeAndReset(const std::string& stat_key)
 {
-    TimeSpan result = StatingTestTimerGlobal::Get().GetStat(stat_key);
-    StatingTestTimerGlobal::Get().Reset(stat_key);
-    return result;
+    return StatingTestTimerGlobal::Get().GetStatAndReset(stat_key);
 }
 
 void StatingTestTimer::ShowAll(std::ostream& os)
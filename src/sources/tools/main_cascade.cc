@@ -0,0 +1,170 @@
+//把OpenCV 1.x（旧式）的Haar分类器转换为OpenCV 2.x（新式）的格式。
+//
+//旧式分类器只能由cv::CascadeClassifier的单线程旧实现（cvHaarDetectObjects）执行，
+//新式分类器使用特征计算器（FeatureEvaluator），可并行检测。
+//两种格式的特征和阈值含义相同（都按窗口内去掉1像素边框的区域归一化），
+//因此只需改写数据的组织方式：
+//  旧式：stages[] { trees[] { nodes[] { feature, threshold, left_val|left_node, right_val|right_node } } }
+//  新式：stages[] { weakClassifiers[] { internalNodes[], leafValues[] } }, features[]
+//internalNodes每4个数为一个节点：left right featureIdx threshold，
+//left、right大于0为节点序号，小于或等于0为叶子序号的相反数。
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "opencv2/opencv.hpp"
+
+namespace portrait {
+namespace {
+
+//读出文件开头的注释（许可协议），转换后保留
+std::string ReadLeadingComment(const std::string& filename)
+{
+    std::ifstream ifs(filename);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    const std::string text = buffer.str();
+    const size_t begin = text.find("<!--");
+    const size_t end = text.find("-->");
+    const size_t storage = text.find("<opencv_storage>");
+    if (begin == std::string::npos || end == std::string::npos || begin > storage)
+        return std::string();
+    return text.substr(begin + 4, end - begin - 4);
+}
+
+//转换一棵树，特征追加到features
+void ConvertTree(const cv::FileNode& tree,
+                 cv::FileStorage& out,
+                 std::vector<cv::FileNode>& features)
+{
+    std::vector<double> leaves;
+    out << "{" << "internalNodes" << "[:";
+    for (int k = 0 ; k < (int)tree.size() ; k++)
+    {
+        const cv::FileNode node = tree[k];
+        int child[2];
+        const char* const node_keys[2] = {"left_node", "right_node"};
+        const char* const val_keys[2] = {"left_val", "right_val"};
+        for (int side = 0 ; side < 2 ; side++)
+        {
+            if (!node[node_keys[side]].empty())
+            {
+                child[side] = (int)node[node_keys[side]];
+            }
+            else
+            {
+                child[side] = -(int)leaves.size();
+                leaves.push_back((double)node[val_keys[side]]);
+            }
+        }
+        out << child[0] << child[1]
+            << (int)features.size() << (double)node["threshold"];
+        features.push_back(node["feature"]);
+    }
+    out << "]" << "leafValues" << "[:";
+    for (size_t i = 0 ; i < leaves.size() ; i++)
+        out << leaves[i];
+    out << "]" << "}";
+}
+
+void WriteFeature(const cv::FileNode& feature, cv::FileStorage& out)
+{
+    out << "{" << "rects" << "[";
+    const cv::FileNode rects = feature["rects"];
+    for (cv::FileNodeIterator it = rects.begin() ; it != rects.end() ; ++it)
+    {
+        std::vector<double> rect;
+        *it >> rect;
+        if (rect.size() != 5)
+            throw std::runtime_error("Invalid feature rect.");
+        out << "[:" << (int)rect[0] << (int)rect[1] << (int)rect[2] << (int)rect[3]
+            << rect[4] << "]";
+    }
+    out << "]" << "tilted" << (int)feature["tilted"] << "}";
+}
+
+void Convert(const std::string& in_filename, const std::string& out_filename)
+{
+    cv::FileStorage in(in_filename, cv::FileStorage::READ);
+    if (!in.isOpened())
+        throw std::runtime_error("Cannot open input file: " + in_filename);
+    const cv::FileNode cascade = in.getFirstTopLevelNode();
+    const cv::FileNode stages = cascade["stages"];
+    std::vector<int> size;
+    cascade["size"] >> size;
+    if (stages.empty() || size.size() != 2)
+        throw std::runtime_error("Not an old format cascade: " + in_filename);
+
+    int max_weak_count = 0;
+    for (cv::FileNodeIterator it = stages.begin() ; it != stages.end() ; ++it)
+        max_weak_count = std::max(max_weak_count, (int)(*it)["trees"].size());
+
+    cv::FileStorage out(out_filename, cv::FileStorage::WRITE);
+    if (!out.isOpened())
+        throw std::runtime_error("Cannot open output file: " + out_filename);
+    const std::string comment = ReadLeadingComment(in_filename);
+    if (!comment.empty())
+        out.writeComment(comment);
+
+    out << "cascade" << "{:opencv-cascade-classifier"
+        << "stageType" << "BOOST"
+        << "featureType" << "HAAR"
+        << "height" << size[1]
+        << "width" << size[0]
+        << "stageParams" << "{" << "maxWeakCount" << max_weak_count << "}"
+        << "featureParams" << "{" << "maxCatCount" << 0 << "}"
+        << "stageNum" << (int)stages.size()
+        << "stages" << "[";
+    std::vector<cv::FileNode> features;
+    int index = 0;
+    for (cv::FileNodeIterator it = stages.begin() ; it != stages.end() ; ++it, ++index)
+    {
+        //只支持逐级串联的分类器（parent为上一级，没有分支）
+        if ((int)(*it)["parent"] != index - 1 || (int)(*it)["next"] != -1)
+            throw std::runtime_error("Tree-structured cascades are not supported.");
+        const cv::FileNode trees = (*it)["trees"];
+        out << "{"
+            << "maxWeakCount" << (int)trees.size()
+            << "stageThreshold" << (double)(*it)["stage_threshold"]
+            << "weakClassifiers" << "[";
+        for (cv::FileNodeIterator tree = trees.begin() ; tree != trees.end() ; ++tree)
+            ConvertTree(*tree, out, features);
+        out << "]" << "}";
+    }
+    out << "]" << "features" << "[";
+    for (size_t i = 0 ; i < features.size() ; i++)
+        WriteFeature(features[i], out);
+    out << "]" << "}";
+}
+
+int _main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        std::cout << "Usage: " << argv[0] << " <old cascade> <new cascade>" << std::endl;
+        return 1;
+    }
+    Convert(argv[1], argv[2]);
+    return 0;
+}
+
+}  //namespace
+}  //namespace portrait
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        return portrait::_main(argc, argv);
+    }
+    catch (std::exception& ex)
+    {
+        std::cerr << "FATAL: " << ex.what() << std::endl;
+        return 1;
+    }
+}